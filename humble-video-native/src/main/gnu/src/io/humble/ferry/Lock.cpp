@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "Lock.h"
+#include <sys/time.h>
+#include <errno.h>
+
+namespace io { namespace humble { namespace ferry
+{
+
+Lock :: Lock()
+{
+  pthread_mutex_init(&mMutex, 0);
+}
+
+Lock :: ~Lock()
+{
+  pthread_mutex_destroy(&mMutex);
+}
+
+void
+Lock :: lock()
+{
+  pthread_mutex_lock(&mMutex);
+}
+
+void
+Lock :: unlock()
+{
+  pthread_mutex_unlock(&mMutex);
+}
+
+Condition :: Condition()
+{
+  pthread_cond_init(&mCond, 0);
+}
+
+Condition :: ~Condition()
+{
+  pthread_cond_destroy(&mCond);
+}
+
+void
+Condition :: wait(Lock* lock)
+{
+  pthread_cond_wait(&mCond, &lock->mMutex);
+}
+
+bool
+Condition :: timedWait(Lock* lock, int64_t timeout)
+{
+  struct timeval now;
+  struct timespec until;
+
+  if (timeout < 0)
+    timeout = 0;
+  gettimeofday(&now, 0);
+  int64_t usecs = (int64_t)now.tv_usec + timeout;
+  until.tv_sec = now.tv_sec + (time_t)(usecs / 1000000);
+  until.tv_nsec = (long)(usecs % 1000000) * 1000;
+  return pthread_cond_timedwait(&mCond, &lock->mMutex, &until) != ETIMEDOUT;
+}
+
+void
+Condition :: signal()
+{
+  pthread_cond_signal(&mCond);
+}
+
+void
+Condition :: broadcast()
+{
+  pthread_cond_broadcast(&mCond);
+}
+
+}}}
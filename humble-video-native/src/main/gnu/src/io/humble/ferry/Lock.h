@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef LOCK_H_
+#define LOCK_H_
+
+#include <io/humble/ferry/Ferry.h>
+#include <pthread.h>
+
+namespace io { namespace humble { namespace ferry {
+
+  /**
+   * Internal Only.
+   * <p>
+   * A native (pthread) mutual-exclusion lock. Unlike {@link Mutex}
+   * this does not need a Java VM to work, and is meant for
+   * native code that starts its own threads.
+   * </p><p>
+   * Locks are not re-entrant.
+   * </p>
+   */
+  class VS_API_FERRY Lock
+  {
+  public:
+    Lock();
+    virtual ~Lock();
+
+    void lock();
+    void unlock();
+
+    /**
+     * Acquires a lock on construction and releases it on destruction.
+     */
+    class VS_API_FERRY Guard
+    {
+    public:
+      Guard(Lock* lock) : mLock(lock) { mLock->lock(); }
+      ~Guard() { mLock->unlock(); }
+    private:
+      Guard(const Guard&);
+      Guard& operator=(const Guard&);
+      Lock* mLock;
+    };
+
+  private:
+    Lock(const Lock&);
+    Lock& operator=(const Lock&);
+    pthread_mutex_t mMutex;
+    friend class Condition;
+  };
+
+  /**
+   * Internal Only.
+   * <p>
+   * A native condition variable to be used with a {@link Lock}.
+   * </p>
+   */
+  class VS_API_FERRY Condition
+  {
+  public:
+    Condition();
+    virtual ~Condition();
+
+    /**
+     * Releases the lock, waits to be signaled, and re-acquires
+     * the lock. The caller must hold the lock.
+     */
+    void wait(Lock* lock);
+    /**
+     * As {@link #wait(Lock*)}, but gives up after timeout
+     * microseconds.
+     * @return false if the wait timed out, true otherwise.
+     */
+    bool timedWait(Lock* lock, int64_t timeout);
+    void signal();
+    void broadcast();
+
+  private:
+    Condition(const Condition&);
+    Condition& operator=(const Condition&);
+    pthread_cond_t mCond;
+  };
+
+}}}
+
+#endif /*LOCK_H_*/
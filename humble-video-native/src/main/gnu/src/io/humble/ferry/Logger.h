@@ -198,6 +198,13 @@ namespace io { namespace humble { namespace ferry {
 #define VS_LOG_TRACE(...) \
   (void) vs_logger_static_context->trace(__FILE__, __LINE__, __VA_ARGS__)
 
+/**
+ * True if VS_LOG_TRACE messages would be logged. Use to skip building
+ * expensive trace messages on hot paths.
+ */
+#define VS_LOG_TRACE_ENABLED() \
+  (vs_logger_static_context->isLogging(io::humble::ferry::Logger::LEVEL_TRACE))
+
 #ifdef VS_DEBUG
 #define VS_ASSERT( expr , msg ) \
   do { \
@@ -254,6 +261,8 @@ namespace io { namespace humble { namespace ferry {
 #define VS_LOG_INFO(...) do { (void) vs_logger_static_context; } while(0)
 #define VS_LOG_DEBUG(...) do { (void) vs_logger_static_context; } while(0)
 #define VS_LOG_TRACE(...) do { (void) vs_logger_static_context; } while(0)
+#undef VS_LOG_TRACE_ENABLED
+#define VS_LOG_TRACE_ENABLED() (false)
 #else
 #ifdef VS_LOG_LOGLEVELS_ERROR
 #undef VS_LOG_WARN
@@ -264,6 +273,8 @@ namespace io { namespace humble { namespace ferry {
 #define VS_LOG_INFO(...) do { (void) vs_logger_static_context; } while(0)
 #define VS_LOG_DEBUG(...) do { (void) vs_logger_static_context; } while(0)
 #define VS_LOG_TRACE(...) do { (void) vs_logger_static_context; } while(0)
+#undef VS_LOG_TRACE_ENABLED
+#define VS_LOG_TRACE_ENABLED() (false)
 #else
 #ifdef VS_LOG_LOGLEVELS_WARN
 #undef VS_LOG_INFO
@@ -272,22 +283,30 @@ namespace io { namespace humble { namespace ferry {
 #define VS_LOG_INFO(...) do { (void) vs_logger_static_context; } while(0)
 #define VS_LOG_DEBUG(...) do { (void) vs_logger_static_context; } while(0)
 #define VS_LOG_TRACE(...) do { (void) vs_logger_static_context; } while(0)
+#undef VS_LOG_TRACE_ENABLED
+#define VS_LOG_TRACE_ENABLED() (false)
 #else
 #ifdef VS_LOG_LOGLEVELS_INFO
 #undef VS_LOG_DEBUG
 #undef VS_LOG_TRACE
 #define VS_LOG_DEBUG(...) do { (void) vs_logger_static_context; } while(0)
 #define VS_LOG_TRACE(...) do { (void) vs_logger_static_context; } while(0)
+#undef VS_LOG_TRACE_ENABLED
+#define VS_LOG_TRACE_ENABLED() (false)
 #else
 #ifdef VS_LOG_LOGLEVELS_DEBUG
 #undef VS_LOG_TRACE
 #define VS_LOG_TRACE(...) do { (void) vs_logger_static_context; } while(0)
+#undef VS_LOG_TRACE_ENABLED
+#define VS_LOG_TRACE_ENABLED() (false)
 #else
 #ifdef VS_LOG_LOGLEVELS_ALL
 #else
 #ifndef VS_DEBUG
 #undef VS_LOG_TRACE
 #define VS_LOG_TRACE(...) do { (void) vs_logger_static_context; } while(0)
+#undef VS_LOG_TRACE_ENABLED
+#define VS_LOG_TRACE_ENABLED() (false)
 #endif // ! VS_DEBUG
 #endif // VS_LOG_LOGLEVELS_ALL
 #endif // VS_LOG_LOGLEVELS_DEBUG
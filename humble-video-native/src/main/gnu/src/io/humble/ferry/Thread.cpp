@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/JNIHelper.h>
+#include <io/humble/ferry/Thread.h>
+#include <stdexcept>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.Thread);
+
+namespace io { namespace humble { namespace ferry
+{
+
+pthread_once_t Thread :: sKeyOnce = PTHREAD_ONCE_INIT;
+pthread_key_t Thread :: sKey;
+
+Thread :: Thread() : mStarted(false)
+{
+}
+
+Thread :: ~Thread()
+{
+  if (mStarted)
+    VS_LOG_ERROR("Destroying thread %p without joining it", this);
+}
+
+void
+Thread :: start()
+{
+  if (mStarted)
+    return;
+  pthread_once(&sKeyOnce, Thread::makeKey);
+  int retval = pthread_create(&mThread, 0, Thread::main, this);
+  if (retval)
+    throw std::runtime_error("could not create native thread");
+  mStarted = true;
+}
+
+void
+Thread :: join()
+{
+  if (!mStarted)
+    return;
+  pthread_join(mThread, 0);
+  mStarted = false;
+}
+
+bool
+Thread :: isStarted()
+{
+  return mStarted;
+}
+
+bool
+Thread :: isCurrentThread()
+{
+  return current() == this;
+}
+
+Thread*
+Thread :: current()
+{
+  pthread_once(&sKeyOnce, Thread::makeKey);
+  return (Thread*)pthread_getspecific(sKey);
+}
+
+void
+Thread :: makeKey()
+{
+  pthread_key_create(&sKey, 0);
+}
+
+void*
+Thread :: main(void* arg)
+{
+  Thread* self = (Thread*)arg;
+  pthread_setspecific(sKey, self);
+  try {
+    self->run();
+  } catch (std::exception & e) {
+    VS_LOG_ERROR("Uncaught exception in native thread %p: %s", self, e.what());
+  } catch (...) {
+    VS_LOG_ERROR("Uncaught exception in native thread %p", self);
+  }
+  // JNIHelper::getEnv attaches threads it does not know; let go of them
+  // before we exit or the VM will never shut down.
+  JavaVM* vm = JNIHelper::sGetVM();
+  if (vm) {
+    JNIEnv* env = 0;
+    if (vm->GetEnv((void**)(void*)&env, JNIHelper::sGetJNIVersion()) == JNI_OK)
+      vm->DetachCurrentThread();
+  }
+  pthread_setspecific(sKey, 0);
+  return 0;
+}
+
+}}}
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef THREAD_H_
+#define THREAD_H_
+
+#include <io/humble/ferry/Lock.h>
+
+namespace io { namespace humble { namespace ferry {
+
+  /**
+   * Internal Only.
+   * <p>
+   * A native thread. Subclasses implement {@link #run()}, and
+   * callers {@link #start()} and {@link #join()} it. A thread
+   * may be started again once it has been joined.
+   * </p><p>
+   * If running inside a Java VM, any JNIEnv the thread attaches
+   * while running is detached before the thread exits. Exceptions
+   * escaping {@link #run()} are logged and swallowed.
+   * </p>
+   */
+  class VS_API_FERRY Thread
+  {
+  public:
+    virtual ~Thread();
+
+    /**
+     * Starts the thread. Does nothing if already started.
+     */
+    void start();
+    /**
+     * Waits for the thread to exit. Does nothing if not started.
+     */
+    void join();
+    /**
+     * @return true if the thread was started and has not yet been joined.
+     */
+    bool isStarted();
+    /**
+     * @return true if the calling thread is this thread.
+     */
+    bool isCurrentThread();
+    /**
+     * @return the Thread object for the calling thread, or null if the
+     *   caller was not started by a Thread.
+     */
+    static Thread* current();
+
+  protected:
+    Thread();
+    virtual void run()=0;
+
+  private:
+    Thread(const Thread&);
+    Thread& operator=(const Thread&);
+    static void* main(void*);
+    static void makeKey();
+    static pthread_once_t sKeyOnce;
+    static pthread_key_t sKey;
+
+    pthread_t mThread;
+    bool mStarted;
+  };
+
+}}}
+
+#endif /*THREAD_H_*/
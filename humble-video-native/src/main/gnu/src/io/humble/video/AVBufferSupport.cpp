@@ -25,6 +25,8 @@
 
 #include "AVBufferSupport.h"
 
+#include <cstring>
+
 using namespace io::humble::ferry;
 
 namespace io {
@@ -76,6 +78,35 @@ AVBufferSupport::wrapBuffer(Buffer* buf, void* data, int32_t size)
   return retval;
 }
 
+void
+AVBufferSupport::resetFrame(AVFrame* frame)
+{
+  AVFrame kept = *frame;
+  bool ownExtendedData = frame->extended_data != frame->data;
+
+  // take the data out of frame so unreferencing it leaves the data be
+  memset(frame->buf, 0, sizeof(frame->buf));
+  frame->extended_buf = 0;
+  frame->nb_extended_buf = 0;
+  frame->extended_data = frame->data;
+  av_frame_unref(frame);
+
+  memcpy(frame->data, kept.data, sizeof(frame->data));
+  memcpy(frame->linesize, kept.linesize, sizeof(frame->linesize));
+  memcpy(frame->buf, kept.buf, sizeof(frame->buf));
+  frame->extended_buf = kept.extended_buf;
+  frame->nb_extended_buf = kept.nb_extended_buf;
+  frame->extended_data = ownExtendedData ? kept.extended_data : frame->data;
+  frame->format = kept.format;
+  frame->width = kept.width;
+  frame->height = kept.height;
+  frame->nb_samples = kept.nb_samples;
+  frame->sample_rate = kept.sample_rate;
+  frame->channel_layout = kept.channel_layout;
+  av_frame_set_channels(frame, av_frame_get_channels(&kept));
+  frame->opaque = kept.opaque;
+}
+
 void
 AVBufferSupport::bufferRelease(void * closure, uint8_t * buf) {
   Buffer* b = (Buffer*) closure;
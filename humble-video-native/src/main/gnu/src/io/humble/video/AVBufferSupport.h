@@ -48,6 +48,14 @@ public:
   static AVBufferRef* wrapBuffer(io::humble::ferry::Buffer* buf);
   static AVBufferRef* wrapBuffer(io::humble::ferry::Buffer* buf, void *data, int32_t size);
 
+  /**
+   * Puts every property of frame (time stamps, flags, side data, metadata
+   * and so on) back to its default, but keeps its data: the pointers,
+   * line sizes and buffers, and the format, dimensions and sample layout
+   * that describe them.
+   */
+  static void resetFrame(AVFrame* frame);
+
 private:
   static void bufferRelease(void * closure, uint8_t * buf);
   static void avBufferRelease(void * buf, void * closure);
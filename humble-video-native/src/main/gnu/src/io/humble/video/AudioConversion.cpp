@@ -0,0 +1,662 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "AudioConversion.h"
+
+#include <math.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define AUDIOCONVERSION_X86 1
+#include <immintrin.h>
+#define AUDIOCONVERSION_SSE4 __attribute__((target("sse4.1")))
+#define AUDIOCONVERSION_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace io {
+namespace humble {
+namespace video {
+
+/*
+ * Kernels over n samples of one or two channels. The vector versions hand
+ * whatever is left over at the end to the scalar ones.
+ */
+struct AudioConversion::Kernels
+{
+  void (*s16ToFlt)(float* dst, const int16_t* src, int32_t n);
+  void (*fltToS16)(int16_t* dst, const float* src, int32_t n);
+  // (a + b + 1) >> 1, which is how swresample mixes two S16 channels at
+  // half volume
+  void (*averageS16)(int16_t* dst, const int16_t* a, const int16_t* b,
+      int32_t n);
+  // (src * coef + 16384) >> 15
+  void (*scaleS16)(int16_t* dst, const int16_t* src, int32_t coef, int32_t n);
+  // coef * a + coef * b
+  void (*mixFlt)(float* dst, const float* a, const float* b, float coef,
+      int32_t n);
+  void (*scaleFlt)(float* dst, const float* src, float coef, int32_t n);
+  void (*interleave16)(int16_t* dst, const int16_t* a, const int16_t* b,
+      int32_t n);
+  void (*deinterleave16)(int16_t* a, int16_t* b, const int16_t* src,
+      int32_t n);
+  void (*interleave32)(float* dst, const float* a, const float* b, int32_t n);
+  void (*deinterleave32)(float* a, float* b, const float* src, int32_t n);
+};
+
+namespace {
+
+const int32_t sBlock = 1024;
+const int32_t sMaxChannels = 8;
+
+inline int16_t
+AudioConversion_fltToS16(float x)
+{
+  // clipped before rounding so that out of range samples cannot overflow
+  // lrintf; NaN ends up at the bottom, as it does with swresample
+  x *= 32768.0f;
+  x = x > -32768.0f ? x : -32768.0f;
+  x = x < 32767.0f ? x : 32767.0f;
+  return (int16_t)lrintf(x);
+}
+
+void
+scalar_s16ToFlt(float* dst, const int16_t* src, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = src[i] * (1.0f / 32768);
+}
+
+void
+scalar_fltToS16(int16_t* dst, const float* src, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = AudioConversion_fltToS16(src[i]);
+}
+
+void
+scalar_averageS16(int16_t* dst, const int16_t* a, const int16_t* b, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = (int16_t)((a[i] + b[i] + 1) >> 1);
+}
+
+void
+scalar_scaleS16(int16_t* dst, const int16_t* src, int32_t coef, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = (int16_t)((src[i] * coef + 16384) >> 15);
+}
+
+void
+scalar_mixFlt(float* dst, const float* a, const float* b, float coef,
+    int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = coef * a[i] + coef * b[i];
+}
+
+void
+scalar_scaleFlt(float* dst, const float* src, float coef, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = coef * src[i];
+}
+
+void
+scalar_interleave16(int16_t* dst, const int16_t* a, const int16_t* b,
+    int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    dst[2*i] = a[i];
+    dst[2*i+1] = b[i];
+  }
+}
+
+void
+scalar_deinterleave16(int16_t* a, int16_t* b, const int16_t* src, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    a[i] = src[2*i];
+    b[i] = src[2*i+1];
+  }
+}
+
+void
+scalar_interleave32(float* dst, const float* a, const float* b, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    dst[2*i] = a[i];
+    dst[2*i+1] = b[i];
+  }
+}
+
+void
+scalar_deinterleave32(float* a, float* b, const float* src, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    a[i] = src[2*i];
+    b[i] = src[2*i+1];
+  }
+}
+
+const AudioConversion::Kernels sScalar = {
+  scalar_s16ToFlt,
+  scalar_fltToS16,
+  scalar_averageS16,
+  scalar_scaleS16,
+  scalar_mixFlt,
+  scalar_scaleFlt,
+  scalar_interleave16,
+  scalar_deinterleave16,
+  scalar_interleave32,
+  scalar_deinterleave32,
+};
+
+#ifdef AUDIOCONVERSION_X86
+
+AUDIOCONVERSION_SSE4 void
+sse4_s16ToFlt(float* dst, const int16_t* src, int32_t n)
+{
+  const __m128 scale = _mm_set1_ps(1.0f / 32768);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+    _mm_storeu_ps(dst + i,
+        _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(s)), scale));
+    _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(
+        _mm_cvtepi16_epi32(_mm_srli_si128(s, 8))), scale));
+  }
+  scalar_s16ToFlt(dst + i, src + i, n - i);
+}
+
+AUDIOCONVERSION_SSE4 inline __m128i
+sse4_fltToS32(__m128 x)
+{
+  x = _mm_mul_ps(x, _mm_set1_ps(32768.0f));
+  x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-32768.0f)),
+      _mm_set1_ps(32767.0f));
+  // rounds to nearest even, as lrintf does
+  return _mm_cvtps_epi32(x);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_fltToS16(int16_t* dst, const float* src, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(
+        sse4_fltToS32(_mm_loadu_ps(src + i)),
+        sse4_fltToS32(_mm_loadu_ps(src + i + 4))));
+  scalar_fltToS16(dst + i, src + i, n - i);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_averageS16(int16_t* dst, const int16_t* a, const int16_t* b, int32_t n)
+{
+  // pavgw is unsigned, so flip the sign bits around it
+  const __m128i sign = _mm_set1_epi16((int16_t)0x8000);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i)), sign);
+    __m128i y = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(b + i)), sign);
+    _mm_storeu_si128((__m128i*)(dst + i),
+        _mm_xor_si128(_mm_avg_epu16(x, y), sign));
+  }
+  scalar_averageS16(dst + i, a + i, b + i, n - i);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_scaleS16(int16_t* dst, const int16_t* src, int32_t coef, int32_t n)
+{
+  const __m128i c = _mm_set1_epi16((int16_t)coef);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_mulhrs_epi16(
+        _mm_loadu_si128((const __m128i*)(src + i)), c));
+  scalar_scaleS16(dst + i, src + i, coef, n - i);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_mixFlt(float* dst, const float* a, const float* b, float coef, int32_t n)
+{
+  const __m128 c = _mm_set1_ps(coef);
+  int32_t i = 0;
+  for(; i + 4 <= n; i += 4)
+    _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(c, _mm_loadu_ps(a + i)),
+        _mm_mul_ps(c, _mm_loadu_ps(b + i))));
+  scalar_mixFlt(dst + i, a + i, b + i, coef, n - i);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_scaleFlt(float* dst, const float* src, float coef, int32_t n)
+{
+  const __m128 c = _mm_set1_ps(coef);
+  int32_t i = 0;
+  for(; i + 4 <= n; i += 4)
+    _mm_storeu_ps(dst + i, _mm_mul_ps(c, _mm_loadu_ps(src + i)));
+  scalar_scaleFlt(dst + i, src + i, coef, n - i);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_interleave16(int16_t* dst, const int16_t* a, const int16_t* b, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+    __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+    _mm_storeu_si128((__m128i*)(dst + 2*i), _mm_unpacklo_epi16(x, y));
+    _mm_storeu_si128((__m128i*)(dst + 2*i + 8), _mm_unpackhi_epi16(x, y));
+  }
+  scalar_interleave16(dst + 2*i, a + i, b + i, n - i);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_deinterleave16(int16_t* a, int16_t* b, const int16_t* src, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(src + 2*i));
+    __m128i y = _mm_loadu_si128((const __m128i*)(src + 2*i + 8));
+    // sign extend each half of every pair, then pack them back down
+    _mm_storeu_si128((__m128i*)(a + i), _mm_packs_epi32(
+        _mm_srai_epi32(_mm_slli_epi32(x, 16), 16),
+        _mm_srai_epi32(_mm_slli_epi32(y, 16), 16)));
+    _mm_storeu_si128((__m128i*)(b + i), _mm_packs_epi32(
+        _mm_srai_epi32(x, 16), _mm_srai_epi32(y, 16)));
+  }
+  scalar_deinterleave16(a + i, b + i, src + 2*i, n - i);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_interleave32(float* dst, const float* a, const float* b, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 4 <= n; i += 4) {
+    __m128 x = _mm_loadu_ps(a + i);
+    __m128 y = _mm_loadu_ps(b + i);
+    _mm_storeu_ps(dst + 2*i, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(dst + 2*i + 4, _mm_unpackhi_ps(x, y));
+  }
+  scalar_interleave32(dst + 2*i, a + i, b + i, n - i);
+}
+
+AUDIOCONVERSION_SSE4 void
+sse4_deinterleave32(float* a, float* b, const float* src, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 4 <= n; i += 4) {
+    __m128 x = _mm_loadu_ps(src + 2*i);
+    __m128 y = _mm_loadu_ps(src + 2*i + 4);
+    _mm_storeu_ps(a + i, _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(b + i, _mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 1, 3, 1)));
+  }
+  scalar_deinterleave32(a + i, b + i, src + 2*i, n - i);
+}
+
+const AudioConversion::Kernels sSse4 = {
+  sse4_s16ToFlt,
+  sse4_fltToS16,
+  sse4_averageS16,
+  sse4_scaleS16,
+  sse4_mixFlt,
+  sse4_scaleFlt,
+  sse4_interleave16,
+  sse4_deinterleave16,
+  sse4_interleave32,
+  sse4_deinterleave32,
+};
+
+AUDIOCONVERSION_AVX2 void
+avx2_s16ToFlt(float* dst, const int16_t* src, int32_t n)
+{
+  const __m256 scale = _mm256_set1_ps(1.0f / 32768);
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m256i lo = _mm256_cvtepi16_epi32(
+        _mm_loadu_si128((const __m128i*)(src + i)));
+    __m256i hi = _mm256_cvtepi16_epi32(
+        _mm_loadu_si128((const __m128i*)(src + i + 8)));
+    _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+    _mm256_storeu_ps(dst + i + 8,
+        _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+  }
+  // the SSE4 code that finishes off is not VEX encoded, and pays for
+  // every instruction it runs while the upper halves are dirty
+  _mm256_zeroupper();
+  sse4_s16ToFlt(dst + i, src + i, n - i);
+}
+
+AUDIOCONVERSION_AVX2 inline __m256i
+avx2_fltToS32(__m256 x)
+{
+  x = _mm256_mul_ps(x, _mm256_set1_ps(32768.0f));
+  x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-32768.0f)),
+      _mm256_set1_ps(32767.0f));
+  return _mm256_cvtps_epi32(x);
+}
+
+AUDIOCONVERSION_AVX2 void
+avx2_fltToS16(int16_t* dst, const float* src, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    // packs works within 128 bit lanes, so put the quarters back in order
+    __m256i s = _mm256_packs_epi32(avx2_fltToS32(_mm256_loadu_ps(src + i)),
+        avx2_fltToS32(_mm256_loadu_ps(src + i + 8)));
+    _mm256_storeu_si256((__m256i*)(dst + i),
+        _mm256_permute4x64_epi64(s, _MM_SHUFFLE(3, 1, 2, 0)));
+  }
+  _mm256_zeroupper();
+  sse4_fltToS16(dst + i, src + i, n - i);
+}
+
+AUDIOCONVERSION_AVX2 void
+avx2_averageS16(int16_t* dst, const int16_t* a, const int16_t* b, int32_t n)
+{
+  const __m256i sign = _mm256_set1_epi16((int16_t)0x8000);
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m256i x = _mm256_xor_si256(
+        _mm256_loadu_si256((const __m256i*)(a + i)), sign);
+    __m256i y = _mm256_xor_si256(
+        _mm256_loadu_si256((const __m256i*)(b + i)), sign);
+    _mm256_storeu_si256((__m256i*)(dst + i),
+        _mm256_xor_si256(_mm256_avg_epu16(x, y), sign));
+  }
+  _mm256_zeroupper();
+  sse4_averageS16(dst + i, a + i, b + i, n - i);
+}
+
+AUDIOCONVERSION_AVX2 void
+avx2_scaleS16(int16_t* dst, const int16_t* src, int32_t coef, int32_t n)
+{
+  const __m256i c = _mm256_set1_epi16((int16_t)coef);
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16)
+    _mm256_storeu_si256((__m256i*)(dst + i), _mm256_mulhrs_epi16(
+        _mm256_loadu_si256((const __m256i*)(src + i)), c));
+  _mm256_zeroupper();
+  sse4_scaleS16(dst + i, src + i, coef, n - i);
+}
+
+AUDIOCONVERSION_AVX2 void
+avx2_mixFlt(float* dst, const float* a, const float* b, float coef, int32_t n)
+{
+  const __m256 c = _mm256_set1_ps(coef);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(dst + i, _mm256_add_ps(
+        _mm256_mul_ps(c, _mm256_loadu_ps(a + i)),
+        _mm256_mul_ps(c, _mm256_loadu_ps(b + i))));
+  _mm256_zeroupper();
+  sse4_mixFlt(dst + i, a + i, b + i, coef, n - i);
+}
+
+AUDIOCONVERSION_AVX2 void
+avx2_scaleFlt(float* dst, const float* src, float coef, int32_t n)
+{
+  const __m256 c = _mm256_set1_ps(coef);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(dst + i, _mm256_mul_ps(c, _mm256_loadu_ps(src + i)));
+  _mm256_zeroupper();
+  sse4_scaleFlt(dst + i, src + i, coef, n - i);
+}
+
+// As with pictures, moving samples around gains little from wider
+// registers, so those kernels are shared with SSE4.
+const AudioConversion::Kernels sAvx2 = {
+  avx2_s16ToFlt,
+  avx2_fltToS16,
+  avx2_averageS16,
+  avx2_scaleS16,
+  avx2_mixFlt,
+  avx2_scaleFlt,
+  sse4_interleave16,
+  sse4_deinterleave16,
+  sse4_interleave32,
+  sse4_deinterleave32,
+};
+
+#endif // AUDIOCONVERSION_X86
+
+bool
+AudioConversion_supported(enum AVSampleFormat fmt)
+{
+  return fmt == AV_SAMPLE_FMT_S16 || fmt == AV_SAMPLE_FMT_S16P ||
+      fmt == AV_SAMPLE_FMT_FLT || fmt == AV_SAMPLE_FMT_FLTP;
+}
+
+}
+
+AudioConversion::Level
+AudioConversion::getBestLevel() {
+#ifdef AUDIOCONVERSION_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return LEVEL_AVX2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return LEVEL_SSE4;
+#endif
+  return LEVEL_SCALAR;
+}
+
+AudioConversion::AudioConversion() {
+  mLevel = LEVEL_SCALAR;
+  mKernels = &sScalar;
+  mOChannels = mIChannels = 0;
+  mOPlanar = mIPlanar = false;
+  mOFloat = mIFloat = false;
+  mMix = MIX_NONE;
+  mFltCoef = 1.0f;
+  mS16Coef = 32768;
+  mScratch = 0;
+}
+
+AudioConversion::~AudioConversion() {
+  av_free(mScratch);
+}
+
+AudioConversion*
+AudioConversion::make(
+    uint64_t outputLayout, enum AVSampleFormat outputFmt,
+    uint64_t inputLayout, enum AVSampleFormat inputFmt,
+    Level level) {
+  if (!AudioConversion_supported(outputFmt) ||
+      !AudioConversion_supported(inputFmt))
+    return 0;
+  int32_t outputChannels = av_get_channel_layout_nb_channels(outputLayout);
+  int32_t inputChannels = av_get_channel_layout_nb_channels(inputLayout);
+  Mix mix;
+  if (outputLayout == inputLayout && inputChannels > 0 &&
+      inputChannels <= sMaxChannels)
+    mix = MIX_NONE;
+  else if (outputLayout == AV_CH_LAYOUT_MONO &&
+      inputLayout == AV_CH_LAYOUT_STEREO)
+    mix = MIX_DOWN;
+  else if (outputLayout == AV_CH_LAYOUT_STEREO &&
+      inputLayout == AV_CH_LAYOUT_MONO)
+    mix = MIX_UP;
+  else
+    return 0;
+
+  AudioConversion* retval = new AudioConversion();
+  retval->mLevel = FFMIN(level, getBestLevel());
+#ifdef AUDIOCONVERSION_X86
+  if (retval->mLevel == LEVEL_AVX2)
+    retval->mKernels = &sAvx2;
+  else if (retval->mLevel == LEVEL_SSE4)
+    retval->mKernels = &sSse4;
+#endif
+  retval->mOChannels = outputChannels;
+  retval->mOPlanar = av_sample_fmt_is_planar(outputFmt);
+  retval->mOFloat = av_get_packed_sample_fmt(outputFmt) == AV_SAMPLE_FMT_FLT;
+  retval->mIChannels = inputChannels;
+  retval->mIPlanar = av_sample_fmt_is_planar(inputFmt);
+  retval->mIFloat = av_get_packed_sample_fmt(inputFmt) == AV_SAMPLE_FMT_FLT;
+  retval->mMix = mix;
+  // swresample's matrix: -3dB from each channel, scaled down to unity
+  // gain when mixing down to S16
+  retval->mFltCoef = (float)M_SQRT1_2;
+  if (mix == MIX_DOWN && !retval->mOFloat)
+    retval->mFltCoef = 0.5f;
+  retval->mS16Coef = (int32_t)lrintf(M_SQRT1_2 * 32768);
+  retval->mScratch = (uint8_t*)av_malloc(2 * sMaxChannels * sBlock *
+      sizeof(float));
+  if (!retval->mScratch) {
+    delete retval;
+    return 0;
+  }
+  return retval;
+}
+
+uint8_t*
+AudioConversion::scratch(int32_t set, int32_t channel) {
+  return mScratch + (set * sMaxChannels + channel) * sBlock * sizeof(float);
+}
+
+void
+AudioConversion::convert(uint8_t* const* out, const uint8_t* const* in,
+    int32_t n) {
+  for(int32_t offset = 0; offset < n; offset += sBlock)
+    convertBlock(out, in, offset, FFMIN(sBlock, n - offset));
+}
+
+void
+AudioConversion::convertBlock(uint8_t* const* out, const uint8_t* const* in,
+    int32_t offset, int32_t n) {
+  const Kernels* k = mKernels;
+  const int32_t iBytes = mIFloat ? 4 : 2;
+  const int32_t oBytes = mOFloat ? 4 : 2;
+  // 16 bit mixing only when both sides are S16, as in swresample
+  const bool toFloat = !mIFloat && mOFloat;
+  const bool fromFloat = mIFloat && !mOFloat;
+  const bool mixFloat = mIFloat || mOFloat;
+  // the last step may write straight into planar (or mono) output
+  const bool direct = mOPlanar || mOChannels == 1;
+  const bool last[3] = {
+      toFloat && !mMix && direct,
+      mMix && !fromFloat && direct,
+      fromFloat && direct,
+  };
+  int32_t set = 0;
+
+  // each channel, planar, in whatever the last step left it in
+  const uint8_t* src[sMaxChannels];
+  if (mIPlanar || mIChannels == 1) {
+    for(int32_t c = 0; c < mIChannels; c++)
+      src[c] = in[mIPlanar ? c : 0] + offset * iBytes;
+  } else {
+    const uint8_t* packed = in[0] + offset * iBytes * mIChannels;
+    for(int32_t c = 0; c < mIChannels; c++)
+      src[c] = scratch(set, c);
+    if (mIChannels == 2 && mIFloat)
+      k->deinterleave32((float*)scratch(set, 0), (float*)scratch(set, 1),
+          (const float*)packed, n);
+    else if (mIChannels == 2)
+      k->deinterleave16((int16_t*)scratch(set, 0), (int16_t*)scratch(set, 1),
+          (const int16_t*)packed, n);
+    else
+      for(int32_t c = 0; c < mIChannels; c++)
+        for(int32_t i = 0; i < n; i++)
+          memcpy(scratch(set, c) + i * iBytes,
+              packed + (i * mIChannels + c) * iBytes, iBytes);
+    set = 1 - set;
+  }
+
+  int32_t channels = mIChannels;
+  if (toFloat) {
+    for(int32_t c = 0; c < channels; c++) {
+      uint8_t* dst = last[0] ? out[mOPlanar ? c : 0] + offset * oBytes :
+          scratch(set, c);
+      k->s16ToFlt((float*)dst, (const int16_t*)src[c], n);
+      src[c] = dst;
+    }
+    set = 1 - set;
+  }
+
+  if (mMix == MIX_DOWN) {
+    uint8_t* dst = last[1] ? out[0] + offset * oBytes : scratch(set, 0);
+    if (mixFloat)
+      k->mixFlt((float*)dst, (const float*)src[0], (const float*)src[1],
+          mFltCoef, n);
+    else
+      k->averageS16((int16_t*)dst, (const int16_t*)src[0],
+          (const int16_t*)src[1], n);
+    src[0] = dst;
+    channels = 1;
+    set = 1 - set;
+  } else if (mMix == MIX_UP) {
+    // both channels get the same samples, so scale them once unless
+    // writing straight into planar output
+    const uint8_t* mono = src[0];
+    for(int32_t c = 0; c < (last[1] && mOPlanar ? 2 : 1); c++) {
+      uint8_t* dst = last[1] ? out[c] + offset * oBytes : scratch(set, 0);
+      if (mixFloat)
+        k->scaleFlt((float*)dst, (const float*)mono, mFltCoef, n);
+      else
+        k->scaleS16((int16_t*)dst, (const int16_t*)mono, mS16Coef, n);
+      src[c] = dst;
+    }
+    if (!(last[1] && mOPlanar))
+      src[1] = src[0];
+    channels = 2;
+    set = 1 - set;
+  }
+
+  if (fromFloat) {
+    const bool same = channels == 2 && src[1] == src[0];
+    for(int32_t c = 0; c < channels; c++) {
+      if (c && same && !(last[2] && mOPlanar)) {
+        src[c] = src[0];
+        continue;
+      }
+      uint8_t* dst = last[2] ? out[mOPlanar ? c : 0] + offset * oBytes :
+          scratch(set, c);
+      k->fltToS16((int16_t*)dst, (const float*)src[c], n);
+      src[c] = dst;
+    }
+    set = 1 - set;
+  }
+
+  if (last[0] || last[1] || last[2])
+    return;
+  if (direct) {
+    // nothing to convert; just a copy
+    for(int32_t c = 0; c < channels; c++)
+      memcpy(out[mOPlanar ? c : 0] + offset * oBytes, src[c], n * oBytes);
+    return;
+  }
+  uint8_t* packed = out[0] + offset * oBytes * channels;
+  if (channels == 2 && mOFloat)
+    k->interleave32((float*)packed, (const float*)src[0],
+        (const float*)src[1], n);
+  else if (channels == 2)
+    k->interleave16((int16_t*)packed, (const int16_t*)src[0],
+        (const int16_t*)src[1], n);
+  else
+    for(int32_t c = 0; c < channels; c++)
+      for(int32_t i = 0; i < n; i++)
+        memcpy(packed + (i * channels + c) * oBytes, src[c] + i * oBytes,
+            oBytes);
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
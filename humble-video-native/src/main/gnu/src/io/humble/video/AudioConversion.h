@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef AUDIOCONVERSION_H_
+#define AUDIOCONVERSION_H_
+
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/FfmpegIncludes.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. Converts audio between S16 and FLT, planar or
+ * interleaved, keeping the channel layout (of up to 8 channels) or mixing
+ * stereo down to mono or mono up to stereo, at one sample rate, with
+ * kernels written for SSE4 and AVX2 as well as in plain C++. The best the
+ * CPU supports is picked at run time, and all of them produce the same
+ * samples.
+ * <p>
+ * The samples are the same as swresample's with its default options:
+ * mixing is done in 16 bits when both sides are S16 and in float
+ * otherwise, with swresample's default matrix (-3dB for each channel,
+ * normalised to 0.5 when mixing down to S16), and floats are rounded to
+ * the nearest S16 and clipped.
+ * </p>
+ */
+class AudioConversion
+{
+public:
+  typedef enum Level {
+    LEVEL_SCALAR,
+    LEVEL_SSE4,
+    LEVEL_AVX2,
+  } Level;
+
+  /** @return the fastest kernels this CPU can run. */
+  static Level getBestLevel();
+
+  /**
+   * Gets a conversion, or 0 if these parameters are not among the ones
+   * supported.
+   *
+   * @param level The kernels to use; if the CPU cannot run them, the best
+   *   it can are used instead.
+   */
+  static AudioConversion* make(
+      uint64_t outputLayout, enum AVSampleFormat outputFmt,
+      uint64_t inputLayout, enum AVSampleFormat inputFmt,
+      Level level);
+
+  ~AudioConversion();
+
+  /** @return the kernels in use. */
+  Level getLevel() { return mLevel; }
+
+  /**
+   * Converts n samples per channel from in to out, which hold a pointer
+   * per channel for planar formats and a single pointer otherwise.
+   */
+  void convert(uint8_t* const* out, const uint8_t* const* in, int32_t n);
+
+  struct Kernels;
+
+private:
+  typedef enum Mix {
+    MIX_NONE,
+    MIX_DOWN,
+    MIX_UP,
+  } Mix;
+
+  AudioConversion();
+  AudioConversion(const AudioConversion&);
+  AudioConversion& operator=(const AudioConversion&);
+
+  void convertBlock(uint8_t* const* out, const uint8_t* const* in,
+      int32_t offset, int32_t n);
+  uint8_t* scratch(int32_t set, int32_t channel);
+
+  Level mLevel;
+  const Kernels* mKernels;
+  int32_t mOChannels;
+  bool mOPlanar;
+  bool mOFloat;
+  int32_t mIChannels;
+  bool mIPlanar;
+  bool mIFloat;
+  Mix mMix;
+  // the weight of each channel mixed in float, and in 1/32768ths when
+  // mixing up in 16 bits
+  float mFltCoef;
+  int32_t mS16Coef;
+  // two sets of a block per channel, to convert from one into the other
+  uint8_t* mScratch;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* AUDIOCONVERSION_H_ */
@@ -0,0 +1,343 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "AudioMix.h"
+
+#include <math.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define AUDIOMIX_X86 1
+#include <immintrin.h>
+#define AUDIOMIX_SSE4 __attribute__((target("sse4.1")))
+#define AUDIOMIX_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace io {
+namespace humble {
+namespace video {
+
+/*
+ * Kernels over n values. The vector versions hand whatever is left over at
+ * the end to the scalar ones.
+ */
+struct AudioMix::Kernels
+{
+  // dst = gain * src
+  void (*scaleFlt)(float* dst, const float* src, float gain, int32_t n);
+  // dst += gain * src
+  void (*addFlt)(float* dst, const float* src, float gain, int32_t n);
+  void (*scaleS16)(float* dst, const int16_t* src, float gain, int32_t n);
+  void (*addS16)(float* dst, const int16_t* src, float gain, int32_t n);
+  // rounds and clips sums of S16 samples
+  void (*storeS16)(int16_t* dst, const float* src, int32_t n);
+};
+
+namespace {
+
+const int32_t sBlock = 1024;
+
+void
+scalar_scaleFlt(float* dst, const float* src, float gain, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = gain * src[i];
+}
+
+void
+scalar_addFlt(float* dst, const float* src, float gain, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] += gain * src[i];
+}
+
+void
+scalar_scaleS16(float* dst, const int16_t* src, float gain, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = gain * (float)src[i];
+}
+
+void
+scalar_addS16(float* dst, const int16_t* src, float gain, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] += gain * (float)src[i];
+}
+
+void
+scalar_storeS16(int16_t* dst, const float* src, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    // clipped before rounding so that loud sums cannot overflow lrintf
+    float x = src[i];
+    x = x > -32768.0f ? x : -32768.0f;
+    x = x < 32767.0f ? x : 32767.0f;
+    dst[i] = (int16_t)lrintf(x);
+  }
+}
+
+const AudioMix::Kernels sScalar = {
+  scalar_scaleFlt,
+  scalar_addFlt,
+  scalar_scaleS16,
+  scalar_addS16,
+  scalar_storeS16,
+};
+
+#ifdef AUDIOMIX_X86
+
+AUDIOMIX_SSE4 void
+sse4_scaleFlt(float* dst, const float* src, float gain, int32_t n)
+{
+  const __m128 g = _mm_set1_ps(gain);
+  int32_t i = 0;
+  for(; i + 4 <= n; i += 4)
+    _mm_storeu_ps(dst + i, _mm_mul_ps(g, _mm_loadu_ps(src + i)));
+  scalar_scaleFlt(dst + i, src + i, gain, n - i);
+}
+
+AUDIOMIX_SSE4 void
+sse4_addFlt(float* dst, const float* src, float gain, int32_t n)
+{
+  const __m128 g = _mm_set1_ps(gain);
+  int32_t i = 0;
+  for(; i + 4 <= n; i += 4)
+    _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i),
+        _mm_mul_ps(g, _mm_loadu_ps(src + i))));
+  scalar_addFlt(dst + i, src + i, gain, n - i);
+}
+
+AUDIOMIX_SSE4 void
+sse4_scaleS16(float* dst, const int16_t* src, float gain, int32_t n)
+{
+  const __m128 g = _mm_set1_ps(gain);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+    _mm_storeu_ps(dst + i,
+        _mm_mul_ps(g, _mm_cvtepi32_ps(_mm_cvtepi16_epi32(s))));
+    _mm_storeu_ps(dst + i + 4, _mm_mul_ps(g,
+        _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(s, 8)))));
+  }
+  scalar_scaleS16(dst + i, src + i, gain, n - i);
+}
+
+AUDIOMIX_SSE4 void
+sse4_addS16(float* dst, const int16_t* src, float gain, int32_t n)
+{
+  const __m128 g = _mm_set1_ps(gain);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8) {
+    __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+    _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i),
+        _mm_mul_ps(g, _mm_cvtepi32_ps(_mm_cvtepi16_epi32(s)))));
+    _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_loadu_ps(dst + i + 4),
+        _mm_mul_ps(g, _mm_cvtepi32_ps(
+            _mm_cvtepi16_epi32(_mm_srli_si128(s, 8))))));
+  }
+  scalar_addS16(dst + i, src + i, gain, n - i);
+}
+
+AUDIOMIX_SSE4 inline __m128i
+sse4_clipS32(__m128 x)
+{
+  x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-32768.0f)),
+      _mm_set1_ps(32767.0f));
+  // rounds to nearest even, as lrintf does
+  return _mm_cvtps_epi32(x);
+}
+
+AUDIOMIX_SSE4 void
+sse4_storeS16(int16_t* dst, const float* src, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_packs_epi32(
+        sse4_clipS32(_mm_loadu_ps(src + i)),
+        sse4_clipS32(_mm_loadu_ps(src + i + 4))));
+  scalar_storeS16(dst + i, src + i, n - i);
+}
+
+const AudioMix::Kernels sSse4 = {
+  sse4_scaleFlt,
+  sse4_addFlt,
+  sse4_scaleS16,
+  sse4_addS16,
+  sse4_storeS16,
+};
+
+AUDIOMIX_AVX2 void
+avx2_scaleFlt(float* dst, const float* src, float gain, int32_t n)
+{
+  const __m256 g = _mm256_set1_ps(gain);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(dst + i, _mm256_mul_ps(g, _mm256_loadu_ps(src + i)));
+  // the SSE4 code that finishes off is not VEX encoded, and pays for
+  // every instruction it runs while the upper halves are dirty
+  _mm256_zeroupper();
+  sse4_scaleFlt(dst + i, src + i, gain, n - i);
+}
+
+AUDIOMIX_AVX2 void
+avx2_addFlt(float* dst, const float* src, float gain, int32_t n)
+{
+  const __m256 g = _mm256_set1_ps(gain);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i),
+        _mm256_mul_ps(g, _mm256_loadu_ps(src + i))));
+  _mm256_zeroupper();
+  sse4_addFlt(dst + i, src + i, gain, n - i);
+}
+
+AUDIOMIX_AVX2 void
+avx2_scaleS16(float* dst, const int16_t* src, float gain, int32_t n)
+{
+  const __m256 g = _mm256_set1_ps(gain);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(dst + i, _mm256_mul_ps(g, _mm256_cvtepi32_ps(
+        _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(src + i))))));
+  _mm256_zeroupper();
+  sse4_scaleS16(dst + i, src + i, gain, n - i);
+}
+
+AUDIOMIX_AVX2 void
+avx2_addS16(float* dst, const int16_t* src, float gain, int32_t n)
+{
+  const __m256 g = _mm256_set1_ps(gain);
+  int32_t i = 0;
+  for(; i + 8 <= n; i += 8)
+    _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i),
+        _mm256_mul_ps(g, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+            _mm_loadu_si128((const __m128i*)(src + i)))))));
+  _mm256_zeroupper();
+  sse4_addS16(dst + i, src + i, gain, n - i);
+}
+
+AUDIOMIX_AVX2 inline __m256i
+avx2_clipS32(__m256 x)
+{
+  x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-32768.0f)),
+      _mm256_set1_ps(32767.0f));
+  return _mm256_cvtps_epi32(x);
+}
+
+AUDIOMIX_AVX2 void
+avx2_storeS16(int16_t* dst, const float* src, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    // packs works within 128 bit lanes, so put the quarters back in order
+    __m256i s = _mm256_packs_epi32(avx2_clipS32(_mm256_loadu_ps(src + i)),
+        avx2_clipS32(_mm256_loadu_ps(src + i + 8)));
+    _mm256_storeu_si256((__m256i*)(dst + i),
+        _mm256_permute4x64_epi64(s, _MM_SHUFFLE(3, 1, 2, 0)));
+  }
+  _mm256_zeroupper();
+  sse4_storeS16(dst + i, src + i, n - i);
+}
+
+const AudioMix::Kernels sAvx2 = {
+  avx2_scaleFlt,
+  avx2_addFlt,
+  avx2_scaleS16,
+  avx2_addS16,
+  avx2_storeS16,
+};
+
+#endif // AUDIOMIX_X86
+
+}
+
+AudioMix::AudioMix() {
+  mLevel = AudioConversion::LEVEL_SCALAR;
+  mKernels = &sScalar;
+  mFloat = false;
+  mPlanes = 0;
+  mValues = 0;
+  mScratch = 0;
+}
+
+AudioMix::~AudioMix() {
+  av_free(mScratch);
+}
+
+AudioMix*
+AudioMix::make(enum AVSampleFormat format, int32_t channels,
+    AudioConversion::Level level) {
+  const enum AVSampleFormat packed = av_get_packed_sample_fmt(format);
+  if ((packed != AV_SAMPLE_FMT_S16 && packed != AV_SAMPLE_FMT_FLT) ||
+      channels <= 0)
+    return 0;
+  AudioMix* retval = new AudioMix();
+  retval->mLevel = FFMIN(level, AudioConversion::getBestLevel());
+#ifdef AUDIOMIX_X86
+  if (retval->mLevel == AudioConversion::LEVEL_AVX2)
+    retval->mKernels = &sAvx2;
+  else if (retval->mLevel == AudioConversion::LEVEL_SSE4)
+    retval->mKernels = &sSse4;
+#endif
+  retval->mFloat = packed == AV_SAMPLE_FMT_FLT;
+  const bool planar = av_sample_fmt_is_planar(format);
+  retval->mPlanes = planar ? channels : 1;
+  retval->mValues = planar ? 1 : channels;
+  retval->mScratch = (float*)av_malloc(sBlock * sizeof(float));
+  if (!retval->mScratch) {
+    delete retval;
+    return 0;
+  }
+  return retval;
+}
+
+void
+AudioMix::mix(uint8_t* const* out, const uint8_t* const* const* ins,
+    const float* gains, int32_t numIns, int32_t n) {
+  const Kernels* k = mKernels;
+  const int32_t values = n * mValues;
+  for(int32_t p = 0; p < mPlanes; p++) {
+    if (!numIns) {
+      memset(out[p], 0, values * (mFloat ? sizeof(float) : sizeof(int16_t)));
+      continue;
+    }
+    // a block at a time, so S16 sums stay in the cache
+    for(int32_t offset = 0; offset < values; offset += sBlock) {
+      const int32_t count = FFMIN(sBlock, values - offset);
+      if (mFloat) {
+        float* dst = (float*)out[p] + offset;
+        k->scaleFlt(dst, (const float*)ins[0][p] + offset, gains[0], count);
+        for(int32_t i = 1; i < numIns; i++)
+          k->addFlt(dst, (const float*)ins[i][p] + offset, gains[i], count);
+      } else {
+        k->scaleS16(mScratch, (const int16_t*)ins[0][p] + offset, gains[0],
+            count);
+        for(int32_t i = 1; i < numIns; i++)
+          k->addS16(mScratch, (const int16_t*)ins[i][p] + offset, gains[i],
+              count);
+        k->storeS16((int16_t*)out[p] + offset, mScratch, count);
+      }
+    }
+  }
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef AUDIOMIX_H_
+#define AUDIOMIX_H_
+
+#include <io/humble/video/AudioConversion.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. Adds up S16 or FLT audio, planar or interleaved, from
+ * many inputs, each scaled by a gain, with kernels written for SSE4 and
+ * AVX2 as well as in plain C++. S16 is summed in float and rounded to the
+ * nearest S16 and clipped on the way out; FLT is not clipped. All levels
+ * produce the same samples.
+ */
+class AudioMix
+{
+public:
+  /**
+   * Gets a mix, or 0 if format is not S16 or FLT (planar or not).
+   *
+   * @param level The kernels to use; if the CPU cannot run them, the best
+   *   it can are used instead.
+   */
+  static AudioMix* make(enum AVSampleFormat format, int32_t channels,
+      AudioConversion::Level level);
+
+  ~AudioMix();
+
+  /** @return the kernels in use. */
+  AudioConversion::Level getLevel() { return mLevel; }
+
+  /**
+   * Sets n samples per channel of out to the sum of numIns inputs, each
+   * times its gain, or to silence if there are none. out and every ins[i]
+   * hold a pointer per channel for planar formats and a single pointer
+   * otherwise.
+   */
+  void mix(uint8_t* const* out, const uint8_t* const* const* ins,
+      const float* gains, int32_t numIns, int32_t n);
+
+  struct Kernels;
+
+private:
+  AudioMix();
+  AudioMix(const AudioMix&);
+  AudioMix& operator=(const AudioMix&);
+
+  AudioConversion::Level mLevel;
+  const Kernels* mKernels;
+  bool mFloat;
+  int32_t mPlanes;
+  // samples per plane for each sample per channel
+  int32_t mValues;
+  // a block of S16 sums
+  float* mScratch;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* AUDIOMIX_H_ */
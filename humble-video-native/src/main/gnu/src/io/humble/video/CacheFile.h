@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef CACHEFILE_H_
+#define CACHEFILE_H_
+
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/FfmpegIncludes.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. Writes the simple binary files Humble Video uses to keep
+ * native caches (probe results, seek indexes) between runs. Values are
+ * written in native byte order; a cache file is only meant to be read back
+ * by the same build on the same machine.
+ * <p>
+ * Every method returns false once any write has failed, so calls can be
+ * chained with &&.
+ * </p>
+ */
+class CacheFileWriter
+{
+public:
+  CacheFileWriter(FILE* f) : mFile(f), mOk(true) {}
+  bool bytes(const void* p, size_t len) {
+    if (mOk && len && fwrite(p, 1, len, mFile) != len)
+      mOk = false;
+    return mOk;
+  }
+  bool i32(int32_t& v) { return bytes(&v, sizeof(v)); }
+  bool i64(int64_t& v) { return bytes(&v, sizeof(v)); }
+  bool q(AVRational& v) { return i32(v.num) && i32(v.den); }
+  bool str(std::string& v) {
+    int32_t len = (int32_t)v.size();
+    return i32(len) && bytes(v.data(), len);
+  }
+  bool ok() { return mOk; }
+private:
+  FILE* mFile;
+  bool mOk;
+};
+
+/**
+ * Internal only. Reads what a CacheFileWriter wrote, with the same method
+ * names so one template can describe a record for both.
+ */
+class CacheFileReader
+{
+public:
+  /** Longest string we will believe is not a damaged file. */
+  static const int32_t MAX_STRING_LENGTH = 16*1024*1024;
+
+  CacheFileReader(FILE* f) : mFile(f), mOk(true) {}
+  bool bytes(void* p, size_t len) {
+    if (mOk && len && fread(p, 1, len, mFile) != len)
+      mOk = false;
+    return mOk;
+  }
+  bool i32(int32_t& v) { return bytes(&v, sizeof(v)); }
+  bool i64(int64_t& v) { return bytes(&v, sizeof(v)); }
+  bool q(AVRational& v) { return i32(v.num) && i32(v.den); }
+  bool str(std::string& v) {
+    int32_t len = 0;
+    if (!i32(len) || len < 0 || len > MAX_STRING_LENGTH)
+      return mOk = false;
+    v.resize(len);
+    return !len || bytes(&v[0], len);
+  }
+  bool ok() { return mOk; }
+private:
+  FILE* mFile;
+  bool mOk;
+};
+
+/**
+ * Internal only. Looks up the regular local file a URL (a path, or "file:"
+ * and a path) names, so a cache file can tell when it has changed.
+ *
+ * @param url The URL.
+ * @param size Set to the size of the file.
+ * @param modified Set to when the file was last modified, in nanoseconds
+ *   (whole seconds where the platform records no finer).
+ * @return the path within url, or null if url is not a regular local file.
+ */
+inline const char*
+statCacheSource(const char* url, int64_t* size, int64_t* modified)
+{
+  if (!url || !*url)
+    return 0;
+  const char* path = url;
+  if (!strncmp(url, "file:", 5))
+    path = url + 5;
+  else {
+    // anything with a protocol (other than a drive letter) is not a file
+    const char* colon = strchr(url, ':');
+    if (colon && colon - url > 1)
+      return 0;
+  }
+  struct stat info;
+  if (stat(path, &info) || !S_ISREG(info.st_mode))
+    return 0;
+  int64_t nanoseconds = 0;
+#if defined(__APPLE__)
+  nanoseconds = info.st_mtimespec.tv_nsec;
+#elif !defined(_WIN32)
+  nanoseconds = info.st_mtim.tv_nsec;
+#endif
+  *size = info.st_size;
+  *modified = (int64_t)info.st_mtime*1000000000 + nanoseconds;
+  return path;
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* CACHEFILE_H_ */
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <io/humble/video/Global.h>
+#include <io/humble/video/VideoExceptions.h>
+#include <io/humble/video/customio/CachingURLProtocolManager.h>
+#include "CachingProtocol.h"
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.CachingProtocol);
+
+using namespace io::humble::ferry;
+using namespace io::humble::video::customio;
+
+namespace io {
+namespace humble {
+namespace video {
+
+// not "cache", which is FFmpeg's own caching protocol
+static const char* CachingProtocol_NAME = "humblecache";
+
+/**
+ * Find the registered manager, registering it again if someone has
+ * unregistered all protocols since Global::init().
+ */
+static CachingURLProtocolManager*
+CachingProtocol_getManager() {
+  Global::init();
+  Global::lock();
+  CachingURLProtocolManager* mgr = dynamic_cast<CachingURLProtocolManager*>(
+      URLProtocolManager::findProtocol(CachingProtocol_NAME, 0, 0, 0));
+  if (!mgr)
+    mgr = CachingURLProtocolManager::registerProtocol(CachingProtocol_NAME);
+  Global::unlock();
+  return mgr;
+}
+
+CachingProtocol::CachingProtocol() {
+}
+
+CachingProtocol::~CachingProtocol() {
+}
+
+const char*
+CachingProtocol::getProtocolName() {
+  return CachingProtocol_NAME;
+}
+
+int64_t
+CachingProtocol::getMaxBytes() {
+  return CachingProtocol_getManager()->getMaxBytes();
+}
+
+void
+CachingProtocol::setMaxBytes(int64_t maxBytes) {
+  if (maxBytes < 0)
+    VS_THROW(HumbleInvalidArgument("maxBytes < 0"));
+  CachingProtocol_getManager()->setMaxBytes(maxBytes);
+}
+
+int64_t
+CachingProtocol::getCachedBytes() {
+  return CachingProtocol_getManager()->getCachedBytes();
+}
+
+int32_t
+CachingProtocol::getBlockSize() {
+  return CachingProtocol_getManager()->getBlockSize();
+}
+
+int64_t
+CachingProtocol::getHits() {
+  return CachingProtocol_getManager()->getHits();
+}
+
+int64_t
+CachingProtocol::getMisses() {
+  return CachingProtocol_getManager()->getMisses();
+}
+
+int64_t
+CachingProtocol::getWaits() {
+  return CachingProtocol_getManager()->getWaits();
+}
+
+int64_t
+CachingProtocol::getEvictions() {
+  return CachingProtocol_getManager()->getEvictions();
+}
+
+void
+CachingProtocol::resetStatistics() {
+  CachingProtocol_getManager()->resetStatistics();
+}
+
+void
+CachingProtocol::clear() {
+  CachingProtocol_getManager()->clear();
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
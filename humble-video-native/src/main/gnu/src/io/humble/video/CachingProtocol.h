@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef CACHINGPROTOCOL_H_
+#define CACHINGPROTOCOL_H_
+
+#include <io/humble/ferry/RefCounted.h>
+#include <io/humble/video/HumbleVideo.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Lets many Demuxers share what they read from the same URLs.
+ * <p>
+ * Open "humblecache:" + url instead of url and reads go through one
+ * process-wide cache of fixed-size blocks, keyed by url and offset, that
+ * is bounded in size and evicts the least recently used blocks first.
+ * Any URL a Demuxer can open can be cached. When several Demuxers miss
+ * the same block at the same time only one of them reads it; the rest
+ * wait for it.
+ * </p><p>
+ * Blocks remember the size of their URL, and for local files its
+ * modification time, and are dropped once either changes. #clear() the
+ * cache if data can change without either changing. Cached URLs can
+ * only be read.
+ * </p>
+ */
+class VS_API_HUMBLEVIDEO CachingProtocol : public io::humble::ferry::RefCounted
+{
+public:
+  /**
+   * @return the protocol name to put in front of URLs to cache: "humblecache".
+   */
+  static const char* getProtocolName();
+
+  /**
+   * @return the most bytes the cache will hold. Defaults to 64 MiB.
+   */
+  static int64_t getMaxBytes();
+
+  /**
+   * Sets the most bytes the cache will hold, evicting blocks if it holds
+   * more now.
+   *
+   * @param maxBytes The bound; 0 caches nothing beyond the reads in progress.
+   *
+   * @throws InvalidArgument if maxBytes < 0.
+   */
+  static void setMaxBytes(int64_t maxBytes);
+
+  /**
+   * @return the bytes the cache holds now.
+   */
+  static int64_t getCachedBytes();
+
+  /**
+   * @return the size of the blocks the cache reads and holds.
+   */
+  static int32_t getBlockSize();
+
+  /**
+   * @return the number of block reads served from the cache.
+   */
+  static int64_t getHits();
+
+  /**
+   * @return the number of blocks read from their URLs because they were not cached.
+   */
+  static int64_t getMisses();
+
+  /**
+   * @return the number of block reads that were not cached, but waited for
+   *   another Demuxer already reading the block rather than reading it again.
+   */
+  static int64_t getWaits();
+
+  /**
+   * @return the number of blocks evicted to stay within #getMaxBytes().
+   */
+  static int64_t getEvictions();
+
+  /**
+   * Zeros the hit, miss, wait and eviction counts.
+   */
+  static void resetStatistics();
+
+  /**
+   * Empties the cache. Demuxers reading through it carry on, reading
+   * blocks again as they need them.
+   */
+  static void clear();
+
+private:
+  CachingProtocol();
+  virtual ~CachingProtocol();
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* CACHINGPROTOCOL_H_ */
@@ -21,13 +21,12 @@
 #include "PropertyImpl.h"
 #include "Encoder.h"
 #include "Decoder.h"
+#include "ContainerIO.h"
 #include <io/humble/ferry/Logger.h>
 #include <io/humble/ferry/RefPointer.h>
-#include <io/humble/video/customio/URLProtocolHandler.h>
 
 VS_LOG_SETUP(VS_CPP_PACKAGE.Container);
 
-using namespace io::humble::video::customio;
 using namespace io::humble::ferry;
 
 namespace io {
@@ -35,6 +34,7 @@ namespace humble {
 namespace video {
 
 Container::Container() {
+  mIO = new ContainerIO();
   VS_LOG_TRACE("Created: %p");
 }
 
@@ -48,48 +48,43 @@ Container::~Container() {
       delete stream;
     }
   }
+  delete mIO;
   VS_LOG_TRACE("Destroyed: %p");
 }
 
-int
-Container::url_read(void*h, unsigned char* buf, int size) {
-  int retval = -1;
-  try {
-    URLProtocolHandler* handler = (URLProtocolHandler*) h;
-    if (handler) retval = handler->url_read(buf, size);
-  } catch (...) {
-    retval = -1;
-  }
-  VS_LOG_TRACE("URLProtocolHandler[%p]->url_read(%p, %d) ==> %d", h, buf, size,
-      retval);
-  return retval;
-}
-int
-Container::url_write(void*h, unsigned char* buf, int size) {
-  int retval = -1;
-  try {
-    URLProtocolHandler* handler = (URLProtocolHandler*) h;
-    if (handler) retval = handler->url_write(buf, size);
-  } catch (...) {
-    retval = -1;
-  }
-  VS_LOG_TRACE("URLProtocolHandler[%p]->url_write(%p, %d) ==> %d", h, buf, size,
-      retval);
-  return retval;
+int64_t
+Container::getIOReadCalls() {
+  return mIO->getReadCalls();
 }
 
 int64_t
-Container::url_seek(void*h, int64_t position, int whence) {
-  int64_t retval = -1;
-  try {
-    URLProtocolHandler* handler = (URLProtocolHandler*) h;
-    if (handler) retval = handler->url_seek(position, whence);
-  } catch (...) {
-    retval = -1;
-  }
-  VS_LOG_TRACE("URLProtocolHandler[%p]->url_seek(%p, %lld) ==> %d", h, position,
-      whence, retval);
-  return retval;
+Container::getIOBytesRead() {
+  return mIO->getBytesRead();
+}
+
+int64_t
+Container::getIOWriteCalls() {
+  return mIO->getWriteCalls();
+}
+
+int64_t
+Container::getIOBytesWritten() {
+  return mIO->getBytesWritten();
+}
+
+int64_t
+Container::getIOSeekCalls() {
+  return mIO->getSeekCalls();
+}
+
+int64_t
+Container::getIOTime() {
+  return mIO->getTime();
+}
+
+int32_t
+Container::getIOBufferLength() {
+  return mIO->getBufferLength();
 }
 
 Container::Stream::Stream(Container* container, int32_t index) {
@@ -97,6 +92,8 @@ Container::Stream::Stream(Container* container, int32_t index) {
   mIndex = index;
   mLastDts = Global::NO_PTS;
   mCachedCtx = 0;
+  mTimeBaseSource.num = 0;
+  mTimeBaseSource.den = 1;
   mCtx = mContainer->getFormatCtx()->streams[index];
 }
 
@@ -118,6 +115,19 @@ Container::Stream::getCoder() {
   return mCoder.get();
 }
 
+Rational*
+Container::Stream::peekTimeBase() {
+  AVStream* stream = getCtx();
+  if (!stream || !stream->time_base.num || !stream->time_base.den)
+    return 0;
+  // compare against what we made it from; make() reduces the fraction.
+  if (!mTimeBase || av_cmp_q(mTimeBaseSource, stream->time_base)) {
+    mTimeBase = Rational::make(stream->time_base.num, stream->time_base.den);
+    mTimeBaseSource = stream->time_base;
+  }
+  return mTimeBase.value();
+}
+
 void
 Container::doSetupStreams() {
   // do nothing if we're already all set up.
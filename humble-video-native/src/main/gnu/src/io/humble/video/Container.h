@@ -40,6 +40,7 @@ namespace video
 {
 
   class ContainerStream;
+  class ContainerIO;
 /**
  * A Container for Media data. This is an abstract class and
  * cannot be instantiated on its own.
@@ -97,6 +98,60 @@ public:
   virtual int32_t
   getNumStreams();
 
+  /**
+   * Get the number of times this container called its custom I/O handler to read data.
+   * <p>
+   * Containers only record I/O statistics when their URL is handled by an
+   * io.humble.video.customio.URLProtocolHandler; for all other URLs every statistic is 0.
+   * Statistics are reset when the container is opened and kept after it is closed.
+   * </p>
+   */
+  int64_t
+  getIOReadCalls();
+
+  /**
+   * Get the number of bytes this container's custom I/O handler has returned from reads.
+   */
+  int64_t
+  getIOBytesRead();
+
+  /**
+   * Get the number of times this container called its custom I/O handler to write data.
+   */
+  int64_t
+  getIOWriteCalls();
+
+  /**
+   * Get the number of bytes this container's custom I/O handler has accepted in writes.
+   */
+  int64_t
+  getIOBytesWritten();
+
+  /**
+   * Get the number of times this container called its custom I/O handler to seek,
+   * including queries for the size of the data.
+   */
+  int64_t
+  getIOSeekCalls();
+
+  /**
+   * Get the time, in microseconds, this container has spent inside its custom I/O handler.
+   */
+  int64_t
+  getIOTime();
+
+  /**
+   * Get the length of the buffer between FFmpeg and this container's custom I/O handler.
+   * <p>
+   * If a buffer length of 0 was asked for, this container picks one from the handler
+   * and may grow it while reading or writing, so this can change over time.
+   * </p>
+   *
+   * @return the length, or 0 if this container has not been opened on a custom I/O handler.
+   */
+  int32_t
+  getIOBufferLength();
+
 #ifndef SWIG
   virtual void* getCtx() { return getFormatCtx(); }
   virtual AVFormatContext* getFormatCtx()=0;
@@ -148,6 +203,21 @@ public:
     Coder*
     getCoder();
 
+    /**
+     * Returns the coder without acquiring it; for stamping on packets
+     * read from this stream. May be null.
+     */
+    Coder*
+    peekCoder() { return mCoder.value(); }
+
+    /**
+     * Returns the stream time base without acquiring it. The returned
+     * object is immutable and is only remade if the underlying
+     * AVStream time base changes.
+     */
+    Rational*
+    peekTimeBase();
+
     void setCoder(Coder* coder) {
       mCoder.reset(coder, true);
     }
@@ -167,6 +237,8 @@ public:
     int64_t mLastDts;
     io::humble::ferry::RefPointer<KeyValueBag> mMetaData;
     io::humble::ferry::RefPointer<Coder> mCoder;
+    io::humble::ferry::RefPointer<Rational> mTimeBase;
+    AVRational mTimeBaseSource;
     Container* mContainer;
     AVStream* mCtx;
     AVCodecContext *mCachedCtx;
@@ -187,15 +259,14 @@ protected:
   virtual
   ~Container();
 #ifndef SWIG
-  // static methods for custom IO
-  static int url_read(void*h, unsigned char* buf, int size);
-  static int url_write(void*h, unsigned char* buf, int size);
-  static int64_t url_seek(void*h, int64_t position, int whence);
+  /** Connects the AVIOContext to a custom I/O handler and keeps its statistics. */
+  ContainerIO* getIO() { return mIO; }
 #endif // ! SWIG
 protected:
   void doSetupStreams();
 private:
   std::vector<Stream*> mStreams;
+  ContainerIO* mIO;
 
 };
 
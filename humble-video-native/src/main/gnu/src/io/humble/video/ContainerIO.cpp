@@ -0,0 +1,295 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cstring>
+
+#include <io/humble/ferry/Logger.h>
+#include "ContainerIO.h"
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.ContainerIO);
+
+using namespace io::humble::video::customio;
+
+namespace io {
+namespace humble {
+namespace video {
+
+ContainerIO::ContainerIO() {
+  mHandler = 0;
+  mContext = 0;
+  mOwnBuffer = 0;
+  mOwnBufferSize = 0;
+  mAdaptive = false;
+  mMax = 0;
+  mLength = 0;
+  mFullCalls = 0;
+  mFullBytes = 0;
+  mFullTime = 0;
+  mLastThroughput = 0;
+  mReadCalls = 0;
+  mBytesRead = 0;
+  mWriteCalls = 0;
+  mBytesWritten = 0;
+  mSeekCalls = 0;
+  mTime = 0;
+}
+
+ContainerIO::~ContainerIO() {
+  close();
+}
+
+AVIOContext*
+ContainerIO::open(URLProtocolHandler* handler, const char* url, bool write,
+    int32_t bufferLength) {
+  close();
+  mHandler = handler;
+  mFullCalls = 0;
+  mFullBytes = 0;
+  mFullTime = 0;
+  mLastThroughput = 0;
+  mReadCalls = 0;
+  mBytesRead = 0;
+  mWriteCalls = 0;
+  mBytesWritten = 0;
+  mSeekCalls = 0;
+  mTime = 0;
+
+  int flags = URLProtocolHandler::SK_NOT_SEEKABLE;
+  try {
+    flags = handler->url_seekflags(url, write ?
+        URLProtocolHandler::URL_WRONLY_MODE : URLProtocolHandler::URL_RDONLY_MODE);
+  } catch (...) {
+    flags = URLProtocolHandler::SK_NOT_SEEKABLE;
+  }
+  bool seekable = flags & URLProtocolHandler::SK_SEEKABLE_NORMAL;
+  mAdaptive = bufferLength <= 0;
+  if (mAdaptive) {
+    mLength = seekable ? SEEKABLE_BUFFER_LENGTH : STREAMED_BUFFER_LENGTH;
+    mMax = seekable ? SEEKABLE_BUFFER_MAX : STREAMED_BUFFER_MAX;
+  } else
+    mLength = mMax = bufferLength;
+
+  uint8_t* buffer = (uint8_t*)av_malloc(mLength);
+  if (!buffer)
+    return 0;
+  // ownership of buffer passes to the context.
+  AVIOContext* pb = avio_alloc_context(buffer, mLength, write ? 1 : 0, this,
+      ContainerIO::url_read, ContainerIO::url_write, ContainerIO::url_seek);
+  if (!pb)
+    av_free(buffer);
+  else if (!seekable)
+    // as avio_open does for streamed protocols, so muxers that would seek
+    // back to patch headers (mp3's Xing frame, mp4's moov) know they can't.
+    pb->seekable = 0;
+  mContext = pb;
+  VS_LOG_TRACE("open ContainerIO@%p[url:%s;length:%d;max:%d]", this, url,
+      mLength, mMax);
+  return pb;
+}
+
+void
+ContainerIO::close() {
+  AVIOContext* pb = mContext;
+  if (!pb)
+    return;
+  if (mOwnBuffer) {
+    pb->buffer = mOwnBuffer;
+    mOwnBuffer = 0;
+  }
+  av_freep(&pb->buffer);
+  av_free(pb);
+  mContext = 0;
+}
+
+void
+ContainerIO::adapt(AVIOContext* pb) {
+  if (pb && pb->read_packet == ContainerIO::url_read && pb->opaque) {
+    ContainerIO* io = (ContainerIO*)pb->opaque;
+    if (pb->write_flag && pb->buf_ptr == pb->buffer)
+      io->borrow(pb, true);
+    io->grow(pb);
+  }
+}
+
+void
+ContainerIO::borrow(AVIOContext* pb, bool empty) {
+  if (!mHandler || pb->direct || (empty && pb->update_checksum))
+    return;
+  int size = 0;
+  unsigned char* memory = 0;
+  try {
+    memory = mHandler->url_write_buffer(&size);
+  } catch (...) {
+    memory = 0;
+  }
+  if (!memory || size <= 0) {
+    if (!mOwnBuffer)
+      return;
+    // nothing to lend any more; back to our own buffer.
+    memory = mOwnBuffer;
+    size = mOwnBufferSize;
+    mOwnBuffer = 0;
+  } else if (!mOwnBuffer) {
+    mOwnBuffer = pb->buffer;
+    mOwnBufferSize = pb->buffer_size;
+  }
+  // when called from a flush FFmpeg moves buf_ptr itself once we return, and
+  // may still need the old one to update a checksum.
+  pb->buffer = memory;
+  pb->buffer_size = size;
+  pb->orig_buffer_size = size;
+  pb->buf_end = memory + size;
+  if (empty)
+    pb->buf_ptr = memory;
+}
+
+void
+ContainerIO::account(int32_t requested, int32_t transferred, int64_t elapsed) {
+  mTime += elapsed;
+  if (!mAdaptive || mLength >= mMax)
+    return;
+  if (requested < mLength || transferred < requested) {
+    // the handler had less to give, or FFmpeg wanted less; a bigger buffer
+    // would not have saved a call.
+    mFullCalls = 0;
+    mFullBytes = 0;
+    mFullTime = 0;
+    return;
+  }
+  ++mFullCalls;
+  mFullBytes += transferred;
+  mFullTime += elapsed;
+  if (mFullCalls < GROW_AFTER)
+    return;
+
+  double throughput = (double)mFullBytes / (double)(mFullTime + 1);
+  if (mLastThroughput > 0 && throughput < mLastThroughput / 2) {
+    // bigger calls are costing more than they save; stop here. Smaller
+    // drops are usually timing noise.
+    mMax = mLength;
+  } else {
+    mLastThroughput = throughput;
+    mLength = mLength > mMax / 2 ? mMax : mLength * 2;
+  }
+  mFullCalls = 0;
+  mFullBytes = 0;
+  mFullTime = 0;
+}
+
+void
+ContainerIO::grow(AVIOContext* pb) {
+  if (mLength <= pb->orig_buffer_size || pb->update_checksum || mOwnBuffer)
+    return;
+  if (pb->buffer_size >= mLength) {
+    // probing left a buffer at least this big; stop FFmpeg shrinking it.
+    pb->orig_buffer_size = mLength;
+    return;
+  }
+  uint8_t* buffer = (uint8_t*)av_malloc(mLength);
+  if (!buffer) {
+    mLength = mMax = pb->orig_buffer_size;
+    return;
+  }
+  // keep what FFmpeg has buffered: everything up to buf_end when reading so
+  // short seeks back still work, and the unflushed bytes when writing.
+  int32_t used = (pb->write_flag ? pb->buf_ptr : pb->buf_end) - pb->buffer;
+  memcpy(buffer, pb->buffer, used);
+  pb->buf_ptr = buffer + (pb->buf_ptr - pb->buffer);
+  pb->buf_end = buffer + (pb->write_flag ? mLength : used);
+  av_free(pb->buffer);
+  pb->buffer = buffer;
+  pb->buffer_size = mLength;
+  pb->orig_buffer_size = mLength;
+  VS_LOG_TRACE("grow ContainerIO@%p[length:%d;]", this, mLength);
+}
+
+int
+ContainerIO::url_read(void*h, unsigned char* buf, int size) {
+  ContainerIO* io = (ContainerIO*) h;
+  int retval = -1;
+  int64_t start = av_gettime_relative();
+  try {
+    if (io && io->mHandler) retval = io->mHandler->url_read(buf, size);
+  } catch (...) {
+    retval = -1;
+  }
+  if (io) {
+    ++io->mReadCalls;
+    if (retval > 0)
+      io->mBytesRead += retval;
+    io->account(size, retval, av_gettime_relative() - start);
+  }
+  VS_LOG_TRACE("URLProtocolHandler[%p]->url_read(%p, %d) ==> %d", h, buf, size,
+      retval);
+  return retval;
+}
+
+int
+ContainerIO::url_write(void*h, unsigned char* buf, int size) {
+  ContainerIO* io = (ContainerIO*) h;
+  int retval = -1;
+  int64_t start = av_gettime_relative();
+  try {
+    if (io && io->mHandler) retval = io->mHandler->url_write(buf, size);
+  } catch (...) {
+    retval = -1;
+  }
+  if (io) {
+    ++io->mWriteCalls;
+    if (retval > 0)
+      io->mBytesWritten += retval;
+    io->account(size, retval, av_gettime_relative() - start);
+    // a flush of the whole buffer; FFmpeg starts it again from the top.
+    if (retval >= 0 && io->mContext && buf == io->mContext->buffer)
+      io->borrow(io->mContext, false);
+  }
+  VS_LOG_TRACE("URLProtocolHandler[%p]->url_write(%p, %d) ==> %d", h, buf, size,
+      retval);
+  return retval;
+}
+
+int64_t
+ContainerIO::url_seek(void*h, int64_t position, int whence) {
+  ContainerIO* io = (ContainerIO*) h;
+  int64_t retval = -1;
+  int64_t start = av_gettime_relative();
+  try {
+    if (io && io->mHandler) retval = io->mHandler->url_seek(position, whence);
+  } catch (...) {
+    retval = -1;
+  }
+  if (io) {
+    ++io->mSeekCalls;
+    io->mTime += av_gettime_relative() - start;
+    // size queries do not move; real seeks mean the reads around them
+    // say little about how big the buffer should be.
+    if (!(whence & URLProtocolHandler::SK_SEEK_SIZE)) {
+      io->mFullCalls = 0;
+      io->mFullBytes = 0;
+      io->mFullTime = 0;
+    }
+  }
+  VS_LOG_TRACE("URLProtocolHandler[%p]->url_seek(%" PRIi64 ", %d) ==> %" PRIi64,
+      h, position, whence, retval);
+  return retval;
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef CONTAINERIO_H_
+#define CONTAINERIO_H_
+
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/FfmpegIncludes.h>
+#include <io/humble/video/customio/URLProtocolHandler.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. Connects a Container's AVIOContext to a custom
+ * io::humble::video::customio::URLProtocolHandler, counting every call
+ * into the handler and the time spent there. Streamed handlers are marked
+ * as such to FFmpeg, so muxers do not rely on seeking back.
+ * <p>
+ * When asked for a buffer length of 0 it picks one from the handler:
+ * small for streamed (not seekable) handlers so that reads return as soon
+ * as data arrives, and FFmpeg's own default for seekable ones. It then
+ * doubles the length, up to a cap, while the handler keeps filling whole
+ * buffers and the measured throughput does not collapse. FFmpeg cannot
+ * resize a buffer it is reading into, so the new length is only applied
+ * when #adapt(AVIOContext*) is called between packets.
+ * </p>
+ * <p>
+ * When writing to a handler that lends memory through
+ * URLProtocolHandler#url_write_buffer(int*), FFmpeg is pointed at that
+ * memory instead of its own buffer, so its output is built in place.
+ * </p>
+ */
+class ContainerIO
+{
+public:
+  /** Initial length for streamed handlers. */
+  static const int32_t STREAMED_BUFFER_LENGTH = 4096;
+  /** Largest length adaptive mode grows a streamed handler's buffer to. */
+  static const int32_t STREAMED_BUFFER_MAX = 64*1024;
+  /** Initial length for seekable handlers; the same as FFmpeg's default. */
+  static const int32_t SEEKABLE_BUFFER_LENGTH = 32*1024;
+  /** Largest length adaptive mode grows a seekable handler's buffer to. */
+  static const int32_t SEEKABLE_BUFFER_MAX = 1024*1024;
+  /** Number of consecutive full buffers at one length before growing. */
+  static const int32_t GROW_AFTER = 8;
+
+  ContainerIO();
+  ~ContainerIO();
+
+  /**
+   * Makes a new AVIOContext that calls into handler. Statistics are reset.
+   *
+   * @param handler The handler; not owned and must outlive the context.
+   * @param url The url the handler will be opened with.
+   * @param write true for a Muxer, false for a Demuxer.
+   * @param bufferLength The buffer length, or 0 to pick one and adapt it.
+   * @return the context, or null if out of memory. Free it with #close().
+   */
+  AVIOContext* open(io::humble::video::customio::URLProtocolHandler* handler,
+      const char* url, bool write, int32_t bufferLength);
+
+  /**
+   * Frees the context made by #open, if any. Call it once FFmpeg is done
+   * with the context.
+   */
+  void close();
+
+  /**
+   * Applies any buffer growth decided since the last call. Must only be
+   * called by the thread doing I/O on pb, and not from within FFmpeg.
+   * Does nothing if pb is null or does not belong to a ContainerIO.
+   */
+  static void adapt(AVIOContext* pb);
+
+  /** @return the length the buffer has now, or will have after the next #adapt(AVIOContext*). */
+  int32_t getBufferLength() { return mLength; }
+  int64_t getReadCalls() { return mReadCalls; }
+  int64_t getBytesRead() { return mBytesRead; }
+  int64_t getWriteCalls() { return mWriteCalls; }
+  int64_t getBytesWritten() { return mBytesWritten; }
+  int64_t getSeekCalls() { return mSeekCalls; }
+  /** @return microseconds spent inside the handler. */
+  int64_t getTime() { return mTime; }
+
+private:
+  static int url_read(void*h, unsigned char* buf, int size);
+  static int url_write(void*h, unsigned char* buf, int size);
+  static int64_t url_seek(void*h, int64_t position, int whence);
+
+  void account(int32_t requested, int32_t transferred, int64_t elapsed);
+  void grow(AVIOContext* pb);
+  void borrow(AVIOContext* pb, bool empty);
+
+  io::humble::video::customio::URLProtocolHandler* mHandler;
+  AVIOContext* mContext;
+  // FFmpeg's own buffer, put aside while it writes into memory the handler lent.
+  unsigned char* mOwnBuffer;
+  int32_t mOwnBufferSize;
+  bool mAdaptive;
+  int32_t mMax;
+  int32_t mLength;
+
+  // consecutive full buffers at the current length, and what they cost.
+  int32_t mFullCalls;
+  int64_t mFullBytes;
+  int64_t mFullTime;
+  // bytes per microsecond measured at the previous length; 0 if none.
+  double mLastThroughput;
+
+  int64_t mReadCalls;
+  int64_t mBytesRead;
+  int64_t mWriteCalls;
+  int64_t mBytesWritten;
+  int64_t mSeekCalls;
+  int64_t mTime;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* CONTAINERIO_H_ */
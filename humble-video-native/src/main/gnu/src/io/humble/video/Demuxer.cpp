@@ -19,6 +19,7 @@
 
 #include "Demuxer.h"
 #include "DemuxerImpl.h"
+#include "DemuxerProbeCache.h"
 
 namespace io {
 namespace humble {
@@ -36,6 +37,26 @@ Demuxer::make() {
   return DemuxerImpl::make();
 }
 
+void
+Demuxer::setProbeCacheSize(int32_t maxEntries) {
+  DemuxerProbeCache::get()->setMaxEntries(maxEntries);
+}
+
+int32_t
+Demuxer::getProbeCacheSize() {
+  return DemuxerProbeCache::get()->getMaxEntries();
+}
+
+int32_t
+Demuxer::loadProbeCache(const char* path) {
+  return DemuxerProbeCache::get()->load(path);
+}
+
+void
+Demuxer::saveProbeCache(const char* path) {
+  DemuxerProbeCache::get()->save(path);
+}
+
 } /* namespace video */
 } /* namespace humble */
 } /* namespace io */
@@ -95,12 +95,14 @@ public:
   getFormat() = 0;
 
   /**
-   * Set the buffer length Humble Video will suggest to FFMPEG for reading inputs.
+   * Set the buffer length Humble Video will suggest to FFMPEG for reading inputs
+   * handled by an io.humble.video.customio.URLProtocolHandler.
    *
    * If called when a Container is open, the call is ignored and -1 is returned.
    *
-   * @param size The suggested buffer size.
-   * @throws InvalidArgument if size <= 0
+   * @param size The suggested buffer size, or 0 (the default) to let Humble Video
+   *   pick a size from the handler and grow it while reading. See Container#getIOBufferLength().
+   * @throws InvalidArgument if size < 0
    */
   virtual void
   setInputBufferLength(int32_t size)=0;
@@ -109,8 +111,7 @@ public:
    * Return the input buffer length.
    *
    * @return The input buffer length Humble Video told FFMPEG to assume.
-   *   0 means FFMPEG should choose it's own
-   *   size (and it'll probably be 32768).
+   *   0 means Humble Video picks and adapts the size itself.
    */
   virtual int32_t
   getInputBufferLength()=0;
@@ -170,6 +171,22 @@ public:
   virtual DemuxerStream*
   getStream(int32_t streamIndex)=0;
 
+#ifndef SWIG
+  /**
+   * Only read packets from the given streams. Every other stream is set to
+   * Codec#DISCARD_ALL (see DemuxerStream#setDiscard(Codec.DiscardFlag)) and
+   * the given ones back to Codec#DISCARD_DEFAULT.
+   * Java callers use Demuxer#selectStreams(int...).
+   *
+   * @param streamIndexes the indexes of the streams to keep.
+   * @param numStreamIndexes how many indexes there are; 0 keeps no streams.
+   *
+   * @throws InvalidArgument if an index is not a stream in this Demuxer.
+   */
+  virtual void
+  selectStreams(const int32_t streamIndexes[], int32_t numStreamIndexes)=0;
+#endif // ! SWIG
+
   /**
    * Reads the next packet in the Demuxer into the Packet.  This method will
    * release any buffers currently held by this packet and allocate
@@ -189,6 +206,36 @@ public:
   virtual int32_t
   read(MediaPacket *packet)=0;
 
+#ifndef SWIG
+  /**
+   * Reads up to numPackets packets in one call, filling packets in order.
+   * Java callers use Demuxer#readBatch(MediaPacket[], int, long).
+   * <p>
+   * The batch ends early once maxBytes of payload have been read, or once
+   * the packets read span maxDuration (in Global#DEFAULT_PTS_PER_SECOND
+   * units); pass <= 0 for either to not limit on it. It also ends early if
+   * the source has no complete packet ready (think EAGAIN), or on end of
+   * file or an error; in that case the packets already read are returned
+   * and the next call reports the end of file or error.
+   * </p><p>
+   * The thread interrupt status is checked once per batch rather than once
+   * per packet.
+   * </p>
+   *
+   * @param packets [In/Out] the packets to read into; none may be null.
+   * @param numPackets how many packets there are.
+   * @param maxBytes stop once this many payload bytes are read, or <= 0.
+   * @param maxDuration stop once the packets span this much time, or <= 0.
+   *
+   * @return the number of packets filled (0 if none were ready),
+   *   or <0 on end of file.
+   * @throws RuntimeException if an error occurs before any packet is read.
+   */
+  virtual int32_t
+  readBatch(MediaPacket* packets[], int32_t numPackets,
+      int32_t maxBytes, int64_t maxDuration)=0;
+#endif // ! SWIG
+
   /**
    * Attempts to read all the meta data in this stream, potentially by reading ahead
    * and decoding packets.
@@ -317,6 +364,84 @@ public:
   virtual void
   setReadRetryCount(int32_t count)=0;
 
+  /**
+   * Turns on reading ahead. When on, the first #read(MediaPacket) after
+   * the Demuxer is opened (or played, or seeked) starts a native thread
+   * that reads packets into a queue while the caller works on the ones
+   * already returned, so decoding and I/O overlap.
+   * <p>
+   * The queue stops filling as soon as any of the positive limits below is
+   * reached. Pass 0 (or less) for all three to turn reading ahead off again;
+   * packets already queued will still be returned first.
+   * </p><p>
+   * Seeking throws away queued packets, and pausing or closing stops the
+   * thread. Errors (and end of file) hit by the thread are returned by
+   * #read(MediaPacket) once the packets read before them are consumed.
+   * Reading ahead is ignored for containers where streams can be added
+   * dynamically.
+   * </p>
+   *
+   * @param maxPackets maximum number of packets to queue, or <= 0 for no limit.
+   * @param maxBytes maximum number of payload bytes to queue, or <= 0 for no limit.
+   * @param maxDuration maximum time between the first and last queued packet,
+   *   in Global#DEFAULT_PTS_PER_SECOND units, or <= 0 for no limit.
+   */
+  virtual void
+  setReadAhead(int32_t maxPackets, int32_t maxBytes, int64_t maxDuration)=0;
+
+  /**
+   * @return true if reading ahead is turned on.
+   * @see #setReadAhead(int, int, long)
+   */
+  virtual bool
+  isReadAhead()=0;
+
+  /**
+   * Turns on the probe cache shared by all Demuxers in this process.
+   * <p>
+   * When on, #queryStreamMetaData() remembers the stream parameters it
+   * had to read (and maybe decode) media to find, and a later Demuxer
+   * opening the same local file skips that work. Files are recognized by
+   * path, size and modification time (to the nanosecond where the
+   * platform records it); URLs that are not local files are never cached.
+   * </p>
+   *
+   * @param maxEntries the most files to remember; the least recently used
+   *   are forgotten first. 0 (the default) turns the cache off and empties it.
+   */
+  static void
+  setProbeCacheSize(int32_t maxEntries);
+
+  /**
+   * @return the most files the probe cache remembers; 0 if it is off.
+   * @see #setProbeCacheSize(int)
+   */
+  static int32_t
+  getProbeCacheSize();
+
+  /**
+   * Adds the entries written by #saveProbeCache(String) to the probe
+   * cache, so a new process does not have to probe files again. The cache
+   * must already be on; entries beyond its size are dropped.
+   *
+   * @param path the file to read.
+   * @return the number of entries read, or -1 if the file was written by
+   *   an incompatible version of Humble Video (or FFmpeg) and was ignored.
+   * @throws RuntimeException if the file cannot be read.
+   */
+  static int32_t
+  loadProbeCache(const char* path);
+
+  /**
+   * Writes the probe cache to a file that #loadProbeCache(String) can
+   * read back.
+   *
+   * @param path the file to (over)write.
+   * @throws RuntimeException if the file cannot be written.
+   */
+  static void
+  saveProbeCache(const char* path);
+
   /**
    * Can streams be added dynamically to this container?
    *
@@ -423,6 +548,48 @@ public:
   seek(int32_t stream_index, int64_t min_ts, int64_t ts,
       int64_t max_ts, int32_t flags)=0;
 
+  /**
+   * Reads the rest of the container, recording where every key frame is
+   * in its stream's index (see ContainerStream#getIndexEntry(int)), then
+   * seeks back to the start.
+   * <p>
+   * Many containers (MPEG-TS, raw H.264, some Matroska files) come with
+   * no index or a sparse one, and #seek(int, long, long, long, int) on
+   * them has to search the file. Once indexed, seeks to a key frame go
+   * straight to it. Index once and then #saveSeekIndex(String) to skip
+   * the scan next time.
+   * </p>
+   *
+   * @return the number of entries in all stream indexes afterwards.
+   * @throws RuntimeException if not STATE_OPENED, or on a read error.
+   */
+  virtual int32_t
+  buildSeekIndex()=0;
+
+  /**
+   * Writes all stream indexes to a sidecar file that
+   * #loadSeekIndex(String) can read back.
+   *
+   * @param path the file to (over)write.
+   * @throws RuntimeException if not open, or the file cannot be written.
+   */
+  virtual void
+  saveSeekIndex(const char* path)=0;
+
+  /**
+   * Adds the entries in a sidecar file written by #saveSeekIndex(String)
+   * to this container's stream indexes, as if #buildSeekIndex() had been
+   * called.
+   *
+   * @param path the file to read.
+   * @return the number of entries added, or -1 if the file was saved for a
+   *   container with a different size, streams or time bases, or for a
+   *   local file modified since, in which case it is ignored.
+   * @throws RuntimeException if not open, or the file cannot be read.
+   */
+  virtual int32_t
+  loadSeekIndex(const char* path)=0;
+
   /**
    * Gets the AVFormatContext.max_delay property if possible.
    * @return The max delay, error code otherwise.
@@ -27,6 +27,9 @@
 #include <io/humble/video/customio/URLProtocolManager.h>
 #include "Global.h"
 #include "DemuxerImpl.h"
+#include "DemuxerProbeCache.h"
+#include "DemuxerSeekIndex.h"
+#include "ContainerIO.h"
 #include "MediaPacketImpl.h"
 #include "KeyValueBagImpl.h"
 #include "VideoExceptions.h"
@@ -43,14 +46,17 @@ namespace video {
 DemuxerImpl::DemuxerImpl() {
   mStreamInfoGotten = 0;
   mReadRetryMax = 1;
-  mInputBufferLength = 2048;
+  mDeferredReadError = 0;
+  mSeekIndexed = false;
+  mInputBufferLength = 0;
   mIOHandler = 0;
+  mReadAhead = 0;
   mCtx = avformat_alloc_context();
   if (!mCtx) {
     VS_THROW(HumbleBadAlloc());
   }
   // Set up thread interrupt capabilities
-  mCtx->interrupt_callback.callback = Global::avioInterruptCB;
+  mCtx->interrupt_callback.callback = DemuxerImpl::avioInterruptCB;
   mCtx->interrupt_callback.opaque = this;
   mState = STATE_INITED;
   VS_LOG_TRACE("Created: %p");
@@ -64,6 +70,7 @@ DemuxerImpl::~DemuxerImpl() {
         this->getURL());
     (void) this->close();
   }
+  delete mReadAhead;
   if (mCtx)
     avformat_free_context(mCtx);
   VS_LOG_TRACE("Destroyed: %p");
@@ -78,6 +85,15 @@ DemuxerImpl::getFormatCtx() {
   return mCtx;
 }
 
+int
+DemuxerImpl::avioInterruptCB(void* opaque) {
+  DemuxerImpl* demuxer = (DemuxerImpl*)opaque;
+  // the read-ahead thread has no Java thread to be interrupted; it stops when asked.
+  if (demuxer && demuxer->mReadAhead && demuxer->mReadAhead->isCurrentThread())
+    return demuxer->mReadAhead->isAborting();
+  return Global::avioInterruptCB(opaque);
+}
+
 DemuxerImpl*
 DemuxerImpl::make() {
   Global::init();
@@ -118,27 +134,12 @@ DemuxerImpl::open(const char *url, DemuxerFormat* format,
 
   if (mIOHandler) {
     ctx->flags |= AVFMT_FLAG_CUSTOM_IO;
-    // free and realloc the input buffer length
-    uint8_t* buffer = (uint8_t*)av_malloc(mInputBufferLength);
-    if (!buffer) {
-      mState = STATE_ERROR;
-      VS_THROW(HumbleBadAlloc());
-    }
-
-    // we will allocate ourselves an io context;
-    // ownership of buffer passes here.
-    ctx->pb = avio_alloc_context(
-        buffer,
-        mInputBufferLength,
-        0,
-        mIOHandler,
-        Container::url_read,
-        Container::url_write,
-        Container::url_seek);
+    // we will allocate ourselves an io context that counts calls into
+    // the handler and, if no length was set, picks and grows its buffer.
+    ctx->pb = getIO()->open(mIOHandler, url, false, mInputBufferLength);
     if (!ctx->pb) {
-      av_free(buffer);
       mState = STATE_ERROR;
-      VS_THROW(HumbleRuntimeError::make("could not open url due to internal error: %s", url));
+      VS_THROW(HumbleBadAlloc());
     }
   }
   // Check for passed in options
@@ -181,8 +182,8 @@ DemuxerImpl::open(const char *url, DemuxerFormat* format,
 
 void
 DemuxerImpl::setInputBufferLength(int32_t size) {
-  if (size <= 0)
-    VS_THROW(HumbleInvalidArgument("size <= 0"));
+  if (size < 0)
+    VS_THROW(HumbleInvalidArgument("size < 0"));
   if (mState != STATE_INITED)
     VS_THROW(HumbleRuntimeError("Demuxer object has already been opened"));
   mInputBufferLength = size;
@@ -212,6 +213,11 @@ DemuxerImpl::close() {
     VS_THROW(HumbleRuntimeError("Attempt to close container when not opened, playing or paused"));
   }
 
+  // the read-ahead thread must let go of the context before we free it
+  if (mReadAhead)
+    mReadAhead->flush();
+  mDeferredReadError = 0;
+
   // we need to remember the avio context
   AVIOContext* pb = this->getFormatCtx()->pb;
 
@@ -238,8 +244,7 @@ DemuxerImpl::doCloseFileHandles(AVIOContext* pb)
     if (pb) avio_flush(pb);
     // close our handle
     retval = mIOHandler->url_close();
-    if (pb) av_freep(&pb->buffer);
-    av_free(pb);
+    getIO()->close();
     delete mIOHandler;
     mIOHandler = 0;
   } else
@@ -259,50 +264,173 @@ DemuxerImpl::getStream(int32_t position) {
   return DemuxerStream::make(this, position);
 }
 
+void
+DemuxerImpl::selectStreams(const int32_t streamIndexes[],
+    int32_t numStreamIndexes) {
+  if (!(mState == STATE_OPENED ||
+      mState == STATE_PLAYING ||
+      mState == STATE_PAUSED)) {
+    VS_THROW(HumbleRuntimeError("Attempt to select streams in Demuxer when not opened, playing or paused"));
+  }
+  if (numStreamIndexes > 0 && !streamIndexes)
+    VS_THROW(HumbleInvalidArgument("no stream indexes passed in"));
+  int32_t n = getFormatCtx()->nb_streams;
+  for(int32_t i = 0; i < numStreamIndexes; i++)
+    if (streamIndexes[i] < 0 || streamIndexes[i] >= n)
+      VS_THROW(HumbleInvalidArgument::make("stream index %" PRIi32 " is not a stream in this Demuxer",
+          streamIndexes[i]));
+
+  for(int32_t i = 0; i < n; i++) {
+    enum AVDiscard discard = AVDISCARD_ALL;
+    for(int32_t j = 0; j < numStreamIndexes; j++)
+      if (streamIndexes[j] == i)
+        discard = AVDISCARD_DEFAULT;
+    getFormatCtx()->streams[i]->discard = discard;
+  }
+}
+
 int32_t
 DemuxerImpl::read(MediaPacket* ipkt) {
   int32_t retval = -1;
   MediaPacketImpl* pkt = dynamic_cast<MediaPacketImpl*>(ipkt);
   if (pkt)
-  {
-    pkt->reset(0);
-    AVPacket* packet=pkt->getCtx();
+    retval = doRead(pkt);
+  VS_CHECK_INTERRUPT(true);
+  // If we do not have enoughd ata, set retval to 0 and return. The caller
+  // should know to call again given that 0 bytes returned with incomplete
+  // packet.
+  if (retval == AVERROR(EAGAIN))
+    retval = 0;
 
-    int32_t numReads=0;
-    pkt->setComplete(false, pkt->getSize());
+  if (retval < 0 && retval != AVERROR_EOF)
+    // throw exception in this case
+    FfmpegException::check(retval, "exception on read of: %s; ", getURL());
+  return retval;
+}
+
+int32_t
+DemuxerImpl::readBatch(MediaPacket* packets[], int32_t numPackets,
+    int32_t maxBytes, int64_t maxDuration) {
+  if (!packets || numPackets <= 0)
+    VS_THROW(HumbleInvalidArgument("no packets to read into"));
+  for(int32_t i = 0; i < numPackets; i++)
+    if (!dynamic_cast<MediaPacketImpl*>(packets[i]))
+      VS_THROW(HumbleInvalidArgument("null packet passed to readBatch"));
+
+  AVFormatContext* ctx = getFormatCtx();
+  int32_t retval = 0;
+  int32_t numRead = 0;
+  int64_t bytes = 0;
+  int64_t firstDts = Global::NO_PTS;
+  while(numRead < numPackets) {
+    MediaPacketImpl* pkt = static_cast<MediaPacketImpl*>(packets[numRead]);
+    retval = doRead(pkt);
+    if (retval < 0 || !pkt->isComplete())
+      break;
+    ++numRead;
+
+    bytes += pkt->getSize();
+    if (maxBytes > 0 && bytes >= maxBytes)
+      break;
+    if (maxDuration > 0) {
+      AVPacket* packet = pkt->getCtx();
+      if (packet->dts != AV_NOPTS_VALUE &&
+          packet->stream_index >= 0 &&
+          (uint32_t)packet->stream_index < ctx->nb_streams) {
+        AVRational defaultTb = { 1, (int)Global::DEFAULT_PTS_PER_SECOND };
+        int64_t dts = av_rescale_q(packet->dts,
+            ctx->streams[packet->stream_index]->time_base, defaultTb);
+        if (firstDts == Global::NO_PTS)
+          firstDts = dts;
+        else if (dts - firstDts >= maxDuration)
+          break;
+      }
+    }
+  }
+  // one interrupt check for the whole batch.
+  VS_CHECK_INTERRUPT(true);
+  VS_LOG_TRACE("readBatch Demuxer@%p[n:%" PRIi32 ";b:%" PRIi64 ";e:%" PRIi32 "]",
+      this, numRead, bytes, retval);
+  // Packets already read win; an error that cut the batch short is
+  // handed to the next read instead (EOF just happens again by itself).
+  if (numRead > 0) {
+    if (retval < 0 && retval != AVERROR(EAGAIN) && retval != AVERROR_EOF)
+      mDeferredReadError = retval;
+    return numRead;
+  }
+  if (retval == AVERROR(EAGAIN))
+    retval = 0;
+  if (retval < 0 && retval != AVERROR_EOF)
+    FfmpegException::check(retval, "exception on read of: %s; ", getURL());
+  return retval < 0 ? retval : 0;
+}
+
+int32_t
+DemuxerImpl::doRead(MediaPacketImpl* pkt) {
+  int32_t retval = -1;
+  pkt->reset(0);
+  AVPacket* packet=pkt->getCtx();
+
+  int32_t numReads=0;
+  pkt->setComplete(false, pkt->getSize());
+  if (mDeferredReadError) {
+    retval = mDeferredReadError;
+    mDeferredReadError = 0;
+    return retval;
+  }
+  retval = DemuxerReadAhead::NOT_RUNNING;
+  if (mReadAhead) {
+    if ((mState == STATE_OPENED || mState == STATE_PLAYING) &&
+        !canStreamsBeAddedDynamically())
+      mReadAhead->startReading();
+    retval = mReadAhead->next(packet);
+    // the read-ahead thread may have queued packets from before a stream
+    // was discarded; if it has stopped since, read the rest ourselves.
+    while (retval >= 0 && retval != DemuxerReadAhead::NOT_RUNNING &&
+        dropIfDiscarded(packet))
+      retval = mReadAhead->next(packet);
+  }
+  if (retval == DemuxerReadAhead::NOT_RUNNING)
+  {
+    ContainerIO::adapt(this->getFormatCtx()->pb);
     do
     {
-      retval = av_read_frame(this->getFormatCtx(),
-          packet);
-      ++numReads;
+      do
+      {
+        retval = av_read_frame(this->getFormatCtx(),
+            packet);
+        ++numReads;
+      }
+      while (retval == AVERROR(EAGAIN) &&
+          (mReadRetryMax < 0 || numReads <= mReadRetryMax));
     }
-    while (retval == AVERROR(EAGAIN) &&
-        (mReadRetryMax < 0 || numReads <= mReadRetryMax));
+    // formats that do not honor AVStream::discard themselves still hand us
+    // packets from discarded streams
+    while (retval >= 0 && dropIfDiscarded(packet));
+  }
 
-    // and let's try to set the packet time base if known
-    if (retval >= 0) {
-      if (pkt->getStreamIndex() >= 0)
+  // and let's try to set the packet time base if known
+  if (retval >= 0) {
+    if (pkt->getStreamIndex() >= 0)
+    {
+      // Get a Container Stream rather than a DemuxerStream; this avoids unnecessarily
+      // recreating all the demuxer streams, decoders and codecs.
+      Container::Stream* stream = ((Container*)this)->getStream(pkt->getStreamIndex());
+      if (stream)
       {
-        // Get a Container Stream rather than a DemuxerStream; this avoids unnecessarily
-        // recreating all the demuxer streams, decoders and codecs.
-        Container::Stream* stream = ((Container*)this)->getStream(pkt->getStreamIndex());
-        if (stream)
+        // the stream caches both, so this costs no allocations per packet.
+        pkt->setCoder(stream->peekCoder());
+        Rational* streamBase = stream->peekTimeBase();
+        if (streamBase)
         {
-          // let's set the packet coder.
-          RefPointer<Coder> coder = stream->getCoder();
-          pkt->setCoder(coder.value());
-          AVStream* avStream = stream->getCtx();
-          RefPointer<Rational> streamBase = Rational::make(avStream->time_base.num,
-                                                           avStream->time_base.den);
-          if (streamBase)
-          {
-            pkt->setTimeBase(streamBase.value());
-          }
+          pkt->setTimeBase(streamBase);
         }
       }
-
-      pkt->setComplete(pkt->getSize()>0, pkt->getSize());
     }
+
+    pkt->setComplete(pkt->getSize()>0, pkt->getSize());
+  }
+  if (VS_LOG_TRACE_ENABLED()) {
     char descr[256];
     pkt->logMetadata(descr, sizeof(descr));
     VS_LOG_TRACE("read Demuxer@%p[p:%s;e:%"  PRIi64 "]",
@@ -310,19 +438,20 @@ DemuxerImpl::read(MediaPacket* ipkt) {
                  descr,
                  (int64_t)retval);
   }
-  VS_CHECK_INTERRUPT(true);
-  // If we do not have enoughd ata, set retval to 0 and return. The caller
-  // should know to call again given that 0 bytes returned with incomplete
-  // packet.
-  if (retval == AVERROR(EAGAIN))
-    retval = 0;
-
-  if (retval < 0 && retval != AVERROR_EOF)
-    // throw exception in this case
-    FfmpegException::check(retval, "exception on read of: %s; ", getURL());
   return retval;
 }
 
+bool
+DemuxerImpl::dropIfDiscarded(AVPacket* packet) {
+  AVFormatContext* ctx = getFormatCtx();
+  if (packet->stream_index < 0 ||
+      packet->stream_index >= (int32_t)ctx->nb_streams ||
+      ctx->streams[packet->stream_index]->discard < AVDISCARD_ALL)
+    return false;
+  av_packet_unref(packet);
+  return true;
+}
+
 void
 DemuxerImpl::queryStreamMetaData() {
   if (!(mState == STATE_OPENED ||
@@ -331,7 +460,13 @@ DemuxerImpl::queryStreamMetaData() {
     VS_THROW(HumbleRuntimeError("Attempt to query stream information from container when not opened, playing or paused"));
   }
   if (!mStreamInfoGotten) {
-    FfmpegException::check(avformat_find_stream_info(this->getFormatCtx(), 0), "could not queryStreamMetaData on: %s; ", getURL());
+    if (mReadAhead)
+      mReadAhead->stopReading();
+    DemuxerProbeCache* cache = DemuxerProbeCache::get();
+    if (!cache->apply(getURL(), this->getFormatCtx())) {
+      FfmpegException::check(avformat_find_stream_info(this->getFormatCtx(), 0), "could not queryStreamMetaData on: %s; ", getURL());
+      cache->store(getURL(), this->getFormatCtx());
+    }
     mStreamInfoGotten = true;
   }
   Container::doSetupStreams();
@@ -415,6 +550,25 @@ DemuxerImpl::setReadRetryCount(int32_t count) {
     mReadRetryMax = count;
 }
 
+void
+DemuxerImpl::setReadAhead(int32_t maxPackets, int32_t maxBytes,
+    int64_t maxDuration) {
+  AVFormatContext* ctx = this->getFormatCtx();
+  if (!mReadAhead)
+    mReadAhead = new DemuxerReadAhead(ctx);
+  mReadAhead->setLimits(maxPackets, maxBytes, maxDuration);
+  if (!mReadAhead->isEnabled())
+    // keep what was queued; read() drains it before reading directly again.
+    mReadAhead->stopReading();
+  VS_LOG_DEBUG("setReadAhead Demuxer@%p[p:%" PRIi32 ";b:%" PRIi32 ";d:%" PRIi64 "]",
+      this, maxPackets, maxBytes, maxDuration);
+}
+
+bool
+DemuxerImpl::isReadAhead() {
+  return mReadAhead && mReadAhead->isEnabled();
+}
+
 bool
 DemuxerImpl::canStreamsBeAddedDynamically() {
   return this->getFormatCtx()->ctx_flags & AVFMTCTX_NOHEADER;
@@ -457,7 +611,21 @@ DemuxerImpl::seek(int32_t stream_index, int64_t min_ts, int64_t ts,
   {
     VS_THROW(HumbleRuntimeError("Can only seek on OPEN (not paused or playing) Demuxers"));
   }
-  int32_t retval = avformat_seek_file(this->getFormatCtx(),
+  // anything read ahead is from the wrong place now
+  if (mReadAhead)
+    mReadAhead->flush();
+  mDeferredReadError = 0;
+  int32_t retval;
+  int64_t pos = -1;
+  // with a full index, go straight to the key frame rather than letting
+  // FFmpeg bisect the file on time stamps.
+  if (mSeekIndexed && !(flags & (SEEK_BYTE|SEEK_ANY|SEEK_FRAME)) &&
+      DemuxerSeekIndex::findPosition(this->getFormatCtx(), stream_index,
+          min_ts, ts, max_ts, &pos))
+    retval = avformat_seek_file(this->getFormatCtx(), -1, pos, pos, pos,
+        AVSEEK_FLAG_BYTE);
+  else
+    retval = avformat_seek_file(this->getFormatCtx(),
       stream_index,
       min_ts,
       ts,
@@ -469,12 +637,55 @@ DemuxerImpl::seek(int32_t stream_index, int64_t min_ts, int64_t ts,
   return retval;
 }
 
+int32_t
+DemuxerImpl::buildSeekIndex() {
+  if (mState != STATE_OPENED)
+  {
+    VS_THROW(HumbleRuntimeError("Can only index OPEN (not paused or playing) Demuxers"));
+  }
+  if (mReadAhead)
+    mReadAhead->flush();
+  mDeferredReadError = 0;
+  int32_t retval = DemuxerSeekIndex::build(this->getFormatCtx(),
+      mReadRetryMax);
+  mSeekIndexed = true;
+  return retval;
+}
+
+void
+DemuxerImpl::saveSeekIndex(const char* path) {
+  if (!(mState == STATE_OPENED ||
+      mState == STATE_PLAYING ||
+      mState == STATE_PAUSED)) {
+    VS_THROW(HumbleRuntimeError("Attempt to save seek index when not opened, playing or paused"));
+  }
+  DemuxerSeekIndex::save(this->getFormatCtx(), path);
+}
+
+int32_t
+DemuxerImpl::loadSeekIndex(const char* path) {
+  if (!(mState == STATE_OPENED ||
+      mState == STATE_PLAYING ||
+      mState == STATE_PAUSED)) {
+    VS_THROW(HumbleRuntimeError("Attempt to load seek index when not opened, playing or paused"));
+  }
+  // the read-ahead thread must not read while the index changes
+  if (mReadAhead)
+    mReadAhead->stopReading();
+  int32_t retval = DemuxerSeekIndex::load(this->getFormatCtx(), path);
+  if (retval >= 0)
+    mSeekIndexed = true;
+  return retval;
+}
+
 void
 DemuxerImpl::pause() {
   if (mState != STATE_PLAYING)
   {
     VS_THROW(HumbleRuntimeError("Can only pause containers in PLAYING state."));
   }
+  if (mReadAhead)
+    mReadAhead->stopReading();
   int32_t retval = av_read_pause(this->getFormatCtx());
   FfmpegException::check(retval, "Could not pause url: %s; ", getURL());
   mState = STATE_PAUSED;
@@ -482,7 +693,7 @@ DemuxerImpl::pause() {
 
 void
 DemuxerImpl::play() {
-  if (mState != STATE_PAUSED || mState != STATE_OPENED)
+  if (mState != STATE_PAUSED && mState != STATE_OPENED)
   {
     VS_THROW(HumbleRuntimeError("Can only play containers in OPENED or PAUSED states"));
   }
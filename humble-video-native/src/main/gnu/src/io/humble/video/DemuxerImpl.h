@@ -29,6 +29,7 @@
 #include <io/humble/ferry/RefPointer.h>
 #include <io/humble/video/Demuxer.h>
 #include <io/humble/video/DemuxerStream.h>
+#include <io/humble/video/DemuxerReadAhead.h>
 #include <io/humble/video/customio/URLProtocolHandler.h>
 
 #include <vector>
@@ -37,6 +38,8 @@ namespace io {
 namespace humble {
 namespace video {
 
+class MediaPacketImpl;
+
 class DemuxerImpl : public io::humble::video::Demuxer
 {
 public:
@@ -68,9 +71,16 @@ public:
   virtual DemuxerStream*
   getStream(int32_t streamIndex);
 
+  virtual void
+  selectStreams(const int32_t streamIndexes[], int32_t numStreamIndexes);
+
   virtual int32_t
   read(MediaPacket *packet);
 
+  virtual int32_t
+  readBatch(MediaPacket* packets[], int32_t numPackets,
+      int32_t maxBytes, int64_t maxDuration);
+
   virtual void
   queryStreamMetaData();
 
@@ -107,6 +117,12 @@ public:
   virtual void
   setReadRetryCount(int32_t count);
 
+  virtual void
+  setReadAhead(int32_t maxPackets, int32_t maxBytes, int64_t maxDuration);
+
+  virtual bool
+  isReadAhead();
+
   virtual bool
   canStreamsBeAddedDynamically();
 
@@ -129,6 +145,15 @@ public:
   seek(int32_t stream_index, int64_t min_ts, int64_t ts,
       int64_t max_ts, int32_t flags);
 
+  virtual int32_t
+  buildSeekIndex();
+
+  virtual void
+  saveSeekIndex(const char* path);
+
+  virtual int32_t
+  loadSeekIndex(const char* path);
+
   virtual void
   play();
 
@@ -142,16 +167,22 @@ protected:
   virtual AVFormatContext* getFormatCtx();
 
 private:
+  static int avioInterruptCB(void*);
+  int32_t doRead(MediaPacketImpl* packet);
+  bool dropIfDiscarded(AVPacket* packet);
   int32_t doOpen(const char*, AVDictionary**);
   int32_t doCloseFileHandles(AVIOContext* pb);
   State mState;
   bool mStreamInfoGotten;
   AVFormatContext* mCtx;
   int32_t mReadRetryMax;
+  int32_t mDeferredReadError;
+  bool mSeekIndexed;
   int32_t mInputBufferLength;
   io::humble::video::customio::URLProtocolHandler* mIOHandler;
   io::humble::ferry::RefPointer<DemuxerFormat> mFormat;
   io::humble::ferry::RefPointer<KeyValueBag> mMetaData;
+  DemuxerReadAhead* mReadAhead;
 };
 
 } /* namespace video */
@@ -0,0 +1,355 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include "DemuxerProbeCache.h"
+#include "CacheFile.h"
+
+#include <stdio.h>
+#include <string.h>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.DemuxerProbeCache);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+namespace {
+
+const char sMagic[4] = { 'H', 'V', 'P', 'C' };
+const int32_t sFileVersion = 1;
+const int32_t sMaxStreams = 4096;
+
+template<class IO>
+bool
+xfer(IO& io, DemuxerProbeCache::StreamInfo& s) {
+  return io.i32(s.codecType) && io.i32(s.codecId) && io.i32(s.codecTag) &&
+      io.q(s.timeBase) && io.q(s.rFrameRate) && io.q(s.avgFrameRate) &&
+      io.q(s.sampleAspectRatio) && io.i64(s.startTime) &&
+      io.i64(s.duration) && io.i64(s.numFrames) &&
+      io.q(s.codecTimeBase) && io.i32(s.ticksPerFrame) &&
+      io.i64(s.bitRate) && io.i32(s.width) && io.i32(s.height) &&
+      io.i32(s.codedWidth) && io.i32(s.codedHeight) && io.i32(s.pixFmt) &&
+      io.q(s.codecSampleAspectRatio) && io.i32(s.hasBFrames) &&
+      io.i32(s.profile) && io.i32(s.level) && io.i32(s.sampleRate) &&
+      io.i32(s.channels) && io.i64(s.channelLayout) &&
+      io.i32(s.sampleFmt) && io.i32(s.frameSize) &&
+      io.i32(s.blockAlign) && io.str(s.extraData);
+}
+
+template<class IO>
+bool
+xfer(IO& io, DemuxerProbeCache::Entry& e) {
+  if (!(io.str(e.key) && io.str(e.format) && io.i64(e.startTime) &&
+      io.i64(e.duration) && io.i64(e.bitRate)))
+    return false;
+  int32_t numStreams = (int32_t)e.streams.size();
+  if (!io.i32(numStreams) || numStreams < 0 || numStreams > sMaxStreams)
+    return false;
+  e.streams.resize(numStreams);
+  for(int32_t i = 0; i < numStreams; i++)
+    if (!xfer(io, e.streams[i]))
+      return false;
+  return true;
+}
+
+}
+
+DemuxerProbeCache DemuxerProbeCache::sCache;
+
+DemuxerProbeCache::DemuxerProbeCache() {
+  mMaxEntries = 0;
+}
+
+DemuxerProbeCache::~DemuxerProbeCache() {
+}
+
+DemuxerProbeCache*
+DemuxerProbeCache::get() {
+  return &sCache;
+}
+
+void
+DemuxerProbeCache::setMaxEntries(int32_t maxEntries) {
+  Lock::Guard g(&mLock);
+  mMaxEntries = maxEntries < 0 ? 0 : maxEntries;
+  trim();
+}
+
+int32_t
+DemuxerProbeCache::getMaxEntries() {
+  Lock::Guard g(&mLock);
+  return mMaxEntries;
+}
+
+int32_t
+DemuxerProbeCache::getNumEntries() {
+  Lock::Guard g(&mLock);
+  return (int32_t)mEntries.size();
+}
+
+bool
+DemuxerProbeCache::makeKey(const char* url, std::string* key) {
+  int64_t size = 0;
+  int64_t modified = 0;
+  // to the nanosecond, so a file rewritten within a second is a new key
+  const char* path = statCacheSource(url, &size, &modified);
+  if (!path)
+    return false;
+  char id[64];
+  snprintf(id, sizeof(id), "%" PRIi64 ":%" PRIi64 ":", size, modified);
+  *key = id;
+  key->append(path);
+  return true;
+}
+
+bool
+DemuxerProbeCache::apply(const char* url, AVFormatContext* ctx) {
+  std::string key;
+  if (!ctx || !ctx->iformat || !makeKey(url, &key))
+    return false;
+
+  Entry entry;
+  {
+    Lock::Guard g(&mLock);
+    if (mMaxEntries <= 0)
+      return false;
+    std::map<std::string, std::list<Entry>::iterator>::iterator found =
+        mIndex.find(key);
+    if (found == mIndex.end())
+      return false;
+    mEntries.splice(mEntries.begin(), mEntries, found->second);
+    entry = mEntries.front();
+  }
+
+  // Only fill in streams the header has already told us about; if they
+  // do not line up, the file is not what we think it is.
+  if (entry.format != ctx->iformat->name ||
+      entry.streams.size() != ctx->nb_streams)
+    return false;
+  for(uint32_t i = 0; i < ctx->nb_streams; i++) {
+    const StreamInfo& s = entry.streams[i];
+    AVStream* st = ctx->streams[i];
+    AVCodecContext* c = st->codec;
+    if (av_cmp_q(st->time_base, s.timeBase) ||
+        (c->codec_type != AVMEDIA_TYPE_UNKNOWN && c->codec_type != s.codecType) ||
+        (c->codec_id != AV_CODEC_ID_NONE && c->codec_id != s.codecId))
+      return false;
+  }
+
+  for(uint32_t i = 0; i < ctx->nb_streams; i++) {
+    const StreamInfo& s = entry.streams[i];
+    AVStream* st = ctx->streams[i];
+    AVCodecContext* c = st->codec;
+    st->r_frame_rate = s.rFrameRate;
+    st->avg_frame_rate = s.avgFrameRate;
+    st->sample_aspect_ratio = s.sampleAspectRatio;
+    st->start_time = s.startTime;
+    st->duration = s.duration;
+    st->nb_frames = s.numFrames;
+    c->codec_type = (enum AVMediaType)s.codecType;
+    c->codec_id = (enum AVCodecID)s.codecId;
+    c->codec_tag = s.codecTag;
+    c->time_base = s.codecTimeBase;
+    c->ticks_per_frame = s.ticksPerFrame;
+    c->bit_rate = s.bitRate;
+    c->width = s.width;
+    c->height = s.height;
+    c->coded_width = s.codedWidth;
+    c->coded_height = s.codedHeight;
+    c->pix_fmt = (enum AVPixelFormat)s.pixFmt;
+    c->sample_aspect_ratio = s.codecSampleAspectRatio;
+    c->has_b_frames = s.hasBFrames;
+    c->profile = s.profile;
+    c->level = s.level;
+    c->sample_rate = s.sampleRate;
+    c->channels = s.channels;
+    c->channel_layout = s.channelLayout;
+    c->sample_fmt = (enum AVSampleFormat)s.sampleFmt;
+    c->frame_size = s.frameSize;
+    c->block_align = s.blockAlign;
+    int32_t extraSize = (int32_t)s.extraData.size();
+    if (extraSize && (c->extradata_size != extraSize ||
+        memcmp(c->extradata, s.extraData.data(), extraSize))) {
+      uint8_t* extra = (uint8_t*)av_mallocz(extraSize + FF_INPUT_BUFFER_PADDING_SIZE);
+      if (!extra)
+        throw HumbleBadAlloc();
+      memcpy(extra, s.extraData.data(), extraSize);
+      av_free(c->extradata);
+      c->extradata = extra;
+      c->extradata_size = extraSize;
+    }
+  }
+  ctx->start_time = entry.startTime;
+  ctx->duration = entry.duration;
+  ctx->bit_rate = entry.bitRate;
+  VS_LOG_DEBUG("probe cache hit: %s", url);
+  return true;
+}
+
+void
+DemuxerProbeCache::store(const char* url, AVFormatContext* ctx) {
+  if (getMaxEntries() <= 0)
+    return;
+  Entry entry;
+  if (!ctx || !ctx->iformat || !makeKey(url, &entry.key))
+    return;
+
+  entry.format = ctx->iformat->name;
+  entry.startTime = ctx->start_time;
+  entry.duration = ctx->duration;
+  entry.bitRate = ctx->bit_rate;
+  entry.streams.resize(ctx->nb_streams);
+  for(uint32_t i = 0; i < ctx->nb_streams; i++) {
+    StreamInfo& s = entry.streams[i];
+    AVStream* st = ctx->streams[i];
+    AVCodecContext* c = st->codec;
+    s.codecType = c->codec_type;
+    s.codecId = c->codec_id;
+    s.codecTag = c->codec_tag;
+    s.timeBase = st->time_base;
+    s.rFrameRate = st->r_frame_rate;
+    s.avgFrameRate = st->avg_frame_rate;
+    s.sampleAspectRatio = st->sample_aspect_ratio;
+    s.startTime = st->start_time;
+    s.duration = st->duration;
+    s.numFrames = st->nb_frames;
+    s.codecTimeBase = c->time_base;
+    s.ticksPerFrame = c->ticks_per_frame;
+    s.bitRate = c->bit_rate;
+    s.width = c->width;
+    s.height = c->height;
+    s.codedWidth = c->coded_width;
+    s.codedHeight = c->coded_height;
+    s.pixFmt = c->pix_fmt;
+    s.codecSampleAspectRatio = c->sample_aspect_ratio;
+    s.hasBFrames = c->has_b_frames;
+    s.profile = c->profile;
+    s.level = c->level;
+    s.sampleRate = c->sample_rate;
+    s.channels = c->channels;
+    s.channelLayout = c->channel_layout;
+    s.sampleFmt = c->sample_fmt;
+    s.frameSize = c->frame_size;
+    s.blockAlign = c->block_align;
+    if (c->extradata && c->extradata_size > 0)
+      s.extraData.assign((const char*)c->extradata, c->extradata_size);
+  }
+  Lock::Guard g(&mLock);
+  insert(entry);
+}
+
+void
+DemuxerProbeCache::insert(const Entry& entry) {
+  if (mMaxEntries <= 0)
+    return;
+  std::map<std::string, std::list<Entry>::iterator>::iterator found =
+      mIndex.find(entry.key);
+  if (found != mIndex.end()) {
+    mEntries.erase(found->second);
+    mIndex.erase(found);
+  }
+  mEntries.push_front(entry);
+  mIndex[entry.key] = mEntries.begin();
+  trim();
+}
+
+void
+DemuxerProbeCache::trim() {
+  while((int32_t)mEntries.size() > mMaxEntries) {
+    mIndex.erase(mEntries.back().key);
+    mEntries.pop_back();
+  }
+}
+
+int32_t
+DemuxerProbeCache::load(const char* path) {
+  if (!path || !*path)
+    VS_THROW(HumbleInvalidArgument("no path for probe cache"));
+  FILE* f = fopen(path, "rb");
+  if (!f)
+    VS_THROW(HumbleRuntimeError::make("could not open probe cache: %s", path));
+
+  CacheFileReader in(f);
+  char magic[sizeof(sMagic)];
+  int32_t version = 0;
+  int32_t lavfVersion = 0;
+  int32_t numEntries = 0;
+  if (!in.bytes(magic, sizeof(magic)) ||
+      memcmp(magic, sMagic, sizeof(magic)) ||
+      !in.i32(version) || version != sFileVersion ||
+      !in.i32(lavfVersion) || lavfVersion != (int32_t)LIBAVFORMAT_VERSION_INT ||
+      !in.i32(numEntries) || numEntries < 0) {
+    fclose(f);
+    VS_LOG_WARN("ignoring incompatible probe cache: %s", path);
+    return -1;
+  }
+  // Read in file order (most recent first) and add oldest first so the
+  // recency order survives.
+  std::vector<Entry> entries;
+  for(int32_t i = 0; i < numEntries; i++) {
+    Entry entry;
+    if (!xfer(in, entry)) {
+      VS_LOG_WARN("probe cache truncated after %" PRIi32 " entries: %s",
+          i, path);
+      break;
+    }
+    entries.push_back(entry);
+  }
+  fclose(f);
+
+  Lock::Guard g(&mLock);
+  for(size_t i = entries.size(); i > 0; i--)
+    insert(entries[i-1]);
+  return (int32_t)entries.size();
+}
+
+void
+DemuxerProbeCache::save(const char* path) {
+  if (!path || !*path)
+    VS_THROW(HumbleInvalidArgument("no path for probe cache"));
+  std::vector<Entry> entries;
+  {
+    Lock::Guard g(&mLock);
+    entries.assign(mEntries.begin(), mEntries.end());
+  }
+  FILE* f = fopen(path, "wb");
+  if (!f)
+    VS_THROW(HumbleRuntimeError::make("could not open probe cache for writing: %s", path));
+  CacheFileWriter out(f);
+  int32_t version = sFileVersion;
+  int32_t lavfVersion = LIBAVFORMAT_VERSION_INT;
+  int32_t numEntries = (int32_t)entries.size();
+  if (out.bytes(sMagic, sizeof(sMagic)) &&
+      out.i32(version) && out.i32(lavfVersion) && out.i32(numEntries))
+    for(size_t i = 0; i < entries.size() && xfer(out, entries[i]); i++)
+      ;
+  bool ok = out.ok();
+  if (fclose(f))
+    ok = false;
+  if (!ok)
+    VS_THROW(HumbleRuntimeError::make("could not write probe cache: %s", path));
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
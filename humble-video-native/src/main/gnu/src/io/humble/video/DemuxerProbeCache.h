@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef DEMUXERPROBECACHE_H_
+#define DEMUXERPROBECACHE_H_
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/FfmpegIncludes.h>
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. A process-wide, bounded (least-recently-used) cache of what
+ * avformat_find_stream_info found out about local files, so that
+ * DemuxerImpl#queryStreamMetaData() can skip it when the same file is
+ * opened again.
+ * <p>
+ * Files are identified by path, size and modification time, to the
+ * nanosecond where the platform records it; anything that is not a plain
+ * local file is never cached. The cache is off until
+ * #setMaxEntries(int32_t) is called with a positive value.
+ * </p>
+ */
+class DemuxerProbeCache
+{
+public:
+  /** The one cache shared by all Demuxers. */
+  static DemuxerProbeCache* get();
+
+  /**
+   * Sets the most files remembered; 0 (the default) turns the cache off
+   * and empties it. Shrinking drops the least recently used entries.
+   */
+  void setMaxEntries(int32_t maxEntries);
+  int32_t getMaxEntries();
+  int32_t getNumEntries();
+
+  /**
+   * If url is a cached file whose streams match what is already in ctx,
+   * fills the rest of ctx in from the cache.
+   * @return true if ctx was filled in; false if the caller must probe.
+   */
+  bool apply(const char* url, AVFormatContext* ctx);
+  /** Remembers the (probed) streams in ctx for url, if url is cacheable. */
+  void store(const char* url, AVFormatContext* ctx);
+
+  /**
+   * Adds the entries saved in path by #save(const char*) to the cache,
+   * up to the maximum size. Entries for files that have since changed
+   * are kept but will never match.
+   * @return the number of entries read, or -1 if path was written by an
+   *   incompatible version of this library.
+   * @throws HumbleRuntimeError if path cannot be read.
+   */
+  int32_t load(const char* path);
+  /**
+   * Writes all entries to path.
+   * @throws HumbleRuntimeError if path cannot be written.
+   */
+  void save(const char* path);
+
+  struct StreamInfo {
+    int32_t codecType;
+    int32_t codecId;
+    int32_t codecTag;
+    AVRational timeBase;
+    AVRational rFrameRate;
+    AVRational avgFrameRate;
+    AVRational sampleAspectRatio;
+    int64_t startTime;
+    int64_t duration;
+    int64_t numFrames;
+    AVRational codecTimeBase;
+    int32_t ticksPerFrame;
+    int64_t bitRate;
+    int32_t width;
+    int32_t height;
+    int32_t codedWidth;
+    int32_t codedHeight;
+    int32_t pixFmt;
+    AVRational codecSampleAspectRatio;
+    int32_t hasBFrames;
+    int32_t profile;
+    int32_t level;
+    int32_t sampleRate;
+    int32_t channels;
+    int64_t channelLayout;
+    int32_t sampleFmt;
+    int32_t frameSize;
+    int32_t blockAlign;
+    std::string extraData;
+  };
+  struct Entry {
+    std::string key;
+    std::string format;
+    int64_t startTime;
+    int64_t duration;
+    int64_t bitRate;
+    std::vector<StreamInfo> streams;
+  };
+
+private:
+  DemuxerProbeCache();
+  ~DemuxerProbeCache();
+  DemuxerProbeCache(const DemuxerProbeCache&);
+  DemuxerProbeCache& operator=(const DemuxerProbeCache&);
+
+  static bool makeKey(const char* url, std::string* key);
+  void insert(const Entry& entry);
+  void trim();
+
+  static DemuxerProbeCache sCache;
+
+  io::humble::ferry::Lock mLock;
+  int32_t mMaxEntries;
+  // most recently used first
+  std::list<Entry> mEntries;
+  std::map<std::string, std::list<Entry>::iterator> mIndex;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* DEMUXERPROBECACHE_H_ */
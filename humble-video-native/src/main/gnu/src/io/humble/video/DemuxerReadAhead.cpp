@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/JNIHelper.h>
+#include "Global.h"
+#include "DemuxerReadAhead.h"
+#include "ContainerIO.h"
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.DemuxerReadAhead);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+DemuxerReadAhead::DemuxerReadAhead(AVFormatContext* ctx) {
+  mCtx = ctx;
+  mMaxPackets = 0;
+  mMaxBytes = 0;
+  mMaxDuration = 0;
+  mQueuedBytes = 0;
+  mStopping = false;
+  mAborting = false;
+  mFinished = false;
+  mError = 0;
+}
+
+DemuxerReadAhead::~DemuxerReadAhead() {
+  flush();
+}
+
+void
+DemuxerReadAhead::setLimits(int32_t maxPackets, int32_t maxBytes,
+    int64_t maxDuration) {
+  Lock::Guard g(&mLock);
+  mMaxPackets = maxPackets;
+  mMaxBytes = maxBytes;
+  mMaxDuration = maxDuration;
+  // limits may have grown
+  mNotFull.broadcast();
+}
+
+bool
+DemuxerReadAhead::isEnabled() {
+  return mMaxPackets > 0 || mMaxBytes > 0 || mMaxDuration > 0;
+}
+
+bool
+DemuxerReadAhead::isFull() {
+  if (mQueue.empty())
+    return false;
+  if (mMaxPackets > 0 && (int64_t)mQueue.size() >= mMaxPackets)
+    return true;
+  if (mMaxBytes > 0 && mQueuedBytes >= mMaxBytes)
+    return true;
+  if (mMaxDuration > 0) {
+    int64_t first = mQueue.front().time;
+    int64_t last = mQueue.back().time;
+    if (first != Global::NO_PTS && last != Global::NO_PTS &&
+        last - first >= mMaxDuration)
+      return true;
+  }
+  return false;
+}
+
+void
+DemuxerReadAhead::clear() {
+  while(!mQueue.empty()) {
+    av_packet_unref(&mQueue.front().pkt);
+    mQueue.pop_front();
+  }
+  mQueuedBytes = 0;
+}
+
+void
+DemuxerReadAhead::startReading() {
+  if (isStarted() || mFinished || !isEnabled())
+    return;
+  mStopping = false;
+  mAborting = false;
+  VS_LOG_TRACE("startReading DemuxerReadAhead@%p", this);
+  start();
+}
+
+void
+DemuxerReadAhead::stopReading() {
+  {
+    Lock::Guard g(&mLock);
+    mStopping = true;
+    mNotFull.broadcast();
+  }
+  join();
+  mStopping = false;
+}
+
+void
+DemuxerReadAhead::flush() {
+  {
+    Lock::Guard g(&mLock);
+    mStopping = true;
+    mAborting = true;
+    mNotFull.broadcast();
+  }
+  join();
+  Lock::Guard g(&mLock);
+  clear();
+  mFinished = false;
+  mError = 0;
+  mStopping = false;
+  mAborting = false;
+}
+
+bool
+DemuxerReadAhead::isAborting() {
+  return mAborting && isCurrentThread();
+}
+
+int32_t
+DemuxerReadAhead::next(AVPacket* pkt) {
+  Lock::Guard g(&mLock);
+  while(mQueue.empty()) {
+    if (mFinished)
+      return mError;
+    if (!isStarted())
+      return NOT_RUNNING;
+    // wake up every now and then to see if Java wants us to stop waiting
+    if (!mNotEmpty.timedWait(&mLock, 100000))
+      VS_CHECK_INTERRUPT(true);
+  }
+  Entry entry = mQueue.front();
+  mQueue.pop_front();
+  mQueuedBytes -= entry.pkt.size;
+  mNotFull.signal();
+
+  av_packet_unref(pkt);
+  av_packet_move_ref(pkt, &entry.pkt);
+  return 0;
+}
+
+void
+DemuxerReadAhead::run() {
+  for(;;) {
+    {
+      Lock::Guard g(&mLock);
+      while(!mStopping && isFull())
+        mNotFull.wait(&mLock);
+      if (mStopping)
+        break;
+    }
+    Entry entry;
+    av_init_packet(&entry.pkt);
+    entry.pkt.data = 0;
+    entry.pkt.size = 0;
+    ContainerIO::adapt(mCtx->pb);
+    int32_t retval = av_read_frame(mCtx, &entry.pkt);
+    if (retval == AVERROR(EAGAIN)) {
+      // nothing to read yet; try again shortly unless told to stop.
+      av_usleep(1000);
+      continue;
+    }
+
+    Lock::Guard g(&mLock);
+    if (retval < 0) {
+      VS_LOG_TRACE("run DemuxerReadAhead@%p[e:%" PRIi64 ";aborted:%d]",
+          this, (int64_t)retval, (int)mAborting);
+      if (!mAborting) {
+        mFinished = true;
+        mError = retval;
+      }
+      mNotEmpty.broadcast();
+      break;
+    }
+    entry.time = Global::NO_PTS;
+    int64_t ts = entry.pkt.dts != Global::NO_PTS ? entry.pkt.dts : entry.pkt.pts;
+    if (ts != Global::NO_PTS &&
+        entry.pkt.stream_index >= 0 &&
+        (uint32_t)entry.pkt.stream_index < mCtx->nb_streams) {
+      AVRational tb = mCtx->streams[entry.pkt.stream_index]->time_base;
+      AVRational defaultTb = { 1, (int)Global::DEFAULT_PTS_PER_SECOND };
+      if (tb.num && tb.den)
+        entry.time = av_rescale_q(ts, tb, defaultTb);
+    }
+    mQueue.push_back(entry);
+    mQueuedBytes += entry.pkt.size;
+    mNotEmpty.signal();
+  }
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
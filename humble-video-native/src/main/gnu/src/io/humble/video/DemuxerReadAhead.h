@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef DEMUXERREADAHEAD_H_
+#define DEMUXERREADAHEAD_H_
+
+#include <io/humble/ferry/Thread.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/FfmpegIncludes.h>
+
+#include <deque>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. Reads packets from an AVFormatContext on a background
+ * thread into a bounded queue that DemuxerImpl#read(MediaPacket*) drains.
+ * <p>
+ * While the thread is started it is the only caller of av_read_frame on
+ * the context; callers must #stop() or #flush() it before doing anything
+ * else (seeking, pausing, closing) that touches the demuxer's I/O.
+ * </p>
+ */
+class DemuxerReadAhead : public io::humble::ferry::Thread
+{
+public:
+  /**
+   * Returned by #next(AVPacket*) if the queue is empty and no thread is
+   * running to fill it; the caller should read synchronously instead.
+   */
+  static const int32_t NOT_RUNNING = 1;
+
+  DemuxerReadAhead(AVFormatContext* ctx);
+  virtual ~DemuxerReadAhead();
+
+  /**
+   * Sets the queue limits. The queue is full as soon as any positive
+   * limit is reached. maxDuration is in Global#DEFAULT_PTS_PER_SECOND units.
+   */
+  void setLimits(int32_t maxPackets, int32_t maxBytes, int64_t maxDuration);
+  /** @return true if any limit is positive. */
+  bool isEnabled();
+
+  /**
+   * Starts the reading thread if it is not already running and has not
+   * hit end of file or an error.
+   */
+  void startReading();
+  /**
+   * Lets the reading thread finish the packet it is on and stops it.
+   * Queued packets are kept.
+   */
+  void stopReading();
+  /**
+   * Interrupts and stops the reading thread, and discards all queued
+   * packets and any pending end of file or error.
+   */
+  void flush();
+
+  /**
+   * Moves the next queued packet into pkt, waiting for one if the thread
+   * is running.
+   * @return 0 on success, the error (e.g. AVERROR_EOF) the thread stopped
+   *   with once all queued packets are drained, or #NOT_RUNNING.
+   */
+  int32_t next(AVPacket* pkt);
+
+  /**
+   * @return true if the calling thread is the reading thread and it has
+   *   been asked to abort its current read.
+   */
+  bool isAborting();
+
+protected:
+  virtual void run();
+
+private:
+  struct Entry {
+    AVPacket pkt;
+    int64_t time;
+  };
+  bool isFull();
+  void clear();
+
+  AVFormatContext* mCtx;
+  int32_t mMaxPackets;
+  int32_t mMaxBytes;
+  int64_t mMaxDuration;
+
+  io::humble::ferry::Lock mLock;
+  io::humble::ferry::Condition mNotEmpty;
+  io::humble::ferry::Condition mNotFull;
+  std::deque<Entry> mQueue;
+  int64_t mQueuedBytes;
+  volatile bool mStopping;
+  volatile bool mAborting;
+  bool mFinished;
+  int32_t mError;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* DEMUXERREADAHEAD_H_ */
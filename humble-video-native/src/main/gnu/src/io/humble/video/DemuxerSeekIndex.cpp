@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/JNIHelper.h>
+#include <io/humble/ferry/HumbleException.h>
+#include "Global.h"
+#include "DemuxerSeekIndex.h"
+#include "CacheFile.h"
+#include "VideoExceptions.h"
+
+#include <stdio.h>
+#include <string.h>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.DemuxerSeekIndex);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+namespace {
+
+const char sMagic[4] = { 'H', 'V', 'S', 'I' };
+const int32_t sFileVersion = 2;
+
+/**
+ * When the file ctx reads was last modified, in nanoseconds, or -1 if it
+ * is not a local file.
+ */
+int64_t
+sourceModified(AVFormatContext* ctx) {
+  int64_t size = 0;
+  int64_t modified = -1;
+  if (!statCacheSource(ctx->filename, &size, &modified))
+    return -1;
+  return modified;
+}
+
+int32_t
+countEntries(AVFormatContext* ctx) {
+  int32_t retval = 0;
+  for(uint32_t i = 0; i < ctx->nb_streams; i++)
+    retval += ctx->streams[i]->nb_index_entries;
+  return retval;
+}
+
+}
+
+int32_t
+DemuxerSeekIndex::build(AVFormatContext* ctx, int32_t readRetryMax) {
+  AVPacket pkt;
+  av_init_packet(&pkt);
+  pkt.data = 0;
+  pkt.size = 0;
+  int32_t retval = 0;
+  int64_t numPackets = 0;
+  int32_t numRetries = 0;
+  for(;;) {
+    retval = av_read_frame(ctx, &pkt);
+    if (retval == AVERROR(EAGAIN)) {
+      // give up on inputs that never have anything, as Demuxer::read does
+      if (readRetryMax >= 0 && ++numRetries > readRetryMax)
+        break;
+      VS_CHECK_INTERRUPT(true);
+      if (ctx->interrupt_callback.callback &&
+          ctx->interrupt_callback.callback(ctx->interrupt_callback.opaque)) {
+        retval = AVERROR_EXIT;
+        break;
+      }
+      continue;
+    }
+    if (retval < 0)
+      break;
+    numRetries = 0;
+    if ((pkt.flags & AV_PKT_FLAG_KEY) && pkt.pos >= 0 &&
+        pkt.stream_index >= 0 && (uint32_t)pkt.stream_index < ctx->nb_streams) {
+      int64_t ts = pkt.dts != AV_NOPTS_VALUE ? pkt.dts : pkt.pts;
+      if (ts != AV_NOPTS_VALUE)
+        av_add_index_entry(ctx->streams[pkt.stream_index], pkt.pos, ts,
+            pkt.size, 0, AVINDEX_KEYFRAME);
+    }
+    av_free_packet(&pkt);
+    if (!(++numPackets % 256))
+      VS_CHECK_INTERRUPT(true);
+  }
+  VS_CHECK_INTERRUPT(true);
+  if (retval != AVERROR_EOF)
+    FfmpegException::check(retval, "could not index: %s; ", ctx->filename);
+
+  int64_t start = ctx->start_time != AV_NOPTS_VALUE ? ctx->start_time : 0;
+  retval = avformat_seek_file(ctx, -1, INT64_MIN, start, start, 0);
+  if (retval < 0)
+    VS_LOG_WARN("could not seek back to start after indexing: %s", ctx->filename);
+  retval = countEntries(ctx);
+  VS_LOG_DEBUG("indexed %s: %" PRIi32 " entries from %" PRIi64 " packets",
+      ctx->filename, retval, numPackets);
+  return retval;
+}
+
+void
+DemuxerSeekIndex::save(AVFormatContext* ctx, const char* path) {
+  if (!path || !*path)
+    VS_THROW(HumbleInvalidArgument("no path for seek index"));
+  FILE* f = fopen(path, "wb");
+  if (!f)
+    VS_THROW(HumbleRuntimeError::make("could not open seek index for writing: %s", path));
+  CacheFileWriter out(f);
+  int32_t version = sFileVersion;
+  int64_t fileSize = ctx->pb ? avio_size(ctx->pb) : -1;
+  int64_t modified = sourceModified(ctx);
+  int32_t numStreams = ctx->nb_streams;
+  if (out.bytes(sMagic, sizeof(sMagic)) && out.i32(version) &&
+      out.i64(fileSize) && out.i64(modified) && out.i32(numStreams))
+    for(uint32_t i = 0; i < ctx->nb_streams && out.ok(); i++) {
+      AVStream* st = ctx->streams[i];
+      int32_t numEntries = st->nb_index_entries;
+      if (!(out.q(st->time_base) && out.i32(numEntries)))
+        break;
+      for(int32_t j = 0; j < numEntries; j++) {
+        AVIndexEntry* e = &st->index_entries[j];
+        int32_t size = e->size;
+        int32_t flags = e->flags;
+        if (!(out.i64(e->pos) && out.i64(e->timestamp) &&
+            out.i32(size) && out.i32(flags)))
+          break;
+      }
+    }
+  bool ok = out.ok();
+  if (fclose(f))
+    ok = false;
+  if (!ok)
+    VS_THROW(HumbleRuntimeError::make("could not write seek index: %s", path));
+}
+
+int32_t
+DemuxerSeekIndex::load(AVFormatContext* ctx, const char* path) {
+  if (!path || !*path)
+    VS_THROW(HumbleInvalidArgument("no path for seek index"));
+  FILE* f = fopen(path, "rb");
+  if (!f)
+    VS_THROW(HumbleRuntimeError::make("could not open seek index: %s", path));
+
+  CacheFileReader in(f);
+  char magic[sizeof(sMagic)];
+  int32_t version = 0;
+  int64_t fileSize = 0;
+  int64_t modified = 0;
+  int32_t numStreams = 0;
+  // a file rewritten in place can keep its size, so check when it changed
+  bool matches = in.bytes(magic, sizeof(magic)) &&
+      !memcmp(magic, sMagic, sizeof(magic)) &&
+      in.i32(version) && version == sFileVersion &&
+      in.i64(fileSize) && fileSize == (ctx->pb ? avio_size(ctx->pb) : -1) &&
+      in.i64(modified) && modified == sourceModified(ctx) &&
+      in.i32(numStreams) && numStreams == (int32_t)ctx->nb_streams;
+  for(int32_t i = 0; matches && i < numStreams; i++) {
+    // the entries follow, so check every stream before adding anything
+    AVRational timeBase;
+    int32_t numEntries = 0;
+    matches = in.q(timeBase) && !av_cmp_q(timeBase, ctx->streams[i]->time_base) &&
+        in.i32(numEntries) && numEntries >= 0 &&
+        !fseek(f, numEntries * (int64_t)(2*sizeof(int64_t) + 2*sizeof(int32_t)), SEEK_CUR);
+  }
+  if (!matches) {
+    fclose(f);
+    VS_LOG_WARN("ignoring seek index that does not match %s: %s", ctx->filename, path);
+    return -1;
+  }
+
+  fseek(f, sizeof(sMagic) + sizeof(int32_t) + 2*sizeof(int64_t) +
+      sizeof(int32_t), SEEK_SET);
+  int32_t retval = 0;
+  for(int32_t i = 0; i < numStreams && in.ok(); i++) {
+    AVStream* st = ctx->streams[i];
+    AVRational timeBase;
+    int32_t numEntries = 0;
+    in.q(timeBase);
+    in.i32(numEntries);
+    for(int32_t j = 0; j < numEntries; j++) {
+      int64_t pos = 0, timestamp = 0;
+      int32_t size = 0, flags = 0;
+      if (!(in.i64(pos) && in.i64(timestamp) && in.i32(size) && in.i32(flags)))
+        break;
+      if (av_add_index_entry(st, pos, timestamp, size, 0, flags) >= 0)
+        ++retval;
+    }
+  }
+  fclose(f);
+  VS_LOG_DEBUG("loaded %" PRIi32 " index entries for %s from %s",
+      retval, ctx->filename, path);
+  return retval;
+}
+
+bool
+DemuxerSeekIndex::findPosition(AVFormatContext* ctx, int32_t streamIndex,
+    int64_t minTs, int64_t ts, int64_t maxTs, int64_t* pos) {
+  AVInputFormat* format = ctx->iformat;
+  // demuxers with their own seek already use the index; and without
+  // read_timestamp FFmpeg's generic seek uses it too.
+  if (!format || format->read_seek || format->read_seek2 ||
+      !format->read_timestamp || (format->flags & AVFMT_NO_BYTE_SEEK))
+    return false;
+
+  if (streamIndex < 0) {
+    streamIndex = av_find_default_stream_index(ctx);
+    if (streamIndex < 0)
+      return false;
+    AVRational from = { 1, AV_TIME_BASE };
+    AVRational to = ctx->streams[streamIndex]->time_base;
+    ts = av_rescale_q(ts, from, to);
+    if (minTs != INT64_MIN)
+      minTs = av_rescale_q_rnd(minTs, from, to, (enum AVRounding)(AV_ROUND_UP | AV_ROUND_PASS_MINMAX));
+    if (maxTs != INT64_MAX)
+      maxTs = av_rescale_q_rnd(maxTs, from, to, (enum AVRounding)(AV_ROUND_DOWN | AV_ROUND_PASS_MINMAX));
+  }
+  if ((uint32_t)streamIndex >= ctx->nb_streams)
+    return false;
+
+  AVStream* st = ctx->streams[streamIndex];
+  int i = av_index_search_timestamp(st, ts, AVSEEK_FLAG_BACKWARD);
+  if (i < 0 || st->index_entries[i].timestamp < minTs)
+    i = av_index_search_timestamp(st, ts, 0);
+  if (i < 0 || st->index_entries[i].timestamp < minTs ||
+      st->index_entries[i].timestamp > maxTs)
+    return false;
+  *pos = st->index_entries[i].pos;
+  return true;
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
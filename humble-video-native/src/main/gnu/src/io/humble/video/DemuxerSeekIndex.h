@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef DEMUXERSEEKINDEX_H_
+#define DEMUXERSEEKINDEX_H_
+
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/FfmpegIncludes.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. Builds, saves and loads the key-frame index FFmpeg keeps
+ * on each AVStream (AVStream::index_entries), for containers such as
+ * MPEG-TS or raw H.264 where the demuxer does not build a useful one.
+ */
+class DemuxerSeekIndex
+{
+public:
+  /**
+   * Reads ctx from where it is to the end, adding every key-frame packet
+   * to its stream's index, then seeks back to the start. Reads that
+   * return EAGAIN are retried up to readRetryMax times in a row (without
+   * limit if negative), checking for interruption between each.
+   * @return the number of index entries in all streams afterwards.
+   */
+  static int32_t build(AVFormatContext* ctx, int32_t readRetryMax);
+
+  /**
+   * Writes every stream's index to path.
+   * @throws HumbleRuntimeError if path cannot be written.
+   */
+  static void save(AVFormatContext* ctx, const char* path);
+
+  /**
+   * Adds the entries in path, written by #save(AVFormatContext*, const char*),
+   * to ctx's stream indexes.
+   * @return the number of entries added, or -1 if path was not written for
+   *   a file like this one (different size, modification time for local
+   *   files, streams or time bases) and was ignored.
+   * @throws HumbleRuntimeError if path cannot be read.
+   */
+  static int32_t load(AVFormatContext* ctx, const char* path);
+
+  /**
+   * For formats that FFmpeg would seek by bisecting on time stamps, finds
+   * the byte position of the indexed key frame to seek to instead, so a
+   * seek costs one I/O. Arguments are as for avformat_seek_file.
+   * @return true and sets pos if there is such a key frame; false if the
+   *   caller should let FFmpeg seek.
+   */
+  static bool findPosition(AVFormatContext* ctx, int32_t streamIndex,
+      int64_t minTs, int64_t ts, int64_t maxTs, int64_t* pos);
+
+private:
+  DemuxerSeekIndex();
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* DEMUXERSEEKINDEX_H_ */
@@ -57,6 +57,16 @@ DemuxerStream::getDemuxer() {
   return dynamic_cast<Demuxer*>(getContainer());
 }
 
+Codec::DiscardFlag
+DemuxerStream::getDiscard() {
+  return (Codec::DiscardFlag) getCtx()->discard;
+}
+
+void
+DemuxerStream::setDiscard(Codec::DiscardFlag discard) {
+  getCtx()->discard = (enum AVDiscard) discard;
+}
+
 Decoder*
 DemuxerStream::getDecoder() {
   AVStream* stream = getCtx();
@@ -52,6 +52,26 @@ public:
    */
   virtual Demuxer* getDemuxer();
 
+  /**
+   * Get which packets the Demuxer drops from this stream.
+   */
+  virtual Codec::DiscardFlag getDiscard();
+
+  /**
+   * Set which packets the Demuxer drops from this stream before they reach
+   * Demuxer#read(MediaPacket). Set Codec#DISCARD_ALL on streams you do not
+   * want and the Demuxer never returns their packets; many formats (MP4,
+   * MPEG-TS, Matroska) then skip over them without reading or parsing their
+   * payloads at all.
+   * <p>
+   * Streams default to Codec#DISCARD_DEFAULT. Which packets the in-between
+   * values drop is up to the format; most only honor Codec#DISCARD_ALL.
+   * </p>
+   *
+   * @param discard what to drop.
+   */
+  virtual void setDiscard(Codec::DiscardFlag discard);
+
 #ifndef SWIG
   static DemuxerStream*
   make(Container* container, int32_t index);
@@ -57,8 +57,10 @@ extern "C"
 #include <libswscale/swscale.h>
 
 #include <libavutil/samplefmt.h>
+#include <libavutil/audio_fifo.h>
 #include <libavutil/log.h>
 #include <libavutil/mathematics.h>
+#include <libavutil/time.h>
 
 
 }
@@ -0,0 +1,310 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <io/humble/video/Global.h>
+#include <io/humble/video/VideoExceptions.h>
+#include "FrameSeeker.h"
+
+#include <vector>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.FrameSeeker);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+namespace {
+const int64_t sDefaultMaxCachedBytes = 256*1024*1024;
+}
+
+/**
+ * Internal only. The decoded frames of one GOP, in display order, covering
+ * time stamps [mStart, mEnd).
+ */
+class FrameSeekerGop
+{
+public:
+  FrameSeekerGop(int64_t start) :
+      mStart(start), mEnd(INT64_MAX), mFirst(false), mBytes(0) {}
+
+  bool contains(int64_t timeStamp) {
+    return (mFirst || mStart == Global::NO_PTS || timeStamp >= mStart) &&
+        timeStamp < mEnd;
+  }
+
+  void add(MediaPicture* picture) {
+    if (mStart == Global::NO_PTS)
+      mStart = picture->getTimeStamp();
+    mFrames.push_back(RefPointer<MediaPicture>());
+    mFrames.back().reset(picture, true);
+    for(int32_t i = 0; i < picture->getNumDataPlanes(); i++)
+      mBytes += picture->getDataPlaneSize(i);
+  }
+
+  // a new picture over the cached frame's data, so callers can set its
+  // time stamp and such without changing what we hand out next time.
+  MediaPicture* frameAt(int64_t timeStamp) {
+    if (mFrames.empty())
+      return 0;
+    // frames come out of the decoder in display order; find the last one
+    // at or before timeStamp.
+    size_t lo = 0, hi = mFrames.size();
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (mFrames[mid]->getTimeStamp() <= timeStamp)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return MediaPicture::make(mFrames[lo ? lo - 1 : 0].value(), false);
+  }
+
+  int64_t mStart;
+  int64_t mEnd;
+  // true if there is no earlier key frame, so this GOP also covers any
+  // time before mStart.
+  bool mFirst;
+  // the picture data of mFrames
+  int64_t mBytes;
+  std::vector<RefPointer<MediaPicture> > mFrames;
+};
+
+FrameSeeker::FrameSeeker(Demuxer* demuxer, int32_t streamIndex,
+    Decoder* decoder, int32_t maxCachedGops) {
+  mDemuxer.reset(demuxer, true);
+  mDecoder.reset(decoder, true);
+  mPacket = MediaPacket::make();
+  mStreamIndex = streamIndex;
+  mMaxCachedGops = maxCachedGops;
+  mMaxCachedBytes = sDefaultMaxCachedBytes;
+  mCachedBytes = 0;
+}
+
+FrameSeeker::~FrameSeeker() {
+  clearCache();
+}
+
+FrameSeeker*
+FrameSeeker::make(Demuxer* demuxer, int32_t streamIndex,
+    int32_t maxCachedGops) {
+  Global::init();
+  if (!demuxer)
+    VS_THROW(HumbleInvalidArgument("no demuxer passed in"));
+  if (maxCachedGops < 0)
+    VS_THROW(HumbleInvalidArgument("maxCachedGops must be >= 0"));
+  if (streamIndex < 0 || streamIndex >= demuxer->getNumStreams())
+    VS_THROW(HumbleInvalidArgument("streamIndex is not a stream in demuxer"));
+
+  RefPointer<DemuxerStream> stream = demuxer->getStream(streamIndex);
+  RefPointer<Decoder> decoder = stream ? stream->getDecoder() : 0;
+  if (!decoder || decoder->getCodecType() != MediaDescriptor::MEDIA_VIDEO)
+    VS_THROW(HumbleInvalidArgument("streamIndex is not a video stream"));
+  if (decoder->getState() != Coder::STATE_OPENED)
+    decoder->open(0, 0);
+
+  FrameSeeker* retval = new FrameSeeker(demuxer, streamIndex,
+      decoder.value(), maxCachedGops);
+  VS_REF_ACQUIRE(retval);
+  return retval;
+}
+
+MediaPicture*
+FrameSeeker::seekToFrame(int64_t timeStamp) {
+  for(std::list<FrameSeekerGop*>::iterator it = mGops.begin();
+      it != mGops.end(); ++it) {
+    if ((*it)->contains(timeStamp)) {
+      mGops.splice(mGops.begin(), mGops, it);
+      VS_LOG_TRACE("seekToFrame FrameSeeker@%p[t:%" PRIi64 ";cached]", this, timeStamp);
+      return mGops.front()->frameAt(timeStamp);
+    }
+  }
+  FrameSeekerGop* gop = decodeFrom(timeStamp);
+  if (!gop)
+    return 0;
+  MediaPicture* retval = gop->frameAt(timeStamp);
+  cache(gop);
+  VS_LOG_TRACE("seekToFrame FrameSeeker@%p[t:%" PRIi64 ";decoded]", this, timeStamp);
+  return retval;
+}
+
+FrameSeekerGop*
+FrameSeeker::decodeFrom(int64_t timeStamp) {
+  // find the key frame at or before timeStamp, or failing that the first
+  // one after it.
+  bool landedBefore = true;
+  int32_t retval = mDemuxer->seek(mStreamIndex, INT64_MIN, timeStamp,
+      timeStamp, 0);
+  if (retval < 0) {
+    landedBefore = false;
+    retval = mDemuxer->seek(mStreamIndex, INT64_MIN, timeStamp, INT64_MAX, 0);
+  }
+  FfmpegException::check(retval, "could not seek to %" PRIi64 "; ", timeStamp);
+  mDecoder->flush();
+
+  FrameSeekerGop* building = 0;
+  FrameSeekerGop* found = 0;
+  // the time stamp of the next key packet once we have read it; frames at
+  // or after it belong to the next GOP.
+  int64_t boundary = Global::NO_PTS;
+  RefPointer<MediaPicture> picture;
+  try {
+    while (!found) {
+      MediaPacket* packet = 0;
+      if (mDemuxer->read(mPacket.value()) >= 0) {
+        if (!mPacket->isComplete() || mPacket->getStreamIndex() != mStreamIndex)
+          continue;
+        int64_t packetTs = mPacket->getPts() != Global::NO_PTS ?
+            mPacket->getPts() : mPacket->getDts();
+        if (mPacket->isKeyPacket()) {
+          if (!building) {
+            building = new FrameSeekerGop(packetTs);
+            building->mFirst = !landedBefore ||
+                (packetTs != Global::NO_PTS && packetTs > timeStamp);
+          } else if (boundary == Global::NO_PTS && packetTs != Global::NO_PTS &&
+              building->mStart != Global::NO_PTS && packetTs > building->mStart)
+            boundary = packetTs;
+        } else if (!building)
+          // decoding has to start on a key frame
+          continue;
+        packet = mPacket.value();
+      } else if (!building)
+        break;
+
+      // decode all of packet, or at end of file drain the decoder
+      int32_t offset = 0;
+      bool drained = false;
+      while (!found && !drained) {
+        if (!picture)
+          picture = MediaPicture::make(mDecoder->getWidth(),
+              mDecoder->getHeight(), mDecoder->getPixelFormat());
+        int32_t bytes = mDecoder->decodeVideo(picture.value(), packet, offset);
+        if (picture->isComplete()) {
+          int64_t ts = picture->getTimeStamp();
+          if (boundary != Global::NO_PTS && ts >= boundary) {
+            building->mEnd = boundary;
+            if (timeStamp < boundary) {
+              found = building;
+              building = 0;
+              break;
+            }
+            cache(building);
+            building = new FrameSeekerGop(boundary);
+            boundary = Global::NO_PTS;
+          }
+          // frames before the key frame belong to the GOP before it
+          if (building->mStart == Global::NO_PTS || ts >= building->mStart)
+            building->add(picture.value());
+          picture = 0;
+        } else if (!packet)
+          drained = true;
+        if (packet) {
+          offset += bytes > 0 ? bytes : packet->getSize();
+          drained = offset >= packet->getSize();
+        }
+      }
+      if (!packet && !found) {
+        // end of file; the last GOP runs on forever
+        found = building;
+        building = 0;
+      }
+    }
+  } catch (...) {
+    delete building;
+    delete found;
+    throw;
+  }
+  delete building;
+  if (found && found->mFrames.empty()) {
+    delete found;
+    found = 0;
+  }
+  return found;
+}
+
+void
+FrameSeeker::cache(FrameSeekerGop* gop) {
+  mGops.push_front(gop);
+  mCachedBytes += gop->mBytes;
+  evict();
+}
+
+void
+FrameSeeker::evict() {
+  while (!mGops.empty() && ((int32_t)mGops.size() > mMaxCachedGops ||
+      mCachedBytes > mMaxCachedBytes)) {
+    mCachedBytes -= mGops.back()->mBytes;
+    delete mGops.back();
+    mGops.pop_back();
+  }
+}
+
+int32_t
+FrameSeeker::getStreamIndex() {
+  return mStreamIndex;
+}
+
+Decoder*
+FrameSeeker::getDecoder() {
+  return mDecoder.get();
+}
+
+int32_t
+FrameSeeker::getMaxCachedGops() {
+  return mMaxCachedGops;
+}
+
+int32_t
+FrameSeeker::getNumCachedGops() {
+  return (int32_t)mGops.size();
+}
+
+int64_t
+FrameSeeker::getMaxCachedBytes() {
+  return mMaxCachedBytes;
+}
+
+void
+FrameSeeker::setMaxCachedBytes(int64_t maxCachedBytes) {
+  if (maxCachedBytes < 0)
+    VS_THROW(HumbleInvalidArgument("maxCachedBytes must be >= 0"));
+  mMaxCachedBytes = maxCachedBytes;
+  evict();
+}
+
+int64_t
+FrameSeeker::getCachedBytes() {
+  return mCachedBytes;
+}
+
+void
+FrameSeeker::clearCache() {
+  while (!mGops.empty()) {
+    delete mGops.back();
+    mGops.pop_back();
+  }
+  mCachedBytes = 0;
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef FRAMESEEKER_H_
+#define FRAMESEEKER_H_
+
+#include <io/humble/ferry/RefCounted.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/Demuxer.h>
+#include <io/humble/video/Decoder.h>
+#include <io/humble/video/MediaPacket.h>
+#include <io/humble/video/MediaPicture.h>
+
+#include <list>
+
+namespace io {
+namespace humble {
+namespace video {
+
+class FrameSeekerGop;
+
+/**
+ * Finds the exact video frame shown at a given time in a Demuxer stream.
+ * <p>
+ * A Demuxer can only seek to key frames, so getting any other frame means
+ * seeking to the key frame before it, flushing the Decoder and decoding
+ * forward. A FrameSeeker does that for you, and keeps the last few group
+ * of pictures (GOPs; a key frame and the frames up to the next key frame)
+ * it decoded, so stepping backwards a frame at a time, or jumping back and
+ * forth over a short range, mostly returns frames that are already decoded.
+ * </p><p>
+ * A FrameSeeker reads from and seeks its Demuxer and decodes with its
+ * stream's Decoder; do not use either yourself while using it. Every
+ * cached frame holds a whole decoded picture, so keep the cache small for
+ * large pictures or long GOPs.
+ * </p>
+ */
+class VS_API_HUMBLEVIDEO FrameSeeker : public io::humble::ferry::RefCounted
+{
+public:
+  /**
+   * Create a FrameSeeker.
+   *
+   * @param demuxer An open Demuxer. Its stream metadata must have been
+   *   queried (see Demuxer#queryStreamMetaData()).
+   * @param streamIndex The video stream to find frames in. Its Decoder is
+   *   opened if it is not already.
+   * @param maxCachedGops How many decoded GOPs to keep, least recently used
+   *   first out. 0 keeps none. The memory they take is bounded too; see
+   *   #setMaxCachedBytes(long).
+   *
+   * @throws InvalidArgument if demuxer is null, streamIndex is not a video
+   *   stream in it, or maxCachedGops < 0.
+   */
+  static FrameSeeker*
+  make(Demuxer* demuxer, int32_t streamIndex, int32_t maxCachedGops);
+
+  /**
+   * Get the frame that is shown at timeStamp: the last frame whose time
+   * stamp is <= timeStamp, or the first frame in the stream if timeStamp is
+   * before it.
+   * <p>
+   * Each call returns a new picture, but its pixel data is shared with the
+   * cache and with every other picture returned for the same frame: treat
+   * it as read-only, and copy it with MediaPicture#make(MediaPicture,
+   * boolean) before drawing on it.
+   * </p>
+   *
+   * @param timeStamp The time wanted, in the same units (the stream's time
+   *   base) as the time stamps on the stream's packets and decoded pictures.
+   *
+   * @return The frame, or null if the stream has no frames to decode.
+   * @throws RuntimeException if the Demuxer cannot seek or a read or decode
+   *   fails.
+   */
+  virtual MediaPicture*
+  seekToFrame(int64_t timeStamp);
+
+  /**
+   * @return the index of the stream this FrameSeeker decodes.
+   */
+  virtual int32_t
+  getStreamIndex();
+
+  /**
+   * @return the Decoder this FrameSeeker decodes with.
+   */
+  virtual Decoder*
+  getDecoder();
+
+  /**
+   * @return the most decoded GOPs this FrameSeeker keeps.
+   */
+  virtual int32_t
+  getMaxCachedGops();
+
+  /**
+   * @return how many decoded GOPs this FrameSeeker is keeping now.
+   */
+  virtual int32_t
+  getNumCachedGops();
+
+  /**
+   * @return the most bytes of decoded pictures this FrameSeeker keeps.
+   *   Defaults to 256 MiB.
+   */
+  virtual int64_t
+  getMaxCachedBytes();
+
+  /**
+   * Set the most bytes of decoded pictures to keep, throwing away the least
+   * recently used GOPs now if more than that is kept. GOPs are thrown away
+   * when they pass either this or #getMaxCachedGops(); a GOP larger than
+   * this on its own is not kept at all.
+   *
+   * @param maxCachedBytes The bound, in bytes of picture data.
+   *
+   * @throws InvalidArgument if maxCachedBytes < 0.
+   */
+  virtual void
+  setMaxCachedBytes(int64_t maxCachedBytes);
+
+  /**
+   * @return the bytes of decoded pictures this FrameSeeker is keeping now.
+   */
+  virtual int64_t
+  getCachedBytes();
+
+  /**
+   * Throw away all decoded GOPs.
+   */
+  virtual void
+  clearCache();
+
+private:
+  FrameSeeker(Demuxer* demuxer, int32_t streamIndex, Decoder* decoder,
+      int32_t maxCachedGops);
+  virtual
+  ~FrameSeeker();
+
+  FrameSeekerGop* decodeFrom(int64_t timeStamp);
+  void cache(FrameSeekerGop* gop);
+  void evict();
+
+  io::humble::ferry::RefPointer<Demuxer> mDemuxer;
+  io::humble::ferry::RefPointer<Decoder> mDecoder;
+  io::humble::ferry::RefPointer<MediaPacket> mPacket;
+  int32_t mStreamIndex;
+  int32_t mMaxCachedGops;
+  int64_t mMaxCachedBytes;
+  int64_t mCachedBytes;
+  // most recently used first
+  std::list<FrameSeekerGop*> mGops;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* FRAMESEEKER_H_ */
@@ -28,6 +28,13 @@
 #include <io/humble/video/Global.h>
 #include <io/humble/video/FfmpegIncludes.h>
 #include <io/humble/video/VideoExceptions.h>
+#include <io/humble/video/CachingProtocol.h>
+#include <io/humble/video/MemoryProtocol.h>
+#include <io/humble/video/customio/AsyncURLProtocolManager.h>
+#include <io/humble/video/customio/CachingURLProtocolManager.h>
+#include <io/humble/video/customio/FdURLProtocolManager.h>
+#include <io/humble/video/customio/MemoryURLProtocolManager.h>
+#include <io/humble/video/customio/MmapURLProtocolManager.h>
 
 /**
  * WARNING: Do not use logging in this class, and do
@@ -153,6 +160,20 @@ namespace io { namespace humble { namespace video
       avformat_network_init();
       // and set up filter support
       avfilter_register_all();
+      // and let "mem:" URLs read and write memory
+      customio::MemoryURLProtocolManager::registerProtocol(
+          MemoryProtocol::getProtocolName());
+      // and "mmap:" URLs read local files through memory mappings
+      customio::MmapURLProtocolManager::registerProtocol("mmap");
+      // and "humbleasync:" URLs read local files ahead with several reads
+      // in flight; "async:" is left to FFmpeg, which wraps any URL with it
+      customio::AsyncURLProtocolManager::registerProtocol("humbleasync");
+      // and "humblecache:" URLs read other URLs through a shared block cache
+      customio::CachingURLProtocolManager::registerProtocol(
+          CachingProtocol::getProtocolName());
+      // and "fd:" URLs read and write descriptors the caller already opened;
+      // we cannot know who reads the pipes, so no vmsplice(2)
+      customio::FdURLProtocolManager::registerProtocol("fd", false);
 
       // turn down logging
       sGlobal = new Global();
@@ -214,6 +214,8 @@ static void SWIGUNUSED SWIG_JavaThrowException(JNIEnv *jenv, SWIG_JavaExceptionC
 
 // HumbleVideo.i: Start generated code
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+#include <vector>
+#include <stdexcept>
 #include <io/humble/ferry/JNIHelper.h>
 #include <io/humble/video/KeyValueBag.h>
 #include <io/humble/video/Property.h>
@@ -256,6 +258,14 @@ static void SWIGUNUSED SWIG_JavaThrowException(JNIEnv *jenv, SWIG_JavaExceptionC
 #include <io/humble/video/FilterAudioSink.h>
 #include <io/humble/video/FilterPictureSink.h>
 #include <io/humble/video/BitStreamFilter.h>
+#include <io/humble/video/FrameSeeker.h>
+#include <io/humble/video/MemoryProtocol.h>
+#include <io/humble/video/CachingProtocol.h>
+#include <io/humble/video/MediaRing.h>
+#include <io/humble/video/MediaPicturePool.h>
+#include <io/humble/video/MediaAudioPool.h>
+#include <io/humble/video/SpriteSheetGenerator.h>
+#include <io/humble/video/MediaAudioMixer.h>
 
 using namespace VS_CPP_NAMESPACE;
 
@@ -277,6 +287,95 @@ Java_io_humble_video_Video_init(JNIEnv *env, jclass)
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<
 // HumbleVideo.i: End generated code
 
+SWIGINTERN int32_t io_humble_video_MediaPictureResampler_resampleToBytes(io::humble::video::MediaPictureResampler *self,jbyteArray out,io::humble::video::MediaPicture *in){
+    JNIEnv* env = io::humble::ferry::JNIHelper::sGetEnv();
+    if (!env)
+      throw std::runtime_error("could not get java environment");
+    if (env->ExceptionCheck())
+      throw std::runtime_error("pending Java exception");
+    if (!out)
+      throw std::invalid_argument("no byte array passed in");
+
+    self->checkResampleToBytes(env->GetArrayLength(out), in);
+    void* bytes = env->GetPrimitiveArrayCritical(out, 0);
+    if (!bytes)
+      throw std::runtime_error("could not get java byte array");
+    int32_t retval = self->resampleToBytes(static_cast<uint8_t*>(bytes), in);
+    env->ReleasePrimitiveArrayCritical(out, bytes, 0);
+    io::humble::video::FfmpegException::check(retval, "Error while resampling. ");
+    return retval;
+  }
+SWIGINTERN int32_t io_humble_video_MediaPictureResampler_resampleFromBytes(io::humble::video::MediaPictureResampler *self,io::humble::video::MediaPicture *out,jbyteArray in){
+    JNIEnv* env = io::humble::ferry::JNIHelper::sGetEnv();
+    if (!env)
+      throw std::runtime_error("could not get java environment");
+    if (env->ExceptionCheck())
+      throw std::runtime_error("pending Java exception");
+    if (!in)
+      throw std::invalid_argument("no byte array passed in");
+
+    self->checkResampleFromBytes(out, env->GetArrayLength(in));
+    void* bytes = env->GetPrimitiveArrayCritical(in, 0);
+    if (!bytes)
+      throw std::runtime_error("could not get java byte array");
+    int32_t retval = self->resampleFromBytes(out,
+        static_cast<const uint8_t*>(bytes));
+    env->ReleasePrimitiveArrayCritical(in, bytes, JNI_ABORT);
+    io::humble::video::FfmpegException::check(retval, "Error while resampling. ");
+    return retval;
+  }
+SWIGINTERN int32_t io_humble_video_MediaAudioResampler_java_resampleBatch(io::humble::video::MediaAudioResampler *self,jlongArray outs,jlongArray ins){
+    JNIEnv* env = io::humble::ferry::JNIHelper::sGetEnv();
+    if (!env)
+      throw std::runtime_error("could not get java environment");
+    if (env->ExceptionCheck())
+      throw std::runtime_error("pending Java exception");
+    if (!outs || !ins)
+      throw std::invalid_argument("no audio passed in");
+
+    jsize numOuts = env->GetArrayLength(outs);
+    jlong* ptrs = env->GetLongArrayElements(outs, 0);
+    if (!ptrs)
+      throw std::runtime_error("could not get java audio array");
+    std::vector<io::humble::video::MediaAudio*> outAudio(numOuts);
+    for(jsize i = 0; i < numOuts; i++)
+      outAudio[i] = *(io::humble::video::MediaAudio**)&ptrs[i];
+    env->ReleaseLongArrayElements(outs, ptrs, JNI_ABORT);
+
+    jsize numIns = env->GetArrayLength(ins);
+    ptrs = env->GetLongArrayElements(ins, 0);
+    if (!ptrs)
+      throw std::runtime_error("could not get java audio array");
+    std::vector<io::humble::video::MediaAudio*> inAudio(numIns);
+    for(jsize i = 0; i < numIns; i++)
+      inAudio[i] = *(io::humble::video::MediaAudio**)&ptrs[i];
+    env->ReleaseLongArrayElements(ins, ptrs, JNI_ABORT);
+
+    return self->resampleBatch(numOuts ? &outAudio[0] : 0, numOuts,
+        numIns ? &inAudio[0] : 0, numIns);
+  }
+SWIGINTERN int32_t io_humble_video_Demuxer_java_readBatch(io::humble::video::Demuxer *self,jlongArray packets,int32_t maxBytes,int64_t maxDuration){
+    JNIEnv* env = io::humble::ferry::JNIHelper::sGetEnv();
+    if (!env)
+      throw std::runtime_error("could not get java environment");
+    if (env->ExceptionCheck())
+      throw std::runtime_error("pending Java exception");
+    if (!packets)
+      throw std::invalid_argument("no packets passed in");
+
+    jsize numPackets = env->GetArrayLength(packets);
+    jlong* ptrs = env->GetLongArrayElements(packets, 0);
+    if (!ptrs)
+      throw std::runtime_error("could not get java packet array");
+    std::vector<io::humble::video::MediaPacket*> pkts(numPackets);
+    for(jsize i = 0; i < numPackets; i++)
+      pkts[i] = *(io::humble::video::MediaPacket**)&ptrs[i];
+    env->ReleaseLongArrayElements(packets, ptrs, JNI_ABORT);
+
+    return self->readBatch(numPackets ? &pkts[0] : 0, numPackets,
+        maxBytes, maxDuration);
+  }
+
 
 
 #ifdef __cplusplus
@@ -9462,23 +9561,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1make_1_1SWI
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getData(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1make_1_1SWIG_13(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2, jint jarg3, jint jarg4) {
   jlong jresult = 0 ;
-  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  int32_t arg1 ;
   int32_t arg2 ;
-  io::humble::ferry::Buffer *result = 0 ;
+  io::humble::video::PixelFormat::Type arg3 ;
+  int32_t arg4 ;
+  io::humble::video::MediaPicture *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  arg1 = (int32_t)jarg1; 
   arg2 = (int32_t)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
+  arg3 = (io::humble::video::PixelFormat::Type)jarg3; 
+  arg4 = (int32_t)jarg4; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -9486,7 +9582,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getData(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::ferry::Buffer *)(arg1)->getData(arg2);
+      result = (io::humble::video::MediaPicture *)io::humble::video::MediaPicture::make(arg1,arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
@@ -9505,74 +9601,28 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getData(JNI
     
     /*@SWIG@*/
   }
-  *(io::humble::ferry::Buffer **)&jresult = result; 
+  *(io::humble::video::MediaPicture **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getDataPlaneSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1makeView(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3, jint jarg4, jint jarg5) {
+  jlong jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   int32_t arg2 ;
-  int32_t result;
+  int32_t arg3 ;
+  int32_t arg4 ;
+  int32_t arg5 ;
+  io::humble::video::MediaPicture *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
   arg2 = (int32_t)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
-  
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      result = (int32_t)(arg1)->getDataPlaneSize(arg2);
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return 0;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
-  }
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getNumDataPlanes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  int32_t result;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int32_t)jarg4; 
+  arg5 = (int32_t)jarg5; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -9580,7 +9630,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getNumDataPl
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumDataPlanes();
+      result = (io::humble::video::MediaPicture *)io::humble::video::MediaPicture::makeView(arg1,arg2,arg3,arg4,arg5);
     }
     catch(std::exception & e)
     {
@@ -9599,16 +9649,16 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getNumDataPl
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::MediaPicture **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getLineSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getData(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   int32_t arg2 ;
-  int32_t result;
+  io::humble::ferry::Buffer *result = 0 ;
   
   (void)jenv;
   (void)jcls;
@@ -9628,97 +9678,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getLineSize(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getLineSize(arg2);
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return 0;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
-  }
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setComplete(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
-  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  bool arg2 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
-  arg2 = jarg2 ? true : false; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
-  
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      (arg1)->setComplete(arg2);
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return ;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
-  }
-}
-
-
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isComplete(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jboolean jresult = 0 ;
-  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  bool result;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
-  
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      result = (bool)(arg1)->isComplete();
+      result = (io::humble::ferry::Buffer *)(arg1)->getData(arg2);
     }
     catch(std::exception & e)
     {
@@ -9737,20 +9697,22 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isComple
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  *(io::humble::ferry::Buffer **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getDataPlaneSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  int32_t arg2 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -9764,7 +9726,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getWidth(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getWidth();
+      result = (int32_t)(arg1)->getDataPlaneSize(arg2);
     }
     catch(std::exception & e)
     {
@@ -9788,7 +9750,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getWidth(JNI
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getNumDataPlanes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   int32_t result;
@@ -9810,53 +9772,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getHeight(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getHeight();
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return 0;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
-  }
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  io::humble::video::PixelFormat::Type result;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
-  
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      result = (io::humble::video::PixelFormat::Type)(arg1)->getFormat();
+      result = (int32_t)(arg1)->getNumDataPlanes();
     }
     catch(std::exception & e)
     {
@@ -9880,15 +9796,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getFormat(JN
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getCodedPictureNumber(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getLineSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  int32_t arg2 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -9902,7 +9820,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getCodedPict
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getCodedPictureNumber();
+      result = (int32_t)(arg1)->getLineSize(arg2);
     }
     catch(std::exception & e)
     {
@@ -9926,15 +9844,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getCodedPict
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setCodedPictureNumber(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setComplete(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  int32_t arg2 ;
+  bool arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg2 = jarg2 ? true : false; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -9948,7 +9866,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setCodedPict
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setCodedPictureNumber(arg2);
+      (arg1)->setComplete(arg2);
     }
     catch(std::exception & e)
     {
@@ -9970,7 +9888,53 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setCodedPict
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getDisplayPictureNumber(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isComplete(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (bool)(arg1)->isComplete();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   int32_t result;
@@ -9992,7 +9956,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getDisplayPi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getDisplayPictureNumber();
+      result = (int32_t)(arg1)->getWidth();
     }
     catch(std::exception & e)
     {
@@ -10016,20 +9980,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getDisplayPi
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setDisplayPictureNumber(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  int32_t arg2 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -10038,18 +10002,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setDisplayPi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setDisplayPictureNumber(arg2);
+      result = (int32_t)(arg1)->getHeight();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -10057,10 +10021,58 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setDisplayPi
     
     /*@SWIG@*/
   }
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getQuality(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  io::humble::video::PixelFormat::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::PixelFormat::Type)(arg1)->getFormat();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getCodedPictureNumber(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   int32_t result;
@@ -10082,7 +10094,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getQuality(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getQuality();
+      result = (int32_t)(arg1)->getCodedPictureNumber();
     }
     catch(std::exception & e)
     {
@@ -10106,7 +10118,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getQuality(J
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setQuality(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setCodedPictureNumber(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   int32_t arg2 ;
   
@@ -10128,7 +10140,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setQuality(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setQuality(arg2);
+      (arg1)->setCodedPictureNumber(arg2);
     }
     catch(std::exception & e)
     {
@@ -10150,17 +10162,15 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setQuality(J
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getError(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jlong jresult = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getDisplayPictureNumber(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  int32_t arg2 ;
-  int64_t result;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -10174,7 +10184,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getError(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getError(arg2);
+      result = (int32_t)(arg1)->getDisplayPictureNumber();
     }
     catch(std::exception & e)
     {
@@ -10193,12 +10203,56 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getError(JN
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getRepeatPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setDisplayPictureNumber(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setDisplayPictureNumber(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getQuality(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   int32_t result;
@@ -10220,7 +10274,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getRepeatPic
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getRepeatPicture();
+      result = (int32_t)(arg1)->getQuality();
     }
     catch(std::exception & e)
     {
@@ -10244,7 +10298,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getRepeatPic
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setRepeatPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setQuality(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   int32_t arg2 ;
   
@@ -10266,7 +10320,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setRepeatPic
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setRepeatPicture(arg2);
+      (arg1)->setQuality(arg2);
     }
     catch(std::exception & e)
     {
@@ -10288,15 +10342,17 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setRepeatPic
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isInterlacedFrame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jboolean jresult = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getError(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  bool result;
+  int32_t arg2 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -10310,7 +10366,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isInterl
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->isInterlacedFrame();
+      result = (int64_t)(arg1)->getError(arg2);
     }
     catch(std::exception & e)
     {
@@ -10329,20 +10385,66 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isInterl
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setInterlacedFrame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1getRepeatPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
-  bool arg2 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
-  arg2 = jarg2 ? true : false; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getRepeatPicture();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setRepeatPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -10356,7 +10458,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setInterlace
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setInterlacedFrame(arg2);
+      (arg1)->setRepeatPicture(arg2);
     }
     catch(std::exception & e)
     {
@@ -10378,7 +10480,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setInterlace
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isTopFieldFirst(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isInterlacedFrame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jboolean jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   bool result;
@@ -10400,7 +10502,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isTopFie
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->isTopFieldFirst();
+      result = (bool)(arg1)->isInterlacedFrame();
     }
     catch(std::exception & e)
     {
@@ -10424,7 +10526,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isTopFie
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setTopFieldFirst(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setInterlacedFrame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   bool arg2 ;
   
@@ -10446,7 +10548,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setTopFieldF
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setTopFieldFirst(arg2);
+      (arg1)->setInterlacedFrame(arg2);
     }
     catch(std::exception & e)
     {
@@ -10468,7 +10570,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setTopFieldF
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isPaletteChanged(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isTopFieldFirst(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jboolean jresult = 0 ;
   io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
   bool result;
@@ -10490,7 +10592,97 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isPalett
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->isPaletteChanged();
+      result = (bool)(arg1)->isTopFieldFirst();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1setTopFieldFirst(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setTopFieldFirst(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPicture_1isPaletteChanged(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (bool)(arg1)->isPaletteChanged();
     }
     catch(std::exception & e)
     {
@@ -14681,13 +14873,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1get
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1setThreads(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -14701,7 +14895,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1ope
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->open();
+      (arg1)->setThreads(arg2);
     }
     catch(std::exception & e)
     {
@@ -14723,21 +14917,15 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1ope
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1resample(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1getThreads(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
-  io::humble::video::MediaSampled *arg2 = (io::humble::video::MediaSampled *) 0 ;
-  io::humble::video::MediaSampled *arg3 = (io::humble::video::MediaSampled *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
   arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
-  arg2 = *(io::humble::video::MediaSampled **)&jarg2; 
-  arg3 = *(io::humble::video::MediaSampled **)&jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -14751,7 +14939,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1res
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->resample(arg2,arg3);
+      result = (int32_t)(arg1)->getThreads();
     }
     catch(std::exception & e)
     {
@@ -14775,21 +14963,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1res
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1resamplePicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1getNumBands(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
-  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
-  io::humble::video::MediaPicture *arg3 = (io::humble::video::MediaPicture *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
   arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
-  arg3 = *(io::humble::video::MediaPicture **)&jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -14803,7 +14985,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1res
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->resamplePicture(arg2,arg3);
+      result = (int32_t)(arg1)->getNumBands();
     }
     catch(std::exception & e)
     {
@@ -14827,44 +15009,40 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1res
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1make(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2, jint jarg3, jint jarg4, jint jarg5, jint jarg6, jint jarg7) {
-  jlong jresult = 0 ;
-  int32_t arg1 ;
-  int32_t arg2 ;
-  io::humble::video::PixelFormat::Type arg3 ;
-  int32_t arg4 ;
-  int32_t arg5 ;
-  io::humble::video::PixelFormat::Type arg6 ;
-  int32_t arg7 ;
-  io::humble::video::MediaPictureResampler *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1setFastPaths(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  bool arg2 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (int32_t)jarg1; 
-  arg2 = (int32_t)jarg2; 
-  arg3 = (io::humble::video::PixelFormat::Type)jarg3; 
-  arg4 = (int32_t)jarg4; 
-  arg5 = (int32_t)jarg5; 
-  arg6 = (io::humble::video::PixelFormat::Type)jarg6; 
-  arg7 = (int32_t)jarg7; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaPictureResampler *)io::humble::video::MediaPictureResampler::make(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+      (arg1)->setFastPaths(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -14872,36 +15050,32 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1ma
     
     /*@SWIG@*/
   }
-  *(io::humble::video::MediaPictureResampler **)&jresult = result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1make(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2, jint jarg3, jint jarg4, jint jarg5, jint jarg6) {
-  jlong jresult = 0 ;
-  io::humble::video::AudioChannel::Layout arg1 ;
-  int32_t arg2 ;
-  io::humble::video::AudioFormat::Type arg3 ;
-  io::humble::video::AudioChannel::Layout arg4 ;
-  int32_t arg5 ;
-  io::humble::video::AudioFormat::Type arg6 ;
-  io::humble::video::MediaAudioResampler *result = 0 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1getFastPaths(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (io::humble::video::AudioChannel::Layout)jarg1; 
-  arg2 = (int32_t)jarg2; 
-  arg3 = (io::humble::video::AudioFormat::Type)jarg3; 
-  arg4 = (io::humble::video::AudioChannel::Layout)jarg4; 
-  arg5 = (int32_t)jarg5; 
-  arg6 = (io::humble::video::AudioFormat::Type)jarg6; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaAudioResampler *)io::humble::video::MediaAudioResampler::make(arg1,arg2,arg3,arg4,arg5,arg6);
+      result = (bool)(arg1)->getFastPaths();
     }
     catch(std::exception & e)
     {
@@ -14920,20 +15094,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1make
     
     /*@SWIG@*/
   }
-  *(io::humble::video::MediaAudioResampler **)&jresult = result; 
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOutputLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::AudioChannel::Layout result;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1usesFastPath(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -14947,7 +15121,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOu
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioChannel::Layout)(arg1)->getOutputLayout();
+      result = (bool)(arg1)->usesFastPath();
     }
     catch(std::exception & e)
     {
@@ -14966,20 +15140,68 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOu
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getInputLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->open();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1resample(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
   jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::AudioChannel::Layout result;
+  io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  io::humble::video::MediaSampled *arg2 = (io::humble::video::MediaSampled *) 0 ;
+  io::humble::video::MediaSampled *arg3 = (io::humble::video::MediaSampled *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
+  arg2 = *(io::humble::video::MediaSampled **)&jarg2; 
+  arg3 = *(io::humble::video::MediaSampled **)&jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -14993,7 +15215,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getIn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioChannel::Layout)(arg1)->getInputLayout();
+      result = (int32_t)(arg1)->resample(arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -15017,15 +15239,21 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getIn
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOutputSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1resamplePicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
   jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
+  io::humble::video::MediaPicture *arg3 = (io::humble::video::MediaPicture *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
+  arg3 = *(io::humble::video::MediaPicture **)&jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15039,7 +15267,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOu
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getOutputSampleRate();
+      result = (int32_t)(arg1)->resamplePicture(arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -15063,29 +15291,33 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOu
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getInputSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1make(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2, jint jarg3, jint jarg4, jint jarg5, jint jarg6, jint jarg7) {
+  jlong jresult = 0 ;
+  int32_t arg1 ;
+  int32_t arg2 ;
+  io::humble::video::PixelFormat::Type arg3 ;
+  int32_t arg4 ;
+  int32_t arg5 ;
+  io::humble::video::PixelFormat::Type arg6 ;
+  int32_t arg7 ;
+  io::humble::video::MediaPictureResampler *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
-  
+  arg1 = (int32_t)jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (io::humble::video::PixelFormat::Type)jarg3; 
+  arg4 = (int32_t)jarg4; 
+  arg5 = (int32_t)jarg5; 
+  arg6 = (io::humble::video::PixelFormat::Type)jarg6; 
+  arg7 = (int32_t)jarg7; 
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getInputSampleRate();
+      result = (io::humble::video::MediaPictureResampler *)io::humble::video::MediaPictureResampler::make(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
     }
     catch(std::exception & e)
     {
@@ -15104,26 +15336,52 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getIn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::MediaPictureResampler **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOutputFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::AudioFormat::Type result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1setCacheSize(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  int32_t arg1 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg1 = (int32_t)jarg1; 
   
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      io::humble::video::MediaPictureResampler::setCacheSize(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
   }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1getCacheSize(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -15131,7 +15389,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOu
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioFormat::Type)(arg1)->getOutputFormat();
+      result = (int32_t)io::humble::video::MediaPictureResampler::getCacheSize();
     }
     catch(std::exception & e)
     {
@@ -15155,21 +15413,12 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOu
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getInputFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::AudioFormat::Type result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1getCacheHits(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -15177,7 +15426,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getIn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioFormat::Type)(arg1)->getInputFormat();
+      result = (int64_t)io::humble::video::MediaPictureResampler::getCacheHits();
     }
     catch(std::exception & e)
     {
@@ -15196,26 +15445,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getIn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getInputChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1getCacheMisses(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -15223,7 +15463,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getIn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getInputChannels();
+      result = (int64_t)io::humble::video::MediaPictureResampler::getCacheMisses();
     }
     catch(std::exception & e)
     {
@@ -15242,26 +15482,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getIn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOutputChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1getCacheEvictions(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -15269,7 +15500,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOu
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getOutputChannels();
+      result = (int64_t)io::humble::video::MediaPictureResampler::getCacheEvictions();
     }
     catch(std::exception & e)
     {
@@ -15288,24 +15519,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOu
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1resetCacheStatistics(JNIEnv *jenv, jclass jcls) {
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -15313,7 +15535,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1open(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->open();
+      io::humble::video::MediaPictureResampler::resetCacheStatistics();
     }
     catch(std::exception & e)
     {
@@ -15335,21 +15557,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1open(
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1resample(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1resampleToBytes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jbyteArray jarg2, jlong jarg3, jobject jarg3_) {
   jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::MediaSampled *arg2 = (io::humble::video::MediaSampled *) 0 ;
-  io::humble::video::MediaSampled *arg3 = (io::humble::video::MediaSampled *) 0 ;
+  io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  jbyteArray arg2 ;
+  io::humble::video::MediaPicture *arg3 = (io::humble::video::MediaPicture *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
   (void)jarg3_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = *(io::humble::video::MediaSampled **)&jarg2; 
-  arg3 = *(io::humble::video::MediaSampled **)&jarg3; 
+  arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
+  arg2 = jarg2; 
+  arg3 = *(io::humble::video::MediaPicture **)&jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15363,7 +15584,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1resam
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->resample(arg2,arg3);
+      result = (int32_t)io_humble_video_MediaPictureResampler_resampleToBytes(arg1,arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -15387,21 +15608,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1resam
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1resampleAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPictureResampler_1resampleFromBytes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jbyteArray jarg3) {
   jint jresult = 0 ;
-  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
-  io::humble::video::MediaAudio *arg3 = (io::humble::video::MediaAudio *) 0 ;
+  io::humble::video::MediaPictureResampler *arg1 = (io::humble::video::MediaPictureResampler *) 0 ;
+  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
+  jbyteArray arg3 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
-  arg3 = *(io::humble::video::MediaAudio **)&jarg3; 
+  arg1 = *(io::humble::video::MediaPictureResampler **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
+  arg3 = jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15415,7 +15635,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1resam
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->resampleAudio(arg2,arg3);
+      result = (int32_t)io_humble_video_MediaPictureResampler_resampleFromBytes(arg1,arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -15439,17 +15659,63 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1resam
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getNextPts(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1make(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2, jint jarg3, jint jarg4, jint jarg5, jint jarg6) {
   jlong jresult = 0 ;
+  io::humble::video::AudioChannel::Layout arg1 ;
+  int32_t arg2 ;
+  io::humble::video::AudioFormat::Type arg3 ;
+  io::humble::video::AudioChannel::Layout arg4 ;
+  int32_t arg5 ;
+  io::humble::video::AudioFormat::Type arg6 ;
+  io::humble::video::MediaAudioResampler *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (io::humble::video::AudioChannel::Layout)jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (io::humble::video::AudioFormat::Type)jarg3; 
+  arg4 = (io::humble::video::AudioChannel::Layout)jarg4; 
+  arg5 = (int32_t)jarg5; 
+  arg6 = (io::humble::video::AudioFormat::Type)jarg6; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::MediaAudioResampler *)io::humble::video::MediaAudioResampler::make(arg1,arg2,arg3,arg4,arg5,arg6);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::MediaAudioResampler **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOutputLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int64_t arg2 ;
-  int64_t result;
+  io::humble::video::AudioChannel::Layout result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = (int64_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15463,7 +15729,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getNextPts(arg2);
+      result = (io::humble::video::AudioChannel::Layout)(arg1)->getOutputLayout();
     }
     catch(std::exception & e)
     {
@@ -15482,27 +15748,25 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getN
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setCompensation(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getInputLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int32_t arg2 ;
-  int32_t arg3 ;
+  io::humble::video::AudioChannel::Layout result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  arg3 = (int32_t)jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -15511,18 +15775,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setCo
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setCompensation(arg2,arg3);
+      result = (io::humble::video::AudioChannel::Layout)(arg1)->getInputLayout();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -15530,20 +15794,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setCo
     
     /*@SWIG@*/
   }
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1dropOutput(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOutputSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int32_t arg2 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15557,7 +15821,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1dropO
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->dropOutput(arg2);
+      result = (int32_t)(arg1)->getOutputSampleRate();
     }
     catch(std::exception & e)
     {
@@ -15581,17 +15845,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1dropO
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1injectSilence(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getInputSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int32_t arg2 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15605,7 +15867,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1injec
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->injectSilence(arg2);
+      result = (int32_t)(arg1)->getInputSampleRate();
     }
     catch(std::exception & e)
     {
@@ -15629,17 +15891,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1injec
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getDelay(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  jlong jresult = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOutputFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int64_t arg2 ;
-  int64_t result;
+  io::humble::video::AudioFormat::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = (int64_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15653,7 +15913,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getD
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getDelay(arg2);
+      result = (io::humble::video::AudioFormat::Type)(arg1)->getOutputFormat();
     }
     catch(std::exception & e)
     {
@@ -15672,22 +15932,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getD
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getNumResampledSamples(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getInputFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  int32_t arg2 ;
-  int32_t result;
+  io::humble::video::AudioFormat::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15701,7 +15959,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getNu
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumResampledSamples(arg2);
+      result = (io::humble::video::AudioFormat::Type)(arg1)->getInputFormat();
     }
     catch(std::exception & e)
     {
@@ -15725,10 +15983,10 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getNu
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getInputChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::Rational *result = 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
@@ -15747,7 +16005,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getT
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Rational *)(arg1)->getTimeBase();
+      result = (int32_t)(arg1)->getInputChannels();
     }
     catch(std::exception & e)
     {
@@ -15766,21 +16024,66 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getT
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Rational **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getOutputChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::Rational *arg2 = (io::humble::video::Rational *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
   arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
-  arg2 = *(io::humble::video::Rational **)&jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getOutputChannels();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setFastPaths(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -15794,7 +16097,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setTi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setTimeBase(arg2);
+      (arg1)->setFastPaths(arg2);
     }
     catch(std::exception & e)
     {
@@ -15816,10 +16119,10 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setTi
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getFastPaths(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
   io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
-  io::humble::video::MediaResampler::State result;
+  bool result;
   
   (void)jenv;
   (void)jcls;
@@ -15838,7 +16141,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getSt
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaResampler::State)(arg1)->getState();
+      result = (bool)(arg1)->getFastPaths();
     }
     catch(std::exception & e)
     {
@@ -15857,132 +16160,797 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getSt
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1UNKNOWN_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1usesFastPath(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_UNKNOWN;
-  jresult = (jint)result; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (bool)(arg1)->usesFastPath();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1VIDEO_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_VIDEO;
-  jresult = (jint)result; 
-  return jresult;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->open();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1AUDIO_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1resample(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
   jint jresult = 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  io::humble::video::MediaSampled *arg2 = (io::humble::video::MediaSampled *) 0 ;
+  io::humble::video::MediaSampled *arg3 = (io::humble::video::MediaSampled *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_AUDIO;
+  (void)jarg1_;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = *(io::humble::video::MediaSampled **)&jarg2; 
+  arg3 = *(io::humble::video::MediaSampled **)&jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->resample(arg2,arg3);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1DATA_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1resampleAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
   jint jresult = 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
+  io::humble::video::MediaAudio *arg3 = (io::humble::video::MediaAudio *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_DATA;
+  (void)jarg1_;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
+  arg3 = *(io::humble::video::MediaAudio **)&jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->resampleAudio(arg2,arg3);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1SUBTITLE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getNextPts(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  int64_t arg2 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_SUBTITLE;
-  jresult = (jint)result; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getNextPts(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1ATTACHMENT_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setCompensation(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  int32_t arg2 ;
+  int32_t arg3 ;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_ATTACHMENT;
-  jresult = (jint)result; 
-  return jresult;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setCompensation(arg2,arg3);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1UNKNOWN_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1dropOutput(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
-  io::humble::video::CodecProfile::ProfileType result;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  int32_t arg2 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::CodecProfile::ProfileType)io::humble::video::CodecProfile::PROFILE_UNKNOWN;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->dropOutput(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1RESERVED_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1injectSilence(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
-  io::humble::video::CodecProfile::ProfileType result;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  int32_t arg2 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::CodecProfile::ProfileType)io::humble::video::CodecProfile::PROFILE_RESERVED;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->injectSilence(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1AAC_1MAIN_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::CodecProfile::ProfileType result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getDelay(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  int64_t arg2 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::CodecProfile::ProfileType)io::humble::video::CodecProfile::PROFILE_AAC_MAIN;
-  jresult = (jint)result; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getDelay(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1AAC_1LOW_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getNumResampledSamples(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
-  io::humble::video::CodecProfile::ProfileType result;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  int32_t arg2 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::CodecProfile::ProfileType)io::humble::video::CodecProfile::PROFILE_AAC_LOW;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumResampledSamples(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1AAC_1SSR_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  io::humble::video::Rational *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Rational *)(arg1)->getTimeBase();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Rational **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1setTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  io::humble::video::Rational *arg2 = (io::humble::video::Rational *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = *(io::humble::video::Rational **)&jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setTimeBase(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  io::humble::video::MediaResampler::State result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::MediaResampler::State)(arg1)->getState();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioResampler_1java_resampleBatch(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlongArray jarg2, jlongArray jarg3) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioResampler *arg1 = (io::humble::video::MediaAudioResampler *) 0 ;
+  jlongArray arg2 ;
+  jlongArray arg3 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioResampler **)&jarg1; 
+  arg2 = jarg2; 
+  arg3 = jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)io_humble_video_MediaAudioResampler_java_resampleBatch(arg1,arg2,arg3);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1UNKNOWN_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_UNKNOWN;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1VIDEO_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_VIDEO;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1AUDIO_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_AUDIO;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1DATA_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_DATA;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1SUBTITLE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_SUBTITLE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaDescriptor_1MEDIA_1ATTACHMENT_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::MediaDescriptor::Type)io::humble::video::MediaDescriptor::MEDIA_ATTACHMENT;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1UNKNOWN_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::CodecProfile::ProfileType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::CodecProfile::ProfileType)io::humble::video::CodecProfile::PROFILE_UNKNOWN;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1RESERVED_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::CodecProfile::ProfileType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::CodecProfile::ProfileType)io::humble::video::CodecProfile::PROFILE_RESERVED;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1AAC_1MAIN_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::CodecProfile::ProfileType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::CodecProfile::ProfileType)io::humble::video::CodecProfile::PROFILE_AAC_MAIN;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1AAC_1LOW_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::CodecProfile::ProfileType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::CodecProfile::ProfileType)io::humble::video::CodecProfile::PROFILE_AAC_LOW;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecProfile_1PROFILE_1AAC_1SSR_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
   io::humble::video::CodecProfile::ProfileType result;
   
@@ -22050,89 +23018,5514 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1FRAME_1THREADS
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1SLICE_1THREADS_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1SLICE_1THREADS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Codec::CodecCapability result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_SLICE_THREADS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1PARAM_1CHANGE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Codec::CodecCapability result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_PARAM_CHANGE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1AUTO_1THREADS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Codec::CodecCapability result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_AUTO_THREADS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1VARIABLE_1FRAME_1SIZE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Codec::CodecCapability result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_VARIABLE_FRAME_SIZE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1INTRA_1ONLY_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Codec::CodecCapability result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_INTRA_ONLY;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1LOSSLESS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Codec::CodecCapability result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_LOSSLESS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1hasCapability(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jboolean jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  io::humble::video::Codec::CodecCapability arg2 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg2 = (io::humble::video::Codec::CodecCapability)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (bool)(arg1)->hasCapability(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getCapabilities(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getCapabilities();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Codec_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getIDAsInt(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int)(arg1)->getIDAsInt();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getID(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getID();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getType();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1canDecode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (bool)(arg1)->canDecode();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1canEncode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (bool)(arg1)->canEncode();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodec(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  jlong jresult = 0 ;
+  io::humble::video::Codec::ID arg1 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (io::humble::video::Codec::ID)jarg1; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)io::humble::video::Codec::findEncodingCodec(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodecByIntID(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  jlong jresult = 0 ;
+  int arg1 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (int)jarg1; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)io::humble::video::Codec::findEncodingCodecByIntID(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodecByName(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
+  }
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)io::humble::video::Codec::findEncodingCodecByName((char const *)arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodec(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  jlong jresult = 0 ;
+  io::humble::video::Codec::ID arg1 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (io::humble::video::Codec::ID)jarg1; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)io::humble::video::Codec::findDecodingCodec(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodecByIntID(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  jlong jresult = 0 ;
+  int arg1 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (int)jarg1; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)io::humble::video::Codec::findDecodingCodecByIntID(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodecByName(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
+  }
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)io::humble::video::Codec::findDecodingCodecByName((char const *)arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1guessEncodingCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jstring jarg4, jint jarg5) {
+  jlong jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  io::humble::video::MediaDescriptor::Type arg5 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return 0;
+  }
+  arg4 = 0;
+  if (jarg4) {
+    arg4 = (char *)jenv->GetStringUTFChars(jarg4, 0);
+    if (!arg4) return 0;
+  }
+  arg5 = (io::humble::video::MediaDescriptor::Type)jarg5; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)io::humble::video::Codec::guessEncodingCodec(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,arg5);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  if (arg4) jenv->ReleaseStringUTFChars(jarg4, (const char *)arg4);
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Codec_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getLongName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumInstalledCodecs(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)io::humble::video::Codec::getNumInstalledCodecs();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getInstalledCodec(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  jlong jresult = 0 ;
+  int32_t arg1 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (int32_t)jarg1; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)io::humble::video::Codec::getInstalledCodec(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedVideoFrameRates(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedVideoFrameRates();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedVideoFrameRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::Rational *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Rational *)(arg1)->getSupportedVideoFrameRate(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Rational **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedVideoPixelFormats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedVideoPixelFormats();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedVideoPixelFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::PixelFormat::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::PixelFormat::Type)(arg1)->getSupportedVideoPixelFormat(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudioSampleRates(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedAudioSampleRates();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t arg2 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getSupportedAudioSampleRate(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudioFormats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedAudioFormats();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::AudioFormat::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::AudioFormat::Type)(arg1)->getSupportedAudioFormat(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudioChannelLayouts(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedAudioChannelLayouts();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::AudioChannel::Layout result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::AudioChannel::Layout)(arg1)->getSupportedAudioChannelLayout(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedProfiles(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedProfiles();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedProfile(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::CodecProfile *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::CodecProfile *)(arg1)->getSupportedProfile(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::CodecProfile **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1PROP_1INTRA_1ONLY_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::CodecDescriptor::CodecProperty result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::CodecDescriptor::CodecProperty)io::humble::video::CodecDescriptor::PROP_INTRA_ONLY;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1PROP_1LOSSY_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::CodecDescriptor::CodecProperty result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::CodecDescriptor::CodecProperty)io::humble::video::CodecDescriptor::PROP_LOSSY;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1PROP_1LOSSLESS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::CodecDescriptor::CodecProperty result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::CodecDescriptor::CodecProperty)io::humble::video::CodecDescriptor::PROP_LOSSLESS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1PROP_1BITMAP_1SUB_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::CodecDescriptor::CodecProperty result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::CodecDescriptor::CodecProperty)io::humble::video::CodecDescriptor::PROP_BITMAP_SUB;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1hasProperty(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jboolean jresult = 0 ;
+  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
+  io::humble::video::CodecDescriptor::CodecProperty arg2 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  arg2 = (io::humble::video::CodecDescriptor::CodecProperty)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (bool)(arg1)->hasProperty(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getLongName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getProperties(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getProperties();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getId();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getType();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1make(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  jlong jresult = 0 ;
+  io::humble::video::Codec::ID arg1 ;
+  io::humble::video::CodecDescriptor *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (io::humble::video::Codec::ID)jarg1; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::CodecDescriptor *)io::humble::video::CodecDescriptor::make(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::CodecDescriptor **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1UNALIGNED_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_UNALIGNED;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1QSCALE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_QSCALE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_14MV_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_4MV;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1QPEL_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_QPEL;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1GMC_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_GMC;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1MV0_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_MV0;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1INPUT_1PRESERVED_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_INPUT_PRESERVED;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1PASS1_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_PASS1;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1PASS2_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_PASS2;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1GRAY_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_GRAY;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1EMU_1EDGE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_EMU_EDGE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1PSNR_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_PSNR;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1TRUNCATED_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_TRUNCATED;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1NORMALIZE_1AQP_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_NORMALIZE_AQP;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1INTERLACED_1DCT_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_INTERLACED_DCT;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1LOW_1DELAY_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_LOW_DELAY;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1GLOBAL_1HEADER_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_GLOBAL_HEADER;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1BITEXACT_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_BITEXACT;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1AC_1PRED_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_AC_PRED;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1LOOP_1FILTER_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_LOOP_FILTER;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1INTERLACED_1ME_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_INTERLACED_ME;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1CLOSED_1GOP_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_CLOSED_GOP;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1FAST_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag2 result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_FAST;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1NO_1OUTPUT_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag2 result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_NO_OUTPUT;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1LOCAL_1HEADER_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag2 result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_LOCAL_HEADER;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1DROP_1FRAME_1TIMECODE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag2 result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_DROP_FRAME_TIMECODE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1IGNORE_1CROP_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag2 result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_IGNORE_CROP;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1CHUNKS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag2 result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_CHUNKS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1SHOW_1ALL_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag2 result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_SHOW_ALL;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1EXPORT_1MVS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Coder::Flag2 result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_EXPORT_MVS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::KeyValueBag *arg2 = (io::humble::video::KeyValueBag *) 0 ;
+  io::humble::video::KeyValueBag *arg3 = (io::humble::video::KeyValueBag *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = *(io::humble::video::KeyValueBag **)&jarg2; 
+  arg3 = *(io::humble::video::KeyValueBag **)&jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->open(arg2,arg3);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Codec *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec *)(arg1)->getCodec();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Codec **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodecType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::MediaDescriptor::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getCodecType();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodecID(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getCodecID();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getHeight();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setHeight(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getWidth();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setWidth(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getPixelFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::PixelFormat::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::PixelFormat::Type)(arg1)->getPixelFormat();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setPixelFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::PixelFormat::Type arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (io::humble::video::PixelFormat::Type)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setPixelFormat(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getSampleRate();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setSampleRate(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getSampleFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::AudioFormat::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::AudioFormat::Type)(arg1)->getSampleFormat();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setSampleFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::AudioFormat::Type arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (io::humble::video::AudioFormat::Type)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setSampleFormat(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getChannels();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setChannels(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::AudioChannel::Layout result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::AudioChannel::Layout)(arg1)->getChannelLayout();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::AudioChannel::Layout arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (io::humble::video::AudioChannel::Layout)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setChannelLayout(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Coder_1getTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Rational *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Rational *)(arg1)->getTimeBase();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Rational **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Rational *arg2 = (io::humble::video::Rational *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = *(io::humble::video::Rational **)&jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setTimeBase(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Coder::State result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Coder::State)(arg1)->getState();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFrameCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFrameCount();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFrameSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFrameSize();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFlags();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Coder::Flag arg2 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (io::humble::video::Coder::Flag)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFlag(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlags2(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFlags2();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlag2(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Coder::Flag2 arg2 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (io::humble::video::Coder::Flag2)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFlag2(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setFlags(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jboolean jarg3) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Coder::Flag arg2 ;
+  bool arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (io::humble::video::Coder::Flag)jarg2; 
+  arg3 = jarg3 ? true : false; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setFlag(arg2,arg3);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlags2(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setFlags2(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlag2(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jboolean jarg3) {
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Coder::Flag2 arg2 ;
+  bool arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg2 = (io::humble::video::Coder::Flag2)jarg2; 
+  arg3 = jarg3 ? true : false; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->setFlag2(arg2,arg3);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1INVALID_1FLAG_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::INVALID_FLAG;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1FILE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_FILE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NEED_1NUMBER_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NEED_NUMBER;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1SHOW_1IDS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::SHOW_IDS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1RAW_1PICTURE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::RAW_PICTURE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1GLOBAL_1HEADER_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::GLOBAL_HEADER;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1TIMESTAMPS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_TIMESTAMPS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1GENERIC_1INDEX_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::GENERIC_INDEX;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1TIMESTAMP_1DISCONTINUITIES_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::TIMESTAMP_DISCONTINUITIES;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1VARIABLE_1FPS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::VARIABLE_FPS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1DIMENSIONS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_DIMENSIONS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1STREAMS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_STREAMS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1BINARY_1SEARCH_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_BINARY_SEARCH;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1GENERIC_1SEARCH_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_GENERIC_SEARCH;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1BYTE_1SEEKING_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_BYTE_SEEKING;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1ALLOW_1FLUSH_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::ALLOW_FLUSH;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NONSTRICT_1TIMESTAMPS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NONSTRICT_TIMESTAMPS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1SEEK_1TO_1PTS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::SEEK_TO_PTS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getLongName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getExtensions(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getExtensions();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFlags();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jboolean jresult = 0 ;
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  io::humble::video::ContainerFormat::Flag arg2 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  arg2 = (io::humble::video::ContainerFormat::Flag)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (bool)(arg1)->getFlag(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getNumSupportedCodecs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedCodecs();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getSupportedCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getSupportedCodecId(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getSupportedCodecTag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  int32_t arg2 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (uint32_t)(arg1)->getSupportedCodecTag(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_delete_1ContainerFormat(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      delete arg1;
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getLongName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getExtensions(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getExtensions();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFlags();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultAudioCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getDefaultAudioCodecId();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultVideoCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getDefaultVideoCodecId();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultSubtitleCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getDefaultSubtitleCodecId();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getMimeType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getMimeType();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1guessFormat(JNIEnv *jenv, jclass jcls, jstring jarg1, jstring jarg2, jstring jarg3) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  io::humble::video::MuxerFormat *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
+  }
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return 0;
+  }
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::MuxerFormat *)io::humble::video::MuxerFormat::guessFormat((char const *)arg1,(char const *)arg2,(char const *)arg3);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::MuxerFormat **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1guessCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jstring jarg4, jint jarg5) {
+  jint jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  io::humble::video::MediaDescriptor::Type arg5 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return 0;
+  }
+  arg4 = 0;
+  if (jarg4) {
+    arg4 = (char *)jenv->GetStringUTFChars(jarg4, 0);
+    if (!arg4) return 0;
+  }
+  arg5 = (io::humble::video::MediaDescriptor::Type)jarg5; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->guessCodec((char const *)arg2,(char const *)arg3,(char const *)arg4,arg5);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  if (arg4) jenv->ReleaseStringUTFChars(jarg4, (const char *)arg4);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getNumSupportedCodecs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedCodecs();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getBestCodecTag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  io::humble::video::Codec::ID arg2 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg2 = (io::humble::video::Codec::ID)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (uint32_t)(arg1)->getBestCodecTag(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getSupportedCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getSupportedCodecId(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getSupportedCodecTag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  int32_t arg2 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (uint32_t)(arg1)->getSupportedCodecTag(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getNumFormats(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)io::humble::video::MuxerFormat::getNumFormats();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getFormat(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  jlong jresult = 0 ;
+  int32_t arg1 ;
+  io::humble::video::MuxerFormat *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (int32_t)jarg1; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::MuxerFormat *)io::humble::video::MuxerFormat::getFormat(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::MuxerFormat **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getLongName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getExtensions(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  char *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getExtensions();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getFlags();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getNumSupportedCodecs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumSupportedCodecs();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getSupportedCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::Codec::ID result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Codec::ID)(arg1)->getSupportedCodecId(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getSupportedCodecTag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  int32_t arg2 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (uint32_t)(arg1)->getSupportedCodecTag(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1findFormat(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  io::humble::video::DemuxerFormat *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
+  }
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::DemuxerFormat *)io::humble::video::DemuxerFormat::findFormat((char const *)arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::DemuxerFormat **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getNumFormats(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Codec::CodecCapability result;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_SLICE_THREADS;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)io::humble::video::DemuxerFormat::getNumFormats();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1PARAM_1CHANGE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Codec::CodecCapability result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getFormat(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  jlong jresult = 0 ;
+  int32_t arg1 ;
+  io::humble::video::DemuxerFormat *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_PARAM_CHANGE;
-  jresult = (jint)result; 
+  arg1 = (int32_t)jarg1; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::DemuxerFormat *)io::humble::video::DemuxerFormat::getFormat(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::DemuxerFormat **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1AUTO_1THREADS_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1INDEX_1FLAG_1KEYFRAME_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Codec::CodecCapability result;
+  int result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_AUTO_THREADS;
+  result = (int)io::humble::video::IndexEntry::INDEX_FLAG_KEYFRAME;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1VARIABLE_1FRAME_1SIZE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Codec::CodecCapability result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1make(JNIEnv *jenv, jclass jcls, jlong jarg1, jlong jarg2, jint jarg3, jint jarg4, jint jarg5) {
+  jlong jresult = 0 ;
+  int64_t arg1 ;
+  int64_t arg2 ;
+  int32_t arg3 ;
+  int32_t arg4 ;
+  int32_t arg5 ;
+  io::humble::video::IndexEntry *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_VARIABLE_FRAME_SIZE;
-  jresult = (jint)result; 
+  arg1 = (int64_t)jarg1; 
+  arg2 = (int64_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int32_t)jarg4; 
+  arg5 = (int32_t)jarg5; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::IndexEntry *)io::humble::video::IndexEntry::make(arg1,arg2,arg3,arg4,arg5);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::IndexEntry **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1INTRA_1ONLY_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Codec::CodecCapability result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getPosition(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_INTRA_ONLY;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1CAP_1LOSSLESS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Codec::CodecCapability result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Codec::CodecCapability)io::humble::video::Codec::CAP_LOSSLESS;
-  jresult = (jint)result; 
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getPosition();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1hasCapability(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jboolean jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  io::humble::video::Codec::CodecCapability arg2 ;
-  bool result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getTimeStamp(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
-  arg2 = (io::humble::video::Codec::CodecCapability)jarg2; 
+  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -22146,7 +28539,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1hasCapability(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->hasCapability(arg2);
+      result = (int64_t)(arg1)->getTimeStamp();
     }
     catch(std::exception & e)
     {
@@ -22165,20 +28558,20 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1hasCapability(J
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getCapabilities(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -22192,7 +28585,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getCapabilities(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getCapabilities();
+      result = (int32_t)(arg1)->getFlags();
     }
     catch(std::exception & e)
     {
@@ -22216,15 +28609,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getCapabilities(JNI
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Codec_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -22238,7 +28631,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Codec_1getName(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      result = (int32_t)(arg1)->getSize();
     }
     catch(std::exception & e)
     {
@@ -22257,20 +28650,20 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Codec_1getName(JNIEnv *
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getIDAsInt(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getMinDistance(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int result;
+  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -22284,7 +28677,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getIDAsInt(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int)(arg1)->getIDAsInt();
+      result = (int32_t)(arg1)->getMinDistance();
     }
     catch(std::exception & e)
     {
@@ -22308,15 +28701,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getIDAsInt(JNIEnv *
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getID(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  io::humble::video::Codec::ID result;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1isKeyFrame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -22330,7 +28723,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getID(JNIEnv *jenv,
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getID();
+      result = (bool)(arg1)->isKeyFrame();
     }
     catch(std::exception & e)
     {
@@ -22349,34 +28742,66 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getID(JNIEnv *jenv,
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Decoder_1make_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
   io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+  io::humble::video::Decoder *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::Codec **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Decoder *)io::humble::video::Decoder::make(arg1);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
   }
+  *(io::humble::video::Decoder **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Decoder_1make_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Decoder *result = 0 ;
   
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getType();
+      result = (io::humble::video::Decoder *)io::humble::video::Decoder::make(arg1);
     }
     catch(std::exception & e)
     {
@@ -22395,25 +28820,23 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getType(JNIEnv *jen
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::Decoder **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1canDecode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jboolean jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  bool result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Decoder_1flush(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::Decoder *arg1 = (io::humble::video::Decoder *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::Decoder **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -22422,18 +28845,18 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1canDecode(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->canDecode();
+      (arg1)->flush();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -22441,20 +28864,26 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1canDecode(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1canEncode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jboolean jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  bool result;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decodeAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_, jint jarg4) {
+  jint jresult = 0 ;
+  io::humble::video::Decoder *arg1 = (io::humble::video::Decoder *) 0 ;
+  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
+  io::humble::video::MediaPacket *arg3 = (io::humble::video::MediaPacket *) 0 ;
+  int32_t arg4 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Decoder **)&jarg1; 
+  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
+  arg3 = *(io::humble::video::MediaPacket **)&jarg3; 
+  arg4 = (int32_t)jarg4; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -22468,7 +28897,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1canEncode(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->canEncode();
+      result = (int32_t)(arg1)->decodeAudio(arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
@@ -22487,26 +28916,42 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Codec_1canEncode(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodec(JNIEnv *jenv, jclass jcls, jint jarg1) {
-  jlong jresult = 0 ;
-  io::humble::video::Codec::ID arg1 ;
-  io::humble::video::Codec *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decodeVideo(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_, jint jarg4) {
+  jint jresult = 0 ;
+  io::humble::video::Decoder *arg1 = (io::humble::video::Decoder *) 0 ;
+  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
+  io::humble::video::MediaPacket *arg3 = (io::humble::video::MediaPacket *) 0 ;
+  int32_t arg4 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (io::humble::video::Codec::ID)jarg1; 
+  (void)jarg1_;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Decoder **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
+  arg3 = *(io::humble::video::MediaPacket **)&jarg3; 
+  arg4 = (int32_t)jarg4; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)io::humble::video::Codec::findEncodingCodec(arg1);
+      result = (int32_t)(arg1)->decodeVideo(arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
@@ -22525,26 +28970,42 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodec(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodecByIntID(JNIEnv *jenv, jclass jcls, jint jarg1) {
-  jlong jresult = 0 ;
-  int arg1 ;
-  io::humble::video::Codec *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_, jint jarg4) {
+  jint jresult = 0 ;
+  io::humble::video::Decoder *arg1 = (io::humble::video::Decoder *) 0 ;
+  io::humble::video::MediaSampled *arg2 = (io::humble::video::MediaSampled *) 0 ;
+  io::humble::video::MediaPacket *arg3 = (io::humble::video::MediaPacket *) 0 ;
+  int32_t arg4 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (int)jarg1; 
+  (void)jarg1_;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Decoder **)&jarg1; 
+  arg2 = *(io::humble::video::MediaSampled **)&jarg2; 
+  arg3 = *(io::humble::video::MediaPacket **)&jarg3; 
+  arg4 = (int32_t)jarg4; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)io::humble::video::Codec::findEncodingCodecByIntID(arg1);
+      result = (int32_t)(arg1)->decode(arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
@@ -22563,30 +29024,34 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodecB
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodecByName(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1getNumDroppedFrames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  char *arg1 = (char *) 0 ;
-  io::humble::video::Codec *result = 0 ;
+  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = 0;
-  if (jarg1) {
-    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
-    if (!arg1) return 0;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Encoder **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
   }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)io::humble::video::Codec::findEncodingCodecByName((char const *)arg1);
+      result = (int64_t)(arg1)->getNumDroppedFrames();
     }
     catch(std::exception & e)
     {
@@ -22605,27 +29070,27 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findEncodingCodecB
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
-  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodec(JNIEnv *jenv, jclass jcls, jint jarg1) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1make_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::Codec::ID arg1 ;
-  io::humble::video::Codec *result = 0 ;
+  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  io::humble::video::Encoder *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (io::humble::video::Codec::ID)jarg1; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Codec **)&jarg1; 
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)io::humble::video::Codec::findDecodingCodec(arg1);
+      result = (io::humble::video::Encoder *)io::humble::video::Encoder::make(arg1);
     }
     catch(std::exception & e)
     {
@@ -22644,26 +29109,27 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodec(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
+  *(io::humble::video::Encoder **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodecByIntID(JNIEnv *jenv, jclass jcls, jint jarg1) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1make_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  int arg1 ;
-  io::humble::video::Codec *result = 0 ;
+  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Encoder *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (int)jarg1; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Coder **)&jarg1; 
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)io::humble::video::Codec::findDecodingCodecByIntID(arg1);
+      result = (io::humble::video::Encoder *)io::humble::video::Encoder::make(arg1);
     }
     catch(std::exception & e)
     {
@@ -22682,41 +29148,49 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodecB
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
+  *(io::humble::video::Encoder **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodecByName(JNIEnv *jenv, jclass jcls, jstring jarg1) {
-  jlong jresult = 0 ;
-  char *arg1 = (char *) 0 ;
-  io::humble::video::Codec *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
+  io::humble::video::KeyValueBag *arg2 = (io::humble::video::KeyValueBag *) 0 ;
+  io::humble::video::KeyValueBag *arg3 = (io::humble::video::KeyValueBag *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = 0;
-  if (jarg1) {
-    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
-    if (!arg1) return 0;
+  (void)jarg1_;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Encoder **)&jarg1; 
+  arg2 = *(io::humble::video::KeyValueBag **)&jarg2; 
+  arg3 = *(io::humble::video::KeyValueBag **)&jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
   }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)io::humble::video::Codec::findDecodingCodecByName((char const *)arg1);
+      (arg1)->open(arg2,arg3);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -22724,59 +29198,47 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1findDecodingCodecB
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
-  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1guessEncodingCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jstring jarg4, jint jarg5) {
-  jlong jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
-  char *arg4 = (char *) 0 ;
-  io::humble::video::MediaDescriptor::Type arg5 ;
-  io::humble::video::Codec *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encodeVideo(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
+  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
+  io::humble::video::MediaPicture *arg3 = (io::humble::video::MediaPicture *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return 0;
-  }
-  arg4 = 0;
-  if (jarg4) {
-    arg4 = (char *)jenv->GetStringUTFChars(jarg4, 0);
-    if (!arg4) return 0;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Encoder **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
+  arg3 = *(io::humble::video::MediaPicture **)&jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
   }
-  arg5 = (io::humble::video::MediaDescriptor::Type)jarg5; 
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)io::humble::video::Codec::guessEncodingCodec(arg1,(char const *)arg2,(char const *)arg3,(char const *)arg4,arg5);
+      (arg1)->encodeVideo(arg2,arg3);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -22784,28 +29246,27 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1guessEncodingCodec
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
-  if (arg4) jenv->ReleaseStringUTFChars(jarg4, (const char *)arg4);
-  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Codec_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encodeAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
+  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
+  io::humble::video::MediaAudio *arg3 = (io::humble::video::MediaAudio *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Encoder **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
+  arg3 = *(io::humble::video::MediaAudio **)&jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -22814,18 +29275,18 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Codec_1getLongName(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getLongName();
+      (arg1)->encodeAudio(arg2,arg3);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -22833,35 +29294,47 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Codec_1getLongName(JNIE
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumInstalledCodecs(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  int32_t result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
+  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
+  io::humble::video::MediaSampled *arg3 = (io::humble::video::MediaSampled *) 0 ;
   
   (void)jenv;
   (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Encoder **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
+  arg3 = *(io::humble::video::MediaSampled **)&jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)io::humble::video::Codec::getNumInstalledCodecs();
+      (arg1)->encode(arg2,arg3);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -22869,26 +29342,248 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumInstalledCode
     
     /*@SWIG@*/
   }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1NONE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_NONE;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getInstalledCodec(JNIEnv *jenv, jclass jcls, jint jarg1) {
-  jlong jresult = 0 ;
-  int32_t arg1 ;
-  io::humble::video::Codec *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1DEFAULT_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (int32_t)jarg1; 
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_DEFAULT;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1DUB_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_DUB;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1ORIGINAL_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_ORIGINAL;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1COMMENT_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_COMMENT;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1LYRICS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_LYRICS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1KARAOKE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_KARAOKE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1FORCED_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_FORCED;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1HEARING_1IMPAIRED_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_HEARING_IMPAIRED;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1VISUAL_1IMPAIRED_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_VISUAL_IMPAIRED;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1CLEAN_1EFFECTS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_CLEAN_EFFECTS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1ATTACHED_1PIC_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::Disposition result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_ATTACHED_PIC;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1NONE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::ParseType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_NONE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1FULL_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::ParseType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_FULL;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1HEADERS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::ParseType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_HEADERS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1TIMESTAMPS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::ParseType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_TIMESTAMPS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1FULL_1ONCE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::ParseType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_FULL_ONCE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1FULL_1RAW_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream::ParseType result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_FULL_RAW;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)io::humble::video::Codec::getInstalledCodec(arg1);
+      result = (int32_t)(arg1)->getIndex();
     }
     catch(std::exception & e)
     {
@@ -22907,20 +29602,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getInstalledCodec(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedVideoFrameRates(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -22934,7 +29629,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedVide
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedVideoFrameRates();
+      result = (int32_t)(arg1)->getId();
     }
     catch(std::exception & e)
     {
@@ -22958,17 +29653,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedVide
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedVideoFrameRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getFrameRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t arg2 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
   io::humble::video::Rational *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -22982,7 +29675,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedVideoF
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Rational *)(arg1)->getSupportedVideoFrameRate(arg2);
+      result = (io::humble::video::Rational *)(arg1)->getFrameRate();
     }
     catch(std::exception & e)
     {
@@ -23006,15 +29699,15 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedVideoF
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedVideoPixelFormats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  io::humble::video::Rational *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23028,7 +29721,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedVide
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedVideoPixelFormats();
+      result = (io::humble::video::Rational *)(arg1)->getTimeBase();
     }
     catch(std::exception & e)
     {
@@ -23047,22 +29740,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedVide
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::Rational **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedVideoPixelFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::PixelFormat::Type result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getStartTime(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23076,7 +29767,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedVideoPi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::PixelFormat::Type)(arg1)->getSupportedVideoPixelFormat(arg2);
+      result = (int64_t)(arg1)->getStartTime();
     }
     catch(std::exception & e)
     {
@@ -23095,20 +29786,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedVideoPi
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudioSampleRates(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getDuration(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23122,7 +29813,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedAudioSampleRates();
+      result = (int64_t)(arg1)->getDuration();
     }
     catch(std::exception & e)
     {
@@ -23141,22 +29832,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudi
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t arg2 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getCurrentDts(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23170,7 +29859,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioSa
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getSupportedAudioSampleRate(arg2);
+      result = (int64_t)(arg1)->getCurrentDts();
     }
     catch(std::exception & e)
     {
@@ -23189,20 +29878,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioSa
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudioFormats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getNumIndexEntries(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t result;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23216,7 +29905,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedAudioFormats();
+      result = (int)(arg1)->getNumIndexEntries();
     }
     catch(std::exception & e)
     {
@@ -23240,17 +29929,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudi
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::AudioFormat::Type result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getNumFrames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23264,7 +29951,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioFo
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioFormat::Type)(arg1)->getSupportedAudioFormat(arg2);
+      result = (int64_t)(arg1)->getNumFrames();
     }
     catch(std::exception & e)
     {
@@ -23283,20 +29970,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioFo
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudioChannelLayouts(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getSampleAspectRatio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  io::humble::video::Rational *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23310,7 +29997,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedAudioChannelLayouts();
+      result = (io::humble::video::Rational *)(arg1)->getSampleAspectRatio();
     }
     catch(std::exception & e)
     {
@@ -23329,22 +30016,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedAudi
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::Rational **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::AudioChannel::Layout result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getContainer(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  io::humble::video::Container *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23358,7 +30043,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioCh
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioChannel::Layout)(arg1)->getSupportedAudioChannelLayout(arg2);
+      result = (io::humble::video::Container *)(arg1)->getContainer();
     }
     catch(std::exception & e)
     {
@@ -23377,20 +30062,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedAudioCh
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::Container **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedProfiles(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getParseType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t result;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  io::humble::video::ContainerStream::ParseType result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23404,7 +30089,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedProf
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedProfiles();
+      result = (io::humble::video::ContainerStream::ParseType)(arg1)->getParseType();
     }
     catch(std::exception & e)
     {
@@ -23428,22 +30113,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Codec_1getNumSupportedProf
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedProfile(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jlong jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::CodecProfile *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1setParseType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  io::humble::video::ContainerStream::ParseType arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg2 = (io::humble::video::ContainerStream::ParseType)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -23452,18 +30135,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedProfil
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::CodecProfile *)(arg1)->getSupportedProfile(arg2);
+      (arg1)->setParseType(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -23471,70 +30154,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Codec_1getSupportedProfil
     
     /*@SWIG@*/
   }
-  *(io::humble::video::CodecProfile **)&jresult = result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1PROP_1INTRA_1ONLY_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::CodecDescriptor::CodecProperty result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::CodecDescriptor::CodecProperty)io::humble::video::CodecDescriptor::PROP_INTRA_ONLY;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1PROP_1LOSSY_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::CodecDescriptor::CodecProperty result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::CodecDescriptor::CodecProperty)io::humble::video::CodecDescriptor::PROP_LOSSY;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1PROP_1LOSSLESS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::CodecDescriptor::CodecProperty result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::CodecDescriptor::CodecProperty)io::humble::video::CodecDescriptor::PROP_LOSSLESS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1PROP_1BITMAP_1SUB_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::CodecDescriptor::CodecProperty result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::CodecDescriptor::CodecProperty)io::humble::video::CodecDescriptor::PROP_BITMAP_SUB;
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1hasProperty(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jboolean jresult = 0 ;
-  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
-  io::humble::video::CodecDescriptor::CodecProperty arg2 ;
-  bool result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getMetaData(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  io::humble::video::KeyValueBag *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
-  arg2 = (io::humble::video::CodecDescriptor::CodecProperty)jarg2; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23548,7 +30179,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1hasPr
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->hasProperty(arg2);
+      result = (io::humble::video::KeyValueBag *)(arg1)->getMetaData();
     }
     catch(std::exception & e)
     {
@@ -23567,20 +30198,24 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1hasPr
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  *(io::humble::video::KeyValueBag **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1findTimeStampEntryInIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int64_t arg2 ;
+  int32_t arg3 ;
+  io::humble::video::IndexEntry *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23594,7 +30229,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getNam
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      result = (io::humble::video::IndexEntry *)(arg1)->findTimeStampEntryInIndex(arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -23613,20 +30248,24 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getNam
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  *(io::humble::video::IndexEntry **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1findTimeStampPositionInIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  jint jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int64_t arg2 ;
+  int32_t arg3 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23640,7 +30279,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getLon
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getLongName();
+      result = (int32_t)(arg1)->findTimeStampPositionInIndex(arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -23659,20 +30298,22 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getLon
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getProperties(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getIndexEntry(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::IndexEntry *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23686,7 +30327,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getProper
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getProperties();
+      result = (io::humble::video::IndexEntry *)(arg1)->getIndexEntry(arg2);
     }
     catch(std::exception & e)
     {
@@ -23705,20 +30346,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getProper
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::IndexEntry **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getDisposition(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
-  io::humble::video::Codec::ID result;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  io::humble::video::ContainerStream::Disposition result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23732,7 +30373,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getId(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getId();
+      result = (io::humble::video::ContainerStream::Disposition)(arg1)->getDisposition();
     }
     catch(std::exception & e)
     {
@@ -23756,15 +30397,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getId(JNI
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::CodecDescriptor *arg1 = (io::humble::video::CodecDescriptor *) 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getAttachedPic(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  io::humble::video::MediaPacket *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::CodecDescriptor **)&jarg1; 
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -23778,7 +30419,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getType(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getType();
+      result = (io::humble::video::MediaPacket *)(arg1)->getAttachedPic();
     }
     catch(std::exception & e)
     {
@@ -23797,26 +30438,40 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1getType(J
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::MediaPacket **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1make(JNIEnv *jenv, jclass jcls, jint jarg1) {
-  jlong jresult = 0 ;
-  io::humble::video::Codec::ID arg1 ;
-  io::humble::video::CodecDescriptor *result = 0 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1matchSpecifier(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jboolean jresult = 0 ;
+  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
+  char *arg2 = (char *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (io::humble::video::Codec::ID)jarg1; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::CodecDescriptor *)io::humble::video::CodecDescriptor::make(arg1);
+      result = (bool)(arg1)->matchSpecifier((char const *)arg2);
     }
     catch(std::exception & e)
     {
@@ -23835,389 +30490,642 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CodecDescriptor_1make(JNI
     
     /*@SWIG@*/
   }
-  *(io::humble::video::CodecDescriptor **)&jresult = result; 
+  jresult = (jboolean)result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1UNALIGNED_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1GENPTS_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_UNALIGNED;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_GENPTS;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1QSCALE_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1IGNIDX_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_QSCALE;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_IGNIDX;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_14MV_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1NONBLOCK_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_4MV;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_NONBLOCK;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1QPEL_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1IGNDTS_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_QPEL;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_IGNDTS;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1GMC_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1NOFILLIN_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_GMC;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_NOFILLIN;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1MV0_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1NOPARSE_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_MV0;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_NOPARSE;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1INPUT_1PRESERVED_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1NOBUFFER_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_INPUT_PRESERVED;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_NOBUFFER;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1PASS1_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1CUSTOM_1IO_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_PASS1;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_CUSTOM_IO;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1PASS2_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1DISCARD_1CORRUPT_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_PASS2;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_DISCARD_CORRUPT;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1GRAY_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1MP4A_1LATM_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_GRAY;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_MP4A_LATM;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1EMU_1EDGE_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1SORT_1DTS_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_EMU_EDGE;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_SORT_DTS;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1PSNR_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1PRIV_1OPT_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_PSNR;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_PRIV_OPT;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1TRUNCATED_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1KEEP_1SIDE_1DATA_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container::Flag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_TRUNCATED;
+  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_KEEP_SIDE_DATA;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1NORMALIZE_1AQP_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1getNumStreams(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_NORMALIZE_AQP;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1INTERLACED_1DCT_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Container **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_INTERLACED_DCT;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1LOW_1DELAY_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_LOW_DELAY;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumStreams();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1GLOBAL_1HEADER_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Container_1getIOReadCalls(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_GLOBAL_HEADER;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1BITEXACT_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Container **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_BITEXACT;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1AC_1PRED_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_AC_PRED;
-  jresult = (jint)result; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getIOReadCalls();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1LOOP_1FILTER_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Container_1getIOBytesRead(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_LOOP_FILTER;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1INTERLACED_1ME_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Container **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_INTERLACED_ME;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG_1CLOSED_1GOP_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag result;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Coder::Flag)io::humble::video::Coder::FLAG_CLOSED_GOP;
-  jresult = (jint)result; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getIOBytesRead();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1FAST_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag2 result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Container_1getIOWriteCalls(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_FAST;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1NO_1OUTPUT_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag2 result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Container **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_NO_OUTPUT;
-  jresult = (jint)result; 
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getIOWriteCalls();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1LOCAL_1HEADER_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag2 result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Container_1getIOBytesWritten(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_LOCAL_HEADER;
-  jresult = (jint)result; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Container **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getIOBytesWritten();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1DROP_1FRAME_1TIMECODE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag2 result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Container_1getIOSeekCalls(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_DROP_FRAME_TIMECODE;
-  jresult = (jint)result; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Container **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getIOSeekCalls();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1IGNORE_1CROP_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag2 result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Container_1getIOTime(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_IGNORE_CROP;
-  jresult = (jint)result; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Container **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getIOTime();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1CHUNKS_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1getIOBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Coder::Flag2 result;
+  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_CHUNKS;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Container **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getIOBufferLength();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1SHOW_1ALL_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag2 result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerStream_1getCoder(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MuxerStream *arg1 = (io::humble::video::MuxerStream *) 0 ;
+  io::humble::video::Coder *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_SHOW_ALL;
-  jresult = (jint)result; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerStream **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Coder *)(arg1)->getCoder();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Coder **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1FLAG2_1EXPORT_1MVS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Coder::Flag2 result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerStream_1getMuxer(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MuxerStream *arg1 = (io::humble::video::MuxerStream *) 0 ;
+  io::humble::video::Muxer *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Coder::Flag2)io::humble::video::Coder::FLAG2_EXPORT_MVS;
-  jresult = (jint)result; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MuxerStream **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Muxer *)(arg1)->getMuxer();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  *(io::humble::video::Muxer **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::KeyValueBag *arg2 = (io::humble::video::KeyValueBag *) 0 ;
-  io::humble::video::KeyValueBag *arg3 = (io::humble::video::KeyValueBag *) 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDecoder(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::DemuxerStream *arg1 = (io::humble::video::DemuxerStream *) 0 ;
+  io::humble::video::Decoder *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = *(io::humble::video::KeyValueBag **)&jarg2; 
-  arg3 = *(io::humble::video::KeyValueBag **)&jarg3; 
+  arg1 = *(io::humble::video::DemuxerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -24226,18 +31134,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1open(JNIEnv *jenv,
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->open(arg2,arg3);
+      result = (io::humble::video::Decoder *)(arg1)->getDecoder();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -24245,18 +31153,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1open(JNIEnv *jenv,
     
     /*@SWIG@*/
   }
+  *(io::humble::video::Decoder **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDemuxer(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Codec *result = 0 ;
+  io::humble::video::DemuxerStream *arg1 = (io::humble::video::DemuxerStream *) 0 ;
+  io::humble::video::Demuxer *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::DemuxerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24270,7 +31180,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodec(JNIEnv *j
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec *)(arg1)->getCodec();
+      result = (io::humble::video::Demuxer *)(arg1)->getDemuxer();
     }
     catch(std::exception & e)
     {
@@ -24289,20 +31199,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodec(JNIEnv *j
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Codec **)&jresult = result; 
+  *(io::humble::video::Demuxer **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodecType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDiscard(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+  io::humble::video::DemuxerStream *arg1 = (io::humble::video::DemuxerStream *) 0 ;
+  io::humble::video::Codec::DiscardFlag result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::DemuxerStream **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24316,7 +31226,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodecType(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getCodecType();
+      result = (io::humble::video::Codec::DiscardFlag)(arg1)->getDiscard();
     }
     catch(std::exception & e)
     {
@@ -24340,20 +31250,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodecType(JNIEnv
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodecID(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Codec::ID result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1setDiscard(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::DemuxerStream *arg1 = (io::humble::video::DemuxerStream *) 0 ;
+  io::humble::video::Codec::DiscardFlag arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::DemuxerStream **)&jarg1; 
+  arg2 = (io::humble::video::Codec::DiscardFlag)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -24362,7 +31272,56 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodecID(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getCodecID();
+      (arg1)->setDiscard(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1make(JNIEnv *jenv, jclass jcls, jstring jarg1, jlong jarg2, jobject jarg2_, jstring jarg3) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  io::humble::video::MuxerFormat *arg2 = (io::humble::video::MuxerFormat *) 0 ;
+  char *arg3 = (char *) 0 ;
+  io::humble::video::Muxer *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg2_;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
+  }
+  arg2 = *(io::humble::video::MuxerFormat **)&jarg2; 
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return 0;
+  }
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Muxer *)io::humble::video::Muxer::make((char const *)arg1,arg2,(char const *)arg3);
     }
     catch(std::exception & e)
     {
@@ -24381,20 +31340,22 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getCodecID(JNIEnv *
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::Muxer **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t result;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Muxer_1getURL(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24408,7 +31369,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getHeight(JNIEnv *j
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getHeight();
+      result = (char *)(arg1)->getURL();
     }
     catch(std::exception & e)
     {
@@ -24427,25 +31388,25 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getHeight(JNIEnv *j
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  io::humble::video::MuxerFormat *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -24454,18 +31415,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setHeight(JNIEnv *j
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setHeight(arg2);
+      result = (io::humble::video::MuxerFormat *)(arg1)->getFormat();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -24473,18 +31434,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setHeight(JNIEnv *j
     
     /*@SWIG@*/
   }
+  *(io::humble::video::MuxerFormat **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t result;
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  io::humble::video::Muxer::State result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24498,7 +31461,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getWidth(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getWidth();
+      result = (io::humble::video::Muxer::State)(arg1)->getState();
     }
     catch(std::exception & e)
     {
@@ -24522,15 +31485,19 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getWidth(JNIEnv *je
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  io::humble::video::KeyValueBag *arg2 = (io::humble::video::KeyValueBag *) 0 ;
+  io::humble::video::KeyValueBag *arg3 = (io::humble::video::KeyValueBag *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  arg2 = *(io::humble::video::KeyValueBag **)&jarg2; 
+  arg3 = *(io::humble::video::KeyValueBag **)&jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24544,7 +31511,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setWidth(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setWidth(arg2);
+      (arg1)->open(arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -24566,15 +31533,57 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setWidth(JNIEnv *je
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getPixelFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1close(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->close();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getNumStreams(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::PixelFormat::Type result;
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24588,7 +31597,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getPixelFormat(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::PixelFormat::Type)(arg1)->getPixelFormat();
+      result = (int32_t)(arg1)->getNumStreams();
     }
     catch(std::exception & e)
     {
@@ -24612,15 +31621,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getPixelFormat(JNIE
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setPixelFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::PixelFormat::Type arg2 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1setOutputBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (io::humble::video::PixelFormat::Type)jarg2; 
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24634,7 +31643,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setPixelFormat(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setPixelFormat(arg2);
+      (arg1)->setOutputBufferLength(arg2);
     }
     catch(std::exception & e)
     {
@@ -24656,15 +31665,15 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setPixelFormat(JNIE
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getOutputBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24678,7 +31687,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getSampleRate(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getSampleRate();
+      result = (int32_t)(arg1)->getOutputBufferLength();
     }
     catch(std::exception & e)
     {
@@ -24702,20 +31711,23 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getSampleRate(JNIEn
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1addNewStream(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  jlong jresult = 0 ;
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  io::humble::video::Coder *arg2 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::MuxerStream *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  arg2 = *(io::humble::video::Coder **)&jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -24724,18 +31736,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setSampleRate(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setSampleRate(arg2);
+      result = (io::humble::video::MuxerStream *)(arg1)->addNewStream(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -24743,18 +31755,22 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setSampleRate(JNIEn
     
     /*@SWIG@*/
   }
+  *(io::humble::video::MuxerStream **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getSampleFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::AudioFormat::Type result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1getStream(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::MuxerStream *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24768,7 +31784,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getSampleFormat(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioFormat::Type)(arg1)->getSampleFormat();
+      result = (io::humble::video::MuxerStream *)(arg1)->getStream(arg2);
     }
     catch(std::exception & e)
     {
@@ -24787,25 +31803,30 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getSampleFormat(JNI
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::MuxerStream **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setSampleFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::AudioFormat::Type arg2 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Muxer_1write(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jboolean jarg3) {
+  jboolean jresult = 0 ;
+  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
+  bool arg3 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (io::humble::video::AudioFormat::Type)jarg2; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
+  arg3 = jarg3 ? true : false; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -24814,18 +31835,54 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setSampleFormat(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setSampleFormat(arg2);
+      result = (bool)(arg1)->write(arg2,arg3);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1make(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  io::humble::video::Demuxer *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::Demuxer *)io::humble::video::Demuxer::make();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -24833,18 +31890,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setSampleFormat(JNI
     
     /*@SWIG@*/
   }
+  *(io::humble::video::Demuxer **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t result;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::Demuxer::State result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -24858,7 +31917,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getChannels(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getChannels();
+      result = (io::humble::video::Demuxer::State)(arg1)->getState();
     }
     catch(std::exception & e)
     {
@@ -24882,20 +31941,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getChannels(JNIEnv
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::DemuxerFormat *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -24904,18 +31963,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setChannels(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setChannels(arg2);
+      result = (io::humble::video::DemuxerFormat *)(arg1)->getFormat();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -24923,23 +31982,25 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setChannels(JNIEnv
     
     /*@SWIG@*/
   }
+  *(io::humble::video::DemuxerFormat **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::AudioChannel::Layout result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setInputBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -24948,18 +32009,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getChannelLayout(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioChannel::Layout)(arg1)->getChannelLayout();
+      (arg1)->setInputBufferLength(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -24967,25 +32028,23 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getChannelLayout(JN
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::AudioChannel::Layout arg2 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getInputBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (io::humble::video::AudioChannel::Layout)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -24994,18 +32053,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setChannelLayout(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setChannelLayout(arg2);
+      result = (int32_t)(arg1)->getInputBufferLength();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -25013,23 +32072,42 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setChannelLayout(JN
     
     /*@SWIG@*/
   }
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Coder_1getTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Rational *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jlong jarg3, jobject jarg3_, jboolean jarg4, jboolean jarg5, jlong jarg6, jobject jarg6_, jlong jarg7, jobject jarg7_) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  char *arg2 = (char *) 0 ;
+  io::humble::video::DemuxerFormat *arg3 = (io::humble::video::DemuxerFormat *) 0 ;
+  bool arg4 ;
+  bool arg5 ;
+  io::humble::video::KeyValueBag *arg6 = (io::humble::video::KeyValueBag *) 0 ;
+  io::humble::video::KeyValueBag *arg7 = (io::humble::video::KeyValueBag *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  (void)jarg3_;
+  (void)jarg6_;
+  (void)jarg7_;
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return ;
+  }
+  arg3 = *(io::humble::video::DemuxerFormat **)&jarg3; 
+  arg4 = jarg4 ? true : false; 
+  arg5 = jarg5 ? true : false; 
+  arg6 = *(io::humble::video::KeyValueBag **)&jarg6; 
+  arg7 = *(io::humble::video::KeyValueBag **)&jarg7; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -25038,18 +32116,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Coder_1getTimeBase(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Rational *)(arg1)->getTimeBase();
+      (arg1)->open((char const *)arg2,arg3,arg4,arg5,arg6,arg7);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -25057,21 +32135,17 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Coder_1getTimeBase(JNIEnv
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Rational **)&jresult = result; 
-  return jresult;
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Rational *arg2 = (io::humble::video::Rational *) 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1close(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = *(io::humble::video::Rational **)&jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25085,7 +32159,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setTimeBase(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setTimeBase(arg2);
+      (arg1)->close();
     }
     catch(std::exception & e)
     {
@@ -25107,15 +32181,17 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setTimeBase(JNIEnv
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Coder::State result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getStream(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::DemuxerStream *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25129,7 +32205,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getState(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Coder::State)(arg1)->getState();
+      result = (io::humble::video::DemuxerStream *)(arg1)->getStream(arg2);
     }
     catch(std::exception & e)
     {
@@ -25148,20 +32224,23 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getState(JNIEnv *je
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::DemuxerStream **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFrameCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1read(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
   jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25175,7 +32254,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFrameCount(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFrameCount();
+      result = (int32_t)(arg1)->read(arg2);
     }
     catch(std::exception & e)
     {
@@ -25199,20 +32278,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFrameCount(JNIEn
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFrameSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1queryStreamMetaData(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -25221,18 +32298,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFrameSize(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFrameSize();
+      (arg1)->queryStreamMetaData();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -25240,20 +32317,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFrameSize(JNIEnv
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getDuration(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25267,7 +32342,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlags(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlags();
+      result = (int64_t)(arg1)->getDuration();
     }
     catch(std::exception & e)
     {
@@ -25286,22 +32361,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlags(JNIEnv *je
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Coder::Flag arg2 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getStartTime(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (io::humble::video::Coder::Flag)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25315,7 +32388,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlag(JNIEnv *jen
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlag(arg2);
+      result = (int64_t)(arg1)->getStartTime();
     }
     catch(std::exception & e)
     {
@@ -25334,20 +32407,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlag(JNIEnv *jen
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlags2(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFileSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25361,7 +32434,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlags2(JNIEnv *j
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlags2();
+      result = (int64_t)(arg1)->getFileSize();
     }
     catch(std::exception & e)
     {
@@ -25380,22 +32453,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlags2(JNIEnv *j
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlag2(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getBitRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Coder::Flag2 arg2 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (io::humble::video::Coder::Flag2)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25409,7 +32480,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlag2(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlag2(arg2);
+      result = (int32_t)(arg1)->getBitRate();
     }
     catch(std::exception & e)
     {
@@ -25433,20 +32504,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Coder_1getFlag2(JNIEnv *je
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -25455,18 +32526,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlags(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setFlags(arg2);
+      result = (int32_t)(arg1)->getFlags();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -25474,20 +32545,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlags(JNIEnv *je
     
     /*@SWIG@*/
   }
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jboolean jarg3) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Coder::Flag arg2 ;
-  bool arg3 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (io::humble::video::Coder::Flag)jarg2; 
-  arg3 = jarg3 ? true : false; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25501,7 +32572,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlag(JNIEnv *jen
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setFlag(arg2,arg3);
+      (arg1)->setFlags(arg2);
     }
     catch(std::exception & e)
     {
@@ -25523,20 +32594,22 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlag(JNIEnv *jen
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlags2(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jboolean jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::Container::Flag arg2 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (io::humble::video::Container::Flag)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -25545,18 +32618,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlags2(JNIEnv *j
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setFlags2(arg2);
+      result = (bool)(arg1)->getFlag(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -25564,19 +32637,21 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlags2(JNIEnv *j
     
     /*@SWIG@*/
   }
+  jresult = (jboolean)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlag2(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jboolean jarg3) {
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Coder::Flag2 arg2 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jboolean jarg3) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::Container::Flag arg2 ;
   bool arg3 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
-  arg2 = (io::humble::video::Coder::Flag2)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (io::humble::video::Container::Flag)jarg2; 
   arg3 = jarg3 ? true : false; 
   
   if (!arg1) {
@@ -25591,7 +32666,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlag2(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setFlag2(arg2,arg3);
+      (arg1)->setFlag(arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -25613,231 +32688,15 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Coder_1setFlag2(JNIEnv *je
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1INVALID_1FLAG_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::INVALID_FLAG;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1FILE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_FILE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NEED_1NUMBER_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NEED_NUMBER;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1SHOW_1IDS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::SHOW_IDS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1RAW_1PICTURE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::RAW_PICTURE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1GLOBAL_1HEADER_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::GLOBAL_HEADER;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1TIMESTAMPS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_TIMESTAMPS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1GENERIC_1INDEX_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::GENERIC_INDEX;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1TIMESTAMP_1DISCONTINUITIES_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::TIMESTAMP_DISCONTINUITIES;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1VARIABLE_1FPS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::VARIABLE_FPS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1DIMENSIONS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_DIMENSIONS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1STREAMS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_STREAMS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1BINARY_1SEARCH_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_BINARY_SEARCH;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1GENERIC_1SEARCH_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_GENERIC_SEARCH;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NO_1BYTE_1SEEKING_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NO_BYTE_SEEKING;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1ALLOW_1FLUSH_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::ALLOW_FLUSH;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1NONSTRICT_1TIMESTAMPS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::NONSTRICT_TIMESTAMPS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1SEEK_1TO_1PTS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerFormat::Flag)io::humble::video::ContainerFormat::SEEK_TO_PTS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getURL(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jstring jresult = 0 ;
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
   char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25851,7 +32710,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getNam
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      result = (char *)(arg1)->getURL();
     }
     catch(std::exception & e)
     {
@@ -25875,15 +32734,15 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getNam
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getReadRetryCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -25897,7 +32756,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getLon
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getLongName();
+      result = (int32_t)(arg1)->getReadRetryCount();
     }
     catch(std::exception & e)
     {
@@ -25916,25 +32775,25 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getLon
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getExtensions(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setReadRetryCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -25943,18 +32802,18 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getExt
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getExtensions();
+      (arg1)->setReadRetryCount(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -25962,25 +32821,27 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getExt
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
-  int32_t result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setReadAhead(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3, jlong jarg4) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t arg2 ;
+  int32_t arg3 ;
+  int64_t arg4 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int64_t)jarg4; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -25989,18 +32850,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getFlags(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlags();
+      (arg1)->setReadAhead(arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -26008,22 +32869,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getFlags(
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1isReadAhead(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jboolean jresult = 0 ;
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
-  io::humble::video::ContainerFormat::Flag arg2 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
   bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
-  arg2 = (io::humble::video::ContainerFormat::Flag)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26037,7 +32894,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getFl
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->getFlag(arg2);
+      result = (bool)(arg1)->isReadAhead();
     }
     catch(std::exception & e)
     {
@@ -26061,21 +32918,12 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getFl
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getNumSupportedCodecs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
-  int32_t result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setProbeCacheSize(JNIEnv *jenv, jclass jcls, jint jarg1) {
+  int32_t arg1 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
+  arg1 = (int32_t)jarg1; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -26083,18 +32931,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getNumSup
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedCodecs();
+      io::humble::video::Demuxer::setProbeCacheSize(arg1);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -26102,28 +32950,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getNumSup
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getSupportedCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getProbeCacheSize(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::Codec::ID result;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -26131,7 +32966,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getSuppor
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getSupportedCodecId(arg2);
+      result = (int32_t)io::humble::video::Demuxer::getProbeCacheSize();
     }
     catch(std::exception & e)
     {
@@ -26155,22 +32990,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getSuppor
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getSupportedCodecTag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
-  int32_t arg2 ;
-  uint32_t result;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1loadProbeCache(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jint jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
   }
   
   {
@@ -26179,7 +33009,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getSuppo
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (uint32_t)(arg1)->getSupportedCodecTag(arg2);
+      result = (int32_t)io::humble::video::Demuxer::loadProbeCache((char const *)arg1);
     }
     catch(std::exception & e)
     {
@@ -26198,22 +33028,21 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerFormat_1getSuppo
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  jresult = (jint)result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_delete_1ContainerFormat(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  io::humble::video::ContainerFormat *arg1 = (io::humble::video::ContainerFormat *) 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1saveProbeCache(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  char *arg1 = (char *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(io::humble::video::ContainerFormat **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return ;
   }
   
   {
@@ -26222,7 +33051,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_delete_1ContainerFormat(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      delete arg1;
+      io::humble::video::Demuxer::saveProbeCache((char const *)arg1);
     }
     catch(std::exception & e)
     {
@@ -26241,18 +33070,19 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_delete_1ContainerFormat(JN
     
     /*@SWIG@*/
   }
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1canStreamsBeAddedDynamically(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26266,7 +33096,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getName(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      result = (bool)(arg1)->canStreamsBeAddedDynamically();
     }
     catch(std::exception & e)
     {
@@ -26285,20 +33115,20 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getName(JN
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getMetaData(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::KeyValueBag *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26312,7 +33142,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getLongNam
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getLongName();
+      result = (io::humble::video::KeyValueBag *)(arg1)->getMetaData();
     }
     catch(std::exception & e)
     {
@@ -26331,20 +33161,22 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getLongNam
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  *(io::humble::video::KeyValueBag **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getExtensions(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedAudioCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::Codec::ID arg2 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (io::humble::video::Codec::ID)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26358,7 +33190,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getExtensi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getExtensions();
+      result = (int32_t)(arg1)->setForcedAudioCodec(arg2);
     }
     catch(std::exception & e)
     {
@@ -26377,20 +33209,22 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getExtensi
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedVideoCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::Codec::ID arg2 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (io::humble::video::Codec::ID)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26404,7 +33238,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getFlags(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlags();
+      result = (int32_t)(arg1)->setForcedVideoCodec(arg2);
     }
     catch(std::exception & e)
     {
@@ -26428,15 +33262,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getFlags(JNIE
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultAudioCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedSubtitleCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  io::humble::video::Codec::ID result;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::Codec::ID arg2 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (io::humble::video::Codec::ID)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26450,7 +33286,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultAud
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getDefaultAudioCodecId();
+      result = (int32_t)(arg1)->setForcedSubtitleCodec(arg2);
     }
     catch(std::exception & e)
     {
@@ -26474,15 +33310,73 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultAud
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultVideoCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1SEEK_1BACKWARD_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  io::humble::video::Codec::ID result;
+  io::humble::video::Demuxer::SeekFlag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Demuxer::SeekFlag)io::humble::video::Demuxer::SEEK_BACKWARD;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1SEEK_1BYTE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer::SeekFlag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Demuxer::SeekFlag)io::humble::video::Demuxer::SEEK_BYTE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1SEEK_1ANY_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer::SeekFlag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Demuxer::SeekFlag)io::humble::video::Demuxer::SEEK_ANY;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1SEEK_1FRAME_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer::SeekFlag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::Demuxer::SeekFlag)io::humble::video::Demuxer::SEEK_FRAME;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1seek(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jlong jarg3, jlong jarg4, jlong jarg5, jint jarg6) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t arg2 ;
+  int64_t arg3 ;
+  int64_t arg4 ;
+  int64_t arg5 ;
+  int32_t arg6 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (int64_t)jarg3; 
+  arg4 = (int64_t)jarg4; 
+  arg5 = (int64_t)jarg5; 
+  arg6 = (int32_t)jarg6; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26496,7 +33390,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultVid
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getDefaultVideoCodecId();
+      result = (int32_t)(arg1)->seek(arg2,arg3,arg4,arg5,arg6);
     }
     catch(std::exception & e)
     {
@@ -26520,15 +33414,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultVid
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultSubtitleCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1buildSeekIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  io::humble::video::Codec::ID result;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26542,7 +33436,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultSub
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getDefaultSubtitleCodecId();
+      result = (int32_t)(arg1)->buildSeekIndex();
     }
     catch(std::exception & e)
     {
@@ -26566,20 +33460,24 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getDefaultSub
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getMimeType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1saveSeekIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  char *arg2 = (char *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return ;
+  }
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -26588,18 +33486,18 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getMimeTyp
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getMimeType();
+      (arg1)->saveSeekIndex((char const *)arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -26607,42 +33505,39 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getMimeTyp
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  return jresult;
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1guessFormat(JNIEnv *jenv, jclass jcls, jstring jarg1, jstring jarg2, jstring jarg3) {
-  jlong jresult = 0 ;
-  char *arg1 = (char *) 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1loadSeekIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
   char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
-  io::humble::video::MuxerFormat *result = 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = 0;
-  if (jarg1) {
-    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
-    if (!arg1) return 0;
-  }
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   arg2 = 0;
   if (jarg2) {
     arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
     if (!arg2) return 0;
   }
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return 0;
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
   }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MuxerFormat *)io::humble::video::MuxerFormat::guessFormat((char const *)arg1,(char const *)arg2,(char const *)arg3);
+      result = (int32_t)(arg1)->loadSeekIndex((char const *)arg2);
     }
     catch(std::exception & e)
     {
@@ -26661,43 +33556,21 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1guessFormat(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::MuxerFormat **)&jresult = result; 
-  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  jresult = (jint)result; 
   if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1guessCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jstring jarg4, jint jarg5) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getMaxDelay(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
-  char *arg4 = (char *) 0 ;
-  io::humble::video::MediaDescriptor::Type arg5 ;
-  io::humble::video::Codec::ID result;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return 0;
-  }
-  arg4 = 0;
-  if (jarg4) {
-    arg4 = (char *)jenv->GetStringUTFChars(jarg4, 0);
-    if (!arg4) return 0;
-  }
-  arg5 = (io::humble::video::MediaDescriptor::Type)jarg5; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26711,7 +33584,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1guessCodec(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->guessCodec((char const *)arg2,(char const *)arg3,(char const *)arg4,arg5);
+      result = (int32_t)(arg1)->getMaxDelay();
     }
     catch(std::exception & e)
     {
@@ -26731,27 +33604,22 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1guessCodec(JN
     /*@SWIG@*/
   }
   jresult = (jint)result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
-  if (arg4) jenv->ReleaseStringUTFChars(jarg4, (const char *)arg4);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getNumSupportedCodecs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  int32_t result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1play(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -26760,18 +33628,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getNumSupport
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedCodecs();
+      (arg1)->play();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -26779,27 +33647,21 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getNumSupport
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getBestCodecTag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jlong jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  io::humble::video::Codec::ID arg2 ;
-  uint32_t result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1pause(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
-  arg2 = (io::humble::video::Codec::ID)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -26808,18 +33670,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getBestCodec
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (uint32_t)(arg1)->getBestCodecTag(arg2);
+      (arg1)->pause();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -26827,22 +33689,24 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getBestCodec
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getSupportedCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1java_1readBatch(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlongArray jarg2, jint jarg3, jlong jarg4) {
   jint jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::Codec::ID result;
+  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  jlongArray arg2 ;
+  int32_t arg3 ;
+  int64_t arg4 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg2 = jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int64_t)jarg4; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26856,7 +33720,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getSupportedC
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getSupportedCodecId(arg2);
+      result = (int32_t)io_humble_video_Demuxer_java_readBatch(arg1,arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
@@ -26880,17 +33744,99 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getSupportedC
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getSupportedCodecTag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jlong jresult = 0 ;
-  io::humble::video::MuxerFormat *arg1 = (io::humble::video::MuxerFormat *) 0 ;
-  int32_t arg2 ;
-  uint32_t result;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1UNKNOWN_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_UNKNOWN;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1DYNAMIC_1INPUTS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_DYNAMIC_INPUTS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1DYNAMIC_1OUTPUTS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_DYNAMIC_OUTPUTS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1SLICE_1THREADS_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_SLICE_THREADS;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1SUPPORT_1TIMELINE_1GENERIC_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_SUPPORT_TIMELINE_GENERIC;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1SUPPORT_1TIMELINE_1INTERNAL_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_SUPPORT_TIMELINE_INTERNAL;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1SUPPORT_1TIMELINE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType::Flag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_SUPPORT_TIMELINE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerFormat **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -26904,7 +33850,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getSupported
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (uint32_t)(arg1)->getSupportedCodecTag(arg2);
+      result = (char *)(arg1)->getName();
     }
     catch(std::exception & e)
     {
@@ -26923,24 +33869,34 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getSupported
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getNumFormats(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  int32_t result;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getDescription(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)io::humble::video::MuxerFormat::getNumFormats();
+      result = (char *)(arg1)->getDescription();
     }
     catch(std::exception & e)
     {
@@ -26959,26 +33915,34 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getNumFormats
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getFormat(JNIEnv *jenv, jclass jcls, jint jarg1) {
-  jlong jresult = 0 ;
-  int32_t arg1 ;
-  io::humble::video::MuxerFormat *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
+  int result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (int32_t)jarg1; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MuxerFormat *)io::humble::video::MuxerFormat::getFormat(arg1);
+      result = (int)(arg1)->getFlags();
     }
     catch(std::exception & e)
     {
@@ -26997,20 +33961,22 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerFormat_1getFormat(JN
     
     /*@SWIG@*/
   }
-  *(io::humble::video::MuxerFormat **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jboolean jresult = 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
+  io::humble::video::FilterType::Flag arg2 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
+  arg2 = (io::humble::video::FilterType::Flag)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27024,7 +33990,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getName(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      result = (bool)(arg1)->getFlag(arg2);
     }
     catch(std::exception & e)
     {
@@ -27043,20 +34009,20 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getName(
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getLongName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumInputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27070,7 +34036,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getLongN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getLongName();
+      result = (int32_t)(arg1)->getNumInputs();
     }
     catch(std::exception & e)
     {
@@ -27089,20 +34055,22 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getLongN
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getExtensions(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getInputName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jstring jresult = 0 ;
-  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
+  int32_t arg2 ;
   char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27116,7 +34084,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getExten
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getExtensions();
+      result = (char *)(arg1)->getInputName(arg2);
     }
     catch(std::exception & e)
     {
@@ -27140,15 +34108,17 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getExten
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getInputType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
-  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
-  int32_t result;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::MediaDescriptor::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27162,7 +34132,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getFlags(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlags();
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getInputType(arg2);
     }
     catch(std::exception & e)
     {
@@ -27186,15 +34156,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getFlags(JN
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getNumSupportedCodecs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumOutputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27208,7 +34178,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getNumSuppo
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSupportedCodecs();
+      result = (int32_t)(arg1)->getNumOutputs();
     }
     catch(std::exception & e)
     {
@@ -27232,16 +34202,16 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getNumSuppo
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getSupportedCodecId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getOutputName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jstring jresult = 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
   int32_t arg2 ;
-  io::humble::video::Codec::ID result;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
   arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
@@ -27256,7 +34226,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getSupporte
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Codec::ID)(arg1)->getSupportedCodecId(arg2);
+      result = (char *)(arg1)->getOutputName(arg2);
     }
     catch(std::exception & e)
     {
@@ -27275,21 +34245,21 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getSupporte
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getSupportedCodecTag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jlong jresult = 0 ;
-  io::humble::video::DemuxerFormat *arg1 = (io::humble::video::DemuxerFormat *) 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getOutputType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
   int32_t arg2 ;
-  uint32_t result;
+  io::humble::video::MediaDescriptor::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerFormat **)&jarg1; 
+  arg1 = *(io::humble::video::FilterType **)&jarg1; 
   arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
@@ -27304,7 +34274,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getSupport
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (uint32_t)(arg1)->getSupportedCodecTag(arg2);
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getOutputType(arg2);
     }
     catch(std::exception & e)
     {
@@ -27323,15 +34293,15 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getSupport
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1findFormat(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterType_1findFilterType(JNIEnv *jenv, jclass jcls, jstring jarg1) {
   jlong jresult = 0 ;
   char *arg1 = (char *) 0 ;
-  io::humble::video::DemuxerFormat *result = 0 ;
+  io::humble::video::FilterType *result = 0 ;
   
   (void)jenv;
   (void)jcls;
@@ -27346,7 +34316,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1findFormat
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::DemuxerFormat *)io::humble::video::DemuxerFormat::findFormat((char const *)arg1);
+      result = (io::humble::video::FilterType *)io::humble::video::FilterType::findFilterType((char const *)arg1);
     }
     catch(std::exception & e)
     {
@@ -27365,13 +34335,13 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1findFormat
     
     /*@SWIG@*/
   }
-  *(io::humble::video::DemuxerFormat **)&jresult = result; 
+  *(io::humble::video::FilterType **)&jresult = result; 
   if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getNumFormats(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumFilterTypes(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
   int32_t result;
   
@@ -27383,7 +34353,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getNumForma
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)io::humble::video::DemuxerFormat::getNumFormats();
+      result = (int32_t)io::humble::video::FilterType::getNumFilterTypes();
     }
     catch(std::exception & e)
     {
@@ -27407,10 +34377,10 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getNumForma
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getFormat(JNIEnv *jenv, jclass jcls, jint jarg1) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFilterType(JNIEnv *jenv, jclass jcls, jint jarg1) {
   jlong jresult = 0 ;
   int32_t arg1 ;
-  io::humble::video::DemuxerFormat *result = 0 ;
+  io::humble::video::FilterType *result = 0 ;
   
   (void)jenv;
   (void)jcls;
@@ -27421,7 +34391,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getFormat(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::DemuxerFormat *)io::humble::video::DemuxerFormat::getFormat(arg1);
+      result = (io::humble::video::FilterType *)io::humble::video::FilterType::getFilterType(arg1);
     }
     catch(std::exception & e)
     {
@@ -27440,46 +34410,48 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerFormat_1getFormat(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::DemuxerFormat **)&jresult = result; 
+  *(io::humble::video::FilterType **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1INDEX_1FLAG_1KEYFRAME_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1AUTO_1CONVERT_1ALL_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  int result;
+  io::humble::video::FilterGraph::AutoConvertFlag result;
   
   (void)jenv;
   (void)jcls;
-  result = (int)io::humble::video::IndexEntry::INDEX_FLAG_KEYFRAME;
+  result = (io::humble::video::FilterGraph::AutoConvertFlag)io::humble::video::FilterGraph::AUTO_CONVERT_ALL;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1make(JNIEnv *jenv, jclass jcls, jlong jarg1, jlong jarg2, jint jarg3, jint jarg4, jint jarg5) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1AUTO_1CONVERT_1NONE_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  io::humble::video::FilterGraph::AutoConvertFlag result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (io::humble::video::FilterGraph::AutoConvertFlag)io::humble::video::FilterGraph::AUTO_CONVERT_NONE;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1make(JNIEnv *jenv, jclass jcls) {
   jlong jresult = 0 ;
-  int64_t arg1 ;
-  int64_t arg2 ;
-  int32_t arg3 ;
-  int32_t arg4 ;
-  int32_t arg5 ;
-  io::humble::video::IndexEntry *result = 0 ;
+  io::humble::video::FilterGraph *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (int64_t)jarg1; 
-  arg2 = (int64_t)jarg2; 
-  arg3 = (int32_t)jarg3; 
-  arg4 = (int32_t)jarg4; 
-  arg5 = (int32_t)jarg5; 
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::IndexEntry *)io::humble::video::IndexEntry::make(arg1,arg2,arg3,arg4,arg5);
+      result = (io::humble::video::FilterGraph *)io::humble::video::FilterGraph::make();
     }
     catch(std::exception & e)
     {
@@ -27498,20 +34470,29 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1make(JNIEnv *
     
     /*@SWIG@*/
   }
-  *(io::humble::video::IndexEntry **)&jresult = result; 
+  *(io::humble::video::FilterGraph **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getPosition(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jstring jarg3) {
   jlong jresult = 0 ;
-  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
-  int64_t result;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  io::humble::video::FilterType *arg2 = (io::humble::video::FilterType *) 0 ;
+  char *arg3 = (char *) 0 ;
+  io::humble::video::Filter *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = *(io::humble::video::FilterType **)&jarg2; 
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return 0;
+  }
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27525,7 +34506,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getPosition(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getPosition();
+      result = (io::humble::video::Filter *)(arg1)->addFilter(arg2,(char const *)arg3);
     }
     catch(std::exception & e)
     {
@@ -27544,20 +34525,27 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getPosition(J
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  *(io::humble::video::Filter **)&jresult = result; 
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getTimeStamp(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
   jlong jresult = 0 ;
-  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
-  int64_t result;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  io::humble::video::Filter *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27571,7 +34559,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getTimeStamp(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getTimeStamp();
+      result = (io::humble::video::Filter *)(arg1)->getFilter((char const *)arg2);
     }
     catch(std::exception & e)
     {
@@ -27590,20 +34578,36 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getTimeStamp(
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  *(io::humble::video::Filter **)&jresult = result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addAudioSource(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jint jarg3, jint jarg4, jint jarg5, jlong jarg6, jobject jarg6_) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int32_t arg3 ;
+  io::humble::video::AudioChannel::Layout arg4 ;
+  io::humble::video::AudioFormat::Type arg5 ;
+  io::humble::video::Rational *arg6 = (io::humble::video::Rational *) 0 ;
+  io::humble::video::FilterAudioSource *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
+  (void)jarg6_;
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  arg3 = (int32_t)jarg3; 
+  arg4 = (io::humble::video::AudioChannel::Layout)jarg4; 
+  arg5 = (io::humble::video::AudioFormat::Type)jarg5; 
+  arg6 = *(io::humble::video::Rational **)&jarg6; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27617,7 +34621,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getFlags(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlags();
+      result = (io::humble::video::FilterAudioSource *)(arg1)->addAudioSource((char const *)arg2,arg3,arg4,arg5,arg6);
     }
     catch(std::exception & e)
     {
@@ -27636,20 +34640,39 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getFlags(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::FilterAudioSource **)&jresult = result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addPictureSource(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jint jarg3, jint jarg4, jint jarg5, jlong jarg6, jobject jarg6_, jlong jarg7, jobject jarg7_) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int32_t arg3 ;
+  int32_t arg4 ;
+  io::humble::video::PixelFormat::Type arg5 ;
+  io::humble::video::Rational *arg6 = (io::humble::video::Rational *) 0 ;
+  io::humble::video::Rational *arg7 = (io::humble::video::Rational *) 0 ;
+  io::humble::video::FilterPictureSource *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
+  (void)jarg6_;
+  (void)jarg7_;
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int32_t)jarg4; 
+  arg5 = (io::humble::video::PixelFormat::Type)jarg5; 
+  arg6 = *(io::humble::video::Rational **)&jarg6; 
+  arg7 = *(io::humble::video::Rational **)&jarg7; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27663,7 +34686,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getSize(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getSize();
+      result = (io::humble::video::FilterPictureSource *)(arg1)->addPictureSource((char const *)arg2,arg3,arg4,arg5,arg6,arg7);
     }
     catch(std::exception & e)
     {
@@ -27682,20 +34705,33 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getSize(JNIEnv
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::FilterPictureSource **)&jresult = result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getMinDistance(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addAudioSink(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jint jarg3, jint jarg4, jint jarg5) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int32_t arg3 ;
+  io::humble::video::AudioChannel::Layout arg4 ;
+  io::humble::video::AudioFormat::Type arg5 ;
+  io::humble::video::FilterAudioSink *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  arg3 = (int32_t)jarg3; 
+  arg4 = (io::humble::video::AudioChannel::Layout)jarg4; 
+  arg5 = (io::humble::video::AudioFormat::Type)jarg5; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27709,7 +34745,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getMinDistance
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getMinDistance();
+      result = (io::humble::video::FilterAudioSink *)(arg1)->addAudioSink((char const *)arg2,arg3,arg4,arg5);
     }
     catch(std::exception & e)
     {
@@ -27728,20 +34764,29 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1getMinDistance
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::FilterAudioSink **)&jresult = result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1isKeyFrame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jboolean jresult = 0 ;
-  io::humble::video::IndexEntry *arg1 = (io::humble::video::IndexEntry *) 0 ;
-  bool result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addPictureSink(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jint jarg3) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  io::humble::video::PixelFormat::Type arg3 ;
+  io::humble::video::FilterPictureSink *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::IndexEntry **)&jarg1; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  arg3 = (io::humble::video::PixelFormat::Type)jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27755,7 +34800,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1isKeyFrame
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->isKeyFrame();
+      result = (io::humble::video::FilterPictureSink *)(arg1)->addPictureSink((char const *)arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -27774,66 +34819,35 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_IndexEntry_1isKeyFrame
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  *(io::humble::video::FilterPictureSink **)&jresult = result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Decoder_1make_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  io::humble::video::Decoder *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getNumSources(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      result = (io::humble::video::Decoder *)io::humble::video::Decoder::make(arg1);
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return 0;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
   }
-  *(io::humble::video::Decoder **)&jresult = result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Decoder_1make_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Decoder *result = 0 ;
   
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Decoder *)io::humble::video::Decoder::make(arg1);
+      result = (int32_t)(arg1)->getNumSources();
     }
     catch(std::exception & e)
     {
@@ -27852,23 +34866,27 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Decoder_1make_1_1SWIG_11(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Decoder **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Decoder_1flush(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  io::humble::video::Decoder *arg1 = (io::humble::video::Decoder *) 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSource_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::FilterSource *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Decoder **)&jarg1; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -27877,18 +34895,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Decoder_1flush(JNIEnv *jen
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->flush();
+      result = (io::humble::video::FilterSource *)(arg1)->getSource(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -27896,26 +34914,26 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Decoder_1flush(JNIEnv *jen
     
     /*@SWIG@*/
   }
+  *(io::humble::video::FilterSource **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decodeAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_, jint jarg4) {
-  jint jresult = 0 ;
-  io::humble::video::Decoder *arg1 = (io::humble::video::Decoder *) 0 ;
-  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
-  io::humble::video::MediaPacket *arg3 = (io::humble::video::MediaPacket *) 0 ;
-  int32_t arg4 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSource_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  io::humble::video::FilterSource *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Decoder **)&jarg1; 
-  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
-  arg3 = *(io::humble::video::MediaPacket **)&jarg3; 
-  arg4 = (int32_t)jarg4; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27929,7 +34947,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decodeAudio(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->decodeAudio(arg2,arg3,arg4);
+      result = (io::humble::video::FilterSource *)(arg1)->getSource((char const *)arg2);
     }
     catch(std::exception & e)
     {
@@ -27948,28 +34966,21 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decodeAudio(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::FilterSource **)&jresult = result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decodeVideo(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_, jint jarg4) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getNumSinks(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Decoder *arg1 = (io::humble::video::Decoder *) 0 ;
-  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
-  io::humble::video::MediaPacket *arg3 = (io::humble::video::MediaPacket *) 0 ;
-  int32_t arg4 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Decoder **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
-  arg3 = *(io::humble::video::MediaPacket **)&jarg3; 
-  arg4 = (int32_t)jarg4; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -27983,7 +34994,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decodeVideo(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->decodeVideo(arg2,arg3,arg4);
+      result = (int32_t)(arg1)->getNumSinks();
     }
     catch(std::exception & e)
     {
@@ -28007,23 +35018,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decodeVideo(JNIEn
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_, jint jarg4) {
-  jint jresult = 0 ;
-  io::humble::video::Decoder *arg1 = (io::humble::video::Decoder *) 0 ;
-  io::humble::video::MediaSampled *arg2 = (io::humble::video::MediaSampled *) 0 ;
-  io::humble::video::MediaPacket *arg3 = (io::humble::video::MediaPacket *) 0 ;
-  int32_t arg4 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSink_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::FilterSink *result = 0 ;
   
   (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Decoder **)&jarg1; 
-  arg2 = *(io::humble::video::MediaSampled **)&jarg2; 
-  arg3 = *(io::humble::video::MediaPacket **)&jarg3; 
-  arg4 = (int32_t)jarg4; 
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28037,7 +35042,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decode(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->decode(arg2,arg3,arg4);
+      result = (io::humble::video::FilterSink *)(arg1)->getSink(arg2);
     }
     catch(std::exception & e)
     {
@@ -28056,20 +35061,26 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Decoder_1decode(JNIEnv *je
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::FilterSink **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1getNumDroppedFrames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSink_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
   jlong jresult = 0 ;
-  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
-  int64_t result;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  io::humble::video::FilterSink *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Encoder **)&jarg1; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28083,7 +35094,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1getNumDroppedFra
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getNumDroppedFrames();
+      result = (io::humble::video::FilterSink *)(arg1)->getSink((char const *)arg2);
     }
     catch(std::exception & e)
     {
@@ -28102,38 +35113,46 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1getNumDroppedFra
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  *(io::humble::video::FilterSink **)&jresult = result; 
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1make_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Codec *arg1 = (io::humble::video::Codec *) 0 ;
-  io::humble::video::Encoder *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1setAutoConvert(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  io::humble::video::FilterGraph::AutoConvertFlag arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Codec **)&jarg1; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = (io::humble::video::FilterGraph::AutoConvertFlag)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Encoder *)io::humble::video::Encoder::make(arg1);
+      (arg1)->setAutoConvert(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -28141,27 +35160,32 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1make_1_1SWIG_10(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Encoder **)&jresult = result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1make_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Coder *arg1 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::Encoder *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getAutoConvert(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  io::humble::video::FilterGraph::AutoConvertFlag result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Coder **)&jarg1; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Encoder *)io::humble::video::Encoder::make(arg1);
+      result = (io::humble::video::FilterGraph::AutoConvertFlag)(arg1)->getAutoConvert();
     }
     catch(std::exception & e)
     {
@@ -28180,24 +35204,24 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Encoder_1make_1_1SWIG_11(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Encoder **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
-  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
-  io::humble::video::KeyValueBag *arg2 = (io::humble::video::KeyValueBag *) 0 ;
-  io::humble::video::KeyValueBag *arg3 = (io::humble::video::KeyValueBag *) 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Encoder **)&jarg1; 
-  arg2 = *(io::humble::video::KeyValueBag **)&jarg2; 
-  arg3 = *(io::humble::video::KeyValueBag **)&jarg3; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return ;
+  }
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28211,7 +35235,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1open(JNIEnv *jenv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->open(arg2,arg3);
+      (arg1)->open((char const *)arg2);
     }
     catch(std::exception & e)
     {
@@ -28230,27 +35254,44 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1open(JNIEnv *jenv
     
     /*@SWIG@*/
   }
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encodeVideo(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
-  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
-  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
-  io::humble::video::MediaPicture *arg3 = (io::humble::video::MediaPicture *) 0 ;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1sendCommand(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jstring jarg4, jint jarg5) {
+  jstring jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  int arg5 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Encoder **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
-  arg3 = *(io::humble::video::MediaPicture **)&jarg3; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return 0;
+  }
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return 0;
+  }
+  arg4 = 0;
+  if (jarg4) {
+    arg4 = (char *)jenv->GetStringUTFChars(jarg4, 0);
+    if (!arg4) return 0;
+  }
+  arg5 = (int)jarg5; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -28259,18 +35300,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encodeVideo(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->encodeVideo(arg2,arg3);
+      result = (char *)(arg1)->sendCommand((char const *)arg2,(char const *)arg3,(char const *)arg4,arg5);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -28278,22 +35319,44 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encodeVideo(JNIEn
     
     /*@SWIG@*/
   }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  if (arg4) jenv->ReleaseStringUTFChars(jarg4, (const char *)arg4);
+  FilterGraph::freeString(result);
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encodeAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
-  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
-  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
-  io::humble::video::MediaAudio *arg3 = (io::humble::video::MediaAudio *) 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1queueCommand(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jstring jarg4, jint jarg5, jdouble jarg6) {
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *arg2 = (char *) 0 ;
+  char *arg3 = (char *) 0 ;
+  char *arg4 = (char *) 0 ;
+  int arg5 ;
+  double arg6 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Encoder **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
-  arg3 = *(io::humble::video::MediaAudio **)&jarg3; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg2 = 0;
+  if (jarg2) {
+    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
+    if (!arg2) return ;
+  }
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return ;
+  }
+  arg4 = 0;
+  if (jarg4) {
+    arg4 = (char *)jenv->GetStringUTFChars(jarg4, 0);
+    if (!arg4) return ;
+  }
+  arg5 = (int)jarg5; 
+  arg6 = (double)jarg6; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28307,7 +35370,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encodeAudio(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->encodeAudio(arg2,arg3);
+      (arg1)->queueCommand((char const *)arg2,(char const *)arg3,(char const *)arg4,arg5,arg6);
     }
     catch(std::exception & e)
     {
@@ -28326,27 +35389,26 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encodeAudio(JNIEn
     
     /*@SWIG@*/
   }
+  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  if (arg4) jenv->ReleaseStringUTFChars(jarg4, (const char *)arg4);
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
-  io::humble::video::Encoder *arg1 = (io::humble::video::Encoder *) 0 ;
-  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
-  io::humble::video::MediaSampled *arg3 = (io::humble::video::MediaSampled *) 0 ;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getDisplayString(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Encoder **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
-  arg3 = *(io::humble::video::MediaSampled **)&jarg3; 
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -28355,18 +35417,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encode(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->encode(arg2,arg3);
+      result = (char *)(arg1)->getDisplayString();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -28374,234 +35436,185 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Encoder_1encode(JNIEnv *je
     
     /*@SWIG@*/
   }
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1NONE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_NONE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1DEFAULT_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_DEFAULT;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1DUB_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_DUB;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1ORIGINAL_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_ORIGINAL;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1COMMENT_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_COMMENT;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1LYRICS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_LYRICS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1KARAOKE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_KARAOKE;
-  jresult = (jint)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  FilterGraph::freeString(result);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1FORCED_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
+  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  io::humble::video::FilterGraph::State result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_FORCED;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1HEARING_1IMPAIRED_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_HEARING_IMPAIRED;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1VISUAL_1IMPAIRED_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_VISUAL_IMPAIRED;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::FilterGraph::State)(arg1)->getState();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1CLEAN_1EFFECTS_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1COMMAND_1FLAG_1ONE_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
+  io::humble::video::Filter::CommandFlag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_CLEAN_EFFECTS;
+  result = (io::humble::video::Filter::CommandFlag)io::humble::video::Filter::COMMAND_FLAG_ONE;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1DISPOSITION_1ATTACHED_1PIC_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1COMMAND_1FLAG_1FAST_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::ContainerStream::Disposition result;
+  io::humble::video::Filter::CommandFlag result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::ContainerStream::Disposition)io::humble::video::ContainerStream::DISPOSITION_ATTACHED_PIC;
+  result = (io::humble::video::Filter::CommandFlag)io::humble::video::Filter::COMMAND_FLAG_FAST;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1NONE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::ParseType result;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_NONE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1FULL_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::ParseType result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_FULL;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1HEADERS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::ParseType result;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_HEADERS;
-  jresult = (jint)result; 
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (char *)(arg1)->getName();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1TIMESTAMPS_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getNumInputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::ContainerStream::ParseType result;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_TIMESTAMPS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1FULL_1ONCE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::ParseType result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_FULL_ONCE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1PARSE_1FULL_1RAW_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream::ParseType result;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::ContainerStream::ParseType)io::humble::video::ContainerStream::PARSE_FULL_RAW;
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int32_t)(arg1)->getNumInputs();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int32_t result;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jstring jresult = 0 ;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  int32_t arg2 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28615,7 +35628,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getIndex(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getIndex();
+      result = (char *)(arg1)->getInputName(arg2);
     }
     catch(std::exception & e)
     {
@@ -28634,20 +35647,22 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getIndex(
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getId(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jint jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int32_t result;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::MediaDescriptor::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28661,7 +35676,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getId(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getId();
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getInputType(arg2);
     }
     catch(std::exception & e)
     {
@@ -28685,15 +35700,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getId(JNI
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getFrameRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputLink(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::Rational *result = 0 ;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::FilterLink *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28707,7 +35724,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getFrame
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Rational *)(arg1)->getFrameRate();
+      result = (io::humble::video::FilterLink *)(arg1)->getInputLink(arg2);
     }
     catch(std::exception & e)
     {
@@ -28726,20 +35743,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getFrame
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Rational **)&jresult = result; 
+  *(io::humble::video::FilterLink **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::Rational *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getNumOutputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28753,7 +35770,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getTimeB
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Rational *)(arg1)->getTimeBase();
+      result = (int32_t)(arg1)->getNumOutputs();
     }
     catch(std::exception & e)
     {
@@ -28772,20 +35789,22 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getTimeB
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Rational **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getStartTime(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int64_t result;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jstring jresult = 0 ;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  int32_t arg2 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28799,7 +35818,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getStart
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getStartTime();
+      result = (char *)(arg1)->getOutputName(arg2);
     }
     catch(std::exception & e)
     {
@@ -28818,20 +35837,22 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getStart
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getDuration(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int64_t result;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::MediaDescriptor::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28845,7 +35866,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getDurat
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getDuration();
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getOutputType(arg2);
     }
     catch(std::exception & e)
     {
@@ -28864,20 +35885,22 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getDurat
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getCurrentDts(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputLink(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int64_t result;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::FilterLink *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28891,7 +35914,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getCurre
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getCurrentDts();
+      result = (io::humble::video::FilterLink *)(arg1)->getOutputLink(arg2);
     }
     catch(std::exception & e)
     {
@@ -28910,20 +35933,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getCurre
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  *(io::humble::video::FilterLink **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getNumIndexEntries(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getGraph(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  io::humble::video::FilterGraph *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::Filter **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28937,7 +35960,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getNumInd
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int)(arg1)->getNumIndexEntries();
+      result = (io::humble::video::FilterGraph *)(arg1)->getGraph();
     }
     catch(std::exception & e)
     {
@@ -28956,20 +35979,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getNumInd
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::FilterGraph **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getNumFrames(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getFilterGraph(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int64_t result;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::FilterGraph *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -28983,7 +36006,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getNumFr
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getNumFrames();
+      result = (io::humble::video::FilterGraph *)(arg1)->getFilterGraph();
     }
     catch(std::exception & e)
     {
@@ -29002,20 +36025,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getNumFr
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  *(io::humble::video::FilterGraph **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getSampleAspectRatio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::Rational *result = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::Filter *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29029,7 +36052,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getSampl
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Rational *)(arg1)->getSampleAspectRatio();
+      result = (io::humble::video::Filter *)(arg1)->getInputFilter();
     }
     catch(std::exception & e)
     {
@@ -29048,20 +36071,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getSampl
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Rational **)&jresult = result; 
+  *(io::humble::video::Filter **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getContainer(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::Container *result = 0 ;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputPadName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29075,7 +36098,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getConta
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Container *)(arg1)->getContainer();
+      result = (char *)(arg1)->getInputPadName();
     }
     catch(std::exception & e)
     {
@@ -29094,20 +36117,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getConta
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Container **)&jresult = result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getParseType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputPadType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::ContainerStream::ParseType result;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::MediaDescriptor::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29121,7 +36144,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getParseT
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::ContainerStream::ParseType)(arg1)->getParseType();
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getInputPadType();
     }
     catch(std::exception & e)
     {
@@ -29145,20 +36168,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getParseT
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1setParseType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::ContainerStream::ParseType arg2 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::Filter *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
-  arg2 = (io::humble::video::ContainerStream::ParseType)jarg2; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -29167,18 +36190,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1setParseT
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setParseType(arg2);
+      result = (io::humble::video::Filter *)(arg1)->getOutputFilter();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -29186,18 +36209,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1setParseT
     
     /*@SWIG@*/
   }
+  *(io::humble::video::Filter **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getMetaData(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::KeyValueBag *result = 0 ;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputPadName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29211,7 +36236,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getMetaD
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::KeyValueBag *)(arg1)->getMetaData();
+      result = (char *)(arg1)->getOutputPadName();
     }
     catch(std::exception & e)
     {
@@ -29230,24 +36255,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getMetaD
     
     /*@SWIG@*/
   }
-  *(io::humble::video::KeyValueBag **)&jresult = result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1findTimeStampEntryInIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int64_t arg2 ;
-  int32_t arg3 ;
-  io::humble::video::IndexEntry *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputPadType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::MediaDescriptor::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
-  arg2 = (int64_t)jarg2; 
-  arg3 = (int32_t)jarg3; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29261,7 +36282,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1findTime
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::IndexEntry *)(arg1)->findTimeStampEntryInIndex(arg2,arg3);
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getOutputPadType();
     }
     catch(std::exception & e)
     {
@@ -29280,24 +36301,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1findTime
     
     /*@SWIG@*/
   }
-  *(io::humble::video::IndexEntry **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1findTimeStampPositionInIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getMediaType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int64_t arg2 ;
-  int32_t arg3 ;
-  int32_t result;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::MediaDescriptor::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
-  arg2 = (int64_t)jarg2; 
-  arg3 = (int32_t)jarg3; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29311,7 +36328,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1findTimeS
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->findTimeStampPositionInIndex(arg2,arg3);
+      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getMediaType();
     }
     catch(std::exception & e)
     {
@@ -29335,17 +36352,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1findTimeS
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getIndexEntry(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::IndexEntry *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29359,7 +36374,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getIndex
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::IndexEntry *)(arg1)->getIndexEntry(arg2);
+      result = (int32_t)(arg1)->getWidth();
     }
     catch(std::exception & e)
     {
@@ -29378,20 +36393,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getIndex
     
     /*@SWIG@*/
   }
-  *(io::humble::video::IndexEntry **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getDisposition(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::ContainerStream::Disposition result;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29405,7 +36420,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getDispos
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::ContainerStream::Disposition)(arg1)->getDisposition();
+      result = (int32_t)(arg1)->getHeight();
     }
     catch(std::exception & e)
     {
@@ -29429,15 +36444,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getDispos
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getAttachedPic(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  io::humble::video::MediaPacket *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getPixelFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::PixelFormat::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29451,7 +36466,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getAttac
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaPacket *)(arg1)->getAttachedPic();
+      result = (io::humble::video::PixelFormat::Type)(arg1)->getPixelFormat();
     }
     catch(std::exception & e)
     {
@@ -29470,26 +36485,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1getAttac
     
     /*@SWIG@*/
   }
-  *(io::humble::video::MediaPacket **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1matchSpecifier(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  jboolean jresult = 0 ;
-  io::humble::video::ContainerStream *arg1 = (io::humble::video::ContainerStream *) 0 ;
-  char *arg2 = (char *) 0 ;
-  bool result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getPixelAspectRatio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::Rational *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::ContainerStream **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29503,7 +36512,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1match
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->matchSpecifier((char const *)arg2);
+      result = (io::humble::video::Rational *)(arg1)->getPixelAspectRatio();
     }
     catch(std::exception & e)
     {
@@ -29522,177 +36531,20 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_ContainerStream_1match
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1GENPTS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_GENPTS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1IGNIDX_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_IGNIDX;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1NONBLOCK_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_NONBLOCK;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1IGNDTS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_IGNDTS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1NOFILLIN_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_NOFILLIN;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1NOPARSE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_NOPARSE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1NOBUFFER_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_NOBUFFER;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1CUSTOM_1IO_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_CUSTOM_IO;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1DISCARD_1CORRUPT_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_DISCARD_CORRUPT;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1MP4A_1LATM_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_MP4A_LATM;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1SORT_1DTS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_SORT_DTS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1PRIV_1OPT_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_PRIV_OPT;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1FLAG_1KEEP_1SIDE_1DATA_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Container::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Container::Flag)io::humble::video::Container::FLAG_KEEP_SIDE_DATA;
-  jresult = (jint)result; 
+  *(io::humble::video::Rational **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1getNumStreams(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Container *arg1 = (io::humble::video::Container *) 0 ;
-  int32_t result;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::AudioChannel::Layout result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Container **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29706,7 +36558,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1getNumStreams(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumStreams();
+      result = (io::humble::video::AudioChannel::Layout)(arg1)->getChannelLayout();
     }
     catch(std::exception & e)
     {
@@ -29730,15 +36582,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Container_1getNumStreams(J
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerStream_1getCoder(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::MuxerStream *arg1 = (io::humble::video::MuxerStream *) 0 ;
-  io::humble::video::Coder *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29752,7 +36604,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerStream_1getCoder(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Coder *)(arg1)->getCoder();
+      result = (int32_t)(arg1)->getSampleRate();
     }
     catch(std::exception & e)
     {
@@ -29771,20 +36623,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerStream_1getCoder(JNI
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Coder **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerStream_1getMuxer(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::MuxerStream *arg1 = (io::humble::video::MuxerStream *) 0 ;
-  io::humble::video::Muxer *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getSampleFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::AudioFormat::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::MuxerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29798,7 +36650,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerStream_1getMuxer(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Muxer *)(arg1)->getMuxer();
+      result = (io::humble::video::AudioFormat::Type)(arg1)->getSampleFormat();
     }
     catch(std::exception & e)
     {
@@ -29817,20 +36669,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MuxerStream_1getMuxer(JNI
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Muxer **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDecoder(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::DemuxerStream *arg1 = (io::humble::video::DemuxerStream *) 0 ;
-  io::humble::video::Decoder *result = 0 ;
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::Rational *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerStream **)&jarg1; 
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -29844,7 +36696,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDecoder
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Decoder *)(arg1)->getDecoder();
+      result = (io::humble::video::Rational *)(arg1)->getTimeBase();
     }
     catch(std::exception & e)
     {
@@ -29863,25 +36715,30 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDecoder
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Decoder **)&jresult = result; 
+  *(io::humble::video::Rational **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDemuxer(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::DemuxerStream *arg1 = (io::humble::video::DemuxerStream *) 0 ;
-  io::humble::video::Demuxer *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterLink_1insertFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jint jarg3, jint jarg4) {
+  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::Filter *arg2 = (io::humble::video::Filter *) 0 ;
+  int32_t arg3 ;
+  int32_t arg4 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::DemuxerStream **)&jarg1; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg2 = *(io::humble::video::Filter **)&jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int32_t)jarg4; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -29890,18 +36747,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDemuxer
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Demuxer *)(arg1)->getDemuxer();
+      (arg1)->insertFilter(arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -29909,50 +36766,44 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_DemuxerStream_1getDemuxer
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Demuxer **)&jresult = result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1make(JNIEnv *jenv, jclass jcls, jstring jarg1, jlong jarg2, jobject jarg2_, jstring jarg3) {
-  jlong jresult = 0 ;
-  char *arg1 = (char *) 0 ;
-  io::humble::video::MuxerFormat *arg2 = (io::humble::video::MuxerFormat *) 0 ;
-  char *arg3 = (char *) 0 ;
-  io::humble::video::Muxer *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterAudioSource_1addAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  io::humble::video::FilterAudioSource *arg1 = (io::humble::video::FilterAudioSource *) 0 ;
+  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
   
   (void)jenv;
   (void)jcls;
+  (void)jarg1_;
   (void)jarg2_;
-  arg1 = 0;
-  if (jarg1) {
-    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
-    if (!arg1) return 0;
-  }
-  arg2 = *(io::humble::video::MuxerFormat **)&jarg2; 
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return 0;
+  arg1 = *(io::humble::video::FilterAudioSource **)&jarg1; 
+  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
   }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Muxer *)io::humble::video::Muxer::make((char const *)arg1,arg2,(char const *)arg3);
+      (arg1)->addAudio(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -29960,27 +36811,24 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1make(JNIEnv *jenv,
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Muxer **)&jresult = result; 
-  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
-  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Muxer_1getURL(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterPictureSource_1addPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  io::humble::video::FilterPictureSource *arg1 = (io::humble::video::FilterPictureSource *) 0 ;
+  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::FilterPictureSource **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -29989,18 +36837,18 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Muxer_1getURL(JNIEnv *j
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getURL();
+      (arg1)->addPicture(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -30008,25 +36856,23 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Muxer_1getURL(JNIEnv *j
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  io::humble::video::MuxerFormat *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterSink_1setFrameSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::FilterSink *arg1 = (io::humble::video::FilterSink *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  arg1 = *(io::humble::video::FilterSink **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -30035,18 +36881,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1getFormat(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MuxerFormat *)(arg1)->getFormat();
+      (arg1)->setFrameSize(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -30054,20 +36900,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1getFormat(JNIEnv *
     
     /*@SWIG@*/
   }
-  *(io::humble::video::MuxerFormat **)&jresult = result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterSink_1getFrameSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  io::humble::video::Muxer::State result;
+  io::humble::video::FilterSink *arg1 = (io::humble::video::FilterSink *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  arg1 = *(io::humble::video::FilterSink **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30081,7 +36925,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getState(JNIEnv *je
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Muxer::State)(arg1)->getState();
+      result = (int32_t)(arg1)->getFrameSize();
     }
     catch(std::exception & e)
     {
@@ -30105,66 +36949,23 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getState(JNIEnv *je
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_) {
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  io::humble::video::KeyValueBag *arg2 = (io::humble::video::KeyValueBag *) 0 ;
-  io::humble::video::KeyValueBag *arg3 = (io::humble::video::KeyValueBag *) 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterAudioSink_1getAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  jint jresult = 0 ;
+  io::humble::video::FilterAudioSink *arg1 = (io::humble::video::FilterAudioSink *) 0 ;
+  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   (void)jarg2_;
-  (void)jarg3_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
-  arg2 = *(io::humble::video::KeyValueBag **)&jarg2; 
-  arg3 = *(io::humble::video::KeyValueBag **)&jarg3; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
-  
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      (arg1)->open(arg2,arg3);
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return ;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
-  }
-}
-
-
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1close(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  arg1 = *(io::humble::video::FilterAudioSink **)&jarg1; 
+  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -30173,18 +36974,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1close(JNIEnv *jenv,
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->close();
+      result = (int32_t)(arg1)->getAudio(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -30192,18 +36993,23 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1close(JNIEnv *jenv,
     
     /*@SWIG@*/
   }
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getNumStreams(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterPictureSink_1getPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
   jint jresult = 0 ;
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
+  io::humble::video::FilterPictureSink *arg1 = (io::humble::video::FilterPictureSink *) 0 ;
+  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::FilterPictureSink **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30217,7 +37023,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getNumStreams(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumStreams();
+      result = (int32_t)(arg1)->getPicture(arg2);
     }
     catch(std::exception & e)
     {
@@ -30241,20 +37047,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getNumStreams(JNIEn
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1setOutputBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::BitStreamFilterType *arg1 = (io::humble::video::BitStreamFilterType *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::BitStreamFilterType **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -30263,18 +37069,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1setOutputBufferLeng
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setOutputBufferLength(arg2);
+      result = (char *)(arg1)->getName();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -30282,32 +37088,24 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Muxer_1setOutputBufferLeng
     
     /*@SWIG@*/
   }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getOutputBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getNumBitStreamFilterTypes(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
-  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getOutputBufferLength();
+      result = (int32_t)io::humble::video::BitStreamFilterType::getNumBitStreamFilterTypes();
     }
     catch(std::exception & e)
     {
@@ -30331,32 +37129,21 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Muxer_1getOutputBufferLeng
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1addNewStream(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getBitStreamFilterType_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jint jarg1) {
   jlong jresult = 0 ;
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  io::humble::video::Coder *arg2 = (io::humble::video::Coder *) 0 ;
-  io::humble::video::MuxerStream *result = 0 ;
+  int32_t arg1 ;
+  io::humble::video::BitStreamFilterType *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
-  arg2 = *(io::humble::video::Coder **)&jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
-  
+  arg1 = (int32_t)jarg1; 
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MuxerStream *)(arg1)->addNewStream(arg2);
+      result = (io::humble::video::BitStreamFilterType *)io::humble::video::BitStreamFilterType::getBitStreamFilterType(arg1);
     }
     catch(std::exception & e)
     {
@@ -30375,36 +37162,30 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1addNewStream(JNIEn
     
     /*@SWIG@*/
   }
-  *(io::humble::video::MuxerStream **)&jresult = result; 
+  *(io::humble::video::BitStreamFilterType **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1getStream(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getBitStreamFilterType_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jstring jarg1) {
   jlong jresult = 0 ;
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::MuxerStream *result = 0 ;
+  char *arg1 = (char *) 0 ;
+  io::humble::video::BitStreamFilterType *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
   }
-  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MuxerStream *)(arg1)->getStream(arg2);
+      result = (io::humble::video::BitStreamFilterType *)io::humble::video::BitStreamFilterType::getBitStreamFilterType((char const *)arg1);
     }
     catch(std::exception & e)
     {
@@ -30423,39 +37204,31 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Muxer_1getStream(JNIEnv *
     
     /*@SWIG@*/
   }
-  *(io::humble::video::MuxerStream **)&jresult = result; 
+  *(io::humble::video::BitStreamFilterType **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Muxer_1write(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jboolean jarg3) {
-  jboolean jresult = 0 ;
-  io::humble::video::Muxer *arg1 = (io::humble::video::Muxer *) 0 ;
-  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
-  bool arg3 ;
-  bool result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1make_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  io::humble::video::BitStreamFilter *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::Muxer **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
-  arg3 = jarg3 ? true : false; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
   }
-  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->write(arg2,arg3);
+      result = (io::humble::video::BitStreamFilter *)io::humble::video::BitStreamFilter::make((char const *)arg1);
     }
     catch(std::exception & e)
     {
@@ -30474,24 +37247,28 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Muxer_1write(JNIEnv *j
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  *(io::humble::video::BitStreamFilter **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1make(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1make_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::Demuxer *result = 0 ;
+  io::humble::video::BitStreamFilterType *arg1 = (io::humble::video::BitStreamFilterType *) 0 ;
+  io::humble::video::BitStreamFilter *result = 0 ;
   
   (void)jenv;
   (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::BitStreamFilterType **)&jarg1; 
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Demuxer *)io::humble::video::Demuxer::make();
+      result = (io::humble::video::BitStreamFilter *)io::humble::video::BitStreamFilter::make(arg1);
     }
     catch(std::exception & e)
     {
@@ -30510,20 +37287,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1make(JNIEnv *jen
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Demuxer **)&jresult = result; 
+  *(io::humble::video::BitStreamFilter **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::Demuxer::State result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1getType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::BitStreamFilter *arg1 = (io::humble::video::BitStreamFilter *) 0 ;
+  io::humble::video::BitStreamFilterType *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg1 = *(io::humble::video::BitStreamFilter **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30537,7 +37314,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getState(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Demuxer::State)(arg1)->getState();
+      result = (io::humble::video::BitStreamFilterType *)(arg1)->getType();
     }
     catch(std::exception & e)
     {
@@ -30556,20 +37333,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getState(JNIEnv *
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::BitStreamFilterType **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::DemuxerFormat *result = 0 ;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::BitStreamFilter *arg1 = (io::humble::video::BitStreamFilter *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg1 = *(io::humble::video::BitStreamFilter **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30583,7 +37360,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFormat(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::DemuxerFormat *)(arg1)->getFormat();
+      result = (char *)(arg1)->getName();
     }
     catch(std::exception & e)
     {
@@ -30602,64 +37379,43 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFormat(JNIEnv
     
     /*@SWIG@*/
   }
-  *(io::humble::video::DemuxerFormat **)&jresult = result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setInputBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t arg2 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
-  
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      (arg1)->setInputBufferLength(arg2);
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return ;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
-  }
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getInputBufferLength(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1filter_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jint jarg3, jlong jarg4, jobject jarg4_, jint jarg5, jint jarg6, jlong jarg7, jobject jarg7_, jstring jarg8, jboolean jarg9) {
   jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::BitStreamFilter *arg1 = (io::humble::video::BitStreamFilter *) 0 ;
+  io::humble::ferry::Buffer *arg2 = (io::humble::ferry::Buffer *) 0 ;
+  int32_t arg3 ;
+  io::humble::ferry::Buffer *arg4 = (io::humble::ferry::Buffer *) 0 ;
+  int32_t arg5 ;
+  int32_t arg6 ;
+  io::humble::video::Coder *arg7 = (io::humble::video::Coder *) 0 ;
+  char *arg8 = (char *) 0 ;
+  bool arg9 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  (void)jarg2_;
+  (void)jarg4_;
+  (void)jarg7_;
+  arg1 = *(io::humble::video::BitStreamFilter **)&jarg1; 
+  arg2 = *(io::humble::ferry::Buffer **)&jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = *(io::humble::ferry::Buffer **)&jarg4; 
+  arg5 = (int32_t)jarg5; 
+  arg6 = (int32_t)jarg6; 
+  arg7 = *(io::humble::video::Coder **)&jarg7; 
+  arg8 = 0;
+  if (jarg8) {
+    arg8 = (char *)jenv->GetStringUTFChars(jarg8, 0);
+    if (!arg8) return 0;
+  }
+  arg9 = jarg9 ? true : false; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30673,7 +37429,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getInputBufferLen
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getInputBufferLength();
+      result = (int32_t)(arg1)->filter(arg2,arg3,arg4,arg5,arg6,arg7,(char const *)arg8,arg9);
     }
     catch(std::exception & e)
     {
@@ -30693,36 +37449,27 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getInputBufferLen
     /*@SWIG@*/
   }
   jresult = (jint)result; 
+  if (arg8) jenv->ReleaseStringUTFChars(jarg8, (const char *)arg8);
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jlong jarg3, jobject jarg3_, jboolean jarg4, jboolean jarg5, jlong jarg6, jobject jarg6_, jlong jarg7, jobject jarg7_) {
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  char *arg2 = (char *) 0 ;
-  io::humble::video::DemuxerFormat *arg3 = (io::humble::video::DemuxerFormat *) 0 ;
-  bool arg4 ;
-  bool arg5 ;
-  io::humble::video::KeyValueBag *arg6 = (io::humble::video::KeyValueBag *) 0 ;
-  io::humble::video::KeyValueBag *arg7 = (io::humble::video::KeyValueBag *) 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1filter_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jstring jarg3) {
+  io::humble::video::BitStreamFilter *arg1 = (io::humble::video::BitStreamFilter *) 0 ;
+  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
+  char *arg3 = (char *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg3_;
-  (void)jarg6_;
-  (void)jarg7_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return ;
+  (void)jarg2_;
+  arg1 = *(io::humble::video::BitStreamFilter **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return ;
   }
-  arg3 = *(io::humble::video::DemuxerFormat **)&jarg3; 
-  arg4 = jarg4 ? true : false; 
-  arg5 = jarg5 ? true : false; 
-  arg6 = *(io::humble::video::KeyValueBag **)&jarg6; 
-  arg7 = *(io::humble::video::KeyValueBag **)&jarg7; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30736,7 +37483,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1open(JNIEnv *jenv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->open((char const *)arg2,arg3,arg4,arg5,arg6,arg7);
+      (arg1)->filter(arg2,(char const *)arg3);
     }
     catch(std::exception & e)
     {
@@ -30755,23 +37502,23 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1open(JNIEnv *jenv
     
     /*@SWIG@*/
   }
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1close(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1make(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  jlong jresult = 0 ;
   io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  int32_t arg2 ;
+  int32_t arg3 ;
+  io::humble::video::FrameSeeker *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
+  arg2 = (int32_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -30779,18 +37526,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1close(JNIEnv *jen
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->close();
+      result = (io::humble::video::FrameSeeker *)io::humble::video::FrameSeeker::make(arg1,arg2,arg3);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -30798,20 +37545,22 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1close(JNIEnv *jen
     
     /*@SWIG@*/
   }
+  *(io::humble::video::FrameSeeker **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getStream(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1seekToFrame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
   jlong jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::DemuxerStream *result = 0 ;
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
+  int64_t arg2 ;
+  io::humble::video::MediaPicture *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30825,7 +37574,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getStream(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::DemuxerStream *)(arg1)->getStream(arg2);
+      result = (io::humble::video::MediaPicture *)(arg1)->seekToFrame(arg2);
     }
     catch(std::exception & e)
     {
@@ -30844,23 +37593,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getStream(JNIEnv
     
     /*@SWIG@*/
   }
-  *(io::humble::video::DemuxerStream **)&jresult = result; 
+  *(io::humble::video::MediaPicture **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1read(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1getStreamIndex(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30874,7 +37620,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1read(JNIEnv *jenv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->read(arg2);
+      result = (int32_t)(arg1)->getStreamIndex();
     }
     catch(std::exception & e)
     {
@@ -30898,18 +37644,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1read(JNIEnv *jenv
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1queryStreamMetaData(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1getDecoder(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
+  io::humble::video::Decoder *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -30918,18 +37666,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1queryStreamMetaDa
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->queryStreamMetaData();
+      result = (io::humble::video::Decoder *)(arg1)->getDecoder();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -30937,18 +37685,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1queryStreamMetaDa
     
     /*@SWIG@*/
   }
+  *(io::humble::video::Decoder **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getDuration(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int64_t result;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1getMaxCachedGops(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -30962,7 +37712,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getDuration(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getDuration();
+      result = (int32_t)(arg1)->getMaxCachedGops();
     }
     catch(std::exception & e)
     {
@@ -30981,20 +37731,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getDuration(JNIE
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getStartTime(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int64_t result;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1getNumCachedGops(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -31008,7 +37758,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getStartTime(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getStartTime();
+      result = (int32_t)(arg1)->getNumCachedGops();
     }
     catch(std::exception & e)
     {
@@ -31027,20 +37777,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getStartTime(JNI
     
     /*@SWIG@*/
   }
-  jresult = (jlong)result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFileSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1getMaxCachedBytes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
   int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -31054,7 +37804,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFileSize(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int64_t)(arg1)->getFileSize();
+      result = (int64_t)(arg1)->getMaxCachedBytes();
     }
     catch(std::exception & e)
     {
@@ -31078,20 +37828,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFileSize(JNIE
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getBitRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1setMaxCachedBytes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -31100,18 +37850,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getBitRate(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getBitRate();
+      (arg1)->setMaxCachedBytes(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -31119,20 +37869,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getBitRate(JNIEnv
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1getCachedBytes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -31146,7 +37894,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFlags(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFlags();
+      result = (int64_t)(arg1)->getCachedBytes();
     }
     catch(std::exception & e)
     {
@@ -31165,20 +37913,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFlags(JNIEnv *
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
-
-
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t arg2 ;
+
+
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1clearCache(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::FrameSeeker *arg1 = (io::humble::video::FrameSeeker *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::FrameSeeker **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -31192,7 +37938,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setFlags(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setFlags(arg2);
+      (arg1)->clearCache();
     }
     catch(std::exception & e)
     {
@@ -31214,23 +37960,12 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setFlags(JNIEnv *
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jboolean jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::Container::Flag arg2 ;
-  bool result;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MemoryProtocol_1getProtocolName(JNIEnv *jenv, jclass jcls) {
+  jstring jresult = 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (io::humble::video::Container::Flag)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31238,7 +37973,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFlag(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->getFlag(arg2);
+      result = (char *)io::humble::video::MemoryProtocol::getProtocolName();
     }
     catch(std::exception & e)
     {
@@ -31257,28 +37992,24 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getFlag(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jboolean jarg3) {
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::Container::Flag arg2 ;
-  bool arg3 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MemoryProtocol_1addSource(JNIEnv *jenv, jclass jcls, jstring jarg1, jlong jarg2, jobject jarg2_) {
+  char *arg1 = (char *) 0 ;
+  io::humble::ferry::Buffer *arg2 = (io::humble::ferry::Buffer *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (io::humble::video::Container::Flag)jarg2; 
-  arg3 = jarg3 ? true : false; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
+  (void)jarg2_;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return ;
   }
+  arg2 = *(io::humble::ferry::Buffer **)&jarg2; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31286,7 +38017,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setFlag(JNIEnv *j
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setFlag(arg2,arg3);
+      io::humble::video::MemoryProtocol::addSource((char const *)arg1,arg2);
     }
     catch(std::exception & e)
     {
@@ -31305,23 +38036,21 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setFlag(JNIEnv *j
     
     /*@SWIG@*/
   }
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getURL(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MemoryProtocol_1removeSource(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jboolean jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
   }
   
   {
@@ -31330,7 +38059,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getURL(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getURL();
+      result = (bool)io::humble::video::MemoryProtocol::removeSource((char const *)arg1);
     }
     catch(std::exception & e)
     {
@@ -31349,25 +38078,23 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getURL(JNIEnv
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jboolean)result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getReadRetryCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MemoryProtocol_1takeOutput(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  io::humble::ferry::Buffer *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
   }
   
   {
@@ -31376,7 +38103,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getReadRetryCount
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getReadRetryCount();
+      result = (io::humble::ferry::Buffer *)io::humble::video::MemoryProtocol::takeOutput((char const *)arg1);
     }
     catch(std::exception & e)
     {
@@ -31395,26 +38122,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getReadRetryCount
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::ferry::Buffer **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setReadRetryCount(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1getProtocolName(JNIEnv *jenv, jclass jcls) {
+  jstring jresult = 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31422,18 +38141,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setReadRetryCount
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setReadRetryCount(arg2);
+      result = (char *)io::humble::video::CachingProtocol::getProtocolName();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -31441,24 +38160,17 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setReadRetryCount
     
     /*@SWIG@*/
   }
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1canStreamsBeAddedDynamically(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jboolean jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  bool result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1getMaxBytes(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31466,7 +38178,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1canStreamsBeA
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->canStreamsBeAddedDynamically();
+      result = (int64_t)io::humble::video::CachingProtocol::getMaxBytes();
     }
     catch(std::exception & e)
     {
@@ -31485,26 +38197,17 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_Demuxer_1canStreamsBeA
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getMetaData(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::KeyValueBag *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1setMaxBytes(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  int64_t arg1 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
+  arg1 = (int64_t)jarg1; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31512,18 +38215,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getMetaData(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::KeyValueBag *)(arg1)->getMetaData();
+      io::humble::video::CachingProtocol::setMaxBytes(arg1);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -31531,28 +38234,15 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getMetaData(JNIE
     
     /*@SWIG@*/
   }
-  *(io::humble::video::KeyValueBag **)&jresult = result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedAudioCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::Codec::ID arg2 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1getCachedBytes(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (io::humble::video::Codec::ID)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31560,7 +38250,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedAudioCod
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->setForcedAudioCodec(arg2);
+      result = (int64_t)io::humble::video::CachingProtocol::getCachedBytes();
     }
     catch(std::exception & e)
     {
@@ -31579,28 +38269,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedAudioCod
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedVideoCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1getBlockSize(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::Codec::ID arg2 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (io::humble::video::Codec::ID)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31608,7 +38287,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedVideoCod
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->setForcedVideoCodec(arg2);
+      result = (int32_t)io::humble::video::CachingProtocol::getBlockSize();
     }
     catch(std::exception & e)
     {
@@ -31632,23 +38311,12 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedVideoCod
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedSubtitleCodec(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  io::humble::video::Codec::ID arg2 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1getHits(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (io::humble::video::Codec::ID)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31656,7 +38324,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedSubtitle
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->setForcedSubtitleCodec(arg2);
+      result = (int64_t)io::humble::video::CachingProtocol::getHits();
     }
     catch(std::exception & e)
     {
@@ -31675,84 +38343,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1setForcedSubtitle
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1SEEK_1BACKWARD_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer::SeekFlag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Demuxer::SeekFlag)io::humble::video::Demuxer::SEEK_BACKWARD;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1SEEK_1BYTE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer::SeekFlag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Demuxer::SeekFlag)io::humble::video::Demuxer::SEEK_BYTE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1SEEK_1ANY_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer::SeekFlag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Demuxer::SeekFlag)io::humble::video::Demuxer::SEEK_ANY;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1SEEK_1FRAME_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer::SeekFlag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Demuxer::SeekFlag)io::humble::video::Demuxer::SEEK_FRAME;
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1seek(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jlong jarg3, jlong jarg4, jlong jarg5, jint jarg6) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t arg2 ;
-  int64_t arg3 ;
-  int64_t arg4 ;
-  int64_t arg5 ;
-  int32_t arg6 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1getMisses(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  arg3 = (int64_t)jarg3; 
-  arg4 = (int64_t)jarg4; 
-  arg5 = (int64_t)jarg5; 
-  arg6 = (int32_t)jarg6; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31760,7 +38361,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1seek(JNIEnv *jenv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->seek(arg2,arg3,arg4,arg5,arg6);
+      result = (int64_t)io::humble::video::CachingProtocol::getMisses();
     }
     catch(std::exception & e)
     {
@@ -31779,26 +38380,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1seek(JNIEnv *jenv
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getMaxDelay(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1getWaits(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31806,7 +38398,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getMaxDelay(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getMaxDelay();
+      result = (int64_t)io::humble::video::CachingProtocol::getWaits();
     }
     catch(std::exception & e)
     {
@@ -31825,24 +38417,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Demuxer_1getMaxDelay(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1play(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1getEvictions(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31850,18 +38435,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1play(JNIEnv *jenv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->play();
+      result = (int64_t)io::humble::video::CachingProtocol::getEvictions();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -31869,22 +38454,15 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1play(JNIEnv *jenv
     
     /*@SWIG@*/
   }
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1pause(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  io::humble::video::Demuxer *arg1 = (io::humble::video::Demuxer *) 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1resetStatistics(JNIEnv *jenv, jclass jcls) {
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Demuxer **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -31892,7 +38470,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1pause(JNIEnv *jen
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->pause();
+      io::humble::video::CachingProtocol::resetStatistics();
     }
     catch(std::exception & e)
     {
@@ -31914,105 +38492,10 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_Demuxer_1pause(JNIEnv *jen
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1UNKNOWN_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_UNKNOWN;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1DYNAMIC_1INPUTS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_DYNAMIC_INPUTS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1DYNAMIC_1OUTPUTS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_DYNAMIC_OUTPUTS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1SLICE_1THREADS_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_SLICE_THREADS;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1SUPPORT_1TIMELINE_1GENERIC_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_SUPPORT_TIMELINE_GENERIC;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1SUPPORT_1TIMELINE_1INTERNAL_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_SUPPORT_TIMELINE_INTERNAL;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1FILTER_1FLAG_1SUPPORT_1TIMELINE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType::Flag result;
-  
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::FilterType::Flag)io::humble::video::FilterType::FILTER_FLAG_SUPPORT_TIMELINE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1clear(JNIEnv *jenv, jclass jcls) {
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -32020,18 +38503,18 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getName(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      io::humble::video::CachingProtocol::clear();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -32039,26 +38522,25 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getName(JNI
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getDescription(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaRing_1make(JNIEnv *jenv, jclass jcls, jstring jarg1, jint jarg2, jint jarg3) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  int32_t arg2 ;
+  int32_t arg3 ;
+  io::humble::video::MediaRing *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
   }
+  arg2 = (int32_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -32066,7 +38548,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getDescript
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getDescription();
+      result = (io::humble::video::MediaRing *)io::humble::video::MediaRing::make((char const *)arg1,arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -32085,25 +38567,23 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getDescript
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  *(io::humble::video::MediaRing **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFlags(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  int result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaRing_1open(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+  jlong jresult = 0 ;
+  char *arg1 = (char *) 0 ;
+  io::humble::video::MediaRing *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
   }
   
   {
@@ -32112,7 +38592,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFlags(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int)(arg1)->getFlags();
+      result = (io::humble::video::MediaRing *)io::humble::video::MediaRing::open((char const *)arg1);
     }
     catch(std::exception & e)
     {
@@ -32131,22 +38611,21 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFlags(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::MediaRing **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFlag(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jboolean jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  io::humble::video::FilterType::Flag arg2 ;
-  bool result;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_MediaRing_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
-  arg2 = (io::humble::video::FilterType::Flag)jarg2; 
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32160,7 +38639,7 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFlag(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (bool)(arg1)->getFlag(arg2);
+      result = (char *)(arg1)->getName();
     }
     catch(std::exception & e)
     {
@@ -32179,20 +38658,20 @@ SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFlag(JN
     
     /*@SWIG@*/
   }
-  jresult = (jboolean)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumInputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  int32_t result;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaRing_1isWriter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32206,7 +38685,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumInputs(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumInputs();
+      result = (bool)(arg1)->isWriter();
     }
     catch(std::exception & e)
     {
@@ -32225,22 +38704,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumInputs(J
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getInputName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jstring jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  int32_t arg2 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaRing_1getNumSlots(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32254,7 +38731,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getInputNam
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getInputName(arg2);
+      result = (int32_t)(arg1)->getNumSlots();
     }
     catch(std::exception & e)
     {
@@ -32273,22 +38750,20 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getInputNam
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getInputType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaRing_1getSlotSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::MediaDescriptor::Type result;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32302,7 +38777,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getInputType(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getInputType(arg2);
+      result = (int32_t)(arg1)->getSlotSize();
     }
     catch(std::exception & e)
     {
@@ -32326,15 +38801,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getInputType(J
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumOutputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaRing_1getNumQueued(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32348,7 +38823,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumOutputs(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumOutputs();
+      result = (int32_t)(arg1)->getNumQueued();
     }
     catch(std::exception & e)
     {
@@ -32372,17 +38847,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumOutputs(
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getOutputName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jstring jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  int32_t arg2 ;
-  char *result = 0 ;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaRing_1writePicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
+  int64_t arg3 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
+  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
+  arg3 = (int64_t)jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32396,7 +38874,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getOutputNa
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getOutputName(arg2);
+      result = (bool)(arg1)->writePicture(arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -32415,22 +38893,25 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterType_1getOutputNa
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getOutputType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::FilterType *arg1 = (io::humble::video::FilterType *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaRing_1writeAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
+  int64_t arg3 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterType **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  (void)jarg2_;
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
+  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
+  arg3 = (int64_t)jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32444,7 +38925,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getOutputType(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getOutputType(arg2);
+      result = (bool)(arg1)->writeAudio(arg2,arg3);
     }
     catch(std::exception & e)
     {
@@ -32463,30 +38944,36 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getOutputType(
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterType_1findFilterType(JNIEnv *jenv, jclass jcls, jstring jarg1) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaRing_1readPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
   jlong jresult = 0 ;
-  char *arg1 = (char *) 0 ;
-  io::humble::video::FilterType *result = 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  int64_t arg2 ;
+  io::humble::video::MediaPicture *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = 0;
-  if (jarg1) {
-    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
-    if (!arg1) return 0;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
   }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterType *)io::humble::video::FilterType::findFilterType((char const *)arg1);
+      result = (io::humble::video::MediaPicture *)(arg1)->readPicture(arg2);
     }
     catch(std::exception & e)
     {
@@ -32505,25 +38992,36 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterType_1findFilterTyp
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterType **)&jresult = result; 
-  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  *(io::humble::video::MediaPicture **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumFilterTypes(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaRing_1readAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  int64_t arg2 ;
+  io::humble::video::MediaAudio *result = 0 ;
   
   (void)jenv;
   (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)io::humble::video::FilterType::getNumFilterTypes();
+      result = (io::humble::video::MediaAudio *)(arg1)->readAudio(arg2);
     }
     catch(std::exception & e)
     {
@@ -32542,37 +39040,43 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterType_1getNumFilterTy
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::MediaAudio **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFilterType(JNIEnv *jenv, jclass jcls, jint jarg1) {
-  jlong jresult = 0 ;
-  int32_t arg1 ;
-  io::humble::video::FilterType *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaRing_1close(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (int32_t)jarg1; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterType *)io::humble::video::FilterType::getFilterType(arg1);
+      (arg1)->close();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -32580,48 +39084,32 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterType_1getFilterType
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterType **)&jresult = result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1AUTO_1CONVERT_1ALL_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterGraph::AutoConvertFlag result;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_MediaRing_1isPeerClosed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::MediaRing *arg1 = (io::humble::video::MediaRing *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::FilterGraph::AutoConvertFlag)io::humble::video::FilterGraph::AUTO_CONVERT_ALL;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1AUTO_1CONVERT_1NONE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::FilterGraph::AutoConvertFlag result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaRing **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::FilterGraph::AutoConvertFlag)io::humble::video::FilterGraph::AUTO_CONVERT_NONE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1make(JNIEnv *jenv, jclass jcls) {
-  jlong jresult = 0 ;
-  io::humble::video::FilterGraph *result = 0 ;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
   
-  (void)jenv;
-  (void)jcls;
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterGraph *)io::humble::video::FilterGraph::make();
+      result = (bool)(arg1)->isPeerClosed();
     }
     catch(std::exception & e)
     {
@@ -32640,35 +39128,25 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1make(JNIEnv
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterGraph **)&jresult = result; 
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jstring jarg3) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1make(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2, jint jarg3, jint jarg4) {
   jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  io::humble::video::FilterType *arg2 = (io::humble::video::FilterType *) 0 ;
-  char *arg3 = (char *) 0 ;
-  io::humble::video::Filter *result = 0 ;
+  int32_t arg1 ;
+  int32_t arg2 ;
+  io::humble::video::PixelFormat::Type arg3 ;
+  int32_t arg4 ;
+  io::humble::video::MediaPicturePool *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = *(io::humble::video::FilterType **)&jarg2; 
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return 0;
-  }
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
+  arg1 = (int32_t)jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (io::humble::video::PixelFormat::Type)jarg3; 
+  arg4 = (int32_t)jarg4; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -32676,7 +39154,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addFilter(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Filter *)(arg1)->addFilter(arg2,(char const *)arg3);
+      result = (io::humble::video::MediaPicturePool *)io::humble::video::MediaPicturePool::make(arg1,arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
@@ -32695,27 +39173,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addFilter(JN
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Filter **)&jresult = result; 
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  *(io::humble::video::MediaPicturePool **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  io::humble::video::Filter *result = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  io::humble::video::MediaPicture *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32729,7 +39200,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getFilter(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Filter *)(arg1)->getFilter((char const *)arg2);
+      result = (io::humble::video::MediaPicture *)(arg1)->getPicture();
     }
     catch(std::exception & e)
     {
@@ -32748,36 +39219,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getFilter(JN
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Filter **)&jresult = result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  *(io::humble::video::MediaPicture **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addAudioSource(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jint jarg3, jint jarg4, jint jarg5, jlong jarg6, jobject jarg6_) {
-  jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  int32_t arg3 ;
-  io::humble::video::AudioChannel::Layout arg4 ;
-  io::humble::video::AudioFormat::Type arg5 ;
-  io::humble::video::Rational *arg6 = (io::humble::video::Rational *) 0 ;
-  io::humble::video::FilterAudioSource *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg6_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
-  arg3 = (int32_t)jarg3; 
-  arg4 = (io::humble::video::AudioChannel::Layout)jarg4; 
-  arg5 = (io::humble::video::AudioFormat::Type)jarg5; 
-  arg6 = *(io::humble::video::Rational **)&jarg6; 
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32791,7 +39246,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addAudioSour
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterAudioSource *)(arg1)->addAudioSource((char const *)arg2,arg3,arg4,arg5,arg6);
+      result = (int32_t)(arg1)->getWidth();
     }
     catch(std::exception & e)
     {
@@ -32810,39 +39265,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addAudioSour
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterAudioSource **)&jresult = result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addPictureSource(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jint jarg3, jint jarg4, jint jarg5, jlong jarg6, jobject jarg6_, jlong jarg7, jobject jarg7_) {
-  jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  int32_t arg3 ;
-  int32_t arg4 ;
-  io::humble::video::PixelFormat::Type arg5 ;
-  io::humble::video::Rational *arg6 = (io::humble::video::Rational *) 0 ;
-  io::humble::video::Rational *arg7 = (io::humble::video::Rational *) 0 ;
-  io::humble::video::FilterPictureSource *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg6_;
-  (void)jarg7_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
-  arg3 = (int32_t)jarg3; 
-  arg4 = (int32_t)jarg4; 
-  arg5 = (io::humble::video::PixelFormat::Type)jarg5; 
-  arg6 = *(io::humble::video::Rational **)&jarg6; 
-  arg7 = *(io::humble::video::Rational **)&jarg7; 
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32856,7 +39292,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addPictureSo
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterPictureSource *)(arg1)->addPictureSource((char const *)arg2,arg3,arg4,arg5,arg6,arg7);
+      result = (int32_t)(arg1)->getHeight();
     }
     catch(std::exception & e)
     {
@@ -32875,33 +39311,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addPictureSo
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterPictureSource **)&jresult = result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addAudioSink(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jint jarg3, jint jarg4, jint jarg5) {
-  jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  int32_t arg3 ;
-  io::humble::video::AudioChannel::Layout arg4 ;
-  io::humble::video::AudioFormat::Type arg5 ;
-  io::humble::video::FilterAudioSink *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  io::humble::video::PixelFormat::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
-  arg3 = (int32_t)jarg3; 
-  arg4 = (io::humble::video::AudioChannel::Layout)jarg4; 
-  arg5 = (io::humble::video::AudioFormat::Type)jarg5; 
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32915,7 +39338,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addAudioSink
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterAudioSink *)(arg1)->addAudioSink((char const *)arg2,arg3,arg4,arg5);
+      result = (io::humble::video::PixelFormat::Type)(arg1)->getFormat();
     }
     catch(std::exception & e)
     {
@@ -32934,29 +39357,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addAudioSink
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterAudioSink **)&jresult = result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addPictureSink(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jint jarg3) {
-  jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  io::humble::video::PixelFormat::Type arg3 ;
-  io::humble::video::FilterPictureSink *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getCapacity(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
-  arg3 = (io::humble::video::PixelFormat::Type)jarg3; 
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -32970,7 +39384,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addPictureSi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterPictureSink *)(arg1)->addPictureSink((char const *)arg2,arg3);
+      result = (int32_t)(arg1)->getCapacity();
     }
     catch(std::exception & e)
     {
@@ -32989,21 +39403,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1addPictureSi
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterPictureSink **)&jresult = result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getNumSources(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getNumIdle(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33017,7 +39430,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getNumSources
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSources();
+      result = (int32_t)(arg1)->getNumIdle();
     }
     catch(std::exception & e)
     {
@@ -33041,17 +39454,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getNumSources
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSource_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getNumReused(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::FilterSource *result = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33065,7 +39476,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSource_1_
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterSource *)(arg1)->getSource(arg2);
+      result = (int64_t)(arg1)->getNumReused();
     }
     catch(std::exception & e)
     {
@@ -33084,26 +39495,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSource_1_
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterSource **)&jresult = result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSource_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getNumAllocated(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  io::humble::video::FilterSource *result = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33117,7 +39522,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSource_1_
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterSource *)(arg1)->getSource((char const *)arg2);
+      result = (int64_t)(arg1)->getNumAllocated();
     }
     catch(std::exception & e)
     {
@@ -33136,21 +39541,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSource_1_
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterSource **)&jresult = result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getNumSinks(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getNumRecycled(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33164,7 +39568,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getNumSinks(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumSinks();
+      result = (int64_t)(arg1)->getNumRecycled();
     }
     catch(std::exception & e)
     {
@@ -33183,22 +39587,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getNumSinks(J
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSink_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1getNumDiscarded(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::FilterSink *result = 0 ;
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33212,7 +39614,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSink_1_1S
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterSink *)(arg1)->getSink(arg2);
+      result = (int64_t)(arg1)->getNumDiscarded();
     }
     catch(std::exception & e)
     {
@@ -33231,31 +39633,23 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSink_1_1S
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterSink **)&jresult = result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSink_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  jlong jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  io::humble::video::FilterSink *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1resetStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::MediaPicturePool *arg1 = (io::humble::video::MediaPicturePool *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
+  arg1 = *(io::humble::video::MediaPicturePool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -33264,7 +39658,54 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSink_1_1S
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterSink *)(arg1)->getSink((char const *)arg2);
+      (arg1)->resetStatistics();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1make(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2, jint jarg3, jint jarg4, jint jarg5, jint jarg6) {
+  jlong jresult = 0 ;
+  int32_t arg1 ;
+  int32_t arg2 ;
+  int32_t arg3 ;
+  io::humble::video::AudioChannel::Layout arg4 ;
+  io::humble::video::AudioFormat::Type arg5 ;
+  int32_t arg6 ;
+  io::humble::video::MediaAudioPool *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = (int32_t)jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (io::humble::video::AudioChannel::Layout)jarg4; 
+  arg5 = (io::humble::video::AudioFormat::Type)jarg5; 
+  arg6 = (int32_t)jarg6; 
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::MediaAudioPool *)io::humble::video::MediaAudioPool::make(arg1,arg2,arg3,arg4,arg5,arg6);
     }
     catch(std::exception & e)
     {
@@ -33283,26 +39724,25 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getSink_1_1S
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterSink **)&jresult = result; 
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  *(io::humble::video::MediaAudioPool **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1setAutoConvert(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  io::humble::video::FilterGraph::AutoConvertFlag arg2 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  io::humble::video::MediaAudio *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = (io::humble::video::FilterGraph::AutoConvertFlag)jarg2; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -33311,18 +39751,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1setAutoConver
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setAutoConvert(arg2);
+      result = (io::humble::video::MediaAudio *)(arg1)->getAudio();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -33330,18 +39770,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1setAutoConver
     
     /*@SWIG@*/
   }
+  *(io::humble::video::MediaAudio **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getAutoConvert(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getNumSamples(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  io::humble::video::FilterGraph::AutoConvertFlag result;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33355,7 +39797,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getAutoConver
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterGraph::AutoConvertFlag)(arg1)->getAutoConvert();
+      result = (int32_t)(arg1)->getNumSamples();
     }
     catch(std::exception & e)
     {
@@ -33379,24 +39821,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getAutoConver
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1open(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return ;
-  }
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -33405,18 +39843,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1open(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->open((char const *)arg2);
+      result = (int32_t)(arg1)->getSampleRate();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -33424,39 +39862,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1open(JNIEnv *
     
     /*@SWIG@*/
   }
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1sendCommand(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jstring jarg4, jint jarg5) {
-  jstring jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
-  char *arg4 = (char *) 0 ;
-  int arg5 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return 0;
-  }
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return 0;
-  }
-  arg4 = 0;
-  if (jarg4) {
-    arg4 = (char *)jenv->GetStringUTFChars(jarg4, 0);
-    if (!arg4) return 0;
-  }
-  arg5 = (int)jarg5; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33470,7 +39889,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1sendComman
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->sendCommand((char const *)arg2,(char const *)arg3,(char const *)arg4,arg5);
+      result = (int32_t)(arg1)->getChannels();
     }
     catch(std::exception & e)
     {
@@ -33489,49 +39908,71 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1sendComman
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
-  if (arg4) jenv->ReleaseStringUTFChars(jarg4, (const char *)arg4);
-  FilterGraph::freeString(result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1queueCommand(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jstring jarg3, jstring jarg4, jint jarg5, jdouble jarg6) {
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *arg2 = (char *) 0 ;
-  char *arg3 = (char *) 0 ;
-  char *arg4 = (char *) 0 ;
-  int arg5 ;
-  double arg6 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  io::humble::video::AudioChannel::Layout result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
-  arg2 = 0;
-  if (jarg2) {
-    arg2 = (char *)jenv->GetStringUTFChars(jarg2, 0);
-    if (!arg2) return ;
-  }
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return ;
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
   }
-  arg4 = 0;
-  if (jarg4) {
-    arg4 = (char *)jenv->GetStringUTFChars(jarg4, 0);
-    if (!arg4) return ;
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (io::humble::video::AudioChannel::Layout)(arg1)->getChannelLayout();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
   }
-  arg5 = (int)jarg5; 
-  arg6 = (double)jarg6; 
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  io::humble::video::AudioFormat::Type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -33540,18 +39981,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1queueCommand(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->queueCommand((char const *)arg2,(char const *)arg3,(char const *)arg4,arg5,arg6);
+      result = (io::humble::video::AudioFormat::Type)(arg1)->getFormat();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -33559,21 +40000,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1queueCommand(
     
     /*@SWIG@*/
   }
-  if (arg2) jenv->ReleaseStringUTFChars(jarg2, (const char *)arg2);
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
-  if (arg4) jenv->ReleaseStringUTFChars(jarg4, (const char *)arg4);
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getDisplayString(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getCapacity(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33587,7 +40027,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getDisplay
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getDisplayString();
+      result = (int32_t)(arg1)->getCapacity();
     }
     catch(std::exception & e)
     {
@@ -33606,21 +40046,20 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getDisplay
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  FilterGraph::freeString(result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getState(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getNumIdle(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterGraph *arg1 = (io::humble::video::FilterGraph *) 0 ;
-  io::humble::video::FilterGraph::State result;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterGraph **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33634,7 +40073,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getState(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterGraph::State)(arg1)->getState();
+      result = (int32_t)(arg1)->getNumIdle();
     }
     catch(std::exception & e)
     {
@@ -33658,39 +40097,61 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterGraph_1getState(JNIE
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1COMMAND_1FLAG_1ONE_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Filter::CommandFlag result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getNumReused(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (io::humble::video::Filter::CommandFlag)io::humble::video::Filter::COMMAND_FLAG_ONE;
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1COMMAND_1FLAG_1FAST_1get(JNIEnv *jenv, jclass jcls) {
-  jint jresult = 0 ;
-  io::humble::video::Filter::CommandFlag result;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
-  (void)jenv;
-  (void)jcls;
-  result = (io::humble::video::Filter::CommandFlag)io::humble::video::Filter::COMMAND_FLAG_FAST;
-  jresult = (jint)result; 
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      result = (int64_t)(arg1)->getNumReused();
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return 0;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return 0;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getNumAllocated(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33704,7 +40165,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getName(JNIEnv
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      result = (int64_t)(arg1)->getNumAllocated();
     }
     catch(std::exception & e)
     {
@@ -33723,20 +40184,20 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getName(JNIEnv
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getNumInputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getNumRecycled(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33750,7 +40211,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getNumInputs(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumInputs();
+      result = (int64_t)(arg1)->getNumRecycled();
     }
     catch(std::exception & e)
     {
@@ -33769,22 +40230,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getNumInputs(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jstring jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  int32_t arg2 ;
-  char *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1getNumDiscarded(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33798,7 +40257,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputName(JN
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getInputName(arg2);
+      result = (int64_t)(arg1)->getNumDiscarded();
     }
     catch(std::exception & e)
     {
@@ -33817,27 +40276,23 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputName(JN
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jint jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1resetStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::MediaAudioPool *arg1 = (io::humble::video::MediaAudioPool *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::MediaAudioPool **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -33846,18 +40301,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputType(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getInputType(arg2);
+      (arg1)->resetStatistics();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -33865,28 +40320,31 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputType(JNIEn
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputLink(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1make(JNIEnv *jenv, jclass jcls, jstring jarg1, jint jarg2, jint jarg3, jint jarg4, jint jarg5, jint jarg6) {
   jlong jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
+  char *arg1 = (char *) 0 ;
   int32_t arg2 ;
-  io::humble::video::FilterLink *result = 0 ;
+  int32_t arg3 ;
+  int32_t arg4 ;
+  int32_t arg5 ;
+  io::humble::video::PixelFormat::Type arg6 ;
+  io::humble::video::SpriteSheetGenerator *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
+  arg1 = 0;
+  if (jarg1) {
+    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
+    if (!arg1) return 0;
   }
+  arg2 = (int32_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int32_t)jarg4; 
+  arg5 = (int32_t)jarg5; 
+  arg6 = (io::humble::video::PixelFormat::Type)jarg6; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -33894,7 +40352,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputLink(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterLink *)(arg1)->getInputLink(arg2);
+      result = (io::humble::video::SpriteSheetGenerator *)io::humble::video::SpriteSheetGenerator::make((char const *)arg1,arg2,arg3,arg4,arg5,arg6);
     }
     catch(std::exception & e)
     {
@@ -33913,20 +40371,21 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getInputLink(JNIE
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterLink **)&jresult = result; 
+  *(io::humble::video::SpriteSheetGenerator **)&jresult = result; 
+  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getNumOutputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  int32_t result;
+SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getURL(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  char *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33940,7 +40399,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getNumOutputs(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getNumOutputs();
+      result = (char *)(arg1)->getURL();
     }
     catch(std::exception & e)
     {
@@ -33959,22 +40418,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getNumOutputs(JNIE
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  if (result) jresult = jenv->NewStringUTF((const char *)result);
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jstring jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  int32_t arg2 ;
-  char *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getColumns(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -33988,7 +40445,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputName(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getOutputName(arg2);
+      result = (int32_t)(arg1)->getColumns();
     }
     catch(std::exception & e)
     {
@@ -34007,22 +40464,20 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputName(J
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getRows(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::MediaDescriptor::Type result;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34036,7 +40491,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputType(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getOutputType(arg2);
+      result = (int32_t)(arg1)->getRows();
     }
     catch(std::exception & e)
     {
@@ -34060,17 +40515,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputType(JNIE
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputLink(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  jlong jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  int32_t arg2 ;
-  io::humble::video::FilterLink *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getTileWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34084,7 +40537,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputLink(JNI
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterLink *)(arg1)->getOutputLink(arg2);
+      result = (int32_t)(arg1)->getTileWidth();
     }
     catch(std::exception & e)
     {
@@ -34103,20 +40556,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getOutputLink(JNI
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterLink **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getGraph(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::Filter *arg1 = (io::humble::video::Filter *) 0 ;
-  io::humble::video::FilterGraph *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getTileHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::Filter **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34130,7 +40583,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getGraph(JNIEnv *
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterGraph *)(arg1)->getGraph();
+      result = (int32_t)(arg1)->getTileHeight();
     }
     catch(std::exception & e)
     {
@@ -34149,20 +40602,20 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_Filter_1getGraph(JNIEnv *
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterGraph **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getFilterGraph(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::FilterGraph *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  io::humble::video::PixelFormat::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34176,7 +40629,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getFilterGrap
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::FilterGraph *)(arg1)->getFilterGraph();
+      result = (io::humble::video::PixelFormat::Type)(arg1)->getFormat();
     }
     catch(std::exception & e)
     {
@@ -34195,25 +40648,25 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getFilterGrap
     
     /*@SWIG@*/
   }
-  *(io::humble::video::FilterGraph **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::Filter *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1setInterval(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -34222,18 +40675,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputFilte
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Filter *)(arg1)->getInputFilter();
+      (arg1)->setInterval(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -34241,20 +40694,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputFilte
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Filter **)&jresult = result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputPadName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getInterval(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34268,7 +40719,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputPad
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getInputPadName();
+      result = (int64_t)(arg1)->getInterval();
     }
     catch(std::exception & e)
     {
@@ -34287,25 +40738,25 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputPad
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputPadType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1setStartTime(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -34314,18 +40765,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputPadTyp
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getInputPadType();
+      (arg1)->setStartTime(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -34333,20 +40784,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getInputPadTyp
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getStartTime(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::Filter *result = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34360,7 +40809,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputFilt
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Filter *)(arg1)->getOutputFilter();
+      result = (int64_t)(arg1)->getStartTime();
     }
     catch(std::exception & e)
     {
@@ -34379,25 +40828,25 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputFilt
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Filter **)&jresult = result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputPadName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1setKeyFramesOnly(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  bool arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -34406,18 +40855,18 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputPa
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getOutputPadName();
+      (arg1)->setKeyFramesOnly(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -34425,20 +40874,18 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputPa
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputPadType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT jboolean JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1isKeyFramesOnly(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34452,7 +40899,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputPadTy
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getOutputPadType();
+      result = (bool)(arg1)->isKeyFramesOnly();
     }
     catch(std::exception & e)
     {
@@ -34471,25 +40918,25 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getOutputPadTy
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jboolean)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getMediaType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::MediaDescriptor::Type result;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1setThreads(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -34498,18 +40945,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getMediaType(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::MediaDescriptor::Type)(arg1)->getMediaType();
+      (arg1)->setThreads(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -34517,20 +40964,18 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getMediaType(J
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getWidth(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getThreads(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34544,7 +40989,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getWidth(JNIEn
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getWidth();
+      result = (int32_t)(arg1)->getThreads();
     }
     catch(std::exception & e)
     {
@@ -34568,15 +41013,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getWidth(JNIEn
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getHeight(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getNumSheets(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34590,7 +41035,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getHeight(JNIE
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getHeight();
+      result = (int32_t)(arg1)->getNumSheets();
     }
     catch(std::exception & e)
     {
@@ -34614,107 +41059,17 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getHeight(JNIE
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getPixelFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::PixelFormat::Type result;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
-  
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      result = (io::humble::video::PixelFormat::Type)(arg1)->getPixelFormat();
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return 0;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
-  }
-  jresult = (jint)result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getPixelAspectRatio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1generate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
   jlong jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::Rational *result = 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
-  
-  {
-    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
-    // HumbleVideo.i: Start generated code
-    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
-    try
-    {
-      result = (io::humble::video::Rational *)(arg1)->getPixelAspectRatio();
-    }
-    catch(std::exception & e)
-    {
-      io::humble::video::Global::catchException(e);
-      return 0;
-    }
-    catch(...)
-    {
-      std::runtime_error e("Unhandled and unknown native exception");
-      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
-    }
-    
-    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
-    // HumbleVideo.i: End generated code
-    
-    /*@SWIG@*/
-  }
-  *(io::humble::video::Rational **)&jresult = result; 
-  return jresult;
-}
-
-
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::AudioChannel::Layout result;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::MediaPicture *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34728,7 +41083,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getChannelLayo
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioChannel::Layout)(arg1)->getChannelLayout();
+      result = (io::humble::video::MediaPicture *)(arg1)->generate(arg2);
     }
     catch(std::exception & e)
     {
@@ -34747,26 +41102,22 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getChannelLayo
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::MediaPicture **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  int32_t result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1encode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaPicture *arg1 = (io::humble::video::MediaPicture *) 0 ;
+  io::humble::video::Codec::ID arg2 ;
+  io::humble::video::MediaPacket *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return 0;
-  }
+  arg1 = *(io::humble::video::MediaPicture **)&jarg1; 
+  arg2 = (io::humble::video::Codec::ID)jarg2; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -34774,7 +41125,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getSampleRate(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getSampleRate();
+      result = (io::humble::video::MediaPacket *)io::humble::video::SpriteSheetGenerator::encode(arg1,arg2);
     }
     catch(std::exception & e)
     {
@@ -34793,20 +41144,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getSampleRate(
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  *(io::humble::video::MediaPacket **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getSampleFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::AudioFormat::Type result;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getNumFramesDecoded(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34820,7 +41171,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getSampleForma
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::AudioFormat::Type)(arg1)->getSampleFormat();
+      result = (int64_t)(arg1)->getNumFramesDecoded();
     }
     catch(std::exception & e)
     {
@@ -34839,20 +41190,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getSampleForma
     
     /*@SWIG@*/
   }
-  jresult = (jint)result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getTimeBase(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1getNumSeeks(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::Rational *result = 0 ;
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34866,7 +41217,7 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getTimeBase(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::Rational *)(arg1)->getTimeBase();
+      result = (int64_t)(arg1)->getNumSeeks();
     }
     catch(std::exception & e)
     {
@@ -34885,25 +41236,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FilterLink_1getTimeBase(J
     
     /*@SWIG@*/
   }
-  *(io::humble::video::Rational **)&jresult = result; 
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterLink_1insertFilter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jint jarg3, jint jarg4) {
-  io::humble::video::FilterLink *arg1 = (io::humble::video::FilterLink *) 0 ;
-  io::humble::video::Filter *arg2 = (io::humble::video::Filter *) 0 ;
-  int32_t arg3 ;
-  int32_t arg4 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1resetStatistics(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  io::humble::video::SpriteSheetGenerator *arg1 = (io::humble::video::SpriteSheetGenerator *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::FilterLink **)&jarg1; 
-  arg2 = *(io::humble::video::Filter **)&jarg2; 
-  arg3 = (int32_t)jarg3; 
-  arg4 = (int32_t)jarg4; 
+  arg1 = *(io::humble::video::SpriteSheetGenerator **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -34917,7 +41261,7 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterLink_1insertFilter(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->insertFilter(arg2,arg3,arg4);
+      (arg1)->resetStatistics();
     }
     catch(std::exception & e)
     {
@@ -34939,22 +41283,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterLink_1insertFilter(J
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterAudioSource_1addAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
-  io::humble::video::FilterAudioSource *arg1 = (io::humble::video::FilterAudioSource *) 0 ;
-  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1make(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2, jint jarg3, jint jarg4) {
+  jlong jresult = 0 ;
+  int32_t arg1 ;
+  io::humble::video::AudioChannel::Layout arg2 ;
+  io::humble::video::AudioFormat::Type arg3 ;
+  int32_t arg4 ;
+  io::humble::video::MediaAudioMixer *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::FilterAudioSource **)&jarg1; 
-  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
-  
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
-      "invalid native object; delete() likely already called");
-    return ;
-  }
+  arg1 = (int32_t)jarg1; 
+  arg2 = (io::humble::video::AudioChannel::Layout)jarg2; 
+  arg3 = (io::humble::video::AudioFormat::Type)jarg3; 
+  arg4 = (int32_t)jarg4; 
   
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
@@ -34962,18 +41304,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterAudioSource_1addAudi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->addAudio(arg2);
+      result = (io::humble::video::MediaAudioMixer *)io::humble::video::MediaAudioMixer::make(arg1,arg2,arg3,arg4);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -34981,24 +41323,25 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterAudioSource_1addAudi
     
     /*@SWIG@*/
   }
+  *(io::humble::video::MediaAudioMixer **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterPictureSource_1addPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
-  io::humble::video::FilterPictureSource *arg1 = (io::humble::video::FilterPictureSource *) 0 ;
-  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getSampleRate(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::FilterPictureSource **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -35007,18 +41350,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterPictureSource_1addPi
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->addPicture(arg2);
+      result = (int32_t)(arg1)->getSampleRate();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -35026,23 +41369,25 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterPictureSource_1addPi
     
     /*@SWIG@*/
   }
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterSink_1setFrameSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  io::humble::video::FilterSink *arg1 = (io::humble::video::FilterSink *) 0 ;
-  int32_t arg2 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getChannelLayout(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  io::humble::video::AudioChannel::Layout result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterSink **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -35051,18 +41396,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterSink_1setFrameSize(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->setFrameSize(arg2);
+      result = (io::humble::video::AudioChannel::Layout)(arg1)->getChannelLayout();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -35070,18 +41415,20 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_FilterSink_1setFrameSize(J
     
     /*@SWIG@*/
   }
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterSink_1getFrameSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getChannels(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterSink *arg1 = (io::humble::video::FilterSink *) 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::FilterSink **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -35095,7 +41442,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterSink_1getFrameSize(J
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getFrameSize();
+      result = (int32_t)(arg1)->getChannels();
     }
     catch(std::exception & e)
     {
@@ -35119,18 +41466,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterSink_1getFrameSize(J
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterAudioSink_1getAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getFormat(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterAudioSink *arg1 = (io::humble::video::FilterAudioSink *) 0 ;
-  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
-  int32_t result;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  io::humble::video::AudioFormat::Type result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::FilterAudioSink **)&jarg1; 
-  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -35144,7 +41488,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterAudioSink_1getAudio(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getAudio(arg2);
+      result = (io::humble::video::AudioFormat::Type)(arg1)->getFormat();
     }
     catch(std::exception & e)
     {
@@ -35168,18 +41512,15 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterAudioSink_1getAudio(
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterPictureSink_1getPicture(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getFrameSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  io::humble::video::FilterPictureSink *arg1 = (io::humble::video::FilterPictureSink *) 0 ;
-  io::humble::video::MediaPicture *arg2 = (io::humble::video::MediaPicture *) 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::FilterPictureSink **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPicture **)&jarg2; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -35193,7 +41534,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterPictureSink_1getPict
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->getPicture(arg2);
+      result = (int32_t)(arg1)->getFrameSize();
     }
     catch(std::exception & e)
     {
@@ -35217,20 +41558,20 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_FilterPictureSink_1getPict
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::BitStreamFilterType *arg1 = (io::humble::video::BitStreamFilterType *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1setMaxDelay(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::BitStreamFilterType **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -35239,18 +41580,18 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1ge
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      (arg1)->setMaxDelay(arg2);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -35258,24 +41599,32 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1ge
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
-  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getNumBitStreamFilterTypes(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getMaxDelay(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)io::humble::video::BitStreamFilterType::getNumBitStreamFilterTypes();
+      result = (int32_t)(arg1)->getMaxDelay();
     }
     catch(std::exception & e)
     {
@@ -35299,21 +41648,31 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getNu
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getBitStreamFilterType_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jint jarg1) {
-  jlong jresult = 0 ;
-  int32_t arg1 ;
-  io::humble::video::BitStreamFilterType *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1addInput(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jdouble jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  double arg2 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = (int32_t)jarg1; 
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  arg2 = (double)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::BitStreamFilterType *)io::humble::video::BitStreamFilterType::getBitStreamFilterType(arg1);
+      result = (int32_t)(arg1)->addInput(arg2);
     }
     catch(std::exception & e)
     {
@@ -35332,30 +41691,34 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getB
     
     /*@SWIG@*/
   }
-  *(io::humble::video::BitStreamFilterType **)&jresult = result; 
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getBitStreamFilterType_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jstring jarg1) {
-  jlong jresult = 0 ;
-  char *arg1 = (char *) 0 ;
-  io::humble::video::BitStreamFilterType *result = 0 ;
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getNumInputs(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = 0;
-  if (jarg1) {
-    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
-    if (!arg1) return 0;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
   }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::BitStreamFilterType *)io::humble::video::BitStreamFilterType::getBitStreamFilterType((char const *)arg1);
+      result = (int32_t)(arg1)->getNumInputs();
     }
     catch(std::exception & e)
     {
@@ -35374,42 +41737,47 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilterType_1getB
     
     /*@SWIG@*/
   }
-  *(io::humble::video::BitStreamFilterType **)&jresult = result; 
-  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1make_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jstring jarg1) {
-  jlong jresult = 0 ;
-  char *arg1 = (char *) 0 ;
-  io::humble::video::BitStreamFilter *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1setGain(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jdouble jarg3) {
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int32_t arg2 ;
+  double arg3 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = 0;
-  if (jarg1) {
-    arg1 = (char *)jenv->GetStringUTFChars(jarg1, 0);
-    if (!arg1) return 0;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (double)jarg3; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
   }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::BitStreamFilter *)io::humble::video::BitStreamFilter::make((char const *)arg1);
+      (arg1)->setGain(arg2,arg3);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -35417,28 +41785,34 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1make_1_1
     
     /*@SWIG@*/
   }
-  *(io::humble::video::BitStreamFilter **)&jresult = result; 
-  if (arg1) jenv->ReleaseStringUTFChars(jarg1, (const char *)arg1);
-  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1make_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::BitStreamFilterType *arg1 = (io::humble::video::BitStreamFilterType *) 0 ;
-  io::humble::video::BitStreamFilter *result = 0 ;
+SWIGEXPORT jdouble JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getGain(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jdouble jresult = 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int32_t arg2 ;
+  double result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::BitStreamFilterType **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return 0;
+  }
+  
   {
     /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
     // HumbleVideo.i: Start generated code
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::BitStreamFilter *)io::humble::video::BitStreamFilter::make(arg1);
+      result = (double)(arg1)->getGain(arg2);
     }
     catch(std::exception & e)
     {
@@ -35457,25 +41831,28 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1make_1_1
     
     /*@SWIG@*/
   }
-  *(io::humble::video::BitStreamFilter **)&jresult = result; 
+  jresult = (jdouble)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1getType(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  io::humble::video::BitStreamFilter *arg1 = (io::humble::video::BitStreamFilter *) 0 ;
-  io::humble::video::BitStreamFilterType *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1addAudio(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jlong jarg3, jobject jarg3_) {
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int32_t arg2 ;
+  io::humble::video::MediaAudio *arg3 = (io::humble::video::MediaAudio *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::BitStreamFilter **)&jarg1; 
+  (void)jarg3_;
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = *(io::humble::video::MediaAudio **)&jarg3; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return 0;
+    return ;
   }
   
   {
@@ -35484,18 +41861,18 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1getType(
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (io::humble::video::BitStreamFilterType *)(arg1)->getType();
+      (arg1)->addAudio(arg2,arg3);
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return 0;
+      return ;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return 0;
+      return ;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -35503,20 +41880,64 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1getType(
     
     /*@SWIG@*/
   }
-  *(io::humble::video::BitStreamFilterType **)&jresult = result; 
-  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1getName(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  io::humble::video::BitStreamFilter *arg1 = (io::humble::video::BitStreamFilter *) 0 ;
-  char *result = 0 ;
+SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1endInput(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(io::humble::video::BitStreamFilter **)&jarg1; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
+      "invalid native object; delete() likely already called");
+    return ;
+  }
+  
+  {
+    /*@SWIG:/Users/aclarke/Work/humble/humble-video/humble-video-native/src/main/gnu/src/io/humble/video/HumbleVideo.i,142,HUMBLE_HANDLE_EXCEPTION@*/
+    // HumbleVideo.i: Start generated code
+    // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+    try
+    {
+      (arg1)->endInput(arg2);
+    }
+    catch(std::exception & e)
+    {
+      io::humble::video::Global::catchException(e);
+      return ;
+    }
+    catch(...)
+    {
+      std::runtime_error e("Unhandled and unknown native exception");
+      io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
+      return ;
+    }
+    
+    // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+    // HumbleVideo.i: End generated code
+    
+    /*@SWIG@*/
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getNumBuffered(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int32_t arg2 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -35530,7 +41951,7 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1getNam
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (char *)(arg1)->getName();
+      result = (int32_t)(arg1)->getNumBuffered(arg2);
     }
     catch(std::exception & e)
     {
@@ -35549,43 +41970,23 @@ SWIGEXPORT jstring JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1getNam
     
     /*@SWIG@*/
   }
-  if (result) jresult = jenv->NewStringUTF((const char *)result);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1filter_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jint jarg3, jlong jarg4, jobject jarg4_, jint jarg5, jint jarg6, jlong jarg7, jobject jarg7_, jstring jarg8, jboolean jarg9) {
+SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1mix(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
   jint jresult = 0 ;
-  io::humble::video::BitStreamFilter *arg1 = (io::humble::video::BitStreamFilter *) 0 ;
-  io::humble::ferry::Buffer *arg2 = (io::humble::ferry::Buffer *) 0 ;
-  int32_t arg3 ;
-  io::humble::ferry::Buffer *arg4 = (io::humble::ferry::Buffer *) 0 ;
-  int32_t arg5 ;
-  int32_t arg6 ;
-  io::humble::video::Coder *arg7 = (io::humble::video::Coder *) 0 ;
-  char *arg8 = (char *) 0 ;
-  bool arg9 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  io::humble::video::MediaAudio *arg2 = (io::humble::video::MediaAudio *) 0 ;
   int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   (void)jarg2_;
-  (void)jarg4_;
-  (void)jarg7_;
-  arg1 = *(io::humble::video::BitStreamFilter **)&jarg1; 
-  arg2 = *(io::humble::ferry::Buffer **)&jarg2; 
-  arg3 = (int32_t)jarg3; 
-  arg4 = *(io::humble::ferry::Buffer **)&jarg4; 
-  arg5 = (int32_t)jarg5; 
-  arg6 = (int32_t)jarg6; 
-  arg7 = *(io::humble::video::Coder **)&jarg7; 
-  arg8 = 0;
-  if (jarg8) {
-    arg8 = (char *)jenv->GetStringUTFChars(jarg8, 0);
-    if (!arg8) return 0;
-  }
-  arg9 = jarg9 ? true : false; 
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
+  arg2 = *(io::humble::video::MediaAudio **)&jarg2; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
@@ -35599,7 +42000,7 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1filter_1_
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      result = (int32_t)(arg1)->filter(arg2,arg3,arg4,arg5,arg6,arg7,(char const *)arg8,arg9);
+      result = (int32_t)(arg1)->mix(arg2);
     }
     catch(std::exception & e)
     {
@@ -35619,32 +42020,24 @@ SWIGEXPORT jint JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1filter_1_
     /*@SWIG@*/
   }
   jresult = (jint)result; 
-  if (arg8) jenv->ReleaseStringUTFChars(jarg8, (const char *)arg8);
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1filter_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jstring jarg3) {
-  io::humble::video::BitStreamFilter *arg1 = (io::humble::video::BitStreamFilter *) 0 ;
-  io::humble::video::MediaPacket *arg2 = (io::humble::video::MediaPacket *) 0 ;
-  char *arg3 = (char *) 0 ;
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1getNumDroppedSamples(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  io::humble::video::MediaAudioMixer *arg1 = (io::humble::video::MediaAudioMixer *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(io::humble::video::BitStreamFilter **)&jarg1; 
-  arg2 = *(io::humble::video::MediaPacket **)&jarg2; 
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return ;
-  }
+  arg1 = *(io::humble::video::MediaAudioMixer **)&jarg1; 
   
   if (!arg1) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException,
       "invalid native object; delete() likely already called");
-    return ;
+    return 0;
   }
   
   {
@@ -35653,18 +42046,18 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1filter_1_
     // >>>>>>>>>>>>>>>>>>>>>>>>>>>
     try
     {
-      (arg1)->filter(arg2,(char const *)arg3);
+      result = (int64_t)(arg1)->getNumDroppedSamples();
     }
     catch(std::exception & e)
     {
       io::humble::video::Global::catchException(e);
-      return ;
+      return 0;
     }
     catch(...)
     {
       std::runtime_error e("Unhandled and unknown native exception");
       io::humble::ferry::JNIHelper::throwJavaException(jenv, "java/lang/RuntimeException", e);
-      return ;
+      return 0;
     }
     
     // <<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -35672,7 +42065,8 @@ SWIGEXPORT void JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1filter_1_
     
     /*@SWIG@*/
   }
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
@@ -36091,6 +42485,70 @@ SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_BitStreamFilter_1SWIGUpca
     *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::BitStreamFilter **)&jarg1;
     return baseptr;
 }
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_FrameSeeker_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::FrameSeeker **)&jarg1;
+    return baseptr;
+}
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MemoryProtocol_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::MemoryProtocol **)&jarg1;
+    return baseptr;
+}
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_CachingProtocol_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::CachingProtocol **)&jarg1;
+    return baseptr;
+}
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaRing_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::MediaRing **)&jarg1;
+    return baseptr;
+}
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaPicturePool_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::MediaPicturePool **)&jarg1;
+    return baseptr;
+}
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioPool_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::MediaAudioPool **)&jarg1;
+    return baseptr;
+}
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_SpriteSheetGenerator_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::SpriteSheetGenerator **)&jarg1;
+    return baseptr;
+}
+SWIGEXPORT jlong JNICALL Java_io_humble_video_VideoJNI_MediaAudioMixer_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(io::humble::ferry::RefCounted **)&baseptr = *(io::humble::video::MediaAudioMixer **)&jarg1;
+    return baseptr;
+}
+
+
+
+
+
+
+
+
 
 #ifdef __cplusplus
 }
@@ -22,6 +22,8 @@
 
 // HumbleVideo.i: Start generated code
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+#include <vector>
+#include <stdexcept>
 #include <io/humble/ferry/JNIHelper.h>
 #include <io/humble/video/KeyValueBag.h>
 #include <io/humble/video/Property.h>
@@ -64,6 +66,14 @@
 #include <io/humble/video/FilterAudioSink.h>
 #include <io/humble/video/FilterPictureSink.h>
 #include <io/humble/video/BitStreamFilter.h>
+#include <io/humble/video/FrameSeeker.h>
+#include <io/humble/video/MemoryProtocol.h>
+#include <io/humble/video/CachingProtocol.h>
+#include <io/humble/video/MediaRing.h>
+#include <io/humble/video/MediaPicturePool.h>
+#include <io/humble/video/MediaAudioPool.h>
+#include <io/humble/video/SpriteSheetGenerator.h>
+#include <io/humble/video/MediaAudioMixer.h>
 
 using namespace VS_CPP_NAMESPACE;
 
@@ -189,7 +199,7 @@ import io.humble.ferry.Buffer;
 %include <io/humble/video/Configurable.swg>
 %include <io/humble/video/MediaResampler.h>
 %include <io/humble/video/MediaPictureResampler.swg>
-%include <io/humble/video/MediaAudioResampler.h>
+%include <io/humble/video/MediaAudioResampler.swg>
 %include <io/humble/video/Codec.swg>
 %include <io/humble/video/Coder.swg>
 %include <io/humble/video/ContainerFormat.swg>
@@ -216,3 +226,11 @@ import io.humble.ferry.Buffer;
 %include <io/humble/video/FilterAudioSink.swg>
 %include <io/humble/video/FilterPictureSink.swg>
 %include <io/humble/video/BitStreamFilter.swg>
+%include <io/humble/video/FrameSeeker.swg>
+%include <io/humble/video/MemoryProtocol.swg>
+%include <io/humble/video/CachingProtocol.swg>
+%include <io/humble/video/MediaRing.swg>
+%include <io/humble/video/MediaPicturePool.swg>
+%include <io/humble/video/MediaAudioPool.swg>
+%include <io/humble/video/SpriteSheetGenerator.swg>
+%include <io/humble/video/MediaAudioMixer.swg>
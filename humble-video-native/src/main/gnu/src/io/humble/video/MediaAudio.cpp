@@ -25,6 +25,7 @@
 
 #include "MediaAudio.h"
 #include "AVBufferSupport.h"
+#include "MediaAudioPool.h"
 #include <io/humble/ferry/Logger.h>
 #include <io/humble/ferry/HumbleException.h>
 #include <io/humble/ferry/RefPointer.h>
@@ -42,12 +43,24 @@ MediaAudio::MediaAudio() {
   if (!mFrame) throw std::bad_alloc();
   mFrame->opaque = this;
   mComplete = false;
+  mPool = 0;
+  mPoolData = 0;
 }
 
 MediaAudio::~MediaAudio() {
   av_frame_free(&mFrame);
 }
 
+void
+MediaAudio::destroy() {
+  MediaAudioPool* pool = mPool;
+  mPool = 0;
+  bool kept = pool && pool->recycle(this);
+  // may free the pool, and with it this if kept
+  if (pool) pool->release();
+  if (!kept) delete this;
+}
+
 MediaAudio*
 MediaAudio::make(int32_t numSamples, int32_t sampleRate, int32_t channels,
     AudioChannel::Layout layout, AudioFormat::Type format) {
@@ -274,6 +287,9 @@ MediaAudio::getNumDataPlanes() {
 int32_t
 MediaAudio::getMaxNumSamples() {
   int32_t bytesPerSample = AudioFormat::getBytesPerSample(getFormat());
+  // interleaved audio has every channel in the one line
+  if (!isPlanar())
+    bytesPerSample *= getChannels();
   int32_t size = bytesPerSample ? mFrame->linesize[0] / bytesPerSample : 0;
   return size;
 }
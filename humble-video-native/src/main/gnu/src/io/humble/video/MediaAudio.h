@@ -373,6 +373,8 @@ protected:
  * MediaAudio#getDataLineSize(int) is the buffer size, in bytes, for the 1 plane.
  * </p>
  */
+class MediaAudioPool;
+
 class VS_API_HUMBLEVIDEO MediaAudio : public MediaSampled
 {
   VS_JNIUTILS_REFCOUNTED_OBJECT_PRIVATE_MAKE(MediaAudio)
@@ -590,14 +592,18 @@ protected:
   MediaAudio();
   virtual
   ~MediaAudio();
+  virtual void destroy();
 private:
+  friend class MediaAudioPool;
   static void
   setBufferType(AudioFormat::Type format,
       io::humble::ferry::Buffer* buffer);
 
   AVFrame* mFrame;
   bool     mComplete;
-
+  /** The pool this was handed out by, if any, and the data it had then. */
+  MediaAudioPool* mPool;
+  uint8_t* mPoolData;
 };
 
 } /* namespace video */
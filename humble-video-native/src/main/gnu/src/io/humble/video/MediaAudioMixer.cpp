@@ -0,0 +1,333 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/Global.h>
+#include "AudioMix.h"
+#include "MediaAudioMixer.h"
+
+#include <string.h>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.MediaAudioMixer);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+MediaAudioMixer::MediaAudioMixer() :
+    mSampleRate(0), mChannelLayout(AudioChannel::CH_LAYOUT_UNKNOWN),
+    mChannels(0), mFormat(AudioFormat::SAMPLE_FMT_NONE), mFrameSize(0),
+    mMaxDelay(0), mPlanes(0), mSampleSize(0), mStride(0),
+    mNextPts(Global::NO_PTS), mDropped(0), mMix(0) {
+}
+
+MediaAudioMixer::~MediaAudioMixer() {
+  for(size_t i = 0; i < mInputs.size(); i++)
+    delete mInputs[i];
+  delete mMix;
+}
+
+MediaAudioMixer*
+MediaAudioMixer::make(int32_t sampleRate, AudioChannel::Layout channelLayout,
+    AudioFormat::Type format, int32_t frameSize) {
+  Global::init();
+  if (sampleRate <= 0)
+    VS_THROW(HumbleInvalidArgument("sampleRate must be > 0"));
+  if (channelLayout == AudioChannel::CH_LAYOUT_UNKNOWN)
+    VS_THROW(HumbleInvalidArgument("channel layout must be specified"));
+  if (frameSize <= 0)
+    VS_THROW(HumbleInvalidArgument("frameSize must be > 0"));
+  const int32_t channels = AudioChannel::getNumChannelsInLayout(channelLayout);
+  if (channels <= 0)
+    VS_THROW(HumbleInvalidArgument("channel layout has no channels"));
+  AudioMix* mix = AudioMix::make((enum AVSampleFormat)format, channels,
+      AudioConversion::getBestLevel());
+  if (!mix)
+    VS_THROW(HumbleInvalidArgument("audio format must be S16 or FLT"));
+
+  RefPointer<MediaAudioMixer> retval = make();
+  retval->mMix = mix;
+  retval->mSampleRate = sampleRate;
+  retval->mChannelLayout = channelLayout;
+  retval->mChannels = channels;
+  retval->mFormat = format;
+  retval->mFrameSize = frameSize;
+  retval->mMaxDelay = sampleRate / 4;
+  const bool planar = av_sample_fmt_is_planar((enum AVSampleFormat)format);
+  retval->mPlanes = planar ? channels : 1;
+  retval->mSampleSize = AudioFormat::getBytesPerSample(format) *
+      (planar ? 1 : channels);
+  retval->resize();
+  VS_LOG_DEBUG("Mixing %s audio with level %d kernels",
+      av_get_sample_fmt_name((enum AVSampleFormat)format), mix->getLevel());
+  return retval.get();
+}
+
+MediaAudioMixer::Input*
+MediaAudioMixer::getInput(int32_t input) {
+  if (input < 0 || input >= (int32_t)mInputs.size())
+    VS_THROW(HumbleInvalidArgument("no such input"));
+  return mInputs[input];
+}
+
+uint8_t*
+MediaAudioMixer::getPlane(Input* input, int32_t plane, int32_t sample) {
+  return &input->data[((int64_t)plane * mStride + input->offset + sample) *
+      mSampleSize];
+}
+
+void
+MediaAudioMixer::compact(Input* input) {
+  if (!input->offset)
+    return;
+  for(int32_t p = 0; p < mPlanes; p++)
+    memmove(&input->data[(int64_t)p * mStride * mSampleSize],
+        getPlane(input, p, 0), input->length * mSampleSize);
+  input->offset = 0;
+}
+
+void
+MediaAudioMixer::resize() {
+  const int32_t capacity = mFrameSize + mMaxDelay;
+  // room for a second buffer's worth means inputs only need compacting
+  // every few frames
+  const int32_t stride = 2 * capacity;
+  for(size_t i = 0; i < mInputs.size(); i++) {
+    Input* input = mInputs[i];
+    compact(input);
+    if (input->length > capacity) {
+      mDropped += input->length - capacity;
+      input->length = capacity;
+    }
+    std::vector<uint8_t> data((int64_t)mPlanes * stride * mSampleSize);
+    for(int32_t p = 0; p < mPlanes; p++)
+      memcpy(&data[(int64_t)p * stride * mSampleSize],
+          &input->data[(int64_t)p * mStride * mSampleSize],
+          input->length * mSampleSize);
+    input->data.swap(data);
+  }
+  mStride = stride;
+}
+
+void
+MediaAudioMixer::setMaxDelay(int32_t maxDelay) {
+  if (maxDelay < 0)
+    VS_THROW(HumbleInvalidArgument("maxDelay must be >= 0"));
+  Lock::Guard g(&mLock);
+  if (maxDelay == mMaxDelay)
+    return;
+  mMaxDelay = maxDelay;
+  resize();
+}
+
+int32_t
+MediaAudioMixer::getMaxDelay() {
+  Lock::Guard g(&mLock);
+  return mMaxDelay;
+}
+
+int32_t
+MediaAudioMixer::addInput(double gain) {
+  Lock::Guard g(&mLock);
+  Input* input = new Input();
+  input->gain = gain;
+  input->ended = false;
+  input->offset = 0;
+  input->length = 0;
+  input->data.resize((int64_t)mPlanes * mStride * mSampleSize);
+  mInputs.push_back(input);
+  return (int32_t)mInputs.size() - 1;
+}
+
+int32_t
+MediaAudioMixer::getNumInputs() {
+  Lock::Guard g(&mLock);
+  return (int32_t)mInputs.size();
+}
+
+void
+MediaAudioMixer::setGain(int32_t input, double gain) {
+  Lock::Guard g(&mLock);
+  getInput(input)->gain = gain;
+}
+
+double
+MediaAudioMixer::getGain(int32_t input) {
+  Lock::Guard g(&mLock);
+  return getInput(input)->gain;
+}
+
+void
+MediaAudioMixer::addAudio(int32_t index, MediaAudio* audio) {
+  Lock::Guard g(&mLock);
+  Input* input = getInput(index);
+  if (input->ended)
+    VS_THROW(HumbleInvalidArgument("input has ended"));
+  if (!audio)
+    VS_THROW(HumbleInvalidArgument("audio must not be null"));
+  if (!audio->isComplete())
+    VS_THROW(HumbleInvalidArgument("audio must be complete"));
+  if (audio->getSampleRate() != mSampleRate
+      || audio->getChannelLayout() != mChannelLayout
+      || audio->getFormat() != mFormat)
+    VS_THROW(HumbleInvalidArgument("audio does not match the mixer's sample rate, channel layout and format"));
+
+  const int32_t numSamples = audio->getNumSamples();
+  int64_t pts = audio->getTimeStamp();
+  if (pts != Global::NO_PTS) {
+    RefPointer<Rational> timeBase = audio->getTimeBase();
+    if (timeBase)
+      pts = Rational::rescale(pts, 1, mSampleRate,
+          timeBase->getNumerator(), timeBase->getDenominator(),
+          Rational::ROUND_NEAR_INF);
+  }
+  if (mNextPts == Global::NO_PTS)
+    mNextPts = pts == Global::NO_PTS ? 0 : pts;
+
+  // where the audio goes, in samples from the head of the mix
+  const int64_t start = pts == Global::NO_PTS ? input->length : pts - mNextPts;
+  const int64_t first = FFMAX(start, 0);
+  const int64_t last = FFMIN(start + numSamples, mFrameSize + mMaxDelay);
+  if (last <= first) {
+    mDropped += numSamples;
+    return;
+  }
+  mDropped += numSamples - (last - first);
+
+  if (input->offset + last > mStride)
+    compact(input);
+  AVFrame* frame = audio->getCtx();
+  for(int32_t p = 0; p < mPlanes; p++) {
+    if (first > input->length)
+      memset(getPlane(input, p, input->length), 0,
+          (first - input->length) * mSampleSize);
+    memcpy(getPlane(input, p, first),
+        frame->extended_data[p] + (first - start) * mSampleSize,
+        (last - first) * mSampleSize);
+  }
+  input->length = FFMAX(input->length, (int32_t)last);
+}
+
+void
+MediaAudioMixer::endInput(int32_t input) {
+  Lock::Guard g(&mLock);
+  getInput(input)->ended = true;
+}
+
+int32_t
+MediaAudioMixer::getNumBuffered(int32_t input) {
+  Lock::Guard g(&mLock);
+  return getInput(input)->length;
+}
+
+int32_t
+MediaAudioMixer::mix(MediaAudio* output) {
+  if (!output)
+    VS_THROW(HumbleInvalidArgument("output must not be null"));
+  if (output->getSampleRate() != mSampleRate
+      || output->getChannelLayout() != mChannelLayout
+      || output->getFormat() != mFormat)
+    VS_THROW(HumbleInvalidArgument("output does not match the mixer's sample rate, channel layout and format"));
+  if (output->getMaxNumSamples() < mFrameSize)
+    VS_THROW(HumbleInvalidArgument("output does not have room for a frame"));
+  output->setComplete(false);
+
+  Lock::Guard g(&mLock);
+  const int32_t numInputs = (int32_t)mInputs.size();
+  const int32_t capacity = mFrameSize + mMaxDelay;
+  bool waiting = false;
+  bool full = false;
+  int32_t longest = 0;
+  for(int32_t i = 0; i < numInputs; i++) {
+    const Input* input = mInputs[i];
+    if (!input->ended && input->length < mFrameSize)
+      waiting = true;
+    if (input->length >= capacity)
+      full = true;
+    longest = FFMAX(longest, input->length);
+  }
+  // unless an input is waited for, every input that has not ended holds a
+  // frame, so this is only short once they all have
+  const int32_t n = !waiting ? FFMIN(mFrameSize, longest) :
+      full ? mFrameSize : 0;
+  if (n <= 0)
+    return 0;
+
+  int32_t numMixed = 0;
+  mPlaneScratch.resize(numInputs * mPlanes);
+  mGainScratch.resize(numInputs);
+  for(int32_t i = 0; i < numInputs; i++) {
+    Input* input = mInputs[i];
+    if (input->gain == 0 || !input->length)
+      continue;
+    if (input->offset + n > mStride)
+      compact(input);
+    for(int32_t p = 0; p < mPlanes; p++) {
+      if (input->length < n)
+        memset(getPlane(input, p, input->length), 0,
+            (n - input->length) * mSampleSize);
+      mPlaneScratch[numMixed * mPlanes + p] = getPlane(input, p, 0);
+    }
+    mGainScratch[numMixed] = (float)input->gain;
+    ++numMixed;
+  }
+  mInScratch.resize(numMixed);
+  for(int32_t i = 0; i < numMixed; i++)
+    mInScratch[i] = &mPlaneScratch[i * mPlanes];
+  mMix->mix(output->getCtx()->extended_data,
+      numMixed ? &mInScratch[0] : 0, numMixed ? &mGainScratch[0] : 0,
+      numMixed, n);
+
+  for(int32_t i = 0; i < numInputs; i++) {
+    Input* input = mInputs[i];
+    if (input->length <= n) {
+      input->offset = 0;
+      input->length = 0;
+    } else {
+      input->offset += n;
+      input->length -= n;
+    }
+  }
+
+  RefPointer<Rational> timeBase = output->getTimeBase();
+  if (!timeBase || timeBase->getNumerator() != 1
+      || timeBase->getDenominator() != mSampleRate) {
+    timeBase = Rational::make(1, mSampleRate);
+    output->setTimeBase(timeBase.value());
+  }
+  output->setNumSamples(n);
+  output->setTimeStamp(mNextPts);
+  output->setComplete(true);
+  mNextPts += n;
+  return n;
+}
+
+int64_t
+MediaAudioMixer::getNumDroppedSamples() {
+  Lock::Guard g(&mLock);
+  return mDropped;
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
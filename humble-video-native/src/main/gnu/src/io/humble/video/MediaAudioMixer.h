@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef MEDIAAUDIOMIXER_H_
+#define MEDIAAUDIOMIXER_H_
+
+#include <vector>
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/RefCounted.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/MediaAudio.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+#ifndef SWIG
+class AudioMix;
+#endif // ! SWIG
+
+/**
+ * Mixes audio from many inputs, such as commentary over program audio or
+ * everyone speaking in a conference, into frames of a fixed number of
+ * samples, each input scaled by its own gain.
+ * <p>
+ * Inputs must already be in the mixer's sample rate, channel layout and
+ * format (use a MediaAudioResampler if they are not), which must be S16 or
+ * FLT, planar or not. S16 is summed in float and clipped once at the end;
+ * FLT is not clipped. Sums use SSE4 or AVX2 kernels where the CPU has them.
+ * </p><p>
+ * Audio is lined up by time stamp: the first time stamp added starts the
+ * mix, and every sample after that goes to its place in the mix whichever
+ * input it came in on. Gaps within an input are silent, audio that
+ * overlaps audio already added to the same input replaces it, and audio
+ * without a time stamp follows on from the last audio added to its input.
+ * Audio for samples that have already been mixed is dropped.
+ * </p><p>
+ * Each input buffers at most #getFrameSize() + #getMaxDelay() samples. A
+ * frame is mixed once every input that has not ended holds a whole frame,
+ * or once any input's buffer is full, in which case inputs that are
+ * behind are treated as silent for that frame. So a stalled input delays
+ * the mix by no more than #getMaxDelay() samples, and audio more than
+ * that far ahead of the mix is dropped. #getNumDroppedSamples() counts
+ * samples dropped for being late or too far ahead.
+ * </p><p>
+ * Mixers are safe to use from several threads.
+ * </p>
+ */
+class VS_API_HUMBLEVIDEO MediaAudioMixer : public io::humble::ferry::RefCounted
+{
+  VS_JNIUTILS_REFCOUNTED_OBJECT_PRIVATE_MAKE(MediaAudioMixer)
+public:
+  /**
+   * Makes a mixer with no inputs.
+   *
+   * @param sampleRate The sample rate of the inputs and the mix.
+   * @param channelLayout The channel layout of the inputs and the mix.
+   * @param format The AudioFormat.Type of the inputs and the mix; S16 or
+   *   FLT, planar or not.
+   * @param frameSize The number of samples in each frame mixed.
+   *
+   * @return a new mixer.
+   *
+   * @throws InvalidArgument if sampleRate or frameSize are not positive,
+   *   channelLayout is unknown, or format is not S16 or FLT.
+   */
+  static MediaAudioMixer*
+  make(int32_t sampleRate, AudioChannel::Layout channelLayout,
+      AudioFormat::Type format, int32_t frameSize);
+
+  /** @return the sample rate of the inputs and the mix. */
+  int32_t getSampleRate() { return mSampleRate; }
+
+  /** @return the channel layout of the inputs and the mix. */
+  AudioChannel::Layout getChannelLayout() { return mChannelLayout; }
+
+  /** @return the number of channels in the channel layout. */
+  int32_t getChannels() { return mChannels; }
+
+  /** @return the AudioFormat.Type of the inputs and the mix. */
+  AudioFormat::Type getFormat() { return mFormat; }
+
+  /** @return the number of samples in each frame mixed. */
+  int32_t getFrameSize() { return mFrameSize; }
+
+  /**
+   * Sets how far an input may run ahead of the mix, which is also the
+   * longest a stalled input can hold up the mix. Audio already buffered
+   * beyond the new limit is dropped.
+   *
+   * @param maxDelay The number of samples; defaults to a quarter of a
+   *   second.
+   *
+   * @throws InvalidArgument if maxDelay is negative.
+   */
+  void setMaxDelay(int32_t maxDelay);
+
+  /** @return how far, in samples, an input may run ahead of the mix. */
+  int32_t getMaxDelay();
+
+  /**
+   * Adds an input.
+   *
+   * @param gain What to multiply the input's samples by; 1 leaves them
+   *   as they are, and 0 leaves the input out of the mix.
+   *
+   * @return the index of the new input, counting from 0.
+   */
+  int32_t addInput(double gain);
+
+  /** @return the number of inputs added. */
+  int32_t getNumInputs();
+
+  /**
+   * Sets an input's gain, from the next frame mixed on.
+   *
+   * @throws InvalidArgument if there is no such input.
+   */
+  void setGain(int32_t input, double gain);
+
+  /**
+   * @return an input's gain.
+   *
+   * @throws InvalidArgument if there is no such input.
+   */
+  double getGain(int32_t input);
+
+  /**
+   * Adds audio to an input. The audio is copied, so it may be reused as
+   * soon as this returns.
+   *
+   * @param input The index of the input.
+   * @param audio The audio to add.
+   *
+   * @throws InvalidArgument if there is no such input, the input has
+   *   ended, audio is null or incomplete, or its sample rate, channel
+   *   layout or format differ from the mixer's.
+   */
+  void addAudio(int32_t input, MediaAudio* audio);
+
+  /**
+   * Ends an input: the mix no longer waits for it, and once every input
+   * has ended, #mix(MediaAudio) drains what is left.
+   *
+   * @throws InvalidArgument if there is no such input.
+   */
+  void endInput(int32_t input);
+
+  /**
+   * @return the number of samples buffered for an input but not yet
+   *   mixed, counting any silent gaps between them.
+   *
+   * @throws InvalidArgument if there is no such input.
+   */
+  int32_t getNumBuffered(int32_t input);
+
+  /**
+   * Mixes the next frame, if it is ready.
+   *
+   * @param output The audio to mix into, with the mixer's sample rate,
+   *   channel layout and format and room for #getFrameSize() samples. It
+   *   is given a 1/#getSampleRate() time base and the time stamp of the
+   *   frame's first sample.
+   *
+   * @return the number of samples mixed: #getFrameSize(), fewer for the
+   *   last frame once every input has ended, or 0 (leaving output
+   *   incomplete) if the next frame is not ready yet.
+   *
+   * @throws InvalidArgument if output is null or does not match the mixer.
+   */
+  int32_t mix(MediaAudio* output);
+
+  /** @return the number of samples dropped from inputs for being late or too far ahead. */
+  int64_t getNumDroppedSamples();
+
+protected:
+  MediaAudioMixer();
+  virtual ~MediaAudioMixer();
+
+private:
+  struct Input {
+    double gain;
+    bool ended;
+    // where the sample at the head of the mix starts in each plane, and
+    // the number of samples after it, in samples
+    int32_t offset;
+    int32_t length;
+    // mPlanes planes of mStride samples
+    std::vector<uint8_t> data;
+  };
+
+  Input* getInput(int32_t input);
+  // sets the size of every input's buffer from the frame size and delay
+  void resize();
+  // moves an input's samples to the start of its planes
+  void compact(Input* input);
+  uint8_t* getPlane(Input* input, int32_t plane, int32_t sample);
+
+  int32_t mSampleRate;
+  AudioChannel::Layout mChannelLayout;
+  int32_t mChannels;
+  AudioFormat::Type mFormat;
+  int32_t mFrameSize;
+  int32_t mMaxDelay;
+  int32_t mPlanes;
+  // bytes per sample in each plane
+  int32_t mSampleSize;
+  // samples each plane of an input has room for
+  int32_t mStride;
+  // the time stamp of the next sample to mix, in 1/mSampleRate units
+  int64_t mNextPts;
+  int64_t mDropped;
+  io::humble::ferry::Lock mLock;
+  std::vector<Input*> mInputs;
+  AudioMix* mMix;
+  // per mix() call scratch
+  std::vector<const uint8_t*> mPlaneScratch;
+  std::vector<const uint8_t* const*> mInScratch;
+  std::vector<float> mGainScratch;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* MEDIAAUDIOMIXER_H_ */
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/Global.h>
+#include "AVBufferSupport.h"
+#include "MediaAudioPool.h"
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.MediaAudioPool);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+MediaAudioPool::MediaAudioPool() :
+    mNumSamples(0), mSampleRate(0), mChannels(0),
+    mChannelLayout(AudioChannel::CH_LAYOUT_UNKNOWN),
+    mFormat(AudioFormat::SAMPLE_FMT_NONE), mCapacity(0),
+    mReused(0), mAllocated(0), mRecycled(0), mDiscarded(0) {
+}
+
+MediaAudioPool::~MediaAudioPool() {
+  for(size_t i = 0; i < mIdle.size(); i++)
+    delete mIdle[i];
+}
+
+MediaAudioPool*
+MediaAudioPool::make(int32_t numSamples, int32_t sampleRate, int32_t channels,
+    AudioChannel::Layout channelLayout, AudioFormat::Type format,
+    int32_t capacity) {
+  Global::init();
+  if (numSamples <= 0)
+    VS_THROW(HumbleInvalidArgument("numSamples must be > 0"));
+  if (sampleRate <= 0)
+    VS_THROW(HumbleInvalidArgument("sampleRate must be > 0"));
+  if (channels <= 0)
+    VS_THROW(HumbleInvalidArgument("channels must be > 0"));
+  if (channelLayout != AudioChannel::CH_LAYOUT_UNKNOWN
+      && channels != AudioChannel::getNumChannelsInLayout(channelLayout))
+    VS_THROW(HumbleInvalidArgument("channel layout does not match number of channels"));
+  if (format == AudioFormat::SAMPLE_FMT_NONE)
+    VS_THROW(HumbleInvalidArgument("audio format must be specified"));
+  if (capacity < 0)
+    VS_THROW(HumbleInvalidArgument("capacity must be >= 0"));
+
+  RefPointer<MediaAudioPool> retval = make();
+  retval->mNumSamples = numSamples;
+  retval->mSampleRate = sampleRate;
+  retval->mChannels = channels;
+  retval->mChannelLayout = channelLayout;
+  retval->mFormat = format;
+  retval->mCapacity = capacity;
+  retval->mIdle.reserve(capacity);
+  return retval.get();
+}
+
+MediaAudio*
+MediaAudioPool::getAudio() {
+  MediaAudio* retval = 0;
+  {
+    Lock::Guard g(&mLock);
+    if (!mIdle.empty()) {
+      retval = mIdle.back();
+      mIdle.pop_back();
+      ++mReused;
+    } else
+      ++mAllocated;
+  }
+  if (retval) {
+    retval->acquire();
+  } else {
+    retval = MediaAudio::make(mNumSamples, mSampleRate, mChannels,
+        mChannelLayout, mFormat);
+    retval->mPoolData = retval->mFrame->data[0];
+  }
+  // the audio keeps us alive until it comes back
+  acquire();
+  retval->mPool = this;
+  return retval;
+}
+
+bool
+MediaAudioPool::recycle(MediaAudio* audio) {
+  AVFrame* frame = audio->mFrame;
+  // decoding or resampling into audio, for one, can swap its buffers for
+  // others; and a filter graph or encoder may still be reading them.
+  bool reusable = frame->data[0] == audio->mPoolData
+      && frame->format == mFormat
+      && av_frame_get_sample_rate(frame) == mSampleRate
+      && av_frame_get_channels(frame) == mChannels
+      && (AudioChannel::Layout)av_frame_get_channel_layout(frame) == mChannelLayout
+      && audio->getMaxNumSamples() >= mNumSamples
+      && av_frame_is_writable(frame);
+
+  Lock::Guard g(&mLock);
+  if (!reusable || (int32_t)mIdle.size() >= mCapacity) {
+    ++mDiscarded;
+    return false;
+  }
+  AVBufferSupport::resetFrame(frame);
+  frame->nb_samples = mNumSamples;
+  audio->mComplete = false;
+  RefPointer<Rational> timeBase = audio->getTimeBase();
+  if (!timeBase || timeBase->getNumerator() != 1
+      || timeBase->getDenominator() != mSampleRate) {
+    timeBase = Rational::make(1, mSampleRate);
+    audio->setTimeBase(timeBase.value());
+  }
+  mIdle.push_back(audio);
+  ++mRecycled;
+  return true;
+}
+
+int32_t
+MediaAudioPool::getNumIdle() {
+  Lock::Guard g(&mLock);
+  return (int32_t)mIdle.size();
+}
+
+int64_t
+MediaAudioPool::getNumReused() {
+  Lock::Guard g(&mLock);
+  return mReused;
+}
+
+int64_t
+MediaAudioPool::getNumAllocated() {
+  Lock::Guard g(&mLock);
+  return mAllocated;
+}
+
+int64_t
+MediaAudioPool::getNumRecycled() {
+  Lock::Guard g(&mLock);
+  return mRecycled;
+}
+
+int64_t
+MediaAudioPool::getNumDiscarded() {
+  Lock::Guard g(&mLock);
+  return mDiscarded;
+}
+
+void
+MediaAudioPool::resetStatistics() {
+  Lock::Guard g(&mLock);
+  mReused = 0;
+  mAllocated = 0;
+  mRecycled = 0;
+  mDiscarded = 0;
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef MEDIAAUDIOPOOL_H_
+#define MEDIAAUDIOPOOL_H_
+
+#include <vector>
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/RefCounted.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/MediaAudio.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Hands out MediaAudio objects of one size, sample rate, channel layout
+ * and format, and takes them back to hand out again once the last
+ * reference to them is released; the audio counterpart of
+ * MediaPicturePool.
+ * <p>
+ * Audio comes back with its samples as they were left, but holding
+ * #getNumSamples() samples again and with every other property reset.
+ * It is only kept if the pool still has room, if it still holds the data
+ * it was handed out with, and if nothing else holds a reference to that
+ * data.
+ * </p><p>
+ * Audio holds a reference to its pool, so a pool lives until all the
+ * audio it handed out has been released. Pools are safe to use from
+ * several threads.
+ * </p>
+ */
+class VS_API_HUMBLEVIDEO MediaAudioPool : public io::humble::ferry::RefCounted
+{
+  VS_JNIUTILS_REFCOUNTED_OBJECT_PRIVATE_MAKE(MediaAudioPool)
+public:
+  /**
+   * Makes a pool of audio laid out as
+   * MediaAudio#make(int, int, int, AudioChannel.Layout, AudioFormat.Type)
+   * lays it out.
+   *
+   * @param numSamples The number of samples each MediaAudio holds.
+   * @param sampleRate The sample rate (per second) of the audio.
+   * @param channels The number of channels of audio.
+   * @param channelLayout The channel layout of the audio.
+   * @param format The format of the audio.
+   * @param capacity The most released MediaAudio objects to keep for reuse.
+   *
+   * @return the pool, empty until audio is released to it.
+   *
+   * @throws InvalidArgument if numSamples, sampleRate or channels are not
+   *   positive, channelLayout does not have that many channels, format is
+   *   AudioFormat.Type.SAMPLE_FMT_NONE, or capacity is negative.
+   */
+  static MediaAudioPool*
+  make(int32_t numSamples, int32_t sampleRate, int32_t channels,
+      AudioChannel::Layout channelLayout, AudioFormat::Type format,
+      int32_t capacity);
+
+  /**
+   * Gets audio, reusing released audio if the pool has any.
+   *
+   * @return audio of this pool's size, sample rate, layout and format.
+   */
+  MediaAudio* getAudio();
+
+  /** @return the number of samples each MediaAudio holds. */
+  int32_t getNumSamples() { return mNumSamples; }
+
+  /** @return the sample rate of the audio. */
+  int32_t getSampleRate() { return mSampleRate; }
+
+  /** @return the number of channels of the audio. */
+  int32_t getChannels() { return mChannels; }
+
+  /** @return the channel layout of the audio. */
+  AudioChannel::Layout getChannelLayout() { return mChannelLayout; }
+
+  /** @return the format of the audio. */
+  AudioFormat::Type getFormat() { return mFormat; }
+
+  /** @return the most released MediaAudio objects kept for reuse. */
+  int32_t getCapacity() { return mCapacity; }
+
+  /** @return the number of released MediaAudio objects waiting to be reused. */
+  int32_t getNumIdle();
+
+  /** @return the number of times #getAudio() reused audio. */
+  int64_t getNumReused();
+
+  /** @return the number of times #getAudio() had to make new audio. */
+  int64_t getNumAllocated();
+
+  /** @return the number of released MediaAudio objects taken back for reuse. */
+  int64_t getNumRecycled();
+
+  /**
+   * @return the number of released MediaAudio objects freed instead,
+   *   because the pool was full or they could not be reused.
+   */
+  int64_t getNumDiscarded();
+
+  /**
+   * Zeros the reused, allocated, recycled and discarded counts.
+   */
+  void resetStatistics();
+
+#ifndef SWIG
+  /**
+   * Called as the last reference to audio from this pool goes; takes the
+   * audio back if it can be reused.
+   * @return true if the pool now owns audio; false if the caller should
+   *   free it.
+   */
+  bool recycle(MediaAudio* audio);
+#endif // ! SWIG
+
+protected:
+  MediaAudioPool();
+  virtual ~MediaAudioPool();
+
+private:
+  int32_t mNumSamples;
+  int32_t mSampleRate;
+  int32_t mChannels;
+  AudioChannel::Layout mChannelLayout;
+  AudioFormat::Type mFormat;
+  int32_t mCapacity;
+  io::humble::ferry::Lock mLock;
+  std::vector<MediaAudio*> mIdle;
+  int64_t mReused;
+  int64_t mAllocated;
+  int64_t mRecycled;
+  int64_t mDiscarded;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* MEDIAAUDIOPOOL_H_ */
@@ -29,6 +29,9 @@
 #include <io/humble/video/VideoExceptions.h>
 #include <io/humble/video/MediaAudio.h>
 #include "MediaAudioResampler.h"
+#include "AudioConversion.h"
+
+#include <float.h>
 
 using namespace io::humble::ferry;
 
@@ -38,14 +41,65 @@ namespace video {
 
 VS_LOG_SETUP(VS_CPP_PACKAGE.MediaAudioResampler);
 
+namespace {
+
+// an audio layout has at most one bit per channel
+const int32_t MediaAudioResampler_maxPlanes = 64;
+
+// points out at sample offset of the planes in data
+void
+MediaAudioResampler_offset(uint8_t** out, uint8_t* const* data,
+    AudioFormat::Type format, int32_t channels, int32_t offset) {
+  const enum AVSampleFormat fmt = (enum AVSampleFormat)format;
+  const bool planar = av_sample_fmt_is_planar(fmt);
+  const int32_t step = av_get_bytes_per_sample(fmt) * (planar ? 1 : channels);
+  for(int32_t i = 0; i < (planar ? channels : 1); i++)
+    out[i] = data[i] + offset * step;
+}
+
+// true if no property that would change the samples from swresample's
+// defaults has been set
+bool
+MediaAudioResampler_isDefault(SwrContext* ctx) {
+  int64_t flags = 0;
+  int64_t dither = 0;
+  int64_t internal = AV_SAMPLE_FMT_NONE;
+  int64_t used = 0;
+  double volume = 1.0;
+  double maxval = 0.0;
+  double minComp = FLT_MAX;
+  av_opt_get_int(ctx, "flags", 0, &flags);
+  av_opt_get_int(ctx, "dither_method", 0, &dither);
+  av_opt_get_int(ctx, "internal_sample_fmt", 0, &internal);
+  av_opt_get_int(ctx, "uch", 0, &used);
+  av_opt_get_double(ctx, "rmvol", 0, &volume);
+  av_opt_get_double(ctx, "rematrix_maxval", 0, &maxval);
+  av_opt_get_double(ctx, "min_comp", 0, &minComp);
+  return !flags && !dither && internal == AV_SAMPLE_FMT_NONE && !used &&
+      volume == 1.0 && maxval == 0.0 && minComp >= FLT_MAX;
+}
+
+}
+
 MediaAudioResampler::MediaAudioResampler() {
   mCtx = swr_alloc();
   mState = STATE_INITED;
+  mOutLayout = mInLayout = AudioChannel::CH_LAYOUT_UNKNOWN;
+  mOutSampleRate = mInSampleRate = 0;
+  mOutFormat = mInFormat = AudioFormat::SAMPLE_FMT_NONE;
+  mOutChannels = mInChannels = 0;
+  mFastPaths = true;
+  mConversion = 0;
+  mPending = 0;
+  mPendingPts = 0;
   if (!mCtx) {
     VS_THROW(HumbleBadAlloc());
   }
 }
 MediaAudioResampler::~MediaAudioResampler() {
+  delete mConversion;
+  if (mPending)
+    av_audio_fifo_free(mPending);
   swr_free(&mCtx);
 }
 
@@ -70,6 +124,15 @@ MediaAudioResampler::make(AudioChannel::Layout outLayout, int32_t outSampleRate,
 
   retval.reset(new MediaAudioResampler(), true);
 
+  retval->mOutLayout = outLayout;
+  retval->mOutSampleRate = outSampleRate;
+  retval->mOutFormat = outFormat;
+  retval->mOutChannels = av_get_channel_layout_nb_channels(outLayout);
+  retval->mInLayout = inLayout;
+  retval->mInSampleRate = inSampleRate;
+  retval->mInFormat = inFormat;
+  retval->mInChannels = av_get_channel_layout_nb_channels(inLayout);
+
   av_opt_set_int(retval->mCtx, "ocl", outLayout,   0);
   av_opt_set_int(retval->mCtx, "osf", outFormat,  0);
   av_opt_set_int(retval->mCtx, "osr", outSampleRate, 0);
@@ -77,8 +140,8 @@ MediaAudioResampler::make(AudioChannel::Layout outLayout, int32_t outSampleRate,
   av_opt_set_int(retval->mCtx, "isf", inFormat,   0);
   av_opt_set_int(retval->mCtx, "isr", inSampleRate,  0);
   av_opt_set_int(retval->mCtx, "tsf", AV_SAMPLE_FMT_NONE,   0);
-  av_opt_set_int(retval->mCtx, "ich", av_get_channel_layout_nb_channels(inLayout), 0);
-  av_opt_set_int(retval->mCtx, "och", av_get_channel_layout_nb_channels(outLayout), 0);
+  av_opt_set_int(retval->mCtx, "ich", retval->mInChannels, 0);
+  av_opt_set_int(retval->mCtx, "och", retval->mOutChannels, 0);
   av_opt_set_int(retval->mCtx, "uch", 0, 0);
 
   // find the LCM of the input and output sample rates
@@ -95,76 +158,48 @@ MediaAudioResampler::make(AudioChannel::Layout outLayout, int32_t outSampleRate,
 
 AudioChannel::Layout
 MediaAudioResampler::getOutputLayout() {
-  int64_t val;
-  if(av_opt_get_int(mCtx, "ocl", 0, &val) < 0)
-    return AudioChannel::CH_LAYOUT_UNKNOWN;
-  else
-    return (AudioChannel::Layout)val;
+  return mOutLayout;
 }
 
 AudioChannel::Layout
 MediaAudioResampler::getInputLayout() {
-  int64_t val;
-  if(av_opt_get_int(mCtx, "icl", 0, &val) < 0)
-    return AudioChannel::CH_LAYOUT_UNKNOWN;
-  else
-    return (AudioChannel::Layout)val;
+  return mInLayout;
 }
 
 int32_t
 MediaAudioResampler::getOutputSampleRate() {
-  int64_t val;
-  if(av_opt_get_int(mCtx, "osr", 0, &val) < 0)
-    return -1;
-  else
-    return (int32_t)val;
+  return mOutSampleRate;
 }
 
 int32_t
 MediaAudioResampler::getInputSampleRate() {
-  int64_t val;
-  if(av_opt_get_int(mCtx, "isr", 0, &val) < 0)
-    return -1;
-  else
-    return (int32_t)val;
+  return mInSampleRate;
 }
 
 AudioFormat::Type
 MediaAudioResampler::getOutputFormat() {
-  int64_t val;
-  if(av_opt_get_int(mCtx, "osf", 0, &val) < 0)
-    return AudioFormat::SAMPLE_FMT_NONE;
-  else
-    return (AudioFormat::Type)val;
+  return mOutFormat;
 }
 
 AudioFormat::Type
 MediaAudioResampler::getInputFormat() {
-  int64_t val;
-  if(av_opt_get_int(mCtx, "isf", 0, &val) < 0)
-    return AudioFormat::SAMPLE_FMT_NONE;
-  else
-    return (AudioFormat::Type)val;
+  return mInFormat;
 }
 
 int32_t
 MediaAudioResampler::getInputChannels() {
-  int64_t val;
-  if(av_opt_get_int(mCtx, "ich", 0, &val) < 0)
-    return -1;
-  else
-    return (int32_t)val;
+  return mInChannels;
 }
 
 int32_t
 MediaAudioResampler::getOutputChannels() {
-  int64_t val;
-  if(av_opt_get_int(mCtx, "och", 0, &val) < 0)
-    return -1;
-  else
-    return (int32_t)val;
+  return mOutChannels;
 }
 
+void
+MediaAudioResampler::setFastPaths(bool fastPaths) {
+  mFastPaths = fastPaths;
+}
 
 void
 MediaAudioResampler::open() {
@@ -173,6 +208,40 @@ MediaAudioResampler::open() {
     mState = STATE_ERROR;
     FfmpegException::check(retval, "Could not open audio resampler: ");
   }
+  // properties may have been set since make(), so read them back once
+  int64_t val;
+  if (av_opt_get_int(mCtx, "ocl", 0, &val) >= 0)
+    mOutLayout = (AudioChannel::Layout)val;
+  if (av_opt_get_int(mCtx, "osr", 0, &val) >= 0)
+    mOutSampleRate = (int32_t)val;
+  if (av_opt_get_int(mCtx, "osf", 0, &val) >= 0)
+    mOutFormat = (AudioFormat::Type)val;
+  if (av_opt_get_int(mCtx, "och", 0, &val) >= 0)
+    mOutChannels = (int32_t)val;
+  if (av_opt_get_int(mCtx, "icl", 0, &val) >= 0)
+    mInLayout = (AudioChannel::Layout)val;
+  if (av_opt_get_int(mCtx, "isr", 0, &val) >= 0)
+    mInSampleRate = (int32_t)val;
+  if (av_opt_get_int(mCtx, "isf", 0, &val) >= 0)
+    mInFormat = (AudioFormat::Type)val;
+  if (av_opt_get_int(mCtx, "ich", 0, &val) >= 0)
+    mInChannels = (int32_t)val;
+
+  if (mPending)
+    av_audio_fifo_reset(mPending);
+  delete mConversion;
+  mConversion = 0;
+  if (mFastPaths && mInSampleRate == mOutSampleRate &&
+      MediaAudioResampler_isDefault(mCtx))
+    mConversion = AudioConversion::make(
+        mOutLayout, (enum AVSampleFormat)mOutFormat,
+        mInLayout, (enum AVSampleFormat)mInFormat,
+        AudioConversion::getBestLevel());
+  if (mConversion)
+    VS_LOG_DEBUG("Converting audio %s -> %s with level %d kernels",
+        av_get_sample_fmt_name((enum AVSampleFormat)mInFormat),
+        av_get_sample_fmt_name((enum AVSampleFormat)mOutFormat),
+        mConversion->getLevel());
   mState = STATE_OPENED;
 }
 
@@ -195,34 +264,115 @@ MediaAudioResampler::resample(MediaSampled* aOut, MediaSampled*aIn)
     VS_THROW(HumbleInvalidArgument("out must be a MediaAudio object"));
   return resampleAudio(out, in);
 }
-int32_t
-MediaAudioResampler::resampleAudio(MediaAudio* out, MediaAudio* in) {
 
-  if (mState != STATE_OPENED)
-    VS_THROW(HumbleRuntimeError("Must call open() on resampler before using"));
-  if (in) {
-    if (in->getFormat() != getInputFormat())
-      VS_THROW(HumbleInvalidArgument("input audio format does not match what resampler expected"));
-    if (in->getSampleRate() != getInputSampleRate())
-      VS_THROW(HumbleInvalidArgument("input audio sample rate does not match what resampler expected"));
-    if (in->getChannelLayout() != getInputLayout())
-      VS_THROW(HumbleInvalidArgument("input audio channel layout does not match what resampler expected"));
-  }
+void
+MediaAudioResampler::checkInput(MediaAudio* in) {
+  if (in->getFormat() != mInFormat)
+    VS_THROW(HumbleInvalidArgument("input audio format does not match what resampler expected"));
+  if (in->getSampleRate() != mInSampleRate)
+    VS_THROW(HumbleInvalidArgument("input audio sample rate does not match what resampler expected"));
+  if (in->getChannelLayout() != mInLayout)
+    VS_THROW(HumbleInvalidArgument("input audio channel layout does not match what resampler expected"));
+}
+
+void
+MediaAudioResampler::checkOutput(MediaAudio* out) {
   if (!out)
     VS_THROW(HumbleInvalidArgument("output must be specified"));
 
-  if (out->getFormat() != getOutputFormat())
+  if (out->getFormat() != mOutFormat)
     VS_THROW(HumbleInvalidArgument("output audio format does not match what resampler expected"));
-  if (out->getSampleRate() != getOutputSampleRate())
+  if (out->getSampleRate() != mOutSampleRate)
     VS_THROW(HumbleInvalidArgument("output audio sample rate does not match what resampler expected"));
-  if (out->getChannelLayout() != getOutputLayout())
+  if (out->getChannelLayout() != mOutLayout)
     VS_THROW(HumbleInvalidArgument("output audio channel layout does not match what resampler expected"));
+}
+
+int32_t
+MediaAudioResampler::convert(uint8_t** out, int32_t outCount,
+    const uint8_t** in, int32_t inCount) {
+  // the fast path only when swresample has nothing buffered to come first
+  if (mConversion && in && inCount <= outCount &&
+      swr_get_delay(mCtx, mInSampleRate) == 0) {
+    mConversion->convert(out, in, inCount);
+    // and move swresample's clock on as if it had done the work
+    swr_next_pts(mCtx, swr_next_pts(mCtx, INT64_MIN) +
+        inCount * (int64_t)mInSampleRate);
+    return inCount;
+  }
+  int retval = swr_convert(mCtx, out, outCount, in, inCount);
+  if (retval < 0) {
+    FfmpegException::check(retval, "Could not convert audio ");
+  }
+  return retval;
+}
+
+void
+MediaAudioResampler::convertToPending(const uint8_t** in, int32_t inCount) {
+  if (!mPending) {
+    mPending = av_audio_fifo_alloc((enum AVSampleFormat)mOutFormat,
+        mOutChannels, 1);
+    if (!mPending)
+      VS_THROW(HumbleBadAlloc());
+  }
+  if (!av_audio_fifo_size(mPending))
+    mPendingPts = swr_next_pts(mCtx, INT64_MIN);
+  // anything swresample holds comes out before this input, and flushing
+  // may take more than one go
+  int32_t needed = FFMAX(swr_get_out_samples(mCtx, inCount), inCount);
+  if (!mScratch || mScratch->getMaxNumSamples() < needed)
+    mScratch = MediaAudio::make(FFMAX(needed, 1024), mOutSampleRate,
+        mOutChannels, mOutLayout, mOutFormat);
+  uint8_t** scratch = mScratch->getCtx()->extended_data;
+  int32_t n;
+  do {
+    n = convert(scratch, mScratch->getMaxNumSamples(), in, inCount);
+    if (n > 0 && av_audio_fifo_write(mPending, (void**)scratch, n) < n)
+      VS_THROW(HumbleBadAlloc());
+    inCount = 0;
+  } while (n > 0);
+}
+
+int32_t
+MediaAudioResampler::readPending(uint8_t** out, int32_t count) {
+  int32_t n = mPending ? FFMIN(av_audio_fifo_size(mPending), count) : 0;
+  if (n > 0) {
+    av_audio_fifo_read(mPending, (void**)out, n);
+    mPendingPts += n * (int64_t)mInSampleRate;
+  }
+  return n;
+}
+
+void
+MediaAudioResampler::finish(MediaAudio* out, int64_t pts, int32_t numSamples) {
+  AVFrame* outFrame = out->getCtx();
+  // convert the 1/(in rate * out rate) time stamp to the right timebase
+  outFrame->pts = Rational::rescale(pts,
+      mTimeBase->getNumerator(), mTimeBase->getDenominator(),
+      1, mInSampleRate * mOutSampleRate,
+      Rational::ROUND_DOWN);
+  // and set our time base.
+  out->setTimeBase(mTimeBase.value());
+  outFrame->nb_samples = numSamples;
+  out->setComplete(numSamples > 0);
+}
+
+int32_t
+MediaAudioResampler::resampleAudio(MediaAudio* out, MediaAudio* in) {
+
+  if (mState != STATE_OPENED)
+    VS_THROW(HumbleRuntimeError("Must call open() on resampler before using"));
+  if (in)
+    checkInput(in);
+  checkOutput(out);
 
   out->setComplete(false);
 
   AVFrame* outFrame = out->getCtx();
   AVFrame* inFrame = in ? in->getCtx() : 0;
-
+  const int32_t outCount = out->getMaxNumSamples();
+  const uint8_t** inData = inFrame ? (const uint8_t**)inFrame->extended_data : 0;
+  const int32_t inCount = inFrame ? inFrame->nb_samples : 0;
 
   // first convert PTS to sample number
   int64_t inputTs = Global::NO_PTS;
@@ -231,31 +381,31 @@ MediaAudioResampler::resampleAudio(MediaAudio* out, MediaAudio* in) {
     RefPointer<Rational> inBase = in->getTimeBase();
     /// convert to 1/samplerate
     inputTs = Rational::rescale(inputTs, 1,
-        getInputSampleRate()*getOutputSampleRate(),
+        mInSampleRate*mOutSampleRate,
         inBase ? inBase->getNumerator() : 1,
-        inBase ? inBase->getDenominator() : getInputSampleRate(),
+        inBase ? inBase->getDenominator() : mInSampleRate,
         Rational::ROUND_DOWN);
   }
-  // now convert the new PTS back to the right timebase
-  outFrame->pts = Rational::rescale(
-      getNextPts(inputTs == Global::NO_PTS ? LONG_LONG_MIN : inputTs),
-      mTimeBase->getNumerator(), mTimeBase->getDenominator(),
-      1, getInputSampleRate() * getOutputSampleRate(),
-      Rational::ROUND_DOWN);
-  // and set our time base.
-  out->setTimeBase(mTimeBase.value());
-
-  // now, we know the audio is hidden in extended_data
-  int retval = swr_convert(mCtx,
-      outFrame->extended_data,
-      out->getMaxNumSamples(),
-      inFrame? (const uint8_t**)inFrame->extended_data : 0,
-      inFrame ? inFrame->nb_samples : 0);
-  if (retval < 0) {
-    FfmpegException::check(retval, "Could not convert audio ");
+  int64_t pts = getNextPts(inputTs == Global::NO_PTS ? LONG_LONG_MIN : inputTs);
+
+  int32_t retval = 0;
+  if (mPending && av_audio_fifo_size(mPending)) {
+    // anything held back by resampleBatch() comes out first
+    pts = mPendingPts;
+    retval = readPending(outFrame->extended_data, outCount);
+    if (!av_audio_fifo_size(mPending)) {
+      uint8_t* data[MediaAudioResampler_maxPlanes];
+      MediaAudioResampler_offset(data, outFrame->extended_data, mOutFormat,
+          mOutChannels, retval);
+      retval += convert(data, outCount - retval, inData, inCount);
+    } else if (in) {
+      convertToPending(inData, inCount);
+    }
+  } else {
+    // now, we know the audio is hidden in extended_data
+    retval = convert(outFrame->extended_data, outCount, inData, inCount);
   }
-  outFrame->nb_samples = retval;
-  out->setComplete(retval > 0);
+  finish(out, pts, retval);
 #ifdef VS_DEBUG
   {
     char inDescr[256];
@@ -276,6 +426,121 @@ MediaAudioResampler::resampleAudio(MediaAudio* out, MediaAudio* in) {
 
 }
 
+int32_t
+MediaAudioResampler::resampleBatch(MediaAudio** outs, int32_t numOuts,
+    MediaAudio** ins, int32_t numIns) {
+  if (mState != STATE_OPENED)
+    VS_THROW(HumbleRuntimeError("Must call open() on resampler before using"));
+  if (numOuts < 0 || (numOuts && !outs))
+    VS_THROW(HumbleInvalidArgument("outputs must be specified"));
+  if (numIns < 0 || (numIns && !ins))
+    VS_THROW(HumbleInvalidArgument("inputs must be specified"));
+  for(int32_t i = 0; i < numOuts; i++) {
+    checkOutput(outs[i]);
+    if (outs[i]->getMaxNumSamples() <= 0)
+      VS_THROW(HumbleInvalidArgument("outputs must have room for samples"));
+  }
+  for(int32_t i = 0; i < numIns; i++)
+    if (ins[i])
+      checkInput(ins[i]);
+
+  int32_t filled = 0;
+  int32_t written = 0;
+  int64_t pts = 0;
+  uint8_t* data[MediaAudioResampler_maxPlanes];
+
+  // anything held back last time comes out first
+  while(filled < numOuts && mPending && av_audio_fifo_size(mPending)) {
+    MediaAudio* out = outs[filled];
+    if (!written)
+      pts = mPendingPts;
+    MediaAudioResampler_offset(data, out->getCtx()->extended_data,
+        mOutFormat, mOutChannels, written);
+    written += readPending(data, out->getMaxNumSamples() - written);
+    if (written == out->getMaxNumSamples()) {
+      finish(out, pts, written);
+      ++filled;
+      written = 0;
+    }
+  }
+
+  // a flush is a single null input to swresample
+  for(int32_t i = 0; i < FFMAX(numIns, 1); i++) {
+    MediaAudio* in = numIns ? ins[i] : 0;
+    if (numIns && !in)
+      continue;
+    const uint8_t* inData[MediaAudioResampler_maxPlanes];
+    int32_t inCount = 0;
+    if (in) {
+      int64_t inputTs = in->getTimeStamp();
+      if (inputTs != Global::NO_PTS) {
+        RefPointer<Rational> inBase = in->getTimeBase();
+        getNextPts(Rational::rescale(inputTs, 1,
+            mInSampleRate*mOutSampleRate,
+            inBase ? inBase->getNumerator() : 1,
+            inBase ? inBase->getDenominator() : mInSampleRate,
+            Rational::ROUND_DOWN));
+      }
+      MediaAudioResampler_offset((uint8_t**)inData,
+          in->getCtx()->extended_data, mInFormat, mInChannels, 0);
+      inCount = in->getNumSamples();
+    }
+    while(filled < numOuts) {
+      MediaAudio* out = outs[filled];
+      const int32_t outCount = out->getMaxNumSamples();
+      if (!written)
+        pts = swr_next_pts(mCtx, INT64_MIN);
+      MediaAudioResampler_offset(data, out->getCtx()->extended_data,
+          mOutFormat, mOutChannels, written);
+      const int32_t space = outCount - written;
+      int32_t n;
+      if (inCount > 0 && mConversion &&
+          swr_get_delay(mCtx, mInSampleRate) == 0) {
+        // convert straight into the output, a piece at a time
+        n = convert(data, space, inData, FFMIN(inCount, space));
+        MediaAudioResampler_offset((uint8_t**)inData, (uint8_t**)inData,
+            mInFormat, mInChannels, n);
+        inCount -= n;
+      } else {
+        // swresample takes the lot, buffering what does not fit, and
+        // hands that back when called again with no more input
+        n = convert(data, space, in ? inData : 0, inCount);
+        inCount = 0;
+      }
+      written += n;
+      if (written < outCount)
+        // nothing more to come out until the next input
+        break;
+      finish(out, pts, written);
+      ++filled;
+      written = 0;
+    }
+    if (filled == numOuts)
+      convertToPending(in ? inData : 0, inCount);
+  }
+
+  if (written) {
+    if (!numIns) {
+      // flushing; the last output may be short
+      finish(outs[filled], pts, written);
+      ++filled;
+    } else {
+      // hold back what does not make a whole output
+      if (!mPending) {
+        mPending = av_audio_fifo_alloc((enum AVSampleFormat)mOutFormat,
+            mOutChannels, written);
+        if (!mPending)
+          VS_THROW(HumbleBadAlloc());
+      }
+      mPendingPts = pts;
+      if (av_audio_fifo_write(mPending,
+          (void**)outs[filled]->getCtx()->extended_data, written) < written)
+        VS_THROW(HumbleBadAlloc());
+    }
+  }
+  return filled;
+}
+
 int64_t
 MediaAudioResampler::getNextPts(int64_t pts) {
   return swr_next_pts(mCtx, pts);
@@ -284,11 +549,17 @@ MediaAudioResampler::getNextPts(int64_t pts) {
 void
 MediaAudioResampler::setCompensation(int32_t sample_delta,
     int32_t compensation_distance) {
+  // the fast path does not resample
+  delete mConversion;
+  mConversion = 0;
   swr_set_compensation(mCtx, sample_delta, compensation_distance);
 }
 
 int32_t
 MediaAudioResampler::dropOutput(int32_t count) {
+  // nor does it drop samples
+  delete mConversion;
+  mConversion = 0;
   return swr_drop_output(mCtx, count);
 }
 
@@ -304,7 +575,7 @@ MediaAudioResampler::getDelay(int64_t base) {
 
 int32_t
 MediaAudioResampler::getNumResampledSamples(int32_t numSamples) {
-  return av_rescale_rnd(getOutputSampleRate(), numSamples, getInputSampleRate(), AV_ROUND_UP);
+  return av_rescale_rnd(mOutSampleRate, numSamples, mInSampleRate, AV_ROUND_UP);
 }
 
 } /* namespace video */
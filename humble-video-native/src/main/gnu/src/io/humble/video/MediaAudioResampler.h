@@ -33,6 +33,8 @@ namespace io {
 namespace humble {
 namespace video {
 
+class AudioConversion;
+
 /**
  * A MediaAudioResampler object resamples MediaAudio objects from
  * one format/sample-rate/channel-layout to another.
@@ -86,6 +88,38 @@ public:
    */
   virtual int32_t getOutputChannels();
 
+  /**
+   * Set whether dedicated conversion routines may be used instead of the
+   * general purpose resampler when the parameters allow it.
+   * <p>
+   * When the input and output sample rates are the same, S16 and FLT
+   * audio, planar or interleaved, is converted between formats, and mixed
+   * from stereo to mono or mono to stereo, by routines written for SSE4
+   * and AVX2 and picked at run time for the CPU. They produce exactly the
+   * same samples as the general resampler, and are not used once
+   * #setCompensation(int,int) or #dropOutput(int) have been called, or if
+   * properties that change the output (such as dithering, timestamp
+   * compensation or the rematrix volume) have been set.
+   * </p>
+   * Must be called before #open().
+   *
+   * @param fastPaths true (the default) to allow them, false to always use
+   *   the general resampler.
+   */
+  virtual void setFastPaths(bool fastPaths);
+
+  /**
+   * @return whether dedicated conversion routines are allowed.
+   * @see #setFastPaths(boolean)
+   */
+  virtual bool getFastPaths() { return mFastPaths; }
+
+  /**
+   * @return true if this resampler is open and converting with one of the
+   *   dedicated routines described in #setFastPaths(boolean).
+   */
+  virtual bool usesFastPath() { return mConversion != 0; }
+
   /**
    * Opens the resampler so it can be ready for resampling.
    * You should NOT set options after you open this object.
@@ -112,6 +146,32 @@ public:
   virtual int32_t resample(MediaSampled* out, MediaSampled* in);
   virtual int32_t resampleAudio(MediaAudio* out, MediaAudio* in);
 
+#ifndef SWIG
+  /**
+   * Convert many pieces of input audio into whole output audio objects,
+   * such as the fixed size frames an encoder wants.
+   * <p>
+   * Each output is filled to its MediaAudio#getMaxNumSamples(), in order,
+   * and gets the time stamp of its first sample. Samples that do not fill
+   * a whole output are held back and come out first on the next call (or
+   * the next call to #resampleAudio(MediaAudio,MediaAudio)), as are any
+   * that do not fit in the outputs given. Pass no inputs to flush
+   * everything out at the end; the last output filled may then be short.
+   * </p>
+   *
+   * @param outs      output audio objects, all of the output format.
+   * @param numOuts   number of outputs.
+   * @param ins       input audio, in order; null entries are skipped.
+   * @param numIns    number of inputs, or 0 to flush.
+   *
+   * @return the number of outputs filled; those after it are left alone.
+   * @throws RuntimeError if we get an error or InvalidArgument if the attributes of
+   *   any input or output do not match what this resampler expected.
+   */
+  virtual int32_t resampleBatch(MediaAudio** outs, int32_t numOuts,
+      MediaAudio** ins, int32_t numIns);
+#endif // ! SWIG
+
   /**
    * Convert the next timestamp from input to output
    * timestamps are in 1/(in_sample_rate * out_sample_rate) units.
@@ -153,6 +213,7 @@ public:
 
   /**
    * Drops the specified number of output samples.
+   * Samples held back by #resampleBatch are not dropped.
    * @return # of samples dropped.
    */
   virtual int32_t dropOutput(int32_t count);
@@ -225,9 +286,39 @@ protected:
   virtual
   ~MediaAudioResampler();
 private:
+  void checkInput(MediaAudio* in);
+  void checkOutput(MediaAudio* out);
+  // converts with the fast path if it can, or swresample; returns the
+  // number of samples output
+  int32_t convert(uint8_t** out, int32_t outCount,
+      const uint8_t** in, int32_t inCount);
+  // the same, but to the end of the held back samples
+  void convertToPending(const uint8_t** in, int32_t inCount);
+  int32_t readPending(uint8_t** out, int32_t count);
+  void finish(MediaAudio* out, int64_t pts, int32_t numSamples);
+
   SwrContext* mCtx;
   State mState;
   io::humble::ferry::RefPointer<Rational> mTimeBase;
+
+  // set in make(), so checking audio needs no option lookups
+  AudioChannel::Layout mOutLayout;
+  int32_t mOutSampleRate;
+  AudioFormat::Type mOutFormat;
+  int32_t mOutChannels;
+  AudioChannel::Layout mInLayout;
+  int32_t mInSampleRate;
+  AudioFormat::Type mInFormat;
+  int32_t mInChannels;
+
+  bool mFastPaths;
+  AudioConversion* mConversion;
+
+  // samples held back by resampleBatch(), in the output format, and the
+  // time stamp of the first in 1/(in rate * out rate) units
+  AVAudioFifo* mPending;
+  int64_t mPendingPts;
+  io::humble::ferry::RefPointer<MediaAudio> mScratch;
 };
 
 } /* namespace video */
@@ -362,7 +362,9 @@ namespace io { namespace humble { namespace video {
   }
   void
   MediaPacketImpl::setCoder(Coder* coder) {
-    mCoder.reset(coder, true);
+    // packets are usually reused for the same stream; skip the ref-count churn.
+    if (mCoder.value() != coder)
+      mCoder.reset(coder, true);
   }
   int64_t
   MediaPacketImpl::logMetadata(char* buffer, size_t len)
@@ -52,7 +52,7 @@ class VS_API_HUMBLEVIDEO MediaPacketImpl : public io::humble::video::MediaPacket
     virtual void setTimeStamp(int64_t aTimeStamp) { setDts(aTimeStamp); }
     virtual bool isKey() { return isKeyPacket(); }
     virtual Rational* getTimeBase() { return mTimeBase.get(); }
-    virtual void setTimeBase(Rational *aBase) { mTimeBase.reset(aBase, true); }
+    virtual void setTimeBase(Rational *aBase) { if (mTimeBase.value() != aBase) mTimeBase.reset(aBase, true); }
     
     virtual int64_t getPts();
     virtual int64_t getDts();
@@ -49,6 +49,14 @@ MediaPicture::make(int32_t width, int32_t height, PixelFormat::Type format)
   return MediaPictureImpl::make(width, height, format);
 }
 
+MediaPicture*
+MediaPicture::make(int32_t width, int32_t height, PixelFormat::Type format,
+    int32_t alignment)
+{
+  Global::init();
+  return MediaPictureImpl::make(width, height, format, alignment);
+}
+
 MediaPicture*
 MediaPicture::make(io::humble::ferry::Buffer* buffer, int32_t width, int32_t height,
     PixelFormat::Type format)
@@ -64,6 +72,15 @@ MediaPicture::make(MediaPicture* src, bool copy)
   return MediaPictureImpl::make(dynamic_cast<MediaPictureImpl*>(src), copy);
 }
 
+MediaPicture*
+MediaPicture::makeView(MediaPicture* src, int32_t x, int32_t y, int32_t width,
+    int32_t height)
+{
+  Global::init();
+  return MediaPictureImpl::makeView(dynamic_cast<MediaPictureImpl*>(src), x, y,
+      width, height);
+}
+
 } /* namespace video */
 } /* namespace humble */
 } /* namespace io */
@@ -68,6 +68,12 @@ public:
 
   /**
    * Create a media picture.
+   * <p>
+   * Each row of each plane starts on a 64 byte boundary, with line sizes
+   * padded to match, so SIMD code in resamplers, filters and encoders can
+   * use aligned loads and stores. Use #make(int, int, PixelFormat.Type, int)
+   * with an alignment of 1 for rows packed one after another.
+   * </p>
    *
    * @param width Number of pixels wide.
    * @param height Number of pixels high.
@@ -82,6 +88,12 @@ public:
 
   /**
    * Create a media picture using a buffer as the memory backing it.
+   * <p>
+   * The planes are packed: each row follows the one before it, with
+   * line sizes no larger than a row of pixels needs, and each plane
+   * follows the one before it, exactly as
+   * PixelFormat#getBufferSizeNeeded(int, int, PixelFormat.Type) counts.
+   * </p>
    *
    * @param buffer A buffer of data to use for the image.
    * @param width Number of pixels wide.
@@ -109,6 +121,60 @@ public:
   static MediaPicture*
   make(MediaPicture* src, bool copy);
 
+  /**
+   * Create a media picture whose rows start on a given boundary.
+   * <p>
+   * Line sizes are padded up to a multiple of alignment and every plane
+   * starts on such a boundary. An alignment of 1 packs the rows and
+   * planes one after another, as #make(Buffer, int, int, PixelFormat.Type)
+   * does, for callers that want the picture as contiguous bytes.
+   * </p>
+   *
+   * @param width Number of pixels wide.
+   * @param height Number of pixels high.
+   * @param format PixelFormat.Type of the MediaPicture
+   * @param alignment The boundary, in bytes; a power of two from 1 to 256.
+   *
+   * @return A MediaPicture with memory allocated for it.
+   *
+   * @throws InvalidArgument if width or height are not positive, format is
+   *   PixelFormat.Type.PIX_FMT_NONE or cannot be allocated, or alignment
+   *   is not a power of two from 1 to 256.
+   */
+  static MediaPicture*
+  make(int32_t width, int32_t height, PixelFormat::Type format,
+      int32_t alignment);
+
+  /**
+   * Create a picture of a rectangle within src, without copying any data.
+   * <p>
+   * The new picture references the same underlying buffers as src, with
+   * its data starting at the top left of the rectangle and the same line
+   * sizes, so writing to either changes what the other holds. It can be
+   * passed anywhere a picture is read from, such as an Encoder, a
+   * FilterPictureSource or a MediaPictureResampler; bear in mind its rows
+   * need not start on the alignment a freshly allocated picture has.
+   * Meta-data such as the time stamp and time base is copied from src.
+   * </p>
+   *
+   * @param src A source MediaPicture.
+   * @param x The left edge of the rectangle, in pixels. Must be a multiple
+   *   of the horizontal chroma subsampling of src's format (2 for YUV420P).
+   * @param y The top edge of the rectangle, in pixels. Must be a multiple
+   *   of the vertical chroma subsampling of src's format (2 for YUV420P).
+   * @param width The width of the rectangle; it must fit within src.
+   * @param height The height of the rectangle; it must fit within src.
+   *
+   * @return A MediaPicture.
+   *
+   * @throws InvalidArgument if src is null or has no data, the rectangle
+   *   does not fit or is not aligned to the chroma subsampling, or src's
+   *   format packs several pixels into a byte or is a hardware format.
+   */
+  static MediaPicture*
+  makeView(MediaPicture* src, int32_t x, int32_t y, int32_t width,
+      int32_t height);
+
   /**
    * Get any underlying raw data available for this object.
    *
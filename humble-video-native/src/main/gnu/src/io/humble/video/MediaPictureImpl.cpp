@@ -26,6 +26,7 @@
 #include "MediaPictureImpl.h"
 
 #include "AVBufferSupport.h"
+#include "MediaPicturePool.h"
 #include <io/humble/ferry/Logger.h>
 #include <io/humble/ferry/HumbleException.h>
 #include <io/humble/ferry/RefPointer.h>
@@ -38,8 +39,13 @@ namespace io {
 namespace humble {
 namespace video {
 
+// rows of pictures we allocate start on this boundary unless asked
+// otherwise; enough for any SIMD that FFmpeg or our own code uses.
+static const int32_t DEFAULT_ALIGNMENT = 64;
+static const int32_t MAX_ALIGNMENT = 256;
+
 MediaPictureImpl::MediaPictureImpl() :
-    mFrame(0) {
+    mFrame(0), mPool(0), mPoolData(0) {
   mFrame = av_frame_alloc();
   if (!mFrame) throw std::bad_alloc();
   mFrame->opaque = this;
@@ -50,9 +56,25 @@ MediaPictureImpl::~MediaPictureImpl() {
   av_frame_free(&mFrame);
 }
 
+void
+MediaPictureImpl::destroy() {
+  MediaPicturePool* pool = mPool;
+  mPool = 0;
+  bool kept = pool && pool->recycle(this);
+  // may free the pool, and with it this if kept
+  if (pool) pool->release();
+  if (!kept) delete this;
+}
+
 MediaPictureImpl*
 MediaPictureImpl::make(int32_t width, int32_t height,
     PixelFormat::Type format) {
+  return make(width, height, format, DEFAULT_ALIGNMENT);
+}
+
+MediaPictureImpl*
+MediaPictureImpl::make(int32_t width, int32_t height,
+    PixelFormat::Type format, int32_t alignment) {
   if (width <= 0)
   VS_THROW(HumbleInvalidArgument("width must be > 0"));
 
@@ -62,11 +84,35 @@ MediaPictureImpl::make(int32_t width, int32_t height,
   if (format == PixelFormat::PIX_FMT_NONE)
   VS_THROW(HumbleInvalidArgument("pixel format must be specifie"));
 
-  // let's figure out how big of a buffer we need
-  int32_t bufSize = PixelFormat::getBufferSizeNeeded(width, height, format);
+  if (alignment < 1 || alignment > MAX_ALIGNMENT || (alignment & (alignment - 1)))
+  VS_THROW(HumbleInvalidArgument("alignment must be a power of two no larger than 256"));
 
-  RefPointer<Buffer> buffer = Buffer::make(0, bufSize);
-  MediaPictureImpl* retval = make(buffer.value(), width, height, format);
+  RefPointer<Buffer> buffer;
+  MediaPictureImpl* retval;
+  if (alignment == 1) {
+    // let's figure out how big of a buffer we need
+    int32_t bufSize = PixelFormat::getBufferSizeNeeded(width, height, format);
+
+    buffer = Buffer::make(0, bufSize);
+    retval = make(buffer.value(), width, height, format);
+  } else {
+    // padded line sizes; and since the planes follow each other, each
+    // starts aligned too once the first does.
+    uint8_t* data[4];
+    int linesize[4];
+    int32_t imgSize = av_image_fill_arrays(data, linesize, 0,
+        (enum AVPixelFormat) format, width, height, alignment);
+    if (imgSize < 0)
+      VS_THROW(HumbleInvalidArgument("cannot allocate a picture in this pixel format"));
+
+    // our allocator only promises 16 byte alignment, so ask for enough
+    // to move the start up to the next boundary
+    buffer = Buffer::make(0, imgSize + alignment - 1);
+    uint8_t* bytes = (uint8_t*) buffer->getBytes(0, imgSize + alignment - 1);
+    int32_t offset = (int32_t) (-(uintptr_t) bytes & (alignment - 1));
+    retval = make(buffer.value(), bytes + offset, width, height, format,
+        alignment);
+  }
   if (retval) buffer->setJavaAllocator(retval->getJavaAllocator());
 
   return retval;
@@ -93,34 +139,43 @@ MediaPictureImpl::make(Buffer* buffer, int32_t width, int32_t height,
 
   // let's figure out how big of a buffer we need
   int32_t bufSize = PixelFormat::getBufferSizeNeeded(width, height, format);
-  if (bufSize < buffer->getBufferSize()) {
+  if (buffer->getBufferSize() < bufSize) {
     VS_THROW(
         HumbleInvalidArgument(
             "passed in buffer too small to fit requested image parameters"));
   }
 
+  // buffer is large enough; let's fill the data pointers
+  uint8_t* data = (uint8_t*) buffer->getBytes(0, bufSize);
+  return make(buffer, data, width, height, format, 1);
+}
+
+MediaPictureImpl*
+MediaPictureImpl::make(Buffer* buffer, uint8_t* data, int32_t width,
+    int32_t height, PixelFormat::Type format, int32_t alignment) {
   RefPointer<MediaPictureImpl> retval = make();
   AVFrame* frame = retval->mFrame;
   frame->width = width;
   frame->height = height;
   frame->format = format;
 
-  // buffer is large enough; let's fill the data pointers
-  uint8_t* data = (uint8_t*) buffer->getBytes(0, bufSize);
-
   int32_t imgSize = av_image_fill_arrays(frame->data, frame->linesize, data,
-      (enum AVPixelFormat) frame->format, frame->width, frame->height, 1);
-  if (imgSize != bufSize) {
-    VS_ASSERT(imgSize == bufSize, "these should always be equal");
+      (enum AVPixelFormat) frame->format, frame->width, frame->height,
+      alignment);
+  if (imgSize < 0) {
     VS_THROW(HumbleRuntimeError("could not fill image with data"));
   }
 
-  // now, set up the reference buffers
+  // now, set up the reference buffers; each plane's runs up to where
+  // the next one starts.
   frame->extended_data = frame->data;
   for (int32_t i = 0; i < AV_NUM_DATA_POINTERS; i++) {
-    if (frame->data[i])
-      frame->buf[i] = AVBufferSupport::wrapBuffer(buffer, frame->data[i], frame->linesize[0]*frame->height+16);
+    if (frame->data[i]) {
+      uint8_t* end = i < 3 && frame->data[i+1] ? frame->data[i+1] : data + imgSize;
+      frame->buf[i] = AVBufferSupport::wrapBuffer(buffer, frame->data[i], end - frame->data[i]);
+    }
   }
+
   // now fill in the AVBufferRefs where we pass of to FFmpeg care
   // of our buffer. Be kind FFmpeg.  Be kind.
   RefPointer<PixelFormatDescriptor> desc = PixelFormat::getDescriptor((PixelFormat::Type)frame->format);
@@ -166,16 +221,13 @@ MediaPictureImpl::make(MediaPictureImpl* src, bool copy) {
     retval = make(src->getWidth(), src->getHeight(), src->getFormat());
     retval->mComplete = src->mComplete;
 
-    // then copy the data into retval
-    int32_t n = src->getNumDataPlanes();
-    for(int32_t i = 0; i < n; i++ )
-    {
-      AVBufferRef* dstBuf = av_frame_get_plane_buffer(retval->mFrame, i);
-      AVBufferRef* srcBuf = av_frame_get_plane_buffer(src->mFrame, i);
-      VS_ASSERT(dstBuf, "should always have buffer");
-      VS_ASSERT(srcBuf, "should always have buffer");
-      memcpy(dstBuf->data, srcBuf->data, srcBuf->size);
-    }
+    // then copy the data into retval, row by row since src need not
+    // be laid out as retval is
+    if (src->mFrame->data[0])
+      av_image_copy(retval->mFrame->data, retval->mFrame->linesize,
+          (const uint8_t**) src->mFrame->data, src->mFrame->linesize,
+          (enum AVPixelFormat) src->getFormat(), src->getWidth(),
+          src->getHeight());
   } else {
     // first create a new media audio object to reference into
     retval = make();
@@ -190,6 +242,51 @@ MediaPictureImpl::make(MediaPictureImpl* src, bool copy) {
   retval->setTimeBase(timeBase.value());
   return retval.get();
 }
+MediaPictureImpl*
+MediaPictureImpl::makeView(MediaPictureImpl* src, int32_t x, int32_t y,
+    int32_t width, int32_t height) {
+  if (!src) VS_THROW(HumbleInvalidArgument("no src object to view"));
+  if (!src->mFrame->data[0])
+    VS_THROW(HumbleInvalidArgument("src has no data to view"));
+  if (x < 0 || y < 0 || width <= 0 || height <= 0 ||
+      x > src->getWidth() - width || y > src->getHeight() - height)
+    VS_THROW(HumbleInvalidArgument("rectangle does not fit within src"));
+
+  const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(
+      (enum AVPixelFormat) src->mFrame->format);
+  if (!desc)
+    VS_THROW(HumbleRuntimeError("could not get format descriptor"));
+  if (desc->flags & (AV_PIX_FMT_FLAG_BITSTREAM | AV_PIX_FMT_FLAG_HWACCEL))
+    VS_THROW(HumbleInvalidArgument("cannot view part of a picture in this pixel format"));
+  if (x % (1 << desc->log2_chroma_w) || y % (1 << desc->log2_chroma_h))
+    VS_THROW(HumbleInvalidArgument("rectangle must start on a chroma sample"));
+
+  RefPointer<MediaPictureImpl> retval = make();
+  if (av_frame_ref(retval->mFrame, src->mFrame) < 0)
+    VS_THROW(HumbleRuntimeError("could not reference src"));
+  AVFrame* frame = retval->mFrame;
+  frame->width = width;
+  frame->height = height;
+
+  // move each plane's pointer to the rectangle's first sample in it; a
+  // palette stays where it is
+  int pixelSteps[4];
+  av_image_fill_max_pixsteps(pixelSteps, 0, desc);
+  for(int32_t i = 0; i < 4 && frame->data[i]; i++) {
+    if (i == 1 && (desc->flags & (AV_PIX_FMT_FLAG_PAL | AV_PIX_FMT_FLAG_PSEUDOPAL)))
+      break;
+    bool chroma = (i == 1 || i == 2) && !(desc->flags & AV_PIX_FMT_FLAG_RGB);
+    frame->data[i] += (y >> (chroma ? desc->log2_chroma_h : 0)) * frame->linesize[i] +
+        (x >> (chroma ? desc->log2_chroma_w : 0)) * pixelSteps[i];
+  }
+  frame->extended_data = frame->data;
+
+  retval->mComplete = src->mComplete;
+  RefPointer<Rational> timeBase = src->getTimeBase();
+  retval->setTimeBase(timeBase.value());
+  return retval.get();
+}
+
 void
 MediaPictureImpl::copy(AVFrame* src, bool complete) {
   if (!src)
@@ -229,14 +326,21 @@ MediaPictureImpl::getData(int32_t plane) {
   RefPointer<Buffer> buffer;
   if (mFrame->buf[plane])
     buffer = AVBufferSupport::wrapAVBuffer(this,
-        mFrame->buf[plane], mFrame->data[plane], mFrame->buf[plane]->size);
+        mFrame->buf[plane], mFrame->data[plane], getDataPlaneSize(plane));
   return buffer.get();
 }
 
 int32_t
 MediaPictureImpl::getDataPlaneSize(int32_t plane) {
   validatePlane(plane);
-  return mFrame->buf[plane] ? mFrame->buf[plane]->size : 0;
+  AVBufferRef* buf = mFrame->buf[plane];
+  if (!buf)
+    return 0;
+  // views start part way into the buffer, and end where it does
+  uint8_t* data = mFrame->data[plane];
+  if (data > buf->data && data < buf->data + buf->size)
+    return buf->size - (int32_t)(data - buf->data);
+  return buf->size;
 }
 int32_t
 MediaPictureImpl::getLineSize(int32_t plane) {
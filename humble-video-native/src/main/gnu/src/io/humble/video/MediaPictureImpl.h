@@ -34,6 +34,8 @@ namespace io {
 namespace humble {
 namespace video {
 
+class MediaPicturePool;
+
 class VS_API_HUMBLEVIDEO MediaPictureImpl : public io::humble::video::MediaPicture
 {
 VS_JNIUTILS_REFCOUNTED_OBJECT_PRIVATE_MAKE(MediaPictureImpl)
@@ -41,6 +43,10 @@ public:
   static MediaPictureImpl*
   make(int32_t width, int32_t height, PixelFormat::Type format);
 
+  static MediaPictureImpl*
+  make(int32_t width, int32_t height, PixelFormat::Type format,
+      int32_t alignment);
+
   static MediaPictureImpl*
   make(io::humble::ferry::Buffer* buffer, int32_t width, int32_t height,
       PixelFormat::Type format);
@@ -48,6 +54,10 @@ public:
   static MediaPictureImpl*
   make(MediaPictureImpl* src, bool copy);
 
+  static MediaPictureImpl*
+  makeView(MediaPictureImpl* src, int32_t x, int32_t y, int32_t width,
+      int32_t height);
+
   void copy(AVFrame*, bool complete);
 
   virtual io::humble::ferry::Buffer*
@@ -141,11 +151,19 @@ protected:
   MediaPictureImpl();
   virtual
   ~MediaPictureImpl();
+  virtual void destroy();
 
 private:
+  friend class MediaPicturePool;
+  static MediaPictureImpl*
+  make(io::humble::ferry::Buffer* buffer, uint8_t* data, int32_t width,
+      int32_t height, PixelFormat::Type format, int32_t alignment);
   void validatePlane(int32_t plane);
   AVFrame* mFrame;
   bool     mComplete;
+  /** The pool this was handed out by, if any, and the data it had then. */
+  MediaPicturePool* mPool;
+  uint8_t* mPoolData;
 };
 
 } /* namespace video */
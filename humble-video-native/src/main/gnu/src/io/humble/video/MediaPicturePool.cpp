@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/Global.h>
+#include "AVBufferSupport.h"
+#include "MediaPictureImpl.h"
+#include "MediaPicturePool.h"
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.MediaPicturePool);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+MediaPicturePool::MediaPicturePool() :
+    mWidth(0), mHeight(0), mFormat(PixelFormat::PIX_FMT_NONE), mCapacity(0),
+    mReused(0), mAllocated(0), mRecycled(0), mDiscarded(0) {
+}
+
+MediaPicturePool::~MediaPicturePool() {
+  for(size_t i = 0; i < mIdle.size(); i++)
+    delete mIdle[i];
+}
+
+MediaPicturePool*
+MediaPicturePool::make(int32_t width, int32_t height,
+    PixelFormat::Type format, int32_t capacity) {
+  Global::init();
+  if (width <= 0)
+    VS_THROW(HumbleInvalidArgument("width must be > 0"));
+  if (height <= 0)
+    VS_THROW(HumbleInvalidArgument("height must be > 0"));
+  if (format == PixelFormat::PIX_FMT_NONE)
+    VS_THROW(HumbleInvalidArgument("pixel format must be specified"));
+  if (capacity < 0)
+    VS_THROW(HumbleInvalidArgument("capacity must be >= 0"));
+
+  RefPointer<MediaPicturePool> retval = make();
+  retval->mWidth = width;
+  retval->mHeight = height;
+  retval->mFormat = format;
+  retval->mCapacity = capacity;
+  retval->mIdle.reserve(capacity);
+  return retval.get();
+}
+
+MediaPicture*
+MediaPicturePool::getPicture() {
+  MediaPictureImpl* retval = 0;
+  {
+    Lock::Guard g(&mLock);
+    if (!mIdle.empty()) {
+      retval = mIdle.back();
+      mIdle.pop_back();
+      ++mReused;
+    } else
+      ++mAllocated;
+  }
+  if (retval) {
+    retval->acquire();
+  } else {
+    retval = MediaPictureImpl::make(mWidth, mHeight, mFormat);
+    retval->mPoolData = retval->mFrame->data[0];
+  }
+  // the picture keeps us alive until it comes back
+  acquire();
+  retval->mPool = this;
+  return retval;
+}
+
+bool
+MediaPicturePool::recycle(MediaPictureImpl* picture) {
+  AVFrame* frame = picture->mFrame;
+  // decoding into a picture, for one, swaps its buffers for others; and
+  // a view, filter graph or encoder may still be reading them.
+  bool reusable = frame->data[0] == picture->mPoolData
+      && frame->width == mWidth && frame->height == mHeight
+      && frame->format == mFormat && av_frame_is_writable(frame);
+
+  Lock::Guard g(&mLock);
+  if (!reusable || (int32_t)mIdle.size() >= mCapacity) {
+    ++mDiscarded;
+    return false;
+  }
+  AVBufferSupport::resetFrame(frame);
+  picture->mComplete = false;
+  picture->setTimeBase(0);
+  mIdle.push_back(picture);
+  ++mRecycled;
+  return true;
+}
+
+int32_t
+MediaPicturePool::getNumIdle() {
+  Lock::Guard g(&mLock);
+  return (int32_t)mIdle.size();
+}
+
+int64_t
+MediaPicturePool::getNumReused() {
+  Lock::Guard g(&mLock);
+  return mReused;
+}
+
+int64_t
+MediaPicturePool::getNumAllocated() {
+  Lock::Guard g(&mLock);
+  return mAllocated;
+}
+
+int64_t
+MediaPicturePool::getNumRecycled() {
+  Lock::Guard g(&mLock);
+  return mRecycled;
+}
+
+int64_t
+MediaPicturePool::getNumDiscarded() {
+  Lock::Guard g(&mLock);
+  return mDiscarded;
+}
+
+void
+MediaPicturePool::resetStatistics() {
+  Lock::Guard g(&mLock);
+  mReused = 0;
+  mAllocated = 0;
+  mRecycled = 0;
+  mDiscarded = 0;
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef MEDIAPICTUREPOOL_H_
+#define MEDIAPICTUREPOOL_H_
+
+#include <vector>
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/RefCounted.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/MediaPicture.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+class MediaPictureImpl;
+
+/**
+ * Hands out MediaPicture objects of one width, height and format, and
+ * takes them back to hand out again once the last reference to them is
+ * released, so a loop that makes a picture per frame stops allocating
+ * frames and buffers once the pool has warmed up.
+ * <p>
+ * A picture comes back with its data as it was left, but with every
+ * other property (time stamp, time base, picture type, the complete flag
+ * and so on) reset. It is only kept if the pool still has room, if it
+ * still holds the data it was handed out with, and if nothing else holds
+ * a reference to that data: a picture that was decoded into, or whose
+ * planes a filter graph or encoder still has, is freed as usual.
+ * </p><p>
+ * Pictures hold a reference to their pool, so a pool lives until every
+ * picture it handed out has been released. Pools are safe to use from
+ * several threads.
+ * </p>
+ */
+class VS_API_HUMBLEVIDEO MediaPicturePool : public io::humble::ferry::RefCounted
+{
+  VS_JNIUTILS_REFCOUNTED_OBJECT_PRIVATE_MAKE(MediaPicturePool)
+public:
+  /**
+   * Makes a pool of pictures laid out as
+   * MediaPicture#make(int, int, PixelFormat.Type) lays them out.
+   *
+   * @param width Number of pixels wide.
+   * @param height Number of pixels high.
+   * @param format PixelFormat.Type of the pictures.
+   * @param capacity The most released pictures to keep for reuse.
+   *
+   * @return the pool, empty until pictures are released to it.
+   *
+   * @throws InvalidArgument if width or height are not positive, format
+   *   is PixelFormat.Type.PIX_FMT_NONE, or capacity is negative.
+   */
+  static MediaPicturePool*
+  make(int32_t width, int32_t height, PixelFormat::Type format,
+      int32_t capacity);
+
+  /**
+   * Gets a picture, reusing a released one if the pool has any.
+   *
+   * @return a picture of this pool's width, height and format.
+   */
+  MediaPicture* getPicture();
+
+  /** @return the width of the pictures. */
+  int32_t getWidth() { return mWidth; }
+
+  /** @return the height of the pictures. */
+  int32_t getHeight() { return mHeight; }
+
+  /** @return the format of the pictures. */
+  PixelFormat::Type getFormat() { return mFormat; }
+
+  /** @return the most released pictures kept for reuse. */
+  int32_t getCapacity() { return mCapacity; }
+
+  /** @return the number of released pictures waiting to be reused. */
+  int32_t getNumIdle();
+
+  /** @return the number of times #getPicture() reused a picture. */
+  int64_t getNumReused();
+
+  /** @return the number of times #getPicture() had to make a new one. */
+  int64_t getNumAllocated();
+
+  /** @return the number of released pictures taken back for reuse. */
+  int64_t getNumRecycled();
+
+  /**
+   * @return the number of released pictures freed instead, because the
+   *   pool was full or they could not be reused.
+   */
+  int64_t getNumDiscarded();
+
+  /**
+   * Zeros the reused, allocated, recycled and discarded counts.
+   */
+  void resetStatistics();
+
+#ifndef SWIG
+  /**
+   * Called as the last reference to a picture from this pool goes; takes
+   * the picture back if it can be reused.
+   * @return true if the pool now owns picture; false if the caller
+   *   should free it.
+   */
+  bool recycle(MediaPictureImpl* picture);
+#endif // ! SWIG
+
+protected:
+  MediaPicturePool();
+  virtual ~MediaPicturePool();
+
+private:
+  int32_t mWidth;
+  int32_t mHeight;
+  PixelFormat::Type mFormat;
+  int32_t mCapacity;
+  io::humble::ferry::Lock mLock;
+  std::vector<MediaPictureImpl*> mIdle;
+  int64_t mReused;
+  int64_t mAllocated;
+  int64_t mRecycled;
+  int64_t mDiscarded;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* MEDIAPICTUREPOOL_H_ */
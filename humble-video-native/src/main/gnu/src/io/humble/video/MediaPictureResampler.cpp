@@ -20,6 +20,7 @@
 #include <io/humble/video/MediaPictureResampler.h>
 #include <io/humble/video/Global.h>
 #include <io/humble/video/MediaPictureResamplerImpl.h>
+#include "SwsContextCache.h"
 
 namespace io { namespace humble { namespace video
 {
@@ -45,4 +46,40 @@ MediaPictureResampler :: make(
       inputWidth, inputHeight, inputFmt, flags);
 }
 
+void
+MediaPictureResampler :: setCacheSize(int32_t maxContexts)
+{
+  SwsContextCache::get()->setMaxContexts(maxContexts);
+}
+
+int32_t
+MediaPictureResampler :: getCacheSize()
+{
+  return SwsContextCache::get()->getMaxContexts();
+}
+
+int64_t
+MediaPictureResampler :: getCacheHits()
+{
+  return SwsContextCache::get()->getHits();
+}
+
+int64_t
+MediaPictureResampler :: getCacheMisses()
+{
+  return SwsContextCache::get()->getMisses();
+}
+
+int64_t
+MediaPictureResampler :: getCacheEvictions()
+{
+  return SwsContextCache::get()->getEvictions();
+}
+
+void
+MediaPictureResampler :: resetCacheStatistics()
+{
+  SwsContextCache::get()->resetStatistics();
+}
+
 }}}
@@ -94,6 +94,72 @@ public:
    */
   virtual PixelFormat::Type getOutputFormat()=0;
 
+  /**
+   * Set the number of threads to resample each picture with. The output
+   * picture is split into horizontal bands that are scaled in parallel on
+   * a worker pool shared by the whole process, and the result is
+   * identical, byte for byte, to resampling with one thread.
+   * <p>
+   * Bands are only used when the vertical scale factor lets each band
+   * reproduce exactly what a single pass would do: the input height over
+   * the output height must be exact in 1/65536ths (for example 2160 to
+   * 1080 or 720, but not 720 to 1080), both heights must be multiples of
+   * their formats' chroma subsampling, and error diffusion dithering must
+   * be off. Otherwise, and for pictures too short to split, the resampler
+   * quietly uses one thread; see #getNumBands().
+   * </p>
+   * Must be called before #open().
+   *
+   * @param threads The number of threads, 0 for one per CPU, or 1 (the
+   *   default) to resample on the calling thread only.
+   */
+  virtual void setThreads(int32_t threads)=0;
+
+  /**
+   * @return the number of threads set with #setThreads(int).
+   */
+  virtual int32_t getThreads()=0;
+
+  /**
+   * Get the number of bands each picture is split into.
+   * @return the number of bands, or 1 if the resampler is not open or
+   *   pictures are resampled in a single pass.
+   */
+  virtual int32_t getNumBands()=0;
+
+  /**
+   * Set whether dedicated conversion routines may be used instead of the
+   * general purpose rescaler when the parameters allow it.
+   * <p>
+   * YUV420P and NV12 are converted to and from BGR24, RGBA and GRAY8, at
+   * the same size or at half the width and height (with even sizes), by
+   * routines written for SSE4 and AVX2 and picked at run time for the CPU.
+   * They are much faster, but do not match the general rescaler: chroma
+   * is repeated rather than interpolated and rounding differs, so colors
+   * can be off by a few levels, and by up to 20 where chroma changes
+   * sharply. They are not used when the flags ask for
+   * FLAG_ACCURATE_RND, FLAG_BITEXACT, FLAG_FULL_CHR_H_INT,
+   * FLAG_FULL_CHR_H_INP or FLAG_ERROR_DIFFUSION, and they convert on the
+   * calling thread, whatever #setThreads(int) says.
+   * </p>
+   * Must be called before #open().
+   *
+   * @param fastPaths true to allow them, false (the default) to always use
+   *   the general rescaler.
+   */
+  virtual void setFastPaths(bool fastPaths)=0;
+
+  /**
+   * @return whether dedicated conversion routines are allowed.
+   * @see #setFastPaths(boolean)
+   */
+  virtual bool getFastPaths()=0;
+
+  /**
+   * @return true if this resampler is open and converting with one of the
+   *   dedicated routines described in #setFastPaths(boolean).
+   */
+  virtual bool usesFastPath()=0;
 
   /**
    * Opens the resampler so it can be ready for resampling.
@@ -120,6 +186,51 @@ public:
    */
   virtual int32_t resamplePicture(MediaPicture *out, MediaPicture *in)=0;
 
+#ifndef SWIG
+  /**
+   * Checks that #resampleToBytes(uint8_t*, MediaPicture*) can resample in
+   * into size bytes.
+   *
+   * @throws InvalidArgument or RuntimeError if the resampler is not open,
+   *   in does not match the input parameters or is not complete, or size
+   *   is smaller than the layout described there.
+   */
+  virtual void checkResampleToBytes(int32_t size, MediaPicture *in)=0;
+
+  /**
+   * Resamples in into memory laid out as av_image_fill_arrays lays out a
+   * picture of the output parameters with an alignment of 1: no padding
+   * between rows or planes. Call
+   * #checkResampleToBytes(int32_t, MediaPicture*) first: this does not
+   * check its arguments. It does not throw or call into Java, and it
+   * resamples in one pass on the calling thread whatever #setThreads(int)
+   * says, so it may be called while out is a pinned Java array.
+   *
+   * @return the number of output rows, or a negative FFmpeg error.
+   */
+  virtual int32_t resampleToBytes(uint8_t *out, MediaPicture *in)=0;
+
+  /**
+   * Checks that #resampleFromBytes(MediaPicture*, const uint8_t*) can
+   * resample size bytes into out.
+   *
+   * @throws InvalidArgument or RuntimeError if the resampler is not open,
+   *   out does not match the output parameters, or size is smaller than
+   *   that layout of the input parameters.
+   */
+  virtual void checkResampleFromBytes(MediaPicture *out, int32_t size)=0;
+
+  /**
+   * Resamples memory laid out as av_image_fill_arrays lays out a picture
+   * of the input parameters with an alignment of 1 into out, and marks out
+   * complete if that worked. As with
+   * #resampleToBytes(uint8_t*, MediaPicture*), check the arguments first.
+   *
+   * @return the number of output rows, or a negative FFmpeg error.
+   */
+  virtual int32_t resampleFromBytes(MediaPicture *out, const uint8_t *in)=0;
+#endif // ! SWIG
+
   /**
    * Get a new picture resampler.
    *
@@ -138,6 +249,52 @@ public:
       PixelFormat::Type inputFmt,
       int32_t flags);
 
+  /**
+   * Sets how many idle rescalers the process keeps for reuse.
+   * <p>
+   * Setting up a rescaler builds filter tables for the sizes, formats and
+   * flags it converts between, which can cost more than converting a
+   * picture. When a resampler is deleted its rescaler is kept, and a later
+   * resampler made with the same parameters takes it over instead of
+   * building a new one. Each rescaler is used by one resampler at a time,
+   * and scales exactly as a new one would; ones whose error diffusion
+   * dithering carries over from picture to picture are not kept.
+   * </p>
+   *
+   * @param maxContexts the most idle rescalers to keep; the least recently
+   *   used are freed first. 0 turns reuse off. Defaults to 16.
+   */
+  static void setCacheSize(int32_t maxContexts);
+
+  /**
+   * @return the most idle rescalers kept for reuse.
+   * @see #setCacheSize(int)
+   */
+  static int32_t getCacheSize();
+
+  /**
+   * @return the number of resamplers (or bands of them) that reused a
+   *   kept rescaler.
+   */
+  static int64_t getCacheHits();
+
+  /**
+   * @return the number of resamplers (or bands of them) that had to set
+   *   up a new rescaler.
+   */
+  static int64_t getCacheMisses();
+
+  /**
+   * @return the number of idle rescalers freed to stay within
+   *   #getCacheSize().
+   */
+  static int64_t getCacheEvictions();
+
+  /**
+   * Zeros the hit, miss and eviction counts.
+   */
+  static void resetCacheStatistics();
+
 protected:
   MediaPictureResampler();
   virtual ~MediaPictureResampler();
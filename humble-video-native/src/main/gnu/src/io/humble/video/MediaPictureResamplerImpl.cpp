@@ -25,6 +25,11 @@
 #include <io/humble/video/Rational.h>
 #include <io/humble/video/Property.h>
 #include <io/humble/video/VideoExceptions.h>
+#include <io/humble/video/SwsContextCache.h>
+#include <io/humble/video/PictureConversion.h>
+
+#include <math.h>
+#include <string.h>
 
 VS_LOG_SETUP(VS_CPP_PACKAGE.MediaPictureResampler);
 
@@ -33,8 +38,138 @@ using namespace io::humble::ferry;
 namespace io { namespace humble { namespace video
 {
 
+namespace {
+/*
+ * Largest scale factor, either way, we split pictures for. Beyond it
+ * swscale may scale in two passes through an intermediate size, which
+ * a band cannot reproduce.
+ */
+const int32_t sMaxBandScale = 8;
+
+int32_t
+MediaPictureResampler_gcd(int32_t a, int32_t b)
+{
+  while (b) {
+    int32_t t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+}
+
+/*
+ * Fills in the number of planes of a format, and for each plane how many
+ * bits its row numbers are shifted down by for vertical chroma subsampling.
+ */
+int32_t
+MediaPictureResampler_planes(enum AVPixelFormat fmt, int32_t* shift)
+{
+  const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(fmt);
+  int32_t planes = av_pix_fmt_count_planes(fmt);
+  for(int32_t i = 0; i < 4; i++)
+    shift[i] = (i == 1 || i == 2) && !(desc->flags & AV_PIX_FMT_FLAG_RGB) ?
+        desc->log2_chroma_h : 0;
+  return planes;
+}
+
+/*
+ * The widest swscale filter, in multiples of the scale factor, the given
+ * flags can produce.
+ */
+int32_t
+MediaPictureResampler_filterWidth(int64_t flags, double param)
+{
+  int32_t width = 2;
+  if (flags & (SWS_SINC | SWS_SPLINE))
+    width = FFMAX(width, 20);
+  if (flags & (SWS_GAUSS | SWS_X))
+    width = FFMAX(width, 8);
+  if (flags & SWS_LANCZOS)
+    width = FFMAX(width, param != SWS_PARAM_DEFAULT ? (int32_t)ceil(2*param) : 6);
+  if (flags & (SWS_BICUBIC | SWS_BICUBLIN))
+    width = FFMAX(width, 4);
+  return width;
+}
+
+/*
+ * The bytes av_image_fill_arrays lays a picture out in with no padding,
+ * counting the palette it points the second plane at for paletted formats.
+ */
+int32_t
+MediaPictureResampler_packedSize(PixelFormat::Type format, int32_t width,
+    int32_t height)
+{
+  uint8_t* data[4];
+  int linesize[4];
+  return av_image_fill_arrays(data, linesize, 0, (enum AVPixelFormat)format,
+      width, height, 1);
+}
+}
+
+MediaPictureResamplerImpl :: Band :: Band()
+{
+  mContext = 0;
+  mSrcY = mSrcH = mDstY = mDstH = mKeepY = mKeepH = 0;
+  mIn = mOut = 0;
+  mRetval = 0;
+  mNumSrcPlanes = mNumDstPlanes = 0;
+  for(int32_t i = 0; i < 4; i++) {
+    mScratch[i] = 0;
+    mScratchStride[i] = 0;
+    mSrcShift[i] = mDstShift[i] = mDstBytes[i] = 0;
+  }
+}
+
+MediaPictureResamplerImpl :: Band :: ~Band()
+{
+  SwsContextCache::get()->release(mContext);
+  av_freep(&mScratch[0]);
+}
+
+void
+MediaPictureResamplerImpl :: Band :: run()
+{
+  const uint8_t* src[4] = { 0, 0, 0, 0 };
+  for(int32_t i = 0; i < mNumSrcPlanes; i++)
+    src[i] = mIn->data[i] + (mSrcY >> mSrcShift[i]) * mIn->linesize[i];
+
+  if (!mScratch[0]) {
+    // no margins; scale straight into the output
+    uint8_t* dst[4] = { 0, 0, 0, 0 };
+    for(int32_t i = 0; i < mNumDstPlanes; i++)
+      dst[i] = mOut->data[i] + (mDstY >> mDstShift[i]) * mOut->linesize[i];
+    mRetval = sws_scale(mContext, src, mIn->linesize, 0, mSrcH,
+        dst, mOut->linesize);
+    return;
+  }
+
+  // swscale leaves a few bytes alone in some conversions (such as the last
+  // pixel of odd widths), so the kept rows start out as the output is.
+  uint8_t* kept[4] = { 0, 0, 0, 0 };
+  for(int32_t i = 0; i < mNumDstPlanes; i++) {
+    kept[i] = mScratch[i] + ((mKeepY - mDstY) >> mDstShift[i]) * mScratchStride[i];
+    av_image_copy_plane(kept[i], mScratchStride[i],
+        mOut->data[i] + (mKeepY >> mDstShift[i]) * mOut->linesize[i],
+        mOut->linesize[i], mDstBytes[i], mKeepH >> mDstShift[i]);
+  }
+
+  mRetval = sws_scale(mContext, src, mIn->linesize, 0, mSrcH,
+      mScratch, mScratchStride);
+  if (mRetval < 0)
+    return;
+
+  for(int32_t i = 0; i < mNumDstPlanes; i++)
+    av_image_copy_plane(
+        mOut->data[i] + (mKeepY >> mDstShift[i]) * mOut->linesize[i],
+        mOut->linesize[i], kept[i], mScratchStride[i],
+        mDstBytes[i], mKeepH >> mDstShift[i]);
+}
+
 MediaPictureResamplerImpl :: MediaPictureResamplerImpl()
 {
+  mThreads = 1;
+  mFastPaths = false;
+  mConversion = 0;
   mIHeight = 0;
   mIWidth = 0;
   mOHeight = 0;
@@ -42,14 +177,20 @@ MediaPictureResamplerImpl :: MediaPictureResamplerImpl()
   mIPixelFmt = PixelFormat::PIX_FMT_NONE;
   mOPixelFmt = PixelFormat::PIX_FMT_NONE;
   mContext = 0;
+  mOptions = 0;
   mState = STATE_INITED;
 }
 
 MediaPictureResamplerImpl :: ~MediaPictureResamplerImpl()
 {
-  if (mContext)
-    sws_freeContext(mContext);
+  freeBands();
+  delete mConversion;
+  mConversion = 0;
+  SwsContextCache::get()->release(mContext);
   mContext = 0;
+  if (mOptions)
+    sws_freeContext(mOptions);
+  mOptions = 0;
 }
 
 int32_t
@@ -88,11 +229,230 @@ MediaPictureResamplerImpl :: getOutputFormat()
   return mOPixelFmt;
 }
 
+void
+MediaPictureResamplerImpl :: setThreads(int32_t threads)
+{
+  if (threads < 0)
+    VS_THROW(HumbleInvalidArgument("threads must be >= 0"));
+  mThreads = threads;
+}
+
+int32_t
+MediaPictureResamplerImpl :: getThreads()
+{
+  return mThreads;
+}
+
+int32_t
+MediaPictureResamplerImpl :: getNumBands()
+{
+  return mBands.empty() ? 1 : (int32_t)mBands.size();
+}
+
+void
+MediaPictureResamplerImpl :: setFastPaths(bool fastPaths)
+{
+  mFastPaths = fastPaths;
+}
+
+bool
+MediaPictureResamplerImpl :: getFastPaths()
+{
+  return mFastPaths;
+}
+
+bool
+MediaPictureResamplerImpl :: usesFastPath()
+{
+  return mConversion != 0;
+}
+
 void
 MediaPictureResamplerImpl::open() {
+  freeBands();
+  delete mConversion;
+  mConversion = 0;
+  if (mFastPaths) {
+    // only when the flags leave swscale free to round as it likes
+    int64_t flags = 0;
+    int64_t dither = 0;
+    av_opt_get_int(mOptions, "sws_flags", 0, &flags);
+    av_opt_get_int(mOptions, "sws_dither", 0, &dither);
+    const int64_t exact = SWS_ACCURATE_RND | SWS_BITEXACT | SWS_FULL_CHR_H_INT |
+        SWS_FULL_CHR_H_INP | SWS_ERROR_DIFFUSION;
+    if (!(flags & exact) && dither <= 2)
+      mConversion = PictureConversion::make(mOWidth, mOHeight,
+          (enum AVPixelFormat)mOPixelFmt, mIWidth, mIHeight,
+          (enum AVPixelFormat)mIPixelFmt, PictureConversion::getBestLevel());
+  }
+  if (mConversion)
+    VS_LOG_DEBUG("Converting %dx%d -> %dx%d with level %d kernels",
+        mIWidth, mIHeight, mOWidth, mOHeight, mConversion->getLevel());
+  else
+    makeBands();
   mState = STATE_OPENED;
 }
 
+void
+MediaPictureResamplerImpl :: freeBands()
+{
+  for(size_t i = 0; i < mBands.size(); i++)
+    delete mBands[i];
+  mBands.clear();
+}
+
+/*
+ * Splits the output into bands that each give the same result as scaling
+ * the whole picture would, or leaves mBands empty if that cannot be done.
+ *
+ * swscale places output row y's vertical filter at y*inc in the input,
+ * where inc is the input height over the output height in 1/65536ths, and
+ * derives the filter from where that lands between input rows. When inc is
+ * exact, rows a whole number of input rows apart get the same filter, so a
+ * context for a band that starts on such a row and keeps the same scale
+ * computes the same rows as the full picture's context does, except near
+ * its top and bottom edges where it clamps the filter to the rows it has.
+ * Each band is therefore scaled with margins above and below wide enough
+ * to hold those edge rows, and the margins are thrown away.
+ *
+ * Bands also start on multiples of the output chroma subsampling and of
+ * the 8 row ordered dither pattern, both of which swscale keys off the
+ * output row number, and on input rows that start a chroma row.
+ */
+void
+MediaPictureResamplerImpl :: makeBands()
+{
+  int32_t threads = mThreads ? mThreads : WorkerPool::getCPUs();
+  if (threads <= 1)
+    return;
+
+  const AVPixFmtDescriptor* iDesc = av_pix_fmt_desc_get((enum AVPixelFormat)mIPixelFmt);
+  const AVPixFmtDescriptor* oDesc = av_pix_fmt_desc_get((enum AVPixelFormat)mOPixelFmt);
+  if (!iDesc || !oDesc)
+    return;
+  // bayer input is demosaiced in a separate pass first
+  const int64_t unsupported = AV_PIX_FMT_FLAG_PAL | AV_PIX_FMT_FLAG_PSEUDOPAL |
+      AV_PIX_FMT_FLAG_BITSTREAM | AV_PIX_FMT_FLAG_HWACCEL;
+  if ((iDesc->flags & unsupported) || (oDesc->flags & unsupported) ||
+      !strncmp(iDesc->name, "bayer_", 6)) {
+    VS_LOG_DEBUG("Not splitting; unsupported pixel format");
+    return;
+  }
+  int64_t flags = 0;
+  int64_t dither = 0;
+  int64_t gamma = 0;
+  double param = SWS_PARAM_DEFAULT;
+  av_opt_get_int(mOptions, "sws_flags", 0, &flags);
+  av_opt_get_int(mOptions, "sws_dither", 0, &dither);
+  av_opt_get_int(mOptions, "gamma", 0, &gamma);
+  av_opt_get_double(mOptions, "param0", 0, &param);
+  // 0 is none, 1 is left to swscale, 2 is ordered; the rest carry state
+  // from row to row. What swscale left to itself it has now picked.
+  int64_t picked = 0;
+  av_opt_get_int(mContext, "sws_dither", 0, &picked);
+  if ((flags & SWS_ERROR_DIFFUSION) || dither > 2 || picked > 2 || gamma) {
+    VS_LOG_DEBUG("Not splitting; dithering or gamma depends on earlier rows");
+    return;
+  }
+  if (mIHeight > sMaxBandScale * mOHeight || mOHeight > sMaxBandScale * mIHeight ||
+      mIWidth > sMaxBandScale * mOWidth || mOWidth > sMaxBandScale * mIWidth) {
+    VS_LOG_DEBUG("Not splitting; scale factor too large");
+    return;
+  }
+
+  const int32_t iSub = iDesc->log2_chroma_h;
+  const int32_t oSub = oDesc->log2_chroma_h;
+  if (mIHeight % (1 << iSub) || mOHeight % (1 << oSub)) {
+    VS_LOG_DEBUG("Not splitting; height does not fit chroma subsampling");
+    return;
+  }
+  const int32_t iChrH = mIHeight >> iSub;
+  const int32_t oChrH = mOHeight >> oSub;
+  if ((((int64_t)mIHeight << 16) % mOHeight) || (((int64_t)iChrH << 16) % oChrH)) {
+    VS_LOG_DEBUG("Not splitting; vertical scale %d:%d is not exact",
+        mIHeight, mOHeight);
+    return;
+  }
+
+  // the shortest run of output rows bands can start on
+  const int32_t gcd = MediaPictureResampler_gcd(mIHeight, mOHeight);
+  const int32_t align = 8 << oSub;
+  int32_t period = mOHeight / gcd;
+  period = period / MediaPictureResampler_gcd(period, align) * align;
+  while ((int64_t)period * mIHeight / mOHeight % (1 << iSub))
+    period *= 2;
+
+  // input rows each side a kept row's filter may reach, in luma and chroma
+  const int32_t width = MediaPictureResampler_filterWidth(flags, param);
+  const int32_t lumReach = width * FFMAX(1, (mIHeight + mOHeight - 1) / mOHeight) + 2;
+  const int32_t chrReach = (width * FFMAX(1, (iChrH + oChrH - 1) / oChrH) + 2) << iSub;
+  const int32_t reach = FFMAX(lumReach, chrReach) + (2 << iSub);
+  int32_t margin = (int32_t)(((int64_t)reach * mOHeight + mIHeight - 1) / mIHeight);
+  margin = FFMAX(period, (margin + period - 1) / period * period);
+  if (mIHeight == mOHeight && iSub == oSub)
+    // each output row comes from its own input row; there are no edges
+    // to hide, and swscale may leave parts of the output alone (such as
+    // the chroma of a nv12 to nv12 copy), so bands write straight to it
+    margin = 0;
+
+  const int32_t periods = mOHeight / period;
+  const int32_t bands = FFMIN(threads, mOHeight / FFMAX(period, margin));
+  if (bands < 2 || periods < bands) {
+    VS_LOG_DEBUG("Not splitting; picture too short");
+    return;
+  }
+
+  int32_t srcShift[4];
+  int32_t dstShift[4];
+  int32_t srcPlanes = MediaPictureResampler_planes((enum AVPixelFormat)mIPixelFmt, srcShift);
+  int32_t dstPlanes = MediaPictureResampler_planes((enum AVPixelFormat)mOPixelFmt, dstShift);
+
+  for(int32_t i = 0; i < bands; i++) {
+    Band* band = new Band();
+    mBands.push_back(band);
+
+    band->mKeepY = (int32_t)((int64_t)periods * i / bands) * period;
+    int32_t keepEnd = i == bands-1 ? mOHeight :
+        (int32_t)((int64_t)periods * (i+1) / bands) * period;
+    band->mKeepH = keepEnd - band->mKeepY;
+    band->mDstY = FFMAX(0, band->mKeepY - margin);
+    int32_t dstEnd = FFMIN(mOHeight, keepEnd + margin);
+    band->mDstH = dstEnd - band->mDstY;
+    band->mSrcY = (int32_t)((int64_t)band->mDstY * mIHeight / mOHeight);
+    int32_t srcEnd = dstEnd == mOHeight ? mIHeight :
+        (int32_t)((int64_t)dstEnd * mIHeight / mOHeight);
+    band->mSrcH = srcEnd - band->mSrcY;
+
+    band->mNumSrcPlanes = srcPlanes;
+    band->mNumDstPlanes = dstPlanes;
+    for(int32_t j = 0; j < 4; j++) {
+      band->mSrcShift[j] = srcShift[j];
+      band->mDstShift[j] = dstShift[j];
+      band->mDstBytes[j] = j < dstPlanes ?
+          av_image_get_linesize((enum AVPixelFormat)mOPixelFmt, mOWidth, j) : 0;
+    }
+
+    // the same options, just shorter
+    SwsContext* options = sws_alloc_context();
+    if (options &&
+        av_opt_copy(options, mOptions) >= 0 &&
+        av_opt_set_int(options, "srch", band->mSrcH, 0) >= 0 &&
+        av_opt_set_int(options, "dsth", band->mDstH, 0) >= 0)
+      band->mContext = SwsContextCache::get()->acquire(options);
+    sws_freeContext(options);
+    if (!band->mContext ||
+        (margin && av_image_alloc(band->mScratch, band->mScratchStride, mOWidth,
+            band->mDstH, (enum AVPixelFormat)mOPixelFmt, 32) < 0)) {
+      VS_LOG_WARN("Could not set up band %d of %d; resampling with one thread",
+          i, bands);
+      freeBands();
+      return;
+    }
+  }
+  VS_LOG_DEBUG("Split %dx%d -> %dx%d into %d bands of about %d rows, %d row margins",
+      mIWidth, mIHeight, mOWidth, mOHeight, bands, mOHeight / bands, margin);
+}
+
 int32_t
 MediaPictureResamplerImpl::resample(MediaSampled* aOut, MediaSampled* aIn)
 {
@@ -105,15 +465,18 @@ MediaPictureResamplerImpl::resample(MediaSampled* aOut, MediaSampled* aIn)
   return resamplePicture(out, in);
 }
 
-int32_t
-MediaPictureResamplerImpl :: resamplePicture(MediaPicture* pOutFrame, MediaPicture* pInFrame)
+void
+MediaPictureResamplerImpl :: checkOpen()
 {
-  int32_t retval = -1;
   if (mState != STATE_OPENED) {
     VS_THROW(HumbleRuntimeError("open() must be called before resample is attempted"));
   }
+}
+
+MediaPictureImpl*
+MediaPictureResamplerImpl :: checkOutput(MediaPicture* pOutFrame)
+{
   MediaPictureImpl* outFrame = dynamic_cast<MediaPictureImpl*>(pOutFrame);
-  MediaPictureImpl* inFrame  = dynamic_cast<MediaPictureImpl*>(pInFrame);
   if (!outFrame)
     VS_THROW(HumbleInvalidArgument("invalid output frame"));
   if (outFrame->getHeight() != mOHeight)
@@ -122,7 +485,13 @@ MediaPictureResamplerImpl :: resamplePicture(MediaPicture* pOutFrame, MediaPictu
     VS_THROW(HumbleInvalidArgument("output frame width does not match expected value"));
   if (outFrame->getFormat() != mOPixelFmt)
     VS_THROW(HumbleInvalidArgument("output frame pixel format does not match expected value"));
+  return outFrame;
+}
 
+MediaPictureImpl*
+MediaPictureResamplerImpl :: checkInput(MediaPicture* pInFrame)
+{
+  MediaPictureImpl* inFrame  = dynamic_cast<MediaPictureImpl*>(pInFrame);
   if (!inFrame)
     VS_THROW(HumbleInvalidArgument("invalid input frame"));
 
@@ -134,14 +503,45 @@ MediaPictureResamplerImpl :: resamplePicture(MediaPicture* pOutFrame, MediaPictu
     VS_THROW(HumbleInvalidArgument("input frame pixel format does not match expected value"));
   if (!inFrame->isComplete())
     VS_THROW(HumbleRuntimeError("incoming frame doesn't have complete data"));
+  return inFrame;
+}
 
-  outFrame->setComplete(false);
-  AVFrame *outAVFrame = outFrame->getCtx();
+int32_t
+MediaPictureResamplerImpl :: scale(AVFrame* outAVFrame, const AVFrame* inAVFrame,
+    bool inBands)
+{
+  int32_t retval = -1;
+  if (mConversion) {
+    mConversion->convert(outAVFrame, inAVFrame);
+    retval = mOHeight;
+  } else if (mBands.empty() || !inBands) {
+    // the bands give the same rows as the whole picture's context does
+    retval = sws_scale(mContext, inAVFrame->data, inAVFrame->linesize, 0,
+        mIHeight, outAVFrame->data, outAVFrame->linesize);
+  } else {
+    for(size_t i = 0; i < mBands.size(); i++) {
+      mBands[i]->mIn = inAVFrame;
+      mBands[i]->mOut = outAVFrame;
+    }
+    std::vector<WorkerPool::Job*> jobs(mBands.begin(), mBands.end());
+    WorkerPool::get()->run(&jobs[0], (int32_t)jobs.size());
+    retval = mOHeight;
+    for(size_t i = 0; i < mBands.size(); i++)
+      if (mBands[i]->mRetval < 0)
+        retval = mBands[i]->mRetval;
+  }
+  return retval;
+}
 
-  AVFrame *inAVFrame = inFrame->getCtx();
+int32_t
+MediaPictureResamplerImpl :: resamplePicture(MediaPicture* pOutFrame, MediaPicture* pInFrame)
+{
+  checkOpen();
+  MediaPictureImpl* outFrame = checkOutput(pOutFrame);
+  MediaPictureImpl* inFrame = checkInput(pInFrame);
 
-  retval = sws_scale(mContext, inAVFrame->data, inAVFrame->linesize, 0,
-      mIHeight, outAVFrame->data, outAVFrame->linesize);
+  outFrame->setComplete(false);
+  int32_t retval = scale(outFrame->getCtx(), inFrame->getCtx(), true);
 
   FfmpegException::check(retval, "Error while resampling. ");
 
@@ -156,6 +556,52 @@ MediaPictureResamplerImpl :: resamplePicture(MediaPicture* pOutFrame, MediaPictu
   return retval;
 }
 
+void
+MediaPictureResamplerImpl :: checkResampleToBytes(int32_t size, MediaPicture* pInFrame)
+{
+  checkOpen();
+  checkInput(pInFrame);
+  if (size < MediaPictureResampler_packedSize(mOPixelFmt, mOWidth, mOHeight))
+    VS_THROW(HumbleInvalidArgument("output is too small for the output picture"));
+}
+
+int32_t
+MediaPictureResamplerImpl :: resampleToBytes(uint8_t* out, MediaPicture* pInFrame)
+{
+  MediaPictureImpl* inFrame = static_cast<MediaPictureImpl*>(pInFrame);
+  // scale() only looks at data and linesize
+  AVFrame outAVFrame;
+  memset(&outAVFrame, 0, sizeof(outAVFrame));
+  av_image_fill_arrays(outAVFrame.data, outAVFrame.linesize, out,
+      (enum AVPixelFormat)mOPixelFmt, mOWidth, mOHeight, 1);
+  // out may be a pinned Java array, so stay on this thread: the workers
+  // could log, start threads or wait on ones that call into Java
+  return scale(&outAVFrame, inFrame->getCtx(), false);
+}
+
+void
+MediaPictureResamplerImpl :: checkResampleFromBytes(MediaPicture* pOutFrame, int32_t size)
+{
+  checkOpen();
+  checkOutput(pOutFrame);
+  if (size < MediaPictureResampler_packedSize(mIPixelFmt, mIWidth, mIHeight))
+    VS_THROW(HumbleInvalidArgument("input is too small for the input picture"));
+}
+
+int32_t
+MediaPictureResamplerImpl :: resampleFromBytes(MediaPicture* pOutFrame, const uint8_t* in)
+{
+  MediaPictureImpl* outFrame = static_cast<MediaPictureImpl*>(pOutFrame);
+  AVFrame inAVFrame;
+  memset(&inAVFrame, 0, sizeof(inAVFrame));
+  av_image_fill_arrays(inAVFrame.data, inAVFrame.linesize, in,
+      (enum AVPixelFormat)mIPixelFmt, mIWidth, mIHeight, 1);
+  // and in may be a pinned Java array
+  int32_t retval = scale(outFrame->getCtx(), &inAVFrame, false);
+  outFrame->setComplete(retval >= 0);
+  return retval;
+}
+
 MediaPictureResamplerImpl*
 MediaPictureResamplerImpl :: make(
     int32_t outputWidth, int32_t outputHeight,
@@ -194,22 +640,24 @@ MediaPictureResamplerImpl :: make(
     // We're downscaling
     flags |= SWS_AREA;
 
-  retval->mContext = sws_getCachedContext(
-      0, // cached context
-      retval->mIWidth, // src width
-      retval->mIHeight, // src height
-      (enum AVPixelFormat)retval->mIPixelFmt, // src pixel type
-      retval->mOWidth, // dst width
-      retval->mOHeight, // dst height
-      (enum AVPixelFormat)retval->mOPixelFmt, // dst pixel type
-      flags, // Flags
-      0, // Source Filter
-      0, // Destination Filter
-      0 // An array of parameters for filters
-  );
-  if (!retval->mContext) {
+  // Keep the options apart from the context, as swscale adjusts some of
+  // them while it sets up; bands are set up from the same ones.
+  SwsContext* options = sws_alloc_context();
+  retval->mOptions = options;
+  if (!options ||
+      av_opt_set_int(options, "srcw", retval->mIWidth, 0) < 0 ||
+      av_opt_set_int(options, "srch", retval->mIHeight, 0) < 0 ||
+      av_opt_set_int(options, "src_format", retval->mIPixelFmt, 0) < 0 ||
+      av_opt_set_int(options, "dstw", retval->mOWidth, 0) < 0 ||
+      av_opt_set_int(options, "dsth", retval->mOHeight, 0) < 0 ||
+      av_opt_set_int(options, "dst_format", retval->mOPixelFmt, 0) < 0 ||
+      av_opt_set_int(options, "sws_flags", flags, 0) < 0) {
     VS_THROW(HumbleRuntimeError("could not allocate an image rescaler"));
   }
+  // Another resampler with the same options may have left one set up.
+  retval->mContext = SwsContextCache::get()->acquire(options);
+  if (!retval->mContext)
+    VS_THROW(HumbleRuntimeError("could not allocate an image rescaler"));
 
   return retval.get();
 }
@@ -21,6 +21,9 @@
 #define MEDIAPICTURERESAMPLERIMPL_H_
 
 #include <io/humble/video/MediaPictureResampler.h>
+#include <io/humble/video/WorkerPool.h>
+
+#include <vector>
 
 
 /*
@@ -33,6 +36,9 @@ struct SwsContext;
 namespace io { namespace humble { namespace video
 {
 
+class PictureConversion;
+class MediaPictureImpl;
+
 class MediaPictureResamplerImpl : public MediaPictureResampler
 {
 private:
@@ -46,9 +52,21 @@ virtual int32_t getOutputWidth();
 virtual int32_t getOutputHeight();
 virtual PixelFormat::Type getOutputFormat();
 
+virtual void setThreads(int32_t threads);
+virtual int32_t getThreads();
+virtual int32_t getNumBands();
+
+virtual void setFastPaths(bool fastPaths);
+virtual bool getFastPaths();
+virtual bool usesFastPath();
+
 virtual void open();
 virtual int32_t resample(MediaSampled *pOutFrame, MediaSampled *pInFrame);
 virtual int32_t resamplePicture(MediaPicture *pOutFrame, MediaPicture *pInFrame);
+virtual void checkResampleToBytes(int32_t size, MediaPicture *pInFrame);
+virtual int32_t resampleToBytes(uint8_t *out, MediaPicture *pInFrame);
+virtual void checkResampleFromBytes(MediaPicture *pOutFrame, int32_t size);
+virtual int32_t resampleFromBytes(MediaPicture *pOutFrame, const uint8_t *in);
 
 virtual State getState() { return mState; }
 static MediaPictureResamplerImpl* make(
@@ -62,6 +80,57 @@ virtual void* getCtx() { return mContext; }
 MediaPictureResamplerImpl();
 virtual ~MediaPictureResamplerImpl();
 private:
+/*
+ * A horizontal band of the output, scaled by its own SwsContext from the
+ * input rows it needs. Unless the height is unchanged, the band is scaled
+ * with extra rows above and below it, into scratch memory, so that the
+ * rows it keeps see the same vertical filter taps as a single pass would.
+ */
+class Band : public WorkerPool::Job
+{
+public:
+  Band();
+  virtual ~Band();
+  virtual void run();
+
+  SwsContext* mContext;
+  // input rows scaled, and the output rows that produces
+  int32_t mSrcY;
+  int32_t mSrcH;
+  int32_t mDstY;
+  int32_t mDstH;
+  // the output rows kept
+  int32_t mKeepY;
+  int32_t mKeepH;
+  uint8_t* mScratch[4];
+  int mScratchStride[4];
+  // the pictures being resampled, and the result of sws_scale
+  const AVFrame* mIn;
+  AVFrame* mOut;
+  int32_t mRetval;
+  // per plane: rows are shifted down by this for chroma subsampling, and
+  // the number of bytes in a line
+  int32_t mNumSrcPlanes;
+  int32_t mSrcShift[4];
+  int32_t mNumDstPlanes;
+  int32_t mDstShift[4];
+  int32_t mDstBytes[4];
+};
+
+void makeBands();
+void freeBands();
+void checkOpen();
+MediaPictureImpl* checkOutput(MediaPicture* picture);
+MediaPictureImpl* checkInput(MediaPicture* picture);
+// converts in to out, in bands if inBands and open() made any; does not
+// throw, and without bands does not touch Java or other threads either
+int32_t scale(AVFrame* out, const AVFrame* in, bool inBands);
+
+int32_t mThreads;
+std::vector<Band*> mBands;
+bool mFastPaths;
+// set when open() found a dedicated routine for these parameters
+PictureConversion* mConversion;
 int32_t mIHeight;
 int32_t mIWidth;
 int32_t mOHeight;
@@ -70,6 +139,8 @@ PixelFormat::Type mIPixelFmt;
 PixelFormat::Type mOPixelFmt;
 State mState;
 SwsContext* mContext;
+// the options mContext was set up from, before swscale adjusted any
+SwsContext* mOptions;
 };
 
 }}}
@@ -0,0 +1,662 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/Global.h>
+#include <io/humble/video/VideoExceptions.h>
+#include <io/humble/video/FfmpegIncludes.h>
+#include "MediaRing.h"
+
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.MediaRing);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+namespace {
+
+const char MediaRing_MAGIC[8] = "HVRING1";
+
+enum {
+  MediaRing_PICTURE = 1,
+  MediaRing_AUDIO = 2,
+};
+
+/**
+ * A count changed by only one side of the ring, on a cache line of its
+ * own so the two sides do not fight over it.
+ */
+struct MediaRingCounter {
+  volatile int64_t count;
+  volatile int32_t closed;
+  char pad[64 - sizeof(int64_t) - sizeof(int32_t)];
+};
+
+/**
+ * The start of the shared memory. Every field but the counters is fixed
+ * when the ring is made.
+ */
+struct MediaRingHeader {
+  char magic[8];
+  int64_t length;
+  int32_t numSlots;
+  int32_t slotSize;
+  int32_t slotStride;
+  int32_t dataOffset;
+  volatile int32_t readers;
+  char pad[64 - 8 - sizeof(int64_t) - 5*sizeof(int32_t)];
+  /** Slots written; only the writer changes it. */
+  MediaRingCounter written;
+  /** Slots handed back; only the reader changes it. */
+  MediaRingCounter handedBack;
+};
+
+/**
+ * What a slot holds, written before the slot is counted as written.
+ */
+struct MediaRingSlot {
+  int32_t type;
+  int32_t size;
+  int32_t format;
+  int32_t complete;
+  int64_t timeStamp;
+  int32_t timeBaseNumerator;
+  int32_t timeBaseDenominator;
+  // pictures
+  int32_t width;
+  int32_t height;
+  int32_t key;
+  int32_t pictureType;
+  int32_t interlaced;
+  int32_t topFieldFirst;
+  int32_t repeat;
+  // audio
+  int32_t numSamples;
+  int32_t sampleRate;
+  int32_t channels;
+  int64_t channelLayout;
+};
+
+/**
+ * Handed to the Buffer wrapping a slot read, so the slot can be handed
+ * back when the Buffer goes.
+ */
+struct MediaRingLease {
+  MediaRing* ring;
+  int64_t index;
+};
+
+void
+MediaRing_release(void*, void* closure) {
+  MediaRingLease* lease = (MediaRingLease*)closure;
+  lease->ring->handBack(lease->index);
+  VS_REF_RELEASE(lease->ring);
+  delete lease;
+}
+
+MediaRingHeader*
+MediaRing_header(unsigned char* memory) {
+  return (MediaRingHeader*)memory;
+}
+
+MediaRingSlot*
+MediaRing_slot(unsigned char* memory, int32_t numSlots, int64_t index) {
+  MediaRingSlot* slots = (MediaRingSlot*)(memory + sizeof(MediaRingHeader));
+  return &slots[index % numSlots];
+}
+
+/**
+ * Spins briefly, then sleeps for longer and longer up to a millisecond.
+ */
+void
+MediaRing_pause(int32_t round) {
+#ifndef _WIN32
+  if (round < 16) {
+    sched_yield();
+    return;
+  }
+#endif
+  int32_t shift = round < 16 ? 0 : round - 16;
+  av_usleep(shift < 7 ? 10 << shift : 1000);
+}
+
+std::string
+MediaRing_name(const char* name) {
+  if (!name || !*name)
+    VS_THROW(HumbleInvalidArgument("no name for ring"));
+  return name[0] == '/' ? std::string(name) : std::string("/") + name;
+}
+
+}
+
+MediaRing::MediaRing() :
+    mWriter(false), mClosed(false), mMemory(0), mLength(0), mNumSlots(0),
+    mSlotSize(0), mSlotStride(0), mNext(0), mTail(0) {
+}
+
+MediaRing::~MediaRing() {
+  close();
+#ifndef _WIN32
+  if (mMemory)
+    munmap(mMemory, mLength);
+#endif
+  mMemory = 0;
+}
+
+#ifndef _WIN32
+MediaRing*
+MediaRing::make(const char* name, int32_t numSlots, int32_t slotSize) {
+  Global::init();
+  std::string shmName = MediaRing_name(name);
+  if (numSlots < 1)
+    VS_THROW(HumbleInvalidArgument("numSlots must be > 0"));
+  if (slotSize < 1)
+    VS_THROW(HumbleInvalidArgument("slotSize must be > 0"));
+
+  // slot data starts on a page, and each slot on a cache line.
+  int64_t page = sysconf(_SC_PAGESIZE);
+  int64_t stride = ((int64_t)slotSize + 63) & ~(int64_t)63;
+  int64_t dataOffset = (int64_t)sizeof(MediaRingHeader)
+      + (int64_t)numSlots * (int64_t)sizeof(MediaRingSlot);
+  dataOffset = (dataOffset + page - 1) / page * page;
+  int64_t length = dataOffset + stride * numSlots;
+  if (stride > INT32_MAX || dataOffset > INT32_MAX || length != (int64_t)(size_t)length
+      || length != (int64_t)(off_t)length)
+    VS_THROW(HumbleInvalidArgument("ring too large"));
+
+  int fd = shm_open(shmName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0)
+    VS_THROW(HumbleRuntimeError::make("could not make ring %s: %s",
+        shmName.c_str(), strerror(errno)));
+  if (ftruncate(fd, (off_t)length) < 0) {
+    int error = errno;
+    ::close(fd);
+    shm_unlink(shmName.c_str());
+    VS_THROW(HumbleRuntimeError::make("could not size ring %s: %s",
+        shmName.c_str(), strerror(error)));
+  }
+  RefPointer<MediaRing> retval;
+  try {
+    retval.reset(new MediaRing(), true);
+    retval->mName = shmName;
+    retval->mWriter = true;
+    retval->map(fd, (size_t)length);
+  } catch (...) {
+    ::close(fd);
+    shm_unlink(shmName.c_str());
+    throw;
+  }
+  ::close(fd);
+
+  // fresh shared memory is zeroed, so only the layout needs filling in;
+  // the magic goes last so a reader never sees half a header.
+  MediaRingHeader* header = MediaRing_header(retval->mMemory);
+  header->length = length;
+  header->numSlots = numSlots;
+  header->slotSize = slotSize;
+  header->slotStride = (int32_t)stride;
+  header->dataOffset = (int32_t)dataOffset;
+  __sync_synchronize();
+  memcpy(header->magic, MediaRing_MAGIC, sizeof(header->magic));
+  retval->mNumSlots = numSlots;
+  retval->mSlotSize = slotSize;
+  retval->mSlotStride = (int32_t)stride;
+  VS_LOG_TRACE("make MediaRing@%p[name:%s;slots:%d;size:%d]", retval.value(),
+      shmName.c_str(), numSlots, slotSize);
+  return retval.get();
+}
+
+MediaRing*
+MediaRing::open(const char* name) {
+  Global::init();
+  std::string shmName = MediaRing_name(name);
+  int fd = shm_open(shmName.c_str(), O_RDWR, 0);
+  if (fd < 0)
+    VS_THROW(HumbleRuntimeError::make("could not open ring %s: %s",
+        shmName.c_str(), strerror(errno)));
+  struct stat info;
+  if (fstat(fd, &info) < 0 || info.st_size < (off_t)sizeof(MediaRingHeader)) {
+    ::close(fd);
+    VS_THROW(HumbleRuntimeError::make("%s is not a ring", shmName.c_str()));
+  }
+  RefPointer<MediaRing> retval;
+  try {
+    retval.reset(new MediaRing(), true);
+    retval->mName = shmName;
+    retval->map(fd, (size_t)info.st_size);
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+  ::close(fd);
+
+  MediaRingHeader* header = MediaRing_header(retval->mMemory);
+  __sync_synchronize();
+  if (memcmp(header->magic, MediaRing_MAGIC, sizeof(header->magic))
+      || header->length != (int64_t)info.st_size
+      || header->numSlots < 1
+      || header->slotSize < 1
+      || header->slotSize > header->slotStride
+      || header->dataOffset < (int64_t)sizeof(MediaRingHeader)
+          + (int64_t)header->numSlots * (int64_t)sizeof(MediaRingSlot)
+      || header->length < header->dataOffset
+          + (int64_t)header->slotStride * header->numSlots)
+    VS_THROW(HumbleRuntimeError::make("%s is not a ring", shmName.c_str()));
+  if (!__sync_bool_compare_and_swap(&header->readers, 0, 1))
+    VS_THROW(HumbleRuntimeError::make("ring %s already has a reader",
+        shmName.c_str()));
+  retval->mNumSlots = header->numSlots;
+  retval->mSlotSize = header->slotSize;
+  retval->mSlotStride = header->slotStride;
+  retval->mNext = retval->mTail = header->handedBack.count;
+  retval->mHandedBack.assign(header->numSlots, false);
+  VS_LOG_TRACE("open MediaRing@%p[name:%s;slots:%d;size:%d]", retval.value(),
+      shmName.c_str(), retval->mNumSlots, retval->mSlotSize);
+  return retval.get();
+}
+
+void
+MediaRing::map(int fd, size_t length) {
+  void* memory = mmap(0, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (memory == MAP_FAILED)
+    VS_THROW(HumbleRuntimeError::make("could not map ring %s: %s",
+        mName.c_str(), strerror(errno)));
+  mMemory = (unsigned char*)memory;
+  mLength = length;
+}
+
+void
+MediaRing::close() {
+  if (mClosed || !mMemory)
+    return;
+  mClosed = true;
+  MediaRingHeader* header = MediaRing_header(mMemory);
+  __sync_synchronize();
+  if (mWriter) {
+    header->written.closed = 1;
+    // readers that have it open keep their mapping.
+    shm_unlink(mName.c_str());
+  } else
+    header->handedBack.closed = 1;
+  __sync_synchronize();
+}
+
+int32_t
+MediaRing::wait(int64_t timeout) {
+  MediaRingHeader* header = MediaRing_header(mMemory);
+  int64_t deadline = timeout > 0 ? av_gettime_relative() + timeout : 0;
+  for(int32_t round = 0; ; round++) {
+    __sync_synchronize();
+    if (mWriter) {
+      if (header->handedBack.closed)
+        return -1;
+      if (mNext - header->handedBack.count < mNumSlots)
+        return 1;
+    } else {
+      // the writer counts its last slot before it closes.
+      bool closed = header->written.closed;
+      __sync_synchronize();
+      if (mNext < header->written.count)
+        return 1;
+      if (closed)
+        return -1;
+    }
+    if (timeout == 0 || (timeout > 0 && av_gettime_relative() >= deadline))
+      return 0;
+    MediaRing_pause(round);
+  }
+}
+
+void*
+MediaRing::beginWrite(int32_t size, int64_t timeout) {
+  if (!mWriter)
+    VS_THROW(HumbleRuntimeError("cannot write to the reading end of a ring"));
+  if (mClosed)
+    VS_THROW(HumbleRuntimeError("ring is closed"));
+  if (size > mSlotSize)
+    VS_THROW(HumbleInvalidArgument::make("%d bytes do not fit in a %d byte slot",
+        size, mSlotSize));
+  int32_t ready = wait(timeout);
+  if (ready < 0)
+    VS_THROW(HumbleRuntimeError("the reader has closed the ring"));
+  if (!ready)
+    return 0;
+  return mMemory + MediaRing_header(mMemory)->dataOffset
+      + (mNext % mNumSlots) * (int64_t)mSlotStride;
+}
+
+void
+MediaRing::endWrite() {
+  // the slot and what it holds must be seen before the count that shows them.
+  __sync_synchronize();
+  MediaRing_header(mMemory)->written.count = ++mNext;
+  __sync_synchronize();
+}
+
+void*
+MediaRing::beginRead(int32_t type, int64_t timeout) {
+  if (mWriter)
+    VS_THROW(HumbleRuntimeError("cannot read from the writing end of a ring"));
+  if (mClosed)
+    VS_THROW(HumbleRuntimeError("ring is closed"));
+  if (wait(timeout) <= 0)
+    return 0;
+  // and nothing in the slot may be read before the count that showed it.
+  __sync_synchronize();
+  MediaRingSlot* slot = MediaRing_slot(mMemory, mNumSlots, mNext);
+  if (slot->type != type)
+    VS_THROW(HumbleRuntimeError(type == MediaRing_PICTURE ?
+        "next frame in ring is not a picture" : "next frame in ring is not audio"));
+  if (slot->size < 0 || slot->size > mSlotSize)
+    VS_THROW(HumbleRuntimeError("corrupt slot in ring"));
+  return mMemory + MediaRing_header(mMemory)->dataOffset
+      + (mNext % mNumSlots) * (int64_t)mSlotStride;
+}
+
+Buffer*
+MediaRing::lease(void* data, int32_t size) {
+  MediaRingLease* lease = new MediaRingLease;
+  lease->ring = this;
+  lease->index = mNext;
+  acquire();
+  Buffer* buffer = 0;
+  try {
+    buffer = Buffer::make(0, data, size, MediaRing_release, lease);
+  } catch (...) {
+    buffer = 0;
+  }
+  if (!buffer) {
+    release();
+    delete lease;
+    VS_THROW(HumbleBadAlloc());
+  }
+  // from here the slot goes back when the buffer does; handBack() may be
+  // reading mNext on the thread that released an earlier one.
+  Lock::Guard guard(&mLock);
+  ++mNext;
+  return buffer;
+}
+
+void
+MediaRing::handBack(int64_t index) {
+  Lock::Guard guard(&mLock);
+  mHandedBack[index % mNumSlots] = true;
+  int64_t tail = mTail;
+  while (tail < mNext && mHandedBack[tail % mNumSlots]) {
+    mHandedBack[tail % mNumSlots] = false;
+    ++tail;
+  }
+  if (tail != mTail) {
+    mTail = tail;
+    // done with the slots before saying so.
+    __sync_synchronize();
+    MediaRing_header(mMemory)->handedBack.count = tail;
+    __sync_synchronize();
+  }
+}
+
+bool
+MediaRing::isPeerClosed() {
+  if (!mMemory)
+    return true;
+  __sync_synchronize();
+  MediaRingHeader* header = MediaRing_header(mMemory);
+  return mWriter ? header->handedBack.closed : header->written.closed;
+}
+
+int32_t
+MediaRing::getNumQueued() {
+  if (!mMemory)
+    return 0;
+  __sync_synchronize();
+  MediaRingHeader* header = MediaRing_header(mMemory);
+  return (int32_t)(header->written.count - header->handedBack.count);
+}
+#else
+MediaRing*
+MediaRing::make(const char*, int32_t, int32_t) {
+  VS_THROW(HumbleRuntimeError("shared memory rings are not supported here"));
+  return 0;
+}
+
+MediaRing*
+MediaRing::open(const char*) {
+  VS_THROW(HumbleRuntimeError("shared memory rings are not supported here"));
+  return 0;
+}
+
+void
+MediaRing::map(int, size_t) {
+}
+
+void
+MediaRing::close() {
+}
+
+int32_t
+MediaRing::wait(int64_t) {
+  return -1;
+}
+
+void*
+MediaRing::beginWrite(int32_t, int64_t) {
+  return 0;
+}
+
+void
+MediaRing::endWrite() {
+}
+
+void*
+MediaRing::beginRead(int32_t, int64_t) {
+  return 0;
+}
+
+Buffer*
+MediaRing::lease(void*, int32_t) {
+  return 0;
+}
+
+void
+MediaRing::handBack(int64_t) {
+}
+
+bool
+MediaRing::isPeerClosed() {
+  return true;
+}
+
+int32_t
+MediaRing::getNumQueued() {
+  return 0;
+}
+#endif // ! _WIN32
+
+const char*
+MediaRing::getName() {
+  return mName.c_str();
+}
+
+bool
+MediaRing::isWriter() {
+  return mWriter;
+}
+
+int32_t
+MediaRing::getNumSlots() {
+  return mNumSlots;
+}
+
+int32_t
+MediaRing::getSlotSize() {
+  return mSlotSize;
+}
+
+bool
+MediaRing::writePicture(MediaPicture* picture, int64_t timeout) {
+  if (!picture)
+    VS_THROW(HumbleInvalidArgument("no picture"));
+  AVFrame* frame = picture->getCtx();
+  int32_t size = PixelFormat::getBufferSizeNeeded(frame->width, frame->height,
+      (PixelFormat::Type)frame->format);
+  if (size <= 0)
+    VS_THROW(HumbleInvalidArgument("picture has no size"));
+  uint8_t* data = (uint8_t*)beginWrite(size, timeout);
+  if (!data)
+    return false;
+  // the same packed layout MediaPicture::make(Buffer*...) expects.
+  int retval = av_image_copy_to_buffer(data, size,
+      (const uint8_t* const*)frame->data, frame->linesize,
+      (enum AVPixelFormat)frame->format, frame->width, frame->height, 1);
+  if (retval < 0)
+    VS_THROW(HumbleRuntimeError("could not copy picture into ring"));
+
+  MediaRingSlot* slot = MediaRing_slot(mMemory, mNumSlots, mNext);
+  memset(slot, 0, sizeof(*slot));
+  slot->type = MediaRing_PICTURE;
+  slot->size = size;
+  slot->format = frame->format;
+  slot->complete = picture->isComplete();
+  slot->timeStamp = picture->getTimeStamp();
+  RefPointer<Rational> timeBase = picture->getTimeBase();
+  slot->timeBaseNumerator = timeBase ? timeBase->getNumerator() : 0;
+  slot->timeBaseDenominator = timeBase ? timeBase->getDenominator() : 0;
+  slot->width = frame->width;
+  slot->height = frame->height;
+  slot->key = frame->key_frame;
+  slot->pictureType = frame->pict_type;
+  slot->interlaced = frame->interlaced_frame;
+  slot->topFieldFirst = frame->top_field_first;
+  slot->repeat = frame->repeat_pict;
+  endWrite();
+  return true;
+}
+
+bool
+MediaRing::writeAudio(MediaAudio* audio, int64_t timeout) {
+  if (!audio)
+    VS_THROW(HumbleInvalidArgument("no audio"));
+  AVFrame* frame = audio->getCtx();
+  int32_t channels = audio->getChannels();
+  int32_t numSamples = audio->getNumSamples();
+  if (numSamples <= 0 || channels <= 0)
+    VS_THROW(HumbleInvalidArgument("audio has no samples"));
+  int32_t size = AudioFormat::getBufferSizeNeeded(numSamples, channels,
+      audio->getFormat());
+  if (size <= 0)
+    VS_THROW(HumbleInvalidArgument("audio has no size"));
+  uint8_t* data = (uint8_t*)beginWrite(size, timeout);
+  if (!data)
+    return false;
+  // the same layout MediaAudio::make(Buffer*...) expects.
+  std::vector<uint8_t*> planes(channels);
+  if (av_samples_fill_arrays(&planes[0], 0, data, channels, numSamples,
+      (enum AVSampleFormat)frame->format, 0) < 0
+      || av_samples_copy(&planes[0], frame->extended_data, 0, 0, numSamples,
+          channels, (enum AVSampleFormat)frame->format) < 0)
+    VS_THROW(HumbleRuntimeError("could not copy audio into ring"));
+
+  MediaRingSlot* slot = MediaRing_slot(mMemory, mNumSlots, mNext);
+  memset(slot, 0, sizeof(*slot));
+  slot->type = MediaRing_AUDIO;
+  slot->size = size;
+  slot->format = frame->format;
+  slot->complete = audio->isComplete();
+  slot->timeStamp = audio->getTimeStamp();
+  RefPointer<Rational> timeBase = audio->getTimeBase();
+  slot->timeBaseNumerator = timeBase ? timeBase->getNumerator() : 0;
+  slot->timeBaseDenominator = timeBase ? timeBase->getDenominator() : 0;
+  slot->numSamples = numSamples;
+  slot->sampleRate = audio->getSampleRate();
+  slot->channels = channels;
+  slot->channelLayout = audio->getChannelLayout();
+  endWrite();
+  return true;
+}
+
+MediaPicture*
+MediaRing::readPicture(int64_t timeout) {
+  void* data = beginRead(MediaRing_PICTURE, timeout);
+  if (!data)
+    return 0;
+  MediaRingSlot* slot = MediaRing_slot(mMemory, mNumSlots, mNext);
+  if (PixelFormat::getBufferSizeNeeded(slot->width, slot->height,
+      (PixelFormat::Type)slot->format) != slot->size)
+    VS_THROW(HumbleRuntimeError("corrupt slot in ring"));
+  RefPointer<Buffer> buffer = lease(data, slot->size);
+  RefPointer<MediaPicture> retval = MediaPicture::make(buffer.value(),
+      slot->width, slot->height, (PixelFormat::Type)slot->format);
+  retval->setComplete(slot->complete);
+  retval->setTimeStamp(slot->timeStamp);
+  if (slot->timeBaseDenominator) {
+    RefPointer<Rational> timeBase = Rational::make(slot->timeBaseNumerator,
+        slot->timeBaseDenominator);
+    retval->setTimeBase(timeBase.value());
+  }
+  AVFrame* frame = retval->getCtx();
+  frame->key_frame = slot->key;
+  frame->pict_type = (enum AVPictureType)slot->pictureType;
+  frame->interlaced_frame = slot->interlaced;
+  frame->top_field_first = slot->topFieldFirst;
+  frame->repeat_pict = slot->repeat;
+  return retval.get();
+}
+
+MediaAudio*
+MediaRing::readAudio(int64_t timeout) {
+  void* data = beginRead(MediaRing_AUDIO, timeout);
+  if (!data)
+    return 0;
+  MediaRingSlot* slot = MediaRing_slot(mMemory, mNumSlots, mNext);
+  if (slot->numSamples <= 0 || slot->channels <= 0
+      || AudioFormat::getBufferSizeNeeded(slot->numSamples, slot->channels,
+          (AudioFormat::Type)slot->format) != slot->size)
+    VS_THROW(HumbleRuntimeError("corrupt slot in ring"));
+  RefPointer<Buffer> buffer = lease(data, slot->size);
+  RefPointer<MediaAudio> retval = MediaAudio::make(buffer.value(),
+      slot->numSamples, slot->sampleRate, slot->channels,
+      (AudioChannel::Layout)slot->channelLayout, (AudioFormat::Type)slot->format);
+  retval->setComplete(slot->complete);
+  retval->setTimeStamp(slot->timeStamp);
+  if (slot->timeBaseDenominator) {
+    RefPointer<Rational> timeBase = Rational::make(slot->timeBaseNumerator,
+        slot->timeBaseDenominator);
+    retval->setTimeBase(timeBase.value());
+  }
+  return retval.get();
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
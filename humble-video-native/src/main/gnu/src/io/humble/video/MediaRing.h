@@ -0,0 +1,225 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef MEDIARING_H_
+#define MEDIARING_H_
+
+#include <string>
+#include <vector>
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/RefCounted.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/MediaAudio.h>
+#include <io/humble/video/MediaPicture.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * A ring of frames in POSIX shared memory, for passing MediaPicture and
+ * MediaAudio objects between processes without encoding them or copying
+ * them through a pipe.
+ * <p>
+ * One process makes the ring under a name and writes to it; one other
+ * process opens the same name and reads. Each write copies one picture or
+ * audio frame, with its time stamp, time base and format, into the next
+ * free slot. Each read returns an object whose data is the slot itself,
+ * mapped into the reader, so nothing is copied on the way out.
+ * </p><p>
+ * A slot goes back to the writer once the last reference to the data read
+ * from it is released. A reader that holds on to frames therefore makes
+ * the writer wait rather than have its frames overwritten; slots are
+ * handed back in the order they were read.
+ * </p><p>
+ * The two sides share only a count of slots written, changed only by the
+ * writer, and a count of slots handed back, changed only by the reader,
+ * so neither side ever locks the other out. A side with nothing to do
+ * polls the other's count, backing off to a millisecond between looks.
+ * </p><p>
+ * Use one ring per stream; a ring carries either pictures or audio.
+ * </p>
+ */
+class VS_API_HUMBLEVIDEO MediaRing : public io::humble::ferry::RefCounted
+{
+public:
+  /**
+   * Makes a ring under name and opens it for writing.
+   *
+   * @param name The name readers open it by. A leading '/' is added if missing.
+   * @param numSlots The most frames written but not yet handed back.
+   * @param slotSize The most bytes of data one frame can hold. For pictures
+   *   that is PixelFormat#getBufferSizeNeeded(int, int, PixelFormat.Type);
+   *   for audio AudioFormat#getBufferSizeNeeded(int, int, AudioFormat.Type).
+   *
+   * @return the ring.
+   *
+   * @throws InvalidArgument if name is null or empty, numSlots < 1 or slotSize < 1.
+   * @throws RuntimeError if the ring cannot be made, for example because
+   *   a ring by that name already exists.
+   */
+  static MediaRing* make(const char* name, int32_t numSlots, int32_t slotSize);
+
+  /**
+   * Opens a ring another process made, for reading.
+   *
+   * @param name The name the ring was made under.
+   *
+   * @return the ring.
+   *
+   * @throws InvalidArgument if name is null or empty.
+   * @throws RuntimeError if there is no such ring, or it already has a reader.
+   */
+  static MediaRing* open(const char* name);
+
+  /**
+   * @return the name this ring was made or opened under.
+   */
+  const char* getName();
+
+  /**
+   * @return true if this end writes; false if it reads.
+   */
+  bool isWriter();
+
+  /**
+   * @return the number of slots in the ring.
+   */
+  int32_t getNumSlots();
+
+  /**
+   * @return the most bytes of data one slot holds.
+   */
+  int32_t getSlotSize();
+
+  /**
+   * @return the number of frames written and not yet handed back by the reader.
+   */
+  int32_t getNumQueued();
+
+  /**
+   * Copies picture into the next free slot, waiting for one if needed.
+   *
+   * @param picture The picture to write.
+   * @param timeout The most microseconds to wait for a free slot; a
+   *   negative value waits as long as it takes.
+   *
+   * @return true if the picture was written; false if no slot came free in time.
+   *
+   * @throws InvalidArgument if picture is null or larger than #getSlotSize().
+   * @throws RuntimeError if this end reads, this end is closed, or the reader has closed its end.
+   */
+  bool writePicture(MediaPicture* picture, int64_t timeout);
+
+  /**
+   * Copies the samples in audio into the next free slot, waiting for one if
+   * needed.
+   *
+   * @param audio The audio to write.
+   * @param timeout The most microseconds to wait for a free slot; a
+   *   negative value waits as long as it takes.
+   *
+   * @return true if the audio was written; false if no slot came free in time.
+   *
+   * @throws InvalidArgument if audio is null or larger than #getSlotSize().
+   * @throws RuntimeError if this end reads, this end is closed, or the reader has closed its end.
+   */
+  bool writeAudio(MediaAudio* audio, int64_t timeout);
+
+  /**
+   * Reads the next picture, waiting for one if needed. Its data is the
+   * slot itself; the slot is handed back once that data is released.
+   *
+   * @param timeout The most microseconds to wait; a negative value waits
+   *   as long as it takes.
+   *
+   * @return the picture, or null if none was written in time or the
+   *   writer has closed its end and every frame has been read.
+   *
+   * @throws RuntimeError if this end writes, or the next frame is audio.
+   */
+  MediaPicture* readPicture(int64_t timeout);
+
+  /**
+   * Reads the next audio, waiting for it if needed. Its data is the
+   * slot itself; the slot is handed back once that data is released.
+   *
+   * @param timeout The most microseconds to wait; a negative value waits
+   *   as long as it takes.
+   *
+   * @return the audio, or null if none was written in time or the
+   *   writer has closed its end and every frame has been read.
+   *
+   * @throws RuntimeError if this end writes, or the next frame is a picture.
+   */
+  MediaAudio* readAudio(int64_t timeout);
+
+  /**
+   * Closes this end. A writer closing tells the reader no more frames are
+   * coming, and removes the name; a reader closing makes further writes
+   * fail. Frames already read stay valid. Called when the ring is
+   * destroyed if not called before.
+   */
+  void close();
+
+  /**
+   * @return true if the other end has closed.
+   */
+  bool isPeerClosed();
+
+#ifndef SWIG
+  /**
+   * Lets go of the slot at index once the reader no longer needs it.
+   */
+  void handBack(int64_t index);
+#endif // ! SWIG
+
+protected:
+  MediaRing();
+  virtual ~MediaRing();
+
+private:
+  void map(int fd, size_t length);
+  int32_t wait(int64_t timeout);
+  void* beginWrite(int32_t size, int64_t timeout);
+  void endWrite();
+  void* beginRead(int32_t type, int64_t timeout);
+  io::humble::ferry::Buffer* lease(void* data, int32_t size);
+
+  std::string mName;
+  bool mWriter;
+  bool mClosed;
+  unsigned char* mMemory;
+  size_t mLength;
+  int32_t mNumSlots;
+  int32_t mSlotSize;
+  int32_t mSlotStride;
+  /** The next slot to write (writer) or read (reader). */
+  int64_t mNext;
+  /** Reader only: slots handed back, in ring order, but not yet published. */
+  io::humble::ferry::Lock mLock;
+  std::vector<bool> mHandedBack;
+  int64_t mTail;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* MEDIARING_H_ */
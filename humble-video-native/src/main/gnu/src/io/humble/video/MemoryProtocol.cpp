@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <io/humble/video/Global.h>
+#include <io/humble/video/VideoExceptions.h>
+#include <io/humble/video/customio/MemoryURLProtocolManager.h>
+#include "MemoryProtocol.h"
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.MemoryProtocol);
+
+using namespace io::humble::ferry;
+using namespace io::humble::video::customio;
+
+namespace io {
+namespace humble {
+namespace video {
+
+static const char* MemoryProtocol_NAME = "mem";
+
+/**
+ * Find the registered manager, registering it again if someone has
+ * unregistered all protocols since Global::init().
+ */
+static MemoryURLProtocolManager*
+MemoryProtocol_getManager() {
+  Global::init();
+  Global::lock();
+  MemoryURLProtocolManager* mgr = dynamic_cast<MemoryURLProtocolManager*>(
+      URLProtocolManager::findProtocol(MemoryProtocol_NAME, 0, 0, 0));
+  if (!mgr)
+    mgr = MemoryURLProtocolManager::registerProtocol(MemoryProtocol_NAME);
+  Global::unlock();
+  return mgr;
+}
+
+MemoryProtocol::MemoryProtocol() {
+}
+
+MemoryProtocol::~MemoryProtocol() {
+}
+
+const char*
+MemoryProtocol::getProtocolName() {
+  return MemoryProtocol_NAME;
+}
+
+void
+MemoryProtocol::addSource(const char* name, Buffer* buffer) {
+  if (!name || !*name)
+    VS_THROW(HumbleInvalidArgument("no name passed in"));
+  if (!buffer)
+    VS_THROW(HumbleInvalidArgument("no buffer passed in"));
+  MemoryProtocol_getManager()->addSource(name, buffer);
+}
+
+bool
+MemoryProtocol::removeSource(const char* name) {
+  return MemoryProtocol_getManager()->removeSource(name);
+}
+
+Buffer*
+MemoryProtocol::takeOutput(const char* name) {
+  return MemoryProtocol_getManager()->takeOutput(name);
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef MEMORYPROTOCOL_H_
+#define MEMORYPROTOCOL_H_
+
+#include <io/humble/ferry/Buffer.h>
+#include <io/humble/ferry/RefCounted.h>
+#include <io/humble/video/HumbleVideo.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Lets a Demuxer read from, and a Muxer write to, memory instead of files.
+ * <p>
+ * Add the data to read under a name with #addSource(String, Buffer), then
+ * open the URL "mem:" + name. Open "mem:" + name for writing and, once the
+ * Muxer is closed, #takeOutput(String) returns everything written in one
+ * Buffer.
+ * </p><p>
+ * Data is served straight from the native memory of the Buffers (or direct
+ * ByteBuffers) you add, and written into native memory that becomes the
+ * output Buffer without a copy; reads and writes never call back into Java.
+ * </p>
+ */
+class VS_API_HUMBLEVIDEO MemoryProtocol : public io::humble::ferry::RefCounted
+{
+public:
+  /**
+   * @return the protocol name to put in front of names in URLs: "mem".
+   */
+  static const char* getProtocolName();
+
+  /**
+   * Appends buffer to the data read from "mem:" + name. Readers see all the
+   * buffers added under a name as one stream, in the order they were added,
+   * so media larger than one Buffer can be added in pieces.
+   * <p>
+   * Do not change the data in buffer while the source is in use.
+   * </p>
+   *
+   * @param name The name to read the data back as.
+   * @param buffer The data. It is kept until #removeSource(String) is called.
+   *
+   * @throws InvalidArgument if name is null or empty, or buffer is null.
+   */
+  static void addSource(const char* name, io::humble::ferry::Buffer* buffer);
+
+  /**
+   * Forgets the data added under name. Demuxers already reading it keep
+   * reading.
+   *
+   * @param name The name the data was added as.
+   * @return true if there was data under name.
+   */
+  static bool removeSource(const char* name);
+
+  /**
+   * Takes what was written to "mem:" + name the last time a writer of it
+   * closed. The data is only returned once.
+   *
+   * @param name The name written to.
+   * @return The data, or null if nothing has been written to name.
+   */
+  static io::humble::ferry::Buffer* takeOutput(const char* name);
+
+private:
+  MemoryProtocol();
+  virtual ~MemoryProtocol();
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* MEMORYPROTOCOL_H_ */
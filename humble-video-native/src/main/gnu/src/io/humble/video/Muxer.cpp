@@ -32,6 +32,7 @@
 #include "VideoExceptions.h"
 #include "KeyValueBagImpl.h"
 #include "MediaPacketImpl.h"
+#include "ContainerIO.h"
 
 VS_LOG_SETUP(VS_CPP_PACKAGE.Muxer);
 
@@ -61,7 +62,7 @@ Muxer::Muxer(MuxerFormat* format, const char* filename,
     const char* formatName) {
   mState = STATE_INITED;
   mIOHandler = 0;
-  mBufferLength = 2048;
+  mBufferLength = 0;
 
   mCtx = 0;
   int e = avformat_alloc_output_context2(&mCtx, format ? format->getCtx() : 0, formatName,
@@ -133,8 +134,8 @@ Muxer::make(const char* filename, MuxerFormat *format, const char* formatName) {
 
 void
 Muxer::setOutputBufferLength(int32_t size) {
-  if (size <= 0)
-  VS_THROW(HumbleInvalidArgument("size <= 0"));
+  if (size < 0)
+  VS_THROW(HumbleInvalidArgument("size < 0"));
   if (mState != STATE_INITED)
   VS_THROW(HumbleRuntimeError("Muxer object has already been opened"));
   mBufferLength = size;
@@ -167,23 +168,12 @@ Muxer::open(KeyValueBag *aInputOptions, KeyValueBag* aOutputOptions) {
 
   if (mIOHandler) {
     ctx->flags |= AVFMT_FLAG_CUSTOM_IO;
-    // free and realloc the input buffer length
-    uint8_t* buffer = (uint8_t*) av_malloc(mBufferLength);
-    if (!buffer) {
-      mState = STATE_ERROR;
-      VS_THROW(HumbleBadAlloc());
-    }
-
-    // we will allocate ourselves an io context;
-    // ownership of buffer passes here.
-    ctx->pb = avio_alloc_context(buffer, mBufferLength, 1, mIOHandler,
-        Container::url_read, Container::url_write, Container::url_seek);
+    // we will allocate ourselves an io context that counts calls into
+    // the handler and, if no length was set, picks and grows its buffer.
+    ctx->pb = getIO()->open(mIOHandler, url, true, mBufferLength);
     if (!ctx->pb) {
-      av_free(buffer);
       mState = STATE_ERROR;
-      VS_THROW(
-          HumbleRuntimeError::make(
-              "could not open url due to internal error: %s", url));
+      VS_THROW(HumbleBadAlloc());
     }
   }
   // Check for passed in options
@@ -256,6 +246,8 @@ Muxer::close() {
   }
   if (mIOHandler) {
     e = mIOHandler->url_close();
+    getIO()->close();
+    ctx->pb = 0;
   } else if (!(ctx->flags & AVFMT_NOFILE))
     e = avio_close(ctx->pb);
   FfmpegException::check(e, "could not close url ");
@@ -469,6 +461,7 @@ Muxer::write(MediaPacket* aPacket, bool forceInterleave) {
   /// now, do the madness.
   AVPacket* out = outPacket->getCtx();
   int e;
+  ContainerIO::adapt(getFormatCtx()->pb);
   pushCoders();
   if (forceInterleave)
     e = av_interleaved_write_frame(getFormatCtx(), out);
@@ -144,12 +144,14 @@ public:
   int32_t getNumStreams() { return getFormatCtx()->nb_streams; }
 
   /**
-   * Set the buffer length Humble Video will suggest to FFMPEG for writing output data.
+   * Set the buffer length Humble Video will suggest to FFMPEG for writing output data
+   * to an io.humble.video.customio.URLProtocolHandler.
    *
    * If called when a Container is open, the call is ignored and -1 is returned.
    *
-   * @param size The suggested buffer size.
-   * @throws InvalidArgument if size <= 0
+   * @param size The suggested buffer size, or 0 (the default) to let Humble Video
+   *   pick a size from the handler and grow it while writing. See Container#getIOBufferLength().
+   * @throws InvalidArgument if size < 0
    */
   virtual void
   setOutputBufferLength(int32_t size);
@@ -157,8 +159,8 @@ public:
   /**
    * Return the output buffer length.
    *
-   * @return The input buffer length Humble Video told FFMPEG to assume.
-   *   0 means FFMPEG should choose it's own size (and it'll probably be 32768).
+   * @return The output buffer length Humble Video told FFMPEG to assume.
+   *   0 means Humble Video picks and adapts the size itself.
    */
   virtual int32_t
   getOutputBufferLength();
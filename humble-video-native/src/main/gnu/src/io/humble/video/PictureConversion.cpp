@@ -0,0 +1,1029 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "PictureConversion.h"
+
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define PICTURECONVERSION_X86 1
+#include <immintrin.h>
+#define PICTURECONVERSION_SSE4 __attribute__((target("sse4.1")))
+#define PICTURECONVERSION_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace io {
+namespace humble {
+namespace video {
+
+/*
+ * Row kernels. n counts output elements, except for duplicate, which
+ * doubles n source elements. The vector versions hand whatever is left
+ * over at the end of a row to the scalar ones.
+ */
+struct PictureConversion::Kernels
+{
+  void (*yuvToRgb)(uint8_t* r, uint8_t* g, uint8_t* b,
+      const uint8_t* y, const uint8_t* u, const uint8_t* v, int32_t n);
+  void (*rgbToY)(uint8_t* y,
+      const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n);
+  void (*rgbToUV)(uint8_t* u, uint8_t* v,
+      const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n);
+  void (*yToGray)(uint8_t* gray, const uint8_t* y, int32_t n);
+  void (*grayToY)(uint8_t* y, const uint8_t* gray, int32_t n);
+  // each output is the mean of a 2x2 block of the two rows
+  void (*average)(uint8_t* dst, const uint8_t* row0, const uint8_t* row1,
+      int32_t n);
+  void (*duplicate)(uint8_t* dst, const uint8_t* src, int32_t n);
+  void (*splitUV)(uint8_t* u, uint8_t* v, const uint8_t* uv, int32_t n);
+  void (*mergeUV)(uint8_t* uv, const uint8_t* u, const uint8_t* v, int32_t n);
+  void (*packBgr24)(uint8_t* dst,
+      const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n);
+  void (*packRgba)(uint8_t* dst,
+      const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n);
+  void (*unpackBgr24)(uint8_t* r, uint8_t* g, uint8_t* b,
+      const uint8_t* src, int32_t n);
+  void (*unpackRgba)(uint8_t* r, uint8_t* g, uint8_t* b,
+      const uint8_t* src, int32_t n);
+};
+
+namespace {
+
+/*
+ * BT.601 coefficients in 1/16384ths. Every kernel multiplies a sample
+ * shifted up 7 bits by one of these, rounding the product down by 15
+ * bits the way pmulhrsw does, which leaves 6 bits of fraction; terms are
+ * summed in 16 bits and rounded off at the end.
+ */
+enum {
+  COEF_Y = 19077,     // 255/219
+  COEF_RV = 26149,    // 1.596
+  COEF_GU = 6419,     // 0.392
+  COEF_GV = 13320,    // 0.813
+  COEF_BU = 282,      // 2.017, less the 2 added by shifting
+  COEF_RY = 4207,     // 0.257
+  COEF_GY = 8260,     // 0.504
+  COEF_BY = 1604,     // 0.098
+  COEF_UB = 7196,     // 0.439, also red's part of V
+  COEF_UR = 2428,     // 0.148
+  COEF_UG = 4768,     // 0.291
+  COEF_VG = 6026,     // 0.368
+  COEF_VB = 1170,     // 0.071
+  COEF_GRAY = 14071,  // 219/255
+};
+
+const int32_t sNumRows = 25;
+
+inline int32_t
+PictureConversion_mulhrs(int32_t a, int32_t b)
+{
+  return (a * b + 0x4000) >> 15;
+}
+
+inline uint8_t
+PictureConversion_clip(int32_t x)
+{
+  return (uint8_t)(x < 0 ? 0 : x > 255 ? 255 : x);
+}
+
+void
+scalar_yuvToRgb(uint8_t* r, uint8_t* g, uint8_t* b,
+    const uint8_t* y, const uint8_t* u, const uint8_t* v, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    int32_t luma = PictureConversion_mulhrs((y[i] - 16) << 7, COEF_Y) + 32;
+    int32_t cu = (u[i] - 128) << 7;
+    int32_t cv = (v[i] - 128) << 7;
+    r[i] = PictureConversion_clip(
+        (luma + PictureConversion_mulhrs(cv, COEF_RV)) >> 6);
+    g[i] = PictureConversion_clip((luma - PictureConversion_mulhrs(cu, COEF_GU) -
+        PictureConversion_mulhrs(cv, COEF_GV)) >> 6);
+    b[i] = PictureConversion_clip(
+        (luma + cu + PictureConversion_mulhrs(cu, COEF_BU)) >> 6);
+  }
+}
+
+void
+scalar_rgbToY(uint8_t* y,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    y[i] = PictureConversion_clip(((PictureConversion_mulhrs(r[i] << 7, COEF_RY) +
+        PictureConversion_mulhrs(g[i] << 7, COEF_GY) +
+        PictureConversion_mulhrs(b[i] << 7, COEF_BY) + 32) >> 6) + 16);
+}
+
+void
+scalar_rgbToUV(uint8_t* u, uint8_t* v,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    u[i] = PictureConversion_clip(((PictureConversion_mulhrs(b[i] << 7, COEF_UB) -
+        PictureConversion_mulhrs(r[i] << 7, COEF_UR) -
+        PictureConversion_mulhrs(g[i] << 7, COEF_UG) + 32) >> 6) + 128);
+    v[i] = PictureConversion_clip(((PictureConversion_mulhrs(r[i] << 7, COEF_UB) -
+        PictureConversion_mulhrs(g[i] << 7, COEF_VG) -
+        PictureConversion_mulhrs(b[i] << 7, COEF_VB) + 32) >> 6) + 128);
+  }
+}
+
+void
+scalar_yToGray(uint8_t* gray, const uint8_t* y, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    gray[i] = PictureConversion_clip(
+        (PictureConversion_mulhrs((y[i] - 16) << 7, COEF_Y) + 32) >> 6);
+}
+
+void
+scalar_grayToY(uint8_t* y, const uint8_t* gray, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    y[i] = PictureConversion_clip(
+        ((PictureConversion_mulhrs(gray[i] << 7, COEF_GRAY) + 32) >> 6) + 16);
+}
+
+void
+scalar_average(uint8_t* dst, const uint8_t* row0, const uint8_t* row1,
+    int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[i] = (uint8_t)((row0[2*i] + row0[2*i+1] + row1[2*i] + row1[2*i+1] + 2) >> 2);
+}
+
+void
+scalar_duplicate(uint8_t* dst, const uint8_t* src, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++)
+    dst[2*i] = dst[2*i+1] = src[i];
+}
+
+void
+scalar_splitUV(uint8_t* u, uint8_t* v, const uint8_t* uv, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    u[i] = uv[2*i];
+    v[i] = uv[2*i+1];
+  }
+}
+
+void
+scalar_mergeUV(uint8_t* uv, const uint8_t* u, const uint8_t* v, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    uv[2*i] = u[i];
+    uv[2*i+1] = v[i];
+  }
+}
+
+void
+scalar_packBgr24(uint8_t* dst,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    dst[3*i] = b[i];
+    dst[3*i+1] = g[i];
+    dst[3*i+2] = r[i];
+  }
+}
+
+void
+scalar_packRgba(uint8_t* dst,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    dst[4*i] = r[i];
+    dst[4*i+1] = g[i];
+    dst[4*i+2] = b[i];
+    dst[4*i+3] = 255;
+  }
+}
+
+void
+scalar_unpackBgr24(uint8_t* r, uint8_t* g, uint8_t* b,
+    const uint8_t* src, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    b[i] = src[3*i];
+    g[i] = src[3*i+1];
+    r[i] = src[3*i+2];
+  }
+}
+
+void
+scalar_unpackRgba(uint8_t* r, uint8_t* g, uint8_t* b,
+    const uint8_t* src, int32_t n)
+{
+  for(int32_t i = 0; i < n; i++) {
+    r[i] = src[4*i];
+    g[i] = src[4*i+1];
+    b[i] = src[4*i+2];
+  }
+}
+
+const PictureConversion::Kernels sScalar = {
+  scalar_yuvToRgb,
+  scalar_rgbToY,
+  scalar_rgbToUV,
+  scalar_yToGray,
+  scalar_grayToY,
+  scalar_average,
+  scalar_duplicate,
+  scalar_splitUV,
+  scalar_mergeUV,
+  scalar_packBgr24,
+  scalar_packRgba,
+  scalar_unpackBgr24,
+  scalar_unpackRgba,
+};
+
+#ifdef PICTURECONVERSION_X86
+
+/*
+ * pshufb masks that move 16 pixels of BGR24 between three planes and
+ * three 16 byte vectors: sPackMasks[vector][plane] picks the bytes of a
+ * vector out of a plane, and sUnpackMasks[plane][vector] the bytes of a
+ * plane out of a vector. Planes are in memory order: blue, green, red.
+ * 0x80 picks zero.
+ */
+uint8_t sPackMasks[3][3][16];
+uint8_t sUnpackMasks[3][3][16];
+
+struct PictureConversion_Masks
+{
+  PictureConversion_Masks() {
+    for(int32_t k = 0; k < 3; k++)
+      for(int32_t c = 0; c < 3; c++)
+        for(int32_t j = 0; j < 16; j++) {
+          int32_t byte = 16 * k + j;
+          sPackMasks[k][c][j] = byte % 3 == c ? (uint8_t)(byte / 3) : 0x80;
+          byte = 3 * j + c;
+          sUnpackMasks[c][k][j] = byte / 16 == k ? (uint8_t)(byte % 16) : 0x80;
+        }
+  }
+} sMasks;
+
+/*
+ * Converts 8 pixels held as 16 bit lanes; see scalar_yuvToRgb, which
+ * this matches exactly. Only sums that end up over 255 can saturate.
+ */
+PICTURECONVERSION_SSE4 inline void
+sse4_yuvToRgb8(__m128i y, __m128i u, __m128i v,
+    __m128i* r, __m128i* g, __m128i* b)
+{
+  y = _mm_mulhrs_epi16(_mm_slli_epi16(_mm_sub_epi16(y, _mm_set1_epi16(16)), 7),
+      _mm_set1_epi16(COEF_Y));
+  y = _mm_add_epi16(y, _mm_set1_epi16(32));
+  u = _mm_slli_epi16(_mm_sub_epi16(u, _mm_set1_epi16(128)), 7);
+  v = _mm_slli_epi16(_mm_sub_epi16(v, _mm_set1_epi16(128)), 7);
+  *r = _mm_srai_epi16(_mm_adds_epi16(y,
+      _mm_mulhrs_epi16(v, _mm_set1_epi16(COEF_RV))), 6);
+  *g = _mm_srai_epi16(_mm_subs_epi16(_mm_subs_epi16(y,
+      _mm_mulhrs_epi16(u, _mm_set1_epi16(COEF_GU))),
+      _mm_mulhrs_epi16(v, _mm_set1_epi16(COEF_GV))), 6);
+  *b = _mm_srai_epi16(_mm_adds_epi16(_mm_adds_epi16(y, u),
+      _mm_mulhrs_epi16(u, _mm_set1_epi16(COEF_BU))), 6);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_yuvToRgb(uint8_t* r, uint8_t* g, uint8_t* b,
+    const uint8_t* y, const uint8_t* u, const uint8_t* v, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i ys = _mm_loadu_si128((const __m128i*)(y + i));
+    __m128i us = _mm_loadu_si128((const __m128i*)(u + i));
+    __m128i vs = _mm_loadu_si128((const __m128i*)(v + i));
+    __m128i r0, g0, b0, r1, g1, b1;
+    sse4_yuvToRgb8(_mm_cvtepu8_epi16(ys), _mm_cvtepu8_epi16(us),
+        _mm_cvtepu8_epi16(vs), &r0, &g0, &b0);
+    sse4_yuvToRgb8(_mm_cvtepu8_epi16(_mm_srli_si128(ys, 8)),
+        _mm_cvtepu8_epi16(_mm_srli_si128(us, 8)),
+        _mm_cvtepu8_epi16(_mm_srli_si128(vs, 8)), &r1, &g1, &b1);
+    _mm_storeu_si128((__m128i*)(r + i), _mm_packus_epi16(r0, r1));
+    _mm_storeu_si128((__m128i*)(g + i), _mm_packus_epi16(g0, g1));
+    _mm_storeu_si128((__m128i*)(b + i), _mm_packus_epi16(b0, b1));
+  }
+  scalar_yuvToRgb(r + i, g + i, b + i, y + i, u + i, v + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 inline __m128i
+sse4_rgbToY8(__m128i r, __m128i g, __m128i b)
+{
+  __m128i y = _mm_add_epi16(
+      _mm_mulhrs_epi16(_mm_slli_epi16(r, 7), _mm_set1_epi16(COEF_RY)),
+      _mm_mulhrs_epi16(_mm_slli_epi16(g, 7), _mm_set1_epi16(COEF_GY)));
+  y = _mm_add_epi16(y,
+      _mm_mulhrs_epi16(_mm_slli_epi16(b, 7), _mm_set1_epi16(COEF_BY)));
+  y = _mm_srai_epi16(_mm_add_epi16(y, _mm_set1_epi16(32)), 6);
+  return _mm_add_epi16(y, _mm_set1_epi16(16));
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_rgbToY(uint8_t* y,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i rs = _mm_loadu_si128((const __m128i*)(r + i));
+    __m128i gs = _mm_loadu_si128((const __m128i*)(g + i));
+    __m128i bs = _mm_loadu_si128((const __m128i*)(b + i));
+    __m128i y0 = sse4_rgbToY8(_mm_cvtepu8_epi16(rs), _mm_cvtepu8_epi16(gs),
+        _mm_cvtepu8_epi16(bs));
+    __m128i y1 = sse4_rgbToY8(_mm_cvtepu8_epi16(_mm_srli_si128(rs, 8)),
+        _mm_cvtepu8_epi16(_mm_srli_si128(gs, 8)),
+        _mm_cvtepu8_epi16(_mm_srli_si128(bs, 8)));
+    _mm_storeu_si128((__m128i*)(y + i), _mm_packus_epi16(y0, y1));
+  }
+  scalar_rgbToY(y + i, r + i, g + i, b + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 inline void
+sse4_rgbToUV8(__m128i r, __m128i g, __m128i b, __m128i* u, __m128i* v)
+{
+  r = _mm_slli_epi16(r, 7);
+  g = _mm_slli_epi16(g, 7);
+  b = _mm_slli_epi16(b, 7);
+  const __m128i round = _mm_set1_epi16(32);
+  const __m128i half = _mm_set1_epi16(128);
+  __m128i x = _mm_sub_epi16(_mm_sub_epi16(
+      _mm_mulhrs_epi16(b, _mm_set1_epi16(COEF_UB)),
+      _mm_mulhrs_epi16(r, _mm_set1_epi16(COEF_UR))),
+      _mm_mulhrs_epi16(g, _mm_set1_epi16(COEF_UG)));
+  *u = _mm_add_epi16(_mm_srai_epi16(_mm_add_epi16(x, round), 6), half);
+  x = _mm_sub_epi16(_mm_sub_epi16(
+      _mm_mulhrs_epi16(r, _mm_set1_epi16(COEF_UB)),
+      _mm_mulhrs_epi16(g, _mm_set1_epi16(COEF_VG))),
+      _mm_mulhrs_epi16(b, _mm_set1_epi16(COEF_VB)));
+  *v = _mm_add_epi16(_mm_srai_epi16(_mm_add_epi16(x, round), 6), half);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_rgbToUV(uint8_t* u, uint8_t* v,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i rs = _mm_loadu_si128((const __m128i*)(r + i));
+    __m128i gs = _mm_loadu_si128((const __m128i*)(g + i));
+    __m128i bs = _mm_loadu_si128((const __m128i*)(b + i));
+    __m128i u0, v0, u1, v1;
+    sse4_rgbToUV8(_mm_cvtepu8_epi16(rs), _mm_cvtepu8_epi16(gs),
+        _mm_cvtepu8_epi16(bs), &u0, &v0);
+    sse4_rgbToUV8(_mm_cvtepu8_epi16(_mm_srli_si128(rs, 8)),
+        _mm_cvtepu8_epi16(_mm_srli_si128(gs, 8)),
+        _mm_cvtepu8_epi16(_mm_srli_si128(bs, 8)), &u1, &v1);
+    _mm_storeu_si128((__m128i*)(u + i), _mm_packus_epi16(u0, u1));
+    _mm_storeu_si128((__m128i*)(v + i), _mm_packus_epi16(v0, v1));
+  }
+  scalar_rgbToUV(u + i, v + i, r + i, g + i, b + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 inline __m128i
+sse4_yToGray8(__m128i y)
+{
+  y = _mm_mulhrs_epi16(_mm_slli_epi16(_mm_sub_epi16(y, _mm_set1_epi16(16)), 7),
+      _mm_set1_epi16(COEF_Y));
+  return _mm_srai_epi16(_mm_add_epi16(y, _mm_set1_epi16(32)), 6);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_yToGray(uint8_t* gray, const uint8_t* y, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i ys = _mm_loadu_si128((const __m128i*)(y + i));
+    _mm_storeu_si128((__m128i*)(gray + i), _mm_packus_epi16(
+        sse4_yToGray8(_mm_cvtepu8_epi16(ys)),
+        sse4_yToGray8(_mm_cvtepu8_epi16(_mm_srli_si128(ys, 8)))));
+  }
+  scalar_yToGray(gray + i, y + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 inline __m128i
+sse4_grayToY8(__m128i gray)
+{
+  __m128i y = _mm_mulhrs_epi16(_mm_slli_epi16(gray, 7),
+      _mm_set1_epi16(COEF_GRAY));
+  y = _mm_srai_epi16(_mm_add_epi16(y, _mm_set1_epi16(32)), 6);
+  return _mm_add_epi16(y, _mm_set1_epi16(16));
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_grayToY(uint8_t* y, const uint8_t* gray, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i gs = _mm_loadu_si128((const __m128i*)(gray + i));
+    _mm_storeu_si128((__m128i*)(y + i), _mm_packus_epi16(
+        sse4_grayToY8(_mm_cvtepu8_epi16(gs)),
+        sse4_grayToY8(_mm_cvtepu8_epi16(_mm_srli_si128(gs, 8)))));
+  }
+  scalar_grayToY(y + i, gray + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_average(uint8_t* dst, const uint8_t* row0, const uint8_t* row1,
+    int32_t n)
+{
+  const __m128i ones = _mm_set1_epi8(1);
+  const __m128i two = _mm_set1_epi16(2);
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i s0 = _mm_add_epi16(
+        _mm_maddubs_epi16(_mm_loadu_si128((const __m128i*)(row0 + 2*i)), ones),
+        _mm_maddubs_epi16(_mm_loadu_si128((const __m128i*)(row1 + 2*i)), ones));
+    __m128i s1 = _mm_add_epi16(
+        _mm_maddubs_epi16(_mm_loadu_si128((const __m128i*)(row0 + 2*i + 16)), ones),
+        _mm_maddubs_epi16(_mm_loadu_si128((const __m128i*)(row1 + 2*i + 16)), ones));
+    s0 = _mm_srli_epi16(_mm_add_epi16(s0, two), 2);
+    s1 = _mm_srli_epi16(_mm_add_epi16(s1, two), 2);
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(s0, s1));
+  }
+  scalar_average(dst + i, row0 + 2*i, row1 + 2*i, n - i);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_duplicate(uint8_t* dst, const uint8_t* src, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+    _mm_storeu_si128((__m128i*)(dst + 2*i), _mm_unpacklo_epi8(x, x));
+    _mm_storeu_si128((__m128i*)(dst + 2*i + 16), _mm_unpackhi_epi8(x, x));
+  }
+  scalar_duplicate(dst + 2*i, src + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_splitUV(uint8_t* u, uint8_t* v, const uint8_t* uv, int32_t n)
+{
+  const __m128i mask = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14,
+      1, 3, 5, 7, 9, 11, 13, 15);
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i a = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(uv + 2*i)), mask);
+    __m128i b = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(uv + 2*i + 16)), mask);
+    _mm_storeu_si128((__m128i*)(u + i), _mm_unpacklo_epi64(a, b));
+    _mm_storeu_si128((__m128i*)(v + i), _mm_unpackhi_epi64(a, b));
+  }
+  scalar_splitUV(u + i, v + i, uv + 2*i, n - i);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_mergeUV(uint8_t* uv, const uint8_t* u, const uint8_t* v, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i us = _mm_loadu_si128((const __m128i*)(u + i));
+    __m128i vs = _mm_loadu_si128((const __m128i*)(v + i));
+    _mm_storeu_si128((__m128i*)(uv + 2*i), _mm_unpacklo_epi8(us, vs));
+    _mm_storeu_si128((__m128i*)(uv + 2*i + 16), _mm_unpackhi_epi8(us, vs));
+  }
+  scalar_mergeUV(uv + 2*i, u + i, v + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_packBgr24(uint8_t* dst,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  __m128i masks[3][3];
+  for(int32_t k = 0; k < 3; k++)
+    for(int32_t c = 0; c < 3; c++)
+      masks[k][c] = _mm_loadu_si128((const __m128i*)sPackMasks[k][c]);
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i planes[3] = {
+      _mm_loadu_si128((const __m128i*)(b + i)),
+      _mm_loadu_si128((const __m128i*)(g + i)),
+      _mm_loadu_si128((const __m128i*)(r + i)),
+    };
+    for(int32_t k = 0; k < 3; k++)
+      _mm_storeu_si128((__m128i*)(dst + 3*i + 16*k), _mm_or_si128(_mm_or_si128(
+          _mm_shuffle_epi8(planes[0], masks[k][0]),
+          _mm_shuffle_epi8(planes[1], masks[k][1])),
+          _mm_shuffle_epi8(planes[2], masks[k][2])));
+  }
+  scalar_packBgr24(dst + 3*i, r + i, g + i, b + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_unpackBgr24(uint8_t* r, uint8_t* g, uint8_t* b,
+    const uint8_t* src, int32_t n)
+{
+  __m128i masks[3][3];
+  for(int32_t c = 0; c < 3; c++)
+    for(int32_t k = 0; k < 3; k++)
+      masks[c][k] = _mm_loadu_si128((const __m128i*)sUnpackMasks[c][k]);
+  uint8_t* planes[3] = { b, g, r };
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i in[3] = {
+      _mm_loadu_si128((const __m128i*)(src + 3*i)),
+      _mm_loadu_si128((const __m128i*)(src + 3*i + 16)),
+      _mm_loadu_si128((const __m128i*)(src + 3*i + 32)),
+    };
+    for(int32_t c = 0; c < 3; c++)
+      _mm_storeu_si128((__m128i*)(planes[c] + i), _mm_or_si128(_mm_or_si128(
+          _mm_shuffle_epi8(in[0], masks[c][0]),
+          _mm_shuffle_epi8(in[1], masks[c][1])),
+          _mm_shuffle_epi8(in[2], masks[c][2])));
+  }
+  scalar_unpackBgr24(r + i, g + i, b + i, src + 3*i, n - i);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_packRgba(uint8_t* dst,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  const __m128i alpha = _mm_set1_epi8((char)0xff);
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i rs = _mm_loadu_si128((const __m128i*)(r + i));
+    __m128i gs = _mm_loadu_si128((const __m128i*)(g + i));
+    __m128i bs = _mm_loadu_si128((const __m128i*)(b + i));
+    __m128i rg0 = _mm_unpacklo_epi8(rs, gs);
+    __m128i rg1 = _mm_unpackhi_epi8(rs, gs);
+    __m128i ba0 = _mm_unpacklo_epi8(bs, alpha);
+    __m128i ba1 = _mm_unpackhi_epi8(bs, alpha);
+    _mm_storeu_si128((__m128i*)(dst + 4*i), _mm_unpacklo_epi16(rg0, ba0));
+    _mm_storeu_si128((__m128i*)(dst + 4*i + 16), _mm_unpackhi_epi16(rg0, ba0));
+    _mm_storeu_si128((__m128i*)(dst + 4*i + 32), _mm_unpacklo_epi16(rg1, ba1));
+    _mm_storeu_si128((__m128i*)(dst + 4*i + 48), _mm_unpackhi_epi16(rg1, ba1));
+  }
+  scalar_packRgba(dst + 4*i, r + i, g + i, b + i, n - i);
+}
+
+PICTURECONVERSION_SSE4 void
+sse4_unpackRgba(uint8_t* r, uint8_t* g, uint8_t* b,
+    const uint8_t* src, int32_t n)
+{
+  // gather each pixel's channels into 32 bit groups, then transpose
+  const __m128i mask = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13,
+      2, 6, 10, 14, 3, 7, 11, 15);
+  int32_t i = 0;
+  for(; i + 16 <= n; i += 16) {
+    __m128i v0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + 4*i)), mask);
+    __m128i v1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + 4*i + 16)), mask);
+    __m128i v2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + 4*i + 32)), mask);
+    __m128i v3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + 4*i + 48)), mask);
+    __m128i rg0 = _mm_unpacklo_epi32(v0, v1);
+    __m128i ba0 = _mm_unpackhi_epi32(v0, v1);
+    __m128i rg1 = _mm_unpacklo_epi32(v2, v3);
+    __m128i ba1 = _mm_unpackhi_epi32(v2, v3);
+    _mm_storeu_si128((__m128i*)(r + i), _mm_unpacklo_epi64(rg0, rg1));
+    _mm_storeu_si128((__m128i*)(g + i), _mm_unpackhi_epi64(rg0, rg1));
+    _mm_storeu_si128((__m128i*)(b + i), _mm_unpacklo_epi64(ba0, ba1));
+  }
+  scalar_unpackRgba(r + i, g + i, b + i, src + 4*i, n - i);
+}
+
+const PictureConversion::Kernels sSse4 = {
+  sse4_yuvToRgb,
+  sse4_rgbToY,
+  sse4_rgbToUV,
+  sse4_yToGray,
+  sse4_grayToY,
+  sse4_average,
+  sse4_duplicate,
+  sse4_splitUV,
+  sse4_mergeUV,
+  sse4_packBgr24,
+  sse4_packRgba,
+  sse4_unpackBgr24,
+  sse4_unpackRgba,
+};
+
+/*
+ * The AVX2 kernels work on 16 pixels per register. packus works within
+ * each 128 bit half, so its result is put back in order afterwards.
+ */
+PICTURECONVERSION_AVX2 inline __m256i
+avx2_widen(const uint8_t* p)
+{
+  return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)p));
+}
+
+PICTURECONVERSION_AVX2 inline void
+avx2_store(uint8_t* p, __m256i lo, __m256i hi)
+{
+  _mm256_storeu_si256((__m256i*)p,
+      _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xd8));
+}
+
+PICTURECONVERSION_AVX2 inline void
+avx2_yuvToRgb16(__m256i y, __m256i u, __m256i v,
+    __m256i* r, __m256i* g, __m256i* b)
+{
+  y = _mm256_mulhrs_epi16(_mm256_slli_epi16(
+      _mm256_sub_epi16(y, _mm256_set1_epi16(16)), 7), _mm256_set1_epi16(COEF_Y));
+  y = _mm256_add_epi16(y, _mm256_set1_epi16(32));
+  u = _mm256_slli_epi16(_mm256_sub_epi16(u, _mm256_set1_epi16(128)), 7);
+  v = _mm256_slli_epi16(_mm256_sub_epi16(v, _mm256_set1_epi16(128)), 7);
+  *r = _mm256_srai_epi16(_mm256_adds_epi16(y,
+      _mm256_mulhrs_epi16(v, _mm256_set1_epi16(COEF_RV))), 6);
+  *g = _mm256_srai_epi16(_mm256_subs_epi16(_mm256_subs_epi16(y,
+      _mm256_mulhrs_epi16(u, _mm256_set1_epi16(COEF_GU))),
+      _mm256_mulhrs_epi16(v, _mm256_set1_epi16(COEF_GV))), 6);
+  *b = _mm256_srai_epi16(_mm256_adds_epi16(_mm256_adds_epi16(y, u),
+      _mm256_mulhrs_epi16(u, _mm256_set1_epi16(COEF_BU))), 6);
+}
+
+PICTURECONVERSION_AVX2 void
+avx2_yuvToRgb(uint8_t* r, uint8_t* g, uint8_t* b,
+    const uint8_t* y, const uint8_t* u, const uint8_t* v, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 32 <= n; i += 32) {
+    __m256i r0, g0, b0, r1, g1, b1;
+    avx2_yuvToRgb16(avx2_widen(y + i), avx2_widen(u + i), avx2_widen(v + i),
+        &r0, &g0, &b0);
+    avx2_yuvToRgb16(avx2_widen(y + i + 16), avx2_widen(u + i + 16),
+        avx2_widen(v + i + 16), &r1, &g1, &b1);
+    avx2_store(r + i, r0, r1);
+    avx2_store(g + i, g0, g1);
+    avx2_store(b + i, b0, b1);
+  }
+  sse4_yuvToRgb(r + i, g + i, b + i, y + i, u + i, v + i, n - i);
+}
+
+PICTURECONVERSION_AVX2 inline __m256i
+avx2_rgbToY16(__m256i r, __m256i g, __m256i b)
+{
+  __m256i y = _mm256_add_epi16(
+      _mm256_mulhrs_epi16(_mm256_slli_epi16(r, 7), _mm256_set1_epi16(COEF_RY)),
+      _mm256_mulhrs_epi16(_mm256_slli_epi16(g, 7), _mm256_set1_epi16(COEF_GY)));
+  y = _mm256_add_epi16(y,
+      _mm256_mulhrs_epi16(_mm256_slli_epi16(b, 7), _mm256_set1_epi16(COEF_BY)));
+  y = _mm256_srai_epi16(_mm256_add_epi16(y, _mm256_set1_epi16(32)), 6);
+  return _mm256_add_epi16(y, _mm256_set1_epi16(16));
+}
+
+PICTURECONVERSION_AVX2 void
+avx2_rgbToY(uint8_t* y,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 32 <= n; i += 32)
+    avx2_store(y + i,
+        avx2_rgbToY16(avx2_widen(r + i), avx2_widen(g + i), avx2_widen(b + i)),
+        avx2_rgbToY16(avx2_widen(r + i + 16), avx2_widen(g + i + 16),
+            avx2_widen(b + i + 16)));
+  sse4_rgbToY(y + i, r + i, g + i, b + i, n - i);
+}
+
+PICTURECONVERSION_AVX2 inline void
+avx2_rgbToUV16(__m256i r, __m256i g, __m256i b, __m256i* u, __m256i* v)
+{
+  r = _mm256_slli_epi16(r, 7);
+  g = _mm256_slli_epi16(g, 7);
+  b = _mm256_slli_epi16(b, 7);
+  const __m256i round = _mm256_set1_epi16(32);
+  const __m256i half = _mm256_set1_epi16(128);
+  __m256i x = _mm256_sub_epi16(_mm256_sub_epi16(
+      _mm256_mulhrs_epi16(b, _mm256_set1_epi16(COEF_UB)),
+      _mm256_mulhrs_epi16(r, _mm256_set1_epi16(COEF_UR))),
+      _mm256_mulhrs_epi16(g, _mm256_set1_epi16(COEF_UG)));
+  *u = _mm256_add_epi16(_mm256_srai_epi16(_mm256_add_epi16(x, round), 6), half);
+  x = _mm256_sub_epi16(_mm256_sub_epi16(
+      _mm256_mulhrs_epi16(r, _mm256_set1_epi16(COEF_UB)),
+      _mm256_mulhrs_epi16(g, _mm256_set1_epi16(COEF_VG))),
+      _mm256_mulhrs_epi16(b, _mm256_set1_epi16(COEF_VB)));
+  *v = _mm256_add_epi16(_mm256_srai_epi16(_mm256_add_epi16(x, round), 6), half);
+}
+
+PICTURECONVERSION_AVX2 void
+avx2_rgbToUV(uint8_t* u, uint8_t* v,
+    const uint8_t* r, const uint8_t* g, const uint8_t* b, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 32 <= n; i += 32) {
+    __m256i u0, v0, u1, v1;
+    avx2_rgbToUV16(avx2_widen(r + i), avx2_widen(g + i), avx2_widen(b + i),
+        &u0, &v0);
+    avx2_rgbToUV16(avx2_widen(r + i + 16), avx2_widen(g + i + 16),
+        avx2_widen(b + i + 16), &u1, &v1);
+    avx2_store(u + i, u0, u1);
+    avx2_store(v + i, v0, v1);
+  }
+  sse4_rgbToUV(u + i, v + i, r + i, g + i, b + i, n - i);
+}
+
+PICTURECONVERSION_AVX2 inline __m256i
+avx2_yToGray16(__m256i y)
+{
+  y = _mm256_mulhrs_epi16(_mm256_slli_epi16(
+      _mm256_sub_epi16(y, _mm256_set1_epi16(16)), 7), _mm256_set1_epi16(COEF_Y));
+  return _mm256_srai_epi16(_mm256_add_epi16(y, _mm256_set1_epi16(32)), 6);
+}
+
+PICTURECONVERSION_AVX2 void
+avx2_yToGray(uint8_t* gray, const uint8_t* y, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 32 <= n; i += 32)
+    avx2_store(gray + i, avx2_yToGray16(avx2_widen(y + i)),
+        avx2_yToGray16(avx2_widen(y + i + 16)));
+  sse4_yToGray(gray + i, y + i, n - i);
+}
+
+PICTURECONVERSION_AVX2 inline __m256i
+avx2_grayToY16(__m256i gray)
+{
+  __m256i y = _mm256_mulhrs_epi16(_mm256_slli_epi16(gray, 7),
+      _mm256_set1_epi16(COEF_GRAY));
+  y = _mm256_srai_epi16(_mm256_add_epi16(y, _mm256_set1_epi16(32)), 6);
+  return _mm256_add_epi16(y, _mm256_set1_epi16(16));
+}
+
+PICTURECONVERSION_AVX2 void
+avx2_grayToY(uint8_t* y, const uint8_t* gray, int32_t n)
+{
+  int32_t i = 0;
+  for(; i + 32 <= n; i += 32)
+    avx2_store(y + i, avx2_grayToY16(avx2_widen(gray + i)),
+        avx2_grayToY16(avx2_widen(gray + i + 16)));
+  sse4_grayToY(y + i, gray + i, n - i);
+}
+
+PICTURECONVERSION_AVX2 void
+avx2_average(uint8_t* dst, const uint8_t* row0, const uint8_t* row1,
+    int32_t n)
+{
+  const __m256i ones = _mm256_set1_epi8(1);
+  const __m256i two = _mm256_set1_epi16(2);
+  int32_t i = 0;
+  for(; i + 32 <= n; i += 32) {
+    __m256i s0 = _mm256_add_epi16(
+        _mm256_maddubs_epi16(_mm256_loadu_si256((const __m256i*)(row0 + 2*i)), ones),
+        _mm256_maddubs_epi16(_mm256_loadu_si256((const __m256i*)(row1 + 2*i)), ones));
+    __m256i s1 = _mm256_add_epi16(
+        _mm256_maddubs_epi16(_mm256_loadu_si256((const __m256i*)(row0 + 2*i + 32)), ones),
+        _mm256_maddubs_epi16(_mm256_loadu_si256((const __m256i*)(row1 + 2*i + 32)), ones));
+    avx2_store(dst + i, _mm256_srli_epi16(_mm256_add_epi16(s0, two), 2),
+        _mm256_srli_epi16(_mm256_add_epi16(s1, two), 2));
+  }
+  sse4_average(dst + i, row0 + 2*i, row1 + 2*i, n - i);
+}
+
+// Moving bytes around gains little from wider registers, so those
+// kernels are shared with SSE4.
+const PictureConversion::Kernels sAvx2 = {
+  avx2_yuvToRgb,
+  avx2_rgbToY,
+  avx2_rgbToUV,
+  avx2_yToGray,
+  avx2_grayToY,
+  avx2_average,
+  sse4_duplicate,
+  sse4_splitUV,
+  sse4_mergeUV,
+  sse4_packBgr24,
+  sse4_packRgba,
+  sse4_unpackBgr24,
+  sse4_unpackRgba,
+};
+
+#endif // PICTURECONVERSION_X86
+
+}
+
+PictureConversion::Level
+PictureConversion::getBestLevel() {
+#ifdef PICTURECONVERSION_X86
+  // asked of the CPU itself, as FFmpeg only detects features when it is
+  // built with its own assembly
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return LEVEL_AVX2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return LEVEL_SSE4;
+#endif
+  return LEVEL_SCALAR;
+}
+
+PictureConversion::PictureConversion() {
+  mLevel = LEVEL_SCALAR;
+  mKernels = &sScalar;
+  mOWidth = mOHeight = mIWidth = mIHeight = 0;
+  mOFmt = mIFmt = AV_PIX_FMT_NONE;
+  mScale = 1;
+  mRows = 0;
+  mRowSize = 0;
+}
+
+PictureConversion::~PictureConversion() {
+  av_free(mRows);
+}
+
+PictureConversion*
+PictureConversion::make(
+    int32_t outputWidth, int32_t outputHeight,
+    enum AVPixelFormat outputFmt,
+    int32_t inputWidth, int32_t inputHeight,
+    enum AVPixelFormat inputFmt,
+    Level level) {
+  bool yuvIn = inputFmt == AV_PIX_FMT_YUV420P || inputFmt == AV_PIX_FMT_NV12;
+  bool yuvOut = outputFmt == AV_PIX_FMT_YUV420P || outputFmt == AV_PIX_FMT_NV12;
+  bool rgbIn = inputFmt == AV_PIX_FMT_BGR24 || inputFmt == AV_PIX_FMT_RGBA ||
+      inputFmt == AV_PIX_FMT_GRAY8;
+  bool rgbOut = outputFmt == AV_PIX_FMT_BGR24 || outputFmt == AV_PIX_FMT_RGBA ||
+      outputFmt == AV_PIX_FMT_GRAY8;
+  if (!(yuvIn && rgbOut) && !(rgbIn && yuvOut))
+    return 0;
+  if (outputWidth <= 0 || outputHeight <= 0 ||
+      outputWidth % 2 || outputHeight % 2)
+    return 0;
+  int32_t scale;
+  if (inputWidth == outputWidth && inputHeight == outputHeight)
+    scale = 1;
+  else if (inputWidth == 2 * outputWidth && inputHeight == 2 * outputHeight)
+    scale = 2;
+  else
+    return 0;
+
+  PictureConversion* retval = new PictureConversion();
+  retval->mLevel = FFMIN(level, getBestLevel());
+#ifdef PICTURECONVERSION_X86
+  if (retval->mLevel == LEVEL_AVX2)
+    retval->mKernels = &sAvx2;
+  else if (retval->mLevel == LEVEL_SSE4)
+    retval->mKernels = &sSse4;
+#endif
+  retval->mOWidth = outputWidth;
+  retval->mOHeight = outputHeight;
+  retval->mOFmt = outputFmt;
+  retval->mIWidth = inputWidth;
+  retval->mIHeight = inputHeight;
+  retval->mIFmt = inputFmt;
+  retval->mScale = scale;
+  retval->mRowSize = FFALIGN(inputWidth, 64);
+  retval->mRows = (uint8_t*)av_malloc(retval->mRowSize * sNumRows);
+  if (!retval->mRows) {
+    delete retval;
+    return 0;
+  }
+  return retval;
+}
+
+void
+PictureConversion::convert(AVFrame* out, const AVFrame* in) {
+  if (mIFmt == AV_PIX_FMT_YUV420P || mIFmt == AV_PIX_FMT_NV12)
+    toPacked(out, in);
+  else
+    toPlanar(out, in);
+}
+
+void
+PictureConversion::toPacked(AVFrame* out, const AVFrame* in) {
+  const Kernels* k = mKernels;
+  const int32_t chromaWidth = mIWidth / 2;
+  uint8_t* luma = row(0);
+  uint8_t* u = row(1);
+  uint8_t* v = row(2);
+  uint8_t* wideU = row(3);
+  uint8_t* wideV = row(4);
+  uint8_t* r = row(5);
+  uint8_t* g = row(6);
+  uint8_t* b = row(7);
+  const uint8_t* y = 0;
+  const uint8_t* cu = 0;
+  const uint8_t* cv = 0;
+  int32_t lastChroma = -1;
+  for(int32_t i = 0; i < mOHeight; i++) {
+    if (mScale == 1)
+      y = in->data[0] + i * in->linesize[0];
+    else {
+      k->average(luma, in->data[0] + 2 * i * in->linesize[0],
+          in->data[0] + (2 * i + 1) * in->linesize[0], mOWidth);
+      y = luma;
+    }
+    uint8_t* dst = out->data[0] + i * out->linesize[0];
+    if (mOFmt == AV_PIX_FMT_GRAY8) {
+      k->yToGray(dst, y, mOWidth);
+      continue;
+    }
+
+    // when halving, each output pixel has a chroma sample of its own
+    int32_t chroma = mScale == 1 ? i / 2 : i;
+    if (chroma != lastChroma) {
+      lastChroma = chroma;
+      if (mIFmt == AV_PIX_FMT_NV12) {
+        k->splitUV(u, v, in->data[1] + chroma * in->linesize[1], chromaWidth);
+        cu = u;
+        cv = v;
+      } else {
+        cu = in->data[1] + chroma * in->linesize[1];
+        cv = in->data[2] + chroma * in->linesize[2];
+      }
+      if (mScale == 1) {
+        k->duplicate(wideU, cu, chromaWidth);
+        k->duplicate(wideV, cv, chromaWidth);
+        cu = wideU;
+        cv = wideV;
+      }
+    }
+    k->yuvToRgb(r, g, b, y, cu, cv, mOWidth);
+    if (mOFmt == AV_PIX_FMT_BGR24)
+      k->packBgr24(dst, r, g, b, mOWidth);
+    else
+      k->packRgba(dst, r, g, b, mOWidth);
+  }
+}
+
+void
+PictureConversion::unpack(uint8_t* r, uint8_t* g, uint8_t* b,
+    const uint8_t* src) {
+  if (mIFmt == AV_PIX_FMT_BGR24)
+    mKernels->unpackBgr24(r, g, b, src, mIWidth);
+  else
+    mKernels->unpackRgba(r, g, b, src, mIWidth);
+}
+
+void
+PictureConversion::toPlanar(AVFrame* out, const AVFrame* in) {
+  const Kernels* k = mKernels;
+  const int32_t chromaWidth = mOWidth / 2;
+  const bool gray = mIFmt == AV_PIX_FMT_GRAY8;
+  // per output row of a pair: red, green (or gray) and blue at the
+  // output width, and when halving the two input rows behind it
+  uint8_t* rgb[2][3] = {
+    { row(8), row(9), row(10) },
+    { row(11), row(12), row(13) },
+  };
+  uint8_t* mean[3] = { row(14), row(15), row(16) };
+  uint8_t* wide[2][3] = {
+    { row(17), row(18), row(19) },
+    { row(20), row(21), row(22) },
+  };
+  uint8_t* u = row(23);
+  uint8_t* v = row(24);
+  for(int32_t i = 0; i < mOHeight; i += 2) {
+    for(int32_t j = 0; j < 2; j++) {
+      int32_t y = i + j;
+      uint8_t* dst = out->data[0] + y * out->linesize[0];
+      if (gray) {
+        const uint8_t* src = in->data[0] + y * in->linesize[0];
+        if (mScale == 2) {
+          k->average(rgb[j][1], in->data[0] + 2 * y * in->linesize[0],
+              in->data[0] + (2 * y + 1) * in->linesize[0], mOWidth);
+          src = rgb[j][1];
+        }
+        k->grayToY(dst, src, mOWidth);
+        continue;
+      }
+      if (mScale == 1)
+        unpack(rgb[j][0], rgb[j][1], rgb[j][2],
+            in->data[0] + y * in->linesize[0]);
+      else {
+        unpack(wide[0][0], wide[0][1], wide[0][2],
+            in->data[0] + 2 * y * in->linesize[0]);
+        unpack(wide[1][0], wide[1][1], wide[1][2],
+            in->data[0] + (2 * y + 1) * in->linesize[0]);
+        for(int32_t c = 0; c < 3; c++)
+          k->average(rgb[j][c], wide[0][c], wide[1][c], mOWidth);
+      }
+      k->rgbToY(dst, rgb[j][0], rgb[j][1], rgb[j][2], mOWidth);
+    }
+
+    int32_t chroma = i / 2;
+    if (gray) {
+      if (mOFmt == AV_PIX_FMT_NV12)
+        memset(out->data[1] + chroma * out->linesize[1], 128, 2 * chromaWidth);
+      else {
+        memset(out->data[1] + chroma * out->linesize[1], 128, chromaWidth);
+        memset(out->data[2] + chroma * out->linesize[2], 128, chromaWidth);
+      }
+      continue;
+    }
+    for(int32_t c = 0; c < 3; c++)
+      k->average(mean[c], rgb[0][c], rgb[1][c], chromaWidth);
+    if (mOFmt == AV_PIX_FMT_NV12) {
+      k->rgbToUV(u, v, mean[0], mean[1], mean[2], chromaWidth);
+      k->mergeUV(out->data[1] + chroma * out->linesize[1], u, v, chromaWidth);
+    } else
+      k->rgbToUV(out->data[1] + chroma * out->linesize[1],
+          out->data[2] + chroma * out->linesize[2],
+          mean[0], mean[1], mean[2], chromaWidth);
+  }
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef PICTURECONVERSION_H_
+#define PICTURECONVERSION_H_
+
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/FfmpegIncludes.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. Converts pictures between YUV420P or NV12 and BGR24,
+ * RGBA or GRAY8, in either direction, at the same size or at half the
+ * width and height, with row kernels written for SSE4 and AVX2 as well as
+ * in plain C++. The best the CPU supports is picked at run time, and all
+ * of them produce the same bytes.
+ * <p>
+ * YUV is taken to be BT.601 with MPEG (16-235) range, and GRAY8 full
+ * range, as swscale does by default. Chroma is repeated, not
+ * interpolated, when sizing it up, and halving averages 2x2 blocks.
+ * Results are within a few levels of what swscale produces, but not
+ * identical to it.
+ * </p>
+ */
+class PictureConversion
+{
+public:
+  typedef enum Level {
+    LEVEL_SCALAR,
+    LEVEL_SSE4,
+    LEVEL_AVX2,
+  } Level;
+
+  /** @return the fastest kernels this CPU can run. */
+  static Level getBestLevel();
+
+  /**
+   * Gets a conversion, or 0 if these parameters are not among the ones
+   * supported. All widths and heights must be even, and the input either
+   * the same size as the output or twice its width and height.
+   *
+   * @param level The kernels to use; if the CPU cannot run them, the best
+   *   it can are used instead.
+   */
+  static PictureConversion* make(
+      int32_t outputWidth, int32_t outputHeight,
+      enum AVPixelFormat outputFmt,
+      int32_t inputWidth, int32_t inputHeight,
+      enum AVPixelFormat inputFmt,
+      Level level);
+
+  ~PictureConversion();
+
+  /** @return the kernels in use. */
+  Level getLevel() { return mLevel; }
+
+  /**
+   * Converts in to out, which must have the sizes and formats this
+   * conversion was made for.
+   */
+  void convert(AVFrame* out, const AVFrame* in);
+
+  struct Kernels;
+
+private:
+  PictureConversion();
+  PictureConversion(const PictureConversion&);
+  PictureConversion& operator=(const PictureConversion&);
+
+  void toPacked(AVFrame* out, const AVFrame* in);
+  void toPlanar(AVFrame* out, const AVFrame* in);
+  void unpack(uint8_t* r, uint8_t* g, uint8_t* b, const uint8_t* src);
+  uint8_t* row(int32_t i) { return mRows + i * mRowSize; }
+
+  Level mLevel;
+  const Kernels* mKernels;
+  int32_t mOWidth;
+  int32_t mOHeight;
+  enum AVPixelFormat mOFmt;
+  int32_t mIWidth;
+  int32_t mIHeight;
+  enum AVPixelFormat mIFmt;
+  // 1 at the same size, 2 when halving
+  int32_t mScale;
+  // scratch rows, each mRowSize bytes
+  uint8_t* mRows;
+  int32_t mRowSize;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* PICTURECONVERSION_H_ */
@@ -0,0 +1,554 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/Global.h>
+#include <io/humble/video/VideoExceptions.h>
+#include <io/humble/video/FfmpegIncludes.h>
+#include <io/humble/video/Demuxer.h>
+#include <io/humble/video/DemuxerStream.h>
+#include <io/humble/video/Decoder.h>
+#include <io/humble/video/Encoder.h>
+#include <io/humble/video/IndexEntry.h>
+#include <io/humble/video/MediaPictureResampler.h>
+#include <io/humble/video/WorkerPool.h>
+#include "SpriteSheetGenerator.h"
+
+#include <climits>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.SpriteSheetGenerator);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+/*
+ * Reads the video through its own Demuxer and draws a run of tiles of a
+ * sheet. Kept between sheets, so it carries on from the last frame it
+ * decoded.
+ */
+class SpriteSheetGenerator::Worker : public WorkerPool::Job
+{
+public:
+  Worker(SpriteSheetGenerator* generator);
+  virtual ~Worker();
+  virtual void run();
+
+  /** Opens the video if not yet open; not thread safe, see generate(). */
+  void open();
+  /** @return the duration of the video, or Global::NO_PTS if unknown. */
+  int64_t getDuration();
+
+  // tiles [mFirst, mEnd) of mSheet, whose first tile is at mSheetTime;
+  // set before run()
+  MediaPicture* mSheet;
+  int64_t mSheetTime;
+  int64_t mInterval;
+  int32_t mFirst;
+  int32_t mEnd;
+  // what went wrong in run(), if anything
+  std::string mError;
+  int64_t mDecoded;
+  int64_t mSeeks;
+
+private:
+  void drawTile(int32_t tile, int64_t time);
+  /** Decodes the next frame into mFrame; false at the end of the video. */
+  bool decodeNext();
+  void seek(int64_t ts);
+  void scale(MediaPicture* tile, MediaPicture* frame);
+  void clear(MediaPicture* tile);
+
+  SpriteSheetGenerator* mGenerator;
+  RefPointer<Demuxer> mDemuxer;
+  RefPointer<DemuxerStream> mStream;
+  RefPointer<Decoder> mDecoder;
+  int32_t mStreamIndex;
+  RefPointer<Rational> mTimeBase;
+  int64_t mStreamStart;
+  RefPointer<MediaPacket> mPacket;
+  int32_t mOffset;
+  bool mPacketPending;
+  bool mDraining;
+  bool mEnded;
+  // the last frame decoded, its time stamp in mTimeBase units, and the
+  // time stamp of the key frame decoding last started from
+  RefPointer<MediaPicture> mFrame;
+  bool mHaveFrame;
+  int64_t mPts;
+  int64_t mKeyPts;
+  RefPointer<MediaPictureResampler> mResampler;
+  RefPointer<MediaPicture> mBlack;
+  RefPointer<MediaPictureResampler> mBlackResampler;
+};
+
+SpriteSheetGenerator::Worker::Worker(SpriteSheetGenerator* generator) :
+    mSheet(0), mSheetTime(0), mInterval(0), mFirst(0), mEnd(0),
+    mDecoded(0), mSeeks(0), mGenerator(generator), mStreamIndex(-1),
+    mStreamStart(0), mOffset(0), mPacketPending(false), mDraining(false),
+    mEnded(false), mHaveFrame(false), mPts(Global::NO_PTS),
+    mKeyPts(Global::NO_PTS) {
+}
+
+SpriteSheetGenerator::Worker::~Worker() {
+  if (mDemuxer && mDemuxer->getState() == Demuxer::STATE_OPENED) {
+    try {
+      mDemuxer->close();
+    } catch (std::exception & e) {
+      VS_LOG_DEBUG("could not close %s: %s", mGenerator->getURL(), e.what());
+    }
+  }
+}
+
+void
+SpriteSheetGenerator::Worker::open() {
+  if (mDecoder)
+    return;
+  RefPointer<Demuxer> demuxer = Demuxer::make();
+  demuxer->open(mGenerator->getURL(), 0, false, true, 0, 0);
+  int32_t numStreams = demuxer->getNumStreams();
+  RefPointer<DemuxerStream> stream;
+  RefPointer<Decoder> decoder;
+  for(int32_t i = 0; i < numStreams && !decoder; i++) {
+    stream = demuxer->getStream(i);
+    decoder = stream->getDecoder();
+    if (decoder && decoder->getCodecType() == MediaDescriptor::MEDIA_VIDEO)
+      mStreamIndex = i;
+    else
+      decoder = 0;
+  }
+  try {
+    if (!decoder)
+      VS_THROW(HumbleRuntimeError::make("no video stream in %s",
+          mGenerator->getURL()));
+    // nothing but the video is read off the disk
+    demuxer->selectStreams(&mStreamIndex, 1);
+    decoder->open(0, 0);
+  } catch (...) {
+    demuxer->close();
+    throw;
+  }
+
+  mTimeBase = stream->getTimeBase();
+  mStreamStart = stream->getStartTime();
+  if (mStreamStart == Global::NO_PTS)
+    mStreamStart = 0;
+  mFrame = MediaPicture::make(decoder->getWidth(), decoder->getHeight(),
+      decoder->getPixelFormat());
+  mPacket = MediaPacket::make();
+  mDemuxer = demuxer;
+  mStream = stream;
+  mDecoder = decoder;
+}
+
+int64_t
+SpriteSheetGenerator::Worker::getDuration() {
+  open();
+  int64_t duration = mDemuxer->getDuration();
+  if (duration == Global::NO_PTS || duration <= 0) {
+    int64_t streamDuration = mStream->getDuration();
+    if (streamDuration != Global::NO_PTS && streamDuration > 0)
+      duration = av_rescale_q(streamDuration,
+          (AVRational){ mTimeBase->getNumerator(), mTimeBase->getDenominator() },
+          AV_TIME_BASE_Q);
+    else
+      duration = Global::NO_PTS;
+  }
+  return duration;
+}
+
+void
+SpriteSheetGenerator::Worker::run() {
+  try {
+    open();
+    for(int32_t i = mFirst; i < mEnd; i++)
+      drawTile(i, mSheetTime + i * mInterval);
+  } catch (std::exception & e) {
+    mError = e.what();
+  }
+}
+
+void
+SpriteSheetGenerator::Worker::drawTile(int32_t tile, int64_t time) {
+  int32_t columns = mGenerator->getColumns();
+  int32_t width = mGenerator->getTileWidth();
+  int32_t height = mGenerator->getTileHeight();
+  RefPointer<MediaPicture> view = MediaPicture::makeView(mSheet,
+      (tile % columns) * width, (tile / columns) * height, width, height);
+
+  int64_t ts = mStreamStart + av_rescale_q(time, AV_TIME_BASE_Q,
+      (AVRational){ mTimeBase->getNumerator(), mTimeBase->getDenominator() });
+
+  // Decoding always starts from the key frame at or before the tile, and
+  // carries on from the last tile only if that started from the same key
+  // frame; so what a tile shows never depends on which tiles a worker drew
+  // before it.
+  RefPointer<IndexEntry> key = mStream->findTimeStampEntryInIndex(ts,
+      Demuxer::SEEK_BACKWARD);
+  int64_t keyPts = key ? key->getTimeStamp() : Global::NO_PTS;
+  bool sameKey = keyPts != Global::NO_PTS && keyPts == mKeyPts
+      && (mHaveFrame || mEnded);
+  if (!sameKey) {
+    seek(ts);
+    mKeyPts = keyPts;
+  }
+
+  if (mGenerator->isKeyFramesOnly()) {
+    if (!sameKey)
+      mHaveFrame = decodeNext();
+  } else if (!sameKey || (mPts != Global::NO_PTS && mPts < ts)) {
+    bool found = false;
+    while(!found && decodeNext())
+      found = mPts == Global::NO_PTS || mPts >= ts;
+    // or the video ended short of the tile
+    mHaveFrame = found;
+  }
+
+  if (mHaveFrame)
+    scale(view.value(), mFrame.value());
+  else
+    clear(view.value());
+}
+
+void
+SpriteSheetGenerator::Worker::seek(int64_t ts) {
+  ++mSeeks;
+  // the key frame at or before ts
+  int32_t retval = mDemuxer->seek(mStreamIndex, INT64_MIN, ts, ts, 0);
+  if (retval < 0)
+    // before the first key frame, say
+    retval = mDemuxer->seek(mStreamIndex, INT64_MIN, ts, INT64_MAX, 0);
+  FfmpegException::check(retval, "could not seek in %s ",
+      mGenerator->getURL());
+  mDecoder->flush();
+  mPacketPending = false;
+  mDraining = false;
+  mEnded = false;
+  mHaveFrame = false;
+}
+
+bool
+SpriteSheetGenerator::Worker::decodeNext() {
+  while(!mEnded) {
+    if (mPacketPending) {
+      int32_t bytesRead = mDecoder->decodeVideo(mFrame.value(), mPacket.value(),
+          mOffset);
+      // skip what can't be decoded, as a player would
+      mOffset = bytesRead > 0 ? mOffset + bytesRead : mPacket->getSize();
+      mPacketPending = mOffset < mPacket->getSize();
+    } else if (mDraining) {
+      mDecoder->decodeVideo(mFrame.value(), 0, 0);
+      mEnded = !mFrame->isComplete();
+    } else {
+      if (mDemuxer->read(mPacket.value()) < 0)
+        mDraining = true;
+      else if (mPacket->getStreamIndex() == mStreamIndex
+          && mPacket->isComplete()) {
+        mPacketPending = true;
+        mOffset = 0;
+      }
+      continue;
+    }
+    if (mFrame->isComplete()) {
+      ++mDecoded;
+      mHaveFrame = true;
+      // decodeVideo passes the packet time stamps through, so this is in
+      // the stream's time base whatever the picture's time base says
+      mPts = mFrame->getTimeStamp();
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+SpriteSheetGenerator::Worker::scale(MediaPicture* tile, MediaPicture* frame) {
+  if (!mResampler || mResampler->getInputWidth() != frame->getWidth()
+      || mResampler->getInputHeight() != frame->getHeight()
+      || mResampler->getInputFormat() != frame->getFormat()) {
+    // made here rather than in open() as streams may change size
+    mResampler = MediaPictureResampler::make(tile->getWidth(),
+        tile->getHeight(), tile->getFormat(), frame->getWidth(),
+        frame->getHeight(), frame->getFormat(), 0);
+    mResampler->open();
+  }
+  mResampler->resamplePicture(tile, frame);
+}
+
+void
+SpriteSheetGenerator::Worker::clear(MediaPicture* tile) {
+  if (!mBlack) {
+    // black in any format is black RGB scaled to it
+    mBlack = MediaPicture::make(tile->getWidth(), tile->getHeight(),
+        PixelFormat::PIX_FMT_RGB24);
+    RefPointer<Buffer> data = mBlack->getData(0);
+    memset(data->getBytes(0, data->getBufferSize()), 0,
+        data->getBufferSize());
+    mBlack->setComplete(true);
+    mBlackResampler = MediaPictureResampler::make(tile->getWidth(),
+        tile->getHeight(), tile->getFormat(), tile->getWidth(),
+        tile->getHeight(), PixelFormat::PIX_FMT_RGB24, 0);
+    mBlackResampler->open();
+  }
+  mBlackResampler->resamplePicture(tile, mBlack.value());
+}
+
+SpriteSheetGenerator::SpriteSheetGenerator() :
+    mColumns(0), mRows(0), mTileWidth(0), mTileHeight(0),
+    mFormat(PixelFormat::PIX_FMT_NONE), mInterval(0), mStartTime(0),
+    mKeyFramesOnly(false), mThreads(1), mDecoded(0), mSeeks(0) {
+}
+
+SpriteSheetGenerator::~SpriteSheetGenerator() {
+  freeWorkers();
+}
+
+void
+SpriteSheetGenerator::freeWorkers() {
+  for(size_t i = 0; i < mWorkers.size(); i++)
+    delete mWorkers[i];
+  mWorkers.clear();
+}
+
+SpriteSheetGenerator*
+SpriteSheetGenerator::make(const char* url, int32_t columns, int32_t rows,
+    int32_t tileWidth, int32_t tileHeight, PixelFormat::Type format) {
+  Global::init();
+  if (!url || !*url)
+    VS_THROW(HumbleInvalidArgument("no url"));
+  if (columns <= 0 || rows <= 0)
+    VS_THROW(HumbleInvalidArgument("columns and rows must be > 0"));
+  if (tileWidth <= 0 || tileHeight <= 0)
+    VS_THROW(HumbleInvalidArgument("tile width and height must be > 0"));
+  const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get((enum AVPixelFormat)format);
+  if (!desc || (desc->flags & (AV_PIX_FMT_FLAG_PAL | AV_PIX_FMT_FLAG_BITSTREAM
+      | AV_PIX_FMT_FLAG_HWACCEL)))
+    VS_THROW(HumbleInvalidArgument("sheets cannot be in this pixel format"));
+  if (tileWidth % (1 << desc->log2_chroma_w)
+      || tileHeight % (1 << desc->log2_chroma_h))
+    VS_THROW(HumbleInvalidArgument("tiles must be a whole number of chroma samples"));
+
+  RefPointer<SpriteSheetGenerator> retval = make();
+  retval->mURL = url;
+  retval->mColumns = columns;
+  retval->mRows = rows;
+  retval->mTileWidth = tileWidth;
+  retval->mTileHeight = tileHeight;
+  retval->mFormat = format;
+  return retval.get();
+}
+
+void
+SpriteSheetGenerator::setInterval(int64_t interval) {
+  if (interval < 0)
+    VS_THROW(HumbleInvalidArgument("interval must be >= 0"));
+  mInterval = interval;
+}
+
+void
+SpriteSheetGenerator::setStartTime(int64_t startTime) {
+  if (startTime < 0)
+    VS_THROW(HumbleInvalidArgument("start time must be >= 0"));
+  mStartTime = startTime;
+}
+
+void
+SpriteSheetGenerator::setThreads(int32_t threads) {
+  if (threads < 0)
+    VS_THROW(HumbleInvalidArgument("threads must be >= 0"));
+  mThreads = threads;
+}
+
+int64_t
+SpriteSheetGenerator::getDuration() {
+  if (mWorkers.empty())
+    mWorkers.push_back(new Worker(this));
+  return mWorkers[0]->getDuration();
+}
+
+int64_t
+SpriteSheetGenerator::getTileInterval() {
+  if (mInterval)
+    return mInterval;
+  int64_t duration = getDuration();
+  if (duration == Global::NO_PTS)
+    return 0;
+  return FFMAX(duration - mStartTime, 0) / (mColumns * mRows);
+}
+
+int32_t
+SpriteSheetGenerator::getNumSheets() {
+  Lock::Guard g(&mLock);
+  if (!mInterval)
+    return 1;
+  int64_t duration = getDuration();
+  if (duration == Global::NO_PTS)
+    return 1;
+  int64_t perSheet = mInterval * mColumns * mRows;
+  return (int32_t)FFMAX((duration - mStartTime + perSheet - 1) / perSheet, 1);
+}
+
+MediaPicture*
+SpriteSheetGenerator::generate(int32_t sheet) {
+  if (sheet < 0)
+    VS_THROW(HumbleInvalidArgument("sheet must be >= 0"));
+  Lock::Guard g(&mLock);
+
+  int32_t numTiles = mColumns * mRows;
+  int64_t interval = getTileInterval();
+  int32_t threads = mThreads ? mThreads : WorkerPool::getCPUs();
+  threads = FFMAX(FFMIN(threads, numTiles), 1);
+  while((int32_t)mWorkers.size() < threads)
+    mWorkers.push_back(new Worker(this));
+  // opening codecs is not safe to do on several threads at once, so only
+  // decoding and scaling happen on the pool
+  for(int32_t i = 0; i < threads; i++)
+    mWorkers[i]->open();
+
+  RefPointer<MediaPicture> retval = MediaPicture::make(mColumns * mTileWidth,
+      mRows * mTileHeight, mFormat);
+  int64_t sheetTime = mStartTime + sheet * numTiles * interval;
+  std::vector<WorkerPool::Job*> jobs;
+  for(int32_t i = 0; i < threads; i++) {
+    Worker* worker = mWorkers[i];
+    worker->mSheet = retval.value();
+    worker->mSheetTime = sheetTime;
+    worker->mInterval = interval;
+    worker->mFirst = numTiles * i / threads;
+    worker->mEnd = numTiles * (i + 1) / threads;
+    worker->mError.clear();
+    jobs.push_back(worker);
+  }
+  if (threads == 1)
+    mWorkers[0]->run();
+  else
+    WorkerPool::get()->run(&jobs[0], (int32_t)jobs.size());
+
+  for(int32_t i = 0; i < threads; i++) {
+    Worker* worker = mWorkers[i];
+    worker->mSheet = 0;
+    mDecoded += worker->mDecoded;
+    mSeeks += worker->mSeeks;
+    worker->mDecoded = worker->mSeeks = 0;
+    if (!worker->mError.empty())
+      VS_THROW(HumbleRuntimeError::make("could not make sheet %d of %s: %s",
+          sheet, mURL.c_str(), worker->mError.c_str()));
+  }
+
+  retval->setTimeStamp(sheetTime);
+  RefPointer<Rational> timeBase = Rational::make(1,
+      Global::DEFAULT_PTS_PER_SECOND);
+  retval->setTimeBase(timeBase.value());
+  retval->setComplete(true);
+  return retval.get();
+}
+
+MediaPacket*
+SpriteSheetGenerator::encode(MediaPicture* sheet, Codec::ID id) {
+  Global::init();
+  if (!sheet || !sheet->isComplete())
+    VS_THROW(HumbleInvalidArgument("sheet must be a complete picture"));
+  RefPointer<Codec> codec = Codec::findEncodingCodec(id);
+  if (!codec || codec->getType() != MediaDescriptor::MEDIA_VIDEO)
+    VS_THROW(HumbleInvalidArgument("no image encoder for this codec"));
+
+  // the sheet's format, or its full range twin for JPEG, if the encoder
+  // takes it; otherwise the encoder's first choice
+  PixelFormat::Type format = sheet->getFormat();
+  PixelFormat::Type fullRange = format;
+  if (format == PixelFormat::PIX_FMT_YUV420P)
+    fullRange = PixelFormat::PIX_FMT_YUVJ420P;
+  else if (format == PixelFormat::PIX_FMT_YUV422P)
+    fullRange = PixelFormat::PIX_FMT_YUVJ422P;
+  else if (format == PixelFormat::PIX_FMT_YUV444P)
+    fullRange = PixelFormat::PIX_FMT_YUVJ444P;
+  int32_t numFormats = codec->getNumSupportedVideoPixelFormats();
+  PixelFormat::Type encoded = numFormats > 0
+      ? codec->getSupportedVideoPixelFormat(0) : format;
+  bool haveFormat = false;
+  for(int32_t i = 0; i < numFormats; i++) {
+    PixelFormat::Type supported = codec->getSupportedVideoPixelFormat(i);
+    if (supported == fullRange) {
+      encoded = fullRange;
+      break;
+    }
+    if (supported == format && !haveFormat) {
+      encoded = format;
+      haveFormat = true;
+    }
+  }
+
+  RefPointer<MediaPicture> picture;
+  if (encoded == format)
+    picture.reset(sheet, true);
+  else {
+    picture = MediaPicture::make(sheet->getWidth(), sheet->getHeight(), encoded);
+    RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+        sheet->getWidth(), sheet->getHeight(), encoded, sheet->getWidth(),
+        sheet->getHeight(), format, 0);
+    resampler->open();
+    resampler->resamplePicture(picture.value(), sheet);
+  }
+  if (picture->getTimeStamp() == Global::NO_PTS)
+    picture->setTimeStamp(0);
+
+  RefPointer<Encoder> encoder = Encoder::make(codec.value());
+  encoder->setWidth(picture->getWidth());
+  encoder->setHeight(picture->getHeight());
+  encoder->setPixelFormat(encoded);
+  RefPointer<Rational> timeBase = picture->getTimeBase();
+  if (!timeBase)
+    timeBase = Rational::make(1, Global::DEFAULT_PTS_PER_SECOND);
+  encoder->setTimeBase(timeBase.value());
+  encoder->open(0, 0);
+
+  RefPointer<MediaPacket> packet = MediaPacket::make();
+  encoder->encodeVideo(packet.value(), picture.value());
+  if (!packet->isComplete())
+    encoder->encodeVideo(packet.value(), 0);
+  if (!packet->isComplete())
+    VS_THROW(HumbleRuntimeError("encoder did not produce an image"));
+  return packet.get();
+}
+
+int64_t
+SpriteSheetGenerator::getNumFramesDecoded() {
+  Lock::Guard g(&mLock);
+  return mDecoded;
+}
+
+int64_t
+SpriteSheetGenerator::getNumSeeks() {
+  Lock::Guard g(&mLock);
+  return mSeeks;
+}
+
+void
+SpriteSheetGenerator::resetStatistics() {
+  Lock::Guard g(&mLock);
+  mDecoded = mSeeks = 0;
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef SPRITESHEETGENERATOR_H_
+#define SPRITESHEETGENERATOR_H_
+
+#include <string>
+#include <vector>
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/RefCounted.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/Codec.h>
+#include <io/humble/video/MediaPacket.h>
+#include <io/humble/video/MediaPicture.h>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Makes sprite sheets: single pictures holding a grid of columns by rows
+ * tiles, each a frame of a video scaled down, taken at a fixed interval.
+ * A thumbnail strip is a sheet with one row.
+ * <p>
+ * Each tile is scaled from the decoded frame straight into its place in
+ * the sheet, and only the frames tiles need are decoded: the generator
+ * seeks to the key frame before each tile's time, unless it is already
+ * decoding forward from that key frame for an earlier tile, and decodes to
+ * the first frame at or after the tile's time. With
+ * #setKeyFramesOnly(boolean) it takes the key frame itself, decoding at
+ * most one frame per tile.
+ * </p><p>
+ * With #setThreads(int), each thread takes a run of neighbouring tiles and
+ * reads the file through its own Demuxer. Demuxers, decoders and scalers
+ * are kept between calls to #generate(int), so sheets made in order carry
+ * on from where the last one stopped. A tile looks the same whichever
+ * thread draws it and whatever was drawn before it.
+ * </p><p>
+ * Times are in Global#DEFAULT_PTS_PER_SECOND units from the start of the
+ * container.
+ * </p>
+ */
+class VS_API_HUMBLEVIDEO SpriteSheetGenerator : public io::humble::ferry::RefCounted
+{
+  VS_JNIUTILS_REFCOUNTED_OBJECT_PRIVATE_MAKE(SpriteSheetGenerator)
+public:
+  /**
+   * Makes a generator for the first video stream of url.
+   *
+   * @param url The file or URL to read; opened when first needed.
+   * @param columns The number of tiles across a sheet.
+   * @param rows The number of tiles down a sheet.
+   * @param tileWidth The width of each tile, in pixels.
+   * @param tileHeight The height of each tile, in pixels.
+   * @param format The PixelFormat.Type of the sheets.
+   *
+   * @return a new generator.
+   *
+   * @throws InvalidArgument if url is null or empty, columns, rows, tile
+   *   width or height are not positive, the tile width or height is not a
+   *   multiple of format's chroma subsampling, or format is paletted,
+   *   packs several pixels into a byte, or is a hardware format.
+   */
+  static SpriteSheetGenerator*
+  make(const char* url, int32_t columns, int32_t rows, int32_t tileWidth,
+      int32_t tileHeight, PixelFormat::Type format);
+
+  /** @return the URL frames are read from. */
+  const char* getURL() { return mURL.c_str(); }
+
+  /** @return the number of tiles across a sheet. */
+  int32_t getColumns() { return mColumns; }
+
+  /** @return the number of tiles down a sheet. */
+  int32_t getRows() { return mRows; }
+
+  /** @return the width of each tile. */
+  int32_t getTileWidth() { return mTileWidth; }
+
+  /** @return the height of each tile. */
+  int32_t getTileHeight() { return mTileHeight; }
+
+  /** @return the PixelFormat.Type of the sheets. */
+  PixelFormat::Type getFormat() { return mFormat; }
+
+  /**
+   * Sets the time between tiles.
+   *
+   * @param interval The time between tiles; 0 (the default) spreads the
+   *   tiles of one sheet evenly over the whole video.
+   *
+   * @throws InvalidArgument if interval is negative.
+   */
+  void setInterval(int64_t interval);
+
+  /** @return the time between tiles, or 0 to spread one sheet over the video. */
+  int64_t getInterval() { return mInterval; }
+
+  /**
+   * Sets the time of the first tile of the first sheet.
+   *
+   * @param startTime The time of the first tile; defaults to 0.
+   *
+   * @throws InvalidArgument if startTime is negative.
+   */
+  void setStartTime(int64_t startTime);
+
+  /** @return the time of the first tile of the first sheet. */
+  int64_t getStartTime() { return mStartTime; }
+
+  /**
+   * Sets whether tiles show the key frame at or before their time rather
+   * than the frame at their time. Much faster, as only key frames are
+   * decoded, but tiles may repeat when key frames are further apart than
+   * the interval.
+   *
+   * @param keyFramesOnly true to take key frames only; defaults to false.
+   */
+  void setKeyFramesOnly(bool keyFramesOnly) { mKeyFramesOnly = keyFramesOnly; }
+
+  /** @return true if tiles show key frames only. */
+  bool isKeyFramesOnly() { return mKeyFramesOnly; }
+
+  /**
+   * Sets the number of threads to make each sheet with.
+   *
+   * @param threads The number of threads; 0 for one per CPU. Defaults to
+   *   1, to make sheets on the calling thread only.
+   *
+   * @throws InvalidArgument if threads is negative.
+   */
+  void setThreads(int32_t threads);
+
+  /** @return the number of threads sheets are made with; 0 for one per CPU. */
+  int32_t getThreads() { return mThreads; }
+
+  /**
+   * Gets the number of sheets it takes to cover the video.
+   *
+   * @return the number of sheets; 1 if the interval is 0 or the duration
+   *   of the video is unknown.
+   *
+   * @throws RuntimeError if the video cannot be opened.
+   */
+  int32_t getNumSheets();
+
+  /**
+   * Makes a sheet. Tile i of sheet n, counting across and then down,
+   * shows the video at time getStartTime() + (n * columns * rows + i) *
+   * interval. Tiles past the end of the video are black.
+   *
+   * @param sheet Which sheet to make, from 0.
+   *
+   * @return a picture of columns * tile width by rows * tile height pixels,
+   *   with the time of its first tile as its time stamp.
+   *
+   * @throws InvalidArgument if sheet is negative.
+   * @throws RuntimeError if the video cannot be opened or decoded.
+   */
+  MediaPicture* generate(int32_t sheet);
+
+  /**
+   * Encodes a sheet as a still image.
+   *
+   * @param sheet The picture to encode, such as one #generate(int) made.
+   * @param codec The Codec.ID of the image encoder, such as
+   *   Codec.ID.CODEC_ID_PNG or Codec.ID.CODEC_ID_MJPEG. The sheet is
+   *   converted to a pixel format the encoder takes if need be, preferring
+   *   full range YUV for JPEG.
+   *
+   * @return a packet holding the encoded image.
+   *
+   * @throws InvalidArgument if sheet is null or incomplete, or there is no
+   *   encoder for codec.
+   * @throws RuntimeError if the sheet cannot be encoded.
+   */
+  static MediaPacket* encode(MediaPicture* sheet, Codec::ID codec);
+
+  /** @return the number of frames decoded since the last #resetStatistics(). */
+  int64_t getNumFramesDecoded();
+
+  /** @return the number of seeks made since the last #resetStatistics(). */
+  int64_t getNumSeeks();
+
+  /** Zeros the decoded frame and seek counts. */
+  void resetStatistics();
+
+#ifndef SWIG
+  class Worker;
+#endif // ! SWIG
+
+protected:
+  SpriteSheetGenerator();
+  virtual ~SpriteSheetGenerator();
+
+private:
+  void freeWorkers();
+  // the video duration and the time between tiles, in microseconds;
+  // both open the first worker to find the duration
+  int64_t getDuration();
+  int64_t getTileInterval();
+
+  std::string mURL;
+  int32_t mColumns;
+  int32_t mRows;
+  int32_t mTileWidth;
+  int32_t mTileHeight;
+  PixelFormat::Type mFormat;
+  int64_t mInterval;
+  int64_t mStartTime;
+  bool mKeyFramesOnly;
+  int32_t mThreads;
+  io::humble::ferry::Lock mLock;
+  std::vector<Worker*> mWorkers;
+  int64_t mDecoded;
+  int64_t mSeeks;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* SPRITESHEETGENERATOR_H_ */
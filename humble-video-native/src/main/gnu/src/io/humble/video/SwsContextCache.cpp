@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "SwsContextCache.h"
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+SwsContextCache SwsContextCache::sCache;
+
+SwsContextCache::SwsContextCache() {
+  mMaxContexts = DEFAULT_MAX_CONTEXTS;
+  mHits = 0;
+  mMisses = 0;
+  mEvictions = 0;
+}
+
+SwsContextCache::~SwsContextCache() {
+  for(std::list<Entry>::iterator i = mIdle.begin(); i != mIdle.end(); ++i)
+    sws_freeContext(i->context);
+}
+
+SwsContextCache*
+SwsContextCache::get() {
+  return &sCache;
+}
+
+void
+SwsContextCache::setMaxContexts(int32_t maxContexts) {
+  Lock::Guard g(&mLock);
+  mMaxContexts = maxContexts < 0 ? 0 : maxContexts;
+  trim();
+}
+
+int32_t
+SwsContextCache::getMaxContexts() {
+  Lock::Guard g(&mLock);
+  return mMaxContexts;
+}
+
+int32_t
+SwsContextCache::getNumContexts() {
+  Lock::Guard g(&mLock);
+  return (int32_t)mIdle.size();
+}
+
+int64_t
+SwsContextCache::getHits() {
+  Lock::Guard g(&mLock);
+  return mHits;
+}
+
+int64_t
+SwsContextCache::getMisses() {
+  Lock::Guard g(&mLock);
+  return mMisses;
+}
+
+int64_t
+SwsContextCache::getEvictions() {
+  Lock::Guard g(&mLock);
+  return mEvictions;
+}
+
+void
+SwsContextCache::resetStatistics() {
+  Lock::Guard g(&mLock);
+  mHits = mMisses = mEvictions = 0;
+}
+
+bool
+SwsContextCache::serialize(SwsContext* context, std::string* options) {
+  // every option, defaults included, so contexts only match if swscale
+  // would set them up the same
+  char* buffer = 0;
+  if (av_opt_serialize(context, 0, 0, &buffer, '=', ':') < 0 || !buffer)
+    return false;
+  options->assign(buffer);
+  av_free(buffer);
+  return true;
+}
+
+SwsContext*
+SwsContextCache::acquire(SwsContext* options) {
+  if (!options)
+    return 0;
+  Entry entry;
+  bool cacheable = serialize(options, &entry.key);
+  if (cacheable) {
+    Lock::Guard g(&mLock);
+    std::multimap<std::string, std::list<Entry>::iterator>::iterator found =
+        mIndex.find(entry.key);
+    if (found != mIndex.end()) {
+      entry = *found->second;
+      mIdle.erase(found->second);
+      mIndex.erase(found);
+      mLent[entry.context] = entry;
+      ++mHits;
+      return entry.context;
+    }
+    ++mMisses;
+  }
+
+  entry.context = sws_alloc_context();
+  if (!entry.context ||
+      av_opt_copy(entry.context, options) < 0 ||
+      sws_init_context(entry.context, 0, 0) < 0) {
+    sws_freeContext(entry.context);
+    return 0;
+  }
+  if (cacheable && serialize(entry.context, &entry.setUp)) {
+    Lock::Guard g(&mLock);
+    mLent[entry.context] = entry;
+  }
+  return entry.context;
+}
+
+void
+SwsContextCache::release(SwsContext* context) {
+  if (!context)
+    return;
+  std::string setUp;
+  bool unchanged = serialize(context, &setUp);
+  // error diffusion carries the error left over from the last picture
+  // into the next one
+  int64_t dither = 0;
+  av_opt_get_int(context, "sws_dither", 0, &dither);
+  {
+    Lock::Guard g(&mLock);
+    std::map<SwsContext*, Entry>::iterator lent = mLent.find(context);
+    if (lent != mLent.end()) {
+      Entry entry = lent->second;
+      mLent.erase(lent);
+      if (mMaxContexts > 0 && unchanged && setUp == entry.setUp && dither <= 2) {
+        mIdle.push_front(entry);
+        mIndex.insert(std::make_pair(entry.key, mIdle.begin()));
+        trim();
+        return;
+      }
+    }
+  }
+  sws_freeContext(context);
+}
+
+void
+SwsContextCache::trim() {
+  while((int32_t)mIdle.size() > mMaxContexts) {
+    std::list<Entry>::iterator oldest = --mIdle.end();
+    std::multimap<std::string, std::list<Entry>::iterator>::iterator i =
+        mIndex.lower_bound(oldest->key);
+    while(i->second != oldest)
+      ++i;
+    mIndex.erase(i);
+    sws_freeContext(oldest->context);
+    mIdle.erase(oldest);
+    ++mEvictions;
+  }
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef SWSCONTEXTCACHE_H_
+#define SWSCONTEXTCACHE_H_
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/video/HumbleVideo.h>
+#include <io/humble/video/FfmpegIncludes.h>
+
+#include <list>
+#include <map>
+#include <string>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. A process-wide, bounded (least-recently-used) cache of
+ * set up SwsContexts that no resampler is using, so that a new resampler
+ * with the same options can skip building swscale's filter tables.
+ * <p>
+ * swscale cannot copy a context, and a context cannot scale two pictures
+ * at once, so contexts are lent out rather than shared: #acquire(SwsContext*)
+ * takes an idle one with identical options out of the cache, or sets up a
+ * new one, and #release(SwsContext*) puts it back when its resampler is
+ * done. Contexts that carry error diffusion state from one picture to the
+ * next are never put back, as they would not scale the same as a new one,
+ * and nor are those whose options were changed while lent out.
+ * </p>
+ */
+class SwsContextCache
+{
+public:
+  /** The number of idle contexts kept unless #setMaxContexts(int32_t) is called. */
+  static const int32_t DEFAULT_MAX_CONTEXTS = 16;
+
+  /** The one cache shared by all resamplers. */
+  static SwsContextCache* get();
+
+  /**
+   * Sets the most idle contexts kept; 0 turns the cache off and frees
+   * them. Shrinking frees the least recently used.
+   */
+  void setMaxContexts(int32_t maxContexts);
+  int32_t getMaxContexts();
+  int32_t getNumContexts();
+
+  /**
+   * Gets a context set up from options, which must not have been set up
+   * (sws_init_context) itself.
+   * @return the context; give it back with #release(SwsContext*). 0 if
+   *   swscale cannot set one up with these options.
+   */
+  SwsContext* acquire(SwsContext* options);
+  /**
+   * Gives back a context #acquire(SwsContext*) returned, to keep for the
+   * next resampler that asks for it or to free. Null is ignored.
+   */
+  void release(SwsContext* context);
+
+  int64_t getHits();
+  int64_t getMisses();
+  int64_t getEvictions();
+  void resetStatistics();
+
+private:
+  SwsContextCache();
+  ~SwsContextCache();
+  SwsContextCache(const SwsContextCache&);
+  SwsContextCache& operator=(const SwsContextCache&);
+
+  static bool serialize(SwsContext* context, std::string* options);
+  void trim();
+
+  static SwsContextCache sCache;
+
+  struct Entry {
+    // the options the context was set up from, and those it had once set up
+    std::string key;
+    std::string setUp;
+    SwsContext* context;
+  };
+
+  io::humble::ferry::Lock mLock;
+  int32_t mMaxContexts;
+  // idle contexts, most recently used first
+  std::list<Entry> mIdle;
+  std::multimap<std::string, std::list<Entry>::iterator> mIndex;
+  // every context lent out
+  std::map<SwsContext*, Entry> mLent;
+  int64_t mHits;
+  int64_t mMisses;
+  int64_t mEvictions;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* SWSCONTEXTCACHE_H_ */
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/video/FfmpegIncludes.h>
+#include "WorkerPool.h"
+
+extern "C" {
+#include <libavutil/cpu.h>
+}
+
+VS_LOG_SETUP(VS_CPP_PACKAGE.WorkerPool);
+
+using namespace io::humble::ferry;
+
+namespace io {
+namespace humble {
+namespace video {
+
+namespace {
+// more threads than this only get in each other's way
+const int32_t sMaxWorkers = 64;
+}
+
+WorkerPool WorkerPool::sPool;
+
+WorkerPool::WorkerPool() {
+  mShutdown = false;
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    Lock::Guard g(&mLock);
+    mShutdown = true;
+    mQueued.broadcast();
+  }
+  for(size_t i = 0; i < mWorkers.size(); i++) {
+    mWorkers[i]->join();
+    delete mWorkers[i];
+  }
+  mWorkers.clear();
+}
+
+WorkerPool*
+WorkerPool::get() {
+  return &sPool;
+}
+
+int32_t
+WorkerPool::getCPUs() {
+  int32_t cpus = av_cpu_count();
+  return cpus < 1 ? 1 : cpus;
+}
+
+void
+WorkerPool::run(Job** jobs, int32_t numJobs) {
+  if (numJobs <= 0)
+    return;
+  if (numJobs == 1) {
+    jobs[0]->run();
+    return;
+  }
+  Batch batch;
+  batch.jobs = jobs;
+  batch.numJobs = numJobs;
+  batch.next = 0;
+  batch.done = 0;
+
+  Lock::Guard g(&mLock);
+  int32_t numWorkers = FFMIN(FFMAX(getCPUs(), numJobs), sMaxWorkers + 1) - 1;
+  if ((int32_t)mWorkers.size() < numWorkers && !mShutdown) {
+    VS_LOG_DEBUG("Starting %d more workers", numWorkers - (int32_t)mWorkers.size());
+    while((int32_t)mWorkers.size() < numWorkers) {
+      Worker* worker = new Worker(this);
+      mWorkers.push_back(worker);
+      worker->start();
+    }
+  }
+  if (!mWorkers.empty()) {
+    mBatches.push_back(&batch);
+    mQueued.broadcast();
+  }
+  while(runNext(&batch))
+    ;
+  while(batch.done < batch.numJobs)
+    mDone.wait(&mLock);
+}
+
+bool
+WorkerPool::runNext(Batch* batch) {
+  if (batch->next >= batch->numJobs)
+    return false;
+  Job* job = batch->jobs[batch->next++];
+  if (batch->next >= batch->numJobs) {
+    // all handed out; nobody else needs to find this batch
+    for(std::deque<Batch*>::iterator it = mBatches.begin();
+        it != mBatches.end(); ++it) {
+      if (*it == batch) {
+        mBatches.erase(it);
+        break;
+      }
+    }
+  }
+  mLock.unlock();
+  job->run();
+  mLock.lock();
+  batch->done++;
+  if (batch->done == batch->numJobs)
+    mDone.broadcast();
+  return true;
+}
+
+void
+WorkerPool::work() {
+  Lock::Guard g(&mLock);
+  while(!mShutdown) {
+    if (mBatches.empty()) {
+      mQueued.wait(&mLock);
+      continue;
+    }
+    runNext(mBatches.front());
+  }
+}
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
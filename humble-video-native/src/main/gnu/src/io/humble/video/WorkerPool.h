@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/Thread.h>
+#include <io/humble/video/HumbleVideo.h>
+
+#include <deque>
+#include <vector>
+
+namespace io {
+namespace humble {
+namespace video {
+
+/**
+ * Internal only. A process-wide set of worker threads that run batches
+ * of short, independent jobs in parallel.
+ * <p>
+ * The thread calling #run(Job**, int32_t) works on its own batch too,
+ * so a batch always makes progress even if every worker is busy with
+ * another caller's batch. Workers are started as batches need them, up
+ * to one fewer than the larger of the number of CPUs and the largest batch
+ * yet, and stopped when the process exits.
+ * </p>
+ */
+class WorkerPool
+{
+public:
+  /**
+   * A unit of work. Jobs must not throw, and must not call
+   * #run(Job**, int32_t) themselves.
+   */
+  class Job
+  {
+  public:
+    virtual ~Job() {}
+    virtual void run()=0;
+  };
+
+  /** @return the pool shared by the whole process. */
+  static WorkerPool* get();
+
+  /** @return the number of CPUs available to the process; at least 1. */
+  static int32_t getCPUs();
+
+  /**
+   * Runs every job in jobs, and returns once they have all finished.
+   */
+  void run(Job** jobs, int32_t numJobs);
+
+private:
+  struct Batch
+  {
+    Job** jobs;
+    int32_t numJobs;
+    // next job to hand out, and number of jobs finished
+    int32_t next;
+    int32_t done;
+  };
+  class Worker : public io::humble::ferry::Thread
+  {
+  public:
+    Worker(WorkerPool* pool) : mPool(pool) {}
+  protected:
+    void run() { mPool->work(); }
+  private:
+    WorkerPool* mPool;
+  };
+
+  WorkerPool();
+  ~WorkerPool();
+  void work();
+  // called with mLock held; runs the next job of batch, if any, and
+  // returns false if it had none left to hand out.
+  bool runNext(Batch* batch);
+
+  static WorkerPool sPool;
+
+  io::humble::ferry::Lock mLock;
+  // signalled when a batch is queued
+  io::humble::ferry::Condition mQueued;
+  // broadcast when a job finishes
+  io::humble::ferry::Condition mDone;
+  // batches with jobs not yet handed out
+  std::deque<Batch*> mBatches;
+  std::vector<Worker*> mWorkers;
+  bool mShutdown;
+};
+
+} /* namespace video */
+} /* namespace humble */
+} /* namespace io */
+#endif /* WORKERPOOL_H_ */
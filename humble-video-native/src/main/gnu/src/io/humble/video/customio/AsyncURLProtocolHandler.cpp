@@ -0,0 +1,372 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <io/humble/ferry/Logger.h>
+
+#include <io/humble/video/customio/AsyncURLProtocolHandler.h>
+#include <io/humble/video/customio/AsyncURLProtocolManager.h>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+using namespace io::humble::ferry;
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+
+AsyncURLProtocolHandler :: AsyncURLProtocolHandler(
+    AsyncURLProtocolManager* mgr, int32_t windows, int32_t windowSize) :
+    URLProtocolHandler(mgr),
+    mNumWindows(windows),
+    mWindowSize(windowSize)
+{
+  mFile = -1;
+  mSize = 0;
+  mPosition = 0;
+  mReadAhead = 0;
+  mShutdown = false;
+}
+
+AsyncURLProtocolHandler :: ~AsyncURLProtocolHandler()
+{
+  (void) url_close();
+}
+
+#ifndef _WIN32
+int
+AsyncURLProtocolHandler :: url_open(const char *url, int flags)
+{
+  if (!url || !*url)
+    return -1;
+  (void) url_close();
+  if (flags != URLProtocolHandler::URL_RDONLY_MODE)
+    return -1;
+
+  // The URL MAY contain a protocol string.  Find it now.
+  char proto[256];
+  const char* protocol = URLProtocolManager::parseProtocol(proto, sizeof(proto), url);
+  if (protocol)
+  {
+    size_t protoLen = strlen(protocol);
+    // skip past it
+    url = url + protoLen;
+    if (*url == ':' || *url == ',')
+      ++url;
+  }
+  mFile = open(url, O_RDONLY);
+  if (mFile < 0)
+    return -1;
+  struct stat info;
+  if (fstat(mFile, &info) < 0 || !S_ISREG(info.st_mode)) {
+    (void) url_close();
+    return -1;
+  }
+  mSize = info.st_size;
+
+  mWindows.resize(mNumWindows);
+  for(int32_t i = 0; i < mNumWindows; i++) {
+    Window* w = &mWindows[i];
+    w->data = (unsigned char*)malloc(mWindowSize);
+    w->offset = 0;
+    w->length = 0;
+    w->state = WINDOW_IDLE;
+    w->cancelled = false;
+    if (!w->data) {
+      (void) url_close();
+      return -1;
+    }
+  }
+  mPosition = 0;
+  mReadAhead = 0;
+  mShutdown = false;
+  // one worker per window, so every window can be in flight at once
+  for(int32_t i = 0; i < mNumWindows; i++) {
+    Worker* worker = new Worker(this);
+    mWorkers.push_back(worker);
+    worker->start();
+  }
+  Lock::Guard guard(&mLock);
+  readAhead();
+  return 0;
+}
+
+int
+AsyncURLProtocolHandler :: url_close()
+{
+  if (mFile < 0)
+    return -1;
+  {
+    Lock::Guard guard(&mLock);
+    mShutdown = true;
+    mChanged.broadcast();
+  }
+  // reads in progress finish before their workers exit
+  for(size_t i = 0; i < mWorkers.size(); i++) {
+    mWorkers[i]->join();
+    delete mWorkers[i];
+  }
+  mWorkers.clear();
+  for(size_t i = 0; i < mWindows.size(); i++)
+    free(mWindows[i].data);
+  mWindows.clear();
+
+  int retval = close(mFile);
+  mFile = -1;
+  mSize = 0;
+  mPosition = 0;
+  mReadAhead = 0;
+  mShutdown = false;
+  return retval;
+}
+
+void
+AsyncURLProtocolHandler :: work()
+{
+  mLock.lock();
+  while(true) {
+    // take the queued window nearest the reader
+    Window* w = 0;
+    while(!mShutdown) {
+      for(size_t i = 0; i < mWindows.size(); i++)
+        if (mWindows[i].state == WINDOW_QUEUED &&
+            (!w || mWindows[i].offset < w->offset))
+          w = &mWindows[i];
+      if (w)
+        break;
+      mChanged.wait(&mLock);
+    }
+    if (mShutdown)
+      break;
+    w->state = WINDOW_READING;
+    const int64_t offset = w->offset;
+    const int32_t size = (int32_t)std::min((int64_t)mWindowSize, mSize - offset);
+    unsigned char* data = w->data;
+    mLock.unlock();
+
+    int32_t total = 0;
+    bool failed = false;
+    while(total < size) {
+      ssize_t bytes = pread(mFile, data + total, size - total, (off_t)(offset + total));
+      if (bytes < 0) {
+        if (errno == EINTR)
+          continue;
+        VS_LOG_DEBUG("could not read %d bytes at %" PRIi64 ": %s",
+            size - total, offset + total, strerror(errno));
+        failed = true;
+        break;
+      }
+      if (bytes == 0)
+        // the file shrank under us
+        break;
+      total += (int32_t)bytes;
+    }
+
+    mLock.lock();
+    if (w->cancelled) {
+      // a seek dropped it while we read; it is free again
+      w->cancelled = false;
+      w->state = WINDOW_IDLE;
+      readAhead();
+    } else {
+      w->length = total;
+      w->state = failed ? WINDOW_FAILED : WINDOW_DONE;
+    }
+    mChanged.broadcast();
+  }
+  mLock.unlock();
+}
+
+int
+AsyncURLProtocolHandler :: url_read(unsigned char* buf, int size)
+{
+  if (mFile < 0 || !buf || size < 0)
+    return -1;
+  Lock::Guard guard(&mLock);
+  if (mPosition >= mSize)
+    return 0;
+
+  Window* w = findWindow(mPosition);
+  if (!w) {
+    retarget(mPosition);
+    w = findWindow(mPosition);
+    if (!w)
+      return -1;
+  }
+  while(w->state == WINDOW_QUEUED || w->state == WINDOW_READING)
+    mChanged.wait(&mLock);
+  if (w->state == WINDOW_FAILED) {
+    // try again from here next time
+    retarget(mPosition);
+    return -1;
+  }
+
+  const int32_t start = (int32_t)(mPosition - w->offset);
+  if (start >= w->length)
+    return 0;
+  const int32_t bytes = std::min(size, w->length - start);
+  // workers never touch a finished window, so no one else is using it
+  memcpy(buf, w->data + start, bytes);
+  mPosition += bytes;
+
+  // hand back windows we have read past so they can read further ahead
+  bool recycled = false;
+  for(size_t i = 0; i < mWindows.size(); i++) {
+    Window* done = &mWindows[i];
+    if (done->state == WINDOW_DONE &&
+        done->offset + done->length <= mPosition) {
+      done->state = WINDOW_IDLE;
+      recycled = true;
+    }
+  }
+  if (recycled)
+    readAhead();
+  return bytes;
+}
+#else
+int
+AsyncURLProtocolHandler :: url_open(const char *, int)
+{
+  // no pread(2) here
+  return -1;
+}
+
+int
+AsyncURLProtocolHandler :: url_close()
+{
+  return -1;
+}
+
+void
+AsyncURLProtocolHandler :: work()
+{
+}
+
+int
+AsyncURLProtocolHandler :: url_read(unsigned char*, int)
+{
+  return -1;
+}
+#endif // ! _WIN32
+
+void
+AsyncURLProtocolHandler :: readAhead()
+{
+  // caller holds mLock
+  bool queued = false;
+  for(size_t i = 0; i < mWindows.size() && mReadAhead < mSize; i++) {
+    Window* w = &mWindows[i];
+    if (w->state != WINDOW_IDLE)
+      continue;
+    w->offset = mReadAhead;
+    w->length = 0;
+    w->state = WINDOW_QUEUED;
+    mReadAhead += mWindowSize;
+    queued = true;
+  }
+  if (queued)
+    mChanged.broadcast();
+}
+
+void
+AsyncURLProtocolHandler :: retarget(int64_t position)
+{
+  // caller holds mLock
+  for(size_t i = 0; i < mWindows.size(); i++) {
+    Window* w = &mWindows[i];
+    if (w->state == WINDOW_READING)
+      // the worker frees it when the read comes back
+      w->cancelled = true;
+    else
+      w->state = WINDOW_IDLE;
+  }
+  mReadAhead = position;
+  readAhead();
+}
+
+AsyncURLProtocolHandler::Window*
+AsyncURLProtocolHandler :: findWindow(int64_t position)
+{
+  // caller holds mLock
+  for(size_t i = 0; i < mWindows.size(); i++) {
+    Window* w = &mWindows[i];
+    if (w->state != WINDOW_IDLE && !w->cancelled &&
+        w->offset <= position && position < w->offset + mWindowSize)
+      return w;
+  }
+  return 0;
+}
+
+int
+AsyncURLProtocolHandler :: url_write(const unsigned char*, int)
+{
+  // read only
+  return -1;
+}
+
+int64_t
+AsyncURLProtocolHandler :: url_seek(int64_t position,
+    int whence)
+{
+  if (mFile < 0)
+    return -1;
+
+  Lock::Guard guard(&mLock);
+  int64_t newPosition;
+  switch(whence) {
+    case SK_SEEK_SET:
+      newPosition = position;
+      break;
+    case SK_SEEK_CUR:
+      newPosition = mPosition + position;
+      break;
+    case SK_SEEK_END:
+      newPosition = mSize + position;
+      break;
+    case SK_SEEK_SIZE:
+      return mSize;
+    default:
+      return -1;
+  }
+  if (newPosition < 0)
+    return -1;
+  mPosition = newPosition;
+  // start reading ahead from the new position now, rather than on the
+  // next read
+  if (mPosition < mSize && !findWindow(mPosition))
+    retarget(mPosition);
+  return mPosition;
+}
+
+URLProtocolHandler::SeekableFlags
+AsyncURLProtocolHandler :: url_seekflags( const char*, int)
+{
+  return URLProtocolHandler::SK_SEEKABLE_NORMAL;
+}
+
+}}}}
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef ASYNCURLPROTOCOLHANDLER_H_
+#define ASYNCURLPROTOCOLHANDLER_H_
+
+#include <vector>
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/Thread.h>
+#include <io/humble/video/customio/URLProtocolHandler.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+  {
+  class AsyncURLProtocolManager;
+
+  /**
+   * Reads local files ahead of the reader, with several reads in flight
+   * at once.
+   *
+   * On open the file is split into windows, and a worker thread per
+   * window reads each with pread(2) ahead of the current position, so the
+   * device always has a queue of requests to work on. #url_read copies out
+   * of completed windows, and hands a window back to the workers to read
+   * further ahead once it has been read through. Seeking outside the
+   * windows in flight drops them (reads already started are left to
+   * finish and thrown away) and starts reading ahead from the new position.
+   *
+   * Only reading is supported, and only where pread(2) is available.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO AsyncURLProtocolHandler : public URLProtocolHandler
+  {
+  public:
+    AsyncURLProtocolHandler(AsyncURLProtocolManager* mgr,
+        int32_t windows, int32_t windowSize);
+    virtual ~AsyncURLProtocolHandler();
+
+    // Now, let's have our forwarding functions
+    virtual int url_open(const char *url, int flags);
+    virtual int url_close();
+    virtual int url_read(unsigned char* buf, int size);
+    virtual int url_write(const unsigned char* buf, int size);
+    virtual int64_t url_seek(int64_t position, int whence);
+    virtual SeekableFlags url_seekflags(const char* url, int flags);
+
+  private:
+    typedef enum WindowState {
+      WINDOW_IDLE,
+      WINDOW_QUEUED,
+      WINDOW_READING,
+      WINDOW_DONE,
+      WINDOW_FAILED,
+    } WindowState;
+    struct Window
+    {
+      unsigned char* data;
+      int64_t offset;
+      int32_t length;
+      WindowState state;
+      // set when a seek drops the window while a worker is reading it
+      bool cancelled;
+    };
+    class Worker : public io::humble::ferry::Thread
+    {
+    public:
+      Worker(AsyncURLProtocolHandler* handler) : mHandler(handler) {}
+    protected:
+      void run() { mHandler->work(); }
+    private:
+      AsyncURLProtocolHandler* mHandler;
+    };
+
+    void work();
+    // the following are called with mLock held
+    void readAhead();
+    void retarget(int64_t position);
+    Window* findWindow(int64_t position);
+
+    const int32_t mNumWindows;
+    const int32_t mWindowSize;
+
+    int mFile;
+    int64_t mSize;
+    int64_t mPosition;
+
+    io::humble::ferry::Lock mLock;
+    io::humble::ferry::Condition mChanged;
+    std::vector<Window> mWindows;
+    std::vector<Worker*> mWorkers;
+    // where the next window handed to the workers starts
+    int64_t mReadAhead;
+    bool mShutdown;
+  };
+  }}}}
+#endif /*ASYNCURLPROTOCOLHANDLER_H_*/
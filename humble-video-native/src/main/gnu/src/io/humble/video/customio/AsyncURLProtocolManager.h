@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef ASYNCURLPROTOCOLMANAGER_H_
+#define ASYNCURLPROTOCOLMANAGER_H_
+
+#include <io/humble/video/customio/URLProtocolManager.h>
+#include <io/humble/video/customio/AsyncURLProtocolHandler.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+  /**
+   * A class for managing a protocol that reads local files ahead of
+   * the reader with several reads in flight.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO AsyncURLProtocolManager : public URLProtocolManager
+  {
+  public:
+    /** Default number of read-ahead windows in flight per open file. */
+    static const int32_t DEFAULT_WINDOWS = 4;
+    /** Default size of each read-ahead window: 1 MiB. */
+    static const int32_t DEFAULT_WINDOW_SIZE = 1024*1024;
+
+    /**
+     * Returns a URLProtocol handler for the given url and flags
+     *
+     * @return a {@link URLProtocolHandler} or NULL if none can be created.
+     */
+    AsyncURLProtocolHandler* getHandler(const char* url, int flags);
+
+    /**
+     * Convenience method that creates a AsyncURLProtocolManager and registers with the
+     * URLProtocolManager global methods.
+     *
+     * @param aProtocolName The protocol name.
+     * @param windows How many windows each handler reads ahead at once.
+     * @param windowSize The size of each window in bytes.
+     */
+    static AsyncURLProtocolManager* registerProtocol(const char *aProtocolName,
+        int32_t windows=DEFAULT_WINDOWS,
+        int32_t windowSize=DEFAULT_WINDOW_SIZE);
+
+  protected:
+    AsyncURLProtocolManager(const char *aProtocolName,
+        int32_t windows, int32_t windowSize);
+    virtual ~AsyncURLProtocolManager();
+
+  private:
+    const int32_t mWindows;
+    const int32_t mWindowSize;
+  };
+}}}}
+#endif /*ASYNCURLPROTOCOLMANAGER_H_*/
@@ -0,0 +1,300 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cstring>
+#include <algorithm>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/video/FfmpegIncludes.h>
+
+#include <io/humble/video/customio/CachingURLProtocolHandler.h>
+#include <io/humble/video/customio/CachingURLProtocolManager.h>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+using namespace io::humble::ferry;
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+
+namespace {
+/**
+ * Returns when the local file url names was last modified, in
+ * nanoseconds, or -1 if url is not a local file.
+ */
+int64_t
+lastModified(const char* url)
+{
+  const char* path = url;
+  if (!strncmp(url, "file:", 5))
+    path = url + 5;
+  else {
+    // anything with a protocol (other than a drive letter) is not a file
+    const char* colon = strchr(url, ':');
+    if (colon && colon - url > 1)
+      return -1;
+  }
+  struct stat info;
+  if (stat(path, &info))
+    return -1;
+  int64_t nanoseconds = 0;
+#if defined(__APPLE__)
+  nanoseconds = info.st_mtimespec.tv_nsec;
+#elif !defined(_WIN32)
+  nanoseconds = info.st_mtim.tv_nsec;
+#endif
+  return (int64_t)info.st_mtime*1000000000 + nanoseconds;
+}
+
+CachingURLProtocolManager::Version
+makeVersion(int64_t size, int64_t modified)
+{
+  CachingURLProtocolManager::Version version;
+  version.size = size;
+  version.modified = modified;
+  return version;
+}
+}
+
+CachingURLProtocolHandler :: CachingURLProtocolHandler(
+    CachingURLProtocolManager* mgr) : URLProtocolHandler(mgr)
+{
+  mCache = mgr;
+  mOpen = false;
+  mSize = -1;
+  mModified = -1;
+  mPosition = 0;
+  mShortRead = false;
+  mSourceHandler = 0;
+  mSourceContext = 0;
+  mSourcePosition = 0;
+}
+
+CachingURLProtocolHandler :: ~CachingURLProtocolHandler()
+{
+  (void) url_close();
+}
+
+int
+CachingURLProtocolHandler :: url_open(const char *url, int flags)
+{
+  if (!url || !*url)
+    return -1;
+  (void) url_close();
+  if (flags != URLProtocolHandler::URL_RDONLY_MODE)
+    return -1;
+
+  // The URL MAY contain a protocol string.  Find it now.
+  char proto[256];
+  const char* protocol = URLProtocolManager::parseProtocol(proto, sizeof(proto), url);
+  if (protocol)
+  {
+    size_t protoLen = strlen(protocol);
+    // skip past it
+    url = url + protoLen;
+    if (*url == ':' || *url == ',')
+      ++url;
+  }
+  if (!*url)
+    return -1;
+  mURL = url;
+  mPosition = 0;
+  // even if all of it is cached, it may not be what is there now.
+  if (openSource() < 0)
+    return -1;
+  mCache->dropStale(mURL.c_str(), makeVersion(mSize, mModified));
+  mOpen = true;
+  return 0;
+}
+
+int
+CachingURLProtocolHandler :: openSource()
+{
+  closeSource();
+  mSourceHandler = URLProtocolManager::findHandler(mURL.c_str(),
+      URLProtocolHandler::URL_RDONLY_MODE, 0);
+  if (mSourceHandler) {
+    if (mSourceHandler->url_open(mURL.c_str(),
+        URLProtocolHandler::URL_RDONLY_MODE) < 0) {
+      delete mSourceHandler;
+      mSourceHandler = 0;
+      return -1;
+    }
+    mSize = mSourceHandler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE);
+  } else {
+    // not one of ours; let FFmpeg open it
+    int retval = avio_open2(&mSourceContext, mURL.c_str(), AVIO_FLAG_READ,
+        0, 0);
+    if (retval < 0) {
+      VS_LOG_DEBUG("could not open %s: %d", mURL.c_str(), retval);
+      mSourceContext = 0;
+      return -1;
+    }
+    mSize = avio_size(mSourceContext);
+  }
+  if (mSize < 0)
+    mSize = -1;
+  mModified = lastModified(mURL.c_str());
+  mSourcePosition = 0;
+  return 0;
+}
+
+void
+CachingURLProtocolHandler :: closeSource()
+{
+  if (mSourceHandler) {
+    (void) mSourceHandler->url_close();
+    delete mSourceHandler;
+    mSourceHandler = 0;
+  }
+  if (mSourceContext)
+    avio_closep(&mSourceContext);
+  mSourcePosition = 0;
+}
+
+int
+CachingURLProtocolHandler :: url_close()
+{
+  if (!mOpen)
+    return -1;
+  closeSource();
+  mOpen = false;
+  mURL.clear();
+  mSize = -1;
+  mModified = -1;
+  mPosition = 0;
+  return 0;
+}
+
+int32_t
+CachingURLProtocolHandler :: loadBlock(int64_t offset, unsigned char* buf,
+    int32_t size, bool* complete)
+{
+  *complete = false;
+  mShortRead = true;
+  if (!mSourceHandler && !mSourceContext && openSource() < 0)
+    return -1;
+  if (offset != mSourcePosition) {
+    int64_t position = mSourceHandler ?
+        mSourceHandler->url_seek(offset, URLProtocolHandler::SK_SEEK_SET) :
+        avio_seek(mSourceContext, offset, SEEK_SET);
+    if (position != offset) {
+      VS_LOG_DEBUG("could not seek %s to %" PRIi64, mURL.c_str(), offset);
+      return -1;
+    }
+    mSourcePosition = offset;
+  }
+  int32_t total = 0;
+  bool eof = false;
+  while(total < size) {
+    int retval = mSourceHandler ?
+        mSourceHandler->url_read(buf + total, size - total) :
+        avio_read(mSourceContext, buf + total, size - total);
+    if (retval == 0 || retval == AVERROR_EOF) {
+      eof = true;
+      break;
+    }
+    if (retval < 0) {
+      if (total > 0)
+        // hand back what we have; the next read reports the error
+        break;
+      return -1;
+    }
+    total += retval;
+  }
+  mSourcePosition += total;
+  // a short block is only the truth if it ends where the URL does
+  *complete = total == size ||
+      (eof && (mSize < 0 || offset + total == mSize));
+  mShortRead = !*complete;
+  return total;
+}
+
+int
+CachingURLProtocolHandler :: url_read(unsigned char* buf, int size)
+{
+  if (!mOpen || size < 0)
+    return -1;
+  if (mSize >= 0 && mPosition >= mSize)
+    return 0;
+
+  const int32_t blockSize = mCache->getBlockSize();
+  int64_t offset = mPosition - mPosition % blockSize;
+  RefPointer<Buffer> block;
+  mShortRead = false;
+  int32_t length = mCache->getBlock(mURL.c_str(), offset,
+      makeVersion(mSize, mModified), this, &block);
+  if (length < 0)
+    return -1;
+  int32_t start = (int32_t)(mPosition - offset);
+  if (start >= length)
+    // the block we read ourselves came up short: an error, not the end
+    return mShortRead ? -1 : 0;
+  int32_t bytes = std::min(size, length - start);
+  memcpy(buf, (unsigned char*)block->getBytes(start, bytes), bytes);
+  mPosition += bytes;
+  return bytes;
+}
+
+int
+CachingURLProtocolHandler :: url_write(const unsigned char*, int)
+{
+  return -1;
+}
+
+int64_t
+CachingURLProtocolHandler :: url_seek(int64_t position,
+    int whence)
+{
+  if (!mOpen)
+    return -1;
+
+  int64_t newPosition;
+  switch(whence) {
+    case SK_SEEK_SET:
+      newPosition = position;
+      break;
+    case SK_SEEK_CUR:
+      newPosition = mPosition + position;
+      break;
+    case SK_SEEK_END:
+      if (mSize < 0)
+        return -1;
+      newPosition = mSize + position;
+      break;
+    case SK_SEEK_SIZE:
+      return mSize;
+    default:
+      return -1;
+  }
+  if (newPosition < 0)
+    return -1;
+  mPosition = newPosition;
+  return mPosition;
+}
+
+URLProtocolHandler::SeekableFlags
+CachingURLProtocolHandler :: url_seekflags( const char*, int)
+{
+  return URLProtocolHandler::SK_SEEKABLE_NORMAL;
+}
+
+}}}}
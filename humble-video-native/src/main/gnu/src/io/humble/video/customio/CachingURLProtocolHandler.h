@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef CACHINGURLPROTOCOLHANDLER_H_
+#define CACHINGURLPROTOCOLHANDLER_H_
+
+#include <string>
+
+#include <io/humble/video/customio/URLProtocolHandler.h>
+
+struct AVIOContext;
+
+namespace io { namespace humble { namespace video { namespace customio
+  {
+  class CachingURLProtocolManager;
+
+  /**
+   * Reads another URL through the block cache of its
+   * {@link CachingURLProtocolManager}.
+   *
+   * "<protocol>:<url>" reads <url>, which may use any protocol FFmpeg or
+   * another registered {@link URLProtocolManager} handles. Reads are
+   * served from cached blocks shared with every other handler of the same
+   * manager; only blocks nobody has cached are read from <url>.
+   *
+   * <url> is always opened, and blocks cached when it had another size
+   * or, for a local file, another modification time are dropped rather
+   * than served. Only reading is supported.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO CachingURLProtocolHandler : public URLProtocolHandler
+  {
+  public:
+    CachingURLProtocolHandler(CachingURLProtocolManager* mgr);
+    virtual ~CachingURLProtocolHandler();
+
+    // Now, let's have our forwarding functions
+    virtual int url_open(const char *url, int flags);
+    virtual int url_close();
+    virtual int url_read(unsigned char* buf, int size);
+    virtual int url_write(const unsigned char* buf, int size);
+    virtual int64_t url_seek(int64_t position, int whence);
+    virtual SeekableFlags url_seekflags(const char* url, int flags);
+
+    /**
+     * Reads up to size bytes at offset from the underlying URL, opening
+     * it if need be. Called by the manager on a cache miss.
+     *
+     * @param complete Set to false if a read error cut the block short,
+     *   in which case the bytes read are good but must not be cached.
+     * @return the number of bytes read, 0 at end of file, or -1 on error.
+     */
+    int32_t loadBlock(int64_t offset, unsigned char* buf, int32_t size,
+        bool* complete);
+
+  private:
+    int openSource();
+    void closeSource();
+
+    CachingURLProtocolManager* mCache;
+    bool mOpen;
+    std::string mURL;
+    int64_t mSize;
+    // nanoseconds; -1 unless the URL is a local file
+    int64_t mModified;
+    int64_t mPosition;
+    // set when the last block this handler read was cut short by an error
+    bool mShortRead;
+
+    // at most one of these is set, once the underlying URL is opened
+    URLProtocolHandler* mSourceHandler;
+    AVIOContext* mSourceContext;
+    int64_t mSourcePosition;
+  };
+  }}}}
+#endif /*CACHINGURLPROTOCOLHANDLER_H_*/
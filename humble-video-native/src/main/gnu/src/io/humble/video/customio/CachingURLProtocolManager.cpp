@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/video/customio/CachingURLProtocolManager.h>
+
+using namespace io::humble::ferry;
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+CachingURLProtocolManager*
+CachingURLProtocolManager :: registerProtocol(const char *aProtocolName,
+    int64_t maxBytes, int32_t blockSize)
+{
+  CachingURLProtocolManager* mgr = new CachingURLProtocolManager(aProtocolName,
+      maxBytes, blockSize);
+  return dynamic_cast<CachingURLProtocolManager*>(URLProtocolManager::registerProtocol(mgr));
+}
+
+CachingURLProtocolManager :: CachingURLProtocolManager(
+    const char * aProtocolName, int64_t maxBytes, int32_t blockSize) :
+    URLProtocolManager(aProtocolName),
+    mBlockSize(blockSize > 0 ? blockSize : DEFAULT_BLOCK_SIZE)
+{
+  mMaxBytes = maxBytes < 0 ? 0 : maxBytes;
+  mCachedBytes = 0;
+  mHits = 0;
+  mMisses = 0;
+  mWaits = 0;
+  mEvictions = 0;
+}
+
+CachingURLProtocolManager :: ~CachingURLProtocolManager()
+{
+  for(Blocks::iterator it = mBlocks.begin(); it != mBlocks.end(); ++it)
+    delete it->second;
+  mBlocks.clear();
+  mLRU.clear();
+}
+
+CachingURLProtocolHandler *
+CachingURLProtocolManager :: getHandler(const char *, int)
+{
+  return new CachingURLProtocolHandler(this);
+}
+
+int32_t
+CachingURLProtocolManager :: getBlock(const char* url, int64_t offset,
+    const Version& version, CachingURLProtocolHandler* loader,
+    RefPointer<Buffer>* block)
+{
+  Key key(url, offset);
+  {
+    Lock::Guard guard(&mLock);
+    bool waited = false;
+    while(true) {
+      Blocks::iterator it = mBlocks.find(key);
+      if (it == mBlocks.end())
+        break;
+      Block* cached = it->second;
+      if (cached->ready && cached->version != version) {
+        // read before url changed; read it again
+        drop(it);
+        break;
+      }
+      if (cached->ready) {
+        if (waited)
+          ++mWaits;
+        else
+          ++mHits;
+        mLRU.splice(mLRU.begin(), mLRU, cached->lru);
+        *block = cached->data;
+        return cached->length;
+      }
+      // another thread is reading it; look again once it is done, as a
+      // failed read removes the block rather than marking it ready.
+      waited = true;
+      mLoaded.wait(&mLock);
+    }
+    // we read it; anyone else who misses waits for us.
+    Block* loading = new Block;
+    loading->length = 0;
+    loading->version = version;
+    loading->ready = false;
+    mBlocks[key] = loading;
+    ++mMisses;
+  }
+
+  RefPointer<Buffer> data = Buffer::make(0, mBlockSize);
+  int32_t length = -1;
+  bool complete = false;
+  if (data)
+    length = loader->loadBlock(offset,
+        (unsigned char*)data->getBytes(0, mBlockSize), mBlockSize, &complete);
+
+  Lock::Guard guard(&mLock);
+  Blocks::iterator it = mBlocks.find(key);
+  Block* loaded = it->second;
+  if (length < 0 || !complete) {
+    // a block cut short by an error is good for this read only; caching
+    // it would end the URL early for everyone after us.
+    mBlocks.erase(it);
+    delete loaded;
+    if (length >= 0)
+      *block = data;
+  } else {
+    loaded->data = data;
+    loaded->length = length;
+    loaded->ready = true;
+    mLRU.push_front(key);
+    loaded->lru = mLRU.begin();
+    mCachedBytes += mBlockSize;
+    *block = data;
+    evict(mMaxBytes);
+  }
+  mLoaded.broadcast();
+  return length;
+}
+
+void
+CachingURLProtocolManager :: dropStale(const char* url, const Version& version)
+{
+  Lock::Guard guard(&mLock);
+  Blocks::iterator it = mBlocks.lower_bound(Key(url, 0));
+  while(it != mBlocks.end() && it->first.first == url) {
+    Blocks::iterator next = it;
+    ++next;
+    // blocks still being read are their reader's to finish
+    if (it->second->ready && it->second->version != version)
+      drop(it);
+    it = next;
+  }
+}
+
+void
+CachingURLProtocolManager :: evict(int64_t maxBytes)
+{
+  // caller holds mLock
+  while(mCachedBytes > maxBytes && !mLRU.empty()) {
+    drop(mBlocks.find(mLRU.back()));
+    ++mEvictions;
+  }
+}
+
+void
+CachingURLProtocolManager :: drop(Blocks::iterator it)
+{
+  // caller holds mLock; only ready blocks are dropped
+  mLRU.erase(it->second->lru);
+  delete it->second;
+  mBlocks.erase(it);
+  mCachedBytes -= mBlockSize;
+}
+
+int64_t
+CachingURLProtocolManager :: getMaxBytes()
+{
+  Lock::Guard guard(&mLock);
+  return mMaxBytes;
+}
+
+void
+CachingURLProtocolManager :: setMaxBytes(int64_t maxBytes)
+{
+  Lock::Guard guard(&mLock);
+  mMaxBytes = maxBytes < 0 ? 0 : maxBytes;
+  evict(mMaxBytes);
+}
+
+int64_t
+CachingURLProtocolManager :: getCachedBytes()
+{
+  Lock::Guard guard(&mLock);
+  return mCachedBytes;
+}
+
+int64_t
+CachingURLProtocolManager :: getHits()
+{
+  Lock::Guard guard(&mLock);
+  return mHits;
+}
+
+int64_t
+CachingURLProtocolManager :: getMisses()
+{
+  Lock::Guard guard(&mLock);
+  return mMisses;
+}
+
+int64_t
+CachingURLProtocolManager :: getWaits()
+{
+  Lock::Guard guard(&mLock);
+  return mWaits;
+}
+
+int64_t
+CachingURLProtocolManager :: getEvictions()
+{
+  Lock::Guard guard(&mLock);
+  return mEvictions;
+}
+
+void
+CachingURLProtocolManager :: resetStatistics()
+{
+  Lock::Guard guard(&mLock);
+  mHits = 0;
+  mMisses = 0;
+  mWaits = 0;
+  mEvictions = 0;
+}
+
+void
+CachingURLProtocolManager :: clear()
+{
+  Lock::Guard guard(&mLock);
+  int64_t evictions = mEvictions;
+  evict(0);
+  // clearing is not evicting
+  mEvictions = evictions;
+}
+}}}}
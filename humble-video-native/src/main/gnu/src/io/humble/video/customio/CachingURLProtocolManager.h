@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef CACHINGURLPROTOCOLMANAGER_H_
+#define CACHINGURLPROTOCOLMANAGER_H_
+
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+
+#include <io/humble/ferry/Buffer.h>
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/customio/URLProtocolManager.h>
+#include <io/humble/video/customio/CachingURLProtocolHandler.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+  /**
+   * A protocol that puts a shared, size-bounded block cache in front of
+   * other URLs.
+   *
+   * Opening "<protocol>:<url>" reads <url> in fixed-size blocks, keyed by
+   * (<url>, offset) and tagged with the size and modification time <url>
+   * had when they were read, which are kept in one least-recently-used cache for
+   * every handler of this manager on every thread. When several threads
+   * miss the same block at once, one reads it and the rest wait for that
+   * read rather than repeating it.
+   *
+   * Blocks are reference counted, so evicting a block another thread is
+   * copying from is safe.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO CachingURLProtocolManager : public URLProtocolManager
+  {
+  public:
+    /** Default size of a cached block: 64 KiB. */
+    static const int32_t DEFAULT_BLOCK_SIZE = 64*1024;
+    /** Default bound on cached data: 64 MiB. */
+    static const int64_t DEFAULT_MAX_BYTES = 64*1024*1024;
+
+    /**
+     * Returns a URLProtocol handler for the given url and flags
+     *
+     * @return a {@link URLProtocolHandler} or NULL if none can be created.
+     */
+    CachingURLProtocolHandler* getHandler(const char* url, int flags);
+
+    /**
+     * Convenience method that creates a CachingURLProtocolManager and registers with the
+     * URLProtocolManager global methods.
+     *
+     * @param aProtocolName The protocol name.
+     * @param maxBytes The most block data to keep cached.
+     * @param blockSize The size of the blocks data is read and cached in.
+     */
+    static CachingURLProtocolManager* registerProtocol(const char *aProtocolName,
+        int64_t maxBytes=DEFAULT_MAX_BYTES,
+        int32_t blockSize=DEFAULT_BLOCK_SIZE);
+
+    /**
+     * What was behind a URL when it was opened. Blocks remember the
+     * version they were read from and are only served to readers who
+     * opened the same version.
+     */
+    struct Version
+    {
+      /** The size of the URL, or -1 if unknown. */
+      int64_t size;
+      /** When a local file was last modified, in nanoseconds, or -1. */
+      int64_t modified;
+      bool operator==(const Version& other) const {
+        return size == other.size && modified == other.modified;
+      }
+      bool operator!=(const Version& other) const { return !(*this == other); }
+    };
+
+    /**
+     * Gets the block of url starting at offset. On a miss the block is
+     * read with loader->loadBlock(), unless another thread is already
+     * reading it, in which case this waits for that thread. A cached
+     * block read from another version of url counts as a miss.
+     *
+     * @param url The underlying URL.
+     * @param offset The start of the block; a multiple of #getBlockSize().
+     * @param version What the caller opened url as.
+     * @param loader The handler to read the block with on a miss.
+     * @param block Set to the block's data.
+     * @return The number of bytes in the block (less than the block size
+     *   only at the end of url, or if a read error cut it short, in which
+     *   case it is not cached), or -1 if it could not be read.
+     */
+    int32_t getBlock(const char* url, int64_t offset, const Version& version,
+        CachingURLProtocolHandler* loader,
+        io::humble::ferry::RefPointer<io::humble::ferry::Buffer>* block);
+
+    /**
+     * Drops the cached blocks of url that were read from a version of it
+     * other than version; called when url is opened.
+     */
+    void dropStale(const char* url, const Version& version);
+
+    int32_t getBlockSize() { return mBlockSize; }
+    int64_t getMaxBytes();
+    /**
+     * Sets the most block data to keep cached, evicting blocks if
+     * more than that is cached now.
+     */
+    void setMaxBytes(int64_t maxBytes);
+    /** @return the bytes of block data cached now. */
+    int64_t getCachedBytes();
+    /** @return the number of blocks served from the cache. */
+    int64_t getHits();
+    /** @return the number of blocks read from underlying URLs. */
+    int64_t getMisses();
+    /** @return the number of misses that waited for another thread's read instead of reading. */
+    int64_t getWaits();
+    /** @return the number of blocks evicted to stay under the size bound. */
+    int64_t getEvictions();
+    /** Zeros the hit, miss, wait and eviction counts. */
+    void resetStatistics();
+    /** Drops every cached block that is not being read. */
+    void clear();
+
+  protected:
+    CachingURLProtocolManager(const char *aProtocolName,
+        int64_t maxBytes, int32_t blockSize);
+    virtual ~CachingURLProtocolManager();
+
+  private:
+    typedef std::pair<std::string, int64_t> Key;
+    struct Block
+    {
+      io::humble::ferry::RefPointer<io::humble::ferry::Buffer> data;
+      int32_t length;
+      Version version;
+      // false while the first thread to miss is reading it
+      bool ready;
+      std::list<Key>::iterator lru;
+    };
+    typedef std::map<Key, Block*> Blocks;
+
+    void evict(int64_t maxBytes);
+    void drop(Blocks::iterator it);
+
+    const int32_t mBlockSize;
+    io::humble::ferry::Lock mLock;
+    io::humble::ferry::Condition mLoaded;
+    Blocks mBlocks;
+    // most recently used at the front; only ready blocks are in here
+    std::list<Key> mLRU;
+    int64_t mMaxBytes;
+    int64_t mCachedBytes;
+    int64_t mHits;
+    int64_t mMisses;
+    int64_t mWaits;
+    int64_t mEvictions;
+  };
+}}}}
+#endif /*CACHINGURLPROTOCOLMANAGER_H_*/
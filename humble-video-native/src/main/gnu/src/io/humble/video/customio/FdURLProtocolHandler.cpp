@@ -0,0 +1,430 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <io/humble/ferry/Logger.h>
+
+#include <io/humble/video/customio/FdURLProtocolHandler.h>
+#include <io/humble/video/customio/FdURLProtocolManager.h>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+
+FdURLProtocolHandler :: FdURLProtocolHandler(
+    FdURLProtocolManager* mgr, bool splice, int32_t batchSize) :
+    URLProtocolHandler(mgr),
+    mCanSplice(splice),
+    mDefaultBatchSize(batchSize)
+{
+  mFd = -1;
+  mWriting = false;
+  mSeekable = false;
+  mSplicing = false;
+  mBuffer = 0;
+  mBufferSize = 0;
+  mBatchSize = 0;
+  mBatchCount = 0;
+  mBatch = 0;
+  mBatchLength = 0;
+}
+
+FdURLProtocolHandler :: ~FdURLProtocolHandler()
+{
+  reset();
+}
+
+void
+FdURLProtocolHandler :: reset()
+{
+  (void) url_close();
+}
+
+int
+FdURLProtocolHandler :: parseDescriptor(const char* url)
+{
+  if (!url)
+    return -1;
+  // The URL MAY contain a protocol string.  Find it now.
+  char proto[256];
+  const char* protocol = URLProtocolManager::parseProtocol(proto, sizeof(proto), url);
+  if (protocol)
+  {
+    size_t protoLen = strlen(protocol);
+    // skip past it
+    url = url + protoLen;
+    if (*url == ':' || *url == ',')
+      ++url;
+  }
+  if (*url < '0' || *url > '9')
+    return -1;
+  char* end = 0;
+  errno = 0;
+  long fd = strtol(url, &end, 10);
+  if (errno || *end || fd != (long)(int)fd)
+    return -1;
+  return (int)fd;
+}
+
+#ifndef _WIN32
+int
+FdURLProtocolHandler :: url_open(const char *url, int flags)
+{
+  reset();
+  int fd = parseDescriptor(url);
+  if (fd < 0)
+    return -1;
+  int status = fcntl(fd, F_GETFL);
+  if (status < 0)
+    return -1;
+  bool writing;
+  switch(flags) {
+    case URLProtocolHandler::URL_RDONLY_MODE:
+      if ((status & O_ACCMODE) == O_WRONLY)
+        return -1;
+      writing = false;
+      break;
+    case URLProtocolHandler::URL_WRONLY_MODE:
+      if ((status & O_ACCMODE) == O_RDONLY)
+        return -1;
+      writing = true;
+      break;
+    default:
+      // batched writes and reads do not mix
+      return -1;
+  }
+  struct stat info;
+  if (fstat(fd, &info) < 0)
+    return -1;
+
+  if (writing) {
+    mBatchSize = mDefaultBatchSize;
+    mBatchCount = 1;
+    mSplicing = false;
+#if defined(__linux__) && defined(F_GETPIPE_SZ)
+    if (mCanSplice && S_ISFIFO(info.st_mode)) {
+      // one batch fills the pipe exactly, so splicing a whole batch in
+      // means the batch before it has been read out.
+      int capacity = fcntl(fd, F_GETPIPE_SZ);
+      if (capacity > 0) {
+        mBatchSize = capacity;
+        mBatchCount = 2;
+        mSplicing = true;
+      }
+    }
+#endif
+    mBufferSize = (int64_t)mBatchSize * mBatchCount;
+    // mapped rather than allocated so the pages are whole and our own
+    void* buffer = mmap(0, (size_t)mBufferSize, PROT_READ|PROT_WRITE,
+        MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (buffer == MAP_FAILED) {
+      VS_LOG_DEBUG("could not map %" PRIi64 " bytes: %s", mBufferSize,
+          strerror(errno));
+      mBufferSize = 0;
+      return -1;
+    }
+    mBuffer = (unsigned char*)buffer;
+    mBatch = 0;
+    mBatchLength = 0;
+  }
+  mFd = fd;
+  mWriting = writing;
+  mSeekable = S_ISREG(info.st_mode);
+  return 0;
+}
+
+int
+FdURLProtocolHandler :: url_close()
+{
+  if (mFd < 0)
+    return -1;
+  int retval = 0;
+  if (mWriting && !flush())
+    retval = -1;
+  // pages still in a pipe stay alive until read; they are just no longer ours.
+  if (mBuffer)
+    (void) munmap(mBuffer, (size_t)mBufferSize);
+  mBuffer = 0;
+  mBufferSize = 0;
+  mBatchSize = 0;
+  mBatchCount = 0;
+  mBatch = 0;
+  mBatchLength = 0;
+  mSplicing = false;
+  mWriting = false;
+  mSeekable = false;
+  // the descriptor belongs to the caller
+  mFd = -1;
+  return retval;
+}
+
+bool
+FdURLProtocolHandler :: waitFor(short events)
+{
+  struct pollfd p;
+  p.fd = mFd;
+  p.events = events;
+  p.revents = 0;
+  int retval;
+  do {
+    retval = poll(&p, 1, -1);
+  } while (retval < 0 && errno == EINTR);
+  return retval > 0 && !(p.revents & (POLLERR|POLLNVAL));
+}
+
+bool
+FdURLProtocolHandler :: writeOut(const unsigned char* data, int64_t length)
+{
+  while (length > 0) {
+    ssize_t written = write(mFd, data, (size_t)length);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      if ((errno == EAGAIN || errno == EWOULDBLOCK) && waitFor(POLLOUT))
+        continue;
+      VS_LOG_DEBUG("could not write to fd %d: %s", mFd, strerror(errno));
+      return false;
+    }
+    data += written;
+    length -= written;
+  }
+  return true;
+}
+
+bool
+FdURLProtocolHandler :: spliceOut(unsigned char* data, int64_t length)
+{
+#if defined(__linux__) && defined(F_GETPIPE_SZ)
+  while (length > 0) {
+    struct iovec iov;
+    iov.iov_base = data;
+    iov.iov_len = (size_t)length;
+    ssize_t spliced = vmsplice(mFd, &iov, 1, 0);
+    if (spliced < 0) {
+      if (errno == EINTR)
+        continue;
+      if (errno == EAGAIN && waitFor(POLLOUT))
+        continue;
+      VS_LOG_DEBUG("could not splice to fd %d: %s", mFd, strerror(errno));
+      return false;
+    }
+    data += spliced;
+    length -= spliced;
+  }
+  return true;
+#else
+  return writeOut(data, length);
+#endif
+}
+
+bool
+FdURLProtocolHandler :: flush()
+{
+  if (!mBatchLength)
+    return true;
+  unsigned char* data = mBuffer + (int64_t)mBatch * mBatchSize;
+  bool retval = mSplicing ? spliceOut(data, mBatchLength) :
+      writeOut(data, mBatchLength);
+  mBatchLength = 0;
+  mBatch = (mBatch + 1) % mBatchCount;
+  return retval;
+}
+
+int
+FdURLProtocolHandler :: url_read(unsigned char* buf, int size)
+{
+  if (mFd < 0 || mWriting || !buf || size < 0)
+    return -1;
+  for(;;) {
+    ssize_t retval = read(mFd, buf, (size_t)size);
+    if (retval >= 0)
+      return (int)retval;
+    if (errno == EINTR)
+      continue;
+    if ((errno == EAGAIN || errno == EWOULDBLOCK) && waitFor(POLLIN))
+      continue;
+    return -1;
+  }
+}
+
+int
+FdURLProtocolHandler :: url_write(const unsigned char* buf, int size)
+{
+  if (mFd < 0 || !mWriting || !buf || size < 0)
+    return -1;
+  unsigned char* tail = mBuffer + (int64_t)mBatch * mBatchSize + mBatchLength;
+  if (buf == tail && size <= mBatchSize - mBatchLength) {
+    // built in memory we lent; nothing to copy
+    mBatchLength += size;
+    if (mBatchLength == mBatchSize && !flush())
+      return -1;
+    return size;
+  }
+  if (!mSplicing && mBatchLength == 0 && size >= mBatchSize)
+    // gathering would not save a call
+    return writeOut(buf, size) ? size : -1;
+
+  int written = 0;
+  while (written < size) {
+    int length = std::min(size - written, mBatchSize - mBatchLength);
+    // buf may be memory we lent before a seek moved the batch on
+    memmove(mBuffer + (int64_t)mBatch * mBatchSize + mBatchLength,
+        buf + written, length);
+    mBatchLength += length;
+    written += length;
+    if (mBatchLength == mBatchSize && !flush())
+      return -1;
+  }
+  return written;
+}
+
+unsigned char*
+FdURLProtocolHandler :: url_write_buffer(int* size)
+{
+  if (mFd < 0 || !mWriting || !size)
+    return 0;
+  *size = mBatchSize - mBatchLength;
+  return mBuffer + (int64_t)mBatch * mBatchSize + mBatchLength;
+}
+
+int64_t
+FdURLProtocolHandler :: url_seek(int64_t position, int whence)
+{
+  if (mFd < 0 || !mSeekable)
+    return -1;
+  if (mWriting && !flush())
+    return -1;
+  if (whence == SK_SEEK_SIZE) {
+    struct stat info;
+    if (fstat(mFd, &info) < 0)
+      return -1;
+    return info.st_size;
+  }
+  int how;
+  switch(whence) {
+    case SK_SEEK_SET:
+      how = SEEK_SET;
+      break;
+    case SK_SEEK_CUR:
+      how = SEEK_CUR;
+      break;
+    case SK_SEEK_END:
+      how = SEEK_END;
+      break;
+    default:
+      return -1;
+  }
+  return lseek(mFd, (off_t)position, how);
+}
+
+URLProtocolHandler::SeekableFlags
+FdURLProtocolHandler :: url_seekflags(const char* url, int)
+{
+  int fd = parseDescriptor(url);
+  struct stat info;
+  if (fd >= 0 && fstat(fd, &info) == 0 && S_ISREG(info.st_mode))
+    return URLProtocolHandler::SK_SEEKABLE_NORMAL;
+  return URLProtocolHandler::SK_NOT_SEEKABLE;
+}
+#else
+int
+FdURLProtocolHandler :: url_open(const char *, int)
+{
+  // no POSIX descriptors here
+  return -1;
+}
+
+int
+FdURLProtocolHandler :: url_close()
+{
+  return -1;
+}
+
+bool
+FdURLProtocolHandler :: waitFor(short)
+{
+  return false;
+}
+
+bool
+FdURLProtocolHandler :: writeOut(const unsigned char*, int64_t)
+{
+  return false;
+}
+
+bool
+FdURLProtocolHandler :: spliceOut(unsigned char*, int64_t)
+{
+  return false;
+}
+
+bool
+FdURLProtocolHandler :: flush()
+{
+  return false;
+}
+
+int
+FdURLProtocolHandler :: url_read(unsigned char*, int)
+{
+  return -1;
+}
+
+int
+FdURLProtocolHandler :: url_write(const unsigned char*, int)
+{
+  return -1;
+}
+
+unsigned char*
+FdURLProtocolHandler :: url_write_buffer(int* size)
+{
+  if (size)
+    *size = 0;
+  return 0;
+}
+
+int64_t
+FdURLProtocolHandler :: url_seek(int64_t, int)
+{
+  return -1;
+}
+
+URLProtocolHandler::SeekableFlags
+FdURLProtocolHandler :: url_seekflags(const char*, int)
+{
+  return URLProtocolHandler::SK_NOT_SEEKABLE;
+}
+#endif // ! _WIN32
+
+}}}}
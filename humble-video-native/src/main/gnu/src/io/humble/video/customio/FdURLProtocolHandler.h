@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef FDURLPROTOCOLHANDLER_H_
+#define FDURLPROTOCOLHANDLER_H_
+
+#include <io/humble/video/customio/URLProtocolHandler.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+  {
+  class FdURLProtocolManager;
+
+  /**
+   * Reads and writes a descriptor the caller already has open, given in
+   * the URL as "fd:" + its number, for example "fd:1". The descriptor is
+   * not closed by #url_close; it belongs to the caller.
+   *
+   * Writes are gathered into large batches rather than making a system call
+   * for every flush FFmpeg makes, and #url_write_buffer lends the batch out
+   * so a Muxer builds its output in place. Batches go out with write(2).
+   *
+   * A protocol registered with splicing on instead moves batches into
+   * pipes with vmsplice(2), which hands the kernel our pages instead of
+   * copying them. Two batches, each the size of the pipe, take turns: once
+   * one batch is wholly in the pipe, nothing of the batch before it can
+   * still be, so that one is safe to fill again. That only holds if
+   * whatever reads the pipe copies the data out with read(2); a reader
+   * that splice(2)s or tee(2)s it onward would keep referencing our pages,
+   * as would enlarging the pipe with F_SETPIPE_SZ while writing. So
+   * splicing is off unless asked for, and the "fd:" protocol Global
+   * registers never splices. Other descriptors (sockets, files) always get
+   * batched write(2)s, since a socket may hold spliced pages long after
+   * the call returns; writes at least a batch long skip the batch and go
+   * straight out.
+   *
+   * Only regular files can seek. Needs POSIX descriptors; vmsplice(2) is
+   * only used on Linux.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO FdURLProtocolHandler : public URLProtocolHandler
+  {
+  public:
+    FdURLProtocolHandler(FdURLProtocolManager* mgr,
+        bool splice, int32_t batchSize);
+    virtual ~FdURLProtocolHandler();
+
+    // Now, let's have our forwarding functions
+    virtual int url_open(const char *url, int flags);
+    virtual int url_close();
+    virtual int url_read(unsigned char* buf, int size);
+    virtual int url_write(const unsigned char* buf, int size);
+    virtual int64_t url_seek(int64_t position, int whence);
+    virtual SeekableFlags url_seekflags(const char* url, int flags);
+    virtual unsigned char* url_write_buffer(int* size);
+
+    /**
+     * Parses the descriptor out of a "fd:" URL.
+     * @return the descriptor, or -1 if url does not name one.
+     */
+    static int parseDescriptor(const char* url);
+
+  private:
+    void reset();
+    bool flush();
+    bool writeOut(const unsigned char* data, int64_t length);
+    bool spliceOut(unsigned char* data, int64_t length);
+    bool waitFor(short events);
+
+    const bool mCanSplice;
+    const int32_t mDefaultBatchSize;
+
+    int mFd;
+    bool mWriting;
+    bool mSeekable;
+    bool mSplicing;
+
+    // mBatchCount batches of mBatchSize bytes, mapped page aligned.
+    unsigned char* mBuffer;
+    int64_t mBufferSize;
+    int32_t mBatchSize;
+    int32_t mBatchCount;
+    // the batch being filled, and how full it is.
+    int32_t mBatch;
+    int32_t mBatchLength;
+  };
+  }}}}
+#endif /*FDURLPROTOCOLHANDLER_H_*/
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/video/customio/FdURLProtocolManager.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+FdURLProtocolManager*
+FdURLProtocolManager :: registerProtocol(const char *aProtocolName,
+    bool splice, int32_t batchSize)
+{
+  FdURLProtocolManager* mgr = new FdURLProtocolManager(aProtocolName,
+      splice, batchSize);
+  return dynamic_cast<FdURLProtocolManager*>(URLProtocolManager::registerProtocol(mgr));
+}
+
+FdURLProtocolManager :: FdURLProtocolManager(
+    const char * aProtocolName, bool splice, int32_t batchSize) :
+    URLProtocolManager(aProtocolName),
+    mSplice(splice),
+    mBatchSize(batchSize > 0 ? batchSize : DEFAULT_BATCH_SIZE)
+{
+}
+
+FdURLProtocolManager :: ~FdURLProtocolManager()
+{
+}
+
+FdURLProtocolHandler *
+FdURLProtocolManager :: getHandler(const char *, int)
+{
+  return new FdURLProtocolHandler(this, mSplice, mBatchSize);
+}
+}}}}
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef FDURLPROTOCOLMANAGER_H_
+#define FDURLPROTOCOLMANAGER_H_
+
+#include <io/humble/video/customio/URLProtocolManager.h>
+#include <io/humble/video/customio/FdURLProtocolHandler.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+  /**
+   * A class for managing a protocol that reads and writes descriptors
+   * the caller has already opened, named in URLs as "fd:" + the number.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO FdURLProtocolManager : public URLProtocolManager
+  {
+  public:
+    /** Default number of bytes gathered before writing to a descriptor that is not a pipe. */
+    static const int32_t DEFAULT_BATCH_SIZE = 64*1024;
+
+    /**
+     * Returns a URLProtocol handler for the given url and flags
+     *
+     * @return a {@link URLProtocolHandler} or NULL if none can be created.
+     */
+    FdURLProtocolHandler* getHandler(const char* url, int flags);
+
+    /**
+     * Convenience method that creates a FdURLProtocolManager and registers with the
+     * URLProtocolManager global methods.
+     *
+     * @param aProtocolName The protocol name.
+     * @param splice If true, output to pipes is moved into the pipe with
+     *   vmsplice(2) rather than copied by write(2). Only turn this on when
+     *   every reader of those pipes copies data out with read(2); see
+     *   FdURLProtocolHandler.
+     * @param batchSize How many bytes to gather before writing to anything
+     *   but a spliced pipe.
+     */
+    static FdURLProtocolManager* registerProtocol(const char *aProtocolName,
+        bool splice=false,
+        int32_t batchSize=DEFAULT_BATCH_SIZE);
+
+  protected:
+    FdURLProtocolManager(const char *aProtocolName,
+        bool splice, int32_t batchSize);
+    virtual ~FdURLProtocolManager();
+
+  private:
+    const bool mSplice;
+    const int32_t mBatchSize;
+  };
+}}}}
+#endif /*FDURLPROTOCOLMANAGER_H_*/
@@ -25,6 +25,7 @@
 #include <io/humble/ferry/JNIHelper.h>
 #include <io/humble/video/customio/FfmpegIO.h>
 #include <io/humble/video/customio/JavaURLProtocolManager.h>
+#include <io/humble/video/customio/JavaURLProtocolHandler.h>
 
 using namespace io::humble::ferry;
 using namespace io::humble::video::customio;
@@ -298,3 +299,9 @@ VS_API_HUMBLE_VIDEO_CUSTOMIO jint VS_API_CALL Java_io_humble_video_customio_Ffmp
   }
   return retval;
 }
+
+VS_API_HUMBLE_VIDEO_CUSTOMIO jlong VS_API_CALL Java_io_humble_video_customio_FfmpegIO_native_1getNumDirectBuffersMade(
+    JNIEnv *, jclass)
+{
+  return JavaURLProtocolHandler::getNumDirectBuffersMade();
+}
@@ -48,6 +48,9 @@ VS_API_HUMBLE_VIDEO_CUSTOMIO jlong VS_API_CALL Java_io_humble_video_customio_Ffm
 VS_API_HUMBLE_VIDEO_CUSTOMIO jint VS_API_CALL Java_io_humble_video_customio_FfmpegIO_native_1url_1close
   (JNIEnv *, jclass, jobject);
 
+VS_API_HUMBLE_VIDEO_CUSTOMIO jlong VS_API_CALL Java_io_humble_video_customio_FfmpegIO_native_1getNumDirectBuffersMade
+  (JNIEnv *, jclass);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,6 +20,7 @@
 #include <stdexcept>
 // For EINTR
 #include <errno.h>
+#include <string.h>
 
 #include <io/humble/ferry/JNIHelper.h>
 #include <io/humble/ferry/Logger.h>
@@ -61,6 +62,9 @@ JavaURLProtocolHandler_CheckException(JNIEnv *env)
     }
   }
 }
+// direct ByteBuffers made by all handlers; bumped atomically
+static int64_t JavaURLProtocolHandler_numDirectBuffersMade = 0;
+
 namespace io { namespace humble { namespace video { namespace customio
 {
 
@@ -68,11 +72,21 @@ JavaURLProtocolHandler :: JavaURLProtocolHandler(
     JavaURLProtocolManager* mgr,
     jobject aJavaProtocolHandler) : URLProtocolHandler(mgr)
 {
+  mJavaProtoHandler = 0;
+  mJavaUrlReadBuffer_mid = 0;
+  mJavaUrlWriteBuffer_mid = 0;
+  mJavaBufferPosition_mid = 0;
+  mJavaBufferLimit_mid = 0;
+  mJavaByteBufferAsReadOnly_mid = 0;
+  memset(&mReadBuffers, 0, sizeof(mReadBuffers));
+  memset(&mWriteBuffers, 0, sizeof(mWriteBuffers));
   cacheJavaMethods(aJavaProtocolHandler);
 }
 
 JavaURLProtocolHandler :: ~JavaURLProtocolHandler()
 {
+  releaseBuffers(&mReadBuffers);
+  releaseBuffers(&mWriteBuffers);
   if (mJavaProtoHandler)
   {
     JNIHelper::sDeleteGlobalRef(mJavaProtoHandler);
@@ -106,6 +120,171 @@ JavaURLProtocolHandler :: cacheJavaMethods(jobject aProtoHandler)
   mJavaUrlIsStreamed_mid = env->GetMethodID(cls, "isStreamed",
       "(Ljava/lang/String;I)Z");
 
+  // If the handler can take ByteBuffers, we hand it direct buffers that
+  // wrap FFmpeg's memory instead of copying through a new byte[] per call.
+  jclass bufferHandlerCls = env->FindClass(
+      "io/humble/video/customio/IURLProtocolByteBufferHandler");
+  if (!bufferHandlerCls)
+    // an older jar; stick with byte arrays
+    env->ExceptionClear();
+  else
+  {
+    if (env->IsInstanceOf(aProtoHandler, bufferHandlerCls))
+    {
+      jclass bufferCls = env->FindClass("java/nio/Buffer");
+      jclass byteBufferCls = env->FindClass("java/nio/ByteBuffer");
+      if (bufferCls && byteBufferCls)
+      {
+        mJavaBufferPosition_mid = env->GetMethodID(bufferCls, "position",
+            "(I)Ljava/nio/Buffer;");
+        mJavaBufferLimit_mid = env->GetMethodID(bufferCls, "limit",
+            "(I)Ljava/nio/Buffer;");
+        mJavaByteBufferAsReadOnly_mid = env->GetMethodID(byteBufferCls,
+            "asReadOnlyBuffer", "()Ljava/nio/ByteBuffer;");
+        mJavaUrlReadBuffer_mid = env->GetMethodID(cls, "read",
+            "(Ljava/nio/ByteBuffer;)I");
+        mJavaUrlWriteBuffer_mid = env->GetMethodID(cls, "write",
+            "(Ljava/nio/ByteBuffer;)I");
+      }
+      if (env->ExceptionCheck() || !mJavaBufferPosition_mid ||
+          !mJavaBufferLimit_mid ||
+          !mJavaByteBufferAsReadOnly_mid)
+      {
+        env->ExceptionClear();
+        mJavaUrlReadBuffer_mid = 0;
+        mJavaUrlWriteBuffer_mid = 0;
+      }
+      if (bufferCls)
+        env->DeleteLocalRef(bufferCls);
+      if (byteBufferCls)
+        env->DeleteLocalRef(byteBufferCls);
+    }
+    env->DeleteLocalRef(bufferHandlerCls);
+  }
+}
+
+int64_t
+JavaURLProtocolHandler :: getNumDirectBuffersMade()
+{
+  return JavaURLProtocolHandler_numDirectBuffersMade;
+}
+
+void
+JavaURLProtocolHandler :: releaseBuffers(DirectBuffers* buffers)
+{
+  if (buffers->region)
+    JNIHelper::sDeleteGlobalRef(buffers->region);
+  if (buffers->staging)
+    JNIHelper::sDeleteGlobalRef(buffers->staging);
+  delete [] buffers->stagingData;
+  memset(buffers, 0, sizeof(*buffers));
+}
+
+jobject
+JavaURLProtocolHandler :: wrap(JNIEnv* env, void* data, int size,
+    bool readOnly)
+{
+  jobject local = env->NewDirectByteBuffer(data, size);
+  JavaURLProtocolHandler_CheckException(env);
+  if (!local)
+    // this JVM does not support direct buffer access from JNI
+    return 0;
+  if (readOnly)
+  {
+    jobject view = env->CallObjectMethod(local, mJavaByteBufferAsReadOnly_mid);
+    env->DeleteLocalRef(local);
+    JavaURLProtocolHandler_CheckException(env);
+    if (!view)
+      return 0;
+    local = view;
+  }
+  jobject retval = env->NewGlobalRef(local);
+  env->DeleteLocalRef(local);
+  if (retval)
+    __sync_fetch_and_add(&JavaURLProtocolHandler_numDirectBuffersMade, 1);
+  return retval;
+}
+
+void
+JavaURLProtocolHandler :: frame(JNIEnv* env, jobject buffer, int position,
+    int size)
+{
+  // limit first, as position may not go past it
+  jobject self = env->CallObjectMethod(buffer, mJavaBufferLimit_mid,
+      position + size);
+  if (self)
+    env->DeleteLocalRef(self);
+  JavaURLProtocolHandler_CheckException(env);
+  self = env->CallObjectMethod(buffer, mJavaBufferPosition_mid, position);
+  if (self)
+    env->DeleteLocalRef(self);
+  JavaURLProtocolHandler_CheckException(env);
+}
+
+jobject
+JavaURLProtocolHandler :: getDirectBuffer(JNIEnv* env, DirectBuffers* buffers,
+    unsigned char* buf, int size, bool readOnly, bool* staged)
+{
+  unsigned char* end = buf + size;
+  unsigned char* regionEnd = buffers->regionData + buffers->regionSize;
+  bool inRegion = buffers->region && buf >= buffers->regionData &&
+      end <= regionEnd;
+  if (!inRegion)
+  {
+    // FFmpeg reads into the rest of its IO buffer, which always ends in
+    // the same place, and writes from its start; memory that shares an
+    // end with the region or with the last call is the IO buffer.
+    bool grows = buffers->region &&
+        (buf == buffers->regionData || end == regionEnd);
+    bool moved = !buffers->region ||
+        buf == buffers->lastStart || end == buffers->lastEnd;
+    if (grows || moved)
+    {
+      unsigned char* data = buf;
+      int dataSize = size;
+      if (grows && buffers->regionSize > size)
+      {
+        data = buffers->regionData;
+        dataSize = buffers->regionSize;
+      }
+      if (buffers->region)
+        JNIHelper::sDeleteGlobalRef(buffers->region);
+      buffers->region = wrap(env, data, dataSize, readOnly);
+      buffers->regionData = buffers->region ? data : 0;
+      buffers->regionSize = buffers->region ? dataSize : 0;
+      inRegion = buffers->region && buf >= buffers->regionData &&
+          end <= buffers->regionData + buffers->regionSize;
+    }
+  }
+  buffers->lastStart = buf;
+  buffers->lastEnd = end;
+  if (inRegion)
+  {
+    *staged = false;
+    frame(env, buffers->region, (int)(buf - buffers->regionData), size);
+    return buffers->region;
+  }
+
+  if (!buffers->staging || buffers->stagingSize < size)
+  {
+    int stagingSize = size > buffers->stagingSize*2 ? size :
+        buffers->stagingSize*2;
+    if (buffers->staging)
+      JNIHelper::sDeleteGlobalRef(buffers->staging);
+    delete [] buffers->stagingData;
+    buffers->staging = 0;
+    buffers->stagingSize = 0;
+    buffers->stagingData = new unsigned char[stagingSize];
+    buffers->staging = wrap(env, buffers->stagingData, stagingSize, readOnly);
+    if (!buffers->staging)
+      return 0;
+    buffers->stagingSize = stagingSize;
+  }
+  *staged = true;
+  if (readOnly)
+    memcpy(buffers->stagingData, buf, size);
+  frame(env, buffers->staging, 0, size);
+  return buffers->staging;
 }
 
 int
@@ -157,6 +336,9 @@ JavaURLProtocolHandler :: url_close()
     JavaURLProtocolHandler_CheckException(env);
     retval = env->CallIntMethod(mJavaProtoHandler, mJavaUrlClose_mid);
     JavaURLProtocolHandler_CheckException(env);
+    // FFmpeg frees its IO buffer after a close, so don't keep wrapping it.
+    releaseBuffers(&mReadBuffers);
+    releaseBuffers(&mWriteBuffers);
   }
   catch (std::exception & e)
   {
@@ -217,20 +399,39 @@ JavaURLProtocolHandler :: url_read(unsigned char* buf, int size)
   try
   {
     JavaURLProtocolHandler_CheckException(env);
-    byteArray = env->NewByteArray(size);
-    JavaURLProtocolHandler_CheckException(env);
-    // read into the Java byte array
-    if (byteArray)
+    jobject directBuffer = 0;
+    bool staged = false;
+    if (mJavaUrlReadBuffer_mid)
+      directBuffer = getDirectBuffer(env, &mReadBuffers, buf, size, false,
+          &staged);
+    if (directBuffer)
     {
-      retval = env->CallIntMethod(mJavaProtoHandler, mJavaUrlRead_mid,
-          byteArray, size);
+      // Java reads straight into FFmpeg's buffer, unless it was staged.
+      retval = env->CallIntMethod(mJavaProtoHandler, mJavaUrlReadBuffer_mid,
+          directBuffer);
       JavaURLProtocolHandler_CheckException(env);
+      if (retval > size)
+        throw std::runtime_error("java handler read more than it was given");
+      if (staged && retval > 0)
+        memcpy(buf, mReadBuffers.stagingData, retval);
     }
-    // now, copy into the C array, but only up to retval.
-    if (retval > 0)
+    else
     {
-      env->GetByteArrayRegion(byteArray, 0, retval, (jbyte*)buf);
+      byteArray = env->NewByteArray(size);
       JavaURLProtocolHandler_CheckException(env);
+      // read into the Java byte array
+      if (byteArray)
+      {
+        retval = env->CallIntMethod(mJavaProtoHandler, mJavaUrlRead_mid,
+            byteArray, size);
+        JavaURLProtocolHandler_CheckException(env);
+      }
+      // now, copy into the C array, but only up to retval.
+      if (retval > 0)
+      {
+        env->GetByteArrayRegion(byteArray, 0, retval, (jbyte*)buf);
+        JavaURLProtocolHandler_CheckException(env);
+      }
     }
   }
   catch (std::exception& e)
@@ -264,19 +465,34 @@ JavaURLProtocolHandler :: url_write(const unsigned char* buf, int size)
   try
   {
     JavaURLProtocolHandler_CheckException(env);
-    byteArray = env->NewByteArray(size);
-    JavaURLProtocolHandler_CheckException(env);
-
-    // copy the data passed into the new java byteArray
-    if (byteArray)
+    jobject directBuffer = 0;
+    bool staged = false;
+    if (mJavaUrlWriteBuffer_mid)
+      // read-only so Java cannot scribble on FFmpeg's buffer
+      directBuffer = getDirectBuffer(env, &mWriteBuffers,
+          (unsigned char*)buf, size, true, &staged);
+    if (directBuffer)
     {
-      env->SetByteArrayRegion(byteArray, 0, size, (jbyte*)buf);
+      retval = env->CallIntMethod(mJavaProtoHandler, mJavaUrlWriteBuffer_mid,
+          directBuffer);
       JavaURLProtocolHandler_CheckException(env);
-
-      // write from the Java byte array
-      retval = env->CallIntMethod(mJavaProtoHandler, mJavaUrlWrite_mid,
-          byteArray, size);
+    }
+    else
+    {
+      byteArray = env->NewByteArray(size);
       JavaURLProtocolHandler_CheckException(env);
+
+      // copy the data passed into the new java byteArray
+      if (byteArray)
+      {
+        env->SetByteArrayRegion(byteArray, 0, size, (jbyte*)buf);
+        JavaURLProtocolHandler_CheckException(env);
+
+        // write from the Java byte array
+        retval = env->CallIntMethod(mJavaProtoHandler, mJavaUrlWrite_mid,
+            byteArray, size);
+        JavaURLProtocolHandler_CheckException(env);
+      }
     }
   }
   catch (std::exception & e)
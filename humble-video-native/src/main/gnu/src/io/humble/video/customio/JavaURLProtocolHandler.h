@@ -42,8 +42,43 @@ namespace io { namespace humble { namespace video { namespace customio
     int64_t url_seek(int64_t position, int whence);
     SeekableFlags url_seekflags(const char* url, int flags);
 
+    /**
+     * @return the number of direct ByteBuffers made by all handlers so far;
+     *   for testing how well they are reused.
+     */
+    static int64_t getNumDirectBuffersMade();
+
   private:
+    /**
+     * The direct buffers for one direction: one wrapping FFmpeg's IO
+     * buffer, and one wrapping memory of our own for calls on any other
+     * memory, copied to or from.
+     */
+    struct DirectBuffers
+    {
+      jobject region;
+      unsigned char* regionData;
+      int regionSize;
+      jobject staging;
+      unsigned char* stagingData;
+      int stagingSize;
+      // the memory the last call was on
+      unsigned char* lastStart;
+      unsigned char* lastEnd;
+    };
     void cacheJavaMethods(jobject aProtoHandler);
+    void releaseBuffers(DirectBuffers* buffers);
+    /**
+     * Returns a direct java.nio.ByteBuffer whose position and limit frame
+     * size bytes: either buf itself, when buf is within FFmpeg's IO buffer,
+     * or the start of the staging memory, in which case *staged is set and
+     * the caller copies between it and buf. Buffers are only made again
+     * when the IO buffer moves or the staging memory is too small.
+     */
+    jobject getDirectBuffer(JNIEnv* env, DirectBuffers* buffers,
+        unsigned char* buf, int size, bool readOnly, bool* staged);
+    jobject wrap(JNIEnv* env, void* data, int size, bool readOnly);
+    void frame(JNIEnv* env, jobject buffer, int position, int size);
     jobject mJavaProtoHandler;
     jmethodID mJavaUrlOpen_mid;
     jmethodID mJavaUrlClose_mid;
@@ -52,6 +87,15 @@ namespace io { namespace humble { namespace video { namespace customio
     jmethodID mJavaUrlSeek_mid;
     jmethodID mJavaUrlIsStreamed_mid;
 
+    // Only set if the handler is an IURLProtocolByteBufferHandler
+    jmethodID mJavaUrlReadBuffer_mid;
+    jmethodID mJavaUrlWriteBuffer_mid;
+    jmethodID mJavaBufferPosition_mid;
+    jmethodID mJavaBufferLimit_mid;
+    jmethodID mJavaByteBufferAsReadOnly_mid;
+    DirectBuffers mReadBuffers;
+    DirectBuffers mWriteBuffers;
+
   };
   }}}}
 #endif /*JAVAURLPROTOCOLHANDLER_H_*/
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include <io/humble/ferry/Logger.h>
+
+#include <io/humble/video/customio/MemoryURLProtocolHandler.h>
+#include <io/humble/video/customio/MemoryURLProtocolManager.h>
+
+using namespace io::humble::ferry;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+
+// Buffers hold at most 2GB
+static const int64_t MemoryURLProtocolHandler_MAX_OUTPUT = 0x7FFFFFFF;
+
+MemoryURLProtocolHandler :: MemoryURLProtocolHandler(
+    MemoryURLProtocolManager* mgr) : URLProtocolHandler(mgr)
+{
+  mOpen = false;
+  mFlags = URL_RDONLY_MODE;
+  mPosition = 0;
+  mSize = 0;
+  mCurrent = 0;
+  mOutput = 0;
+  mCapacity = 0;
+}
+
+MemoryURLProtocolHandler :: ~MemoryURLProtocolHandler()
+{
+  reset();
+}
+
+void
+MemoryURLProtocolHandler :: reset()
+{
+  (void) url_close();
+}
+
+int
+MemoryURLProtocolHandler :: url_open(const char *url, int flags)
+{
+  if (!url || !*url)
+    return -1;
+  reset();
+  if (flags != URL_RDONLY_MODE && flags != URL_WRONLY_MODE)
+    return -1;
+
+  // The URL MAY contain a protocol string.  Find it now.
+  char proto[256];
+  const char* protocol = URLProtocolManager::parseProtocol(proto, sizeof(proto), url);
+  if (protocol)
+  {
+    size_t protoLen = strlen(protocol);
+    // skip past it
+    url = url + protoLen;
+    if (*url == ':' || *url == ',')
+      ++url;
+  }
+  MemoryURLProtocolManager* mgr =
+      dynamic_cast<MemoryURLProtocolManager*>(getProtocolManager());
+  if (!mgr)
+    return -1;
+
+  if (flags == URL_RDONLY_MODE) {
+    if (!mgr->getSource(url, &mSources))
+      return -1;
+    mStarts.resize(mSources.size());
+    for(size_t i = 0; i < mSources.size(); i++) {
+      mStarts[i] = mSize;
+      mSize += mSources[i]->getBufferSize();
+    }
+  }
+  mName = url;
+  mFlags = flags;
+  mOpen = true;
+  return 0;
+}
+
+int
+MemoryURLProtocolHandler :: url_close()
+{
+  if (!mOpen)
+    return -1;
+  int retval = 0;
+  if (mFlags == URL_WRONLY_MODE) {
+    MemoryURLProtocolManager* mgr =
+        dynamic_cast<MemoryURLProtocolManager*>(getProtocolManager());
+    RefPointer<Buffer> output;
+    if (mSize > 0) {
+      // hand our buffer over as is; the Buffer frees it.
+      output = Buffer::make(0, mOutput, (int32_t)mSize, freeOutput, 0);
+      if (output)
+        mOutput = 0;
+    }
+    if (mgr && (output || mSize == 0))
+      mgr->putOutput(mName.c_str(), output.value());
+    else
+      retval = -1;
+    free(mOutput);
+    mOutput = 0;
+    mCapacity = 0;
+  }
+  mSources.clear();
+  mStarts.clear();
+  mCurrent = 0;
+  mPosition = 0;
+  mSize = 0;
+  mOpen = false;
+  return retval;
+}
+
+int
+MemoryURLProtocolHandler :: url_read(unsigned char* buf, int size)
+{
+  if (!mOpen || mFlags != URL_RDONLY_MODE || !buf || size < 0)
+    return -1;
+  int retval = 0;
+  while (retval < size && mPosition < mSize) {
+    // reads are mostly sequential, so try where the last one ended first
+    if (mCurrent >= mStarts.size() || mPosition < mStarts[mCurrent] ||
+        mPosition >= mStarts[mCurrent] + mSources[mCurrent]->getBufferSize())
+      mCurrent = std::upper_bound(mStarts.begin(), mStarts.end(), mPosition) -
+          mStarts.begin() - 1;
+    Buffer* source = mSources[mCurrent].value();
+    int32_t offset = (int32_t)(mPosition - mStarts[mCurrent]);
+    int32_t length = std::min(source->getBufferSize() - offset, size - retval);
+    unsigned char* data = (unsigned char*)source->getBytes(offset, length);
+    if (!data)
+      return retval > 0 ? retval : -1;
+    memcpy(buf + retval, data, length);
+    retval += length;
+    mPosition += length;
+  }
+  return retval;
+}
+
+bool
+MemoryURLProtocolHandler :: reserve(int64_t capacity)
+{
+  if (capacity <= mCapacity)
+    return true;
+  if (capacity > MemoryURLProtocolHandler_MAX_OUTPUT)
+    return false;
+  int64_t newCapacity = std::max(mCapacity*2, (int64_t)64*1024);
+  newCapacity = std::min(std::max(newCapacity, capacity), MemoryURLProtocolHandler_MAX_OUTPUT);
+  unsigned char* output = (unsigned char*)realloc(mOutput, (size_t)newCapacity);
+  if (!output)
+    return false;
+  mOutput = output;
+  mCapacity = newCapacity;
+  return true;
+}
+
+int
+MemoryURLProtocolHandler :: url_write(const unsigned char* buf, int size)
+{
+  if (!mOpen || mFlags != URL_WRONLY_MODE || !buf || size < 0)
+    return -1;
+  if (!reserve(mPosition + size)) {
+    VS_LOG_ERROR("could not grow memory output to %" PRIi64 " bytes",
+        mPosition + size);
+    return -1;
+  }
+  // zero any gap left by seeking past the end
+  if (mPosition > mSize)
+    memset(mOutput + mSize, 0, (size_t)(mPosition - mSize));
+  memcpy(mOutput + mPosition, buf, size);
+  mPosition += size;
+  mSize = std::max(mSize, mPosition);
+  return size;
+}
+
+int64_t
+MemoryURLProtocolHandler :: url_seek(int64_t position,
+    int whence)
+{
+  if (!mOpen)
+    return -1;
+
+  int64_t newPosition;
+  switch(whence) {
+    case SK_SEEK_SET:
+      newPosition = position;
+      break;
+    case SK_SEEK_CUR:
+      newPosition = mPosition + position;
+      break;
+    case SK_SEEK_END:
+      newPosition = mSize + position;
+      break;
+    case SK_SEEK_SIZE:
+      return mSize;
+    default:
+      return -1;
+  }
+  if (newPosition < 0)
+    return -1;
+  mPosition = newPosition;
+  return mPosition;
+}
+
+URLProtocolHandler::SeekableFlags
+MemoryURLProtocolHandler :: url_seekflags( const char*, int)
+{
+  return URLProtocolHandler::SK_SEEKABLE_NORMAL;
+}
+
+void
+MemoryURLProtocolHandler :: freeOutput(void* mem, void*)
+{
+  free(mem);
+}
+
+}}}}
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef MEMORYURLPROTOCOLHANDLER_H_
+#define MEMORYURLPROTOCOLHANDLER_H_
+
+#include <string>
+#include <vector>
+
+#include <io/humble/ferry/Buffer.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/customio/URLProtocolHandler.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+  {
+  class MemoryURLProtocolManager;
+
+  /**
+   * Reads from Buffers added to a MemoryURLProtocolManager, or writes
+   * into a growable native buffer the manager keeps when the handler
+   * closes.
+   *
+   * Reads copy straight from the source Buffers into FFmpeg's IO buffer;
+   * there are no file system or Java calls. Read-write mode is not
+   * supported.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO MemoryURLProtocolHandler : public URLProtocolHandler
+  {
+  public:
+    MemoryURLProtocolHandler(MemoryURLProtocolManager* mgr);
+    virtual ~MemoryURLProtocolHandler();
+
+    // Now, let's have our forwarding functions
+    virtual int url_open(const char *url, int flags);
+    virtual int url_close();
+    virtual int url_read(unsigned char* buf, int size);
+    virtual int url_write(const unsigned char* buf, int size);
+    virtual int64_t url_seek(int64_t position, int whence);
+    virtual SeekableFlags url_seekflags(const char* url, int flags);
+
+  private:
+    void reset();
+    bool reserve(int64_t capacity);
+    static void freeOutput(void* mem, void* closure);
+
+    bool mOpen;
+    int mFlags;
+    std::string mName;
+    int64_t mPosition;
+    int64_t mSize;
+
+    // reading: the source buffers and where each starts in the stream.
+    std::vector<io::humble::ferry::RefPointer<io::humble::ferry::Buffer> > mSources;
+    std::vector<int64_t> mStarts;
+    // the source buffer the last read ended in.
+    size_t mCurrent;
+
+    // writing
+    unsigned char* mOutput;
+    int64_t mCapacity;
+  };
+  }}}}
+#endif /*MEMORYURLPROTOCOLHANDLER_H_*/
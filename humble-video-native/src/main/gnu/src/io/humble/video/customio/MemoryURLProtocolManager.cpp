@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/video/customio/MemoryURLProtocolManager.h>
+
+using namespace io::humble::ferry;
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+MemoryURLProtocolManager*
+MemoryURLProtocolManager :: registerProtocol(const char *aProtocolName)
+{
+  MemoryURLProtocolManager* mgr = new MemoryURLProtocolManager(aProtocolName);
+  return dynamic_cast<MemoryURLProtocolManager*>(URLProtocolManager::registerProtocol(mgr));
+}
+
+MemoryURLProtocolManager :: MemoryURLProtocolManager(
+    const char * aProtocolName) : URLProtocolManager(aProtocolName)
+{
+}
+
+MemoryURLProtocolManager :: ~MemoryURLProtocolManager()
+{
+}
+
+MemoryURLProtocolHandler *
+MemoryURLProtocolManager :: getHandler(const char *, int)
+{
+  return new MemoryURLProtocolHandler(this);
+}
+
+void
+MemoryURLProtocolManager :: addSource(const char* name, Buffer* buffer)
+{
+  if (!name || !buffer)
+    return;
+  Lock::Guard g(&mLock);
+  Buffers& buffers = mSources[name];
+  buffers.push_back(RefPointer<Buffer>());
+  buffers.back().reset(buffer, true);
+}
+
+bool
+MemoryURLProtocolManager :: removeSource(const char* name)
+{
+  if (!name)
+    return false;
+  Lock::Guard g(&mLock);
+  return mSources.erase(name) > 0;
+}
+
+bool
+MemoryURLProtocolManager :: getSource(const char* name, Buffers* buffers)
+{
+  if (!name || !buffers)
+    return false;
+  Lock::Guard g(&mLock);
+  std::map<std::string, Buffers>::iterator it = mSources.find(name);
+  if (it == mSources.end())
+    return false;
+  *buffers = it->second;
+  return true;
+}
+
+Buffer*
+MemoryURLProtocolManager :: takeOutput(const char* name)
+{
+  if (!name)
+    return 0;
+  Lock::Guard g(&mLock);
+  std::map<std::string, RefPointer<Buffer> >::iterator it = mOutputs.find(name);
+  if (it == mOutputs.end())
+    return 0;
+  Buffer* retval = it->second.get();
+  mOutputs.erase(it);
+  return retval;
+}
+
+void
+MemoryURLProtocolManager :: putOutput(const char* name, Buffer* output)
+{
+  if (!name)
+    return;
+  Lock::Guard g(&mLock);
+  if (output)
+    mOutputs[name].reset(output, true);
+  else
+    mOutputs.erase(name);
+}
+}}}}
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef MEMORYURLPROTOCOLMANAGER_H_
+#define MEMORYURLPROTOCOLMANAGER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <io/humble/ferry/Buffer.h>
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/video/customio/URLProtocolManager.h>
+#include <io/humble/video/customio/MemoryURLProtocolHandler.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+  /**
+   * A protocol that reads from and writes to memory instead of files.
+   *
+   * Data added with {@link #addSource} under a name is read back by
+   * opening "<protocol>:<name>". Opening "<protocol>:<name>" for writing
+   * collects everything written in one growable native buffer, which
+   * {@link #takeOutput} hands back as a Buffer once the writer closes.
+   *
+   * The source and output tables are shared by every thread; handlers
+   * take their own references to the source buffers when they open,
+   * so removing or replacing a source does not affect open readers.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO MemoryURLProtocolManager : public URLProtocolManager
+  {
+  public:
+    /**
+     * Returns a URLProtocol handler for the given url and flags
+     *
+     * @return a {@link URLProtocolHandler} or NULL if none can be created.
+     */
+    MemoryURLProtocolHandler* getHandler(const char* url, int flags);
+
+    /**
+     * Convenience method that creates a MemoryURLProtocolManager and registers with the
+     * URLProtocolManager global methods.
+     */
+    static MemoryURLProtocolManager* registerProtocol(const char *aProtocolName);
+
+    /**
+     * Appends buffer to the data read from "<protocol>:<name>". Readers
+     * see all the buffers added under a name as one contiguous stream, in
+     * the order they were added.
+     *
+     * @param name The name, without the protocol, to read it back as.
+     * @param buffer The data. A reference is held until the source is removed.
+     */
+    void addSource(const char* name, io::humble::ferry::Buffer* buffer);
+
+    /**
+     * Forgets the source for name.
+     *
+     * @return true if there was one.
+     */
+    bool removeSource(const char* name);
+
+    /**
+     * Takes the data written to name the last time a writer of name closed,
+     * and forgets it.
+     *
+     * @return The data, or NULL if nothing has been written. The caller
+     *   must release it.
+     */
+    io::humble::ferry::Buffer* takeOutput(const char* name);
+
+    /**
+     * Copies the buffers added under name into buffers.
+     *
+     * @return false if there is no source called name.
+     */
+    bool getSource(const char* name,
+        std::vector<io::humble::ferry::RefPointer<io::humble::ferry::Buffer> >* buffers);
+
+    /**
+     * Stores output as the data written to name, replacing any earlier output.
+     */
+    void putOutput(const char* name, io::humble::ferry::Buffer* output);
+
+  protected:
+    MemoryURLProtocolManager(const char *aProtocolName);
+    virtual ~MemoryURLProtocolManager();
+
+  private:
+    typedef std::vector<io::humble::ferry::RefPointer<io::humble::ferry::Buffer> > Buffers;
+    io::humble::ferry::Lock mLock;
+    std::map<std::string, Buffers> mSources;
+    std::map<std::string, io::humble::ferry::RefPointer<io::humble::ferry::Buffer> > mOutputs;
+  };
+}}}}
+#endif /*MEMORYURLPROTOCOLMANAGER_H_*/
@@ -0,0 +1,244 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <io/humble/ferry/Logger.h>
+
+#include <io/humble/video/customio/MmapURLProtocolHandler.h>
+#include <io/humble/video/customio/MmapURLProtocolManager.h>
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+
+// How much of a file we map at once. Large enough that remapping is rare,
+// small enough to fit any address space.
+static const int64_t MmapURLProtocolHandler_WINDOW_SIZE = 64*1024*1024;
+
+MmapURLProtocolHandler :: MmapURLProtocolHandler(
+    MmapURLProtocolManager* mgr) : URLProtocolHandler(mgr)
+{
+  mFile = -1;
+  mSize = 0;
+  mPosition = 0;
+  mWindow = 0;
+  mWindowStart = 0;
+  mWindowSize = 0;
+}
+
+MmapURLProtocolHandler :: ~MmapURLProtocolHandler()
+{
+  reset();
+}
+
+void
+MmapURLProtocolHandler :: reset()
+{
+  (void) url_close();
+}
+
+#ifndef _WIN32
+int
+MmapURLProtocolHandler :: url_open(const char *url, int flags)
+{
+  if (!url || !*url)
+    return -1;
+  reset();
+  if (flags != URLProtocolHandler::URL_RDONLY_MODE)
+    return -1;
+
+  // The URL MAY contain a protocol string.  Find it now.
+  char proto[256];
+  const char* protocol = URLProtocolManager::parseProtocol(proto, sizeof(proto), url);
+  if (protocol)
+  {
+    size_t protoLen = strlen(protocol);
+    // skip past it
+    url = url + protoLen;
+    if (*url == ':' || *url == ',')
+      ++url;
+  }
+  mFile = open(url, O_RDONLY);
+  if (mFile < 0)
+    return -1;
+  struct stat info;
+  if (fstat(mFile, &info) < 0 || !S_ISREG(info.st_mode)) {
+    reset();
+    return -1;
+  }
+  mSize = info.st_size;
+#ifdef POSIX_FADV_SEQUENTIAL
+  (void) posix_fadvise(mFile, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+  return 0;
+}
+
+int
+MmapURLProtocolHandler :: url_close()
+{
+  if (mFile < 0)
+    return -1;
+  unmapWindow();
+  int retval = close(mFile);
+  mFile = -1;
+  mSize = 0;
+  mPosition = 0;
+  return retval;
+}
+
+bool
+MmapURLProtocolHandler :: mapWindow(int64_t position)
+{
+  unmapWindow();
+  static const int64_t pageSize = sysconf(_SC_PAGESIZE);
+  int64_t start = position - position % pageSize;
+  int64_t size = std::min(MmapURLProtocolHandler_WINDOW_SIZE, mSize - start);
+  if (size <= 0)
+    return false;
+  void* window = mmap(0, (size_t)size, PROT_READ, MAP_SHARED, mFile,
+      (off_t)start);
+  if (window == MAP_FAILED) {
+    VS_LOG_DEBUG("could not map %" PRIi64 " bytes at %" PRIi64 ": %s",
+        size, start, strerror(errno));
+    return false;
+  }
+  // we mostly read straight through, so have the kernel read ahead
+  (void) madvise(window, (size_t)size, MADV_SEQUENTIAL);
+  (void) madvise(window, (size_t)size, MADV_WILLNEED);
+  mWindow = (unsigned char*)window;
+  mWindowStart = start;
+  mWindowSize = size;
+  return true;
+}
+
+void
+MmapURLProtocolHandler :: unmapWindow()
+{
+  if (mWindow)
+    (void) munmap(mWindow, (size_t)mWindowSize);
+  mWindow = 0;
+  mWindowStart = 0;
+  mWindowSize = 0;
+}
+
+int
+MmapURLProtocolHandler :: url_read(unsigned char* buf, int size)
+{
+  if (mFile < 0 || !buf || size < 0)
+    return -1;
+  int retval = 0;
+  while (retval < size && mPosition < mSize) {
+    if (!mWindow || mPosition < mWindowStart ||
+        mPosition >= mWindowStart + mWindowSize)
+      if (!mapWindow(mPosition))
+        return retval > 0 ? retval : -1;
+    int64_t available = mWindowStart + mWindowSize - mPosition;
+    int length = (int)std::min(available, (int64_t)(size - retval));
+    memcpy(buf + retval, mWindow + (mPosition - mWindowStart), length);
+    retval += length;
+    mPosition += length;
+  }
+  return retval;
+}
+#else
+int
+MmapURLProtocolHandler :: url_open(const char *, int)
+{
+  // no mmap(2) here
+  return -1;
+}
+
+int
+MmapURLProtocolHandler :: url_close()
+{
+  return -1;
+}
+
+bool
+MmapURLProtocolHandler :: mapWindow(int64_t)
+{
+  return false;
+}
+
+void
+MmapURLProtocolHandler :: unmapWindow()
+{
+}
+
+int
+MmapURLProtocolHandler :: url_read(unsigned char*, int)
+{
+  return -1;
+}
+#endif // ! _WIN32
+
+int
+MmapURLProtocolHandler :: url_write(const unsigned char*, int)
+{
+  // read only
+  return -1;
+}
+
+int64_t
+MmapURLProtocolHandler :: url_seek(int64_t position,
+    int whence)
+{
+  if (mFile < 0)
+    return -1;
+
+  int64_t newPosition;
+  switch(whence) {
+    case SK_SEEK_SET:
+      newPosition = position;
+      break;
+    case SK_SEEK_CUR:
+      newPosition = mPosition + position;
+      break;
+    case SK_SEEK_END:
+      newPosition = mSize + position;
+      break;
+    case SK_SEEK_SIZE:
+      return mSize;
+    default:
+      return -1;
+  }
+  if (newPosition < 0)
+    return -1;
+  mPosition = newPosition;
+  return mPosition;
+}
+
+URLProtocolHandler::SeekableFlags
+MmapURLProtocolHandler :: url_seekflags( const char*, int)
+{
+  return URLProtocolHandler::SK_SEEKABLE_NORMAL;
+}
+
+}}}}
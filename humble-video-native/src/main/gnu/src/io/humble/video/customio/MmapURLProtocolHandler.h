@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef MMAPURLPROTOCOLHANDLER_H_
+#define MMAPURLPROTOCOLHANDLER_H_
+
+#include <io/humble/video/customio/URLProtocolHandler.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+  {
+  class MmapURLProtocolManager;
+
+  /**
+   * Reads local files by mapping them into memory, rather than with
+   * buffered stdio.
+   *
+   * Each read is one copy from the mapping into FFmpeg's IO buffer with no
+   * system call. Files are mapped a window at a time so huge files do not
+   * need huge address ranges, and each window is advised as sequential and
+   * needed soon so the kernel reads ahead.
+   *
+   * Only reading is supported, and only where mmap(2) is available. Do not
+   * truncate a file while it is open this way; touching the lost pages
+   * raises SIGBUS.
+   */
+  class VS_API_HUMBLE_VIDEO_CUSTOMIO MmapURLProtocolHandler : public URLProtocolHandler
+  {
+  public:
+    MmapURLProtocolHandler(MmapURLProtocolManager* mgr);
+    virtual ~MmapURLProtocolHandler();
+
+    // Now, let's have our forwarding functions
+    virtual int url_open(const char *url, int flags);
+    virtual int url_close();
+    virtual int url_read(unsigned char* buf, int size);
+    virtual int url_write(const unsigned char* buf, int size);
+    virtual int64_t url_seek(int64_t position, int whence);
+    virtual SeekableFlags url_seekflags(const char* url, int flags);
+
+  private:
+    void reset();
+    bool mapWindow(int64_t position);
+    void unmapWindow();
+
+    int mFile;
+    int64_t mSize;
+    int64_t mPosition;
+
+    unsigned char* mWindow;
+    int64_t mWindowStart;
+    int64_t mWindowSize;
+  };
+  }}}}
+#endif /*MMAPURLPROTOCOLHANDLER_H_*/
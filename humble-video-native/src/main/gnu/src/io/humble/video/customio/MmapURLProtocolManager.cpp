@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/video/customio/MmapURLProtocolManager.h>
+
+namespace io { namespace humble { namespace video { namespace customio
+{
+MmapURLProtocolManager*
+MmapURLProtocolManager :: registerProtocol(const char *aProtocolName)
+{
+  MmapURLProtocolManager* mgr = new MmapURLProtocolManager(aProtocolName);
+  return dynamic_cast<MmapURLProtocolManager*>(URLProtocolManager::registerProtocol(mgr));
+}
+
+MmapURLProtocolManager :: MmapURLProtocolManager(
+    const char * aProtocolName) : URLProtocolManager(aProtocolName)
+{
+}
+
+MmapURLProtocolManager :: ~MmapURLProtocolManager()
+{
+}
+
+MmapURLProtocolHandler *
+MmapURLProtocolManager :: getHandler(const char *, int)
+{
+  return new MmapURLProtocolHandler(this);
+}
+}}}}
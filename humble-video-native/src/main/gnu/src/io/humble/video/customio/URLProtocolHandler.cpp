@@ -43,4 +43,12 @@ URLProtocolHandler :: getProtocolName()
   return retval;
 }
 
+unsigned char*
+URLProtocolHandler :: url_write_buffer(int* size)
+{
+  if (size)
+    *size = 0;
+  return 0;
+}
+
 }}}}
@@ -58,6 +58,18 @@ namespace io { namespace humble { namespace video { namespace customio
     virtual int64_t url_seek(int64_t position, int whence)=0;
     virtual SeekableFlags url_seekflags(const char* url, int flags)=0;
 
+    /**
+     * Optional. Lends the caller memory to build its next write in, so that
+     * #url_write can take the data where it already is instead of copying it.
+     * A caller that uses the memory passes its start to #url_write, and asks
+     * again before writing more. Pointers to memory lent before are no
+     * longer valid once #url_write returns.
+     *
+     * @param size Set to how many bytes may be written at the returned address.
+     * @return the memory, or null (the default) if the handler has none to lend.
+     */
+    virtual unsigned char* url_write_buffer(int* size);
+
   protected:
     URLProtocolHandler(
         URLProtocolManager* mgr);
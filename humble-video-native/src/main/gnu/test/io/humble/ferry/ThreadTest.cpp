@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <io/humble/ferry/Thread.h>
+#include "ThreadTest.h"
+
+using namespace VS_CPP_NAMESPACE;
+
+namespace {
+class CountingThread : public Thread
+{
+public:
+  CountingThread() : mCount(0), mRanOnSelf(false) {}
+  virtual ~CountingThread() {}
+  int32_t mCount;
+  bool mRanOnSelf;
+  Lock mLock;
+  Condition mDone;
+protected:
+  virtual void run() {
+    Lock::Guard g(&mLock);
+    ++mCount;
+    mRanOnSelf = isCurrentThread() && Thread::current() == this;
+    mDone.broadcast();
+  }
+};
+}
+
+void
+ThreadTestSuite :: testStartAndJoin()
+{
+  CountingThread thread;
+  TS_ASSERT(!thread.isStarted());
+  TS_ASSERT(!thread.isCurrentThread());
+  TS_ASSERT(!Thread::current());
+  thread.start();
+  TS_ASSERT(thread.isStarted());
+  {
+    Lock::Guard g(&thread.mLock);
+    while(!thread.mCount)
+      thread.mDone.wait(&thread.mLock);
+  }
+  thread.join();
+  TS_ASSERT(!thread.isStarted());
+  TS_ASSERT_EQUALS(1, thread.mCount);
+  TS_ASSERT(thread.mRanOnSelf);
+  // joining twice is harmless
+  thread.join();
+}
+
+void
+ThreadTestSuite :: testRestart()
+{
+  CountingThread thread;
+  for(int i = 0; i < 5; i++) {
+    thread.start();
+    thread.join();
+  }
+  TS_ASSERT_EQUALS(5, thread.mCount);
+}
+
+void
+ThreadTestSuite :: testConditionTimedWait()
+{
+  Lock lock;
+  Condition cond;
+  Lock::Guard g(&lock);
+  TS_ASSERT(!cond.timedWait(&lock, 1000));
+}
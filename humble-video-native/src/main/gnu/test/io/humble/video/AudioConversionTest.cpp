@@ -0,0 +1,281 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "AudioConversionTest.h"
+#include <io/humble/ferry/Logger.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace io::humble::ferry;
+using namespace io::humble::video;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+namespace {
+
+const enum AVSampleFormat sFormats[] = {
+    AV_SAMPLE_FMT_S16, AV_SAMPLE_FMT_S16P, AV_SAMPLE_FMT_FLT, AV_SAMPLE_FMT_FLTP };
+const struct {
+  uint64_t out;
+  uint64_t in;
+} sLayouts[] = {
+    { AV_CH_LAYOUT_MONO, AV_CH_LAYOUT_MONO },
+    { AV_CH_LAYOUT_STEREO, AV_CH_LAYOUT_STEREO },
+    { AV_CH_LAYOUT_5POINT1, AV_CH_LAYOUT_5POINT1 },
+    { AV_CH_LAYOUT_MONO, AV_CH_LAYOUT_STEREO },
+    { AV_CH_LAYOUT_STEREO, AV_CH_LAYOUT_MONO },
+};
+const int32_t sGuard = 64;
+
+/**
+ * Samples for every plane, with 0xaa in sGuard bytes past the end of
+ * each.
+ */
+class Samples
+{
+public:
+  Samples(uint64_t layout, enum AVSampleFormat format, int32_t n) :
+    mFormat(format), mN(n) {
+    mChannels = av_get_channel_layout_nb_channels(layout);
+    const bool planar = av_sample_fmt_is_planar(format);
+    mBytes = n * av_get_bytes_per_sample(format) * (planar ? 1 : mChannels);
+    mPlanes.resize(planar ? mChannels : 1);
+    for(size_t i = 0; i < mPlanes.size(); i++) {
+      mPlanes[i].assign(mBytes + sGuard, 0xaa);
+      mData[i] = &mPlanes[i][0];
+    }
+  }
+  uint8_t** data() { return mData; }
+  int32_t planes() { return (int32_t)mPlanes.size(); }
+
+  /**
+   * Noise with some full scale and out of range samples, and floats that
+   * fall exactly half way between two S16 values.
+   */
+  void fill(uint32_t seed) {
+    for(size_t p = 0; p < mPlanes.size(); p++) {
+      for(int32_t i = 0; i < mBytes / av_get_bytes_per_sample(mFormat); i++) {
+        seed = seed * 1664525 + 1013904223;
+        int32_t r = (int32_t)(seed >> 8) & 0xffff;
+        if (av_get_packed_sample_fmt(mFormat) == AV_SAMPLE_FMT_S16) {
+          int16_t v = (int16_t)(i % 97 == 0 ? (i & 1 ? 32767 : -32768) : r - 32768);
+          memcpy(&mPlanes[p][i * 2], &v, 2);
+        } else {
+          float v = (r - 32768) / 32768.0f;
+          if (i % 5 == 0)
+            v = ((r - 32768) * 2 + 1) / 65536.0f;
+          else if (i % 13 == 0)
+            v *= 1.5f;
+          memcpy(&mPlanes[p][i * 4], &v, 4);
+        }
+      }
+    }
+  }
+
+  /** @return the number of bytes that differ from other. */
+  int32_t diff(Samples& other) {
+    int32_t retval = 0;
+    for(size_t p = 0; p < mPlanes.size(); p++)
+      for(int32_t i = 0; i < mBytes; i++)
+        retval += mPlanes[p][i] != other.mPlanes[p][i];
+    return retval;
+  }
+
+  bool guardIntact() {
+    for(size_t p = 0; p < mPlanes.size(); p++)
+      for(int32_t i = 0; i < sGuard; i++)
+        if (mPlanes[p][mBytes + i] != 0xaa)
+          return false;
+    return true;
+  }
+
+private:
+  enum AVSampleFormat mFormat;
+  int32_t mN;
+  int32_t mChannels;
+  int32_t mBytes;
+  std::vector<std::vector<uint8_t> > mPlanes;
+  uint8_t* mData[8];
+};
+
+int32_t
+AudioConversionTest_swresample(uint8_t** out, uint64_t outLayout,
+    enum AVSampleFormat outFmt, uint8_t** in, uint64_t inLayout,
+    enum AVSampleFormat inFmt, int32_t n) {
+  SwrContext* ctx = swr_alloc_set_opts(0, outLayout, outFmt, 48000,
+      inLayout, inFmt, 48000, 0, 0);
+  swr_init(ctx);
+  int32_t retval = swr_convert(ctx, out, n, (const uint8_t**)in, n);
+  swr_free(&ctx);
+  return retval;
+}
+
+}
+
+AudioConversionTest::AudioConversionTest() {
+}
+
+AudioConversionTest::~AudioConversionTest() {
+}
+
+void
+AudioConversionTest::testMake() {
+  AudioConversion* conversion = AudioConversion::make(AV_CH_LAYOUT_MONO,
+      AV_SAMPLE_FMT_S16, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP,
+      AudioConversion::LEVEL_AVX2);
+  TS_ASSERT(conversion);
+  TS_ASSERT_EQUALS(AudioConversion::getBestLevel(), conversion->getLevel());
+  delete conversion;
+  conversion = AudioConversion::make(AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLT,
+      AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16P, AudioConversion::LEVEL_SCALAR);
+  TS_ASSERT(conversion);
+  TS_ASSERT_EQUALS(AudioConversion::LEVEL_SCALAR, conversion->getLevel());
+  delete conversion;
+
+  // formats and layouts it does not do
+  TS_ASSERT(!AudioConversion::make(AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S32,
+      AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16, AudioConversion::LEVEL_AVX2));
+  TS_ASSERT(!AudioConversion::make(AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16,
+      AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_DBL, AudioConversion::LEVEL_AVX2));
+  TS_ASSERT(!AudioConversion::make(AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16,
+      AV_CH_LAYOUT_5POINT1, AV_SAMPLE_FMT_S16, AudioConversion::LEVEL_AVX2));
+  TS_ASSERT(!AudioConversion::make(AV_CH_LAYOUT_MONO, AV_SAMPLE_FMT_S16,
+      AV_CH_LAYOUT_2_1, AV_SAMPLE_FMT_S16, AudioConversion::LEVEL_AVX2));
+  TS_ASSERT(!AudioConversion::make(AV_CH_LAYOUT_7POINT1_WIDE_BACK | AV_CH_TOP_CENTER,
+      AV_SAMPLE_FMT_S16, AV_CH_LAYOUT_7POINT1_WIDE_BACK | AV_CH_TOP_CENTER,
+      AV_SAMPLE_FMT_S16, AudioConversion::LEVEL_AVX2));
+}
+
+void
+AudioConversionTest::testLevelsAgree() {
+  // odd lengths leave remainders for the scalar kernels, and the longest
+  // goes over more than one block
+  const int32_t lengths[] = { 1, 7, 33, 2500 };
+  for(size_t l = 0; l < sizeof(sLayouts)/sizeof(*sLayouts); l++) {
+    for(size_t i = 0; i < sizeof(sFormats)/sizeof(*sFormats); i++) {
+      for(size_t o = 0; o < sizeof(sFormats)/sizeof(*sFormats); o++) {
+        for(size_t n = 0; n < sizeof(lengths)/sizeof(*lengths); n++) {
+          Samples in(sLayouts[l].in, sFormats[i], lengths[n]);
+          in.fill(l + i + o + n);
+          Samples expected(sLayouts[l].out, sFormats[o], lengths[n]);
+          AudioConversion* conversion = AudioConversion::make(sLayouts[l].out,
+              sFormats[o], sLayouts[l].in, sFormats[i],
+              AudioConversion::LEVEL_SCALAR);
+          TS_ASSERT(conversion);
+          conversion->convert(expected.data(), in.data(), lengths[n]);
+          TS_ASSERT(expected.guardIntact());
+          delete conversion;
+          for(int32_t level = AudioConversion::LEVEL_SSE4;
+              level <= AudioConversion::getBestLevel(); level++) {
+            Samples out(sLayouts[l].out, sFormats[o], lengths[n]);
+            conversion = AudioConversion::make(sLayouts[l].out, sFormats[o],
+                sLayouts[l].in, sFormats[i], (AudioConversion::Level)level);
+            TS_ASSERT_EQUALS(level, conversion->getLevel());
+            conversion->convert(out.data(), in.data(), lengths[n]);
+            delete conversion;
+            TSM_ASSERT_EQUALS(av_get_sample_fmt_name(sFormats[i]), 0,
+                out.diff(expected));
+            TS_ASSERT(out.guardIntact());
+          }
+        }
+      }
+    }
+  }
+}
+
+void
+AudioConversionTest::testAgainstSwresample() {
+  const int32_t length = 4000;
+  for(size_t l = 0; l < sizeof(sLayouts)/sizeof(*sLayouts); l++) {
+    for(size_t i = 0; i < sizeof(sFormats)/sizeof(*sFormats); i++) {
+      for(size_t o = 0; o < sizeof(sFormats)/sizeof(*sFormats); o++) {
+        Samples in(sLayouts[l].in, sFormats[i], length);
+        in.fill(l * 16 + i * 4 + o);
+        Samples expected(sLayouts[l].out, sFormats[o], length);
+        TS_ASSERT_EQUALS(length, AudioConversionTest_swresample(
+            expected.data(), sLayouts[l].out, sFormats[o],
+            in.data(), sLayouts[l].in, sFormats[i], length));
+        AudioConversion* conversion = AudioConversion::make(sLayouts[l].out,
+            sFormats[o], sLayouts[l].in, sFormats[i],
+            AudioConversion::getBestLevel());
+        Samples out(sLayouts[l].out, sFormats[o], length);
+        conversion->convert(out.data(), in.data(), length);
+        delete conversion;
+        int32_t diff = out.diff(expected);
+        if (diff)
+          VS_LOG_ERROR("%s %d channels -> %s %d channels differs in %d bytes",
+              av_get_sample_fmt_name(sFormats[i]),
+              av_get_channel_layout_nb_channels(sLayouts[l].in),
+              av_get_sample_fmt_name(sFormats[o]),
+              av_get_channel_layout_nb_channels(sLayouts[l].out), diff);
+        TS_ASSERT_EQUALS(0, diff);
+      }
+    }
+  }
+}
+
+void
+AudioConversionTest::testThroughput() {
+  // not a pass or fail test; it logs how fast each set of kernels is
+  struct {
+    uint64_t inLayout;
+    enum AVSampleFormat inFmt;
+    uint64_t outLayout;
+    enum AVSampleFormat outFmt;
+  } cases[] = {
+    { AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP },
+    { AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16 },
+    { AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_S16, AV_CH_LAYOUT_MONO, AV_SAMPLE_FMT_S16 },
+    { AV_CH_LAYOUT_MONO, AV_SAMPLE_FMT_S16, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP },
+    { AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLT, AV_CH_LAYOUT_STEREO, AV_SAMPLE_FMT_FLTP },
+  };
+  const int32_t length = 48000;
+  const int32_t iterations = 50;
+  for(size_t i = 0; i < sizeof(cases)/sizeof(*cases); i++) {
+    Samples in(cases[i].inLayout, cases[i].inFmt, length);
+    in.fill(1);
+    Samples out(cases[i].outLayout, cases[i].outFmt, length);
+    double rates[4] = { 0, 0, 0, 0 };
+    for(int32_t level = -1; level <= AudioConversion::getBestLevel(); level++) {
+      AudioConversion* conversion = level < 0 ? 0 : AudioConversion::make(
+          cases[i].outLayout, cases[i].outFmt, cases[i].inLayout,
+          cases[i].inFmt, (AudioConversion::Level)level);
+      int64_t start = av_gettime();
+      for(int32_t j = 0; j < iterations; j++) {
+        if (conversion)
+          conversion->convert(out.data(), in.data(), length);
+        else
+          AudioConversionTest_swresample(out.data(), cases[i].outLayout,
+              cases[i].outFmt, in.data(), cases[i].inLayout, cases[i].inFmt,
+              length);
+      }
+      int64_t elapsed = FFMAX(av_gettime() - start, 1);
+      rates[level + 1] = (double)length * iterations / elapsed;
+      delete conversion;
+    }
+    VS_LOG_INFO("%s %d channels -> %s %d channels, Msamples/s: swresample %.1f, "
+        "scalar %.1f, sse4 %.1f, avx2 %.1f",
+        av_get_sample_fmt_name(cases[i].inFmt),
+        av_get_channel_layout_nb_channels(cases[i].inLayout),
+        av_get_sample_fmt_name(cases[i].outFmt),
+        av_get_channel_layout_nb_channels(cases[i].outLayout),
+        rates[0], rates[1], rates[2], rates[3]);
+  }
+}
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "AudioMixTest.h"
+#include <io/humble/ferry/Logger.h>
+
+#include <cstring>
+#include <math.h>
+#include <vector>
+
+using namespace io::humble::ferry;
+using namespace io::humble::video;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+namespace {
+
+const enum AVSampleFormat sFormats[] = {
+    AV_SAMPLE_FMT_S16, AV_SAMPLE_FMT_S16P, AV_SAMPLE_FMT_FLT, AV_SAMPLE_FMT_FLTP };
+
+/**
+ * numIns inputs and an output of n samples per channel each, with the
+ * output starting as garbage and inputs as noise loud enough for S16 sums
+ * to clip.
+ */
+class Mix
+{
+public:
+  Mix(enum AVSampleFormat format, int32_t channels, int32_t numIns,
+      int32_t n, uint32_t seed) : mFormat(format), mNumIns(numIns) {
+    const bool planar = av_sample_fmt_is_planar(format);
+    mPlanes = planar ? channels : 1;
+    mValues = n * (planar ? 1 : channels);
+    mBuffers.resize((numIns + 1) * mPlanes);
+    mPointers.resize(mBuffers.size());
+    mIns.resize(numIns + 1);
+    for(size_t i = 0; i < mBuffers.size(); i++) {
+      mBuffers[i].resize(mValues * av_get_bytes_per_sample(format));
+      for(size_t j = 0; j < mBuffers[i].size(); j++) {
+        seed = seed * 1664525 + 1013904223;
+        mBuffers[i][j] = (uint8_t)(seed >> 24);
+      }
+      if (!isS16())
+        // keep floats in range so they are not NaNs
+        for(int32_t j = 0; j < mValues; j++)
+          ((float*)&mBuffers[i][0])[j] = (int8_t)mBuffers[i][j] / 128.0f;
+      mPointers[i] = &mBuffers[i][0];
+    }
+    for(int32_t i = 0; i <= numIns; i++)
+      mIns[i] = &mPointers[(i + 1) * mPlanes];
+    for(int32_t i = 0; i < numIns; i++)
+      mGains.push_back(0.25f + 0.5f * i);
+  }
+  bool isS16() { return av_get_packed_sample_fmt(mFormat) == AV_SAMPLE_FMT_S16; }
+  uint8_t* const* out() { return &mPointers[0]; }
+  const uint8_t* const* const* ins() { return (const uint8_t* const* const*)&mIns[0]; }
+  const float* gains() { return mGains.empty() ? 0 : &mGains[0]; }
+  int32_t numIns() { return mNumIns; }
+  int32_t planes() { return mPlanes; }
+  int32_t values() { return mValues; }
+  float in(int32_t i, int32_t p, int32_t v) {
+    return isS16() ? ((int16_t*)mIns[i][p])[v] : ((float*)mIns[i][p])[v];
+  }
+  float out(int32_t p, int32_t v) {
+    return isS16() ? ((int16_t*)mPointers[p])[v] : ((float*)mPointers[p])[v];
+  }
+  bool same(Mix& other) {
+    for(int32_t p = 0; p < mPlanes; p++)
+      if (memcmp(mPointers[p], other.mPointers[p], mBuffers[p].size()))
+        return false;
+    return true;
+  }
+
+private:
+  enum AVSampleFormat mFormat;
+  int32_t mNumIns;
+  int32_t mPlanes;
+  int32_t mValues;
+  std::vector<std::vector<uint8_t> > mBuffers;
+  std::vector<uint8_t*> mPointers;
+  std::vector<uint8_t**> mIns;
+  std::vector<float> mGains;
+};
+
+}
+
+AudioMixTest::AudioMixTest() {
+}
+
+AudioMixTest::~AudioMixTest() {
+}
+
+void
+AudioMixTest::testMake() {
+  AudioMix* mix = AudioMix::make(AV_SAMPLE_FMT_FLTP, 2,
+      AudioConversion::LEVEL_AVX2);
+  TS_ASSERT(mix);
+  TS_ASSERT_EQUALS(AudioConversion::getBestLevel(), mix->getLevel());
+  delete mix;
+  mix = AudioMix::make(AV_SAMPLE_FMT_S16, 6, AudioConversion::LEVEL_SCALAR);
+  TS_ASSERT(mix);
+  TS_ASSERT_EQUALS(AudioConversion::LEVEL_SCALAR, mix->getLevel());
+  delete mix;
+
+  TS_ASSERT(!AudioMix::make(AV_SAMPLE_FMT_S32, 2, AudioConversion::LEVEL_AVX2));
+  TS_ASSERT(!AudioMix::make(AV_SAMPLE_FMT_DBLP, 2, AudioConversion::LEVEL_AVX2));
+  TS_ASSERT(!AudioMix::make(AV_SAMPLE_FMT_S16, 0, AudioConversion::LEVEL_AVX2));
+}
+
+void
+AudioMixTest::testMix() {
+  for(size_t f = 0; f < sizeof(sFormats)/sizeof(*sFormats); f++) {
+    Mix m(sFormats[f], 2, 3, 100, f);
+    AudioMix* mix = AudioMix::make(sFormats[f], 2,
+        AudioConversion::LEVEL_SCALAR);
+    mix->mix(m.out(), m.ins(), m.gains(), m.numIns(), 100);
+    delete mix;
+    int32_t clipped = 0;
+    for(int32_t p = 0; p < m.planes(); p++) {
+      for(int32_t v = 0; v < m.values(); v++) {
+        float expected = 0;
+        for(int32_t i = 0; i < m.numIns(); i++)
+          expected += m.gains()[i] * m.in(i, p, v);
+        if (m.isS16()) {
+          if (expected > 32767 || expected < -32768)
+            ++clipped;
+          expected = lrintf(FFMAX(-32768.0f, FFMIN(32767.0f, expected)));
+        }
+        TS_ASSERT_EQUALS(expected, m.out(p, v));
+      }
+    }
+    if (m.isS16())
+      TS_ASSERT(clipped > 0);
+  }
+
+  // no inputs is silence
+  for(size_t f = 0; f < sizeof(sFormats)/sizeof(*sFormats); f++) {
+    Mix m(sFormats[f], 2, 0, 50, f);
+    AudioMix* mix = AudioMix::make(sFormats[f], 2,
+        AudioConversion::LEVEL_AVX2);
+    mix->mix(m.out(), m.ins(), m.gains(), 0, 50);
+    delete mix;
+    for(int32_t p = 0; p < m.planes(); p++)
+      for(int32_t v = 0; v < m.values(); v++)
+        TS_ASSERT_EQUALS(0, m.out(p, v));
+  }
+}
+
+void
+AudioMixTest::testLevelsAgree() {
+  // odd lengths leave remainders for the scalar kernels, and the longest
+  // goes over more than one block
+  const int32_t lengths[] = { 1, 7, 33, 2500 };
+  const int32_t channels[] = { 1, 2, 6 };
+  const int32_t numIns[] = { 1, 2, 20 };
+  for(size_t f = 0; f < sizeof(sFormats)/sizeof(*sFormats); f++) {
+    for(size_t c = 0; c < sizeof(channels)/sizeof(*channels); c++) {
+      for(size_t i = 0; i < sizeof(numIns)/sizeof(*numIns); i++) {
+        for(size_t n = 0; n < sizeof(lengths)/sizeof(*lengths); n++) {
+          const uint32_t seed = f * 64 + c * 16 + i * 4 + n;
+          Mix expected(sFormats[f], channels[c], numIns[i], lengths[n], seed);
+          AudioMix* mix = AudioMix::make(sFormats[f], channels[c],
+              AudioConversion::LEVEL_SCALAR);
+          mix->mix(expected.out(), expected.ins(), expected.gains(),
+              numIns[i], lengths[n]);
+          delete mix;
+          for(int32_t level = AudioConversion::LEVEL_SSE4;
+              level <= AudioConversion::getBestLevel(); level++) {
+            Mix m(sFormats[f], channels[c], numIns[i], lengths[n], seed);
+            mix = AudioMix::make(sFormats[f], channels[c],
+                (AudioConversion::Level)level);
+            TS_ASSERT_EQUALS(level, mix->getLevel());
+            mix->mix(m.out(), m.ins(), m.gains(), numIns[i], lengths[n]);
+            delete mix;
+            TSM_ASSERT(av_get_sample_fmt_name(sFormats[f]), m.same(expected));
+          }
+        }
+      }
+    }
+  }
+}
+
+void
+AudioMixTest::testThroughput() {
+  // not a pass or fail test; it logs how fast each set of kernels is
+  const int32_t length = 4800;
+  const int32_t numIns = 20;
+  const int32_t iterations = 50;
+  for(size_t f = 0; f < sizeof(sFormats)/sizeof(*sFormats); f++) {
+    Mix m(sFormats[f], 2, numIns, length, 1);
+    double rates[3] = { 0, 0, 0 };
+    for(int32_t level = 0; level <= AudioConversion::getBestLevel(); level++) {
+      AudioMix* mix = AudioMix::make(sFormats[f], 2,
+          (AudioConversion::Level)level);
+      int64_t start = av_gettime();
+      for(int32_t i = 0; i < iterations; i++)
+        mix->mix(m.out(), m.ins(), m.gains(), numIns, length);
+      int64_t elapsed = FFMAX(av_gettime() - start, 1);
+      delete mix;
+      rates[level] = (double)length * numIns * iterations / elapsed;
+    }
+    VS_LOG_INFO("%d stereo %s inputs, Msamples/s: scalar %.1f, sse4 %.1f, "
+        "avx2 %.1f", numIns, av_get_sample_fmt_name(sFormats[f]), rates[0],
+        rates[1], rates[2]);
+  }
+}
@@ -26,11 +26,19 @@
 // for getenv
 #include <cstdlib>
 #include <vector>
+#include <sys/time.h>
 
 #include <io/humble/ferry/Logger.h>
 #include <io/humble/ferry/LoggerStack.h>
 #include "DemuxerTest.h"
 #include <io/humble/video/DemuxerImpl.h>
+#include <io/humble/video/ContainerIO.h>
+#include <io/humble/video/DemuxerProbeCache.h>
+#include <io/humble/video/DemuxerSeekIndex.h>
+#include <io/humble/video/Muxer.h>
+#include <io/humble/video/FrameSeeker.h>
+#include <io/humble/video/CachingProtocol.h>
+#include <io/humble/video/MemoryProtocol.h>
 #include <io/humble/video/customio/StdioURLProtocolManager.h>
 
 VS_LOG_SETUP(VS_CPP_PACKAGE);
@@ -261,3 +269,884 @@ DemuxerTest::testRead()
   TS_ASSERT_EQUALS(pktsRead, mFixture->packets);
   source->close();
 }
+
+void
+DemuxerTest::testReadAhead()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+
+  // read everything once without reading ahead to know what to expect
+  std::vector<int64_t> dts;
+  std::vector<int32_t> sizes;
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  RefPointer<Demuxer> source = Demuxer::make();
+  source->open(filepath, 0, false, true, 0, 0);
+  TS_ASSERT(!source->isReadAhead());
+  while(source->read(pkt.value()) >= 0) {
+    dts.push_back(pkt->getDts());
+    sizes.push_back(pkt->getSize());
+  }
+  source->close();
+  TS_ASSERT(dts.size() > 0);
+
+  source = Demuxer::make();
+  source->open(filepath, 0, false, true, 0, 0);
+  // a tiny queue so the reader thread has to wait on us a lot.
+  source->setReadAhead(4, 0, 0);
+  TS_ASSERT(source->isReadAhead());
+  for(int pass = 0; pass < 2; pass++) {
+    size_t i = 0;
+    int32_t retval;
+    while((retval = source->read(pkt.value())) >= 0) {
+      TS_ASSERT(i < dts.size());
+      if (i >= dts.size())
+        break;
+      TS_ASSERT(pkt->isComplete());
+      TS_ASSERT_EQUALS(dts[i], pkt->getDts());
+      TS_ASSERT_EQUALS(sizes[i], pkt->getSize());
+      ++i;
+    }
+    TS_ASSERT_EQUALS(AVERROR_EOF, retval);
+    TS_ASSERT_EQUALS(dts.size(), i);
+    // end of file sticks until we seek
+    TS_ASSERT_EQUALS(AVERROR_EOF, source->read(pkt.value()));
+    TS_ASSERT(source->seek(-1, 0, 0, 0, 0) >= 0);
+  }
+
+  // turn it off part way through; nothing should be lost or repeated.
+  source->setReadAhead(0, 1024*1024, Global::DEFAULT_PTS_PER_SECOND);
+  for(size_t i = 0; i < dts.size(); i++) {
+    if (i == dts.size()/2)
+      source->setReadAhead(0, 0, 0);
+    TS_ASSERT(source->read(pkt.value()) >= 0);
+    TS_ASSERT_EQUALS(dts[i], pkt->getDts());
+  }
+  TS_ASSERT(!source->isReadAhead());
+  TS_ASSERT(source->read(pkt.value()) < 0);
+
+  // close while the reader thread is still busy.
+  source->setReadAhead(2, 0, 0);
+  TS_ASSERT(source->seek(-1, 0, 0, 0, 0) >= 0);
+  TS_ASSERT(source->read(pkt.value()) >= 0);
+  source->close();
+}
+
+void
+DemuxerTest::testReadAheadStopsWithDiscardedStream()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+
+  std::vector<int64_t> dts;
+  std::vector<int32_t> streams;
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  RefPointer<Demuxer> source = Demuxer::make();
+  source->open(filepath, 0, false, true, 0, 0);
+  TS_ASSERT(source->getNumStreams() > 1);
+  while(source->read(pkt.value()) >= 0) {
+    dts.push_back(pkt->getDts());
+    streams.push_back(pkt->getStreamIndex());
+  }
+  source->close();
+
+  // stop reading ahead with packets of a now discarded stream 0 still
+  // queued, at different points so the queue sometimes ends with one.
+  for(size_t start = 5; start <= 50; start += 5) {
+    source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    source->setReadAhead(4, 0, 0);
+    for(size_t i = 0; i < start; i++)
+      TS_ASSERT(source->read(pkt.value()) >= 0);
+    source->setReadAhead(0, 0, 0);
+    int32_t selected = 1;
+    source->selectStreams(&selected, 1);
+
+    size_t i = start;
+    int32_t retval;
+    while((retval = source->read(pkt.value())) >= 0) {
+      while(i < dts.size() && streams[i] != selected)
+        ++i;
+      TS_ASSERT(i < dts.size());
+      if (i >= dts.size())
+        break;
+      TS_ASSERT(pkt->isComplete());
+      TS_ASSERT_EQUALS(selected, pkt->getStreamIndex());
+      TS_ASSERT_EQUALS(dts[i], pkt->getDts());
+      ++i;
+    }
+    TS_ASSERT_EQUALS(AVERROR_EOF, retval);
+    source->close();
+  }
+}
+
+void
+DemuxerTest::testReadReusesStreamTimeBase()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+
+  RefPointer<Demuxer> source = Demuxer::make();
+  source->open(filepath, 0, false, true, 0, 0);
+  int32_t n = source->getNumStreams();
+  std::vector<Rational*> bases(n, (Rational*)0);
+  std::vector<Coder*> coders(n, (Coder*)0);
+
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  int32_t numPackets = 0;
+  while(source->read(pkt.value()) >= 0 && numPackets < 200) {
+    int32_t i = pkt->getStreamIndex();
+    TS_ASSERT(i >= 0 && i < n);
+    RefPointer<Rational> base = pkt->getTimeBase();
+    RefPointer<Coder> coder = pkt->getCoder();
+    TS_ASSERT(base);
+    if (!bases[i]) {
+      RefPointer<DemuxerStream> stream = source->getStream(i);
+      RefPointer<Rational> streamBase = stream->getTimeBase();
+      TS_ASSERT_EQUALS(0, streamBase->compareTo(base.value()));
+      bases[i] = base.value();
+      coders[i] = coder.value();
+    }
+    // the same objects are handed out for every packet in a stream
+    TS_ASSERT_EQUALS(bases[i], base.value());
+    TS_ASSERT_EQUALS(coders[i], coder.value());
+    ++numPackets;
+  }
+  TS_ASSERT(numPackets > 0);
+  source->close();
+}
+
+void
+DemuxerTest::testReadBatch()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+
+  // read everything one packet at a time to compare against
+  std::vector<int64_t> dts;
+  std::vector<int32_t> sizes;
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    RefPointer<MediaPacket> pkt = MediaPacket::make();
+    while(source->read(pkt.value()) >= 0)
+      if (pkt->isComplete()) {
+        dts.push_back(pkt->getDts());
+        sizes.push_back(pkt->getSize());
+      }
+    source->close();
+  }
+  TS_ASSERT(dts.size() > 10);
+
+  const int32_t numPackets = 8;
+  RefPointer<MediaPacket> pkts[numPackets];
+  MediaPacket* raw[numPackets];
+  for(int32_t i = 0; i < numPackets; i++) {
+    pkts[i] = MediaPacket::make();
+    raw[i] = pkts[i].value();
+  }
+
+  RefPointer<Demuxer> source = Demuxer::make();
+  source->open(filepath, 0, false, true, 0, 0);
+
+  // a byte budget of 1 stops after the first packet
+  int32_t retval = source->readBatch(raw, numPackets, 1, 0);
+  TS_ASSERT_EQUALS(1, retval);
+  TS_ASSERT_EQUALS(dts[0], raw[0]->getDts());
+  size_t read = 1;
+
+  // unlimited batches return the same packets as single reads, then EOF
+  while((retval = source->readBatch(raw, numPackets, 0, 0)) > 0) {
+    TS_ASSERT(retval <= numPackets);
+    for(int32_t i = 0; i < retval; i++, read++) {
+      TS_ASSERT(read < dts.size());
+      if (read >= dts.size())
+        break;
+      TS_ASSERT(raw[i]->isComplete());
+      TS_ASSERT_EQUALS(dts[read], raw[i]->getDts());
+      TS_ASSERT_EQUALS(sizes[read], raw[i]->getSize());
+      RefPointer<Rational> base = raw[i]->getTimeBase();
+      TS_ASSERT(base);
+    }
+  }
+  TS_ASSERT(retval < 0);
+  TS_ASSERT_EQUALS(dts.size(), read);
+
+  // and EOF is sticky
+  TS_ASSERT(source->readBatch(raw, numPackets, 0, 0) < 0);
+
+  // invalid arguments
+  TS_ASSERT_THROWS(source->readBatch(0, numPackets, 0, 0), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(source->readBatch(raw, 0, 0, 0), HumbleInvalidArgument);
+  raw[1] = 0;
+  TS_ASSERT_THROWS(source->readBatch(raw, numPackets, 0, 0), HumbleInvalidArgument);
+  source->close();
+}
+
+namespace {
+// sets when path was modified to a fixed time plus usec microseconds
+bool
+setModified(const char* path, int32_t usec)
+{
+  struct timeval times[2];
+  times[0].tv_sec = times[1].tv_sec = 1400000000;
+  times[0].tv_usec = times[1].tv_usec = usec;
+  return !utimes(path, times);
+}
+
+// a copy of a fixture we can touch
+bool
+copyFile(const char* from, const char* to)
+{
+  FILE* in = fopen(from, "rb");
+  FILE* out = fopen(to, "wb");
+  bool retval = in && out;
+  char buf[4096];
+  size_t bytes;
+  while (retval && (bytes = fread(buf, 1, sizeof(buf), in)) > 0)
+    retval = fwrite(buf, 1, bytes, out) == bytes;
+  if (in)
+    fclose(in);
+  if (out && fclose(out))
+    retval = false;
+  return retval && setModified(to, 0);
+}
+
+// what we expect the probe cache to give back
+std::string
+describeStreams(Demuxer* source)
+{
+  std::string retval;
+  char buf[512];
+  snprintf(buf, sizeof(buf), "d:%" PRIi64 ";s:%" PRIi64 ";",
+      source->getDuration(), source->getStartTime());
+  retval += buf;
+  int32_t n = source->getNumStreams();
+  for(int32_t i = 0; i < n; i++) {
+    RefPointer<DemuxerStream> stream = source->getStream(i);
+    RefPointer<Decoder> d = stream->getDecoder();
+    RefPointer<Rational> frameRate = stream->getFrameRate();
+    snprintf(buf, sizeof(buf),
+        "[t:%d;c:%d;w:%d;h:%d;p:%d;r:%d;ch:%d;f:%d;fr:%d/%d]",
+        (int)d->getCodecType(), (int)d->getCodecID(),
+        d->getWidth(), d->getHeight(), (int)d->getPixelFormat(),
+        d->getSampleRate(), d->getChannels(), (int)d->getSampleFormat(),
+        frameRate ? frameRate->getNumerator() : 0,
+        frameRate ? frameRate->getDenominator() : 0);
+    retval += buf;
+  }
+  return retval;
+}
+}
+
+void
+DemuxerTest::testProbeCache()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+  const char* cacheFile = "DemuxerTest_testProbeCache.cache";
+  DemuxerProbeCache* cache = DemuxerProbeCache::get();
+
+  // off by default; opening does not fill it.
+  TS_ASSERT_EQUALS(0, Demuxer::getProbeCacheSize());
+  std::string expected;
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    expected = describeStreams(source.value());
+    source->close();
+  }
+  TS_ASSERT_EQUALS(0, cache->getNumEntries());
+
+  Demuxer::setProbeCacheSize(4);
+  TS_ASSERT_EQUALS(4, Demuxer::getProbeCacheSize());
+  for(int32_t pass = 0; pass < 2; pass++) {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    TS_ASSERT_EQUALS(1, cache->getNumEntries());
+    TS_ASSERT_EQUALS(expected, describeStreams(source.value()));
+    // and a cached open is still good to decode from
+    int32_t n = source->getNumStreams();
+    for(int32_t i = 0; i < n; i++) {
+      RefPointer<DemuxerStream> stream = source->getStream(i);
+      RefPointer<Decoder> d = stream->getDecoder();
+      d->open(0, 0);
+    }
+    RefPointer<MediaPacket> pkt = MediaPacket::make();
+    TS_ASSERT(source->read(pkt.value()) >= 0);
+    TS_ASSERT(pkt->isComplete());
+    source->close();
+  }
+
+  // survives a round trip through a file
+  Demuxer::saveProbeCache(cacheFile);
+  Demuxer::setProbeCacheSize(0);
+  TS_ASSERT_EQUALS(0, cache->getNumEntries());
+  Demuxer::setProbeCacheSize(4);
+  TS_ASSERT_EQUALS(1, Demuxer::loadProbeCache(cacheFile));
+  TS_ASSERT_EQUALS(1, cache->getNumEntries());
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    TS_ASSERT_EQUALS(expected, describeStreams(source.value()));
+    source->close();
+  }
+
+  // a damaged file is ignored
+  FILE* f = fopen(cacheFile, "wb");
+  TS_ASSERT(f);
+  fputs("not a probe cache", f);
+  fclose(f);
+  TS_ASSERT_EQUALS(-1, Demuxer::loadProbeCache(cacheFile));
+  remove(cacheFile);
+  TS_ASSERT_THROWS_ANYTHING(Demuxer::loadProbeCache(cacheFile));
+
+  // a file rewritten within the same second is not the file we probed
+  const char* copy = "DemuxerTest_testProbeCache.mp4";
+  TS_ASSERT(copyFile(filepath, copy));
+  for(int32_t usec = 0; usec < 2; usec++) {
+    TS_ASSERT(setModified(copy, usec));
+    for(int32_t pass = 0; pass < 2; pass++) {
+      RefPointer<Demuxer> source = Demuxer::make();
+      source->open(copy, 0, false, true, 0, 0);
+      TS_ASSERT_EQUALS(expected, describeStreams(source.value()));
+      source->close();
+    }
+    TS_ASSERT_EQUALS(2+usec, cache->getNumEntries());
+  }
+  remove(copy);
+
+  Demuxer::setProbeCacheSize(0);
+  TS_ASSERT_EQUALS(0, cache->getNumEntries());
+}
+
+void
+DemuxerTest::testSeekIndex()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+  const char* indexFile = "DemuxerTest_testSeekIndex.index";
+  const char* copy = "DemuxerTest_testSeekIndex.mp4";
+  TS_ASSERT(copyFile(filepath, copy));
+
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  int64_t firstDts = Global::NO_PTS;
+  int32_t numEntries = 0;
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(copy, 0, false, true, 0, 0);
+    TS_ASSERT(source->read(pkt.value()) >= 0);
+    firstDts = pkt->getDts();
+
+    numEntries = source->buildSeekIndex();
+    TS_ASSERT(numEntries > 0);
+    int32_t n = source->getNumStreams();
+    int32_t total = 0;
+    for(int32_t i = 0; i < n; i++) {
+      RefPointer<DemuxerStream> stream = source->getStream(i);
+      total += stream->getNumIndexEntries();
+    }
+    TS_ASSERT_EQUALS(total, numEntries);
+
+    // indexing leaves us back at the start
+    TS_ASSERT(source->read(pkt.value()) >= 0);
+    TS_ASSERT(pkt->isComplete());
+    TS_ASSERT_EQUALS(firstDts, pkt->getDts());
+
+    source->saveSeekIndex(indexFile);
+    source->close();
+  }
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(copy, 0, false, true, 0, 0);
+    TS_ASSERT_EQUALS(numEntries, source->loadSeekIndex(indexFile));
+    TS_ASSERT(source->seek(-1, 0, Global::DEFAULT_PTS_PER_SECOND,
+        Global::DEFAULT_PTS_PER_SECOND*2, 0) >= 0);
+    TS_ASSERT(source->read(pkt.value()) >= 0);
+    TS_ASSERT(pkt->isComplete());
+    source->close();
+  }
+
+  // an index for the file before it was rewritten is ignored, even at
+  // the same size and within the same second...
+  TS_ASSERT(setModified(copy, 1));
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(copy, 0, false, true, 0, 0);
+    TS_ASSERT_EQUALS(-1, source->loadSeekIndex(indexFile));
+    source->close();
+  }
+  remove(copy);
+
+  // ...as is one for some other file
+  fixture=mFixtures.getFixture("testfile.mp3");
+  TSM_ASSERT("Missing fixture", fixture);
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    TS_ASSERT_EQUALS(-1, source->loadSeekIndex(indexFile));
+    source->close();
+  }
+  remove(indexFile);
+}
+
+void
+DemuxerTest::testSeekIndexByteSeek()
+{
+  // MPEG-TS has no index of its own, so FFmpeg would bisect it on time
+  // stamps; make one from the MP3 fixture
+  TestData::Fixture* fixture=mFixtures.getFixture("testfile.mp3");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+  const char* tsFile = "DemuxerTest_testSeekIndexByteSeek.ts";
+  {
+    RefPointer<Demuxer> demuxer = Demuxer::make();
+    demuxer->open(filepath, 0, false, true, 0, 0);
+    RefPointer<Muxer> muxer = Muxer::make(tsFile, 0, "mpegts");
+    for(int32_t i = 0; i < demuxer->getNumStreams(); i++) {
+      RefPointer<DemuxerStream> stream = demuxer->getStream(i);
+      RefPointer<Decoder> d = stream->getDecoder();
+      RefPointer<MuxerStream> muxerStream = muxer->addNewStream(d.value());
+    }
+    muxer->open(0, 0);
+    RefPointer<MediaPacket> packet = MediaPacket::make();
+    while(demuxer->read(packet.value()) >= 0)
+      if (packet->isComplete())
+        muxer->write(packet.value(), false);
+    muxer->close();
+    demuxer->close();
+  }
+
+  RefPointer<Demuxer> source = Demuxer::make();
+  source->open(tsFile, 0, false, true, 0, 0);
+  TS_ASSERT(source->buildSeekIndex() > 0);
+
+  // the index has a key frame for the seek, so it becomes a byte seek
+  const int64_t ts = 2 * Global::DEFAULT_PTS_PER_SECOND;
+  int64_t pos = -1;
+  TS_ASSERT(DemuxerSeekIndex::findPosition(source->getFormatCtx(), -1,
+      0, ts, ts + Global::DEFAULT_PTS_PER_SECOND, &pos));
+  TS_ASSERT(pos > 0);
+  TS_ASSERT(source->seek(-1, 0, ts, ts + Global::DEFAULT_PTS_PER_SECOND, 0) >= 0);
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  TS_ASSERT(source->read(pkt.value()) >= 0);
+  TS_ASSERT(pkt->isComplete());
+  TS_ASSERT_EQUALS(pos, pkt->getPosition());
+  source->close();
+  remove(tsFile);
+}
+
+void
+DemuxerTest::testFrameSeeker()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+
+  RefPointer<Demuxer> source = Demuxer::make();
+  source->open(filepath, 0, false, true, 0, 0);
+  int32_t videoStream = -1;
+  for(int32_t i = 0; i < source->getNumStreams() && videoStream < 0; i++) {
+    RefPointer<DemuxerStream> stream = source->getStream(i);
+    RefPointer<Decoder> decoder = stream->getDecoder();
+    if (decoder->getCodecType() == MediaDescriptor::MEDIA_VIDEO)
+      videoStream = i;
+  }
+  TS_ASSERT(videoStream >= 0);
+
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    stack.setGlobalLevel(Logger::LEVEL_DEBUG, false);
+    TS_ASSERT_THROWS(FrameSeeker::make(0, videoStream, 2), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(FrameSeeker::make(source.value(), videoStream, -1),
+        HumbleInvalidArgument);
+    TS_ASSERT_THROWS(FrameSeeker::make(source.value(), source->getNumStreams(), 2),
+        HumbleInvalidArgument);
+    TS_ASSERT_THROWS(FrameSeeker::make(source.value(), videoStream == 0 ? 1 : 0, 2),
+        HumbleInvalidArgument);
+  }
+
+  RefPointer<FrameSeeker> seeker = FrameSeeker::make(source.value(),
+      videoStream, 2);
+  TS_ASSERT_EQUALS(videoStream, seeker->getStreamIndex());
+  TS_ASSERT_EQUALS(2, seeker->getMaxCachedGops());
+  TS_ASSERT_EQUALS(0, seeker->getNumCachedGops());
+
+  // decode the whole stream once to know every frame's time stamp
+  std::vector<int64_t> timeStamps;
+  {
+    RefPointer<Decoder> decoder = seeker->getDecoder();
+    RefPointer<MediaPacket> packet = MediaPacket::make();
+    RefPointer<MediaPicture> picture = MediaPicture::make(decoder->getWidth(),
+        decoder->getHeight(), decoder->getPixelFormat());
+    while(source->read(packet.value()) >= 0) {
+      if (!packet->isComplete() || packet->getStreamIndex() != videoStream)
+        continue;
+      int32_t offset = 0;
+      do {
+        offset += decoder->decodeVideo(picture.value(), packet.value(), offset);
+        if (picture->isComplete())
+          timeStamps.push_back(picture->getTimeStamp());
+      } while (offset < packet->getSize());
+    }
+    do {
+      decoder->decodeVideo(picture.value(), 0, 0);
+      if (picture->isComplete())
+        timeStamps.push_back(picture->getTimeStamp());
+    } while (picture->isComplete());
+  }
+  TS_ASSERT(timeStamps.size() > 10);
+
+  // a frame in the middle, then step backwards over a few GOPs
+  size_t middle = timeStamps.size()/2;
+  for(size_t i = middle; i + 30 > middle && i > 0; i--) {
+    RefPointer<MediaPicture> picture = seeker->seekToFrame(timeStamps[i]);
+    TS_ASSERT(picture);
+    TS_ASSERT_EQUALS(timeStamps[i], picture->getTimeStamp());
+    TS_ASSERT(seeker->getNumCachedGops() <= 2);
+  }
+  // time between two frames gives the earlier one
+  RefPointer<MediaPicture> picture = seeker->seekToFrame(timeStamps[middle]+1);
+  TS_ASSERT_EQUALS(timeStamps[middle], picture->getTimeStamp());
+  // cached frames come back as new pictures of the same frame
+  picture->setTimeStamp(-1);
+  RefPointer<MediaPicture> again = seeker->seekToFrame(timeStamps[middle]+1);
+  TS_ASSERT_DIFFERS(picture.value(), again.value());
+  TS_ASSERT_EQUALS(timeStamps[middle], again->getTimeStamp());
+  TS_ASSERT_EQUALS(picture->getNumDataPlanes(), again->getNumDataPlanes());
+  for(int32_t i = 0; i < picture->getNumDataPlanes(); i++) {
+    int32_t size = picture->getDataPlaneSize(i);
+    TS_ASSERT_EQUALS(size, again->getDataPlaneSize(i));
+    RefPointer<Buffer> expected = picture->getData(i);
+    RefPointer<Buffer> actual = again->getData(i);
+    TS_ASSERT(memcmp(expected->getBytes(0, size), actual->getBytes(0, size),
+        size) == 0);
+  }
+
+  // before the start gives the first frame; past the end the last
+  picture = seeker->seekToFrame(timeStamps.front()-1);
+  TS_ASSERT(picture);
+  TS_ASSERT_EQUALS(timeStamps.front(), picture->getTimeStamp());
+  picture = seeker->seekToFrame(timeStamps.back()+1000);
+  TS_ASSERT(picture);
+  TS_ASSERT_EQUALS(timeStamps.back(), picture->getTimeStamp());
+
+  // the memory kept is bounded as well as the GOP count
+  TS_ASSERT_EQUALS(256*1024*1024, seeker->getMaxCachedBytes());
+  TS_ASSERT_EQUALS(2, seeker->getNumCachedGops());
+  int64_t cached = seeker->getCachedBytes();
+  TS_ASSERT(cached >= (int64_t)picture->getDataPlaneSize(0)*2);
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    stack.setGlobalLevel(Logger::LEVEL_DEBUG, false);
+    TS_ASSERT_THROWS(seeker->setMaxCachedBytes(-1), HumbleInvalidArgument);
+  }
+  seeker->setMaxCachedBytes(cached-1);
+  TS_ASSERT_EQUALS(1, seeker->getNumCachedGops());
+  TS_ASSERT(seeker->getCachedBytes() < cached);
+  TS_ASSERT(seeker->getCachedBytes() > 0);
+  seeker->setMaxCachedBytes(0);
+  TS_ASSERT_EQUALS(0, seeker->getNumCachedGops());
+  TS_ASSERT_EQUALS(0, seeker->getCachedBytes());
+  // nothing fits, but seeking still works
+  picture = seeker->seekToFrame(timeStamps[middle]);
+  TS_ASSERT(picture);
+  TS_ASSERT_EQUALS(timeStamps[middle], picture->getTimeStamp());
+  TS_ASSERT_EQUALS(0, seeker->getNumCachedGops());
+  TS_ASSERT_EQUALS(0, seeker->getCachedBytes());
+
+  seeker->setMaxCachedBytes(cached);
+  picture = seeker->seekToFrame(timeStamps[middle]);
+  TS_ASSERT_EQUALS(1, seeker->getNumCachedGops());
+  seeker->clearCache();
+  TS_ASSERT_EQUALS(0, seeker->getNumCachedGops());
+  TS_ASSERT_EQUALS(0, seeker->getCachedBytes());
+  source->close();
+}
+
+void
+DemuxerTest::testSelectStreams()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  std::vector<int32_t> counts;
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    counts.resize(source->getNumStreams(), 0);
+    while(source->read(pkt.value()) >= 0)
+      if (pkt->isComplete())
+        ++counts[pkt->getStreamIndex()];
+    source->close();
+  }
+  TS_ASSERT(counts.size() > 1);
+
+  for(int32_t selected = 0; selected < (int32_t)counts.size(); selected++) {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    source->selectStreams(&selected, 1);
+    for(int32_t i = 0; i < source->getNumStreams(); i++) {
+      RefPointer<DemuxerStream> stream = source->getStream(i);
+      TS_ASSERT_EQUALS(i == selected ? Codec::DISCARD_DEFAULT : Codec::DISCARD_ALL,
+          stream->getDiscard());
+    }
+    int32_t count = 0;
+    while(source->read(pkt.value()) >= 0) {
+      if (pkt->isComplete()) {
+        TS_ASSERT_EQUALS(selected, pkt->getStreamIndex());
+        ++count;
+      }
+    }
+    TS_ASSERT_EQUALS(counts[selected], count);
+    source->close();
+  }
+
+  RefPointer<Demuxer> source = Demuxer::make();
+  source->open(filepath, 0, false, true, 0, 0);
+  // selecting no streams reads nothing
+  source->selectStreams(0, 0);
+  TS_ASSERT(source->read(pkt.value()) < 0);
+  TS_ASSERT(!pkt->isComplete());
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    stack.setGlobalLevel(Logger::LEVEL_DEBUG, false);
+    int32_t bad = source->getNumStreams();
+    TS_ASSERT_THROWS(source->selectStreams(&bad, 1), HumbleInvalidArgument);
+  }
+  source->close();
+}
+
+void
+DemuxerTest::testOpenMemory()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  int32_t numPackets = 0;
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(filepath, 0, false, true, 0, 0);
+    while(source->read(pkt.value()) >= 0)
+      if (pkt->isComplete())
+        ++numPackets;
+    source->close();
+  }
+  TS_ASSERT(numPackets > 0);
+
+  // load the file in two pieces
+  FILE* file = fopen(filepath, "rb");
+  TS_ASSERT(file);
+  fseek(file, 0, SEEK_END);
+  int32_t size = (int32_t)ftell(file);
+  fseek(file, 0, SEEK_SET);
+  int32_t half = size/2;
+  RefPointer<Buffer> first = Buffer::make(0, half);
+  RefPointer<Buffer> second = Buffer::make(0, size-half);
+  TS_ASSERT_EQUALS((size_t)half, fread(first->getBytes(0, half), 1, half, file));
+  TS_ASSERT_EQUALS((size_t)(size-half),
+      fread(second->getBytes(0, size-half), 1, size-half, file));
+  fclose(file);
+
+  const char* name = "DemuxerTest_testOpenMemory";
+  MemoryProtocol::addSource(name, first.value());
+  MemoryProtocol::addSource(name, second.value());
+  char url[256];
+  snprintf(url, sizeof(url), "%s:%s", MemoryProtocol::getProtocolName(), name);
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(url, 0, false, true, 0, 0);
+    int32_t count = 0;
+    while(source->read(pkt.value()) >= 0)
+      if (pkt->isComplete())
+        ++count;
+    TS_ASSERT_EQUALS(numPackets, count);
+    // and seeking works
+    TS_ASSERT(source->seek(-1, INT64_MIN, 0, 0, 0) >= 0);
+    TS_ASSERT(source->read(pkt.value()) >= 0);
+    TS_ASSERT(pkt->isComplete());
+    source->close();
+  }
+  TS_ASSERT(MemoryProtocol::removeSource(name));
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    stack.setGlobalLevel(Logger::LEVEL_DEBUG, false);
+    RefPointer<Demuxer> source = Demuxer::make();
+    TS_ASSERT_THROWS_ANYTHING(source->open(url, 0, false, true, 0, 0));
+  }
+}
+
+void
+DemuxerTest::testOpenAsync()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+  // our read-ahead, and FFmpeg's async: wrapped around another protocol
+  const char* prefixes[] = { "", "humbleasync:", "async:file:" };
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  int32_t counts[3];
+  for(int32_t i = 0; i < 3; i++) {
+    char url[2100];
+    snprintf(url, sizeof(url), "%s%s", prefixes[i], filepath);
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(url, 0, false, true, 0, 0);
+    counts[i] = 0;
+    while(source->read(pkt.value()) >= 0)
+      if (pkt->isComplete())
+        ++counts[i];
+    source->close();
+  }
+  TS_ASSERT(counts[0] > 0);
+  TS_ASSERT_EQUALS(counts[0], counts[1]);
+  TS_ASSERT_EQUALS(counts[0], counts[2]);
+}
+
+void
+DemuxerTest::testOpenCached()
+{
+  TestData::Fixture* fixture=mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+  char url[2100];
+  snprintf(url, sizeof(url), "%s:%s", CachingProtocol::getProtocolName(), filepath);
+
+  CachingProtocol::clear();
+  CachingProtocol::resetStatistics();
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+  int32_t counts[2];
+  for(int32_t i = 0; i < 2; i++) {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(url, 0, false, true, 0, 0);
+    counts[i] = 0;
+    while(source->read(pkt.value()) >= 0)
+      if (pkt->isComplete())
+        ++counts[i];
+    source->close();
+    if (i == 0)
+      TS_ASSERT(CachingProtocol::getMisses() > 0);
+  }
+  TS_ASSERT(counts[0] > 0);
+  TS_ASSERT_EQUALS(counts[0], counts[1]);
+
+  // the second Demuxer read everything from the cache
+  int64_t misses = CachingProtocol::getMisses();
+  TS_ASSERT(CachingProtocol::getHits() >= misses);
+  TS_ASSERT(CachingProtocol::getCachedBytes() > 0);
+  TS_ASSERT(CachingProtocol::getCachedBytes() <= CachingProtocol::getMaxBytes());
+  TS_ASSERT_EQUALS(0, CachingProtocol::getEvictions());
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(url, 0, false, true, 0, 0);
+    while(source->read(pkt.value()) >= 0)
+      ;
+    source->close();
+  }
+  TS_ASSERT_EQUALS(misses, CachingProtocol::getMisses());
+  CachingProtocol::clear();
+  TS_ASSERT_EQUALS(0, CachingProtocol::getCachedBytes());
+
+  // FFmpeg's own "cache:" protocol must still be reachable, and not ours
+  snprintf(url, sizeof(url), "cache:%s", filepath);
+  CachingProtocol::resetStatistics();
+  {
+    RefPointer<Demuxer> source = Demuxer::make();
+    source->open(url, 0, false, true, 0, 0);
+    int32_t count = 0;
+    while(source->read(pkt.value()) >= 0)
+      if (pkt->isComplete())
+        ++count;
+    source->close();
+    TS_ASSERT_EQUALS(counts[0], count);
+  }
+  TS_ASSERT_EQUALS(0, CachingProtocol::getMisses());
+}
+
+void
+DemuxerTest::testIOStatistics()
+{
+  StdioURLProtocolManager::registerProtocol("test");
+  TestData::Fixture* fixture=mFixtures.getFixture("testfile.mp3");
+  TSM_ASSERT("Missing fixture", fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+  char url[2100];
+  snprintf(url, sizeof(url), "test:%s", filepath);
+  RefPointer<MediaPacket> pkt = MediaPacket::make();
+
+  // by default the buffer is picked from the handler, and grows.
+  RefPointer<Demuxer> source = Demuxer::make();
+  TS_ASSERT_EQUALS(0, source->getInputBufferLength());
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(source->setInputBufferLength(-1), HumbleInvalidArgument);
+  }
+  TS_ASSERT_EQUALS(0, source->getIOBufferLength());
+  source->open(url, 0, false, true, 0, 0);
+  TS_ASSERT_EQUALS(ContainerIO::SEEKABLE_BUFFER_LENGTH, source->getIOBufferLength());
+  int32_t packets = 0;
+  while(source->read(pkt.value()) >= 0)
+    if (pkt->isComplete())
+      ++packets;
+  source->close();
+  TS_ASSERT(packets > 0);
+  int64_t calls = source->getIOReadCalls();
+  int64_t bytes = source->getIOBytesRead();
+  TS_ASSERT(calls > 0);
+  TS_ASSERT(bytes > 0);
+  TS_ASSERT(source->getIOTime() >= 0);
+  TS_ASSERT_EQUALS(0, source->getIOWriteCalls());
+  TS_ASSERT_EQUALS(0, source->getIOBytesWritten());
+  TS_ASSERT(source->getIOBufferLength() > ContainerIO::SEEKABLE_BUFFER_LENGTH);
+  TS_ASSERT(source->getIOBufferLength() <= ContainerIO::SEEKABLE_BUFFER_MAX);
+
+  // a fixed length is kept, and costs more calls for the same data.
+  source = Demuxer::make();
+  source->setInputBufferLength(2048);
+  source->open(url, 0, false, true, 0, 0);
+  int32_t fixedPackets = 0;
+  while(source->read(pkt.value()) >= 0)
+    if (pkt->isComplete())
+      ++fixedPackets;
+  source->close();
+  TS_ASSERT_EQUALS(packets, fixedPackets);
+  TS_ASSERT_EQUALS(2048, source->getIOBufferLength());
+  TS_ASSERT(source->getIOBytesRead() > 0);
+  TS_ASSERT(source->getIOReadCalls() > calls);
+
+  // FFmpeg's own protocols do not go through a handler.
+  source = Demuxer::make();
+  source->open(filepath, 0, false, true, 0, 0);
+  TS_ASSERT(source->read(pkt.value()) >= 0);
+  source->close();
+  TS_ASSERT_EQUALS(0, source->getIOReadCalls());
+  TS_ASSERT_EQUALS(0, source->getIOBufferLength());
+}
@@ -45,6 +45,19 @@ public:
   void testOpenWithoutCloseAutoCloses();
   void testOpenInvalidArguments();
   void testRead();
+  void testReadAhead();
+  void testReadAheadStopsWithDiscardedStream();
+  void testReadReusesStreamTimeBase();
+  void testReadBatch();
+  void testProbeCache();
+  void testSeekIndex();
+  void testSeekIndexByteSeek();
+  void testFrameSeeker();
+  void testSelectStreams();
+  void testOpenMemory();
+  void testOpenCached();
+  void testOpenAsync();
+  void testIOStatistics();
 private:
   void openTestHelper(const char* url);
   char mSampleFile[2048];
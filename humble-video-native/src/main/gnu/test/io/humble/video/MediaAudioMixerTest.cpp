@@ -0,0 +1,314 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "MediaAudioMixerTest.h"
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/ferry/LoggerStack.h>
+#include <io/humble/ferry/HumbleException.h>
+
+using namespace io::humble::video;
+using namespace io::humble::ferry;
+
+namespace {
+
+/**
+ * Makes numSamples of audio with every sample of every channel set to
+ * value, time stamped pts in 1/timeBase units.
+ */
+MediaAudio*
+MediaAudioMixerTest_audio(AudioChannel::Layout layout,
+    AudioFormat::Type format, int32_t numSamples, double value, int64_t pts,
+    int32_t timeBase = 48000) {
+  const int32_t channels = AudioChannel::getNumChannelsInLayout(layout);
+  RefPointer<MediaAudio> audio = MediaAudio::make(numSamples, 48000, channels,
+      layout, format);
+  const bool planar = AudioFormat::isPlanar(format);
+  const int32_t values = numSamples * (planar ? 1 : channels);
+  for(int32_t p = 0; p < (planar ? channels : 1); p++) {
+    RefPointer<Buffer> buffer = audio->getData(p);
+    if (format == AudioFormat::SAMPLE_FMT_S16 ||
+        format == AudioFormat::SAMPLE_FMT_S16P) {
+      int16_t* data = (int16_t*)buffer->getBytes(0, values * 2);
+      for(int32_t i = 0; i < values; i++)
+        data[i] = (int16_t)value;
+    } else {
+      float* data = (float*)buffer->getBytes(0, values * 4);
+      for(int32_t i = 0; i < values; i++)
+        data[i] = (float)value;
+    }
+  }
+  RefPointer<Rational> tb = Rational::make(1, timeBase);
+  audio->setTimeBase(tb.value());
+  audio->setTimeStamp(pts);
+  audio->setComplete(true);
+  return audio.get();
+}
+
+/** @return sample i of channel 0 of audio. */
+double
+MediaAudioMixerTest_sample(MediaAudio* audio, int32_t i) {
+  const AudioFormat::Type format = audio->getFormat();
+  const int32_t stride = AudioFormat::isPlanar(format) ? 1 : audio->getChannels();
+  RefPointer<Buffer> buffer = audio->getData(0);
+  if (format == AudioFormat::SAMPLE_FMT_S16 ||
+      format == AudioFormat::SAMPLE_FMT_S16P)
+    return ((int16_t*)buffer->getBytes(0, 2))[i * stride];
+  return ((float*)buffer->getBytes(0, 4))[i * stride];
+}
+
+}
+
+MediaAudioMixerTest::MediaAudioMixerTest() {
+}
+
+MediaAudioMixerTest::~MediaAudioMixerTest() {
+}
+
+void
+MediaAudioMixerTest::testMake() {
+  RefPointer<MediaAudioMixer> mixer = MediaAudioMixer::make(48000,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_FLTP, 1024);
+  TS_ASSERT(mixer);
+  TS_ASSERT_EQUALS(48000, mixer->getSampleRate());
+  TS_ASSERT_EQUALS(AudioChannel::CH_LAYOUT_STEREO, mixer->getChannelLayout());
+  TS_ASSERT_EQUALS(2, mixer->getChannels());
+  TS_ASSERT_EQUALS(AudioFormat::SAMPLE_FMT_FLTP, mixer->getFormat());
+  TS_ASSERT_EQUALS(1024, mixer->getFrameSize());
+  TS_ASSERT_EQUALS(12000, mixer->getMaxDelay());
+  TS_ASSERT_EQUALS(0, mixer->getNumInputs());
+  TS_ASSERT_EQUALS(0, mixer->addInput(1.0));
+  TS_ASSERT_EQUALS(1, mixer->addInput(0.5));
+  TS_ASSERT_EQUALS(2, mixer->getNumInputs());
+  TS_ASSERT_EQUALS(0.5, mixer->getGain(1));
+  mixer->setGain(1, 2.0);
+  TS_ASSERT_EQUALS(2.0, mixer->getGain(1));
+  TS_ASSERT_EQUALS(0, mixer->getNumBuffered(0));
+
+  LoggerStack stack;
+  stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+  TS_ASSERT_THROWS(MediaAudioMixer::make(0, AudioChannel::CH_LAYOUT_STEREO,
+      AudioFormat::SAMPLE_FMT_FLTP, 1024), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaAudioMixer::make(48000,
+      AudioChannel::CH_LAYOUT_UNKNOWN, AudioFormat::SAMPLE_FMT_FLTP, 1024),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaAudioMixer::make(48000,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_S32, 1024),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaAudioMixer::make(48000,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_FLTP, 0),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(mixer->setMaxDelay(-1), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(mixer->getGain(2), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(mixer->setGain(-1, 1.0), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(mixer->addAudio(0, 0), HumbleInvalidArgument);
+  RefPointer<MediaAudio> audio = MediaAudioMixerTest_audio(
+      AudioChannel::CH_LAYOUT_MONO, AudioFormat::SAMPLE_FMT_FLTP, 100, 0, 0);
+  TS_ASSERT_THROWS(mixer->addAudio(0, audio.value()), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(mixer->mix(audio.value()), HumbleInvalidArgument);
+  audio = MediaAudioMixerTest_audio(AudioChannel::CH_LAYOUT_STEREO,
+      AudioFormat::SAMPLE_FMT_FLTP, 100, 0, 0);
+  // no room for a frame
+  TS_ASSERT_THROWS(mixer->mix(audio.value()), HumbleInvalidArgument);
+  audio->setComplete(false);
+  TS_ASSERT_THROWS(mixer->addAudio(0, audio.value()), HumbleInvalidArgument);
+}
+
+void
+MediaAudioMixerTest::testAlignment() {
+  const AudioChannel::Layout layout = AudioChannel::CH_LAYOUT_STEREO;
+  const AudioFormat::Type format = AudioFormat::SAMPLE_FMT_S16;
+  RefPointer<MediaAudioMixer> mixer = MediaAudioMixer::make(48000, layout,
+      format, 100);
+  mixer->addInput(1.0);
+  mixer->addInput(1.0);
+  RefPointer<MediaAudio> output = MediaAudio::make(100, 48000, 2, layout,
+      format);
+
+  // the first time stamp starts the mix; the second input starts 1ms,
+  // or 48 samples, later
+  RefPointer<MediaAudio> audio = MediaAudioMixerTest_audio(layout, format,
+      300, 1000, 4800);
+  mixer->addAudio(0, audio.value());
+  TS_ASSERT_EQUALS(0, mixer->mix(output.value()));
+  TS_ASSERT(!output->isComplete());
+  audio = MediaAudioMixerTest_audio(layout, format, 200, 10, 101, 1000);
+  mixer->addAudio(1, audio.value());
+  TS_ASSERT_EQUALS(248, mixer->getNumBuffered(1));
+
+  TS_ASSERT_EQUALS(100, mixer->mix(output.value()));
+  TS_ASSERT(output->isComplete());
+  TS_ASSERT_EQUALS(100, output->getNumSamples());
+  TS_ASSERT_EQUALS(4800, output->getTimeStamp());
+  RefPointer<Rational> timeBase = output->getTimeBase();
+  TS_ASSERT_EQUALS(1, timeBase->getNumerator());
+  TS_ASSERT_EQUALS(48000, timeBase->getDenominator());
+  TS_ASSERT_EQUALS(1000, MediaAudioMixerTest_sample(output.value(), 47));
+  TS_ASSERT_EQUALS(1010, MediaAudioMixerTest_sample(output.value(), 48));
+  TS_ASSERT_EQUALS(200, mixer->getNumBuffered(0));
+  TS_ASSERT_EQUALS(148, mixer->getNumBuffered(1));
+
+  // audio without a time stamp carries on from the last
+  audio = MediaAudioMixerTest_audio(layout, format, 52, 20, Global::NO_PTS);
+  mixer->addAudio(1, audio.value());
+  TS_ASSERT_EQUALS(200, mixer->getNumBuffered(1));
+  TS_ASSERT_EQUALS(100, mixer->mix(output.value()));
+  TS_ASSERT_EQUALS(4900, output->getTimeStamp());
+  TS_ASSERT_EQUALS(100, mixer->mix(output.value()));
+  TS_ASSERT_EQUALS(5000, output->getTimeStamp());
+  TS_ASSERT_EQUALS(1010, MediaAudioMixerTest_sample(output.value(), 47));
+  TS_ASSERT_EQUALS(1020, MediaAudioMixerTest_sample(output.value(), 48));
+  TS_ASSERT_EQUALS(0, mixer->mix(output.value()));
+
+  // a gap is silent, and overlapping audio replaces what was there
+  audio = MediaAudioMixerTest_audio(layout, format, 100, 1, 5150);
+  mixer->addAudio(0, audio.value());
+  audio = MediaAudioMixerTest_audio(layout, format, 200, 2, 5100);
+  mixer->addAudio(1, audio.value());
+  audio = MediaAudioMixerTest_audio(layout, format, 10, 3, 5100);
+  mixer->addAudio(1, audio.value());
+  TS_ASSERT_EQUALS(100, mixer->mix(output.value()));
+  TS_ASSERT_EQUALS(3, MediaAudioMixerTest_sample(output.value(), 9));
+  TS_ASSERT_EQUALS(2, MediaAudioMixerTest_sample(output.value(), 10));
+  TS_ASSERT_EQUALS(2, MediaAudioMixerTest_sample(output.value(), 49));
+  TS_ASSERT_EQUALS(3, MediaAudioMixerTest_sample(output.value(), 50));
+  TS_ASSERT_EQUALS(0, mixer->getNumDroppedSamples());
+}
+
+void
+MediaAudioMixerTest::testGains() {
+  const AudioChannel::Layout layout = AudioChannel::CH_LAYOUT_STEREO;
+  const AudioFormat::Type formats[] = {
+      AudioFormat::SAMPLE_FMT_S16, AudioFormat::SAMPLE_FMT_S16P,
+      AudioFormat::SAMPLE_FMT_FLT, AudioFormat::SAMPLE_FMT_FLTP };
+  for(size_t f = 0; f < sizeof(formats)/sizeof(*formats); f++) {
+    const bool s16 = f < 2;
+    const double scale = s16 ? 10000 : 0.25;
+    RefPointer<MediaAudioMixer> mixer = MediaAudioMixer::make(48000, layout,
+        formats[f], 64);
+    RefPointer<MediaAudio> output = MediaAudio::make(64, 48000, 2, layout,
+        formats[f]);
+    // twenty talkers, one of them out of phase, and one muted
+    for(int32_t i = 0; i < 20; i++) {
+      mixer->addInput(i == 0 ? -1.0 : 0.05);
+      RefPointer<MediaAudio> audio = MediaAudioMixerTest_audio(layout,
+          formats[f], 128, scale, 0);
+      mixer->addAudio(i, audio.value());
+    }
+    mixer->addInput(0.0);
+    RefPointer<MediaAudio> audio = MediaAudioMixerTest_audio(layout,
+        formats[f], 128, scale, 0);
+    mixer->addAudio(20, audio.value());
+    TS_ASSERT_EQUALS(64, mixer->mix(output.value()));
+    for(int32_t i = 0; i < 64; i++)
+      TS_ASSERT_DELTA(-0.05 * scale, MediaAudioMixerTest_sample(output.value(), i),
+          s16 ? 0.5 : 1e-6);
+
+    // loud S16 clips rather than wrapping; floats do not clip
+    mixer->setGain(0, 3.5);
+    TS_ASSERT_EQUALS(64, mixer->mix(output.value()));
+    TS_ASSERT_DELTA(s16 ? 32767 : 4.45 * scale,
+        MediaAudioMixerTest_sample(output.value(), 0), s16 ? 0 : 1e-6);
+  }
+}
+
+void
+MediaAudioMixerTest::testMaxDelay() {
+  const AudioChannel::Layout layout = AudioChannel::CH_LAYOUT_MONO;
+  const AudioFormat::Type format = AudioFormat::SAMPLE_FMT_FLT;
+  RefPointer<MediaAudioMixer> mixer = MediaAudioMixer::make(48000, layout,
+      format, 100);
+  mixer->setMaxDelay(200);
+  TS_ASSERT_EQUALS(200, mixer->getMaxDelay());
+  mixer->addInput(1.0);
+  mixer->addInput(1.0);
+  RefPointer<MediaAudio> output = MediaAudio::make(100, 48000, 1, layout,
+      format);
+
+  // the first input fills its buffer while the second stalls; what does
+  // not fit is dropped
+  RefPointer<MediaAudio> audio = MediaAudioMixerTest_audio(layout, format,
+      250, 1, 0);
+  mixer->addAudio(0, audio.value());
+  TS_ASSERT_EQUALS(0, mixer->mix(output.value()));
+  audio = MediaAudioMixerTest_audio(layout, format, 100, 1, 250);
+  mixer->addAudio(0, audio.value());
+  TS_ASSERT_EQUALS(300, mixer->getNumBuffered(0));
+  TS_ASSERT_EQUALS(50, mixer->getNumDroppedSamples());
+
+  // so the mix goes on without the second
+  TS_ASSERT_EQUALS(100, mixer->mix(output.value()));
+  TS_ASSERT_EQUALS(1, MediaAudioMixerTest_sample(output.value(), 99));
+  TS_ASSERT_EQUALS(0, mixer->mix(output.value()));
+
+  // and when it catches up, the part already mixed is dropped
+  audio = MediaAudioMixerTest_audio(layout, format, 200, 2, 0);
+  mixer->addAudio(1, audio.value());
+  TS_ASSERT_EQUALS(150, mixer->getNumDroppedSamples());
+  TS_ASSERT_EQUALS(100, mixer->getNumBuffered(1));
+  TS_ASSERT_EQUALS(100, mixer->mix(output.value()));
+  TS_ASSERT_EQUALS(100, output->getTimeStamp());
+  TS_ASSERT_EQUALS(3, MediaAudioMixerTest_sample(output.value(), 0));
+
+  // audio too far ahead is dropped too
+  audio = MediaAudioMixerTest_audio(layout, format, 100, 2, 500);
+  mixer->addAudio(1, audio.value());
+  TS_ASSERT_EQUALS(250, mixer->getNumDroppedSamples());
+  TS_ASSERT_EQUALS(0, mixer->getNumBuffered(1));
+
+  // shrinking the delay drops what no longer fits
+  mixer->setMaxDelay(0);
+  TS_ASSERT_EQUALS(100, mixer->getNumBuffered(0));
+  TS_ASSERT_EQUALS(250, mixer->getNumDroppedSamples());
+  TS_ASSERT_EQUALS(100, mixer->mix(output.value()));
+  TS_ASSERT_EQUALS(200, output->getTimeStamp());
+}
+
+void
+MediaAudioMixerTest::testEndInput() {
+  const AudioChannel::Layout layout = AudioChannel::CH_LAYOUT_STEREO;
+  const AudioFormat::Type format = AudioFormat::SAMPLE_FMT_FLTP;
+  RefPointer<MediaAudioMixer> mixer = MediaAudioMixer::make(48000, layout,
+      format, 100);
+  mixer->addInput(1.0);
+  mixer->addInput(1.0);
+  RefPointer<MediaAudio> output = MediaAudio::make(100, 48000, 2, layout,
+      format);
+  RefPointer<MediaAudio> audio = MediaAudioMixerTest_audio(layout, format,
+      150, 0.5, 0);
+  mixer->addAudio(0, audio.value());
+  TS_ASSERT_EQUALS(0, mixer->mix(output.value()));
+
+  // once the second input ends the mix no longer waits for it
+  mixer->endInput(1);
+  TS_ASSERT_EQUALS(100, mixer->mix(output.value()));
+  TS_ASSERT_EQUALS(0, mixer->mix(output.value()));
+
+  // and once they all end it drains what is left
+  mixer->endInput(0);
+  TS_ASSERT_EQUALS(50, mixer->mix(output.value()));
+  TS_ASSERT_EQUALS(50, output->getNumSamples());
+  TS_ASSERT_EQUALS(100, output->getTimeStamp());
+  TS_ASSERT_EQUALS(0.5, MediaAudioMixerTest_sample(output.value(), 49));
+  TS_ASSERT_EQUALS(0, mixer->mix(output.value()));
+
+  LoggerStack stack;
+  stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+  TS_ASSERT_THROWS(mixer->addAudio(0, audio.value()), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(mixer->endInput(2), HumbleInvalidArgument);
+}
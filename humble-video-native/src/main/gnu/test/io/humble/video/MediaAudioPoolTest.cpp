@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "MediaAudioPoolTest.h"
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/ferry/LoggerStack.h>
+#include <io/humble/ferry/HumbleException.h>
+
+using namespace io::humble::video;
+using namespace io::humble::ferry;
+
+MediaAudioPoolTest::MediaAudioPoolTest() {
+}
+
+MediaAudioPoolTest::~MediaAudioPoolTest() {
+}
+
+void
+MediaAudioPoolTest::testMake() {
+  RefPointer<MediaAudioPool> pool = MediaAudioPool::make(1024, 44100, 2,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_S16, 4);
+  TS_ASSERT(pool);
+  TS_ASSERT_EQUALS(1024, pool->getNumSamples());
+  TS_ASSERT_EQUALS(44100, pool->getSampleRate());
+  TS_ASSERT_EQUALS(2, pool->getChannels());
+  TS_ASSERT_EQUALS(AudioChannel::CH_LAYOUT_STEREO, pool->getChannelLayout());
+  TS_ASSERT_EQUALS(AudioFormat::SAMPLE_FMT_S16, pool->getFormat());
+  TS_ASSERT_EQUALS(4, pool->getCapacity());
+
+  LoggerStack stack;
+  stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+  TS_ASSERT_THROWS(MediaAudioPool::make(0, 44100, 2,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_S16, 4),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaAudioPool::make(1024, 0, 2,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_S16, 4),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaAudioPool::make(1024, 44100, 2,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_NONE, 4),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaAudioPool::make(1024, 44100, 2,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_S16, -1),
+      HumbleInvalidArgument);
+}
+
+void
+MediaAudioPoolTest::testReuse() {
+  RefPointer<MediaAudioPool> pool = MediaAudioPool::make(1024, 48000, 2,
+      AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_FLTP, 2);
+
+  RefPointer<MediaAudio> audio = pool->getAudio();
+  TS_ASSERT_EQUALS(1024, audio->getNumSamples());
+  TS_ASSERT_EQUALS(1024, audio->getMaxNumSamples());
+  TS_ASSERT_EQUALS(48000, audio->getSampleRate());
+  TS_ASSERT_EQUALS(2, audio->getChannels());
+  MediaAudio* first = audio.value();
+  audio->setNumSamples(100);
+  audio->setTimeStamp(5000);
+  audio->setComplete(true);
+  audio = 0;
+  TS_ASSERT_EQUALS(1, pool->getNumIdle());
+
+  audio = pool->getAudio();
+  TS_ASSERT_EQUALS(first, audio.value());
+  TS_ASSERT_EQUALS(1024, audio->getNumSamples());
+  TS_ASSERT_EQUALS(Global::NO_PTS, audio->getTimeStamp());
+  TS_ASSERT(!audio->isComplete());
+  RefPointer<Rational> timeBase = audio->getTimeBase();
+  TS_ASSERT(timeBase);
+  TS_ASSERT_EQUALS(1, timeBase->getNumerator());
+  TS_ASSERT_EQUALS(48000, timeBase->getDenominator());
+  audio = 0;
+
+  // a steady loop allocates nothing once the pool is warm
+  pool->resetStatistics();
+  for(int32_t i = 0; i < 100; i++) {
+    audio = pool->getAudio();
+    audio->setTimeStamp(i * 1024);
+    audio = 0;
+  }
+  TS_ASSERT_EQUALS(0, pool->getNumAllocated());
+  TS_ASSERT_EQUALS(100, pool->getNumReused());
+  TS_ASSERT_EQUALS(100, pool->getNumRecycled());
+}
+
+void
+MediaAudioPoolTest::testSharedDataNotReused() {
+  RefPointer<MediaAudioPool> pool = MediaAudioPool::make(512, 22050, 1,
+      AudioChannel::CH_LAYOUT_MONO, AudioFormat::SAMPLE_FMT_S16, 2);
+
+  RefPointer<MediaAudio> audio = pool->getAudio();
+  RefPointer<MediaAudio> other = MediaAudio::make(audio.value(), false);
+  audio = 0;
+  TS_ASSERT_EQUALS(0, pool->getNumIdle());
+  TS_ASSERT_EQUALS(1, pool->getNumDiscarded());
+  other = 0;
+
+  // the pool outlives what it handed out
+  audio = pool->getAudio();
+  MediaAudioPool* raw = pool.value();
+  pool = 0;
+  TS_ASSERT_EQUALS(1, raw->getCurrentRefCount());
+  audio = 0;
+}
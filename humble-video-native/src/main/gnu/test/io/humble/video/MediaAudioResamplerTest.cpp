@@ -33,6 +33,8 @@
 #include <io/humble/video/Demuxer.h>
 #include <io/humble/video/Decoder.h>
 
+#include <vector>
+
 using namespace io::humble::ferry;
 using namespace io::humble::video;
 
@@ -324,3 +326,242 @@ MediaAudioResamplerTest::testFlushResampler() {
   resampler->resample(out.value(), 0);
   TS_ASSERT(!out->isComplete());
 }
+
+static MediaAudio*
+makeAudioHelper(int32_t numSamples, int32_t sampleRate,
+    AudioChannel::Layout layout, AudioFormat::Type format, int64_t pts,
+    uint32_t seed) {
+  RefPointer<MediaAudio> audio = MediaAudio::make(numSamples, sampleRate,
+      AudioChannel::getNumChannelsInLayout(layout), layout, format);
+  for(int32_t i = 0; i < audio->getNumDataPlanes(); i++) {
+    RefPointer<Buffer> buf = audio->getData(i);
+    int32_t size = audio->getDataPlaneSize(i);
+    uint8_t* data = (uint8_t*)buf->getBytes(0, size);
+    if (AudioFormat::getPackedSampleFormat(format) == AudioFormat::SAMPLE_FMT_FLT) {
+      for(int32_t j = 0; j < size / 4; j++) {
+        seed = seed * 1664525 + 1013904223;
+        ((float*)data)[j] = ((int32_t)(seed >> 16) - 32768) / 32768.0f;
+      }
+    } else {
+      for(int32_t j = 0; j < size / 2; j++) {
+        seed = seed * 1664525 + 1013904223;
+        ((int16_t*)data)[j] = (int16_t)(seed >> 16);
+      }
+    }
+  }
+  audio->setNumSamples(numSamples);
+  audio->setTimeStamp(pts);
+  RefPointer<Rational> tb = Rational::make(1, sampleRate);
+  audio->setTimeBase(tb.value());
+  audio->setComplete(true);
+  return audio.get();
+}
+
+static void
+appendAudioHelper(std::vector<uint8_t>& samples, MediaAudio* audio) {
+  // the first plane is enough to tell the outputs apart
+  RefPointer<Buffer> buf = audio->getData(0);
+  int32_t size = audio->getNumSamples() * audio->getBytesPerSample() *
+      (audio->isPlanar() ? 1 : audio->getChannels());
+  const uint8_t* data = (const uint8_t*)buf->getBytes(0, size);
+  samples.insert(samples.end(), data, data + size);
+}
+
+void
+MediaAudioResamplerTest::testFastPath() {
+  struct {
+    AudioChannel::Layout outLayout;
+    AudioFormat::Type outFormat;
+    AudioChannel::Layout inLayout;
+    AudioFormat::Type inFormat;
+  } cases[] = {
+    { AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_FLTP,
+        AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_S16 },
+    { AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_S16,
+        AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_FLTP },
+    { AudioChannel::CH_LAYOUT_MONO, AudioFormat::SAMPLE_FMT_S16,
+        AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_S16 },
+    { AudioChannel::CH_LAYOUT_STEREO, AudioFormat::SAMPLE_FMT_FLTP,
+        AudioChannel::CH_LAYOUT_MONO, AudioFormat::SAMPLE_FMT_S16 },
+    { AudioChannel::CH_LAYOUT_5POINT1, AudioFormat::SAMPLE_FMT_S16P,
+        AudioChannel::CH_LAYOUT_5POINT1, AudioFormat::SAMPLE_FMT_FLT },
+  };
+  const int32_t sampleRate = 44100;
+  for(size_t c = 0; c < sizeof(cases)/sizeof(*cases); c++) {
+    RefPointer<MediaAudioResampler> fast = MediaAudioResampler::make(
+        cases[c].outLayout, sampleRate, cases[c].outFormat,
+        cases[c].inLayout, sampleRate, cases[c].inFormat);
+    RefPointer<MediaAudioResampler> slow = MediaAudioResampler::make(
+        cases[c].outLayout, sampleRate, cases[c].outFormat,
+        cases[c].inLayout, sampleRate, cases[c].inFormat);
+    TS_ASSERT(fast->getFastPaths());
+    slow->setFastPaths(false);
+    TS_ASSERT(!fast->usesFastPath());
+    fast->open();
+    slow->open();
+    TS_ASSERT(fast->usesFastPath());
+    TS_ASSERT(!slow->usesFastPath());
+
+    RefPointer<MediaAudio> fastOut = MediaAudio::make(1024, sampleRate,
+        AudioChannel::getNumChannelsInLayout(cases[c].outLayout),
+        cases[c].outLayout, cases[c].outFormat);
+    RefPointer<MediaAudio> slowOut = MediaAudio::make(1024, sampleRate,
+        AudioChannel::getNumChannelsInLayout(cases[c].outLayout),
+        cases[c].outLayout, cases[c].outFormat);
+    std::vector<uint8_t> fastSamples;
+    std::vector<uint8_t> slowSamples;
+    int64_t pts = 0;
+    // some inputs are bigger than the output, so the general resampler
+    // has to buffer them and the fast path must wait for it to empty
+    for(int32_t i = 0; i < 24; i++) {
+      int32_t n = 100 + (i * 397) % 1500;
+      RefPointer<MediaAudio> in = makeAudioHelper(n, sampleRate,
+          cases[c].inLayout, cases[c].inFormat, i % 7 == 3 ? Global::NO_PTS : pts, i);
+      pts += n;
+      int32_t fastCount = fast->resampleAudio(fastOut.value(), in.value());
+      int32_t slowCount = slow->resampleAudio(slowOut.value(), in.value());
+      TS_ASSERT_EQUALS(slowCount, fastCount);
+      TS_ASSERT_EQUALS(slowOut->getTimeStamp(), fastOut->getTimeStamp());
+      if (fastCount > 0)
+        appendAudioHelper(fastSamples, fastOut.value());
+      if (slowCount > 0)
+        appendAudioHelper(slowSamples, slowOut.value());
+    }
+    int32_t fastCount;
+    do {
+      fastCount = fast->resampleAudio(fastOut.value(), 0);
+      int32_t slowCount = slow->resampleAudio(slowOut.value(), 0);
+      TS_ASSERT_EQUALS(slowCount, fastCount);
+      TS_ASSERT_EQUALS(slowOut->getTimeStamp(), fastOut->getTimeStamp());
+      if (fastCount > 0) {
+        appendAudioHelper(fastSamples, fastOut.value());
+        appendAudioHelper(slowSamples, slowOut.value());
+      }
+    } while (fastCount > 0);
+    TS_ASSERT_EQUALS(slowSamples.size(), fastSamples.size());
+    TS_ASSERT(slowSamples == fastSamples);
+  }
+
+  // not when resampling, or when a property changes the samples
+  RefPointer<MediaAudioResampler> resampler = MediaAudioResampler::make(
+      AudioChannel::CH_LAYOUT_STEREO, 48000, AudioFormat::SAMPLE_FMT_FLTP,
+      AudioChannel::CH_LAYOUT_STEREO, 44100, AudioFormat::SAMPLE_FMT_S16);
+  resampler->open();
+  TS_ASSERT(!resampler->usesFastPath());
+  resampler = MediaAudioResampler::make(
+      AudioChannel::CH_LAYOUT_STEREO, 44100, AudioFormat::SAMPLE_FMT_FLTP,
+      AudioChannel::CH_LAYOUT_STEREO, 44100, AudioFormat::SAMPLE_FMT_S16);
+  resampler->setProperty("rmvol", 0.5);
+  resampler->open();
+  TS_ASSERT(!resampler->usesFastPath());
+}
+
+void
+MediaAudioResamplerTest::testResampleBatch() {
+  const AudioChannel::Layout layout = AudioChannel::CH_LAYOUT_STEREO;
+  const int32_t inSampleRate = 44100;
+  const int32_t frameSize = 1024;
+  const int32_t inputSize = 441;
+  for(int32_t fastPaths = 0; fastPaths < 2; fastPaths++) {
+    // what the encoder would have got one input at a time
+    RefPointer<MediaAudioResampler> reference = MediaAudioResampler::make(
+        layout, inSampleRate, AudioFormat::SAMPLE_FMT_FLTP,
+        layout, inSampleRate, AudioFormat::SAMPLE_FMT_S16);
+    reference->setFastPaths(false);
+    reference->open();
+    RefPointer<MediaAudioResampler> resampler = MediaAudioResampler::make(
+        layout, inSampleRate, AudioFormat::SAMPLE_FMT_FLTP,
+        layout, inSampleRate, AudioFormat::SAMPLE_FMT_S16);
+    resampler->setFastPaths(fastPaths);
+    resampler->open();
+    TS_ASSERT_EQUALS(fastPaths != 0, resampler->usesFastPath());
+
+    RefPointer<MediaAudio> referenceOut = MediaAudio::make(4096, inSampleRate,
+        2, layout, AudioFormat::SAMPLE_FMT_FLTP);
+    std::vector<uint8_t> expected;
+    std::vector<uint8_t> actual;
+    int64_t expectedPts = 0;
+
+    MediaAudio* ins[10];
+    MediaAudio* outs[8];
+    for(int32_t i = 0; i < 8; i++)
+      outs[i] = MediaAudio::make(frameSize, inSampleRate, 2, layout,
+          AudioFormat::SAMPLE_FMT_FLTP);
+
+    // 4410 samples make 4 frames with 314 held back, then 4724 make 4
+    // more with 628 held back, which a flush puts out on its own
+    const int32_t filled[] = { 4, 4 };
+    for(int32_t call = 0; call < 2; call++) {
+      for(int32_t i = 0; i < 10; i++) {
+        ins[i] = makeAudioHelper(inputSize, inSampleRate, layout,
+            AudioFormat::SAMPLE_FMT_S16, (call * 10 + i) * inputSize,
+            call * 10 + i);
+        int32_t n = reference->resampleAudio(referenceOut.value(), ins[i]);
+        TS_ASSERT_EQUALS(inputSize, n);
+        appendAudioHelper(expected, referenceOut.value());
+      }
+      TS_ASSERT_EQUALS(filled[call], resampler->resampleBatch(outs, 8, ins, 10));
+      for(int32_t i = 0; i < filled[call]; i++) {
+        TS_ASSERT(outs[i]->isComplete());
+        TS_ASSERT_EQUALS(frameSize, outs[i]->getNumSamples());
+        TS_ASSERT_EQUALS(expectedPts, outs[i]->getTimeStamp());
+        RefPointer<Rational> tb = outs[i]->getTimeBase();
+        TS_ASSERT_EQUALS(inSampleRate, tb->getDenominator());
+        expectedPts += frameSize;
+        appendAudioHelper(actual, outs[i]);
+      }
+      for(int32_t i = 0; i < 10; i++)
+        ins[i]->release();
+    }
+    // fewer outputs than there is audio for; the rest waits for next time
+    int32_t n = resampler->resampleBatch(outs, 0, 0, 0);
+    TS_ASSERT_EQUALS(0, n);
+    n = resampler->resampleBatch(outs, 1, 0, 0);
+    TS_ASSERT_EQUALS(1, n);
+    TS_ASSERT_EQUALS(628, outs[0]->getNumSamples());
+    TS_ASSERT_EQUALS(expectedPts, outs[0]->getTimeStamp());
+    appendAudioHelper(actual, outs[0]);
+    TS_ASSERT_EQUALS(0, resampler->resampleBatch(outs, 1, 0, 0));
+
+    TS_ASSERT_EQUALS(expected.size(), actual.size());
+    TS_ASSERT(expected == actual);
+    for(int32_t i = 0; i < 8; i++)
+      outs[i]->release();
+  }
+
+  // changing the sample rate, every output but the last is whole and
+  // they follow on from each other
+  RefPointer<MediaAudioResampler> resampler = MediaAudioResampler::make(
+      layout, 48000, AudioFormat::SAMPLE_FMT_FLTP,
+      layout, inSampleRate, AudioFormat::SAMPLE_FMT_S16);
+  resampler->open();
+  MediaAudio* outs[4];
+  for(int32_t i = 0; i < 4; i++)
+    outs[i] = MediaAudio::make(frameSize, 48000, 2, layout,
+        AudioFormat::SAMPLE_FMT_FLTP);
+  int64_t total = 0;
+  int64_t nextPts = 0;
+  for(int32_t call = 0; call < 11; call++) {
+    RefPointer<MediaAudio> in = call < 10 ? makeAudioHelper(inputSize,
+        inSampleRate, layout, AudioFormat::SAMPLE_FMT_S16, call * inputSize,
+        call) : 0;
+    MediaAudio* ins[1] = { in.value() };
+    int32_t n = resampler->resampleBatch(outs, 4, ins, in ? 1 : 0);
+    for(int32_t i = 0; i < n; i++) {
+      if (in)
+        TS_ASSERT_EQUALS(frameSize, outs[i]->getNumSamples());
+      RefPointer<Rational> tb = outs[i]->getTimeBase();
+      int64_t pts = Rational::rescale(outs[i]->getTimeStamp(), 1, 48000,
+          tb->getNumerator(), tb->getDenominator(), Rational::ROUND_DOWN);
+      if (total)
+        TS_ASSERT_EQUALS(nextPts, pts);
+      nextPts = pts + outs[i]->getNumSamples();
+      total += outs[i]->getNumSamples();
+    }
+  }
+  // 4410 input samples make 4800 output samples, give or take the filter
+  TS_ASSERT_LESS_THAN_EQUALS(4790, total);
+  TS_ASSERT_LESS_THAN_EQUALS(total, 4810);
+  for(int32_t i = 0; i < 4; i++)
+    outs[i]->release();
+}
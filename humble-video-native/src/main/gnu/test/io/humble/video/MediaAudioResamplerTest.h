@@ -42,6 +42,8 @@ public:
   void testResampleErrors();
   void testResample();
   void testFlushResampler();
+  void testFastPath();
+  void testResampleBatch();
 private:
   void writeAudio(FILE* output, io::humble::video::MediaAudio* audio,
       io::humble::video::MediaAudioResampler*,
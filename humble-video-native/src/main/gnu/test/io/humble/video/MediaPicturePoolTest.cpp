@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "MediaPicturePoolTest.h"
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/ferry/LoggerStack.h>
+#include <io/humble/ferry/HumbleException.h>
+
+using namespace io::humble::video;
+using namespace io::humble::ferry;
+
+MediaPicturePoolTest::MediaPicturePoolTest() {
+}
+
+MediaPicturePoolTest::~MediaPicturePoolTest() {
+}
+
+void
+MediaPicturePoolTest::testMake() {
+  RefPointer<MediaPicturePool> pool = MediaPicturePool::make(320, 240,
+      PixelFormat::PIX_FMT_YUV420P, 4);
+  TS_ASSERT(pool);
+  TS_ASSERT_EQUALS(320, pool->getWidth());
+  TS_ASSERT_EQUALS(240, pool->getHeight());
+  TS_ASSERT_EQUALS(PixelFormat::PIX_FMT_YUV420P, pool->getFormat());
+  TS_ASSERT_EQUALS(4, pool->getCapacity());
+  TS_ASSERT_EQUALS(0, pool->getNumIdle());
+
+  LoggerStack stack;
+  stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+  TS_ASSERT_THROWS(MediaPicturePool::make(0, 240,
+      PixelFormat::PIX_FMT_YUV420P, 4), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaPicturePool::make(320, -1,
+      PixelFormat::PIX_FMT_YUV420P, 4), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaPicturePool::make(320, 240,
+      PixelFormat::PIX_FMT_NONE, 4), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(MediaPicturePool::make(320, 240,
+      PixelFormat::PIX_FMT_YUV420P, -1), HumbleInvalidArgument);
+}
+
+void
+MediaPicturePoolTest::testReuse() {
+  RefPointer<MediaPicturePool> pool = MediaPicturePool::make(64, 48,
+      PixelFormat::PIX_FMT_YUV420P, 2);
+  RefPointer<Rational> timeBase = Rational::make(1, 30);
+
+  RefPointer<MediaPicture> picture = pool->getPicture();
+  TS_ASSERT_EQUALS(64, picture->getWidth());
+  TS_ASSERT_EQUALS(48, picture->getHeight());
+  TS_ASSERT_EQUALS(PixelFormat::PIX_FMT_YUV420P, picture->getFormat());
+  TS_ASSERT_EQUALS(1, pool->getNumAllocated());
+  MediaPicture* first = picture.value();
+  RefPointer<Buffer> plane = picture->getData(0);
+  uint8_t* data = (uint8_t*)plane->getBytes(0, 1);
+  plane = 0;
+  picture->setTimeStamp(1234);
+  picture->setTimeBase(timeBase.value());
+  picture->setComplete(true);
+  picture->setInterlacedFrame(true);
+
+  picture = 0;
+  TS_ASSERT_EQUALS(1, pool->getNumIdle());
+  TS_ASSERT_EQUALS(1, pool->getNumRecycled());
+
+  // comes back with its data, but looking like a new picture
+  picture = pool->getPicture();
+  TS_ASSERT_EQUALS(first, picture.value());
+  TS_ASSERT_EQUALS(0, pool->getNumIdle());
+  TS_ASSERT_EQUALS(1, pool->getNumReused());
+  TS_ASSERT_EQUALS(1, pool->getNumAllocated());
+  TS_ASSERT_EQUALS(1, picture->getCurrentRefCount());
+  plane = picture->getData(0);
+  TS_ASSERT_EQUALS(data, (uint8_t*)plane->getBytes(0, 1));
+  plane = 0;
+  TS_ASSERT(!picture->isComplete());
+  TS_ASSERT(!picture->isInterlacedFrame());
+  TS_ASSERT_EQUALS(Global::NO_PTS, picture->getTimeStamp());
+  RefPointer<Rational> reset = picture->getTimeBase();
+  TS_ASSERT(!reset || reset->compareTo(timeBase.value()) != 0);
+
+  // and is still a working picture
+  picture->setComplete(true);
+  TS_ASSERT(picture->isComplete());
+
+  pool->resetStatistics();
+  TS_ASSERT_EQUALS(0, pool->getNumReused());
+  TS_ASSERT_EQUALS(0, pool->getNumAllocated());
+  TS_ASSERT_EQUALS(0, pool->getNumRecycled());
+  TS_ASSERT_EQUALS(0, pool->getNumDiscarded());
+}
+
+void
+MediaPicturePoolTest::testCapacity() {
+  const int32_t capacity = 3;
+  RefPointer<MediaPicturePool> pool = MediaPicturePool::make(32, 32,
+      PixelFormat::PIX_FMT_RGB24, capacity);
+  RefPointer<MediaPicture> pictures[capacity + 2];
+  for(int32_t i = 0; i < capacity + 2; i++)
+    pictures[i] = pool->getPicture();
+  TS_ASSERT_EQUALS(capacity + 2, pool->getNumAllocated());
+  for(int32_t i = 0; i < capacity + 2; i++)
+    pictures[i] = 0;
+  TS_ASSERT_EQUALS(capacity, pool->getNumIdle());
+  TS_ASSERT_EQUALS(capacity, pool->getNumRecycled());
+  TS_ASSERT_EQUALS(2, pool->getNumDiscarded());
+
+  // a steady loop allocates nothing once the pool is warm
+  pool->resetStatistics();
+  for(int32_t i = 0; i < 100; i++) {
+    RefPointer<MediaPicture> picture = pool->getPicture();
+    picture->setTimeStamp(i);
+  }
+  TS_ASSERT_EQUALS(0, pool->getNumAllocated());
+  TS_ASSERT_EQUALS(100, pool->getNumReused());
+
+  RefPointer<MediaPicturePool> none = MediaPicturePool::make(32, 32,
+      PixelFormat::PIX_FMT_RGB24, 0);
+  RefPointer<MediaPicture> picture = none->getPicture();
+  picture = 0;
+  TS_ASSERT_EQUALS(0, none->getNumIdle());
+  TS_ASSERT_EQUALS(1, none->getNumDiscarded());
+}
+
+void
+MediaPicturePoolTest::testSharedDataNotReused() {
+  RefPointer<MediaPicturePool> pool = MediaPicturePool::make(64, 48,
+      PixelFormat::PIX_FMT_YUV420P, 4);
+
+  // a view still reads the planes, so they can't be handed out again
+  RefPointer<MediaPicture> picture = pool->getPicture();
+  RefPointer<MediaPicture> view = MediaPicture::makeView(picture.value(),
+      0, 0, 32, 24);
+  picture = 0;
+  TS_ASSERT_EQUALS(0, pool->getNumIdle());
+  TS_ASSERT_EQUALS(1, pool->getNumDiscarded());
+  view = 0;
+
+  // nor can planes another picture references
+  picture = pool->getPicture();
+  RefPointer<MediaPicture> other = MediaPicture::make(picture.value(), false);
+  picture = 0;
+  TS_ASSERT_EQUALS(0, pool->getNumIdle());
+  TS_ASSERT_EQUALS(2, pool->getNumDiscarded());
+  other = 0;
+
+  // once nothing else holds them they go back as usual
+  picture = pool->getPicture();
+  picture = 0;
+  TS_ASSERT_EQUALS(1, pool->getNumIdle());
+}
+
+void
+MediaPicturePoolTest::testPoolOutlivesPictures() {
+  RefPointer<MediaPicturePool> pool = MediaPicturePool::make(16, 16,
+      PixelFormat::PIX_FMT_GRAY8, 2);
+  RefPointer<MediaPicture> picture = pool->getPicture();
+  TS_ASSERT_EQUALS(2, pool->getCurrentRefCount());
+  MediaPicturePool* raw = pool.value();
+  pool = 0;
+
+  // the picture keeps the pool alive, and the pool takes it back
+  TS_ASSERT_EQUALS(1, raw->getCurrentRefCount());
+  picture = 0;
+}
@@ -26,6 +26,7 @@
 #include "MediaPictureResamplerTest.h"
 #include <io/humble/ferry/RefPointer.h>
 #include <io/humble/ferry/LoggerStack.h>
+#include <io/humble/ferry/HumbleException.h>
 
 #include <io/humble/video/MediaPicture.h>
 #include <io/humble/video/MediaPictureResampler.h>
@@ -33,9 +34,204 @@
 #include <io/humble/video/Decoder.h>
 #include "lodepng.h"
 
+#include <cstring>
+#include <vector>
+
 using namespace io::humble::ferry;
 using namespace io::humble::video;
 
+namespace {
+
+/** Rows in a plane of pictures the threaded tests use. */
+int32_t
+MediaPictureResamplerTest_planeHeight(MediaPicture* picture, int32_t plane) {
+  int32_t height = picture->getHeight();
+  if ((picture->getFormat() == PixelFormat::PIX_FMT_YUV420P ||
+      picture->getFormat() == PixelFormat::PIX_FMT_NV12) && plane)
+    return (height + 1) / 2;
+  return height;
+}
+
+/** Bytes of picture data in a row of a plane, not counting any padding. */
+int32_t
+MediaPictureResamplerTest_rowBytes(MediaPicture* picture, int32_t plane) {
+  int32_t width = picture->getWidth();
+  switch(picture->getFormat()) {
+  case PixelFormat::PIX_FMT_YUV420P:
+    return plane ? (width + 1) / 2 : width;
+  case PixelFormat::PIX_FMT_NV12:
+    return plane ? (width + 1) / 2 * 2 : width;
+  case PixelFormat::PIX_FMT_GRAY8:
+    return width;
+  case PixelFormat::PIX_FMT_RGB565LE:
+    return width * 2;
+  case PixelFormat::PIX_FMT_BGR24:
+    return width * 3;
+  default:
+    return width * 4;
+  }
+}
+
+MediaPicture*
+MediaPictureResamplerTest_picture(int32_t width, int32_t height,
+    PixelFormat::Type format) {
+  RefPointer<MediaPicture> picture = MediaPicture::make(width, height, format);
+  // smooth gradients with some noise, so every filter tap matters
+  uint32_t seed = 12345;
+  for(int32_t i = 0; i < picture->getNumDataPlanes(); i++) {
+    RefPointer<Buffer> plane = picture->getData(i);
+    int32_t lineSize = picture->getLineSize(i);
+    int32_t rows = MediaPictureResamplerTest_planeHeight(picture.value(), i);
+    uint8_t* bytes = (uint8_t*)plane->getBytes(0, lineSize * rows);
+    for(int32_t y = 0; y < rows; y++)
+      for(int32_t x = 0; x < lineSize; x++) {
+        seed = seed * 1103515245 + 12345;
+        bytes[y * lineSize + x] = (uint8_t)(x + 3 * y + i * 50 +
+            ((seed >> 16) & 0x1f));
+      }
+  }
+  picture->setComplete(true);
+  return picture.get();
+}
+
+/**
+ * Like MediaPictureResamplerTest_picture() but without the gradients
+ * wrapping round, as natural pictures do not jump from white to black.
+ */
+MediaPicture*
+MediaPictureResamplerTest_smoothPicture(int32_t width, int32_t height,
+    PixelFormat::Type format) {
+  RefPointer<MediaPicture> picture = MediaPicture::make(width, height, format);
+  uint32_t seed = 12345;
+  for(int32_t i = 0; i < picture->getNumDataPlanes(); i++) {
+    RefPointer<Buffer> plane = picture->getData(i);
+    int32_t lineSize = picture->getLineSize(i);
+    int32_t rows = MediaPictureResamplerTest_planeHeight(picture.value(), i);
+    uint8_t* bytes = (uint8_t*)plane->getBytes(0, lineSize * rows);
+    for(int32_t y = 0; y < rows; y++)
+      for(int32_t x = 0; x < lineSize; x++) {
+        seed = seed * 1103515245 + 12345;
+        bytes[y * lineSize + x] = (uint8_t)(32 + x * 128 / lineSize +
+            y * 64 / rows + i * 8 + ((seed >> 16) & 0xf));
+      }
+  }
+  picture->setComplete(true);
+  return picture.get();
+}
+
+/**
+ * Resamples in with the dedicated routines and with swscale, and returns
+ * the largest difference between any two output bytes, or -1 if no
+ * dedicated routine applies.
+ */
+int32_t
+MediaPictureResamplerTest_fastError(MediaPicture* in, int32_t width,
+    int32_t height, PixelFormat::Type format) {
+  RefPointer<MediaPicture> out[2];
+  for(int32_t i = 0; i < 2; i++) {
+    out[i] = MediaPicture::make(width, height, format);
+    RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+        width, height, format, in->getWidth(), in->getHeight(), in->getFormat(),
+        0);
+    resampler->setFastPaths(i == 0);
+    resampler->open();
+    if (resampler->usesFastPath() != (i == 0))
+      return -1;
+    resampler->resamplePicture(out[i].value(), in);
+  }
+  int32_t retval = 0;
+  // GRAY8's second plane is a palette neither writes
+  int32_t planes = format == PixelFormat::PIX_FMT_GRAY8 ? 1 :
+      out[0]->getNumDataPlanes();
+  for(int32_t i = 0; i < planes; i++) {
+    int32_t rows = MediaPictureResamplerTest_planeHeight(out[0].value(), i);
+    int32_t rowBytes = MediaPictureResamplerTest_rowBytes(out[0].value(), i);
+    RefPointer<Buffer> a = out[0]->getData(i);
+    RefPointer<Buffer> b = out[1]->getData(i);
+    const uint8_t* aBytes = (const uint8_t*)a->getBytes(0, out[0]->getLineSize(i) * rows);
+    const uint8_t* bBytes = (const uint8_t*)b->getBytes(0, out[1]->getLineSize(i) * rows);
+    for(int32_t y = 0; y < rows; y++)
+      for(int32_t x = 0; x < rowBytes; x++) {
+        int32_t diff = aBytes[y * out[0]->getLineSize(i) + x] -
+            bBytes[y * out[1]->getLineSize(i) + x];
+        if (diff < 0)
+          diff = -diff;
+        if (diff > retval)
+          retval = diff;
+      }
+  }
+  return retval;
+}
+
+/**
+ * Resamples in to a packed picture and to bytes with the same parameters,
+ * and returns true if both give the same output.
+ */
+bool
+MediaPictureResamplerTest_toBytes(MediaPicture* in, int32_t width,
+    int32_t height, bool fastPaths, int32_t threads) {
+  RefPointer<MediaPicture> packed = MediaPicture::make(width, height,
+      PixelFormat::PIX_FMT_BGR24, 1);
+  RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+      width, height, PixelFormat::PIX_FMT_BGR24, in->getWidth(),
+      in->getHeight(), in->getFormat(), 0);
+  resampler->setFastPaths(fastPaths);
+  resampler->setThreads(threads);
+  resampler->open();
+  resampler->resamplePicture(packed.value(), in);
+
+  int32_t size = 3 * width * height;
+  std::vector<uint8_t> bytes(size);
+  resampler->checkResampleToBytes(size, in);
+  if (resampler->resampleToBytes(&bytes[0], in) != height)
+    return false;
+  RefPointer<Buffer> buffer = packed->getData(0);
+  return !memcmp(buffer->getBytes(0, size), &bytes[0], size);
+}
+
+/**
+ * Resamples in with one thread and with threads, and returns the number
+ * of bands the threaded resampler used, or -1 if the outputs differ.
+ */
+int32_t
+MediaPictureResamplerTest_compare(MediaPicture* in, int32_t width,
+    int32_t height, PixelFormat::Type format, int32_t flags, int32_t threads) {
+  RefPointer<MediaPicture> single = MediaPicture::make(width, height, format);
+  RefPointer<MediaPicture> banded = MediaPicture::make(width, height, format);
+  RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+      width, height, format, in->getWidth(), in->getHeight(), in->getFormat(),
+      flags);
+  // bands only split the general rescaler
+  resampler->setFastPaths(false);
+  resampler->open();
+  resampler->resamplePicture(single.value(), in);
+  resampler = MediaPictureResampler::make(
+      width, height, format, in->getWidth(), in->getHeight(), in->getFormat(),
+      flags);
+  resampler->setFastPaths(false);
+  resampler->setThreads(threads);
+  resampler->open();
+  resampler->resamplePicture(banded.value(), in);
+  if (!banded->isComplete())
+    return -1;
+
+  for(int32_t i = 0; i < single->getNumDataPlanes(); i++) {
+    int32_t rows = MediaPictureResamplerTest_planeHeight(single.value(), i);
+    int32_t rowBytes = MediaPictureResamplerTest_rowBytes(single.value(), i);
+    RefPointer<Buffer> a = single->getData(i);
+    RefPointer<Buffer> b = banded->getData(i);
+    const uint8_t* aBytes = (const uint8_t*)a->getBytes(0, single->getLineSize(i) * rows);
+    const uint8_t* bBytes = (const uint8_t*)b->getBytes(0, banded->getLineSize(i) * rows);
+    for(int32_t y = 0; y < rows; y++)
+      if (memcmp(aBytes + y * single->getLineSize(i),
+          bBytes + y * banded->getLineSize(i), rowBytes))
+        return -1;
+  }
+  return resampler->getNumBands();
+}
+
+}
+
 MediaPictureResamplerTest::MediaPictureResamplerTest() {
 }
 
@@ -188,3 +384,306 @@ MediaPictureResamplerTest::testCreation()
   resampler = MediaPictureResampler::make(oWidth, oHeight, oFormat, iWidth, iHeight, iFormat, 0);
   TS_ASSERT(resampler);
 }
+
+void
+MediaPictureResamplerTest::testThreads() {
+  RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+      1280, 720, PixelFormat::PIX_FMT_YUV420P,
+      3840, 2160, PixelFormat::PIX_FMT_YUV420P, 0);
+  TS_ASSERT_EQUALS(1, resampler->getThreads());
+  TS_ASSERT_EQUALS(1, resampler->getNumBands());
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(resampler->setThreads(-1), HumbleInvalidArgument);
+  }
+  resampler->setThreads(4);
+  TS_ASSERT_EQUALS(4, resampler->getThreads());
+  resampler->open();
+  TS_ASSERT_EQUALS(4, resampler->getNumBands());
+
+  // 720 to 1080 is not exact in 1/65536ths, so it cannot be split
+  resampler = MediaPictureResampler::make(
+      1920, 1080, PixelFormat::PIX_FMT_YUV420P,
+      1280, 720, PixelFormat::PIX_FMT_YUV420P, 0);
+  resampler->setThreads(4);
+  resampler->open();
+  TS_ASSERT_EQUALS(1, resampler->getNumBands());
+
+  // nor can error diffusion dithering
+  resampler = MediaPictureResampler::make(
+      960, 540, PixelFormat::PIX_FMT_BGR24,
+      1920, 1080, PixelFormat::PIX_FMT_YUV420P,
+      MediaPictureResampler::FLAG_ERROR_DIFFUSION);
+  resampler->setThreads(4);
+  resampler->open();
+  TS_ASSERT_EQUALS(1, resampler->getNumBands());
+
+  // including when swscale picks it itself
+  resampler = MediaPictureResampler::make(
+      960, 540, PixelFormat::PIX_FMT_RGB8,
+      1920, 1080, PixelFormat::PIX_FMT_YUV420P,
+      MediaPictureResampler::FLAG_FULL_CHR_H_INT);
+  resampler->setThreads(4);
+  resampler->open();
+  TS_ASSERT_EQUALS(1, resampler->getNumBands());
+}
+
+void
+MediaPictureResamplerTest::testThreadsBitExact() {
+  RefPointer<MediaPicture> uhd = MediaPictureResamplerTest_picture(3840, 2160,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> hd = MediaPictureResamplerTest_picture(1920, 1080,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> qhd = MediaPictureResamplerTest_picture(960, 540,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> rgb = MediaPictureResamplerTest_picture(1920, 1080,
+      PixelFormat::PIX_FMT_BGR24);
+  const PixelFormat::Type yuv = PixelFormat::PIX_FMT_YUV420P;
+
+  // 4K to a ladder of renditions, with the filters the resampler picks
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(uhd.value(), 1920, 1080, yuv, 0, 4));
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(uhd.value(), 1280, 720, yuv, 0, 8));
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(uhd.value(), 960, 540, yuv, 0, 3));
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(hd.value(), 640, 360, yuv, 0, 4));
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(hd.value(), 1280, 720, yuv, 0, 4));
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(uhd.value(), 1280, 720, yuv,
+      MediaPictureResampler::FLAG_ACCURATE_RND, 4));
+  // upscaling
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(qhd.value(), 1920, 1080, yuv, 0, 4));
+  // converting, with ordered dithering, to and from RGB
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(hd.value(), 960, 540,
+      PixelFormat::PIX_FMT_BGR24, 0, 4));
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(hd.value(), 1920, 1080,
+      PixelFormat::PIX_FMT_RGB565LE, 0, 4));
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(hd.value(), 960, 540,
+      PixelFormat::PIX_FMT_BGR24, MediaPictureResampler::FLAG_FULL_CHR_H_INT, 4));
+  TS_ASSERT_LESS_THAN(1, MediaPictureResamplerTest_compare(rgb.value(), 640, 360, yuv, 0, 4));
+  // pictures that cannot be split still resample
+  TS_ASSERT_EQUALS(1, MediaPictureResamplerTest_compare(hd.value(), 1280, 800, yuv, 0, 4));
+}
+
+void
+MediaPictureResamplerTest::testCache() {
+  TS_ASSERT_EQUALS(16, MediaPictureResampler::getCacheSize());
+  // start empty, whatever earlier tests left behind
+  MediaPictureResampler::setCacheSize(0);
+  MediaPictureResampler::setCacheSize(2);
+  MediaPictureResampler::resetCacheStatistics();
+  TS_ASSERT_EQUALS(0, MediaPictureResampler::getCacheHits());
+
+  RefPointer<MediaPicture> in = MediaPictureResamplerTest_picture(352, 288,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> fresh = MediaPicture::make(176, 144,
+      PixelFormat::PIX_FMT_BGR24);
+  RefPointer<MediaPicture> reused = MediaPicture::make(176, 144,
+      PixelFormat::PIX_FMT_BGR24);
+
+  RefPointer<MediaPictureResampler> a = MediaPictureResampler::make(
+      176, 144, PixelFormat::PIX_FMT_BGR24, 352, 288, PixelFormat::PIX_FMT_YUV420P, 0);
+  TS_ASSERT_EQUALS(1, MediaPictureResampler::getCacheMisses());
+  a->open();
+  a->resamplePicture(fresh.value(), in.value());
+
+  // a second resampler while the first is in use sets up its own
+  RefPointer<MediaPictureResampler> b = MediaPictureResampler::make(
+      176, 144, PixelFormat::PIX_FMT_BGR24, 352, 288, PixelFormat::PIX_FMT_YUV420P, 0);
+  TS_ASSERT_EQUALS(0, MediaPictureResampler::getCacheHits());
+  TS_ASSERT_EQUALS(2, MediaPictureResampler::getCacheMisses());
+
+  // once they are deleted, the next ones take their rescalers over
+  a = 0;
+  b = 0;
+  a = MediaPictureResampler::make(
+      176, 144, PixelFormat::PIX_FMT_BGR24, 352, 288, PixelFormat::PIX_FMT_YUV420P, 0);
+  b = MediaPictureResampler::make(
+      176, 144, PixelFormat::PIX_FMT_BGR24, 352, 288, PixelFormat::PIX_FMT_YUV420P, 0);
+  TS_ASSERT_EQUALS(2, MediaPictureResampler::getCacheHits());
+  TS_ASSERT_EQUALS(2, MediaPictureResampler::getCacheMisses());
+
+  // and scale the same
+  a->open();
+  a->resamplePicture(reused.value(), in.value());
+  RefPointer<Buffer> freshData = fresh->getData(0);
+  RefPointer<Buffer> reusedData = reused->getData(0);
+  for(int32_t y = 0; y < 144; y++)
+    TS_ASSERT_SAME_DATA(
+        (const uint8_t*)freshData->getBytes(0, fresh->getLineSize(0) * 144) +
+            y * fresh->getLineSize(0),
+        (const uint8_t*)reusedData->getBytes(0, reused->getLineSize(0) * 144) +
+            y * reused->getLineSize(0),
+        176 * 3);
+
+  // different flags do not match
+  RefPointer<MediaPictureResampler> other = MediaPictureResampler::make(
+      176, 144, PixelFormat::PIX_FMT_BGR24, 352, 288, PixelFormat::PIX_FMT_YUV420P,
+      MediaPictureResampler::FLAG_ACCURATE_RND);
+  TS_ASSERT_EQUALS(2, MediaPictureResampler::getCacheHits());
+  TS_ASSERT_EQUALS(3, MediaPictureResampler::getCacheMisses());
+  other = 0;
+
+  // rescalers whose options were changed are not kept
+  a->setProperty("sws_dither", "none");
+  a = 0;
+  b = 0;
+  a = MediaPictureResampler::make(
+      176, 144, PixelFormat::PIX_FMT_BGR24, 352, 288, PixelFormat::PIX_FMT_YUV420P, 0);
+  b = MediaPictureResampler::make(
+      176, 144, PixelFormat::PIX_FMT_BGR24, 352, 288, PixelFormat::PIX_FMT_YUV420P, 0);
+  TS_ASSERT_EQUALS(3, MediaPictureResampler::getCacheHits());
+  TS_ASSERT_EQUALS(4, MediaPictureResampler::getCacheMisses());
+
+  // with room for two, the least recently used of three is freed
+  TS_ASSERT_EQUALS(0, MediaPictureResampler::getCacheEvictions());
+  a = 0;
+  b = 0;
+  TS_ASSERT_EQUALS(1, MediaPictureResampler::getCacheEvictions());
+  MediaPictureResampler::setCacheSize(0);
+  TS_ASSERT_EQUALS(3, MediaPictureResampler::getCacheEvictions());
+  a = MediaPictureResampler::make(
+      176, 144, PixelFormat::PIX_FMT_BGR24, 352, 288, PixelFormat::PIX_FMT_YUV420P, 0);
+  TS_ASSERT_EQUALS(3, MediaPictureResampler::getCacheHits());
+
+  MediaPictureResampler::setCacheSize(16);
+}
+
+void
+MediaPictureResamplerTest::testFastPaths() {
+  RefPointer<MediaPicture> in = MediaPictureResamplerTest_picture(704, 576,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> fast = MediaPicture::make(352, 288,
+      PixelFormat::PIX_FMT_BGR24);
+  RefPointer<MediaPicture> general = MediaPicture::make(352, 288,
+      PixelFormat::PIX_FMT_BGR24);
+
+  RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+      352, 288, PixelFormat::PIX_FMT_BGR24, 704, 576, PixelFormat::PIX_FMT_YUV420P, 0);
+  // they only agree with swscale to within a few levels, so ask for them
+  TS_ASSERT(!resampler->getFastPaths());
+  resampler->setFastPaths(true);
+  TS_ASSERT(resampler->getFastPaths());
+  TS_ASSERT(!resampler->usesFastPath());
+  resampler->setThreads(4);
+  resampler->open();
+  TS_ASSERT(resampler->usesFastPath());
+  TS_ASSERT_EQUALS(1, resampler->getNumBands());
+  TS_ASSERT_EQUALS(288, resampler->resamplePicture(fast.value(), in.value()));
+  TS_ASSERT(fast->isComplete());
+
+  resampler = MediaPictureResampler::make(
+      352, 288, PixelFormat::PIX_FMT_BGR24, 704, 576, PixelFormat::PIX_FMT_YUV420P, 0);
+  TS_ASSERT(!resampler->getFastPaths());
+  resampler->open();
+  TS_ASSERT(!resampler->usesFastPath());
+  resampler->resamplePicture(general.value(), in.value());
+  TS_ASSERT(general->isComplete());
+
+  // flags asking for swscale's own rounding keep it
+  resampler = MediaPictureResampler::make(
+      352, 288, PixelFormat::PIX_FMT_BGR24, 704, 576, PixelFormat::PIX_FMT_YUV420P,
+      MediaPictureResampler::FLAG_ACCURATE_RND);
+  resampler->setFastPaths(true);
+  resampler->open();
+  TS_ASSERT(!resampler->usesFastPath());
+  // as do sizes and formats it has no routine for
+  resampler = MediaPictureResampler::make(
+      320, 240, PixelFormat::PIX_FMT_BGR24, 704, 576, PixelFormat::PIX_FMT_YUV420P, 0);
+  resampler->setFastPaths(true);
+  resampler->open();
+  TS_ASSERT(!resampler->usesFastPath());
+  resampler = MediaPictureResampler::make(
+      352, 288, PixelFormat::PIX_FMT_RGB24, 352, 288, PixelFormat::PIX_FMT_YUV420P, 0);
+  resampler->setFastPaths(true);
+  resampler->open();
+  TS_ASSERT(!resampler->usesFastPath());
+}
+
+void
+MediaPictureResamplerTest::testFastPathsMatchSwscale() {
+  // chroma is repeated rather than interpolated, so where it changes from
+  // one sample to the next, as the noise here makes it, packed output can
+  // be this many levels from what swscale gives
+  const int32_t tolerance = 20;
+  const PixelFormat::Type planar[] = { PixelFormat::PIX_FMT_YUV420P,
+      PixelFormat::PIX_FMT_NV12 };
+  const PixelFormat::Type packed[] = { PixelFormat::PIX_FMT_BGR24,
+      PixelFormat::PIX_FMT_RGBA, PixelFormat::PIX_FMT_GRAY8 };
+  for(int32_t i = 0; i < 2; i++)
+    for(int32_t j = 0; j < 3; j++)
+      for(int32_t scale = 1; scale <= 2; scale++) {
+        RefPointer<MediaPicture> in = MediaPictureResamplerTest_smoothPicture(
+            352, 288, planar[i]);
+        int32_t error = MediaPictureResamplerTest_fastError(in.value(),
+            352 / scale, 288 / scale, packed[j]);
+        TS_ASSERT_LESS_THAN_EQUALS(0, error);
+        TS_ASSERT_LESS_THAN_EQUALS(error, tolerance);
+
+        in = MediaPictureResamplerTest_smoothPicture(352, 288, packed[j]);
+        error = MediaPictureResamplerTest_fastError(in.value(),
+            352 / scale, 288 / scale, planar[i]);
+        TS_ASSERT_LESS_THAN_EQUALS(0, error);
+        TS_ASSERT_LESS_THAN_EQUALS(error, tolerance);
+      }
+}
+
+void
+MediaPictureResamplerTest::testBytes() {
+  RefPointer<MediaPicture> in = MediaPictureResamplerTest_picture(704, 576,
+      PixelFormat::PIX_FMT_YUV420P);
+  // the fast path, swscale, and swscale in bands
+  TS_ASSERT(MediaPictureResamplerTest_toBytes(in.value(), 352, 288, true, 1));
+  TS_ASSERT(MediaPictureResamplerTest_toBytes(in.value(), 352, 288, false, 1));
+  TS_ASSERT(MediaPictureResamplerTest_toBytes(in.value(), 352, 288, false, 4));
+
+  // and back again
+  RefPointer<MediaPicture> bgr = MediaPicture::make(352, 288,
+      PixelFormat::PIX_FMT_BGR24, 1);
+  RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+      352, 288, PixelFormat::PIX_FMT_BGR24, 704, 576,
+      PixelFormat::PIX_FMT_YUV420P, 0);
+  resampler->open();
+  resampler->resamplePicture(bgr.value(), in.value());
+  int32_t size = 3 * 352 * 288;
+  RefPointer<Buffer> bgrBuffer = bgr->getData(0);
+  const uint8_t* bgrBytes = (const uint8_t*)bgrBuffer->getBytes(0, size);
+
+  RefPointer<MediaPicture> expected = MediaPicture::make(352, 288,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> actual = MediaPicture::make(352, 288,
+      PixelFormat::PIX_FMT_YUV420P);
+  resampler = MediaPictureResampler::make(352, 288,
+      PixelFormat::PIX_FMT_YUV420P, 352, 288, PixelFormat::PIX_FMT_BGR24, 0);
+  resampler->open();
+  resampler->resamplePicture(expected.value(), bgr.value());
+  resampler->checkResampleFromBytes(actual.value(), size);
+  TS_ASSERT_EQUALS(288, resampler->resampleFromBytes(actual.value(), bgrBytes));
+  TS_ASSERT(actual->isComplete());
+  for(int32_t i = 0; i < expected->getNumDataPlanes(); i++) {
+    int32_t rows = MediaPictureResamplerTest_planeHeight(expected.value(), i);
+    int32_t rowBytes = MediaPictureResamplerTest_rowBytes(expected.value(), i);
+    RefPointer<Buffer> a = expected->getData(i);
+    RefPointer<Buffer> b = actual->getData(i);
+    const uint8_t* aBytes = (const uint8_t*)a->getBytes(0, expected->getLineSize(i) * rows);
+    const uint8_t* bBytes = (const uint8_t*)b->getBytes(0, actual->getLineSize(i) * rows);
+    for(int32_t y = 0; y < rows; y++)
+      TS_ASSERT(!memcmp(aBytes + y * expected->getLineSize(i),
+          bBytes + y * actual->getLineSize(i), rowBytes));
+  }
+
+  // the checks are what stand between bad arguments and the bytes
+  LoggerStack stack;
+  stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+  TS_ASSERT_THROWS(resampler->checkResampleFromBytes(actual.value(), size - 1),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(resampler->checkResampleFromBytes(bgr.value(), size),
+      HumbleInvalidArgument);
+  resampler = MediaPictureResampler::make(352, 288, PixelFormat::PIX_FMT_BGR24,
+      704, 576, PixelFormat::PIX_FMT_YUV420P, 0);
+  TS_ASSERT_THROWS(resampler->checkResampleToBytes(size, in.value()),
+      HumbleRuntimeError);
+  resampler->open();
+  TS_ASSERT_THROWS(resampler->checkResampleToBytes(size - 1, in.value()),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(resampler->checkResampleToBytes(size, bgr.value()),
+      HumbleInvalidArgument);
+}
@@ -39,6 +39,12 @@ public:
   ~MediaPictureResamplerTest();
   void testCreation();
   void testRescale();
+  void testThreads();
+  void testThreadsBitExact();
+  void testCache();
+  void testFastPaths();
+  void testFastPathsMatchSwscale();
+  void testBytes();
 private:
   void writePicture(const char* prefix, int32_t* frameNo,
       io::humble::video::MediaPicture* picture,
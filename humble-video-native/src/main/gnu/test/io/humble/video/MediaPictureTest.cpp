@@ -26,13 +26,103 @@
 #include <io/humble/ferry/RefPointer.h>
 #include <io/humble/ferry/LoggerStack.h>
 #include <io/humble/ferry/HumbleException.h>
+#include <io/humble/ferry/Logger.h>
 
 #include <io/humble/video/MediaPicture.h>
+#include <io/humble/video/MediaPictureResampler.h>
+#include <io/humble/video/FilterGraph.h>
+#include <io/humble/video/FilterPictureSource.h>
+#include <io/humble/video/FilterPictureSink.h>
+#include <io/humble/video/Encoder.h>
+#include <io/humble/video/Codec.h>
 #include "MediaPictureTest.h"
 
+#include <cstring>
+
 using namespace io::humble::ferry;
 using namespace io::humble::video;
 
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+namespace {
+
+/** The address of byte x of row y in a plane of picture. */
+uint8_t*
+MediaPictureTest_at(MediaPicture* picture, int32_t plane, int32_t x, int32_t y) {
+  RefPointer<Buffer> buffer = picture->getData(plane);
+  uint8_t* data = (uint8_t*)buffer->getBytes(0, 1);
+  return data + y * picture->getLineSize(plane) + x;
+}
+
+MediaPicture*
+MediaPictureTest_pattern(int32_t width, int32_t height, PixelFormat::Type format) {
+  RefPointer<MediaPicture> picture = MediaPicture::make(width, height, format);
+  for(int32_t i = 0; i < picture->getNumDataPlanes(); i++) {
+    // every format used here has half height chroma, if any
+    int32_t rows = i ? (height + 1) / 2 : height;
+    int32_t size = picture->getLineSize(i) * rows;
+    RefPointer<Buffer> buffer = picture->getData(i);
+    uint8_t* data = (uint8_t*)buffer->getBytes(0, size);
+    for(int32_t j = 0; j < size; j++)
+      data[j] = (uint8_t)(j * 7 + i * 31);
+  }
+  picture->setComplete(true);
+  return picture.get();
+}
+
+/** Copies a rectangle of a yuv420p picture into a picture of its own. */
+MediaPicture*
+MediaPictureTest_crop(MediaPicture* src, int32_t x, int32_t y, int32_t width,
+    int32_t height) {
+  RefPointer<MediaPicture> picture = MediaPicture::make(width, height,
+      PixelFormat::PIX_FMT_YUV420P);
+  for(int32_t i = 0; i < 3; i++) {
+    int32_t shift = i ? 1 : 0;
+    for(int32_t row = 0; row < (height + shift) >> shift; row++)
+      memcpy(MediaPictureTest_at(picture.value(), i, 0, row),
+          MediaPictureTest_at(src, i, x >> shift, (y >> shift) + row),
+          (width + shift) >> shift);
+  }
+  picture->setComplete(true);
+  return picture.get();
+}
+
+/** Microseconds per picture to resample pictures from in to out. */
+double
+MediaPictureTest_resampleTime(MediaPictureResampler* resampler, MediaPicture* out,
+    MediaPicture* in, int32_t iterations) {
+  int64_t start = av_gettime();
+  for(int32_t i = 0; i < iterations; i++)
+    resampler->resamplePicture(out, in);
+  return (double)(av_gettime() - start) / iterations;
+}
+
+/** Microseconds per picture to encode in as MPEG4 iterations times. */
+double
+MediaPictureTest_encodeTime(MediaPicture* in, int32_t iterations) {
+  RefPointer<Codec> codec = Codec::findEncodingCodec(Codec::CODEC_ID_MPEG4);
+  RefPointer<Encoder> encoder = Encoder::make(codec.value());
+  RefPointer<Rational> tb = Rational::make(1, 25);
+  encoder->setWidth(in->getWidth());
+  encoder->setHeight(in->getHeight());
+  encoder->setPixelFormat(in->getFormat());
+  encoder->setTimeBase(tb.value());
+  encoder->open(0, 0);
+  in->setTimeBase(tb.value());
+  RefPointer<MediaPacket> packet = MediaPacket::make();
+  int64_t start = av_gettime();
+  for(int32_t i = 0; i < iterations; i++) {
+    in->setTimeStamp(i);
+    encoder->encodeVideo(packet.value(), in);
+  }
+  do {
+    encoder->encodeVideo(packet.value(), 0);
+  } while (packet->isComplete());
+  return (double)(av_gettime() - start) / iterations;
+}
+
+}
+
 MediaPictureTest::MediaPictureTest() {
 }
 
@@ -128,3 +218,230 @@ MediaPictureTest::testCreationFromBuffer() {
   picture = MediaPicture::make(buf.value(), width, height, format);
   TS_ASSERT(picture);
 }
+
+void
+MediaPictureTest::testMakeView() {
+  RefPointer<MediaPicture> src = MediaPictureTest_pattern(64, 48,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<Rational> tb = Rational::make(1, 25);
+  src->setTimeBase(tb.value());
+  src->setTimeStamp(7);
+  RefPointer<MediaPicture> view = MediaPicture::makeView(src.value(), 10, 6, 20, 16);
+  TS_ASSERT_EQUALS(20, view->getWidth());
+  TS_ASSERT_EQUALS(16, view->getHeight());
+  TS_ASSERT_EQUALS(PixelFormat::PIX_FMT_YUV420P, view->getFormat());
+  TS_ASSERT_EQUALS(7, view->getTimeStamp());
+  TS_ASSERT(view->isComplete());
+  RefPointer<Rational> viewTb = view->getTimeBase();
+  TS_ASSERT_EQUALS(0, viewTb->compareTo(tb.value()));
+
+  // every plane starts at the rectangle, with the source's line sizes
+  for(int32_t i = 0; i < 3; i++) {
+    int32_t shift = i ? 1 : 0;
+    TS_ASSERT_EQUALS(src->getLineSize(i), view->getLineSize(i));
+    TS_ASSERT_EQUALS(MediaPictureTest_at(src.value(), i, 10 >> shift, 6 >> shift),
+        MediaPictureTest_at(view.value(), i, 0, 0));
+    TS_ASSERT_EQUALS(src->getDataPlaneSize(i) -
+        ((6 >> shift) * src->getLineSize(i) + (10 >> shift)),
+        view->getDataPlaneSize(i));
+  }
+  // and writing to one shows in the other
+  *MediaPictureTest_at(view.value(), 0, 1, 1) = 0x5a;
+  TS_ASSERT_EQUALS(0x5a, *MediaPictureTest_at(src.value(), 0, 11, 7));
+  // views of views add up
+  RefPointer<MediaPicture> inner = MediaPicture::makeView(view.value(), 2, 2, 4, 4);
+  TS_ASSERT_EQUALS(0x5a, *MediaPictureTest_at(inner.value(), 0, -1, -1));
+
+  // interleaved chroma moves by whole pairs, packed pixels by whole pixels
+  RefPointer<MediaPicture> nv12 = MediaPictureTest_pattern(64, 48,
+      PixelFormat::PIX_FMT_NV12);
+  view = MediaPicture::makeView(nv12.value(), 10, 6, 20, 16);
+  TS_ASSERT_EQUALS(MediaPictureTest_at(nv12.value(), 1, 10, 3),
+      MediaPictureTest_at(view.value(), 1, 0, 0));
+  RefPointer<MediaPicture> rgba = MediaPictureTest_pattern(64, 48,
+      PixelFormat::PIX_FMT_RGBA);
+  view = MediaPicture::makeView(rgba.value(), 3, 5, 7, 9);
+  TS_ASSERT_EQUALS(MediaPictureTest_at(rgba.value(), 0, 12, 5),
+      MediaPictureTest_at(view.value(), 0, 0, 0));
+
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(MediaPicture::makeView(0, 0, 0, 2, 2), HumbleInvalidArgument);
+    // off the edge
+    TS_ASSERT_THROWS(MediaPicture::makeView(src.value(), 50, 0, 16, 2), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaPicture::makeView(src.value(), 0, -2, 2, 2), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaPicture::makeView(src.value(), 0, 0, 0, 2), HumbleInvalidArgument);
+    // between chroma samples
+    TS_ASSERT_THROWS(MediaPicture::makeView(src.value(), 1, 0, 2, 2), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaPicture::makeView(src.value(), 0, 3, 2, 2), HumbleInvalidArgument);
+  }
+}
+
+void
+MediaPictureTest::testViewConsumers() {
+  RefPointer<MediaPicture> src = MediaPictureTest_pattern(64, 48,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<Rational> tb = Rational::make(1, 25);
+  src->setTimeBase(tb.value());
+  src->setTimeStamp(0);
+  RefPointer<MediaPicture> view = MediaPicture::makeView(src.value(), 8, 4, 32, 24);
+  RefPointer<MediaPicture> crop = MediaPictureTest_crop(src.value(), 8, 4, 32, 24);
+  crop->setTimeBase(tb.value());
+  crop->setTimeStamp(0);
+
+  // resampling a view is resampling the rectangle
+  RefPointer<MediaPicture> fromView = MediaPicture::make(32, 24, PixelFormat::PIX_FMT_BGR24);
+  RefPointer<MediaPicture> fromCrop = MediaPicture::make(32, 24, PixelFormat::PIX_FMT_BGR24);
+  RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+      32, 24, PixelFormat::PIX_FMT_BGR24, 32, 24, PixelFormat::PIX_FMT_YUV420P, 0);
+  resampler->open();
+  resampler->resamplePicture(fromView.value(), view.value());
+  resampler->resamplePicture(fromCrop.value(), crop.value());
+  for(int32_t y = 0; y < 24; y++)
+    TS_ASSERT_SAME_DATA(MediaPictureTest_at(fromCrop.value(), 0, 0, y),
+        MediaPictureTest_at(fromView.value(), 0, 0, y), 32 * 3);
+
+  // as is filtering it
+  RefPointer<Rational> aspect = Rational::make(1, 1);
+  RefPointer<FilterGraph> graph = FilterGraph::make();
+  RefPointer<FilterPictureSource> source = graph->addPictureSource("in", 32, 24,
+      PixelFormat::PIX_FMT_YUV420P, tb.value(), aspect.value());
+  RefPointer<FilterPictureSink> sink = graph->addPictureSink("out",
+      PixelFormat::PIX_FMT_YUV420P);
+  graph->open("[in]null[out]");
+  source->addPicture(view.value());
+  RefPointer<MediaPicture> filtered = MediaPicture::make(32, 24, PixelFormat::PIX_FMT_YUV420P);
+  sink->getPicture(filtered.value());
+  TS_ASSERT(filtered->isComplete());
+  for(int32_t i = 0; i < 3; i++) {
+    int32_t shift = i ? 1 : 0;
+    for(int32_t y = 0; y < 24 >> shift; y++)
+      TS_ASSERT_SAME_DATA(MediaPictureTest_at(crop.value(), i, 0, y),
+          MediaPictureTest_at(filtered.value(), i, 0, y), 32 >> shift);
+  }
+
+  // and encoding it
+  RefPointer<Codec> codec = Codec::findEncodingCodec(Codec::CODEC_ID_RAWVIDEO);
+  RefPointer<Encoder> encoder = Encoder::make(codec.value());
+  encoder->setWidth(32);
+  encoder->setHeight(24);
+  encoder->setPixelFormat(PixelFormat::PIX_FMT_YUV420P);
+  encoder->setTimeBase(tb.value());
+  encoder->open(0, 0);
+  RefPointer<MediaPacket> packet = MediaPacket::make();
+  encoder->encodeVideo(packet.value(), view.value());
+  TS_ASSERT(packet->isComplete());
+  TS_ASSERT_EQUALS(32 * 24 * 3 / 2, packet->getSize());
+  RefPointer<Buffer> encoded = packet->getData();
+  const uint8_t* bytes = (const uint8_t*)encoded->getBytes(0, packet->getSize());
+  for(int32_t i = 0; i < 3; i++) {
+    int32_t shift = i ? 1 : 0;
+    for(int32_t y = 0; y < 24 >> shift; y++) {
+      TS_ASSERT_SAME_DATA(MediaPictureTest_at(crop.value(), i, 0, y), bytes,
+          32 >> shift);
+      bytes += 32 >> shift;
+    }
+  }
+}
+
+void
+MediaPictureTest::testCreationAligned() {
+  const int32_t width = 17; // use a prime
+  const int32_t height = 191; // use a prime
+  RefPointer<MediaPicture> aligned = MediaPicture::make(width, height,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> packed = MediaPicture::make(width, height,
+      PixelFormat::PIX_FMT_YUV420P, 1);
+  for(int32_t i = 0; i < 3; i++) {
+    int32_t rows = i ? (height + 1) / 2 : height;
+    TS_ASSERT_EQUALS(0, aligned->getLineSize(i) % 64);
+    TS_ASSERT_EQUALS(0, (uintptr_t)MediaPictureTest_at(aligned.value(), i, 0, 0) % 64);
+    TS_ASSERT_EQUALS(aligned->getLineSize(i) * rows, aligned->getDataPlaneSize(i));
+    TS_ASSERT_EQUALS(i ? (width + 1) / 2 : width, packed->getLineSize(i));
+    TS_ASSERT_EQUALS(packed->getLineSize(i) * rows, packed->getDataPlaneSize(i));
+  }
+  // planes of a packed picture follow each other
+  TS_ASSERT_EQUALS(MediaPictureTest_at(packed.value(), 0, 0, 0) +
+      width * height, MediaPictureTest_at(packed.value(), 1, 0, 0));
+
+  // other boundaries
+  RefPointer<MediaPicture> picture = MediaPicture::make(width, height,
+      PixelFormat::PIX_FMT_BGR24, 256);
+  TS_ASSERT_EQUALS(256, picture->getLineSize(0));
+  TS_ASSERT_EQUALS(0, (uintptr_t)MediaPictureTest_at(picture.value(), 0, 0, 0) % 256);
+  picture = MediaPicture::make(width, height, PixelFormat::PIX_FMT_GRAY8);
+  TS_ASSERT_EQUALS(64, picture->getLineSize(0));
+  picture = MediaPicture::make(width, height, PixelFormat::PIX_FMT_GRAY8, 1);
+  TS_ASSERT_EQUALS(width, picture->getLineSize(0));
+
+  // copies keep the pixels, whatever the layouts
+  RefPointer<MediaPicture> src = MediaPictureTest_pattern(width, height,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> crop = MediaPictureTest_crop(src.value(), 0, 0,
+      width, height);
+  RefPointer<MediaPicture> copy = MediaPicture::make(crop.value(), true);
+  for(int32_t i = 0; i < 3; i++) {
+    int32_t shift = i ? 1 : 0;
+    for(int32_t y = 0; y < (height + shift) >> shift; y++)
+      TS_ASSERT_SAME_DATA(MediaPictureTest_at(src.value(), i, 0, y),
+          MediaPictureTest_at(copy.value(), i, 0, y), (width + shift) >> shift);
+  }
+
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(MediaPicture::make(width, height,
+        PixelFormat::PIX_FMT_YUV420P, 0), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaPicture::make(width, height,
+        PixelFormat::PIX_FMT_YUV420P, 48), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaPicture::make(width, height,
+        PixelFormat::PIX_FMT_YUV420P, 512), HumbleInvalidArgument);
+  }
+}
+
+void
+MediaPictureTest::testAlignedThroughput() {
+  // not a pass or fail test; it logs how long resampling and encoding
+  // take with packed and aligned pictures. The width keeps packed rows
+  // off any SIMD boundary.
+  const int32_t width = 1910;
+  const int32_t height = 1080;
+  const int32_t iterations = 8;
+  for(int32_t fastPaths = 1; fastPaths >= 0; fastPaths--) {
+    double times[2];
+    for(int32_t alignment = 1, i = 0; i < 2; alignment = 64, i++) {
+      RefPointer<MediaPicture> in = MediaPicture::make(width, height,
+          PixelFormat::PIX_FMT_YUV420P, alignment);
+      in->setComplete(true);
+      RefPointer<MediaPicture> out = MediaPicture::make(width, height,
+          PixelFormat::PIX_FMT_BGR24, alignment);
+      RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+          width, height, PixelFormat::PIX_FMT_BGR24,
+          width, height, PixelFormat::PIX_FMT_YUV420P, 0);
+      resampler->setFastPaths(fastPaths);
+      resampler->open();
+      times[i] = MediaPictureTest_resampleTime(resampler.value(), out.value(),
+          in.value(), iterations);
+    }
+    VS_LOG_INFO("YUV420P -> BGR24 %dx%d (%s), ms per picture: packed %.2f, aligned %.2f",
+        width, height, fastPaths ? "fast paths" : "swscale",
+        times[0] / 1000, times[1] / 1000);
+  }
+
+  double times[2];
+  for(int32_t alignment = 1, i = 0; i < 2; alignment = 64, i++) {
+    RefPointer<MediaPicture> in = MediaPictureTest_pattern(width, height,
+        PixelFormat::PIX_FMT_YUV420P);
+    RefPointer<MediaPicture> picture = MediaPicture::make(width, height,
+        PixelFormat::PIX_FMT_YUV420P, alignment);
+    RefPointer<MediaPictureResampler> resampler = MediaPictureResampler::make(
+        width, height, PixelFormat::PIX_FMT_YUV420P,
+        width, height, PixelFormat::PIX_FMT_YUV420P, 0);
+    resampler->open();
+    resampler->resamplePicture(picture.value(), in.value());
+    times[i] = MediaPictureTest_encodeTime(picture.value(), iterations / 2);
+  }
+  VS_LOG_INFO("MPEG4 %dx%d, ms per picture: packed %.2f, aligned %.2f",
+      width, height, times[0] / 1000, times[1] / 1000);
+}
@@ -40,6 +40,10 @@ public:
   void testCreation();
   void testCreationInvalidParameters();
   void testCreationFromBuffer();
+  void testMakeView();
+  void testViewConsumers();
+  void testCreationAligned();
+  void testAlignedThroughput();
 
 };
 
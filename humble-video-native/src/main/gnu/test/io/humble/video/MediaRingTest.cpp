@@ -0,0 +1,347 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "MediaRingTest.h"
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/ferry/LoggerStack.h>
+#include <io/humble/ferry/HumbleException.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace io::humble::video;
+using namespace io::humble::ferry;
+
+namespace {
+
+/** Bytes in a plane of a yuv420p picture; MediaPicture rounds chroma planes up. */
+int32_t
+MediaRingTest_planeSize(MediaPicture* picture, int32_t plane) {
+  int32_t height = picture->getHeight();
+  return picture->getLineSize(plane) * (plane ? (height + 1) / 2 : height);
+}
+
+MediaPicture*
+MediaRingTest_picture(int32_t width, int32_t height, int32_t seed) {
+  // packed, as pictures read back from the ring are, so every byte of a
+  // plane is a pixel that makes the trip
+  RefPointer<MediaPicture> picture = MediaPicture::make(width, height,
+      PixelFormat::PIX_FMT_YUV420P, 1);
+  for(int32_t i = 0; i < picture->getNumDataPlanes(); i++) {
+    RefPointer<Buffer> plane = picture->getData(i);
+    int32_t size = MediaRingTest_planeSize(picture.value(), i);
+    uint8_t* bytes = (uint8_t*)plane->getBytes(0, size);
+    for(int32_t j = 0; j < size; j++)
+      bytes[j] = (uint8_t)(seed + i * 7 + j * 3);
+  }
+  picture->setComplete(true);
+  picture->setTimeStamp(seed * 1001);
+  RefPointer<Rational> timeBase = Rational::make(1, 30000);
+  picture->setTimeBase(timeBase.value());
+  return picture.get();
+}
+
+/** Returns an empty string if picture is the one made from seed. */
+std::string
+MediaRingTest_check(MediaPicture* picture, int32_t width, int32_t height,
+    int32_t seed) {
+  if (!picture)
+    return "no picture";
+  if (picture->getWidth() != width || picture->getHeight() != height
+      || picture->getFormat() != PixelFormat::PIX_FMT_YUV420P)
+    return "wrong format";
+  if (!picture->isComplete() || picture->getTimeStamp() != seed * 1001)
+    return "wrong time stamp";
+  RefPointer<Rational> timeBase = picture->getTimeBase();
+  if (!timeBase || timeBase->getNumerator() != 1
+      || timeBase->getDenominator() != 30000)
+    return "wrong time base";
+  for(int32_t i = 0; i < picture->getNumDataPlanes(); i++) {
+    RefPointer<Buffer> plane = picture->getData(i);
+    int32_t size = MediaRingTest_planeSize(picture, i);
+    uint8_t* bytes = (uint8_t*)plane->getBytes(0, size);
+    for(int32_t j = 0; j < size; j++)
+      if (bytes[j] != (uint8_t)(seed + i * 7 + j * 3))
+        return "wrong data";
+  }
+  return "";
+}
+
+}
+
+MediaRingTest::MediaRingTest() {
+  char name[64];
+  snprintf(name, sizeof(name), "MediaRingTest_%d", (int)getpid());
+  mName = name;
+}
+
+MediaRingTest::~MediaRingTest() {
+}
+
+void
+MediaRingTest::testMakeAndOpen() {
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(MediaRing::make(0, 1, 1), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaRing::make("", 1, 1), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaRing::make(mName.c_str(), 0, 1), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaRing::make(mName.c_str(), 1, 0), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(MediaRing::open(mName.c_str()), HumbleRuntimeError);
+  }
+  RefPointer<MediaRing> writer = MediaRing::make(mName.c_str(), 3, 1000);
+  TS_ASSERT(writer);
+  TS_ASSERT(writer->isWriter());
+  TS_ASSERT_EQUALS(std::string("/") + mName, writer->getName());
+  TS_ASSERT_EQUALS(3, writer->getNumSlots());
+  TS_ASSERT_EQUALS(1000, writer->getSlotSize());
+  TS_ASSERT_EQUALS(0, writer->getNumQueued());
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    // names are unique
+    TS_ASSERT_THROWS(MediaRing::make(mName.c_str(), 3, 1000), HumbleRuntimeError);
+  }
+  RefPointer<MediaRing> reader = MediaRing::open(writer->getName());
+  TS_ASSERT(reader);
+  TS_ASSERT(!reader->isWriter());
+  TS_ASSERT_EQUALS(3, reader->getNumSlots());
+  TS_ASSERT_EQUALS(1000, reader->getSlotSize());
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    // and have one reader
+    TS_ASSERT_THROWS(MediaRing::open(mName.c_str()), HumbleRuntimeError);
+    TS_ASSERT_THROWS(reader->writePicture(0, 0), HumbleInvalidArgument);
+    RefPointer<MediaPicture> picture = MediaRingTest_picture(64, 48, 1);
+    // too big for a slot
+    TS_ASSERT_THROWS(writer->writePicture(picture.value(), 0), HumbleInvalidArgument);
+    TS_ASSERT_THROWS(writer->readPicture(0), HumbleRuntimeError);
+  }
+  TS_ASSERT(!reader->isPeerClosed());
+  TS_ASSERT(reader->readPicture(0) == 0);
+  writer->close();
+  TS_ASSERT(reader->isPeerClosed());
+  // the name goes with the writer
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(MediaRing::open(mName.c_str()), HumbleRuntimeError);
+  }
+}
+
+void
+MediaRingTest::testOpenCorrupt() {
+  RefPointer<MediaRing> writer = MediaRing::make(mName.c_str(), 3, 1000);
+  int fd = shm_open(writer->getName(), O_RDWR, 0);
+  TS_ASSERT(fd >= 0);
+  void* memory = mmap(0, 64, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  TS_ASSERT(memory != MAP_FAILED);
+  // the header: magic, length, numSlots, slotSize, slotStride
+  int32_t* slotSize = (int32_t*)((char*)memory + 20);
+  const int32_t* slotStride = (int32_t*)((char*)memory + 24);
+  TS_ASSERT_EQUALS(1000, *slotSize);
+  TS_ASSERT(*slotStride >= 1000);
+  *slotSize = *slotStride + 1;
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    // slots would overlap
+    TS_ASSERT_THROWS(MediaRing::open(mName.c_str()), HumbleRuntimeError);
+  }
+  *slotSize = 1000;
+  munmap(memory, 64);
+  RefPointer<MediaRing> reader = MediaRing::open(mName.c_str());
+  TS_ASSERT(reader);
+  TS_ASSERT_EQUALS(1000, reader->getSlotSize());
+}
+
+void
+MediaRingTest::testPictures() {
+  const int32_t width = 176;
+  const int32_t height = 144;
+  const int32_t size = PixelFormat::getBufferSizeNeeded(width, height,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaRing> writer = MediaRing::make(mName.c_str(), 4, size);
+  RefPointer<MediaRing> reader = MediaRing::open(mName.c_str());
+
+  for(int32_t i = 0; i < 10; i++) {
+    RefPointer<MediaPicture> picture = MediaRingTest_picture(width, height, i);
+    picture->getCtx()->key_frame = i % 3 == 0;
+    picture->setType(i % 3 == 0 ? MediaPicture::PICTURE_TYPE_I : MediaPicture::PICTURE_TYPE_P);
+    TS_ASSERT(writer->writePicture(picture.value(), 0));
+    TS_ASSERT_EQUALS(1, writer->getNumQueued());
+
+    RefPointer<MediaPicture> read = reader->readPicture(0);
+    TS_ASSERT_EQUALS(std::string(""), MediaRingTest_check(read.value(), width, height, i));
+    TS_ASSERT_EQUALS(i % 3 == 0, read->isKey());
+    TS_ASSERT_EQUALS(i % 3 == 0 ? MediaPicture::PICTURE_TYPE_I : MediaPicture::PICTURE_TYPE_P,
+        read->getType());
+    // the picture is the slot, not a copy of it
+    RefPointer<Buffer> plane = read->getData(0);
+    TS_ASSERT_EQUALS(1, writer->getNumQueued());
+    read = 0;
+    plane = 0;
+    TS_ASSERT_EQUALS(0, writer->getNumQueued());
+  }
+  writer->close();
+  TS_ASSERT(reader->readPicture(0) == 0);
+}
+
+void
+MediaRingTest::testAudio() {
+  const int32_t numSamples = 1024;
+  const int32_t channels = 6;
+  const AudioFormat::Type format = AudioFormat::SAMPLE_FMT_S16P;
+  RefPointer<MediaRing> writer = MediaRing::make(mName.c_str(), 2,
+      AudioFormat::getBufferSizeNeeded(numSamples, channels, format));
+  RefPointer<MediaRing> reader = MediaRing::open(mName.c_str());
+
+  RefPointer<MediaAudio> audio = MediaAudio::make(numSamples, 48000, channels,
+      AudioChannel::CH_LAYOUT_5POINT1, format);
+  // only the samples in use go into the ring
+  audio->setNumSamples(1000);
+  audio->setTimeStamp(4800);
+  audio->setComplete(true);
+  for(int32_t i = 0; i < channels; i++) {
+    RefPointer<Buffer> plane = audio->getData(i);
+    int16_t* samples = (int16_t*)plane->getBytes(0, numSamples * 2);
+    for(int32_t j = 0; j < numSamples; j++)
+      samples[j] = (int16_t)(i * 1000 + j);
+  }
+  TS_ASSERT(writer->writeAudio(audio.value(), 0));
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(reader->readPicture(0), HumbleRuntimeError);
+  }
+  RefPointer<MediaAudio> read = reader->readAudio(0);
+  TS_ASSERT(read);
+  TS_ASSERT_EQUALS(1000, read->getNumSamples());
+  TS_ASSERT_EQUALS(48000, read->getSampleRate());
+  TS_ASSERT_EQUALS(channels, read->getChannels());
+  TS_ASSERT_EQUALS(AudioChannel::CH_LAYOUT_5POINT1, read->getChannelLayout());
+  TS_ASSERT_EQUALS(format, read->getFormat());
+  TS_ASSERT_EQUALS(4800, read->getTimeStamp());
+  TS_ASSERT(read->isComplete());
+  RefPointer<Rational> timeBase = read->getTimeBase();
+  TS_ASSERT_EQUALS(48000, timeBase->getDenominator());
+  for(int32_t i = 0; i < channels; i++) {
+    RefPointer<Buffer> plane = read->getData(i);
+    int16_t* samples = (int16_t*)plane->getBytes(0, 1000 * 2);
+    for(int32_t j = 0; j < 1000; j++)
+      if (samples[j] != (int16_t)(i * 1000 + j)) {
+        TS_FAIL("wrong samples");
+        break;
+      }
+  }
+}
+
+void
+MediaRingTest::testBackPressure() {
+  const int32_t size = PixelFormat::getBufferSizeNeeded(32, 32,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaRing> writer = MediaRing::make(mName.c_str(), 2, size);
+  RefPointer<MediaRing> reader = MediaRing::open(mName.c_str());
+
+  RefPointer<MediaPicture> pictures[5];
+  for(int32_t i = 0; i < 5; i++)
+    pictures[i] = MediaRingTest_picture(32, 32, i);
+  TS_ASSERT(writer->writePicture(pictures[0].value(), 0));
+  TS_ASSERT(writer->writePicture(pictures[1].value(), 0));
+  // full, and a short wait does not change that
+  TS_ASSERT(!writer->writePicture(pictures[2].value(), 0));
+  TS_ASSERT(!writer->writePicture(pictures[2].value(), 2000));
+  TS_ASSERT_EQUALS(2, writer->getNumQueued());
+
+  RefPointer<MediaPicture> first = reader->readPicture(0);
+  RefPointer<MediaPicture> second = reader->readPicture(-1);
+  TS_ASSERT(reader->readPicture(0) == 0);
+  // read but held, so still full
+  TS_ASSERT(!writer->writePicture(pictures[2].value(), 0));
+  // slots go back in order, so the second waits for the first
+  second = 0;
+  TS_ASSERT_EQUALS(2, writer->getNumQueued());
+  TS_ASSERT(!writer->writePicture(pictures[2].value(), 0));
+  first = 0;
+  TS_ASSERT_EQUALS(0, writer->getNumQueued());
+  TS_ASSERT(writer->writePicture(pictures[2].value(), 0));
+  TS_ASSERT(writer->writePicture(pictures[3].value(), 0));
+  TS_ASSERT_EQUALS(std::string(""),
+      MediaRingTest_check(RefPointer<MediaPicture>(reader->readPicture(0)).value(), 32, 32, 2));
+
+  // a reader that goes away fails the writer rather than leaving it waiting
+  reader->close();
+  TS_ASSERT(writer->isPeerClosed());
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(writer->writePicture(pictures[4].value(), -1), HumbleRuntimeError);
+  }
+}
+
+void
+MediaRingTest::testAcrossProcesses() {
+  const int32_t width = 320;
+  const int32_t height = 240;
+  const int32_t count = 50;
+  const int32_t size = PixelFormat::getBufferSizeNeeded(width, height,
+      PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaRing> writer = MediaRing::make(mName.c_str(), 3, size);
+  fflush(0);
+  pid_t child = fork();
+  TS_ASSERT(child >= 0);
+  if (child == 0) {
+    // the reading process; tells the test how it went with its exit code.
+    int status = 0;
+    try {
+      RefPointer<MediaRing> reader = MediaRing::open(mName.c_str());
+      int32_t read = 0;
+      RefPointer<MediaPicture> picture;
+      for(;;) {
+        picture = reader->readPicture(-1);
+        if (!picture)
+          break;
+        if (!MediaRingTest_check(picture.value(), width, height, read).empty())
+          status = 1;
+        ++read;
+      }
+      if (read != count)
+        status = 2;
+    } catch (...) {
+      status = 3;
+    }
+    _exit(status);
+  }
+  RefPointer<MediaPicture> picture;
+  for(int32_t i = 0; i < count; i++) {
+    picture = MediaRingTest_picture(width, height, i);
+    TS_ASSERT(writer->writePicture(picture.value(), -1));
+  }
+  writer->close();
+  int status = -1;
+  TS_ASSERT_EQUALS(child, waitpid(child, &status, 0));
+  TS_ASSERT(WIFEXITED(status));
+  TS_ASSERT_EQUALS(0, WEXITSTATUS(status));
+}
@@ -25,14 +25,40 @@
 
 #include "MuxerTest.h"
 #include <io/humble/ferry/Logger.h>
+#include <io/humble/ferry/LoggerStack.h>
 
 #include <io/humble/video/Demuxer.h>
 #include <io/humble/video/Decoder.h>
 #include <io/humble/video/MediaPacket.h>
 #include <io/humble/video/BitStreamFilter.h>
+#include <io/humble/video/MemoryProtocol.h>
+#include <io/humble/video/ContainerIO.h>
+#include <io/humble/ferry/Thread.h>
+
+#include <cstring>
+#include <vector>
+#include <unistd.h>
 
 VS_LOG_SETUP(io.humble.video);
 
+/**
+ * Drains a pipe the way a process reading a Muxer's output would.
+ */
+class MuxerTest_PipeReader : public Thread
+{
+public:
+  MuxerTest_PipeReader(int fd) : mFd(fd) {}
+  int mFd;
+  std::vector<unsigned char> mData;
+protected:
+  void run() {
+    unsigned char buf[4096];
+    ssize_t bytes;
+    while ((bytes = read(mFd, buf, sizeof(buf))) > 0)
+      mData.insert(mData.end(), buf, buf + bytes);
+  }
+};
+
 MuxerTest::MuxerTest() {
 
 }
@@ -163,3 +189,127 @@ MuxerTest::testHLSRemuxing() {
   muxer->close();
   demuxer->close();
 }
+
+void
+MuxerTest::testIOStatistics() {
+  TestData::Fixture* fixture=mFixtures.getFixture("testfile.mp3");
+  TS_ASSERT(fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+  const char* name = "MuxerTest_testIOStatistics";
+  char url[2048];
+  snprintf(url, sizeof(url), "%s:%s", MemoryProtocol::getProtocolName(), name);
+
+  RefPointer<Demuxer> demuxer = Demuxer::make();
+  demuxer->open(filepath, 0, false, true, 0, 0);
+  RefPointer<Muxer> muxer = Muxer::make(url, 0, "mp3");
+  // otherwise every packet is flushed on its own and there is nothing
+  // for a bigger buffer to save.
+  muxer->setProperty("flush_packets", (int64_t)0LL);
+  TS_ASSERT_EQUALS(0, muxer->getOutputBufferLength());
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    TS_ASSERT_THROWS(muxer->setOutputBufferLength(-1), HumbleInvalidArgument);
+  }
+  int32_t n = demuxer->getNumStreams();
+  for(int i = 0; i < n; i++) {
+    RefPointer<DemuxerStream> demuxerStream = demuxer->getStream(i);
+    RefPointer<Decoder> d = demuxerStream->getDecoder();
+    RefPointer<MuxerStream> muxerStream = muxer->addNewStream(d.value());
+  }
+  muxer->open(0, 0);
+  TS_ASSERT_EQUALS(ContainerIO::SEEKABLE_BUFFER_LENGTH, muxer->getIOBufferLength());
+
+  RefPointer<MediaPacket> packet = MediaPacket::make();
+  int32_t written = 0;
+  while(demuxer->read(packet.value()) >= 0)
+    if (packet->isComplete()) {
+      muxer->write(packet.value(), false);
+      ++written;
+    }
+  muxer->close();
+  demuxer->close();
+
+  RefPointer<Buffer> output = MemoryProtocol::takeOutput(name);
+  TS_ASSERT(output);
+  TS_ASSERT(muxer->getIOWriteCalls() > 0);
+  TS_ASSERT(muxer->getIOBytesWritten() >= output->getBufferSize());
+  TS_ASSERT_EQUALS(0, muxer->getIOReadCalls());
+  TS_ASSERT(muxer->getIOBufferLength() > ContainerIO::SEEKABLE_BUFFER_LENGTH);
+  TS_ASSERT(muxer->getIOBufferLength() <= ContainerIO::SEEKABLE_BUFFER_MAX);
+  // nothing custom about the file the Demuxer read.
+  TS_ASSERT_EQUALS(0, demuxer->getIOReadCalls());
+
+  // and growing the buffer part way through lost nothing.
+  MemoryProtocol::addSource(name, output.value());
+  demuxer = Demuxer::make();
+  demuxer->open(url, 0, false, true, 0, 0);
+  int32_t read = 0;
+  while(demuxer->read(packet.value()) >= 0)
+    if (packet->isComplete())
+      ++read;
+  demuxer->close();
+  MemoryProtocol::removeSource(name);
+  TS_ASSERT_EQUALS(written, read);
+}
+
+void
+MuxerTest::testWriteToPipe() {
+  TestData::Fixture* fixture=mFixtures.getFixture("testfile.mp3");
+  TS_ASSERT(fixture);
+  char filepath[2048];
+  mFixtures.fillPath(fixture, filepath, sizeof(filepath));
+
+  int fds[2];
+  TS_ASSERT_EQUALS(0, pipe(fds));
+  char url[64];
+  snprintf(url, sizeof(url), "fd:%d", fds[1]);
+  MuxerTest_PipeReader reader(fds[0]);
+  reader.start();
+
+  RefPointer<Demuxer> demuxer = Demuxer::make();
+  demuxer->open(filepath, 0, false, true, 0, 0);
+  RefPointer<Muxer> muxer = Muxer::make(url, 0, "mp3");
+  muxer->setProperty("flush_packets", (int64_t)0LL);
+  int32_t n = demuxer->getNumStreams();
+  for(int i = 0; i < n; i++) {
+    RefPointer<DemuxerStream> demuxerStream = demuxer->getStream(i);
+    RefPointer<Decoder> d = demuxerStream->getDecoder();
+    RefPointer<MuxerStream> muxerStream = muxer->addNewStream(d.value());
+  }
+  muxer->open(0, 0);
+
+  RefPointer<MediaPacket> packet = MediaPacket::make();
+  int32_t written = 0;
+  while(demuxer->read(packet.value()) >= 0)
+    if (packet->isComplete()) {
+      muxer->write(packet.value(), false);
+      ++written;
+    }
+  muxer->close();
+  demuxer->close();
+  // the Muxer leaves the descriptor to us.
+  close(fds[1]);
+  reader.join();
+  close(fds[0]);
+  TS_ASSERT(written > 0);
+  TS_ASSERT_EQUALS(muxer->getIOBytesWritten(), (int64_t)reader.mData.size());
+
+  // everything that went down the pipe, in order, reads back.
+  const char* name = "MuxerTest_testWriteToPipe";
+  RefPointer<Buffer> output = Buffer::make(0, (int32_t)reader.mData.size());
+  memcpy(output->getBytes(0, output->getBufferSize()), &reader.mData[0],
+      reader.mData.size());
+  MemoryProtocol::addSource(name, output.value());
+  snprintf(url, sizeof(url), "%s:%s", MemoryProtocol::getProtocolName(), name);
+  demuxer = Demuxer::make();
+  demuxer->open(url, 0, false, true, 0, 0);
+  int32_t read = 0;
+  while(demuxer->read(packet.value()) >= 0)
+    if (packet->isComplete())
+      ++read;
+  demuxer->close();
+  MemoryProtocol::removeSource(name);
+  TS_ASSERT_EQUALS(written, read);
+}
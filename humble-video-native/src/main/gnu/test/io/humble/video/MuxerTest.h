@@ -43,6 +43,8 @@ public:
   void testCreation();
   void testRemuxing();
   void testHLSRemuxing();
+  void testIOStatistics();
+  void testWriteToPipe();
 private:
   TestData mFixtures;
 };
@@ -0,0 +1,314 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "PictureConversionTest.h"
+#include <io/humble/ferry/Logger.h>
+
+#include <cstring>
+
+using namespace io::humble::ferry;
+using namespace io::humble::video;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+namespace {
+
+const enum AVPixelFormat sYuvFormats[] = {
+    AV_PIX_FMT_YUV420P, AV_PIX_FMT_NV12 };
+const enum AVPixelFormat sRgbFormats[] = {
+    AV_PIX_FMT_BGR24, AV_PIX_FMT_RGBA, AV_PIX_FMT_GRAY8 };
+const char* sLevelNames[] = { "scalar", "sse4", "avx2" };
+
+int32_t
+PictureConversionTest_rows(const AVFrame* frame, int32_t plane) {
+  const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get((enum AVPixelFormat)frame->format);
+  return plane ? -((-frame->height) >> desc->log2_chroma_h) : frame->height;
+}
+
+int32_t
+PictureConversionTest_rowBytes(const AVFrame* frame, int32_t plane) {
+  return av_image_get_linesize((enum AVPixelFormat)frame->format, frame->width, plane);
+}
+
+/**
+ * A picture of smooth gradients with a little noise, with 0xaa in the
+ * padding at the end of each row.
+ */
+AVFrame*
+PictureConversionTest_frame(int32_t width, int32_t height,
+    enum AVPixelFormat format, uint32_t seed) {
+  AVFrame* frame = av_frame_alloc();
+  frame->width = width;
+  frame->height = height;
+  frame->format = format;
+  av_frame_get_buffer(frame, 32);
+  for(int32_t i = 0; i < av_pix_fmt_count_planes(format); i++) {
+    int32_t bytes = PictureConversionTest_rowBytes(frame, i);
+    for(int32_t y = 0; y < PictureConversionTest_rows(frame, i); y++) {
+      uint8_t* row = frame->data[i] + y * frame->linesize[i];
+      memset(row, 0xaa, frame->linesize[i]);
+      for(int32_t x = 0; x < bytes; x++) {
+        seed = seed * 1103515245 + 12345;
+        row[x] = (uint8_t)(16 + x * 120 / bytes + y * 60 / height + i * 20 +
+            ((seed >> 16) & 0x7));
+      }
+    }
+  }
+  return frame;
+}
+
+/**
+ * Returns the largest difference between two pictures, adding the sum of
+ * them to total and their number to count if given.
+ */
+int32_t
+PictureConversionTest_diff(const AVFrame* a, const AVFrame* b,
+    int64_t* total = 0, int64_t* count = 0) {
+  int32_t most = 0;
+  for(int32_t i = 0; i < av_pix_fmt_count_planes((enum AVPixelFormat)a->format); i++)
+    for(int32_t y = 0; y < PictureConversionTest_rows(a, i); y++) {
+      const uint8_t* aRow = a->data[i] + y * a->linesize[i];
+      const uint8_t* bRow = b->data[i] + y * b->linesize[i];
+      for(int32_t x = 0; x < PictureConversionTest_rowBytes(a, i); x++) {
+        int32_t diff = abs(aRow[x] - bRow[x]);
+        most = FFMAX(most, diff);
+        if (total)
+          *total += diff;
+        if (count)
+          ++*count;
+      }
+    }
+  return most;
+}
+
+/** Returns true if nothing was written to the padding after any row. */
+bool
+PictureConversionTest_paddingIntact(const AVFrame* frame) {
+  for(int32_t i = 0; i < av_pix_fmt_count_planes((enum AVPixelFormat)frame->format); i++)
+    for(int32_t y = 0; y < PictureConversionTest_rows(frame, i); y++) {
+      const uint8_t* row = frame->data[i] + y * frame->linesize[i];
+      for(int32_t x = PictureConversionTest_rowBytes(frame, i); x < frame->linesize[i]; x++)
+        if (row[x] != 0xaa)
+          return false;
+    }
+  return true;
+}
+
+void
+PictureConversionTest_swscale(AVFrame* out, const AVFrame* in) {
+  SwsContext* context = sws_getContext(in->width, in->height,
+      (enum AVPixelFormat)in->format, out->width, out->height,
+      (enum AVPixelFormat)out->format, SWS_AREA, 0, 0, 0);
+  sws_scale(context, in->data, in->linesize, 0, in->height,
+      out->data, out->linesize);
+  sws_freeContext(context);
+}
+
+/** Megapixels of output per second. */
+double
+PictureConversionTest_time(PictureConversion* conversion, SwsContext* context,
+    AVFrame* out, AVFrame* in, int32_t iterations) {
+  int64_t start = av_gettime();
+  for(int32_t i = 0; i < iterations; i++)
+    if (conversion)
+      conversion->convert(out, in);
+    else
+      sws_scale(context, in->data, in->linesize, 0, in->height,
+          out->data, out->linesize);
+  int64_t elapsed = FFMAX(1, av_gettime() - start);
+  return (double)out->width * out->height * iterations / elapsed;
+}
+
+}
+
+PictureConversionTest::PictureConversionTest() {
+}
+
+PictureConversionTest::~PictureConversionTest() {
+}
+
+void
+PictureConversionTest::testMake() {
+  PictureConversion* conversion = PictureConversion::make(
+      640, 480, AV_PIX_FMT_BGR24, 1280, 960, AV_PIX_FMT_YUV420P,
+      PictureConversion::LEVEL_AVX2);
+  TS_ASSERT(conversion);
+  TS_ASSERT_EQUALS(PictureConversion::getBestLevel(), conversion->getLevel());
+  delete conversion;
+  conversion = PictureConversion::make(
+      640, 480, AV_PIX_FMT_NV12, 640, 480, AV_PIX_FMT_GRAY8,
+      PictureConversion::LEVEL_SCALAR);
+  TS_ASSERT(conversion);
+  TS_ASSERT_EQUALS(PictureConversion::LEVEL_SCALAR, conversion->getLevel());
+  delete conversion;
+
+  // odd sizes
+  TS_ASSERT(!PictureConversion::make(641, 480, AV_PIX_FMT_BGR24,
+      641, 480, AV_PIX_FMT_YUV420P, PictureConversion::LEVEL_AVX2));
+  TS_ASSERT(!PictureConversion::make(640, 481, AV_PIX_FMT_BGR24,
+      640, 481, AV_PIX_FMT_YUV420P, PictureConversion::LEVEL_AVX2));
+  // sizes that are not the same or halved
+  TS_ASSERT(!PictureConversion::make(640, 480, AV_PIX_FMT_BGR24,
+      1920, 1440, AV_PIX_FMT_YUV420P, PictureConversion::LEVEL_AVX2));
+  TS_ASSERT(!PictureConversion::make(1280, 960, AV_PIX_FMT_BGR24,
+      640, 480, AV_PIX_FMT_YUV420P, PictureConversion::LEVEL_AVX2));
+  TS_ASSERT(!PictureConversion::make(640, 480, AV_PIX_FMT_BGR24,
+      1280, 480, AV_PIX_FMT_YUV420P, PictureConversion::LEVEL_AVX2));
+  // other formats, and YUV to YUV or RGB to RGB
+  TS_ASSERT(!PictureConversion::make(640, 480, AV_PIX_FMT_RGB24,
+      640, 480, AV_PIX_FMT_YUV420P, PictureConversion::LEVEL_AVX2));
+  TS_ASSERT(!PictureConversion::make(640, 480, AV_PIX_FMT_NV12,
+      640, 480, AV_PIX_FMT_YUV420P, PictureConversion::LEVEL_AVX2));
+  TS_ASSERT(!PictureConversion::make(640, 480, AV_PIX_FMT_BGR24,
+      640, 480, AV_PIX_FMT_RGBA, PictureConversion::LEVEL_AVX2));
+}
+
+void
+PictureConversionTest::testLevelsAgree() {
+  const PictureConversion::Level best = PictureConversion::getBestLevel();
+  if (best == PictureConversion::LEVEL_SCALAR)
+    VS_LOG_INFO("Only scalar kernels run on this CPU");
+  // widths leave every length of tail the vector kernels can
+  const int32_t widths[] = { 2, 14, 30, 46, 94, 126 };
+  int32_t checked = 0;
+  for(int32_t direction = 0; direction < 2; direction++)
+    for(size_t i = 0; i < sizeof(sYuvFormats)/sizeof(*sYuvFormats); i++)
+      for(size_t j = 0; j < sizeof(sRgbFormats)/sizeof(*sRgbFormats); j++)
+        for(int32_t scale = 1; scale <= 2; scale++)
+          for(size_t w = 0; w < sizeof(widths)/sizeof(*widths); w++) {
+            const int32_t width = widths[w];
+            const int32_t height = 6;
+            enum AVPixelFormat inFmt = direction ? sRgbFormats[j] : sYuvFormats[i];
+            enum AVPixelFormat outFmt = direction ? sYuvFormats[i] : sRgbFormats[j];
+            AVFrame* in = PictureConversionTest_frame(width * scale, height * scale,
+                inFmt, (uint32_t)(w + 7 * j));
+            AVFrame* expected = PictureConversionTest_frame(width, height, outFmt, 0);
+            PictureConversion* conversion = PictureConversion::make(width, height,
+                outFmt, width * scale, height * scale, inFmt,
+                PictureConversion::LEVEL_SCALAR);
+            TS_ASSERT(conversion);
+            conversion->convert(expected, in);
+            TS_ASSERT(PictureConversionTest_paddingIntact(expected));
+            delete conversion;
+
+            for(int32_t level = PictureConversion::LEVEL_SSE4; level <= best; level++) {
+              AVFrame* out = PictureConversionTest_frame(width, height, outFmt, 0);
+              conversion = PictureConversion::make(width, height,
+                  outFmt, width * scale, height * scale, inFmt,
+                  (PictureConversion::Level)level);
+              TS_ASSERT_EQUALS(level, conversion->getLevel());
+              conversion->convert(out, in);
+              int32_t diff = PictureConversionTest_diff(expected, out);
+              if (diff)
+                VS_LOG_ERROR("%s %dx%d -> %s %dx%d differs by %d with %s kernels",
+                    av_get_pix_fmt_name(inFmt), in->width, in->height,
+                    av_get_pix_fmt_name(outFmt), width, height, diff,
+                    sLevelNames[level]);
+              TS_ASSERT_EQUALS(0, diff);
+              TS_ASSERT(PictureConversionTest_paddingIntact(out));
+              ++checked;
+              delete conversion;
+              av_frame_free(&out);
+            }
+            av_frame_free(&expected);
+            av_frame_free(&in);
+          }
+  VS_LOG_DEBUG("Compared %d conversions with the scalar kernels", checked);
+}
+
+void
+PictureConversionTest::testAgainstSwscale() {
+  for(int32_t direction = 0; direction < 2; direction++)
+    for(size_t i = 0; i < sizeof(sYuvFormats)/sizeof(*sYuvFormats); i++)
+      for(size_t j = 0; j < sizeof(sRgbFormats)/sizeof(*sRgbFormats); j++)
+        for(int32_t scale = 1; scale <= 2; scale++) {
+          const int32_t width = 352;
+          const int32_t height = 288;
+          enum AVPixelFormat inFmt = direction ? sRgbFormats[j] : sYuvFormats[i];
+          enum AVPixelFormat outFmt = direction ? sYuvFormats[i] : sRgbFormats[j];
+          AVFrame* in = PictureConversionTest_frame(width * scale, height * scale,
+              inFmt, 1);
+          AVFrame* expected = PictureConversionTest_frame(width, height, outFmt, 0);
+          AVFrame* out = PictureConversionTest_frame(width, height, outFmt, 0);
+          PictureConversionTest_swscale(expected, in);
+          PictureConversion* conversion = PictureConversion::make(width, height,
+              outFmt, width * scale, height * scale, inFmt,
+              PictureConversion::getBestLevel());
+          conversion->convert(out, in);
+          int64_t total = 0;
+          int64_t count = 0;
+          int32_t diff = PictureConversionTest_diff(expected, out, &total, &count);
+          VS_LOG_DEBUG("%s %dx%d -> %s %dx%d: at most %d and on average %.3f from swscale",
+              av_get_pix_fmt_name(inFmt), in->width, in->height,
+              av_get_pix_fmt_name(outFmt), width, height, diff,
+              (double)total / count);
+          // swscale interpolates chroma, and the picture's noise is
+          // amplified by up to twice converting it to blue
+          TS_ASSERT_LESS_THAN_EQUALS(diff, 12);
+          TS_ASSERT_LESS_THAN_EQUALS((double)total / count, 2.0);
+          delete conversion;
+          av_frame_free(&out);
+          av_frame_free(&expected);
+          av_frame_free(&in);
+        }
+}
+
+void
+PictureConversionTest::testThroughput() {
+  // not a pass or fail test; it logs how fast each set of kernels is
+  struct {
+    enum AVPixelFormat inFmt;
+    int32_t scale;
+    enum AVPixelFormat outFmt;
+  } cases[] = {
+    { AV_PIX_FMT_YUV420P, 1, AV_PIX_FMT_BGR24 },
+    { AV_PIX_FMT_YUV420P, 2, AV_PIX_FMT_BGR24 },
+    { AV_PIX_FMT_NV12, 1, AV_PIX_FMT_RGBA },
+    { AV_PIX_FMT_YUV420P, 1, AV_PIX_FMT_GRAY8 },
+    { AV_PIX_FMT_BGR24, 1, AV_PIX_FMT_YUV420P },
+    { AV_PIX_FMT_RGBA, 2, AV_PIX_FMT_NV12 },
+  };
+  const int32_t width = 1920;
+  const int32_t height = 1080;
+  const int32_t iterations = 8;
+  for(size_t i = 0; i < sizeof(cases)/sizeof(*cases); i++) {
+    AVFrame* in = PictureConversionTest_frame(width * cases[i].scale,
+        height * cases[i].scale, cases[i].inFmt, 1);
+    AVFrame* out = PictureConversionTest_frame(width, height, cases[i].outFmt, 0);
+    SwsContext* context = sws_getContext(in->width, in->height, cases[i].inFmt,
+        width, height, cases[i].outFmt, SWS_AREA, 0, 0, 0);
+    double rates[3] = { 0, 0, 0 };
+    double swscale = PictureConversionTest_time(0, context, out, in, iterations);
+    for(int32_t level = 0; level <= PictureConversion::getBestLevel(); level++) {
+      PictureConversion* conversion = PictureConversion::make(width, height,
+          cases[i].outFmt, in->width, in->height, cases[i].inFmt,
+          (PictureConversion::Level)level);
+      rates[level] = PictureConversionTest_time(conversion, 0, out, in, iterations);
+      delete conversion;
+    }
+    VS_LOG_INFO("%s %dx%d -> %s %dx%d, Mpixels/s: swscale %.1f, scalar %.1f, "
+        "sse4 %.1f, avx2 %.1f",
+        av_get_pix_fmt_name(cases[i].inFmt), in->width, in->height,
+        av_get_pix_fmt_name(cases[i].outFmt), width, height,
+        swscale, rates[0], rates[1], rates[2]);
+    sws_freeContext(context);
+    av_frame_free(&out);
+    av_frame_free(&in);
+  }
+}
@@ -0,0 +1,228 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include "SpriteSheetGeneratorTest.h"
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/ferry/LoggerStack.h>
+#include <io/humble/ferry/HumbleException.h>
+#include <cstring>
+
+using namespace io::humble::video;
+using namespace io::humble::ferry;
+
+namespace {
+/** The mean luma of a tile of a YUV420P sheet. */
+int32_t
+SpriteSheetGeneratorTest_meanLuma(MediaPicture* sheet, int32_t x, int32_t y,
+    int32_t width, int32_t height) {
+  RefPointer<Buffer> buffer = sheet->getData(0);
+  uint8_t* data = (uint8_t*)buffer->getBytes(0, buffer->getBufferSize());
+  int32_t linesize = sheet->getLineSize(0);
+  int64_t sum = 0;
+  for(int32_t row = y; row < y + height; row++)
+    for(int32_t col = x; col < x + width; col++)
+      sum += data[row * linesize + col];
+  return (int32_t)(sum / (width * height));
+}
+
+/** Whether two sheets hold the same picture, ignoring row padding. */
+bool
+SpriteSheetGeneratorTest_samePicture(MediaPicture* a, MediaPicture* b) {
+  for(int32_t plane = 0; plane < 3; plane++) {
+    int32_t width = plane ? a->getWidth() / 2 : a->getWidth();
+    int32_t height = plane ? a->getHeight() / 2 : a->getHeight();
+    RefPointer<Buffer> bufA = a->getData(plane);
+    RefPointer<Buffer> bufB = b->getData(plane);
+    uint8_t* dataA = (uint8_t*)bufA->getBytes(0, bufA->getBufferSize());
+    uint8_t* dataB = (uint8_t*)bufB->getBytes(0, bufB->getBufferSize());
+    for(int32_t row = 0; row < height; row++)
+      if (memcmp(dataA + row * a->getLineSize(plane),
+          dataB + row * b->getLineSize(plane), width))
+        return false;
+  }
+  return true;
+}
+}
+
+SpriteSheetGeneratorTest::SpriteSheetGeneratorTest() {
+  mSampleFile[0] = 0;
+  TestData::Fixture* fixture = mFixtures.getFixture("ucl_h264_aac.mp4");
+  TSM_ASSERT("Missing fixture", fixture);
+  mFixtures.fillPath(fixture, mSampleFile, sizeof(mSampleFile));
+}
+
+SpriteSheetGeneratorTest::~SpriteSheetGeneratorTest() {
+}
+
+void
+SpriteSheetGeneratorTest::testMake() {
+  RefPointer<SpriteSheetGenerator> generator = SpriteSheetGenerator::make(
+      mSampleFile, 5, 4, 64, 36, PixelFormat::PIX_FMT_YUV420P);
+  TS_ASSERT(generator);
+  TS_ASSERT_EQUALS(0, strcmp(mSampleFile, generator->getURL()));
+  TS_ASSERT_EQUALS(5, generator->getColumns());
+  TS_ASSERT_EQUALS(4, generator->getRows());
+  TS_ASSERT_EQUALS(64, generator->getTileWidth());
+  TS_ASSERT_EQUALS(36, generator->getTileHeight());
+  TS_ASSERT_EQUALS(PixelFormat::PIX_FMT_YUV420P, generator->getFormat());
+  TS_ASSERT_EQUALS(0, generator->getInterval());
+  TS_ASSERT_EQUALS(0, generator->getStartTime());
+  TS_ASSERT(!generator->isKeyFramesOnly());
+  TS_ASSERT_EQUALS(1, generator->getThreads());
+  // one sheet spread over the video unless an interval is set
+  TS_ASSERT_EQUALS(1, generator->getNumSheets());
+
+  LoggerStack stack;
+  stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+  TS_ASSERT_THROWS(SpriteSheetGenerator::make("", 5, 4, 64, 36,
+      PixelFormat::PIX_FMT_YUV420P), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(SpriteSheetGenerator::make(mSampleFile, 0, 4, 64, 36,
+      PixelFormat::PIX_FMT_YUV420P), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(SpriteSheetGenerator::make(mSampleFile, 5, 4, 0, 36,
+      PixelFormat::PIX_FMT_YUV420P), HumbleInvalidArgument);
+  // half a chroma sample
+  TS_ASSERT_THROWS(SpriteSheetGenerator::make(mSampleFile, 5, 4, 63, 36,
+      PixelFormat::PIX_FMT_YUV420P), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(SpriteSheetGenerator::make(mSampleFile, 5, 4, 64, 36,
+      PixelFormat::PIX_FMT_MONOBLACK), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(generator->setInterval(-1), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(generator->setThreads(-1), HumbleInvalidArgument);
+  TS_ASSERT_THROWS(generator->generate(-1), HumbleInvalidArgument);
+
+  generator = SpriteSheetGenerator::make("no-such-file.mp4", 5, 4, 64, 36,
+      PixelFormat::PIX_FMT_YUV420P);
+  TS_ASSERT_THROWS_ANYTHING(generator->generate(0));
+}
+
+void
+SpriteSheetGeneratorTest::testGenerate() {
+  RefPointer<SpriteSheetGenerator> generator = SpriteSheetGenerator::make(
+      mSampleFile, 4, 3, 64, 36, PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> sheet = generator->generate(0);
+  TS_ASSERT(sheet);
+  TS_ASSERT(sheet->isComplete());
+  TS_ASSERT_EQUALS(4 * 64, sheet->getWidth());
+  TS_ASSERT_EQUALS(3 * 36, sheet->getHeight());
+  TS_ASSERT_EQUALS(PixelFormat::PIX_FMT_YUV420P, sheet->getFormat());
+  TS_ASSERT_EQUALS(0, sheet->getTimeStamp());
+  // every tile is from inside the video; a few scenes in it are dark, but
+  // most tiles must have something on them
+  int32_t lit = 0;
+  for(int32_t tile = 0; tile < 12; tile++)
+    if (SpriteSheetGeneratorTest_meanLuma(sheet.value(), (tile % 4) * 64,
+        (tile / 4) * 36, 64, 36) > 20)
+      ++lit;
+  TS_ASSERT_LESS_THAN(8, lit);
+  TS_ASSERT_LESS_THAN_EQUALS(12, generator->getNumFramesDecoded());
+  TS_ASSERT_LESS_THAN(0, generator->getNumSeeks());
+  TS_ASSERT_LESS_THAN_EQUALS(generator->getNumSeeks(), 12);
+
+  generator->resetStatistics();
+  TS_ASSERT_EQUALS(0, generator->getNumFramesDecoded());
+  TS_ASSERT_EQUALS(0, generator->getNumSeeks());
+
+  // the same sheet again, from a generator that has read past it
+  RefPointer<MediaPicture> again = generator->generate(0);
+  TS_ASSERT(SpriteSheetGeneratorTest_samePicture(sheet.value(), again.value()));
+}
+
+void
+SpriteSheetGeneratorTest::testKeyFramesOnly() {
+  RefPointer<SpriteSheetGenerator> accurate = SpriteSheetGenerator::make(
+      mSampleFile, 4, 3, 64, 36, PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> sheet = accurate->generate(0);
+
+  RefPointer<SpriteSheetGenerator> keys = SpriteSheetGenerator::make(
+      mSampleFile, 4, 3, 64, 36, PixelFormat::PIX_FMT_YUV420P);
+  keys->setKeyFramesOnly(true);
+  TS_ASSERT(keys->isKeyFramesOnly());
+  sheet = keys->generate(0);
+  TS_ASSERT(sheet->isComplete());
+  // at most one frame per tile
+  TS_ASSERT_LESS_THAN(0, keys->getNumFramesDecoded());
+  TS_ASSERT_LESS_THAN_EQUALS(keys->getNumFramesDecoded(), 12);
+  TS_ASSERT_LESS_THAN_EQUALS(keys->getNumFramesDecoded(),
+      accurate->getNumFramesDecoded());
+}
+
+void
+SpriteSheetGeneratorTest::testThreads() {
+  RefPointer<SpriteSheetGenerator> generator = SpriteSheetGenerator::make(
+      mSampleFile, 4, 3, 64, 36, PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> serial = generator->generate(0);
+
+  generator = SpriteSheetGenerator::make(mSampleFile, 4, 3, 64, 36,
+      PixelFormat::PIX_FMT_YUV420P);
+  generator->setThreads(4);
+  TS_ASSERT_EQUALS(4, generator->getThreads());
+  RefPointer<MediaPicture> parallel = generator->generate(0);
+  TS_ASSERT(SpriteSheetGeneratorTest_samePicture(serial.value(),
+      parallel.value()));
+
+  // one per CPU
+  generator->setThreads(0);
+  parallel = generator->generate(0);
+  TS_ASSERT(SpriteSheetGeneratorTest_samePicture(serial.value(),
+      parallel.value()));
+}
+
+void
+SpriteSheetGeneratorTest::testPastEnd() {
+  // a thumbnail strip with a tile every second
+  RefPointer<SpriteSheetGenerator> generator = SpriteSheetGenerator::make(
+      mSampleFile, 8, 1, 64, 36, PixelFormat::PIX_FMT_YUV420P);
+  generator->setInterval(Global::DEFAULT_PTS_PER_SECOND);
+  int32_t numSheets = generator->getNumSheets();
+  TS_ASSERT_LESS_THAN(0, numSheets);
+
+  RefPointer<MediaPicture> sheet = generator->generate(numSheets - 1);
+  TS_ASSERT_EQUALS((numSheets - 1) * 8 * Global::DEFAULT_PTS_PER_SECOND,
+      sheet->getTimeStamp());
+  // the sheet after the last is all past the end, and so black
+  sheet = generator->generate(numSheets);
+  for(int32_t tile = 0; tile < 8; tile++)
+    TS_ASSERT_EQUALS(16, SpriteSheetGeneratorTest_meanLuma(sheet.value(),
+        tile * 64, 0, 64, 36));
+}
+
+void
+SpriteSheetGeneratorTest::testEncode() {
+  RefPointer<SpriteSheetGenerator> generator = SpriteSheetGenerator::make(
+      mSampleFile, 4, 3, 64, 36, PixelFormat::PIX_FMT_YUV420P);
+  RefPointer<MediaPicture> sheet = generator->generate(0);
+
+  RefPointer<MediaPacket> packet = SpriteSheetGenerator::encode(sheet.value(),
+      Codec::CODEC_ID_MJPEG);
+  TS_ASSERT(packet);
+  TS_ASSERT(packet->isComplete());
+  TS_ASSERT_LESS_THAN(0, packet->getSize());
+
+  packet = SpriteSheetGenerator::encode(sheet.value(), Codec::CODEC_ID_PNG);
+  TS_ASSERT(packet);
+  TS_ASSERT(packet->isComplete());
+  RefPointer<Buffer> data = packet->getData();
+  TS_ASSERT_EQUALS(0, memcmp("\x89PNG", data->getBytes(0, 4), 4));
+
+  LoggerStack stack;
+  stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+  TS_ASSERT_THROWS(SpriteSheetGenerator::encode(0, Codec::CODEC_ID_PNG),
+      HumbleInvalidArgument);
+  TS_ASSERT_THROWS(SpriteSheetGenerator::encode(sheet.value(),
+      Codec::CODEC_ID_AAC), HumbleInvalidArgument);
+}
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+
+#include "AsyncURLProtocolHandlerTest.h"
+
+using namespace io::humble::video::customio;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+// small windows, so reads cross and recycle many of them
+static const int32_t AsyncURLProtocolHandlerTest_WINDOWS = 3;
+static const int32_t AsyncURLProtocolHandlerTest_WINDOW_SIZE = 8192;
+
+AsyncURLProtocolHandlerTest :: AsyncURLProtocolHandlerTest()
+{
+  char *fixtureDirectory = getenv("VS_TEST_FIXTUREDIR");
+  if (fixtureDirectory)
+    snprintf(mSampleFile, sizeof(mSampleFile), "%s/%s", fixtureDirectory,
+        "ucl_h264_aac.mp4");
+  else {
+    TSM_ASSERT("no fixture dir", false);
+    throw new std::runtime_error("Must define environment variable VS_TEST_FIXTUREDIR");
+  }
+  FILE* file = fopen(mSampleFile, "rb");
+  if (file) {
+    unsigned char buf[2048];
+    size_t bytes;
+    while ((bytes = fread(buf, 1, sizeof(buf), file)) > 0)
+      mSampleData.insert(mSampleData.end(), buf, buf + bytes);
+    fclose(file);
+  }
+}
+
+AsyncURLProtocolHandlerTest :: ~AsyncURLProtocolHandlerTest()
+{
+}
+
+void
+AsyncURLProtocolHandlerTest :: setUp()
+{
+  AsyncURLProtocolManager::registerProtocol("test",
+      AsyncURLProtocolHandlerTest_WINDOWS,
+      AsyncURLProtocolHandlerTest_WINDOW_SIZE);
+}
+
+void
+AsyncURLProtocolHandlerTest :: tearDown()
+{
+  URLProtocolManager::unregisterAllProtocols();
+}
+
+void
+AsyncURLProtocolHandlerTest :: testOpenClose()
+{
+  URLProtocolHandler* handler = AsyncURLProtocolManager::findHandler("test:foo", 0,0);
+  TSM_ASSERT("", handler);
+
+  TS_ASSERT(handler->url_open(mSampleFile, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  // nothing to close now
+  TS_ASSERT(handler->url_close() < 0);
+
+  // read only, and only regular files
+  TS_ASSERT(handler->url_open(mSampleFile, URLProtocolHandler::URL_WRONLY_MODE) < 0);
+  TS_ASSERT(handler->url_open("test:/no/such/file", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  TS_ASSERT(handler->url_open("test:/", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  TS_ASSERT_EQUALS(URLProtocolHandler::SK_SEEKABLE_NORMAL,
+      handler->url_seekflags("test:foo", 0));
+  delete handler;
+}
+
+void
+AsyncURLProtocolHandlerTest :: testRead()
+{
+  TS_ASSERT(mSampleData.size() > 0);
+  URLProtocolHandler* handler = AsyncURLProtocolManager::findHandler("test:foo", 0,0);
+  TSM_ASSERT("", handler);
+  char url[4200];
+  snprintf(url, sizeof(url), "test:%s", mSampleFile);
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT_EQUALS((int64_t)mSampleData.size(),
+      handler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE));
+
+  // reads that do not line up with the windows
+  std::vector<unsigned char> actual;
+  unsigned char buf[3000];
+  int retval;
+  do {
+    retval = handler->url_read(buf, (int)sizeof(buf));
+    if (retval > 0)
+      actual.insert(actual.end(), buf, buf + retval);
+  } while (retval > 0);
+  TS_ASSERT_EQUALS(0, retval);
+  TS_ASSERT_EQUALS(mSampleData.size(), actual.size());
+  TS_ASSERT(mSampleData == actual);
+
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+AsyncURLProtocolHandlerTest :: testSeek()
+{
+  URLProtocolHandler* handler = AsyncURLProtocolManager::findHandler("test:foo", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open(mSampleFile, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+
+  const int64_t size = mSampleData.size();
+  unsigned char actual[100];
+  // within the windows read ahead on open
+  TS_ASSERT_EQUALS(1000, handler->url_seek(1000, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(100, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[1000], actual, 100) == 0);
+
+  // far ahead of them, then back behind them
+  const int64_t far = size/2 + 7;
+  TS_ASSERT_EQUALS(far, handler->url_seek(far, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(100, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[far], actual, 100) == 0);
+  TS_ASSERT_EQUALS(far+200, handler->url_seek(100, URLProtocolHandler::SK_SEEK_CUR));
+  TS_ASSERT_EQUALS(100, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[far+200], actual, 100) == 0);
+  TS_ASSERT_EQUALS(5, handler->url_seek(5, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(100, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[5], actual, 100) == 0);
+
+  // a read never crosses a window, so the end of one comes back short
+  const int64_t edge = AsyncURLProtocolHandlerTest_WINDOW_SIZE + 5 - 10;
+  TS_ASSERT_EQUALS(edge, handler->url_seek(edge, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(10, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[edge], actual, 10) == 0);
+  TS_ASSERT_EQUALS(100, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[edge+10], actual, 100) == 0);
+
+  TS_ASSERT_EQUALS(size-50, handler->url_seek(-50, URLProtocolHandler::SK_SEEK_END));
+  TS_ASSERT_EQUALS(50, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[size-50], actual, 50) == 0);
+  TS_ASSERT_EQUALS(0, handler->url_read(actual, sizeof(actual)));
+  // past the end is allowed, and reads nothing
+  TS_ASSERT_EQUALS(size+10, handler->url_seek(size+10, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(0, handler->url_read(actual, sizeof(actual)));
+
+  TS_ASSERT(handler->url_seek(-1, URLProtocolHandler::SK_SEEK_SET) < 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+AsyncURLProtocolHandlerTest :: testCloseWhileReadingAhead()
+{
+  URLProtocolHandler* handler = AsyncURLProtocolManager::findHandler("test:foo", 0,0);
+  TSM_ASSERT("", handler);
+  for(int i = 0; i < 20; i++) {
+    TS_ASSERT(handler->url_open(mSampleFile, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+    unsigned char byte;
+    if (i % 2)
+      TS_ASSERT_EQUALS(1, handler->url_read(&byte, 1));
+    TS_ASSERT(handler->url_seek(i*1000, URLProtocolHandler::SK_SEEK_SET) >= 0);
+    TS_ASSERT(handler->url_close() >= 0);
+  }
+  // and deleting an open handler closes it
+  TS_ASSERT(handler->url_open(mSampleFile, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  delete handler;
+}
@@ -0,0 +1,516 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "CachingURLProtocolHandlerTest.h"
+
+#include <io/humble/ferry/Lock.h>
+#include <io/humble/ferry/LoggerStack.h>
+#include <io/humble/ferry/RefPointer.h>
+#include <io/humble/ferry/Thread.h>
+#include <io/humble/video/Global.h>
+
+using namespace io::humble::ferry;
+using namespace io::humble::video::customio;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+static const int32_t CachingURLProtocolHandlerTest_BLOCK_SIZE = 4096;
+
+/**
+ * A source that takes a while to read, and counts how often it is read.
+ */
+class CachingURLProtocolHandlerTest_SlowHandler : public URLProtocolHandler
+{
+public:
+  static Lock sLock;
+  static int32_t sReads;
+  CachingURLProtocolHandlerTest_SlowHandler(URLProtocolManager* mgr) :
+    URLProtocolHandler(mgr), mPosition(0) {}
+  int url_open(const char*, int) { mPosition = 0; return 0; }
+  int url_close() { return 0; }
+  int url_read(unsigned char* buf, int size) {
+    {
+      Lock::Guard guard(&sLock);
+      ++sReads;
+    }
+    usleep(200*1000);
+    for(int i = 0; i < size; i++)
+      buf[i] = (unsigned char)(mPosition + i);
+    mPosition += size;
+    return size;
+  }
+  int url_write(const unsigned char*, int) { return -1; }
+  int64_t url_seek(int64_t position, int whence) {
+    if (whence == SK_SEEK_SIZE)
+      return -1;
+    if (whence != SK_SEEK_SET)
+      return -1;
+    mPosition = position;
+    return mPosition;
+  }
+  SeekableFlags url_seekflags(const char*, int) { return SK_SEEKABLE_NORMAL; }
+private:
+  int64_t mPosition;
+};
+Lock CachingURLProtocolHandlerTest_SlowHandler::sLock;
+int32_t CachingURLProtocolHandlerTest_SlowHandler::sReads = 0;
+
+class CachingURLProtocolHandlerTest_SlowManager : public URLProtocolManager
+{
+public:
+  CachingURLProtocolHandlerTest_SlowManager() : URLProtocolManager("slowtest") {}
+  URLProtocolHandler* getHandler(const char*, int) {
+    return new CachingURLProtocolHandlerTest_SlowHandler(this);
+  }
+};
+
+/**
+ * A source of two blocks that fails when read at sFailAt, sFailures times.
+ */
+class CachingURLProtocolHandlerTest_FlakyHandler : public URLProtocolHandler
+{
+public:
+  static const int64_t SIZE = 2*CachingURLProtocolHandlerTest_BLOCK_SIZE;
+  static int64_t sFailAt;
+  static int32_t sFailures;
+  static unsigned char byteAt(int64_t position) { return (unsigned char)(position % 251); }
+  CachingURLProtocolHandlerTest_FlakyHandler(URLProtocolManager* mgr) :
+    URLProtocolHandler(mgr), mPosition(0) {}
+  int url_open(const char*, int) { mPosition = 0; return 0; }
+  int url_close() { return 0; }
+  int url_read(unsigned char* buf, int size) {
+    int64_t end = SIZE;
+    if (sFailures > 0 && mPosition <= sFailAt) {
+      if (mPosition == sFailAt) {
+        --sFailures;
+        return -1;
+      }
+      end = sFailAt;
+    }
+    int bytes = (int)std::min((int64_t)size, end - mPosition);
+    for(int i = 0; i < bytes; i++)
+      buf[i] = byteAt(mPosition + i);
+    mPosition += bytes;
+    return bytes;
+  }
+  int url_write(const unsigned char*, int) { return -1; }
+  int64_t url_seek(int64_t position, int whence) {
+    if (whence == SK_SEEK_SIZE)
+      return SIZE;
+    if (whence != SK_SEEK_SET)
+      return -1;
+    mPosition = position;
+    return mPosition;
+  }
+  SeekableFlags url_seekflags(const char*, int) { return SK_SEEKABLE_NORMAL; }
+private:
+  int64_t mPosition;
+};
+int64_t CachingURLProtocolHandlerTest_FlakyHandler::sFailAt = 0;
+int32_t CachingURLProtocolHandlerTest_FlakyHandler::sFailures = 0;
+
+class CachingURLProtocolHandlerTest_FlakyManager : public URLProtocolManager
+{
+public:
+  CachingURLProtocolHandlerTest_FlakyManager() : URLProtocolManager("flakytest") {}
+  URLProtocolHandler* getHandler(const char*, int) {
+    return new CachingURLProtocolHandlerTest_FlakyHandler(this);
+  }
+};
+
+/**
+ * Reads the first bytes of a URL through the cache.
+ */
+class CachingURLProtocolHandlerTest_Reader : public Thread
+{
+public:
+  CachingURLProtocolHandlerTest_Reader() : mBytes(-1) {}
+  int mBytes;
+  unsigned char mData[100];
+protected:
+  void run() {
+    URLProtocolHandler* handler = URLProtocolManager::findHandler("cachetest:slowtest:x", 0, 0);
+    if (!handler)
+      return;
+    if (handler->url_open("cachetest:slowtest:x", URLProtocolHandler::URL_RDONLY_MODE) >= 0) {
+      mBytes = handler->url_read(mData, sizeof(mData));
+      handler->url_close();
+    }
+    delete handler;
+  }
+};
+
+CachingURLProtocolHandlerTest :: CachingURLProtocolHandlerTest()
+{
+  mCache = 0;
+  mMemory = 0;
+  char *fixtureDirectory = getenv("VS_TEST_FIXTUREDIR");
+  if (fixtureDirectory)
+    snprintf(mSampleFile, sizeof(mSampleFile), "%s/%s", fixtureDirectory,
+        "ucl_h264_aac.mp4");
+  else {
+    TSM_ASSERT("no fixture dir", false);
+    throw new std::runtime_error("Must define environment variable VS_TEST_FIXTUREDIR");
+  }
+  FILE* file = fopen(mSampleFile, "rb");
+  if (file) {
+    unsigned char buf[2048];
+    size_t bytes;
+    while ((bytes = fread(buf, 1, sizeof(buf), file)) > 0)
+      mSampleData.insert(mSampleData.end(), buf, buf + bytes);
+    fclose(file);
+  }
+}
+
+CachingURLProtocolHandlerTest :: ~CachingURLProtocolHandlerTest()
+{
+}
+
+void
+CachingURLProtocolHandlerTest :: setUp()
+{
+  // so FFmpeg can open plain files under the cache
+  io::humble::video::Global::init();
+  mCache = CachingURLProtocolManager::registerProtocol("cachetest",
+      CachingURLProtocolManager::DEFAULT_MAX_BYTES,
+      CachingURLProtocolHandlerTest_BLOCK_SIZE);
+  mMemory = MemoryURLProtocolManager::registerProtocol("memtest");
+}
+
+void
+CachingURLProtocolHandlerTest :: tearDown()
+{
+  URLProtocolManager::unregisterAllProtocols();
+  mCache = 0;
+  mMemory = 0;
+}
+
+void
+CachingURLProtocolHandlerTest :: readAll(URLProtocolHandler* handler,
+    std::vector<unsigned char>* data)
+{
+  // a block at a time, so each read is one cache lookup
+  unsigned char buf[CachingURLProtocolHandlerTest_BLOCK_SIZE];
+  int retval;
+  do {
+    retval = handler->url_read(buf, (int)sizeof(buf));
+    if (retval > 0)
+      data->insert(data->end(), buf, buf + retval);
+  } while (retval > 0);
+  TS_ASSERT_EQUALS(0, retval);
+}
+
+void
+CachingURLProtocolHandlerTest :: testOpenClose()
+{
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("cachetest:foo", 0,0);
+  TSM_ASSERT("", handler);
+
+  char url[4200];
+  snprintf(url, sizeof(url), "cachetest:%s", mSampleFile);
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  // nothing to close now
+  TS_ASSERT(handler->url_close() < 0);
+
+  // read only
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_WRONLY_MODE) < 0);
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    stack.setGlobalLevel(Logger::LEVEL_DEBUG, false);
+    TS_ASSERT(handler->url_open("cachetest:/no/such/file", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+    TS_ASSERT(handler->url_open("cachetest:memtest:nothing", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  }
+  TS_ASSERT(handler->url_open("cachetest:", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  TS_ASSERT_EQUALS(URLProtocolHandler::SK_SEEKABLE_NORMAL,
+      handler->url_seekflags("cachetest:foo", 0));
+  delete handler;
+}
+
+void
+CachingURLProtocolHandlerTest :: testReadMatchesFile()
+{
+  TS_ASSERT(mSampleData.size() > 0);
+  const int64_t blocks = (mSampleData.size() + CachingURLProtocolHandlerTest_BLOCK_SIZE - 1) /
+      CachingURLProtocolHandlerTest_BLOCK_SIZE;
+  char url[4200];
+  snprintf(url, sizeof(url), "cachetest:%s", mSampleFile);
+
+  for(int i = 0; i < 2; i++) {
+    URLProtocolHandler* handler = URLProtocolManager::findHandler(url, 0,0);
+    TSM_ASSERT("", handler);
+    TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+    TS_ASSERT_EQUALS((int64_t)mSampleData.size(),
+        handler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE));
+    std::vector<unsigned char> data;
+    readAll(handler, &data);
+    TS_ASSERT(mSampleData == data);
+    TS_ASSERT(handler->url_close() >= 0);
+    delete handler;
+
+    // the first pass reads every block; the second reads none.
+    TS_ASSERT_EQUALS(blocks, mCache->getMisses());
+    TS_ASSERT_EQUALS(i*blocks, mCache->getHits());
+  }
+  TS_ASSERT_EQUALS(0, mCache->getWaits());
+  TS_ASSERT_EQUALS(0, mCache->getEvictions());
+  TS_ASSERT_EQUALS(blocks*CachingURLProtocolHandlerTest_BLOCK_SIZE, mCache->getCachedBytes());
+
+  mCache->resetStatistics();
+  TS_ASSERT_EQUALS(0, mCache->getHits());
+  TS_ASSERT_EQUALS(0, mCache->getMisses());
+  mCache->clear();
+  TS_ASSERT_EQUALS(0, mCache->getCachedBytes());
+}
+
+void
+CachingURLProtocolHandlerTest :: testSeek()
+{
+  char url[4200];
+  snprintf(url, sizeof(url), "cachetest:%s", mSampleFile);
+  URLProtocolHandler* handler = URLProtocolManager::findHandler(url, 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+
+  const int64_t size = mSampleData.size();
+  unsigned char actual[100];
+  // straddle a block boundary
+  const int64_t position = CachingURLProtocolHandlerTest_BLOCK_SIZE*3 - 10;
+  TS_ASSERT_EQUALS(position, handler->url_seek(position, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(10, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[position], actual, 10) == 0);
+  TS_ASSERT_EQUALS(100, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[position+10], actual, 100) == 0);
+  TS_ASSERT_EQUALS(position+10, handler->url_seek(-100, URLProtocolHandler::SK_SEEK_CUR));
+
+  TS_ASSERT_EQUALS(size-50, handler->url_seek(-50, URLProtocolHandler::SK_SEEK_END));
+  TS_ASSERT_EQUALS(50, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(&mSampleData[size-50], actual, 50) == 0);
+  TS_ASSERT_EQUALS(0, handler->url_read(actual, sizeof(actual)));
+
+  TS_ASSERT(handler->url_seek(-1, URLProtocolHandler::SK_SEEK_SET) < 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+CachingURLProtocolHandlerTest :: testEviction()
+{
+  mCache->setMaxBytes(4*CachingURLProtocolHandlerTest_BLOCK_SIZE);
+  TS_ASSERT_EQUALS(4*CachingURLProtocolHandlerTest_BLOCK_SIZE, mCache->getMaxBytes());
+  const int64_t blocks = (mSampleData.size() + CachingURLProtocolHandlerTest_BLOCK_SIZE - 1) /
+      CachingURLProtocolHandlerTest_BLOCK_SIZE;
+  char url[4200];
+  snprintf(url, sizeof(url), "cachetest:%s", mSampleFile);
+  URLProtocolHandler* handler = URLProtocolManager::findHandler(url, 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  std::vector<unsigned char> data;
+  readAll(handler, &data);
+  TS_ASSERT(mSampleData == data);
+
+  TS_ASSERT_EQUALS(4*CachingURLProtocolHandlerTest_BLOCK_SIZE, mCache->getCachedBytes());
+  TS_ASSERT_EQUALS(blocks-4, mCache->getEvictions());
+
+  // the last blocks are still there, the first is not.
+  mCache->resetStatistics();
+  TS_ASSERT_EQUALS((int64_t)mSampleData.size()-1,
+      handler->url_seek(-1, URLProtocolHandler::SK_SEEK_END));
+  unsigned char byte;
+  TS_ASSERT_EQUALS(1, handler->url_read(&byte, 1));
+  TS_ASSERT_EQUALS(1, mCache->getHits());
+  TS_ASSERT_EQUALS(0, handler->url_seek(0, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(1, handler->url_read(&byte, 1));
+  TS_ASSERT_EQUALS(1, mCache->getMisses());
+
+  // and shrinking the cache evicts
+  mCache->setMaxBytes(CachingURLProtocolHandlerTest_BLOCK_SIZE);
+  TS_ASSERT_EQUALS(CachingURLProtocolHandlerTest_BLOCK_SIZE, mCache->getCachedBytes());
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+CachingURLProtocolHandlerTest :: testChangedSourceIsNotServedFromCache()
+{
+  RefPointer<Buffer> source = Buffer::make(0, 100);
+  memset(source->getBytes(0, 100), 'x', 100);
+  mMemory->addSource("hundred", source.value());
+
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("cachetest:memtest:hundred", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open("cachetest:memtest:hundred", URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  unsigned char buf[200];
+  TS_ASSERT_EQUALS(100, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT(handler->url_close() >= 0);
+
+  // the source is opened even when all of it is cached
+  TS_ASSERT(mMemory->removeSource("hundred"));
+  {
+    LoggerStack stack;
+    stack.setGlobalLevel(Logger::LEVEL_ERROR, false);
+    stack.setGlobalLevel(Logger::LEVEL_DEBUG, false);
+    TS_ASSERT(handler->url_open("cachetest:memtest:hundred", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  }
+
+  // and when it has changed size, what was cached is dropped
+  source = Buffer::make(0, 150);
+  memset(source->getBytes(0, 150), 'y', 150);
+  mMemory->addSource("hundred", source.value());
+  TS_ASSERT(handler->url_open("cachetest:memtest:hundred", URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT_EQUALS(150, handler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE));
+  TS_ASSERT_EQUALS(0, mCache->getCachedBytes());
+  memset(buf, 0, sizeof(buf));
+  TS_ASSERT_EQUALS(150, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT_EQUALS('y', buf[0]);
+  TS_ASSERT_EQUALS('y', buf[149]);
+  TS_ASSERT_EQUALS(0, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT_EQUALS(2, mCache->getMisses());
+  TS_ASSERT_EQUALS(0, mCache->getHits());
+  TS_ASSERT_EQUALS(CachingURLProtocolHandlerTest_BLOCK_SIZE, mCache->getCachedBytes());
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+CachingURLProtocolHandlerTest :: testChangedFileIsNotServedFromCache()
+{
+  char path[] = "CachingURLProtocolHandlerTest_testChangedFile_XXXXXX";
+  int fd = mkstemp(path);
+  TS_ASSERT(fd >= 0);
+  unsigned char bytes[100];
+  memset(bytes, 'a', sizeof(bytes));
+  TS_ASSERT_EQUALS((ssize_t)sizeof(bytes), write(fd, bytes, sizeof(bytes)));
+  close(fd);
+  struct timeval times[2];
+  times[0].tv_sec = times[1].tv_sec = 1400000000;
+  times[0].tv_usec = times[1].tv_usec = 0;
+  TS_ASSERT_EQUALS(0, utimes(path, times));
+
+  char url[128];
+  snprintf(url, sizeof(url), "cachetest:%s", path);
+  URLProtocolHandler* handler = URLProtocolManager::findHandler(url, 0,0);
+  TSM_ASSERT("", handler);
+  unsigned char buf[200];
+  for(int i = 0; i < 2; i++) {
+    TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+    TS_ASSERT_EQUALS(100, handler->url_read(buf, sizeof(buf)));
+    TS_ASSERT_EQUALS('a', buf[99]);
+    TS_ASSERT(handler->url_close() >= 0);
+  }
+  TS_ASSERT_EQUALS(1, mCache->getMisses());
+  TS_ASSERT_EQUALS(1, mCache->getHits());
+
+  // rewrite it with the same size, within the same second
+  fd = open(path, O_WRONLY|O_TRUNC);
+  TS_ASSERT(fd >= 0);
+  memset(bytes, 'b', sizeof(bytes));
+  TS_ASSERT_EQUALS((ssize_t)sizeof(bytes), write(fd, bytes, sizeof(bytes)));
+  close(fd);
+  times[0].tv_usec = times[1].tv_usec = 1;
+  TS_ASSERT_EQUALS(0, utimes(path, times));
+
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT_EQUALS(100, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT_EQUALS('b', buf[0]);
+  TS_ASSERT_EQUALS('b', buf[99]);
+  TS_ASSERT(handler->url_close() >= 0);
+  TS_ASSERT_EQUALS(2, mCache->getMisses());
+  TS_ASSERT_EQUALS(CachingURLProtocolHandlerTest_BLOCK_SIZE, mCache->getCachedBytes());
+  delete handler;
+  unlink(path);
+}
+
+void
+CachingURLProtocolHandlerTest :: testConcurrentMissesAreCoalesced()
+{
+  URLProtocolManager::registerProtocol(new CachingURLProtocolHandlerTest_SlowManager());
+  CachingURLProtocolHandlerTest_SlowHandler::sReads = 0;
+
+  const int numReaders = 4;
+  CachingURLProtocolHandlerTest_Reader readers[numReaders];
+  for(int i = 0; i < numReaders; i++)
+    readers[i].start();
+  for(int i = 0; i < numReaders; i++)
+    readers[i].join();
+
+  for(int i = 0; i < numReaders; i++) {
+    TS_ASSERT_EQUALS(100, readers[i].mBytes);
+    TS_ASSERT_EQUALS(99, readers[i].mData[99]);
+  }
+  // one slow read fills the block (the source reads whole blocks at once)
+  TS_ASSERT_EQUALS(1, CachingURLProtocolHandlerTest_SlowHandler::sReads);
+  TS_ASSERT_EQUALS(1, mCache->getMisses());
+  TS_ASSERT_EQUALS(numReaders-1, mCache->getWaits() + mCache->getHits());
+  TS_ASSERT(mCache->getWaits() > 0);
+}
+
+void
+CachingURLProtocolHandlerTest :: testReadErrorIsNotCached()
+{
+  typedef CachingURLProtocolHandlerTest_FlakyHandler Flaky;
+  URLProtocolManager::registerProtocol(new CachingURLProtocolHandlerTest_FlakyManager());
+  // fail twice part way into the first block
+  Flaky::sFailAt = 1000;
+  Flaky::sFailures = 2;
+
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("cachetest:flakytest:x", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open("cachetest:flakytest:x", URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  unsigned char buf[CachingURLProtocolHandlerTest_BLOCK_SIZE];
+  // what was read before the error is still ours
+  TS_ASSERT_EQUALS(1000, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT_EQUALS(Flaky::byteAt(999), buf[999]);
+  // but was not cached; reading the block again fails again, and that
+  // is an error rather than the end of the URL
+  TS_ASSERT_EQUALS(0, mCache->getCachedBytes());
+  TS_ASSERT_EQUALS(-1, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT_EQUALS(0, mCache->getCachedBytes());
+
+  // once the source recovers, the rest reads back whole
+  std::vector<unsigned char> data;
+  readAll(handler, &data);
+  TS_ASSERT_EQUALS(Flaky::SIZE - 1000, (int64_t)data.size());
+  for(size_t i = 0; i < data.size(); i++)
+    if (data[i] != Flaky::byteAt(1000 + i)) {
+      TS_FAIL("bytes differ");
+      break;
+    }
+  TS_ASSERT_EQUALS(4, mCache->getMisses());
+  TS_ASSERT_EQUALS(Flaky::SIZE, mCache->getCachedBytes());
+  TS_ASSERT(handler->url_close() >= 0);
+
+  // and everyone after us sees all of it
+  TS_ASSERT(handler->url_open("cachetest:flakytest:x", URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  data.clear();
+  readAll(handler, &data);
+  TS_ASSERT_EQUALS(Flaky::SIZE, (int64_t)data.size());
+  TS_ASSERT_EQUALS(2, mCache->getHits());
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef CACHINGURLHANDLERTEST_H_
+#define CACHINGURLHANDLERTEST_H_
+
+#include <vector>
+
+#include <io/humble/testutils/TestUtils.h>
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/video/customio/CachingURLProtocolManager.h>
+#include <io/humble/video/customio/MemoryURLProtocolManager.h>
+
+using namespace io::humble::video::customio;
+
+class CachingURLProtocolHandlerTest: public CxxTest::TestSuite
+{
+public:
+  CachingURLProtocolHandlerTest();
+  virtual
+  ~CachingURLProtocolHandlerTest();
+  void setUp();
+  void tearDown();
+  void testOpenClose();
+  void testReadMatchesFile();
+  void testSeek();
+  void testEviction();
+  void testChangedSourceIsNotServedFromCache();
+  void testChangedFileIsNotServedFromCache();
+  void testConcurrentMissesAreCoalesced();
+  void testReadErrorIsNotCached();
+private:
+  void readAll(URLProtocolHandler* handler, std::vector<unsigned char>* data);
+  char mSampleFile[4098];
+  std::vector<unsigned char> mSampleData;
+  CachingURLProtocolManager* mCache;
+  MemoryURLProtocolManager* mMemory;
+};
+
+#endif /* CACHINGURLHANDLERTEST_H_ */
@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <io/humble/ferry/Thread.h>
+
+#include "FdURLProtocolHandlerTest.h"
+
+#include <io/humble/video/Global.h>
+
+using namespace io::humble::ferry;
+using namespace io::humble::video::customio;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+// more than a few pipes' worth, so batches are reused many times
+static const int32_t FdURLProtocolHandlerTest_SIZE = 1024*1024 + 1234;
+
+/**
+ * Reads a descriptor to the end, the way a relay reading our output would.
+ */
+class FdURLProtocolHandlerTest_Reader : public Thread
+{
+public:
+  FdURLProtocolHandlerTest_Reader(int fd) : mFd(fd) {}
+  int mFd;
+  std::vector<unsigned char> mData;
+protected:
+  void run() {
+    unsigned char buf[1000];
+    ssize_t bytes;
+    while ((bytes = read(mFd, buf, sizeof(buf))) > 0)
+      mData.insert(mData.end(), buf, buf + bytes);
+  }
+};
+
+/**
+ * Writes a buffer to a descriptor and closes it.
+ */
+class FdURLProtocolHandlerTest_Writer : public Thread
+{
+public:
+  FdURLProtocolHandlerTest_Writer(int fd, const std::vector<unsigned char>* data) :
+    mFd(fd), mData(data) {}
+  int mFd;
+  const std::vector<unsigned char>* mData;
+protected:
+  void run() {
+    size_t written = 0;
+    while (written < mData->size()) {
+      ssize_t bytes = write(mFd, &(*mData)[written], mData->size() - written);
+      if (bytes <= 0)
+        break;
+      written += bytes;
+    }
+    close(mFd);
+  }
+};
+
+FdURLProtocolHandlerTest :: FdURLProtocolHandlerTest()
+{
+  for(int32_t i = 0; i < FdURLProtocolHandlerTest_SIZE; i++)
+    mSampleData.push_back((unsigned char)(i * 31 + i / 4099));
+}
+
+FdURLProtocolHandlerTest :: ~FdURLProtocolHandlerTest()
+{
+}
+
+void
+FdURLProtocolHandlerTest :: tearDown()
+{
+  URLProtocolManager::unregisterAllProtocols();
+}
+
+void
+FdURLProtocolHandlerTest :: testOpenClose()
+{
+  FdURLProtocolManager::registerProtocol("test");
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("test:0", 0,0);
+  TSM_ASSERT("", handler);
+
+  TS_ASSERT_EQUALS(12, FdURLProtocolHandler::parseDescriptor("test:12"));
+  TS_ASSERT_EQUALS(12, FdURLProtocolHandler::parseDescriptor("12"));
+  TS_ASSERT_EQUALS(-1, FdURLProtocolHandler::parseDescriptor("test:"));
+  TS_ASSERT_EQUALS(-1, FdURLProtocolHandler::parseDescriptor("test:-1"));
+  TS_ASSERT_EQUALS(-1, FdURLProtocolHandler::parseDescriptor("test:1x"));
+  TS_ASSERT_EQUALS(-1, FdURLProtocolHandler::parseDescriptor("test:99999999999"));
+
+  int fds[2];
+  TS_ASSERT_EQUALS(0, pipe(fds));
+  char readURL[64], writeURL[64];
+  snprintf(readURL, sizeof(readURL), "test:%d", fds[0]);
+  snprintf(writeURL, sizeof(writeURL), "test:%d", fds[1]);
+
+  TS_ASSERT(handler->url_open(readURL, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  // nothing to close now
+  TS_ASSERT(handler->url_close() < 0);
+  // and the descriptor is still the caller's
+  TS_ASSERT(fcntl(fds[0], F_GETFL) >= 0);
+
+  TS_ASSERT(handler->url_open(writeURL, URLProtocolHandler::URL_WRONLY_MODE) >= 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  TS_ASSERT(fcntl(fds[1], F_GETFL) >= 0);
+
+  // wrong direction, both directions, and no descriptor at all
+  TS_ASSERT(handler->url_open(readURL, URLProtocolHandler::URL_WRONLY_MODE) < 0);
+  TS_ASSERT(handler->url_open(writeURL, URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  TS_ASSERT(handler->url_open(readURL, URLProtocolHandler::URL_RDWR_MODE) < 0);
+  TS_ASSERT(handler->url_open("test:foo", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+
+  TS_ASSERT_EQUALS(URLProtocolHandler::SK_NOT_SEEKABLE,
+      handler->url_seekflags(readURL, 0));
+  close(fds[0]);
+  close(fds[1]);
+  TS_ASSERT(handler->url_open(readURL, URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  delete handler;
+}
+
+void
+FdURLProtocolHandlerTest :: testRead()
+{
+  FdURLProtocolManager::registerProtocol("test");
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("test:0", 0,0);
+  TSM_ASSERT("", handler);
+  int fds[2];
+  TS_ASSERT_EQUALS(0, pipe(fds));
+  char url[64];
+  snprintf(url, sizeof(url), "test:%d", fds[0]);
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  // no seeking or writing a pipe we read
+  TS_ASSERT(handler->url_seek(0, URLProtocolHandler::SK_SEEK_SET) < 0);
+  TS_ASSERT(handler->url_write(&mSampleData[0], 10) < 0);
+
+  FdURLProtocolHandlerTest_Writer writer(fds[1], &mSampleData);
+  writer.start();
+  std::vector<unsigned char> actual;
+  unsigned char buf[3000];
+  int retval;
+  do {
+    retval = handler->url_read(buf, (int)sizeof(buf));
+    if (retval > 0)
+      actual.insert(actual.end(), buf, buf + retval);
+  } while (retval > 0);
+  writer.join();
+  TS_ASSERT_EQUALS(0, retval);
+  TS_ASSERT(mSampleData == actual);
+
+  TS_ASSERT(handler->url_close() >= 0);
+  close(fds[0]);
+  delete handler;
+}
+
+void
+FdURLProtocolHandlerTest :: writePipeHelper(const char* protocol)
+{
+  int fds[2];
+  TS_ASSERT_EQUALS(0, pipe(fds));
+  char url[64];
+  snprintf(url, sizeof(url), "%s:%d", protocol, fds[1]);
+  URLProtocolHandler* handler = URLProtocolManager::findHandler(url, 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_WRONLY_MODE) >= 0);
+  TS_ASSERT(handler->url_seek(0, URLProtocolHandler::SK_SEEK_SET) < 0);
+
+  FdURLProtocolHandlerTest_Reader reader(fds[0]);
+  reader.start();
+
+  // the first half from our own memory, in sizes that do not line up
+  // with pages or batches...
+  int32_t written = 0;
+  int32_t half = FdURLProtocolHandlerTest_SIZE / 2;
+  int32_t size = 1;
+  while (written < half) {
+    int32_t length = std::min(size, half - written);
+    TS_ASSERT_EQUALS(length, handler->url_write(&mSampleData[written], length));
+    written += length;
+    size = size * 3 % 70001 + 1;
+  }
+  // ... and the second half built in memory the handler lends.
+  size = 1;
+  while (written < FdURLProtocolHandlerTest_SIZE) {
+    int available = 0;
+    unsigned char* memory = handler->url_write_buffer(&available);
+    TS_ASSERT(memory);
+    TS_ASSERT(available > 0);
+    if (!memory || available <= 0)
+      break;
+    int32_t length = std::min(std::min(size, available),
+        FdURLProtocolHandlerTest_SIZE - written);
+    memcpy(memory, &mSampleData[written], length);
+    TS_ASSERT_EQUALS(length, handler->url_write(memory, length));
+    written += length;
+    size = size * 5 % 30011 + 1;
+  }
+  TS_ASSERT(handler->url_close() >= 0);
+  close(fds[1]);
+  reader.join();
+  close(fds[0]);
+  TS_ASSERT_EQUALS(mSampleData.size(), reader.mData.size());
+  TS_ASSERT(mSampleData == reader.mData);
+  delete handler;
+}
+
+void
+FdURLProtocolHandlerTest :: testWritePipeSpliced()
+{
+  FdURLProtocolManager::registerProtocol("test", true);
+  writePipeHelper("test");
+}
+
+void
+FdURLProtocolHandlerTest :: testWritePipeCopied()
+{
+  FdURLProtocolManager::registerProtocol("test", false, 4096);
+  writePipeHelper("test");
+}
+
+void
+FdURLProtocolHandlerTest :: testWritePipeGlobal()
+{
+  // "fd:" copies with write(2); we cannot know how its pipes are read
+  io::humble::video::Global::init();
+  writePipeHelper("fd");
+}
+
+void
+FdURLProtocolHandlerTest :: testWriteFile()
+{
+  FdURLProtocolManager::registerProtocol("test");
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("test:0", 0,0);
+  TSM_ASSERT("", handler);
+  char path[] = "FdURLProtocolHandlerTest_testWriteFile_XXXXXX";
+  int fd = mkstemp(path);
+  TS_ASSERT(fd >= 0);
+  char url[64];
+  snprintf(url, sizeof(url), "test:%d", fd);
+  TS_ASSERT_EQUALS(URLProtocolHandler::SK_SEEKABLE_NORMAL,
+      handler->url_seekflags(url, URLProtocolHandler::URL_WRONLY_MODE));
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_WRONLY_MODE) >= 0);
+
+  // small writes are gathered, big ones go straight out
+  TS_ASSERT_EQUALS(100, handler->url_write(&mSampleData[0], 100));
+  TS_ASSERT_EQUALS(FdURLProtocolHandlerTest_SIZE - 100,
+      handler->url_write(&mSampleData[100], FdURLProtocolHandlerTest_SIZE - 100));
+  TS_ASSERT_EQUALS((int64_t)FdURLProtocolHandlerTest_SIZE,
+      handler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE));
+
+  // go back and patch the start, the way muxers fix up headers
+  std::vector<unsigned char> expected = mSampleData;
+  unsigned char patch[4] = { 'h', 'd', 'r', '!' };
+  memcpy(&expected[10], patch, sizeof(patch));
+  TS_ASSERT_EQUALS(10, handler->url_seek(10, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(4, handler->url_write(patch, sizeof(patch)));
+  TS_ASSERT(handler->url_close() >= 0);
+
+  std::vector<unsigned char> actual(expected.size() + 1);
+  TS_ASSERT_EQUALS((ssize_t)expected.size(), pread(fd, &actual[0], actual.size(), 0));
+  actual.resize(expected.size());
+  TS_ASSERT(expected == actual);
+  close(fd);
+  unlink(path);
+  delete handler;
+}
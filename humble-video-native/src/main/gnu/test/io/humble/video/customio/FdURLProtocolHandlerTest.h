@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#ifndef FDURLHANDLERTEST_H_
+#define FDURLHANDLERTEST_H_
+
+#include <vector>
+
+#include <io/humble/testutils/TestUtils.h>
+#include <io/humble/ferry/Logger.h>
+#include <io/humble/video/customio/FdURLProtocolManager.h>
+
+using namespace io::humble::video::customio;
+
+class FdURLProtocolHandlerTest: public CxxTest::TestSuite
+{
+public:
+  FdURLProtocolHandlerTest();
+  virtual
+  ~FdURLProtocolHandlerTest();
+  void tearDown();
+  void testOpenClose();
+  void testRead();
+  void testWritePipeSpliced();
+  void testWritePipeCopied();
+  void testWritePipeGlobal();
+  void testWriteFile();
+private:
+  void writePipeHelper(const char* protocol);
+  std::vector<unsigned char> mSampleData;
+};
+
+#endif /* FDURLHANDLERTEST_H_ */
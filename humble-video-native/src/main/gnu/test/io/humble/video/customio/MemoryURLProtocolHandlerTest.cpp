@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cstring>
+
+#include "MemoryURLProtocolHandlerTest.h"
+
+#include <io/humble/ferry/RefPointer.h>
+
+using namespace io::humble::ferry;
+using namespace io::humble::video::customio;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+static Buffer*
+MemoryURLProtocolHandlerTest_makeBuffer(const char* data)
+{
+  int32_t len = (int32_t)strlen(data);
+  Buffer* retval = Buffer::make(0, len);
+  memcpy(retval->getBytes(0, len), data, len);
+  return retval;
+}
+
+MemoryURLProtocolHandlerTest :: MemoryURLProtocolHandlerTest()
+{
+  mManager = 0;
+}
+
+MemoryURLProtocolHandlerTest :: ~MemoryURLProtocolHandlerTest()
+{
+}
+
+void
+MemoryURLProtocolHandlerTest :: setUp()
+{
+  mManager = MemoryURLProtocolManager::registerProtocol("memtest");
+  RefPointer<Buffer> hello = MemoryURLProtocolHandlerTest_makeBuffer("hello ");
+  RefPointer<Buffer> world = MemoryURLProtocolHandlerTest_makeBuffer("world");
+  mManager->addSource("greeting", hello.value());
+  mManager->addSource("greeting", world.value());
+}
+
+void
+MemoryURLProtocolHandlerTest :: tearDown()
+{
+  URLProtocolManager::unregisterAllProtocols();
+  mManager = 0;
+}
+
+void
+MemoryURLProtocolHandlerTest :: testOpenClose()
+{
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("memtest:greeting", 0,0);
+  TSM_ASSERT("", handler);
+
+  TS_ASSERT(handler->url_open("memtest:greeting", URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  // no such source
+  TS_ASSERT(handler->url_open("memtest:nothing", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  // read-write is not supported
+  TS_ASSERT(handler->url_open("memtest:greeting", URLProtocolHandler::URL_RDWR_MODE) < 0);
+  TS_ASSERT_EQUALS(URLProtocolHandler::SK_SEEKABLE_NORMAL,
+      handler->url_seekflags("memtest:greeting", 0));
+  delete handler;
+}
+
+void
+MemoryURLProtocolHandlerTest :: testRead()
+{
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("memtest:greeting", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open("memtest:greeting", URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+
+  // small reads that straddle the two buffers
+  char result[64];
+  int32_t totalBytes = 0;
+  int retval;
+  do {
+    retval = handler->url_read((unsigned char*)result + totalBytes, 4);
+    if (retval > 0)
+      totalBytes += retval;
+  } while (retval > 0);
+  TS_ASSERT_EQUALS(0, retval);
+  TS_ASSERT_EQUALS(11, totalBytes);
+  result[totalBytes] = 0;
+  TS_ASSERT_EQUALS(std::string("hello world"), std::string(result));
+
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+MemoryURLProtocolHandlerTest :: testSeek()
+{
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("memtest:greeting", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open("memtest:greeting", URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+
+  TS_ASSERT_EQUALS(11, handler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE));
+
+  char result[64];
+  TS_ASSERT_EQUALS(4, handler->url_seek(4, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(5, handler->url_read((unsigned char*)result, 5));
+  TS_ASSERT(memcmp(result, "o wor", 5) == 0);
+
+  TS_ASSERT_EQUALS(9, handler->url_seek(-2, URLProtocolHandler::SK_SEEK_END));
+  TS_ASSERT_EQUALS(2, handler->url_read((unsigned char*)result, 10));
+  TS_ASSERT(memcmp(result, "ld", 2) == 0);
+
+  // back into the first buffer
+  TS_ASSERT_EQUALS(1, handler->url_seek(-10, URLProtocolHandler::SK_SEEK_CUR));
+  TS_ASSERT_EQUALS(3, handler->url_read((unsigned char*)result, 3));
+  TS_ASSERT(memcmp(result, "ell", 3) == 0);
+
+  TS_ASSERT(handler->url_seek(-1, URLProtocolHandler::SK_SEEK_SET) < 0);
+
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+MemoryURLProtocolHandlerTest :: testWrite()
+{
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("memtest:out", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open("memtest:out", URLProtocolHandler::URL_WRONLY_MODE) >= 0);
+
+  TS_ASSERT_EQUALS(3, handler->url_write((const unsigned char*)"abc", 3));
+  // writing past the end leaves zeros in the gap
+  TS_ASSERT_EQUALS(6, handler->url_seek(6, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(2, handler->url_write((const unsigned char*)"yz", 2));
+  // and we can go back and rewrite
+  TS_ASSERT_EQUALS(1, handler->url_seek(1, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(1, handler->url_write((const unsigned char*)"B", 1));
+  TS_ASSERT_EQUALS(8, handler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE));
+
+  // nothing to take until the writer closes
+  RefPointer<Buffer> output = mManager->takeOutput("out");
+  TS_ASSERT(!output);
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+
+  output = mManager->takeOutput("out");
+  TS_ASSERT(output);
+  TS_ASSERT_EQUALS(8, output->getBufferSize());
+  TS_ASSERT(memcmp(output->getBytes(0, 8), "aBc\0\0\0yz", 8) == 0);
+  // only handed out once
+  RefPointer<Buffer> again = mManager->takeOutput("out");
+  TS_ASSERT(!again);
+}
+
+void
+MemoryURLProtocolHandlerTest :: testRemoveSourceWhileOpen()
+{
+  URLProtocolHandler* handler = URLProtocolManager::findHandler("memtest:greeting", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open("memtest:greeting", URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+
+  TS_ASSERT(mManager->removeSource("greeting"));
+  TS_ASSERT(!mManager->removeSource("greeting"));
+
+  // the open handler keeps its own references
+  char result[64];
+  TS_ASSERT_EQUALS(11, handler->url_read((unsigned char*)result, sizeof(result)));
+  TS_ASSERT(handler->url_close() >= 0);
+  TS_ASSERT(handler->url_open("memtest:greeting", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  delete handler;
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2014, Andrew "Art" Clarke.  All rights reserved.
+ *   
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+
+#include "MmapURLProtocolHandlerTest.h"
+
+using namespace io::humble::video::customio;
+
+VS_LOG_SETUP(VS_CPP_PACKAGE);
+
+MmapURLProtocolHandlerTest :: MmapURLProtocolHandlerTest()
+{
+  char *fixtureDirectory = getenv("VS_TEST_FIXTUREDIR");
+  if (fixtureDirectory)
+    snprintf(mSampleFile, sizeof(mSampleFile), "%s/%s", fixtureDirectory,
+        "ucl_h264_aac.mp4");
+  else {
+    TSM_ASSERT("no fixture dir", false);
+    throw new std::runtime_error("Must define environment variable VS_TEST_FIXTUREDIR");
+  }
+}
+
+MmapURLProtocolHandlerTest :: ~MmapURLProtocolHandlerTest()
+{
+}
+
+void
+MmapURLProtocolHandlerTest :: setUp()
+{
+  MmapURLProtocolManager::registerProtocol("test");
+}
+
+void
+MmapURLProtocolHandlerTest :: tearDown()
+{
+  URLProtocolManager::unregisterAllProtocols();
+}
+
+void
+MmapURLProtocolHandlerTest :: testOpenClose()
+{
+  URLProtocolHandler* handler = MmapURLProtocolManager::findHandler("test:foo", 0,0);
+  TSM_ASSERT("", handler);
+
+  TS_ASSERT(handler->url_open(mSampleFile, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  // nothing to close now
+  TS_ASSERT(handler->url_close() < 0);
+
+  // read only, and only regular files
+  TS_ASSERT(handler->url_open(mSampleFile, URLProtocolHandler::URL_WRONLY_MODE) < 0);
+  TS_ASSERT(handler->url_open("test:/no/such/file", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  TS_ASSERT(handler->url_open("test:/", URLProtocolHandler::URL_RDONLY_MODE) < 0);
+  TS_ASSERT_EQUALS(URLProtocolHandler::SK_SEEKABLE_NORMAL,
+      handler->url_seekflags("test:foo", 0));
+  delete handler;
+}
+
+void
+MmapURLProtocolHandlerTest :: testRead()
+{
+  std::vector<unsigned char> expected;
+  FILE* file = fopen(mSampleFile, "rb");
+  TS_ASSERT(file);
+  unsigned char buf[2048];
+  size_t bytes;
+  while ((bytes = fread(buf, 1, sizeof(buf), file)) > 0)
+    expected.insert(expected.end(), buf, buf + bytes);
+  fclose(file);
+
+  URLProtocolHandler* handler = MmapURLProtocolManager::findHandler("test:foo", 0,0);
+  TSM_ASSERT("", handler);
+  char url[4200];
+  snprintf(url, sizeof(url), "test:%s", mSampleFile);
+  TS_ASSERT(handler->url_open(url, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+
+  std::vector<unsigned char> actual;
+  int retval;
+  do {
+    retval = handler->url_read(buf, (int)sizeof(buf));
+    if (retval > 0)
+      actual.insert(actual.end(), buf, buf + retval);
+  } while (retval > 0);
+  TS_ASSERT_EQUALS(0, retval);
+  TS_ASSERT_EQUALS(expected.size(), actual.size());
+  TS_ASSERT(expected == actual);
+
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+MmapURLProtocolHandlerTest :: testSeek()
+{
+  URLProtocolHandler* handler = MmapURLProtocolManager::findHandler("test:foo", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open(mSampleFile, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+
+  FILE* file = fopen(mSampleFile, "rb");
+  TS_ASSERT(file);
+  fseek(file, 0, SEEK_END);
+  int64_t size = ftell(file);
+  TS_ASSERT_EQUALS(size, handler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE));
+
+  unsigned char expected[100];
+  unsigned char actual[100];
+  fseek(file, 1000, SEEK_SET);
+  TS_ASSERT_EQUALS(100u, fread(expected, 1, sizeof(expected), file));
+  TS_ASSERT_EQUALS(1000, handler->url_seek(1000, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(100, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(expected, actual, sizeof(actual)) == 0);
+
+  fseek(file, -100, SEEK_END);
+  TS_ASSERT_EQUALS(100u, fread(expected, 1, sizeof(expected), file));
+  TS_ASSERT_EQUALS(size-100, handler->url_seek(-100, URLProtocolHandler::SK_SEEK_END));
+  TS_ASSERT_EQUALS(100, handler->url_read(actual, sizeof(actual)));
+  TS_ASSERT(memcmp(expected, actual, sizeof(actual)) == 0);
+  TS_ASSERT_EQUALS(0, handler->url_read(actual, sizeof(actual)));
+  fclose(file);
+
+  TS_ASSERT(handler->url_seek(-1, URLProtocolHandler::SK_SEEK_SET) < 0);
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+}
+
+void
+MmapURLProtocolHandlerTest :: testReadAcrossWindows()
+{
+  // a sparse file bigger than one mapping window, with a marker where
+  // the first two windows meet.
+  const char* path = "MmapURLProtocolHandlerTest_testReadAcrossWindows.dat";
+  const int64_t window = 64*1024*1024;
+  FILE* file = fopen(path, "wb");
+  TS_ASSERT(file);
+  TS_ASSERT(fseeko(file, (off_t)(window-4), SEEK_SET) == 0);
+  TS_ASSERT_EQUALS(8u, fwrite("01234567", 1, 8, file));
+  TS_ASSERT(fseeko(file, (off_t)(2*window+10), SEEK_SET) == 0);
+  TS_ASSERT_EQUALS(1u, fwrite("!", 1, 1, file));
+  fclose(file);
+
+  URLProtocolHandler* handler = MmapURLProtocolManager::findHandler("test:foo", 0,0);
+  TSM_ASSERT("", handler);
+  TS_ASSERT(handler->url_open(path, URLProtocolHandler::URL_RDONLY_MODE) >= 0);
+  TS_ASSERT_EQUALS(2*window+11, handler->url_seek(0, URLProtocolHandler::SK_SEEK_SIZE));
+
+  unsigned char buf[8];
+  TS_ASSERT_EQUALS(window-4, handler->url_seek(window-4, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(8, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT(memcmp(buf, "01234567", 8) == 0);
+  TS_ASSERT_EQUALS(2*window+10, handler->url_seek(2*window+10, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(1, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT_EQUALS('!', buf[0]);
+  // and back into the first window
+  TS_ASSERT_EQUALS(0, handler->url_seek(0, URLProtocolHandler::SK_SEEK_SET));
+  TS_ASSERT_EQUALS(8, handler->url_read(buf, sizeof(buf)));
+  TS_ASSERT_EQUALS(0, buf[0]);
+
+  TS_ASSERT(handler->url_close() >= 0);
+  delete handler;
+  remove(path);
+}
@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.6
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package io.humble.video;
+import io.humble.ferry.*;
+/**
+ * Lets many Demuxers share what they read from the same URLs.<br>
+ * <p><br>
+ * Open "humblecache:" + url instead of url and reads go through one<br>
+ * process-wide cache of fixed-size blocks, keyed by url and offset, that<br>
+ * is bounded in size and evicts the least recently used blocks first.<br>
+ * Any URL a Demuxer can open can be cached. When several Demuxers miss<br>
+ * the same block at the same time only one of them reads it; the rest<br>
+ * wait for it.<br>
+ * </p><p><br>
+ * Blocks remember the size of their URL, and for local files its<br>
+ * modification time, and are dropped once either changes. #clear() the<br>
+ * cache if data can change without either changing. Cached URLs can<br>
+ * only be read.<br>
+ * </p>
+ */
+public class CachingProtocol extends RefCounted {
+  // JNIHelper.swg: Start generated code
+  // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+  /**
+   * This method is only here to use some references and remove
+   * a Eclipse compiler warning.
+   */
+  @SuppressWarnings("unused")
+  private void noop()
+  {
+    Buffer.make(null, 1);
+  }
+   
+  private volatile long swigCPtr;
+
+  /**
+   * Internal Only.
+   */
+  protected CachingProtocol(long cPtr, boolean cMemoryOwn) {
+    super(VideoJNI.CachingProtocol_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+  
+  /**
+   * Internal Only.
+   */
+  protected CachingProtocol(long cPtr, boolean cMemoryOwn,
+      java.util.concurrent.atomic.AtomicLong ref)
+  {
+    super(VideoJNI.CachingProtocol_SWIGUpcast(cPtr),
+     cMemoryOwn, ref);
+    swigCPtr = cPtr;
+  }
+    
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that obj is proxying for.
+   *   
+   * @param obj The java proxy object for a native object.
+   * @return The raw pointer obj is proxying for.
+   */
+  protected static long getCPtr(CachingProtocol obj) {
+    if (obj == null) return 0;
+    return obj.getMyCPtr();
+  }
+
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that we're proxying for.
+   *   
+   * @return The raw pointer we're proxying for.
+   */  
+  protected long getMyCPtr() {
+    if (swigCPtr == 0) throw new IllegalStateException("underlying native object already deleted");
+    return swigCPtr;
+  }
+  
+  /**
+   * Create a new CachingProtocol object that is actually referring to the
+   * exact same underlying native object.
+   *
+   * @return the new Java object.
+   */
+  @Override
+  public CachingProtocol copyReference() {
+    if (swigCPtr == 0)
+      return null;
+    else
+      return new CachingProtocol(swigCPtr, swigCMemOwn, getJavaRefCount());
+  }
+
+  /**
+   * Compares two values, returning true if the underlying objects in native code are the same object.
+   *
+   * That means you can have two different Java objects, but when you do a comparison, you'll find out
+   * they are the EXACT same object.
+   *
+   * @return True if the underlying native object is the same.  False otherwise.
+   */
+  public boolean equals(Object obj) {
+    boolean equal = false;
+    if (obj instanceof CachingProtocol)
+      equal = (((CachingProtocol)obj).swigCPtr == this.swigCPtr);
+    return equal;
+  }
+  
+  /**
+   * Get a hashable value for this object.
+   *
+   * @return the hashable value.
+   */
+  public int hashCode() {
+     return (int)swigCPtr;
+  }
+  
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // JNIHelper.swg: End generated code
+  /**
+   * Get the URL that reads url through the cache.
+   * @param url the url to cache.
+   * @return getProtocolName() + ":" + url
+   */
+  public static String getURL(String url) {
+    return getProtocolName() + ":" + url;
+  }
+
+/**
+ * @return the protocol name to put in front of URLs to cache: "humblecache".
+ */
+  public static String getProtocolName() {
+    return VideoJNI.CachingProtocol_getProtocolName();
+  }
+
+/**
+ * @return the most bytes the cache will hold. Defaults to 64 MiB.
+ */
+  public static long getMaxBytes() {
+    return VideoJNI.CachingProtocol_getMaxBytes();
+  }
+
+/**
+ * Sets the most bytes the cache will hold, evicting blocks if it holds<br>
+ * more now.<br>
+ * <br>
+ * @param maxBytes The bound; 0 caches nothing beyond the reads in progress.<br>
+ * <br>
+ * @throws InvalidArgument if maxBytes &lt; 0.
+ */
+  public static void setMaxBytes(long maxBytes) {
+    VideoJNI.CachingProtocol_setMaxBytes(maxBytes);
+  }
+
+/**
+ * @return the bytes the cache holds now.
+ */
+  public static long getCachedBytes() {
+    return VideoJNI.CachingProtocol_getCachedBytes();
+  }
+
+/**
+ * @return the size of the blocks the cache reads and holds.
+ */
+  public static int getBlockSize() {
+    return VideoJNI.CachingProtocol_getBlockSize();
+  }
+
+/**
+ * @return the number of block reads served from the cache.
+ */
+  public static long getHits() {
+    return VideoJNI.CachingProtocol_getHits();
+  }
+
+/**
+ * @return the number of blocks read from their URLs because they were not cached.
+ */
+  public static long getMisses() {
+    return VideoJNI.CachingProtocol_getMisses();
+  }
+
+/**
+ * @return the number of block reads that were not cached, but waited for<br>
+ *   another Demuxer already reading the block rather than reading it again.
+ */
+  public static long getWaits() {
+    return VideoJNI.CachingProtocol_getWaits();
+  }
+
+/**
+ * @return the number of blocks evicted to stay within #getMaxBytes().
+ */
+  public static long getEvictions() {
+    return VideoJNI.CachingProtocol_getEvictions();
+  }
+
+/**
+ * Zeros the hit, miss, wait and eviction counts.
+ */
+  public static void resetStatistics() {
+    VideoJNI.CachingProtocol_resetStatistics();
+  }
+
+/**
+ * Empties the cache. Demuxers reading through it carry on, reading<br>
+ * blocks again as they need them.
+ */
+  public static void clear() {
+    VideoJNI.CachingProtocol_clear();
+  }
+
+}
@@ -138,6 +138,67 @@ public class Container extends Configurable {
     return VideoJNI.Container_getNumStreams(swigCPtr, this);
   }
 
+/**
+ * Get the number of times this container called its custom I/O handler to read data.<br>
+ * <p><br>
+ * Containers only record I/O statistics when their URL is handled by an<br>
+ * io.humble.video.customio.URLProtocolHandler; for all other URLs every statistic is 0.<br>
+ * Statistics are reset when the container is opened and kept after it is closed.<br>
+ * </p>
+ */
+  public long getIOReadCalls() {
+    return VideoJNI.Container_getIOReadCalls(swigCPtr, this);
+  }
+
+/**
+ * Get the number of bytes this container's custom I/O handler has returned from reads.
+ */
+  public long getIOBytesRead() {
+    return VideoJNI.Container_getIOBytesRead(swigCPtr, this);
+  }
+
+/**
+ * Get the number of times this container called its custom I/O handler to write data.
+ */
+  public long getIOWriteCalls() {
+    return VideoJNI.Container_getIOWriteCalls(swigCPtr, this);
+  }
+
+/**
+ * Get the number of bytes this container's custom I/O handler has accepted in writes.
+ */
+  public long getIOBytesWritten() {
+    return VideoJNI.Container_getIOBytesWritten(swigCPtr, this);
+  }
+
+/**
+ * Get the number of times this container called its custom I/O handler to seek,<br>
+ * including queries for the size of the data.
+ */
+  public long getIOSeekCalls() {
+    return VideoJNI.Container_getIOSeekCalls(swigCPtr, this);
+  }
+
+/**
+ * Get the time, in microseconds, this container has spent inside its custom I/O handler.
+ */
+  public long getIOTime() {
+    return VideoJNI.Container_getIOTime(swigCPtr, this);
+  }
+
+/**
+ * Get the length of the buffer between FFmpeg and this container's custom I/O handler.<br>
+ * <p><br>
+ * If a buffer length of 0 was asked for, this container picks one from the handler<br>
+ * and may grow it while reading or writing, so this can change over time.<br>
+ * </p><br>
+ * <br>
+ * @return the length, or 0 if this container has not been opened on a custom I/O handler.
+ */
+  public int getIOBufferLength() {
+    return VideoJNI.Container_getIOBufferLength(swigCPtr, this);
+  }
+
   /**
    * Do not set these flags -- several are used by the internals of Humble Video.
    */
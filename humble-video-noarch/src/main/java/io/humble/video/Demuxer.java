@@ -121,6 +121,78 @@ public class Demuxer extends Container {
     return b.toString();
   }
 
+  /**
+   * Reads up to packets.length packets in one call, filling packets in order.
+   * <p>
+   * The batch ends early once maxBytes of payload have been read, or once
+   * the packets read span maxDuration (in Global#DEFAULT_PTS_PER_SECOND
+   * units); pass &lt;= 0 for either to not limit on it. It also ends early if
+   * the source has no complete packet ready (think EAGAIN), or on end of
+   * file or an error; in that case the packets already read are returned
+   * and the next call reports the end of file or error.
+   * </p><p>
+   * This crosses into native code and checks the thread interrupt status
+   * once per batch rather than once per packet.
+   * </p>
+   *
+   * @param packets [In/Out] the packets to read into; none may be null.
+   * @param maxBytes stop once this many payload bytes are read, or &lt;= 0.
+   * @param maxDuration stop once the packets span this much time, or &lt;= 0.
+   *
+   * @return the number of packets filled (0 if none were ready),
+   *   or &lt;0 on end of file.
+   * @throws RuntimeException if an error occurs before any packet is read.
+   */
+  public int readBatch(MediaPacket[] packets, int maxBytes, long maxDuration)
+      throws java.lang.InterruptedException, java.io.IOException {
+    if (packets == null || packets.length == 0)
+      throw new IllegalArgumentException("no packets to read into");
+    final long[] ptrs = new long[packets.length];
+    for(int i = 0; i < packets.length; i++) {
+      if (packets[i] == null)
+        throw new IllegalArgumentException("null packet passed to readBatch");
+      ptrs[i] = MediaPacket.getCPtr(packets[i]);
+    }
+    return java_readBatch(ptrs, maxBytes, maxDuration);
+  }
+
+  /**
+   * Reads up to packets.length packets in one call.
+   * @see #readBatch(MediaPacket[], int, long)
+   */
+  public int readBatch(MediaPacket[] packets)
+      throws java.lang.InterruptedException, java.io.IOException {
+    return readBatch(packets, 0, 0);
+  }
+
+  /**
+   * Only read packets from the given streams. Every other stream is set to
+   * Codec.DiscardFlag#DISCARD_ALL (see
+   * DemuxerStream#setDiscard(Codec.DiscardFlag)), so #read(MediaPacket)
+   * never returns its packets and, for many formats, never reads or parses
+   * them either. The given streams are set back to
+   * Codec.DiscardFlag#DISCARD_DEFAULT.
+   *
+   * @param streamIndexes the indexes of the streams to keep.
+   * @throws IllegalArgumentException if an index is not a stream in this
+   *   Demuxer.
+   */
+  public void selectStreams(int... streamIndexes)
+      throws java.lang.InterruptedException, java.io.IOException {
+    final int numStreams = getNumStreams();
+    final boolean[] selected = new boolean[numStreams];
+    for(int i : streamIndexes) {
+      if (i < 0 || i >= numStreams)
+        throw new IllegalArgumentException("stream index " + i +
+            " is not a stream in this Demuxer");
+      selected[i] = true;
+    }
+    for(int i = 0; i < numStreams; i++) {
+      getStream(i).setDiscard(selected[i] ?
+          Codec.DiscardFlag.DISCARD_DEFAULT : Codec.DiscardFlag.DISCARD_ALL);
+    }
+  }
+
 /**
  * Create a new Demuxer
  */
@@ -146,12 +218,14 @@ public class Demuxer extends Container {
   }
 
 /**
- * Set the buffer length Humble Video will suggest to FFMPEG for reading inputs.<br>
+ * Set the buffer length Humble Video will suggest to FFMPEG for reading inputs<br>
+ * handled by an io.humble.video.customio.URLProtocolHandler.<br>
  * <br>
  * If called when a Container is open, the call is ignored and -1 is returned.<br>
  * <br>
- * @param size The suggested buffer size.<br>
- * @throws InvalidArgument if size &lt;= 0
+ * @param size The suggested buffer size, or 0 (the default) to let Humble Video<br>
+ *   pick a size from the handler and grow it while reading. See Container#getIOBufferLength().<br>
+ * @throws InvalidArgument if size &lt; 0
  */
   public void setInputBufferLength(int size) {
     VideoJNI.Demuxer_setInputBufferLength(swigCPtr, this, size);
@@ -161,8 +235,7 @@ public class Demuxer extends Container {
  * Return the input buffer length.<br>
  * <br>
  * @return The input buffer length Humble Video told FFMPEG to assume.<br>
- *   0 means FFMPEG should choose it's own<br>
- *   size (and it'll probably be 32768).
+ *   0 means Humble Video picks and adapts the size itself.
  */
   public int getInputBufferLength() {
     return VideoJNI.Demuxer_getInputBufferLength(swigCPtr, this);
@@ -382,6 +455,90 @@ public class Demuxer extends Container {
     VideoJNI.Demuxer_setReadRetryCount(swigCPtr, this, count);
   }
 
+/**
+ * Turns on reading ahead. When on, the first #read(MediaPacket) after<br>
+ * the Demuxer is opened (or played, or seeked) starts a native thread<br>
+ * that reads packets into a queue while the caller works on the ones<br>
+ * already returned, so decoding and I/O overlap.<br>
+ * <p><br>
+ * The queue stops filling as soon as any of the positive limits below is<br>
+ * reached. Pass 0 (or less) for all three to turn reading ahead off again;<br>
+ * packets already queued will still be returned first.<br>
+ * </p><p><br>
+ * Seeking throws away queued packets, and pausing or closing stops the<br>
+ * thread. Errors (and end of file) hit by the thread are returned by<br>
+ * #read(MediaPacket) once the packets read before them are consumed.<br>
+ * Reading ahead is ignored for containers where streams can be added<br>
+ * dynamically.<br>
+ * </p><br>
+ * <br>
+ * @param maxPackets maximum number of packets to queue, or &lt;= 0 for no limit.<br>
+ * @param maxBytes maximum number of payload bytes to queue, or &lt;= 0 for no limit.<br>
+ * @param maxDuration maximum time between the first and last queued packet,<br>
+ *   in Global#DEFAULT_PTS_PER_SECOND units, or &lt;= 0 for no limit.
+ */
+  public void setReadAhead(int maxPackets, int maxBytes, long maxDuration) {
+    VideoJNI.Demuxer_setReadAhead(swigCPtr, this, maxPackets, maxBytes, maxDuration);
+  }
+
+/**
+ * @return true if reading ahead is turned on.<br>
+ * @see #setReadAhead(int, int, long)
+ */
+  public boolean isReadAhead() {
+    return VideoJNI.Demuxer_isReadAhead(swigCPtr, this);
+  }
+
+/**
+ * Turns on the probe cache shared by all Demuxers in this process.<br>
+ * <p><br>
+ * When on, #queryStreamMetaData() remembers the stream parameters it<br>
+ * had to read (and maybe decode) media to find, and a later Demuxer<br>
+ * opening the same local file skips that work. Files are recognized by<br>
+ * path, size and modification time (to the nanosecond where the<br>
+ * platform records it); URLs that are not local files are never cached.<br>
+ * </p><br>
+ * <br>
+ * @param maxEntries the most files to remember; the least recently used<br>
+ *   are forgotten first. 0 (the default) turns the cache off and empties it.
+ */
+  public static void setProbeCacheSize(int maxEntries) {
+    VideoJNI.Demuxer_setProbeCacheSize(maxEntries);
+  }
+
+/**
+ * @return the most files the probe cache remembers; 0 if it is off.<br>
+ * @see #setProbeCacheSize(int)
+ */
+  public static int getProbeCacheSize() {
+    return VideoJNI.Demuxer_getProbeCacheSize();
+  }
+
+/**
+ * Adds the entries written by #saveProbeCache(String) to the probe<br>
+ * cache, so a new process does not have to probe files again. The cache<br>
+ * must already be on; entries beyond its size are dropped.<br>
+ * <br>
+ * @param path the file to read.<br>
+ * @return the number of entries read, or -1 if the file was written by<br>
+ *   an incompatible version of Humble Video (or FFmpeg) and was ignored.<br>
+ * @throws RuntimeException if the file cannot be read.
+ */
+  public static int loadProbeCache(String path) {
+    return VideoJNI.Demuxer_loadProbeCache(path);
+  }
+
+/**
+ * Writes the probe cache to a file that #loadProbeCache(String) can<br>
+ * read back.<br>
+ * <br>
+ * @param path the file to (over)write.<br>
+ * @throws RuntimeException if the file cannot be written.
+ */
+  public static void saveProbeCache(String path) {
+    VideoJNI.Demuxer_saveProbeCache(path);
+  }
+
 /**
  * Can streams be added dynamically to this container?<br>
  * <br>
@@ -476,6 +633,51 @@ public class Demuxer extends Container {
     return VideoJNI.Demuxer_seek(swigCPtr, this, stream_index, min_ts, ts, max_ts, flags);
   }
 
+/**
+ * Reads the rest of the container, recording where every key frame is<br>
+ * in its stream's index (see ContainerStream#getIndexEntry(int)), then<br>
+ * seeks back to the start.<br>
+ * <p><br>
+ * Many containers (MPEG-TS, raw H.264, some Matroska files) come with<br>
+ * no index or a sparse one, and #seek(int, long, long, long, int) on<br>
+ * them has to search the file. Once indexed, seeks to a key frame go<br>
+ * straight to it. Index once and then #saveSeekIndex(String) to skip<br>
+ * the scan next time.<br>
+ * </p><br>
+ * <br>
+ * @return the number of entries in all stream indexes afterwards.<br>
+ * @throws RuntimeException if not STATE_OPENED, or on a read error.
+ */
+  public int buildSeekIndex() throws java.lang.InterruptedException, java.io.IOException {
+    return VideoJNI.Demuxer_buildSeekIndex(swigCPtr, this);
+  }
+
+/**
+ * Writes all stream indexes to a sidecar file that<br>
+ * #loadSeekIndex(String) can read back.<br>
+ * <br>
+ * @param path the file to (over)write.<br>
+ * @throws RuntimeException if not open, or the file cannot be written.
+ */
+  public void saveSeekIndex(String path) {
+    VideoJNI.Demuxer_saveSeekIndex(swigCPtr, this, path);
+  }
+
+/**
+ * Adds the entries in a sidecar file written by #saveSeekIndex(String)<br>
+ * to this container's stream indexes, as if #buildSeekIndex() had been<br>
+ * called.<br>
+ * <br>
+ * @param path the file to read.<br>
+ * @return the number of entries added, or -1 if the file was saved for a<br>
+ *   container with a different size, streams or time bases, or for a<br>
+ *   local file modified since, in which case it is ignored.<br>
+ * @throws RuntimeException if not open, or the file cannot be read.
+ */
+  public int loadSeekIndex(String path) {
+    return VideoJNI.Demuxer_loadSeekIndex(swigCPtr, this, path);
+  }
+
 /**
  * Gets the AVFormatContext.max_delay property if possible.<br>
  * @return The max delay, error code otherwise.
@@ -500,6 +702,10 @@ public class Demuxer extends Container {
     VideoJNI.Demuxer_pause(swigCPtr, this);
   }
 
+  private int java_readBatch(long[] packets, int maxBytes, long maxDuration) throws java.lang.InterruptedException, java.io.IOException {
+    return VideoJNI.Demuxer_java_readBatch(swigCPtr, this, packets, maxBytes, maxDuration);
+  }
+
   /**
    * Demuxers can only be in one of these states:
    */
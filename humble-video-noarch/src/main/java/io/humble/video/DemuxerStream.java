@@ -149,4 +149,28 @@ public class DemuxerStream extends ContainerStream {
     return (cPtr == 0) ? null : new Demuxer(cPtr, false);
   }
 
+/**
+ * Get which packets the Demuxer drops from this stream.
+ */
+  public Codec.DiscardFlag getDiscard() {
+    return Codec.DiscardFlag.swigToEnum(VideoJNI.DemuxerStream_getDiscard(swigCPtr, this));
+  }
+
+/**
+ * Set which packets the Demuxer drops from this stream before they reach<br>
+ * Demuxer#read(MediaPacket). Set Codec#DISCARD_ALL on streams you do not<br>
+ * want and the Demuxer never returns their packets; many formats (MP4,<br>
+ * MPEG-TS, Matroska) then skip over them without reading or parsing their<br>
+ * payloads at all.<br>
+ * <p><br>
+ * Streams default to Codec#DISCARD_DEFAULT. Which packets the in-between<br>
+ * values drop is up to the format; most only honor Codec#DISCARD_ALL.<br>
+ * </p><br>
+ * <br>
+ * @param discard what to drop.
+ */
+  public void setDiscard(Codec.DiscardFlag discard) {
+    VideoJNI.DemuxerStream_setDiscard(swigCPtr, this, discard.swigValue());
+  }
+
 }
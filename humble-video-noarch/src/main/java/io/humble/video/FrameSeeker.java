@@ -0,0 +1,251 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.6
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package io.humble.video;
+import io.humble.ferry.*;
+/**
+ * Finds the exact video frame shown at a given time in a Demuxer stream.<br>
+ * <p><br>
+ * A Demuxer can only seek to key frames, so getting any other frame means<br>
+ * seeking to the key frame before it, flushing the Decoder and decoding<br>
+ * forward. A FrameSeeker does that for you, and keeps the last few group<br>
+ * of pictures (GOPs; a key frame and the frames up to the next key frame)<br>
+ * it decoded, so stepping backwards a frame at a time, or jumping back and<br>
+ * forth over a short range, mostly returns frames that are already decoded.<br>
+ * </p><p><br>
+ * A FrameSeeker reads from and seeks its Demuxer and decodes with its<br>
+ * stream's Decoder; do not use either yourself while using it. Every<br>
+ * cached frame holds a whole decoded picture, so keep the cache small for<br>
+ * large pictures or long GOPs.<br>
+ * </p>
+ */
+public class FrameSeeker extends RefCounted {
+  // JNIHelper.swg: Start generated code
+  // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+  /**
+   * This method is only here to use some references and remove
+   * a Eclipse compiler warning.
+   */
+  @SuppressWarnings("unused")
+  private void noop()
+  {
+    Buffer.make(null, 1);
+  }
+   
+  private volatile long swigCPtr;
+
+  /**
+   * Internal Only.
+   */
+  protected FrameSeeker(long cPtr, boolean cMemoryOwn) {
+    super(VideoJNI.FrameSeeker_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+  
+  /**
+   * Internal Only.
+   */
+  protected FrameSeeker(long cPtr, boolean cMemoryOwn,
+      java.util.concurrent.atomic.AtomicLong ref)
+  {
+    super(VideoJNI.FrameSeeker_SWIGUpcast(cPtr),
+     cMemoryOwn, ref);
+    swigCPtr = cPtr;
+  }
+    
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that obj is proxying for.
+   *   
+   * @param obj The java proxy object for a native object.
+   * @return The raw pointer obj is proxying for.
+   */
+  protected static long getCPtr(FrameSeeker obj) {
+    if (obj == null) return 0;
+    return obj.getMyCPtr();
+  }
+
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that we're proxying for.
+   *   
+   * @return The raw pointer we're proxying for.
+   */  
+  protected long getMyCPtr() {
+    if (swigCPtr == 0) throw new IllegalStateException("underlying native object already deleted");
+    return swigCPtr;
+  }
+  
+  /**
+   * Create a new FrameSeeker object that is actually referring to the
+   * exact same underlying native object.
+   *
+   * @return the new Java object.
+   */
+  @Override
+  public FrameSeeker copyReference() {
+    if (swigCPtr == 0)
+      return null;
+    else
+      return new FrameSeeker(swigCPtr, swigCMemOwn, getJavaRefCount());
+  }
+
+  /**
+   * Compares two values, returning true if the underlying objects in native code are the same object.
+   *
+   * That means you can have two different Java objects, but when you do a comparison, you'll find out
+   * they are the EXACT same object.
+   *
+   * @return True if the underlying native object is the same.  False otherwise.
+   */
+  public boolean equals(Object obj) {
+    boolean equal = false;
+    if (obj instanceof FrameSeeker)
+      equal = (((FrameSeeker)obj).swigCPtr == this.swigCPtr);
+    return equal;
+  }
+  
+  /**
+   * Get a hashable value for this object.
+   *
+   * @return the hashable value.
+   */
+  public int hashCode() {
+     return (int)swigCPtr;
+  }
+  
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // JNIHelper.swg: End generated code
+  /**
+   * info about this seeker
+   * @return information about this object
+   */
+   
+  @Override
+  public String toString()
+  {
+    StringBuilder result = new StringBuilder();
+    
+    result.append(this.getClass().getName()+"@"+hashCode()+"[");
+    result.append("stream:"+getStreamIndex()+";");
+    result.append("cached-gops:"+getNumCachedGops()+"/"+getMaxCachedGops()+";");
+    result.append("cached-bytes:"+getCachedBytes()+"/"+getMaxCachedBytes()+";");
+    result.append("]");
+    return result.toString();
+  }
+
+/**
+ * Create a FrameSeeker.<br>
+ * <br>
+ * @param demuxer An open Demuxer. Its stream metadata must have been<br>
+ *   queried (see Demuxer#queryStreamMetaData()).<br>
+ * @param streamIndex The video stream to find frames in. Its Decoder is<br>
+ *   opened if it is not already.<br>
+ * @param maxCachedGops How many decoded GOPs to keep, least recently used<br>
+ *   first out. 0 keeps none. The memory they take is bounded too; see<br>
+ *   #setMaxCachedBytes(long).<br>
+ * <br>
+ * @throws InvalidArgument if demuxer is null, streamIndex is not a video<br>
+ *   stream in it, or maxCachedGops &lt; 0.
+ */
+  public static FrameSeeker make(Demuxer demuxer, int streamIndex, int maxCachedGops) {
+    long cPtr = VideoJNI.FrameSeeker_make(Demuxer.getCPtr(demuxer), demuxer, streamIndex, maxCachedGops);
+    return (cPtr == 0) ? null : new FrameSeeker(cPtr, false);
+  }
+
+/**
+ * Get the frame that is shown at timeStamp: the last frame whose time<br>
+ * stamp is &lt;= timeStamp, or the first frame in the stream if timeStamp is<br>
+ * before it.<br>
+ * <p><br>
+ * Each call returns a new picture, but its pixel data is shared with the<br>
+ * cache and with every other picture returned for the same frame: treat<br>
+ * it as read-only, and copy it with MediaPicture#make(MediaPicture,<br>
+ * boolean) before drawing on it.<br>
+ * </p><br>
+ * <br>
+ * @param timeStamp The time wanted, in the same units (the stream's time<br>
+ *   base) as the time stamps on the stream's packets and decoded pictures.<br>
+ * <br>
+ * @return The frame, or null if the stream has no frames to decode.<br>
+ * @throws RuntimeException if the Demuxer cannot seek or a read or decode<br>
+ *   fails.
+ */
+  public MediaPicture seekToFrame(long timeStamp) throws java.lang.InterruptedException, java.io.IOException {
+    long cPtr = VideoJNI.FrameSeeker_seekToFrame(swigCPtr, this, timeStamp);
+    return (cPtr == 0) ? null : new MediaPicture(cPtr, false);
+  }
+
+/**
+ * @return the index of the stream this FrameSeeker decodes.
+ */
+  public int getStreamIndex() {
+    return VideoJNI.FrameSeeker_getStreamIndex(swigCPtr, this);
+  }
+
+/**
+ * @return the Decoder this FrameSeeker decodes with.
+ */
+  public Decoder getDecoder() {
+    long cPtr = VideoJNI.FrameSeeker_getDecoder(swigCPtr, this);
+    return (cPtr == 0) ? null : new Decoder(cPtr, false);
+  }
+
+/**
+ * @return the most decoded GOPs this FrameSeeker keeps.
+ */
+  public int getMaxCachedGops() {
+    return VideoJNI.FrameSeeker_getMaxCachedGops(swigCPtr, this);
+  }
+
+/**
+ * @return how many decoded GOPs this FrameSeeker is keeping now.
+ */
+  public int getNumCachedGops() {
+    return VideoJNI.FrameSeeker_getNumCachedGops(swigCPtr, this);
+  }
+
+/**
+ * @return the most bytes of decoded pictures this FrameSeeker keeps.<br>
+ *   Defaults to 256 MiB.
+ */
+  public long getMaxCachedBytes() {
+    return VideoJNI.FrameSeeker_getMaxCachedBytes(swigCPtr, this);
+  }
+
+/**
+ * Set the most bytes of decoded pictures to keep, throwing away the least<br>
+ * recently used GOPs now if more than that is kept. GOPs are thrown away<br>
+ * when they pass either this or #getMaxCachedGops(); a GOP larger than<br>
+ * this on its own is not kept at all.<br>
+ * <br>
+ * @param maxCachedBytes The bound, in bytes of picture data.<br>
+ * <br>
+ * @throws InvalidArgument if maxCachedBytes &lt; 0.
+ */
+  public void setMaxCachedBytes(long maxCachedBytes) {
+    VideoJNI.FrameSeeker_setMaxCachedBytes(swigCPtr, this, maxCachedBytes);
+  }
+
+/**
+ * @return the bytes of decoded pictures this FrameSeeker is keeping now.
+ */
+  public long getCachedBytes() {
+    return VideoJNI.FrameSeeker_getCachedBytes(swigCPtr, this);
+  }
+
+/**
+ * Throw away all decoded GOPs.
+ */
+  public void clearCache() {
+    VideoJNI.FrameSeeker_clearCache(swigCPtr, this);
+  }
+
+}
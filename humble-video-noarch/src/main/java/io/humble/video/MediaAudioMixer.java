@@ -0,0 +1,311 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.6
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package io.humble.video;
+import io.humble.ferry.*;
+/**
+ * Mixes audio from many inputs, such as commentary over program audio or<br>
+ * everyone speaking in a conference, into frames of a fixed number of<br>
+ * samples, each input scaled by its own gain.<br>
+ * <p><br>
+ * Inputs must already be in the mixer's sample rate, channel layout and<br>
+ * format (use a MediaAudioResampler if they are not), which must be S16 or<br>
+ * FLT, planar or not. S16 is summed in float and clipped once at the end;<br>
+ * FLT is not clipped. Sums use SSE4 or AVX2 kernels where the CPU has them.<br>
+ * </p><p><br>
+ * Audio is lined up by time stamp: the first time stamp added starts the<br>
+ * mix, and every sample after that goes to its place in the mix whichever<br>
+ * input it came in on. Gaps within an input are silent, audio that<br>
+ * overlaps audio already added to the same input replaces it, and audio<br>
+ * without a time stamp follows on from the last audio added to its input.<br>
+ * Audio for samples that have already been mixed is dropped.<br>
+ * </p><p><br>
+ * Each input buffers at most #getFrameSize() + #getMaxDelay() samples. A<br>
+ * frame is mixed once every input that has not ended holds a whole frame,<br>
+ * or once any input's buffer is full, in which case inputs that are<br>
+ * behind are treated as silent for that frame. So a stalled input delays<br>
+ * the mix by no more than #getMaxDelay() samples, and audio more than<br>
+ * that far ahead of the mix is dropped. #getNumDroppedSamples() counts<br>
+ * samples dropped for being late or too far ahead.<br>
+ * </p><p><br>
+ * Mixers are safe to use from several threads.<br>
+ * </p>
+ */
+public class MediaAudioMixer extends RefCounted {
+  // JNIHelper.swg: Start generated code
+  // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+  /**
+   * This method is only here to use some references and remove
+   * a Eclipse compiler warning.
+   */
+  @SuppressWarnings("unused")
+  private void noop()
+  {
+    Buffer.make(null, 1);
+  }
+   
+  private volatile long swigCPtr;
+
+  /**
+   * Internal Only.
+   */
+  protected MediaAudioMixer(long cPtr, boolean cMemoryOwn) {
+    super(VideoJNI.MediaAudioMixer_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+  
+  /**
+   * Internal Only.
+   */
+  protected MediaAudioMixer(long cPtr, boolean cMemoryOwn,
+      java.util.concurrent.atomic.AtomicLong ref)
+  {
+    super(VideoJNI.MediaAudioMixer_SWIGUpcast(cPtr),
+     cMemoryOwn, ref);
+    swigCPtr = cPtr;
+  }
+    
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that obj is proxying for.
+   *   
+   * @param obj The java proxy object for a native object.
+   * @return The raw pointer obj is proxying for.
+   */
+  protected static long getCPtr(MediaAudioMixer obj) {
+    if (obj == null) return 0;
+    return obj.getMyCPtr();
+  }
+
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that we're proxying for.
+   *   
+   * @return The raw pointer we're proxying for.
+   */  
+  protected long getMyCPtr() {
+    if (swigCPtr == 0) throw new IllegalStateException("underlying native object already deleted");
+    return swigCPtr;
+  }
+  
+  /**
+   * Create a new MediaAudioMixer object that is actually referring to the
+   * exact same underlying native object.
+   *
+   * @return the new Java object.
+   */
+  @Override
+  public MediaAudioMixer copyReference() {
+    if (swigCPtr == 0)
+      return null;
+    else
+      return new MediaAudioMixer(swigCPtr, swigCMemOwn, getJavaRefCount());
+  }
+
+  /**
+   * Compares two values, returning true if the underlying objects in native code are the same object.
+   *
+   * That means you can have two different Java objects, but when you do a comparison, you'll find out
+   * they are the EXACT same object.
+   *
+   * @return True if the underlying native object is the same.  False otherwise.
+   */
+  public boolean equals(Object obj) {
+    boolean equal = false;
+    if (obj instanceof MediaAudioMixer)
+      equal = (((MediaAudioMixer)obj).swigCPtr == this.swigCPtr);
+    return equal;
+  }
+  
+  /**
+   * Get a hashable value for this object.
+   *
+   * @return the hashable value.
+   */
+  public int hashCode() {
+     return (int)swigCPtr;
+  }
+  
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // JNIHelper.swg: End generated code
+
+/**
+ * Makes a mixer with no inputs.<br>
+ * <br>
+ * @param sampleRate The sample rate of the inputs and the mix.<br>
+ * @param channelLayout The channel layout of the inputs and the mix.<br>
+ * @param format The AudioFormat.Type of the inputs and the mix; S16 or<br>
+ *   FLT, planar or not.<br>
+ * @param frameSize The number of samples in each frame mixed.<br>
+ * <br>
+ * @return a new mixer.<br>
+ * <br>
+ * @throws InvalidArgument if sampleRate or frameSize are not positive,<br>
+ *   channelLayout is unknown, or format is not S16 or FLT.
+ */
+  public static MediaAudioMixer make(int sampleRate, AudioChannel.Layout channelLayout, AudioFormat.Type format, int frameSize) {
+    long cPtr = VideoJNI.MediaAudioMixer_make(sampleRate, channelLayout.swigValue(), format.swigValue(), frameSize);
+    return (cPtr == 0) ? null : new MediaAudioMixer(cPtr, false);
+  }
+
+/**
+ *  @return the sample rate of the inputs and the mix.
+ */
+  public int getSampleRate() {
+    return VideoJNI.MediaAudioMixer_getSampleRate(swigCPtr, this);
+  }
+
+/**
+ *  @return the channel layout of the inputs and the mix.
+ */
+  public AudioChannel.Layout getChannelLayout() {
+    return AudioChannel.Layout.swigToEnum(VideoJNI.MediaAudioMixer_getChannelLayout(swigCPtr, this));
+  }
+
+/**
+ *  @return the number of channels in the channel layout.
+ */
+  public int getChannels() {
+    return VideoJNI.MediaAudioMixer_getChannels(swigCPtr, this);
+  }
+
+/**
+ *  @return the AudioFormat.Type of the inputs and the mix.
+ */
+  public AudioFormat.Type getFormat() {
+    return AudioFormat.Type.swigToEnum(VideoJNI.MediaAudioMixer_getFormat(swigCPtr, this));
+  }
+
+/**
+ *  @return the number of samples in each frame mixed.
+ */
+  public int getFrameSize() {
+    return VideoJNI.MediaAudioMixer_getFrameSize(swigCPtr, this);
+  }
+
+/**
+ * Sets how far an input may run ahead of the mix, which is also the<br>
+ * longest a stalled input can hold up the mix. Audio already buffered<br>
+ * beyond the new limit is dropped.<br>
+ * <br>
+ * @param maxDelay The number of samples; defaults to a quarter of a<br>
+ *   second.<br>
+ * <br>
+ * @throws InvalidArgument if maxDelay is negative.
+ */
+  public void setMaxDelay(int maxDelay) {
+    VideoJNI.MediaAudioMixer_setMaxDelay(swigCPtr, this, maxDelay);
+  }
+
+/**
+ *  @return how far, in samples, an input may run ahead of the mix.
+ */
+  public int getMaxDelay() {
+    return VideoJNI.MediaAudioMixer_getMaxDelay(swigCPtr, this);
+  }
+
+/**
+ * Adds an input.<br>
+ * <br>
+ * @param gain What to multiply the input's samples by; 1 leaves them<br>
+ *   as they are, and 0 leaves the input out of the mix.<br>
+ * <br>
+ * @return the index of the new input, counting from 0.
+ */
+  public int addInput(double gain) {
+    return VideoJNI.MediaAudioMixer_addInput(swigCPtr, this, gain);
+  }
+
+/**
+ *  @return the number of inputs added.
+ */
+  public int getNumInputs() {
+    return VideoJNI.MediaAudioMixer_getNumInputs(swigCPtr, this);
+  }
+
+/**
+ * Sets an input's gain, from the next frame mixed on.<br>
+ * <br>
+ * @throws InvalidArgument if there is no such input.
+ */
+  public void setGain(int input, double gain) {
+    VideoJNI.MediaAudioMixer_setGain(swigCPtr, this, input, gain);
+  }
+
+/**
+ * @return an input's gain.<br>
+ * <br>
+ * @throws InvalidArgument if there is no such input.
+ */
+  public double getGain(int input) {
+    return VideoJNI.MediaAudioMixer_getGain(swigCPtr, this, input);
+  }
+
+/**
+ * Adds audio to an input. The audio is copied, so it may be reused as<br>
+ * soon as this returns.<br>
+ * <br>
+ * @param input The index of the input.<br>
+ * @param audio The audio to add.<br>
+ * <br>
+ * @throws InvalidArgument if there is no such input, the input has<br>
+ *   ended, audio is null or incomplete, or its sample rate, channel<br>
+ *   layout or format differ from the mixer's.
+ */
+  public void addAudio(int input, MediaAudio audio) {
+    VideoJNI.MediaAudioMixer_addAudio(swigCPtr, this, input, MediaAudio.getCPtr(audio), audio);
+  }
+
+/**
+ * Ends an input: the mix no longer waits for it, and once every input<br>
+ * has ended, #mix(MediaAudio) drains what is left.<br>
+ * <br>
+ * @throws InvalidArgument if there is no such input.
+ */
+  public void endInput(int input) {
+    VideoJNI.MediaAudioMixer_endInput(swigCPtr, this, input);
+  }
+
+/**
+ * @return the number of samples buffered for an input but not yet<br>
+ *   mixed, counting any silent gaps between them.<br>
+ * <br>
+ * @throws InvalidArgument if there is no such input.
+ */
+  public int getNumBuffered(int input) {
+    return VideoJNI.MediaAudioMixer_getNumBuffered(swigCPtr, this, input);
+  }
+
+/**
+ * Mixes the next frame, if it is ready.<br>
+ * <br>
+ * @param output The audio to mix into, with the mixer's sample rate,<br>
+ *   channel layout and format and room for #getFrameSize() samples. It<br>
+ *   is given a 1/#getSampleRate() time base and the time stamp of the<br>
+ *   frame's first sample.<br>
+ * <br>
+ * @return the number of samples mixed: #getFrameSize(), fewer for the<br>
+ *   last frame once every input has ended, or 0 (leaving output<br>
+ *   incomplete) if the next frame is not ready yet.<br>
+ * <br>
+ * @throws InvalidArgument if output is null or does not match the mixer.
+ */
+  public int mix(MediaAudio output) {
+    return VideoJNI.MediaAudioMixer_mix(swigCPtr, this, MediaAudio.getCPtr(output), output);
+  }
+
+/**
+ *  @return the number of samples dropped from inputs for being late or too far ahead.
+ */
+  public long getNumDroppedSamples() {
+    return VideoJNI.MediaAudioMixer_getNumDroppedSamples(swigCPtr, this);
+  }
+
+}
@@ -0,0 +1,246 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.6
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package io.humble.video;
+import io.humble.ferry.*;
+/**
+ * Hands out MediaAudio objects of one size, sample rate, channel layout<br>
+ * and format, and takes them back to hand out again once the last<br>
+ * reference to them is released; the audio counterpart of<br>
+ * MediaPicturePool.<br>
+ * <p><br>
+ * Audio comes back with its samples as they were left, but holding<br>
+ * #getNumSamples() samples again and with every other property reset.<br>
+ * It is only kept if the pool still has room, if it still holds the data<br>
+ * it was handed out with, and if nothing else holds a reference to that<br>
+ * data.<br>
+ * </p><p><br>
+ * Audio holds a reference to its pool, so a pool lives until all the<br>
+ * audio it handed out has been released. Pools are safe to use from<br>
+ * several threads.<br>
+ * </p>
+ */
+public class MediaAudioPool extends RefCounted {
+  // JNIHelper.swg: Start generated code
+  // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+  /**
+   * This method is only here to use some references and remove
+   * a Eclipse compiler warning.
+   */
+  @SuppressWarnings("unused")
+  private void noop()
+  {
+    Buffer.make(null, 1);
+  }
+   
+  private volatile long swigCPtr;
+
+  /**
+   * Internal Only.
+   */
+  protected MediaAudioPool(long cPtr, boolean cMemoryOwn) {
+    super(VideoJNI.MediaAudioPool_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+  
+  /**
+   * Internal Only.
+   */
+  protected MediaAudioPool(long cPtr, boolean cMemoryOwn,
+      java.util.concurrent.atomic.AtomicLong ref)
+  {
+    super(VideoJNI.MediaAudioPool_SWIGUpcast(cPtr),
+     cMemoryOwn, ref);
+    swigCPtr = cPtr;
+  }
+    
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that obj is proxying for.
+   *   
+   * @param obj The java proxy object for a native object.
+   * @return The raw pointer obj is proxying for.
+   */
+  protected static long getCPtr(MediaAudioPool obj) {
+    if (obj == null) return 0;
+    return obj.getMyCPtr();
+  }
+
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that we're proxying for.
+   *   
+   * @return The raw pointer we're proxying for.
+   */  
+  protected long getMyCPtr() {
+    if (swigCPtr == 0) throw new IllegalStateException("underlying native object already deleted");
+    return swigCPtr;
+  }
+  
+  /**
+   * Create a new MediaAudioPool object that is actually referring to the
+   * exact same underlying native object.
+   *
+   * @return the new Java object.
+   */
+  @Override
+  public MediaAudioPool copyReference() {
+    if (swigCPtr == 0)
+      return null;
+    else
+      return new MediaAudioPool(swigCPtr, swigCMemOwn, getJavaRefCount());
+  }
+
+  /**
+   * Compares two values, returning true if the underlying objects in native code are the same object.
+   *
+   * That means you can have two different Java objects, but when you do a comparison, you'll find out
+   * they are the EXACT same object.
+   *
+   * @return True if the underlying native object is the same.  False otherwise.
+   */
+  public boolean equals(Object obj) {
+    boolean equal = false;
+    if (obj instanceof MediaAudioPool)
+      equal = (((MediaAudioPool)obj).swigCPtr == this.swigCPtr);
+    return equal;
+  }
+  
+  /**
+   * Get a hashable value for this object.
+   *
+   * @return the hashable value.
+   */
+  public int hashCode() {
+     return (int)swigCPtr;
+  }
+  
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // JNIHelper.swg: End generated code
+
+/**
+ * Makes a pool of audio laid out as<br>
+ * MediaAudio#make(int, int, int, AudioChannel.Layout, AudioFormat.Type)<br>
+ * lays it out.<br>
+ * <br>
+ * @param numSamples The number of samples each MediaAudio holds.<br>
+ * @param sampleRate The sample rate (per second) of the audio.<br>
+ * @param channels The number of channels of audio.<br>
+ * @param channelLayout The channel layout of the audio.<br>
+ * @param format The format of the audio.<br>
+ * @param capacity The most released MediaAudio objects to keep for reuse.<br>
+ * <br>
+ * @return the pool, empty until audio is released to it.<br>
+ * <br>
+ * @throws InvalidArgument if numSamples, sampleRate or channels are not<br>
+ *   positive, channelLayout does not have that many channels, format is<br>
+ *   AudioFormat.Type.SAMPLE_FMT_NONE, or capacity is negative.
+ */
+  public static MediaAudioPool make(int numSamples, int sampleRate, int channels, AudioChannel.Layout channelLayout, AudioFormat.Type format, int capacity) {
+    long cPtr = VideoJNI.MediaAudioPool_make(numSamples, sampleRate, channels, channelLayout.swigValue(), format.swigValue(), capacity);
+    return (cPtr == 0) ? null : new MediaAudioPool(cPtr, false);
+  }
+
+/**
+ * Gets audio, reusing released audio if the pool has any.<br>
+ * <br>
+ * @return audio of this pool's size, sample rate, layout and format.
+ */
+  public MediaAudio getAudio() {
+    long cPtr = VideoJNI.MediaAudioPool_getAudio(swigCPtr, this);
+    return (cPtr == 0) ? null : new MediaAudio(cPtr, false);
+  }
+
+/**
+ *  @return the number of samples each MediaAudio holds.
+ */
+  public int getNumSamples() {
+    return VideoJNI.MediaAudioPool_getNumSamples(swigCPtr, this);
+  }
+
+/**
+ *  @return the sample rate of the audio.
+ */
+  public int getSampleRate() {
+    return VideoJNI.MediaAudioPool_getSampleRate(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of channels of the audio.
+ */
+  public int getChannels() {
+    return VideoJNI.MediaAudioPool_getChannels(swigCPtr, this);
+  }
+
+/**
+ *  @return the channel layout of the audio.
+ */
+  public AudioChannel.Layout getChannelLayout() {
+    return AudioChannel.Layout.swigToEnum(VideoJNI.MediaAudioPool_getChannelLayout(swigCPtr, this));
+  }
+
+/**
+ *  @return the format of the audio.
+ */
+  public AudioFormat.Type getFormat() {
+    return AudioFormat.Type.swigToEnum(VideoJNI.MediaAudioPool_getFormat(swigCPtr, this));
+  }
+
+/**
+ *  @return the most released MediaAudio objects kept for reuse.
+ */
+  public int getCapacity() {
+    return VideoJNI.MediaAudioPool_getCapacity(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of released MediaAudio objects waiting to be reused.
+ */
+  public int getNumIdle() {
+    return VideoJNI.MediaAudioPool_getNumIdle(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of times #getAudio() reused audio.
+ */
+  public long getNumReused() {
+    return VideoJNI.MediaAudioPool_getNumReused(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of times #getAudio() had to make new audio.
+ */
+  public long getNumAllocated() {
+    return VideoJNI.MediaAudioPool_getNumAllocated(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of released MediaAudio objects taken back for reuse.
+ */
+  public long getNumRecycled() {
+    return VideoJNI.MediaAudioPool_getNumRecycled(swigCPtr, this);
+  }
+
+/**
+ * @return the number of released MediaAudio objects freed instead,<br>
+ *   because the pool was full or they could not be reused.
+ */
+  public long getNumDiscarded() {
+    return VideoJNI.MediaAudioPool_getNumDiscarded(swigCPtr, this);
+  }
+
+/**
+ * Zeros the reused, allocated, recycled and discarded counts.
+ */
+  public void resetStatistics() {
+    VideoJNI.MediaAudioPool_resetStatistics(swigCPtr, this);
+  }
+
+}
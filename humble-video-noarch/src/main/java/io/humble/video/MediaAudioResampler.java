@@ -112,6 +112,41 @@ public class MediaAudioResampler extends MediaResampler {
   // <<<<<<<<<<<<<<<<<<<<<<<<<<<
   // JNIHelper.swg: End generated code
   
+  /**
+   * Convert many pieces of input audio into whole output audio objects,
+   * such as the fixed size frames an encoder wants.
+   * <p>
+   * Each output is filled to its MediaAudio#getMaxNumSamples(), in order,
+   * and gets the time stamp of its first sample. Samples that do not fill
+   * a whole output are held back and come out first on the next call (or
+   * the next call to #resampleAudio(MediaAudio,MediaAudio)), as are any
+   * that do not fit in the outputs given. Pass no inputs to flush
+   * everything out at the end; the last output filled may then be short.
+   * </p>
+   *
+   * @param outs output audio objects, all of the output format.
+   * @param ins input audio, in order; null entries are skipped. Null or
+   *   empty to flush.
+   * @return the number of outputs filled; those after it are left alone.
+   * @throws RuntimeException if we get an error or IllegalArgumentException
+   *   if the attributes of any input or output do not match what this
+   *   resampler expected.
+   */
+  public int resampleBatch(MediaAudio[] outs, MediaAudio[] ins) {
+    if (outs == null)
+      throw new IllegalArgumentException("no outputs to resample into");
+    final long[] outPtrs = new long[outs.length];
+    for(int i = 0; i < outs.length; i++) {
+      if (outs[i] == null)
+        throw new IllegalArgumentException("null output passed to resampleBatch");
+      outPtrs[i] = MediaAudio.getCPtr(outs[i]);
+    }
+    final long[] inPtrs = new long[ins == null ? 0 : ins.length];
+    for(int i = 0; i < inPtrs.length; i++)
+      inPtrs[i] = MediaAudio.getCPtr(ins[i]);
+    return java_resampleBatch(outPtrs, inPtrs);
+  }
+
 /**
  * Create a new MediaAudioResampler.
  */
@@ -176,6 +211,44 @@ public class MediaAudioResampler extends MediaResampler {
     return VideoJNI.MediaAudioResampler_getOutputChannels(swigCPtr, this);
   }
 
+/**
+ * Set whether dedicated conversion routines may be used instead of the<br>
+ * general purpose resampler when the parameters allow it.<br>
+ * <p><br>
+ * When the input and output sample rates are the same, S16 and FLT<br>
+ * audio, planar or interleaved, is converted between formats, and mixed<br>
+ * from stereo to mono or mono to stereo, by routines written for SSE4<br>
+ * and AVX2 and picked at run time for the CPU. They produce exactly the<br>
+ * same samples as the general resampler, and are not used once<br>
+ * #setCompensation(int,int) or #dropOutput(int) have been called, or if<br>
+ * properties that change the output (such as dithering, timestamp<br>
+ * compensation or the rematrix volume) have been set.<br>
+ * </p><br>
+ * Must be called before #open().<br>
+ * <br>
+ * @param fastPaths true (the default) to allow them, false to always use<br>
+ *   the general resampler.
+ */
+  public void setFastPaths(boolean fastPaths) {
+    VideoJNI.MediaAudioResampler_setFastPaths(swigCPtr, this, fastPaths);
+  }
+
+/**
+ * @return whether dedicated conversion routines are allowed.<br>
+ * @see #setFastPaths(boolean)
+ */
+  public boolean getFastPaths() {
+    return VideoJNI.MediaAudioResampler_getFastPaths(swigCPtr, this);
+  }
+
+/**
+ * @return true if this resampler is open and converting with one of the<br>
+ *   dedicated routines described in #setFastPaths(boolean).
+ */
+  public boolean usesFastPath() {
+    return VideoJNI.MediaAudioResampler_usesFastPath(swigCPtr, this);
+  }
+
 /**
  * Opens the resampler so it can be ready for resampling.<br>
  * You should NOT set options after you open this object.
@@ -246,6 +319,7 @@ public class MediaAudioResampler extends MediaResampler {
  * @return AVERROR error code in case of failure.<br>
  * <br>
  * Drops the specified number of output samples.<br>
+ * Samples held back by #resampleBatch are not dropped.<br>
  * @return # of samples dropped.
  */
   public int dropOutput(int count) {
@@ -328,4 +402,8 @@ public class MediaAudioResampler extends MediaResampler {
     return MediaResampler.State.swigToEnum(VideoJNI.MediaAudioResampler_getState(swigCPtr, this));
   }
 
+  private int java_resampleBatch(long[] outs, long[] ins) {
+    return VideoJNI.MediaAudioResampler_java_resampleBatch(swigCPtr, this, outs, ins);
+  }
+
 }
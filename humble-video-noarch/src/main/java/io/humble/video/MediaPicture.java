@@ -140,6 +140,12 @@ public class MediaPicture extends MediaSampled {
 
 /**
  * Create a media picture.<br>
+ * <p><br>
+ * Each row of each plane starts on a 64 byte boundary, with line sizes<br>
+ * padded to match, so SIMD code in resamplers, filters and encoders can<br>
+ * use aligned loads and stores. Use #make(int, int, PixelFormat.Type, int)<br>
+ * with an alignment of 1 for rows packed one after another.<br>
+ * </p><br>
  * <br>
  * @param width Number of pixels wide.<br>
  * @param height Number of pixels high.<br>
@@ -156,6 +162,12 @@ public class MediaPicture extends MediaSampled {
 
 /**
  * Create a media picture using a buffer as the memory backing it.<br>
+ * <p><br>
+ * The planes are packed: each row follows the one before it, with<br>
+ * line sizes no larger than a row of pixels needs, and each plane<br>
+ * follows the one before it, exactly as<br>
+ * PixelFormat#getBufferSizeNeeded(int, int, PixelFormat.Type) counts.<br>
+ * </p><br>
  * <br>
  * @param buffer A buffer of data to use for the image.<br>
  * @param width Number of pixels wide.<br>
@@ -186,6 +198,62 @@ public class MediaPicture extends MediaSampled {
     return (cPtr == 0) ? null : new MediaPicture(cPtr, false);
   }
 
+/**
+ * Create a media picture whose rows start on a given boundary.<br>
+ * <p><br>
+ * Line sizes are padded up to a multiple of alignment and every plane<br>
+ * starts on such a boundary. An alignment of 1 packs the rows and<br>
+ * planes one after another, as #make(Buffer, int, int, PixelFormat.Type)<br>
+ * does, for callers that want the picture as contiguous bytes.<br>
+ * </p><br>
+ * <br>
+ * @param width Number of pixels wide.<br>
+ * @param height Number of pixels high.<br>
+ * @param format PixelFormat.Type of the MediaPicture<br>
+ * @param alignment The boundary, in bytes; a power of two from 1 to 256.<br>
+ * <br>
+ * @return A MediaPicture with memory allocated for it.<br>
+ * <br>
+ * @throws InvalidArgument if width or height are not positive, format is<br>
+ *   PixelFormat.Type.PIX_FMT_NONE or cannot be allocated, or alignment<br>
+ *   is not a power of two from 1 to 256.
+ */
+  public static MediaPicture make(int width, int height, PixelFormat.Type format, int alignment) {
+    long cPtr = VideoJNI.MediaPicture_make__SWIG_3(width, height, format.swigValue(), alignment);
+    return (cPtr == 0) ? null : new MediaPicture(cPtr, false);
+  }
+
+/**
+ * Create a picture of a rectangle within src, without copying any data.<br>
+ * <p><br>
+ * The new picture references the same underlying buffers as src, with<br>
+ * its data starting at the top left of the rectangle and the same line<br>
+ * sizes, so writing to either changes what the other holds. It can be<br>
+ * passed anywhere a picture is read from, such as an Encoder, a<br>
+ * FilterPictureSource or a MediaPictureResampler; bear in mind its rows<br>
+ * need not start on the alignment a freshly allocated picture has.<br>
+ * Meta-data such as the time stamp and time base is copied from src.<br>
+ * </p><br>
+ * <br>
+ * @param src A source MediaPicture.<br>
+ * @param x The left edge of the rectangle, in pixels. Must be a multiple<br>
+ *   of the horizontal chroma subsampling of src's format (2 for YUV420P).<br>
+ * @param y The top edge of the rectangle, in pixels. Must be a multiple<br>
+ *   of the vertical chroma subsampling of src's format (2 for YUV420P).<br>
+ * @param width The width of the rectangle; it must fit within src.<br>
+ * @param height The height of the rectangle; it must fit within src.<br>
+ * <br>
+ * @return A MediaPicture.<br>
+ * <br>
+ * @throws InvalidArgument if src is null or has no data, the rectangle<br>
+ *   does not fit or is not aligned to the chroma subsampling, or src's<br>
+ *   format packs several pixels into a byte or is a hardware format.
+ */
+  public static MediaPicture makeView(MediaPicture src, int x, int y, int width, int height) {
+    long cPtr = VideoJNI.MediaPicture_makeView(MediaPicture.getCPtr(src), src, x, y, width, height);
+    return (cPtr == 0) ? null : new MediaPicture(cPtr, false);
+  }
+
 /**
  * Get any underlying raw data available for this object.<br>
  * <br>
@@ -0,0 +1,229 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.6
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package io.humble.video;
+import io.humble.ferry.*;
+/**
+ * Hands out MediaPicture objects of one width, height and format, and<br>
+ * takes them back to hand out again once the last reference to them is<br>
+ * released, so a loop that makes a picture per frame stops allocating<br>
+ * frames and buffers once the pool has warmed up.<br>
+ * <p><br>
+ * A picture comes back with its data as it was left, but with every<br>
+ * other property (time stamp, time base, picture type, the complete flag<br>
+ * and so on) reset. It is only kept if the pool still has room, if it<br>
+ * still holds the data it was handed out with, and if nothing else holds<br>
+ * a reference to that data: a picture that was decoded into, or whose<br>
+ * planes a filter graph or encoder still has, is freed as usual.<br>
+ * </p><p><br>
+ * Pictures hold a reference to their pool, so a pool lives until every<br>
+ * picture it handed out has been released. Pools are safe to use from<br>
+ * several threads.<br>
+ * </p>
+ */
+public class MediaPicturePool extends RefCounted {
+  // JNIHelper.swg: Start generated code
+  // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+  /**
+   * This method is only here to use some references and remove
+   * a Eclipse compiler warning.
+   */
+  @SuppressWarnings("unused")
+  private void noop()
+  {
+    Buffer.make(null, 1);
+  }
+   
+  private volatile long swigCPtr;
+
+  /**
+   * Internal Only.
+   */
+  protected MediaPicturePool(long cPtr, boolean cMemoryOwn) {
+    super(VideoJNI.MediaPicturePool_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+  
+  /**
+   * Internal Only.
+   */
+  protected MediaPicturePool(long cPtr, boolean cMemoryOwn,
+      java.util.concurrent.atomic.AtomicLong ref)
+  {
+    super(VideoJNI.MediaPicturePool_SWIGUpcast(cPtr),
+     cMemoryOwn, ref);
+    swigCPtr = cPtr;
+  }
+    
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that obj is proxying for.
+   *   
+   * @param obj The java proxy object for a native object.
+   * @return The raw pointer obj is proxying for.
+   */
+  protected static long getCPtr(MediaPicturePool obj) {
+    if (obj == null) return 0;
+    return obj.getMyCPtr();
+  }
+
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that we're proxying for.
+   *   
+   * @return The raw pointer we're proxying for.
+   */  
+  protected long getMyCPtr() {
+    if (swigCPtr == 0) throw new IllegalStateException("underlying native object already deleted");
+    return swigCPtr;
+  }
+  
+  /**
+   * Create a new MediaPicturePool object that is actually referring to the
+   * exact same underlying native object.
+   *
+   * @return the new Java object.
+   */
+  @Override
+  public MediaPicturePool copyReference() {
+    if (swigCPtr == 0)
+      return null;
+    else
+      return new MediaPicturePool(swigCPtr, swigCMemOwn, getJavaRefCount());
+  }
+
+  /**
+   * Compares two values, returning true if the underlying objects in native code are the same object.
+   *
+   * That means you can have two different Java objects, but when you do a comparison, you'll find out
+   * they are the EXACT same object.
+   *
+   * @return True if the underlying native object is the same.  False otherwise.
+   */
+  public boolean equals(Object obj) {
+    boolean equal = false;
+    if (obj instanceof MediaPicturePool)
+      equal = (((MediaPicturePool)obj).swigCPtr == this.swigCPtr);
+    return equal;
+  }
+  
+  /**
+   * Get a hashable value for this object.
+   *
+   * @return the hashable value.
+   */
+  public int hashCode() {
+     return (int)swigCPtr;
+  }
+  
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // JNIHelper.swg: End generated code
+
+/**
+ * Makes a pool of pictures laid out as<br>
+ * MediaPicture#make(int, int, PixelFormat.Type) lays them out.<br>
+ * <br>
+ * @param width Number of pixels wide.<br>
+ * @param height Number of pixels high.<br>
+ * @param format PixelFormat.Type of the pictures.<br>
+ * @param capacity The most released pictures to keep for reuse.<br>
+ * <br>
+ * @return the pool, empty until pictures are released to it.<br>
+ * <br>
+ * @throws InvalidArgument if width or height are not positive, format<br>
+ *   is PixelFormat.Type.PIX_FMT_NONE, or capacity is negative.
+ */
+  public static MediaPicturePool make(int width, int height, PixelFormat.Type format, int capacity) {
+    long cPtr = VideoJNI.MediaPicturePool_make(width, height, format.swigValue(), capacity);
+    return (cPtr == 0) ? null : new MediaPicturePool(cPtr, false);
+  }
+
+/**
+ * Gets a picture, reusing a released one if the pool has any.<br>
+ * <br>
+ * @return a picture of this pool's width, height and format.
+ */
+  public MediaPicture getPicture() {
+    long cPtr = VideoJNI.MediaPicturePool_getPicture(swigCPtr, this);
+    return (cPtr == 0) ? null : new MediaPicture(cPtr, false);
+  }
+
+/**
+ *  @return the width of the pictures.
+ */
+  public int getWidth() {
+    return VideoJNI.MediaPicturePool_getWidth(swigCPtr, this);
+  }
+
+/**
+ *  @return the height of the pictures.
+ */
+  public int getHeight() {
+    return VideoJNI.MediaPicturePool_getHeight(swigCPtr, this);
+  }
+
+/**
+ *  @return the format of the pictures.
+ */
+  public PixelFormat.Type getFormat() {
+    return PixelFormat.Type.swigToEnum(VideoJNI.MediaPicturePool_getFormat(swigCPtr, this));
+  }
+
+/**
+ *  @return the most released pictures kept for reuse.
+ */
+  public int getCapacity() {
+    return VideoJNI.MediaPicturePool_getCapacity(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of released pictures waiting to be reused.
+ */
+  public int getNumIdle() {
+    return VideoJNI.MediaPicturePool_getNumIdle(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of times #getPicture() reused a picture.
+ */
+  public long getNumReused() {
+    return VideoJNI.MediaPicturePool_getNumReused(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of times #getPicture() had to make a new one.
+ */
+  public long getNumAllocated() {
+    return VideoJNI.MediaPicturePool_getNumAllocated(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of released pictures taken back for reuse.
+ */
+  public long getNumRecycled() {
+    return VideoJNI.MediaPicturePool_getNumRecycled(swigCPtr, this);
+  }
+
+/**
+ * @return the number of released pictures freed instead, because the<br>
+ *   pool was full or they could not be reused.
+ */
+  public long getNumDiscarded() {
+    return VideoJNI.MediaPicturePool_getNumDiscarded(swigCPtr, this);
+  }
+
+/**
+ * Zeros the reused, allocated, recycled and discarded counts.
+ */
+  public void resetStatistics() {
+    VideoJNI.MediaPicturePool_resetStatistics(swigCPtr, this);
+  }
+
+}
@@ -177,6 +177,85 @@ public class MediaPictureResampler extends MediaResampler {
     return PixelFormat.Type.swigToEnum(VideoJNI.MediaPictureResampler_getOutputFormat(swigCPtr, this));
   }
 
+/**
+ * Set the number of threads to resample each picture with. The output<br>
+ * picture is split into horizontal bands that are scaled in parallel on<br>
+ * a worker pool shared by the whole process, and the result is<br>
+ * identical, byte for byte, to resampling with one thread.<br>
+ * <p><br>
+ * Bands are only used when the vertical scale factor lets each band<br>
+ * reproduce exactly what a single pass would do: the input height over<br>
+ * the output height must be exact in 1/65536ths (for example 2160 to<br>
+ * 1080 or 720, but not 720 to 1080), both heights must be multiples of<br>
+ * their formats' chroma subsampling, and error diffusion dithering must<br>
+ * be off. Otherwise, and for pictures too short to split, the resampler<br>
+ * quietly uses one thread; see #getNumBands().<br>
+ * </p><br>
+ * Must be called before #open().<br>
+ * <br>
+ * @param threads The number of threads, 0 for one per CPU, or 1 (the<br>
+ *   default) to resample on the calling thread only.
+ */
+  public void setThreads(int threads) {
+    VideoJNI.MediaPictureResampler_setThreads(swigCPtr, this, threads);
+  }
+
+/**
+ * @return the number of threads set with #setThreads(int).
+ */
+  public int getThreads() {
+    return VideoJNI.MediaPictureResampler_getThreads(swigCPtr, this);
+  }
+
+/**
+ * Get the number of bands each picture is split into.<br>
+ * @return the number of bands, or 1 if the resampler is not open or<br>
+ *   pictures are resampled in a single pass.
+ */
+  public int getNumBands() {
+    return VideoJNI.MediaPictureResampler_getNumBands(swigCPtr, this);
+  }
+
+/**
+ * Set whether dedicated conversion routines may be used instead of the<br>
+ * general purpose rescaler when the parameters allow it.<br>
+ * <p><br>
+ * YUV420P and NV12 are converted to and from BGR24, RGBA and GRAY8, at<br>
+ * the same size or at half the width and height (with even sizes), by<br>
+ * routines written for SSE4 and AVX2 and picked at run time for the CPU.<br>
+ * They are much faster, but do not match the general rescaler: chroma<br>
+ * is repeated rather than interpolated and rounding differs, so colors<br>
+ * can be off by a few levels, and by up to 20 where chroma changes<br>
+ * sharply. They are not used when the flags ask for<br>
+ * FLAG_ACCURATE_RND, FLAG_BITEXACT, FLAG_FULL_CHR_H_INT,<br>
+ * FLAG_FULL_CHR_H_INP or FLAG_ERROR_DIFFUSION, and they convert on the<br>
+ * calling thread, whatever #setThreads(int) says.<br>
+ * </p><br>
+ * Must be called before #open().<br>
+ * <br>
+ * @param fastPaths true to allow them, false (the default) to always use<br>
+ *   the general rescaler.
+ */
+  public void setFastPaths(boolean fastPaths) {
+    VideoJNI.MediaPictureResampler_setFastPaths(swigCPtr, this, fastPaths);
+  }
+
+/**
+ * @return whether dedicated conversion routines are allowed.<br>
+ * @see #setFastPaths(boolean)
+ */
+  public boolean getFastPaths() {
+    return VideoJNI.MediaPictureResampler_getFastPaths(swigCPtr, this);
+  }
+
+/**
+ * @return true if this resampler is open and converting with one of the<br>
+ *   dedicated routines described in #setFastPaths(boolean).
+ */
+  public boolean usesFastPath() {
+    return VideoJNI.MediaPictureResampler_usesFastPath(swigCPtr, this);
+  }
+
 /**
  * Opens the resampler so it can be ready for resampling.<br>
  * You should NOT set options after you open this object.
@@ -225,6 +304,107 @@ public class MediaPictureResampler extends MediaResampler {
     return (cPtr == 0) ? null : new MediaPictureResampler(cPtr, false);
   }
 
+/**
+ * Sets how many idle rescalers the process keeps for reuse.<br>
+ * <p><br>
+ * Setting up a rescaler builds filter tables for the sizes, formats and<br>
+ * flags it converts between, which can cost more than converting a<br>
+ * picture. When a resampler is deleted its rescaler is kept, and a later<br>
+ * resampler made with the same parameters takes it over instead of<br>
+ * building a new one. Each rescaler is used by one resampler at a time,<br>
+ * and scales exactly as a new one would; ones whose error diffusion<br>
+ * dithering carries over from picture to picture are not kept.<br>
+ * </p><br>
+ * <br>
+ * @param maxContexts the most idle rescalers to keep; the least recently<br>
+ *   used are freed first. 0 turns reuse off. Defaults to 16.
+ */
+  public static void setCacheSize(int maxContexts) {
+    VideoJNI.MediaPictureResampler_setCacheSize(maxContexts);
+  }
+
+/**
+ * @return the most idle rescalers kept for reuse.<br>
+ * @see #setCacheSize(int)
+ */
+  public static int getCacheSize() {
+    return VideoJNI.MediaPictureResampler_getCacheSize();
+  }
+
+/**
+ * @return the number of resamplers (or bands of them) that reused a<br>
+ *   kept rescaler.
+ */
+  public static long getCacheHits() {
+    return VideoJNI.MediaPictureResampler_getCacheHits();
+  }
+
+/**
+ * @return the number of resamplers (or bands of them) that had to set<br>
+ *   up a new rescaler.
+ */
+  public static long getCacheMisses() {
+    return VideoJNI.MediaPictureResampler_getCacheMisses();
+  }
+
+/**
+ * @return the number of idle rescalers freed to stay within<br>
+ *   #getCacheSize().
+ */
+  public static long getCacheEvictions() {
+    return VideoJNI.MediaPictureResampler_getCacheEvictions();
+  }
+
+/**
+ * Zeros the hit, miss and eviction counts.
+ */
+  public static void resetCacheStatistics() {
+    VideoJNI.MediaPictureResampler_resetCacheStatistics();
+  }
+
+/**
+ * Resamples in straight into out, with no copy through a picture of the<br>
+ * output parameters. out holds the picture as MediaPicture#make(Buffer,<br>
+ * int, int, PixelFormat.Type) lays one out: rows and planes with no<br>
+ * padding between them. The bytes of a java.awt.image.BufferedImage of<br>
+ * type TYPE_3BYTE_BGR are laid out that way, for one.<br>
+ * <p><br>
+ * The Java heap is pinned while the resampler writes to out, so the<br>
+ * garbage collector may wait for the conversion to finish. For the same<br>
+ * reason it runs in one pass on the calling thread, whatever<br>
+ * #setThreads(int) says.<br>
+ * </p><br>
+ * <br>
+ * @param out The array to resample to.<br>
+ * @param in The picture we'll resample from.<br>
+ * <br>
+ * @return the number of rows written.<br>
+ * <br>
+ * @throws InvalidArgument if in does not match the parameters this<br>
+ *         resampler was set with, or out is too small.
+ */
+  public int resampleToBytes(byte[] out, MediaPicture in) {
+    return VideoJNI.MediaPictureResampler_resampleToBytes(swigCPtr, this, out, MediaPicture.getCPtr(in), in);
+  }
+
+/**
+ * Resamples the picture in holds straight into out, with no copy through<br>
+ * a picture of the input parameters; in is laid out as described in<br>
+ * #resampleToBytes(byte[], MediaPicture). out is marked complete, but its<br>
+ * time stamp and time base are left for the caller to set.<br>
+ * <br>
+ * @param out The picture we'll resample to.<br>
+ * @param in The array to resample from.<br>
+ * <br>
+ * @return the number of rows written.<br>
+ * <br>
+ * @throws InvalidArgument if out does not match the parameters this<br>
+ *         resampler was set with, or in is too small.
+ */
+  public int resampleFromBytes(MediaPicture out, byte[] in) {
+    return VideoJNI.MediaPictureResampler_resampleFromBytes(swigCPtr, this, MediaPicture.getCPtr(out), out, in);
+  }
+
   public enum Flag {
     FLAG_FAST_BILINEAR(VideoJNI.MediaPictureResampler_FLAG_FAST_BILINEAR_get()),
     FLAG_BILINEAR(VideoJNI.MediaPictureResampler_FLAG_BILINEAR_get()),
@@ -0,0 +1,289 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.6
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package io.humble.video;
+import io.humble.ferry.*;
+/**
+ * A ring of frames in POSIX shared memory, for passing MediaPicture and<br>
+ * MediaAudio objects between processes without encoding them or copying<br>
+ * them through a pipe.<br>
+ * <p><br>
+ * One process makes the ring under a name and writes to it; one other<br>
+ * process opens the same name and reads. Each write copies one picture or<br>
+ * audio frame, with its time stamp, time base and format, into the next<br>
+ * free slot. Each read returns an object whose data is the slot itself,<br>
+ * mapped into the reader, so nothing is copied on the way out.<br>
+ * </p><p><br>
+ * A slot goes back to the writer once the last reference to the data read<br>
+ * from it is released. A reader that holds on to frames therefore makes<br>
+ * the writer wait rather than have its frames overwritten; slots are<br>
+ * handed back in the order they were read.<br>
+ * </p><p><br>
+ * The two sides share only a count of slots written, changed only by the<br>
+ * writer, and a count of slots handed back, changed only by the reader,<br>
+ * so neither side ever locks the other out. A side with nothing to do<br>
+ * polls the other's count, backing off to a millisecond between looks.<br>
+ * </p><p><br>
+ * Use one ring per stream; a ring carries either pictures or audio.<br>
+ * </p>
+ */
+public class MediaRing extends RefCounted {
+  // JNIHelper.swg: Start generated code
+  // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+  /**
+   * This method is only here to use some references and remove
+   * a Eclipse compiler warning.
+   */
+  @SuppressWarnings("unused")
+  private void noop()
+  {
+    Buffer.make(null, 1);
+  }
+   
+  private volatile long swigCPtr;
+
+  /**
+   * Internal Only.
+   */
+  protected MediaRing(long cPtr, boolean cMemoryOwn) {
+    super(VideoJNI.MediaRing_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+  
+  /**
+   * Internal Only.
+   */
+  protected MediaRing(long cPtr, boolean cMemoryOwn,
+      java.util.concurrent.atomic.AtomicLong ref)
+  {
+    super(VideoJNI.MediaRing_SWIGUpcast(cPtr),
+     cMemoryOwn, ref);
+    swigCPtr = cPtr;
+  }
+    
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that obj is proxying for.
+   *   
+   * @param obj The java proxy object for a native object.
+   * @return The raw pointer obj is proxying for.
+   */
+  protected static long getCPtr(MediaRing obj) {
+    if (obj == null) return 0;
+    return obj.getMyCPtr();
+  }
+
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that we're proxying for.
+   *   
+   * @return The raw pointer we're proxying for.
+   */  
+  protected long getMyCPtr() {
+    if (swigCPtr == 0) throw new IllegalStateException("underlying native object already deleted");
+    return swigCPtr;
+  }
+  
+  /**
+   * Create a new MediaRing object that is actually referring to the
+   * exact same underlying native object.
+   *
+   * @return the new Java object.
+   */
+  @Override
+  public MediaRing copyReference() {
+    if (swigCPtr == 0)
+      return null;
+    else
+      return new MediaRing(swigCPtr, swigCMemOwn, getJavaRefCount());
+  }
+
+  /**
+   * Compares two values, returning true if the underlying objects in native code are the same object.
+   *
+   * That means you can have two different Java objects, but when you do a comparison, you'll find out
+   * they are the EXACT same object.
+   *
+   * @return True if the underlying native object is the same.  False otherwise.
+   */
+  public boolean equals(Object obj) {
+    boolean equal = false;
+    if (obj instanceof MediaRing)
+      equal = (((MediaRing)obj).swigCPtr == this.swigCPtr);
+    return equal;
+  }
+  
+  /**
+   * Get a hashable value for this object.
+   *
+   * @return the hashable value.
+   */
+  public int hashCode() {
+     return (int)swigCPtr;
+  }
+  
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // JNIHelper.swg: End generated code
+
+/**
+ * Makes a ring under name and opens it for writing.<br>
+ * <br>
+ * @param name The name readers open it by. A leading '/' is added if missing.<br>
+ * @param numSlots The most frames written but not yet handed back.<br>
+ * @param slotSize The most bytes of data one frame can hold. For pictures<br>
+ *   that is PixelFormat#getBufferSizeNeeded(int, int, PixelFormat.Type);<br>
+ *   for audio AudioFormat#getBufferSizeNeeded(int, int, AudioFormat.Type).<br>
+ * <br>
+ * @return the ring.<br>
+ * <br>
+ * @throws InvalidArgument if name is null or empty, numSlots &lt; 1 or slotSize &lt; 1.<br>
+ * @throws RuntimeError if the ring cannot be made, for example because<br>
+ *   a ring by that name already exists.
+ */
+  public static MediaRing make(String name, int numSlots, int slotSize) {
+    long cPtr = VideoJNI.MediaRing_make(name, numSlots, slotSize);
+    return (cPtr == 0) ? null : new MediaRing(cPtr, false);
+  }
+
+/**
+ * Opens a ring another process made, for reading.<br>
+ * <br>
+ * @param name The name the ring was made under.<br>
+ * <br>
+ * @return the ring.<br>
+ * <br>
+ * @throws InvalidArgument if name is null or empty.<br>
+ * @throws RuntimeError if there is no such ring, or it already has a reader.
+ */
+  public static MediaRing open(String name) {
+    long cPtr = VideoJNI.MediaRing_open(name);
+    return (cPtr == 0) ? null : new MediaRing(cPtr, false);
+  }
+
+/**
+ * @return the name this ring was made or opened under.
+ */
+  public String getName() {
+    return VideoJNI.MediaRing_getName(swigCPtr, this);
+  }
+
+/**
+ * @return true if this end writes; false if it reads.
+ */
+  public boolean isWriter() {
+    return VideoJNI.MediaRing_isWriter(swigCPtr, this);
+  }
+
+/**
+ * @return the number of slots in the ring.
+ */
+  public int getNumSlots() {
+    return VideoJNI.MediaRing_getNumSlots(swigCPtr, this);
+  }
+
+/**
+ * @return the most bytes of data one slot holds.
+ */
+  public int getSlotSize() {
+    return VideoJNI.MediaRing_getSlotSize(swigCPtr, this);
+  }
+
+/**
+ * @return the number of frames written and not yet handed back by the reader.
+ */
+  public int getNumQueued() {
+    return VideoJNI.MediaRing_getNumQueued(swigCPtr, this);
+  }
+
+/**
+ * Copies picture into the next free slot, waiting for one if needed.<br>
+ * <br>
+ * @param picture The picture to write.<br>
+ * @param timeout The most microseconds to wait for a free slot; a<br>
+ *   negative value waits as long as it takes.<br>
+ * <br>
+ * @return true if the picture was written; false if no slot came free in time.<br>
+ * <br>
+ * @throws InvalidArgument if picture is null or larger than #getSlotSize().<br>
+ * @throws RuntimeError if this end reads, this end is closed, or the reader has closed its end.
+ */
+  public boolean writePicture(MediaPicture picture, long timeout) {
+    return VideoJNI.MediaRing_writePicture(swigCPtr, this, MediaPicture.getCPtr(picture), picture, timeout);
+  }
+
+/**
+ * Copies the samples in audio into the next free slot, waiting for one if<br>
+ * needed.<br>
+ * <br>
+ * @param audio The audio to write.<br>
+ * @param timeout The most microseconds to wait for a free slot; a<br>
+ *   negative value waits as long as it takes.<br>
+ * <br>
+ * @return true if the audio was written; false if no slot came free in time.<br>
+ * <br>
+ * @throws InvalidArgument if audio is null or larger than #getSlotSize().<br>
+ * @throws RuntimeError if this end reads, this end is closed, or the reader has closed its end.
+ */
+  public boolean writeAudio(MediaAudio audio, long timeout) {
+    return VideoJNI.MediaRing_writeAudio(swigCPtr, this, MediaAudio.getCPtr(audio), audio, timeout);
+  }
+
+/**
+ * Reads the next picture, waiting for one if needed. Its data is the<br>
+ * slot itself; the slot is handed back once that data is released.<br>
+ * <br>
+ * @param timeout The most microseconds to wait; a negative value waits<br>
+ *   as long as it takes.<br>
+ * <br>
+ * @return the picture, or null if none was written in time or the<br>
+ *   writer has closed its end and every frame has been read.<br>
+ * <br>
+ * @throws RuntimeError if this end writes, or the next frame is audio.
+ */
+  public MediaPicture readPicture(long timeout) {
+    long cPtr = VideoJNI.MediaRing_readPicture(swigCPtr, this, timeout);
+    return (cPtr == 0) ? null : new MediaPicture(cPtr, false);
+  }
+
+/**
+ * Reads the next audio, waiting for it if needed. Its data is the<br>
+ * slot itself; the slot is handed back once that data is released.<br>
+ * <br>
+ * @param timeout The most microseconds to wait; a negative value waits<br>
+ *   as long as it takes.<br>
+ * <br>
+ * @return the audio, or null if none was written in time or the<br>
+ *   writer has closed its end and every frame has been read.<br>
+ * <br>
+ * @throws RuntimeError if this end writes, or the next frame is a picture.
+ */
+  public MediaAudio readAudio(long timeout) {
+    long cPtr = VideoJNI.MediaRing_readAudio(swigCPtr, this, timeout);
+    return (cPtr == 0) ? null : new MediaAudio(cPtr, false);
+  }
+
+/**
+ * Closes this end. A writer closing tells the reader no more frames are<br>
+ * coming, and removes the name; a reader closing makes further writes<br>
+ * fail. Frames already read stay valid. Called when the ring is<br>
+ * destroyed if not called before.
+ */
+  public void close() {
+    VideoJNI.MediaRing_close(swigCPtr, this);
+  }
+
+/**
+ * @return true if the other end has closed.
+ */
+  public boolean isPeerClosed() {
+    return VideoJNI.MediaRing_isPeerClosed(swigCPtr, this);
+  }
+
+}
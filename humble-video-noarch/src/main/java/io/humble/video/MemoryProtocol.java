@@ -0,0 +1,197 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.6
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package io.humble.video;
+import io.humble.ferry.*;
+/**
+ * Lets a Demuxer read from, and a Muxer write to, memory instead of files.<br>
+ * <p><br>
+ * Add the data to read under a name with #addSource(String, Buffer), then<br>
+ * open the URL "mem:" + name. Open "mem:" + name for writing and, once the<br>
+ * Muxer is closed, #takeOutput(String) returns everything written in one<br>
+ * Buffer.<br>
+ * </p><p><br>
+ * Data is served straight from the native memory of the Buffers (or direct<br>
+ * ByteBuffers) you add, and written into native memory that becomes the<br>
+ * output Buffer without a copy; reads and writes never call back into Java.<br>
+ * </p>
+ */
+public class MemoryProtocol extends RefCounted {
+  // JNIHelper.swg: Start generated code
+  // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+  /**
+   * This method is only here to use some references and remove
+   * a Eclipse compiler warning.
+   */
+  @SuppressWarnings("unused")
+  private void noop()
+  {
+    Buffer.make(null, 1);
+  }
+   
+  private volatile long swigCPtr;
+
+  /**
+   * Internal Only.
+   */
+  protected MemoryProtocol(long cPtr, boolean cMemoryOwn) {
+    super(VideoJNI.MemoryProtocol_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+  
+  /**
+   * Internal Only.
+   */
+  protected MemoryProtocol(long cPtr, boolean cMemoryOwn,
+      java.util.concurrent.atomic.AtomicLong ref)
+  {
+    super(VideoJNI.MemoryProtocol_SWIGUpcast(cPtr),
+     cMemoryOwn, ref);
+    swigCPtr = cPtr;
+  }
+    
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that obj is proxying for.
+   *   
+   * @param obj The java proxy object for a native object.
+   * @return The raw pointer obj is proxying for.
+   */
+  protected static long getCPtr(MemoryProtocol obj) {
+    if (obj == null) return 0;
+    return obj.getMyCPtr();
+  }
+
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that we're proxying for.
+   *   
+   * @return The raw pointer we're proxying for.
+   */  
+  protected long getMyCPtr() {
+    if (swigCPtr == 0) throw new IllegalStateException("underlying native object already deleted");
+    return swigCPtr;
+  }
+  
+  /**
+   * Create a new MemoryProtocol object that is actually referring to the
+   * exact same underlying native object.
+   *
+   * @return the new Java object.
+   */
+  @Override
+  public MemoryProtocol copyReference() {
+    if (swigCPtr == 0)
+      return null;
+    else
+      return new MemoryProtocol(swigCPtr, swigCMemOwn, getJavaRefCount());
+  }
+
+  /**
+   * Compares two values, returning true if the underlying objects in native code are the same object.
+   *
+   * That means you can have two different Java objects, but when you do a comparison, you'll find out
+   * they are the EXACT same object.
+   *
+   * @return True if the underlying native object is the same.  False otherwise.
+   */
+  public boolean equals(Object obj) {
+    boolean equal = false;
+    if (obj instanceof MemoryProtocol)
+      equal = (((MemoryProtocol)obj).swigCPtr == this.swigCPtr);
+    return equal;
+  }
+  
+  /**
+   * Get a hashable value for this object.
+   *
+   * @return the hashable value.
+   */
+  public int hashCode() {
+     return (int)swigCPtr;
+  }
+  
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // JNIHelper.swg: End generated code
+  /**
+   * Get the URL that reads or writes the data under name.
+   * @param name the name.
+   * @return getProtocolName() + ":" + name
+   */
+  public static String getURL(String name) {
+    return getProtocolName() + ":" + name;
+  }
+
+  /**
+   * Appends the remaining bytes of a direct ByteBuffer to the data read
+   * from "mem:" + name, without copying them.
+   * <p>
+   * Do not change the bytes while the source is in use.
+   * </p>
+   *
+   * @param name The name to read the data back as.
+   * @param directBuffer The data; must be direct.
+   * @see #addSource(String, Buffer)
+   */
+  public static void addSource(String name, java.nio.ByteBuffer directBuffer) {
+    if (directBuffer == null || !directBuffer.isDirect())
+      throw new IllegalArgumentException("need a direct ByteBuffer");
+    addSource(name, Buffer.make(null, directBuffer,
+        directBuffer.position(), directBuffer.remaining()));
+  }
+
+/**
+ * @return the protocol name to put in front of names in URLs: "mem".
+ */
+  public static String getProtocolName() {
+    return VideoJNI.MemoryProtocol_getProtocolName();
+  }
+
+/**
+ * Appends buffer to the data read from "mem:" + name. Readers see all the<br>
+ * buffers added under a name as one stream, in the order they were added,<br>
+ * so media larger than one Buffer can be added in pieces.<br>
+ * <p><br>
+ * Do not change the data in buffer while the source is in use.<br>
+ * </p><br>
+ * <br>
+ * @param name The name to read the data back as.<br>
+ * @param buffer The data. It is kept until #removeSource(String) is called.<br>
+ * <br>
+ * @throws InvalidArgument if name is null or empty, or buffer is null.
+ */
+  public static void addSource(String name, Buffer buffer) {
+    VideoJNI.MemoryProtocol_addSource(name, Buffer.getCPtr(buffer), buffer);
+  }
+
+/**
+ * Forgets the data added under name. Demuxers already reading it keep<br>
+ * reading.<br>
+ * <br>
+ * @param name The name the data was added as.<br>
+ * @return true if there was data under name.
+ */
+  public static boolean removeSource(String name) {
+    return VideoJNI.MemoryProtocol_removeSource(name);
+  }
+
+/**
+ * Takes what was written to "mem:" + name the last time a writer of it<br>
+ * closed. The data is only returned once.<br>
+ * <br>
+ * @param name The name written to.<br>
+ * @return The data, or null if nothing has been written to name.
+ */
+  public static Buffer takeOutput(String name) {
+    long cPtr = VideoJNI.MemoryProtocol_takeOutput(name);
+    return (cPtr == 0) ? null : new Buffer(cPtr, false);
+  }
+
+}
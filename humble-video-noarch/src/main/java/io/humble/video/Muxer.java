@@ -195,12 +195,14 @@ public class Muxer extends Container {
   }
 
 /**
- * Set the buffer length Humble Video will suggest to FFMPEG for writing output data.<br>
+ * Set the buffer length Humble Video will suggest to FFMPEG for writing output data<br>
+ * to an io.humble.video.customio.URLProtocolHandler.<br>
  * <br>
  * If called when a Container is open, the call is ignored and -1 is returned.<br>
  * <br>
- * @param size The suggested buffer size.<br>
- * @throws InvalidArgument if size &lt;= 0
+ * @param size The suggested buffer size, or 0 (the default) to let Humble Video<br>
+ *   pick a size from the handler and grow it while writing. See Container#getIOBufferLength().<br>
+ * @throws InvalidArgument if size &lt; 0
  */
   public void setOutputBufferLength(int size) {
     VideoJNI.Muxer_setOutputBufferLength(swigCPtr, this, size);
@@ -209,8 +211,8 @@ public class Muxer extends Container {
 /**
  * Return the output buffer length.<br>
  * <br>
- * @return The input buffer length Humble Video told FFMPEG to assume.<br>
- *   0 means FFMPEG should choose it's own size (and it'll probably be 32768).
+ * @return The output buffer length Humble Video told FFMPEG to assume.<br>
+ *   0 means Humble Video picks and adapts the size itself.
  */
   public int getOutputBufferLength() {
     return VideoJNI.Muxer_getOutputBufferLength(swigCPtr, this);
@@ -0,0 +1,344 @@
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (http://www.swig.org).
+ * Version 2.0.6
+ *
+ * Do not make changes to this file unless you know what you are doing--modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package io.humble.video;
+import io.humble.ferry.*;
+/**
+ * Makes sprite sheets: single pictures holding a grid of columns by rows<br>
+ * tiles, each a frame of a video scaled down, taken at a fixed interval.<br>
+ * A thumbnail strip is a sheet with one row.<br>
+ * <p><br>
+ * Each tile is scaled from the decoded frame straight into its place in<br>
+ * the sheet, and only the frames tiles need are decoded: the generator<br>
+ * seeks to the key frame before each tile's time, unless it is already<br>
+ * decoding forward from that key frame for an earlier tile, and decodes to<br>
+ * the first frame at or after the tile's time. With<br>
+ * #setKeyFramesOnly(boolean) it takes the key frame itself, decoding at<br>
+ * most one frame per tile.<br>
+ * </p><p><br>
+ * With #setThreads(int), each thread takes a run of neighbouring tiles and<br>
+ * reads the file through its own Demuxer. Demuxers, decoders and scalers<br>
+ * are kept between calls to #generate(int), so sheets made in order carry<br>
+ * on from where the last one stopped. A tile looks the same whichever<br>
+ * thread draws it and whatever was drawn before it.<br>
+ * </p><p><br>
+ * Times are in Global#DEFAULT_PTS_PER_SECOND units from the start of the<br>
+ * container.<br>
+ * </p>
+ */
+public class SpriteSheetGenerator extends RefCounted {
+  // JNIHelper.swg: Start generated code
+  // >>>>>>>>>>>>>>>>>>>>>>>>>>>
+  /**
+   * This method is only here to use some references and remove
+   * a Eclipse compiler warning.
+   */
+  @SuppressWarnings("unused")
+  private void noop()
+  {
+    Buffer.make(null, 1);
+  }
+   
+  private volatile long swigCPtr;
+
+  /**
+   * Internal Only.
+   */
+  protected SpriteSheetGenerator(long cPtr, boolean cMemoryOwn) {
+    super(VideoJNI.SpriteSheetGenerator_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+  
+  /**
+   * Internal Only.
+   */
+  protected SpriteSheetGenerator(long cPtr, boolean cMemoryOwn,
+      java.util.concurrent.atomic.AtomicLong ref)
+  {
+    super(VideoJNI.SpriteSheetGenerator_SWIGUpcast(cPtr),
+     cMemoryOwn, ref);
+    swigCPtr = cPtr;
+  }
+    
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that obj is proxying for.
+   *   
+   * @param obj The java proxy object for a native object.
+   * @return The raw pointer obj is proxying for.
+   */
+  protected static long getCPtr(SpriteSheetGenerator obj) {
+    if (obj == null) return 0;
+    return obj.getMyCPtr();
+  }
+
+  /**
+   * Internal Only.  Not part of public API.
+   *
+   * Get the raw value of the native object that we're proxying for.
+   *   
+   * @return The raw pointer we're proxying for.
+   */  
+  protected long getMyCPtr() {
+    if (swigCPtr == 0) throw new IllegalStateException("underlying native object already deleted");
+    return swigCPtr;
+  }
+  
+  /**
+   * Create a new SpriteSheetGenerator object that is actually referring to the
+   * exact same underlying native object.
+   *
+   * @return the new Java object.
+   */
+  @Override
+  public SpriteSheetGenerator copyReference() {
+    if (swigCPtr == 0)
+      return null;
+    else
+      return new SpriteSheetGenerator(swigCPtr, swigCMemOwn, getJavaRefCount());
+  }
+
+  /**
+   * Compares two values, returning true if the underlying objects in native code are the same object.
+   *
+   * That means you can have two different Java objects, but when you do a comparison, you'll find out
+   * they are the EXACT same object.
+   *
+   * @return True if the underlying native object is the same.  False otherwise.
+   */
+  public boolean equals(Object obj) {
+    boolean equal = false;
+    if (obj instanceof SpriteSheetGenerator)
+      equal = (((SpriteSheetGenerator)obj).swigCPtr == this.swigCPtr);
+    return equal;
+  }
+  
+  /**
+   * Get a hashable value for this object.
+   *
+   * @return the hashable value.
+   */
+  public int hashCode() {
+     return (int)swigCPtr;
+  }
+  
+  // <<<<<<<<<<<<<<<<<<<<<<<<<<<
+  // JNIHelper.swg: End generated code
+
+/**
+ * Makes a generator for the first video stream of url.<br>
+ * <br>
+ * @param url The file or URL to read; opened when first needed.<br>
+ * @param columns The number of tiles across a sheet.<br>
+ * @param rows The number of tiles down a sheet.<br>
+ * @param tileWidth The width of each tile, in pixels.<br>
+ * @param tileHeight The height of each tile, in pixels.<br>
+ * @param format The PixelFormat.Type of the sheets.<br>
+ * <br>
+ * @return a new generator.<br>
+ * <br>
+ * @throws InvalidArgument if url is null or empty, columns, rows, tile<br>
+ *   width or height are not positive, the tile width or height is not a<br>
+ *   multiple of format's chroma subsampling, or format is paletted,<br>
+ *   packs several pixels into a byte, or is a hardware format.
+ */
+  public static SpriteSheetGenerator make(String url, int columns, int rows, int tileWidth, int tileHeight, PixelFormat.Type format) {
+    long cPtr = VideoJNI.SpriteSheetGenerator_make(url, columns, rows, tileWidth, tileHeight, format.swigValue());
+    return (cPtr == 0) ? null : new SpriteSheetGenerator(cPtr, false);
+  }
+
+/**
+ *  @return the URL frames are read from.
+ */
+  public String getURL() {
+    return VideoJNI.SpriteSheetGenerator_getURL(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of tiles across a sheet.
+ */
+  public int getColumns() {
+    return VideoJNI.SpriteSheetGenerator_getColumns(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of tiles down a sheet.
+ */
+  public int getRows() {
+    return VideoJNI.SpriteSheetGenerator_getRows(swigCPtr, this);
+  }
+
+/**
+ *  @return the width of each tile.
+ */
+  public int getTileWidth() {
+    return VideoJNI.SpriteSheetGenerator_getTileWidth(swigCPtr, this);
+  }
+
+/**
+ *  @return the height of each tile.
+ */
+  public int getTileHeight() {
+    return VideoJNI.SpriteSheetGenerator_getTileHeight(swigCPtr, this);
+  }
+
+/**
+ *  @return the PixelFormat.Type of the sheets.
+ */
+  public PixelFormat.Type getFormat() {
+    return PixelFormat.Type.swigToEnum(VideoJNI.SpriteSheetGenerator_getFormat(swigCPtr, this));
+  }
+
+/**
+ * Sets the time between tiles.<br>
+ * <br>
+ * @param interval The time between tiles; 0 (the default) spreads the<br>
+ *   tiles of one sheet evenly over the whole video.<br>
+ * <br>
+ * @throws InvalidArgument if interval is negative.
+ */
+  public void setInterval(long interval) {
+    VideoJNI.SpriteSheetGenerator_setInterval(swigCPtr, this, interval);
+  }
+
+/**
+ *  @return the time between tiles, or 0 to spread one sheet over the video.
+ */
+  public long getInterval() {
+    return VideoJNI.SpriteSheetGenerator_getInterval(swigCPtr, this);
+  }
+
+/**
+ * Sets the time of the first tile of the first sheet.<br>
+ * <br>
+ * @param startTime The time of the first tile; defaults to 0.<br>
+ * <br>
+ * @throws InvalidArgument if startTime is negative.
+ */
+  public void setStartTime(long startTime) {
+    VideoJNI.SpriteSheetGenerator_setStartTime(swigCPtr, this, startTime);
+  }
+
+/**
+ *  @return the time of the first tile of the first sheet.
+ */
+  public long getStartTime() {
+    return VideoJNI.SpriteSheetGenerator_getStartTime(swigCPtr, this);
+  }
+
+/**
+ * Sets whether tiles show the key frame at or before their time rather<br>
+ * than the frame at their time. Much faster, as only key frames are<br>
+ * decoded, but tiles may repeat when key frames are further apart than<br>
+ * the interval.<br>
+ * <br>
+ * @param keyFramesOnly true to take key frames only; defaults to false.
+ */
+  public void setKeyFramesOnly(boolean keyFramesOnly) {
+    VideoJNI.SpriteSheetGenerator_setKeyFramesOnly(swigCPtr, this, keyFramesOnly);
+  }
+
+/**
+ *  @return true if tiles show key frames only.
+ */
+  public boolean isKeyFramesOnly() {
+    return VideoJNI.SpriteSheetGenerator_isKeyFramesOnly(swigCPtr, this);
+  }
+
+/**
+ * Sets the number of threads to make each sheet with.<br>
+ * <br>
+ * @param threads The number of threads; 0 for one per CPU. Defaults to<br>
+ *   1, to make sheets on the calling thread only.<br>
+ * <br>
+ * @throws InvalidArgument if threads is negative.
+ */
+  public void setThreads(int threads) {
+    VideoJNI.SpriteSheetGenerator_setThreads(swigCPtr, this, threads);
+  }
+
+/**
+ *  @return the number of threads sheets are made with; 0 for one per CPU.
+ */
+  public int getThreads() {
+    return VideoJNI.SpriteSheetGenerator_getThreads(swigCPtr, this);
+  }
+
+/**
+ * Gets the number of sheets it takes to cover the video.<br>
+ * <br>
+ * @return the number of sheets; 1 if the interval is 0 or the duration<br>
+ *   of the video is unknown.<br>
+ * <br>
+ * @throws RuntimeError if the video cannot be opened.
+ */
+  public int getNumSheets() throws java.lang.InterruptedException, java.io.IOException {
+    return VideoJNI.SpriteSheetGenerator_getNumSheets(swigCPtr, this);
+  }
+
+/**
+ * Makes a sheet. Tile i of sheet n, counting across and then down,<br>
+ * shows the video at time getStartTime() + (n * columns * rows + i) *<br>
+ * interval. Tiles past the end of the video are black.<br>
+ * <br>
+ * @param sheet Which sheet to make, from 0.<br>
+ * <br>
+ * @return a picture of columns * tile width by rows * tile height pixels,<br>
+ *   with the time of its first tile as its time stamp.<br>
+ * <br>
+ * @throws InvalidArgument if sheet is negative.<br>
+ * @throws RuntimeError if the video cannot be opened or decoded.
+ */
+  public MediaPicture generate(int sheet) throws java.lang.InterruptedException, java.io.IOException {
+    long cPtr = VideoJNI.SpriteSheetGenerator_generate(swigCPtr, this, sheet);
+    return (cPtr == 0) ? null : new MediaPicture(cPtr, false);
+  }
+
+/**
+ * Encodes a sheet as a still image.<br>
+ * <br>
+ * @param sheet The picture to encode, such as one #generate(int) made.<br>
+ * @param codec The Codec.ID of the image encoder, such as<br>
+ *   Codec.ID.CODEC_ID_PNG or Codec.ID.CODEC_ID_MJPEG. The sheet is<br>
+ *   converted to a pixel format the encoder takes if need be, preferring<br>
+ *   full range YUV for JPEG.<br>
+ * <br>
+ * @return a packet holding the encoded image.<br>
+ * <br>
+ * @throws InvalidArgument if sheet is null or incomplete, or there is no<br>
+ *   encoder for codec.<br>
+ * @throws RuntimeError if the sheet cannot be encoded.
+ */
+  public static MediaPacket encode(MediaPicture sheet, Codec.ID codec) {
+    long cPtr = VideoJNI.SpriteSheetGenerator_encode(MediaPicture.getCPtr(sheet), sheet, codec.swigValue());
+    return (cPtr == 0) ? null : new MediaPacket(cPtr, false);
+  }
+
+/**
+ *  @return the number of frames decoded since the last #resetStatistics().
+ */
+  public long getNumFramesDecoded() {
+    return VideoJNI.SpriteSheetGenerator_getNumFramesDecoded(swigCPtr, this);
+  }
+
+/**
+ *  @return the number of seeks made since the last #resetStatistics().
+ */
+  public long getNumSeeks() {
+    return VideoJNI.SpriteSheetGenerator_getNumSeeks(swigCPtr, this);
+  }
+
+/**
+ *  Zeros the decoded frame and seek counts.
+ */
+  public void resetStatistics() {
+    VideoJNI.SpriteSheetGenerator_resetStatistics(swigCPtr, this);
+  }
+
+}
@@ -423,6 +423,8 @@ public class VideoJNI {
   public final static native long MediaPicture_make__SWIG_0(int jarg1, int jarg2, int jarg3);
   public final static native long MediaPicture_make__SWIG_1(long jarg1, Buffer jarg1_, int jarg2, int jarg3, int jarg4);
   public final static native long MediaPicture_make__SWIG_2(long jarg1, MediaPicture jarg1_, boolean jarg2);
+  public final static native long MediaPicture_make__SWIG_3(int jarg1, int jarg2, int jarg3, int jarg4);
+  public final static native long MediaPicture_makeView(long jarg1, MediaPicture jarg1_, int jarg2, int jarg3, int jarg4, int jarg5);
   public final static native long MediaPicture_getData(long jarg1, MediaPicture jarg1_, int jarg2);
   public final static native int MediaPicture_getDataPlaneSize(long jarg1, MediaPicture jarg1_, int jarg2);
   public final static native int MediaPicture_getNumDataPlanes(long jarg1, MediaPicture jarg1_);
@@ -560,10 +562,24 @@ public class VideoJNI {
   public final static native int MediaPictureResampler_getOutputWidth(long jarg1, MediaPictureResampler jarg1_);
   public final static native int MediaPictureResampler_getOutputHeight(long jarg1, MediaPictureResampler jarg1_);
   public final static native int MediaPictureResampler_getOutputFormat(long jarg1, MediaPictureResampler jarg1_);
+  public final static native void MediaPictureResampler_setThreads(long jarg1, MediaPictureResampler jarg1_, int jarg2);
+  public final static native int MediaPictureResampler_getThreads(long jarg1, MediaPictureResampler jarg1_);
+  public final static native int MediaPictureResampler_getNumBands(long jarg1, MediaPictureResampler jarg1_);
+  public final static native void MediaPictureResampler_setFastPaths(long jarg1, MediaPictureResampler jarg1_, boolean jarg2);
+  public final static native boolean MediaPictureResampler_getFastPaths(long jarg1, MediaPictureResampler jarg1_);
+  public final static native boolean MediaPictureResampler_usesFastPath(long jarg1, MediaPictureResampler jarg1_);
   public final static native void MediaPictureResampler_open(long jarg1, MediaPictureResampler jarg1_);
   public final static native int MediaPictureResampler_resample(long jarg1, MediaPictureResampler jarg1_, long jarg2, MediaSampled jarg2_, long jarg3, MediaSampled jarg3_);
   public final static native int MediaPictureResampler_resamplePicture(long jarg1, MediaPictureResampler jarg1_, long jarg2, MediaPicture jarg2_, long jarg3, MediaPicture jarg3_);
   public final static native long MediaPictureResampler_make(int jarg1, int jarg2, int jarg3, int jarg4, int jarg5, int jarg6, int jarg7);
+  public final static native void MediaPictureResampler_setCacheSize(int jarg1);
+  public final static native int MediaPictureResampler_getCacheSize();
+  public final static native long MediaPictureResampler_getCacheHits();
+  public final static native long MediaPictureResampler_getCacheMisses();
+  public final static native long MediaPictureResampler_getCacheEvictions();
+  public final static native void MediaPictureResampler_resetCacheStatistics();
+  public final static native int MediaPictureResampler_resampleToBytes(long jarg1, MediaPictureResampler jarg1_, byte[] jarg2, long jarg3, MediaPicture jarg3_);
+  public final static native int MediaPictureResampler_resampleFromBytes(long jarg1, MediaPictureResampler jarg1_, long jarg2, MediaPicture jarg2_, byte[] jarg3);
   public final static native long MediaAudioResampler_make(int jarg1, int jarg2, int jarg3, int jarg4, int jarg5, int jarg6);
   public final static native int MediaAudioResampler_getOutputLayout(long jarg1, MediaAudioResampler jarg1_);
   public final static native int MediaAudioResampler_getInputLayout(long jarg1, MediaAudioResampler jarg1_);
@@ -573,6 +589,9 @@ public class VideoJNI {
   public final static native int MediaAudioResampler_getInputFormat(long jarg1, MediaAudioResampler jarg1_);
   public final static native int MediaAudioResampler_getInputChannels(long jarg1, MediaAudioResampler jarg1_);
   public final static native int MediaAudioResampler_getOutputChannels(long jarg1, MediaAudioResampler jarg1_);
+  public final static native void MediaAudioResampler_setFastPaths(long jarg1, MediaAudioResampler jarg1_, boolean jarg2);
+  public final static native boolean MediaAudioResampler_getFastPaths(long jarg1, MediaAudioResampler jarg1_);
+  public final static native boolean MediaAudioResampler_usesFastPath(long jarg1, MediaAudioResampler jarg1_);
   public final static native void MediaAudioResampler_open(long jarg1, MediaAudioResampler jarg1_);
   public final static native int MediaAudioResampler_resample(long jarg1, MediaAudioResampler jarg1_, long jarg2, MediaSampled jarg2_, long jarg3, MediaSampled jarg3_);
   public final static native int MediaAudioResampler_resampleAudio(long jarg1, MediaAudioResampler jarg1_, long jarg2, MediaAudio jarg2_, long jarg3, MediaAudio jarg3_);
@@ -585,6 +604,7 @@ public class VideoJNI {
   public final static native long MediaAudioResampler_getTimeBase(long jarg1, MediaAudioResampler jarg1_);
   public final static native void MediaAudioResampler_setTimeBase(long jarg1, MediaAudioResampler jarg1_, long jarg2, Rational jarg2_);
   public final static native int MediaAudioResampler_getState(long jarg1, MediaAudioResampler jarg1_);
+  public final static native int MediaAudioResampler_java_resampleBatch(long jarg1, MediaAudioResampler jarg1_, long[] jarg2, long[] jarg3);
   public final static native int MediaDescriptor_MEDIA_UNKNOWN_get();
   public final static native int MediaDescriptor_MEDIA_VIDEO_get();
   public final static native int MediaDescriptor_MEDIA_AUDIO_get();
@@ -1329,10 +1349,19 @@ public class VideoJNI {
   public final static native int Container_FLAG_PRIV_OPT_get();
   public final static native int Container_FLAG_KEEP_SIDE_DATA_get();
   public final static native int Container_getNumStreams(long jarg1, Container jarg1_) throws java.lang.InterruptedException, java.io.IOException;
+  public final static native long Container_getIOReadCalls(long jarg1, Container jarg1_);
+  public final static native long Container_getIOBytesRead(long jarg1, Container jarg1_);
+  public final static native long Container_getIOWriteCalls(long jarg1, Container jarg1_);
+  public final static native long Container_getIOBytesWritten(long jarg1, Container jarg1_);
+  public final static native long Container_getIOSeekCalls(long jarg1, Container jarg1_);
+  public final static native long Container_getIOTime(long jarg1, Container jarg1_);
+  public final static native int Container_getIOBufferLength(long jarg1, Container jarg1_);
   public final static native long MuxerStream_getCoder(long jarg1, MuxerStream jarg1_);
   public final static native long MuxerStream_getMuxer(long jarg1, MuxerStream jarg1_);
   public final static native long DemuxerStream_getDecoder(long jarg1, DemuxerStream jarg1_);
   public final static native long DemuxerStream_getDemuxer(long jarg1, DemuxerStream jarg1_);
+  public final static native int DemuxerStream_getDiscard(long jarg1, DemuxerStream jarg1_);
+  public final static native void DemuxerStream_setDiscard(long jarg1, DemuxerStream jarg1_, int jarg2);
   public final static native long Muxer_make(String jarg1, long jarg2, MuxerFormat jarg2_, String jarg3);
   public final static native String Muxer_getURL(long jarg1, Muxer jarg1_);
   public final static native long Muxer_getFormat(long jarg1, Muxer jarg1_);
@@ -1366,6 +1395,12 @@ public class VideoJNI {
   public final static native String Demuxer_getURL(long jarg1, Demuxer jarg1_);
   public final static native int Demuxer_getReadRetryCount(long jarg1, Demuxer jarg1_);
   public final static native void Demuxer_setReadRetryCount(long jarg1, Demuxer jarg1_, int jarg2);
+  public final static native void Demuxer_setReadAhead(long jarg1, Demuxer jarg1_, int jarg2, int jarg3, long jarg4);
+  public final static native boolean Demuxer_isReadAhead(long jarg1, Demuxer jarg1_);
+  public final static native void Demuxer_setProbeCacheSize(int jarg1);
+  public final static native int Demuxer_getProbeCacheSize();
+  public final static native int Demuxer_loadProbeCache(String jarg1);
+  public final static native void Demuxer_saveProbeCache(String jarg1);
   public final static native boolean Demuxer_canStreamsBeAddedDynamically(long jarg1, Demuxer jarg1_);
   public final static native long Demuxer_getMetaData(long jarg1, Demuxer jarg1_);
   public final static native int Demuxer_setForcedAudioCodec(long jarg1, Demuxer jarg1_, int jarg2);
@@ -1376,9 +1411,13 @@ public class VideoJNI {
   public final static native int Demuxer_SEEK_ANY_get();
   public final static native int Demuxer_SEEK_FRAME_get();
   public final static native int Demuxer_seek(long jarg1, Demuxer jarg1_, int jarg2, long jarg3, long jarg4, long jarg5, int jarg6) throws java.lang.InterruptedException, java.io.IOException;
+  public final static native int Demuxer_buildSeekIndex(long jarg1, Demuxer jarg1_) throws java.lang.InterruptedException, java.io.IOException;
+  public final static native void Demuxer_saveSeekIndex(long jarg1, Demuxer jarg1_, String jarg2);
+  public final static native int Demuxer_loadSeekIndex(long jarg1, Demuxer jarg1_, String jarg2);
   public final static native int Demuxer_getMaxDelay(long jarg1, Demuxer jarg1_);
   public final static native void Demuxer_play(long jarg1, Demuxer jarg1_) throws java.lang.InterruptedException, java.io.IOException;
   public final static native void Demuxer_pause(long jarg1, Demuxer jarg1_) throws java.lang.InterruptedException, java.io.IOException;
+  public final static native int Demuxer_java_readBatch(long jarg1, Demuxer jarg1_, long[] jarg2, int jarg3, long jarg4) throws java.lang.InterruptedException, java.io.IOException;
   public final static native int FilterType_FILTER_FLAG_UNKNOWN_get();
   public final static native int FilterType_FILTER_FLAG_DYNAMIC_INPUTS_get();
   public final static native int FilterType_FILTER_FLAG_DYNAMIC_OUTPUTS_get();
@@ -1466,6 +1505,108 @@ public class VideoJNI {
   public final static native String BitStreamFilter_getName(long jarg1, BitStreamFilter jarg1_);
   public final static native int BitStreamFilter_filter__SWIG_0(long jarg1, BitStreamFilter jarg1_, long jarg2, Buffer jarg2_, int jarg3, long jarg4, Buffer jarg4_, int jarg5, int jarg6, long jarg7, Coder jarg7_, String jarg8, boolean jarg9);
   public final static native void BitStreamFilter_filter__SWIG_1(long jarg1, BitStreamFilter jarg1_, long jarg2, MediaPacket jarg2_, String jarg3);
+  public final static native long FrameSeeker_make(long jarg1, Demuxer jarg1_, int jarg2, int jarg3);
+  public final static native long FrameSeeker_seekToFrame(long jarg1, FrameSeeker jarg1_, long jarg2) throws java.lang.InterruptedException, java.io.IOException;
+  public final static native int FrameSeeker_getStreamIndex(long jarg1, FrameSeeker jarg1_);
+  public final static native long FrameSeeker_getDecoder(long jarg1, FrameSeeker jarg1_);
+  public final static native int FrameSeeker_getMaxCachedGops(long jarg1, FrameSeeker jarg1_);
+  public final static native int FrameSeeker_getNumCachedGops(long jarg1, FrameSeeker jarg1_);
+  public final static native long FrameSeeker_getMaxCachedBytes(long jarg1, FrameSeeker jarg1_);
+  public final static native void FrameSeeker_setMaxCachedBytes(long jarg1, FrameSeeker jarg1_, long jarg2);
+  public final static native long FrameSeeker_getCachedBytes(long jarg1, FrameSeeker jarg1_);
+  public final static native void FrameSeeker_clearCache(long jarg1, FrameSeeker jarg1_);
+  public final static native String MemoryProtocol_getProtocolName();
+  public final static native void MemoryProtocol_addSource(String jarg1, long jarg2, Buffer jarg2_);
+  public final static native boolean MemoryProtocol_removeSource(String jarg1);
+  public final static native long MemoryProtocol_takeOutput(String jarg1);
+  public final static native String CachingProtocol_getProtocolName();
+  public final static native long CachingProtocol_getMaxBytes();
+  public final static native void CachingProtocol_setMaxBytes(long jarg1);
+  public final static native long CachingProtocol_getCachedBytes();
+  public final static native int CachingProtocol_getBlockSize();
+  public final static native long CachingProtocol_getHits();
+  public final static native long CachingProtocol_getMisses();
+  public final static native long CachingProtocol_getWaits();
+  public final static native long CachingProtocol_getEvictions();
+  public final static native void CachingProtocol_resetStatistics();
+  public final static native void CachingProtocol_clear();
+  public final static native long MediaRing_make(String jarg1, int jarg2, int jarg3);
+  public final static native long MediaRing_open(String jarg1);
+  public final static native String MediaRing_getName(long jarg1, MediaRing jarg1_);
+  public final static native boolean MediaRing_isWriter(long jarg1, MediaRing jarg1_);
+  public final static native int MediaRing_getNumSlots(long jarg1, MediaRing jarg1_);
+  public final static native int MediaRing_getSlotSize(long jarg1, MediaRing jarg1_);
+  public final static native int MediaRing_getNumQueued(long jarg1, MediaRing jarg1_);
+  public final static native boolean MediaRing_writePicture(long jarg1, MediaRing jarg1_, long jarg2, MediaPicture jarg2_, long jarg3);
+  public final static native boolean MediaRing_writeAudio(long jarg1, MediaRing jarg1_, long jarg2, MediaAudio jarg2_, long jarg3);
+  public final static native long MediaRing_readPicture(long jarg1, MediaRing jarg1_, long jarg2);
+  public final static native long MediaRing_readAudio(long jarg1, MediaRing jarg1_, long jarg2);
+  public final static native void MediaRing_close(long jarg1, MediaRing jarg1_);
+  public final static native boolean MediaRing_isPeerClosed(long jarg1, MediaRing jarg1_);
+  public final static native long MediaPicturePool_make(int jarg1, int jarg2, int jarg3, int jarg4);
+  public final static native long MediaPicturePool_getPicture(long jarg1, MediaPicturePool jarg1_);
+  public final static native int MediaPicturePool_getWidth(long jarg1, MediaPicturePool jarg1_);
+  public final static native int MediaPicturePool_getHeight(long jarg1, MediaPicturePool jarg1_);
+  public final static native int MediaPicturePool_getFormat(long jarg1, MediaPicturePool jarg1_);
+  public final static native int MediaPicturePool_getCapacity(long jarg1, MediaPicturePool jarg1_);
+  public final static native int MediaPicturePool_getNumIdle(long jarg1, MediaPicturePool jarg1_);
+  public final static native long MediaPicturePool_getNumReused(long jarg1, MediaPicturePool jarg1_);
+  public final static native long MediaPicturePool_getNumAllocated(long jarg1, MediaPicturePool jarg1_);
+  public final static native long MediaPicturePool_getNumRecycled(long jarg1, MediaPicturePool jarg1_);
+  public final static native long MediaPicturePool_getNumDiscarded(long jarg1, MediaPicturePool jarg1_);
+  public final static native void MediaPicturePool_resetStatistics(long jarg1, MediaPicturePool jarg1_);
+  public final static native long MediaAudioPool_make(int jarg1, int jarg2, int jarg3, int jarg4, int jarg5, int jarg6);
+  public final static native long MediaAudioPool_getAudio(long jarg1, MediaAudioPool jarg1_);
+  public final static native int MediaAudioPool_getNumSamples(long jarg1, MediaAudioPool jarg1_);
+  public final static native int MediaAudioPool_getSampleRate(long jarg1, MediaAudioPool jarg1_);
+  public final static native int MediaAudioPool_getChannels(long jarg1, MediaAudioPool jarg1_);
+  public final static native int MediaAudioPool_getChannelLayout(long jarg1, MediaAudioPool jarg1_);
+  public final static native int MediaAudioPool_getFormat(long jarg1, MediaAudioPool jarg1_);
+  public final static native int MediaAudioPool_getCapacity(long jarg1, MediaAudioPool jarg1_);
+  public final static native int MediaAudioPool_getNumIdle(long jarg1, MediaAudioPool jarg1_);
+  public final static native long MediaAudioPool_getNumReused(long jarg1, MediaAudioPool jarg1_);
+  public final static native long MediaAudioPool_getNumAllocated(long jarg1, MediaAudioPool jarg1_);
+  public final static native long MediaAudioPool_getNumRecycled(long jarg1, MediaAudioPool jarg1_);
+  public final static native long MediaAudioPool_getNumDiscarded(long jarg1, MediaAudioPool jarg1_);
+  public final static native void MediaAudioPool_resetStatistics(long jarg1, MediaAudioPool jarg1_);
+  public final static native long SpriteSheetGenerator_make(String jarg1, int jarg2, int jarg3, int jarg4, int jarg5, int jarg6);
+  public final static native String SpriteSheetGenerator_getURL(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native int SpriteSheetGenerator_getColumns(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native int SpriteSheetGenerator_getRows(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native int SpriteSheetGenerator_getTileWidth(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native int SpriteSheetGenerator_getTileHeight(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native int SpriteSheetGenerator_getFormat(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native void SpriteSheetGenerator_setInterval(long jarg1, SpriteSheetGenerator jarg1_, long jarg2);
+  public final static native long SpriteSheetGenerator_getInterval(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native void SpriteSheetGenerator_setStartTime(long jarg1, SpriteSheetGenerator jarg1_, long jarg2);
+  public final static native long SpriteSheetGenerator_getStartTime(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native void SpriteSheetGenerator_setKeyFramesOnly(long jarg1, SpriteSheetGenerator jarg1_, boolean jarg2);
+  public final static native boolean SpriteSheetGenerator_isKeyFramesOnly(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native void SpriteSheetGenerator_setThreads(long jarg1, SpriteSheetGenerator jarg1_, int jarg2);
+  public final static native int SpriteSheetGenerator_getThreads(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native int SpriteSheetGenerator_getNumSheets(long jarg1, SpriteSheetGenerator jarg1_) throws java.lang.InterruptedException, java.io.IOException;
+  public final static native long SpriteSheetGenerator_generate(long jarg1, SpriteSheetGenerator jarg1_, int jarg2) throws java.lang.InterruptedException, java.io.IOException;
+  public final static native long SpriteSheetGenerator_encode(long jarg1, MediaPicture jarg1_, int jarg2);
+  public final static native long SpriteSheetGenerator_getNumFramesDecoded(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native long SpriteSheetGenerator_getNumSeeks(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native void SpriteSheetGenerator_resetStatistics(long jarg1, SpriteSheetGenerator jarg1_);
+  public final static native long MediaAudioMixer_make(int jarg1, int jarg2, int jarg3, int jarg4);
+  public final static native int MediaAudioMixer_getSampleRate(long jarg1, MediaAudioMixer jarg1_);
+  public final static native int MediaAudioMixer_getChannelLayout(long jarg1, MediaAudioMixer jarg1_);
+  public final static native int MediaAudioMixer_getChannels(long jarg1, MediaAudioMixer jarg1_);
+  public final static native int MediaAudioMixer_getFormat(long jarg1, MediaAudioMixer jarg1_);
+  public final static native int MediaAudioMixer_getFrameSize(long jarg1, MediaAudioMixer jarg1_);
+  public final static native void MediaAudioMixer_setMaxDelay(long jarg1, MediaAudioMixer jarg1_, int jarg2);
+  public final static native int MediaAudioMixer_getMaxDelay(long jarg1, MediaAudioMixer jarg1_);
+  public final static native int MediaAudioMixer_addInput(long jarg1, MediaAudioMixer jarg1_, double jarg2);
+  public final static native int MediaAudioMixer_getNumInputs(long jarg1, MediaAudioMixer jarg1_);
+  public final static native void MediaAudioMixer_setGain(long jarg1, MediaAudioMixer jarg1_, int jarg2, double jarg3);
+  public final static native double MediaAudioMixer_getGain(long jarg1, MediaAudioMixer jarg1_, int jarg2);
+  public final static native void MediaAudioMixer_addAudio(long jarg1, MediaAudioMixer jarg1_, int jarg2, long jarg3, MediaAudio jarg3_);
+  public final static native void MediaAudioMixer_endInput(long jarg1, MediaAudioMixer jarg1_, int jarg2);
+  public final static native int MediaAudioMixer_getNumBuffered(long jarg1, MediaAudioMixer jarg1_, int jarg2);
+  public final static native int MediaAudioMixer_mix(long jarg1, MediaAudioMixer jarg1_, long jarg2, MediaAudio jarg2_);
+  public final static native long MediaAudioMixer_getNumDroppedSamples(long jarg1, MediaAudioMixer jarg1_);
   public final static native long PixelFormat_SWIGUpcast(long jarg1);
   public final static native long PixelComponentDescriptor_SWIGUpcast(long jarg1);
   public final static native long PixelFormatDescriptor_SWIGUpcast(long jarg1);
@@ -1518,4 +1659,12 @@ public class VideoJNI {
   public final static native long FilterPictureSink_SWIGUpcast(long jarg1);
   public final static native long BitStreamFilterType_SWIGUpcast(long jarg1);
   public final static native long BitStreamFilter_SWIGUpcast(long jarg1);
+  public final static native long FrameSeeker_SWIGUpcast(long jarg1);
+  public final static native long MemoryProtocol_SWIGUpcast(long jarg1);
+  public final static native long CachingProtocol_SWIGUpcast(long jarg1);
+  public final static native long MediaRing_SWIGUpcast(long jarg1);
+  public final static native long MediaPicturePool_SWIGUpcast(long jarg1);
+  public final static native long MediaAudioPool_SWIGUpcast(long jarg1);
+  public final static native long SpriteSheetGenerator_SWIGUpcast(long jarg1);
+  public final static native long MediaAudioMixer_SWIGUpcast(long jarg1);
 }
@@ -100,6 +100,38 @@ abstract class AMediaPictureConverter implements MediaPictureConverter
     int pictureHeight,
     int imageWidth, 
     int imageHeight)
+  {
+    this(pictureType, requiredPictureType, imageType, pictureWidth,
+      pictureHeight, imageWidth, imageHeight, false);
+  }
+
+  /** 
+   * Construct an abstract Converter, choosing whether its
+   * {@link MediaPictureResampler}s may use their dedicated conversion
+   * routines.
+   *
+   * @param pictureType the recognized {@link MediaPicture} type
+   * @param requiredPictureType the picture type requred to translate to
+   *        and from the BufferedImage
+   * @param imageType the recognized {@link BufferedImage} type
+   * @param pictureWidth the width of picture
+   * @param pictureHeight the height of picture
+   * @param imageWidth the width of image
+   * @param imageHeight the height of image
+   * @param fastPaths true to let the resamplers use dedicated routines
+   *        where they have them; see
+   *        {@link MediaPictureResampler#setFastPaths(boolean)}
+   */
+
+  public AMediaPictureConverter(
+    PixelFormat.Type pictureType, 
+    PixelFormat.Type requiredPictureType, 
+    int imageType,
+    int pictureWidth, 
+    int pictureHeight,
+    int imageWidth, 
+    int imageHeight,
+    boolean fastPaths)
   {
     // by default there is no resample description
 
@@ -126,11 +158,13 @@ abstract class AMediaPictureConverter implements MediaPictureConverter
       mToImageResampler = MediaPictureResampler.make(
           mImageWidth, mImageHeight, mRequiredPictureType,
         mPictureWidth, mPictureHeight, mPictureType, 0);
+      mToImageResampler.setFastPaths(fastPaths);
       mToImageResampler.open();
 
       mToPictureResampler = MediaPictureResampler.make(
         mPictureWidth, mPictureHeight, mPictureType,
         mImageWidth, mImageHeight, mRequiredPictureType, 0);
+      mToPictureResampler.setFastPaths(fastPaths);
       mToPictureResampler.open();
 
       resampleDescription = "Pictures will be resampled to and from " + 
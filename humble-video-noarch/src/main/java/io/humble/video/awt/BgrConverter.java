@@ -37,6 +37,7 @@ import java.awt.image.Raster;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
 import java.nio.IntBuffer;
+import java.util.Arrays;
 import java.util.concurrent.atomic.AtomicReference;
 
 /**
@@ -56,7 +57,8 @@ class BgrConverter extends AMediaPictureConverter {
   private static final ColorSpace mColorSpace = ColorSpace
       .getInstance(ColorSpace.CS_sRGB);
 
-  // a private copy we use as the resample buffer when converting back and forth. saves time.
+  // a private copy we use as the resample buffer when converting back and
+  // forth images that can't be resampled in place. saves time.
   private MediaPicture mResampleMediaPicture;
 
   /**
@@ -77,11 +79,48 @@ class BgrConverter extends AMediaPictureConverter {
 
   public BgrConverter(PixelFormat.Type pictureType, int pictureWidth,
       int pictureHeight, int imageWidth, int imageHeight) {
+    this(pictureType, pictureWidth, pictureHeight, imageWidth, imageHeight,
+        false);
+  }
+
+  /**
+   * Construct as converter to translate {@link MediaPicture}s to and from
+   * {@link BufferedImage}s of type {@link BufferedImage#TYPE_3BYTE_BGR},
+   * choosing whether resampling may use dedicated conversion routines.
+   * 
+   * @param pictureType
+   *          the picture type recognized by this converter
+   * @param pictureWidth
+   *          the width of pictures
+   * @param pictureHeight
+   *          the height of pictures
+   * @param imageWidth
+   *          the width of images
+   * @param imageHeight
+   *          the height of images
+   * @param fastPaths
+   *          true to let resampling use dedicated routines; see
+   *          {@link io.humble.video.MediaPictureResampler#setFastPaths(boolean)}
+   */
+
+  public BgrConverter(PixelFormat.Type pictureType, int pictureWidth,
+      int pictureHeight, int imageWidth, int imageHeight, boolean fastPaths) {
     super(pictureType, PixelFormat.Type.PIX_FMT_BGR24,
         BufferedImage.TYPE_3BYTE_BGR, pictureWidth, pictureHeight, imageWidth,
-        imageHeight);
-    mResampleMediaPicture = willResample() ? MediaPicture.make(imageWidth,
-        imageHeight, getRequiredPictureType()) : null;
+        imageHeight, fastPaths);
+  }
+
+  /**
+   * Gets the picture images are copied through when they can't be
+   * resampled in place, making it the first time it's needed.
+   */
+
+  private MediaPicture getResamplePicture() {
+    // packed, so its rows line up with the image's
+    if (mResampleMediaPicture == null)
+      mResampleMediaPicture = MediaPicture.make(mImageWidth, mImageHeight,
+          getRequiredPictureType(), 1);
+    return mResampleMediaPicture;
   }
 
   /** {@inheritDoc} */
@@ -123,25 +162,51 @@ class BgrConverter extends AMediaPictureConverter {
               + imageBuffer.getDataType());
     }
 
+    // resample straight from the image's bytes when they are laid out as
+    // the resampler expects, rather than copying them to a picture first
+
+    if (willResample() && imageBytes != null && isPacked(input)) {
+      mToPictureResampler.resampleFromBytes(output, imageBytes);
+      output.setTimeStamp(timestamp);
+      return output;
+    }
+
+    final int rowSize = 3 * mImageWidth;
+
     // create the video picture and get it's underlying buffer
 
     final AtomicReference<JNIReference> ref = new AtomicReference<JNIReference>(
         null);
-    final MediaPicture picture = willResample() ? mResampleMediaPicture : output;
+    final MediaPicture picture = willResample() ? getResamplePicture() : output;
     try {
       Buffer buffer = picture.getData(0);
       int size = picture.getDataPlaneSize(0);
+      int lineSize = picture.getLineSize(0);
       ByteBuffer pictureByteBuffer = buffer.getByteBuffer(0,
           size, ref);
       buffer.delete();
       buffer = null;
 
-      if (imageInts != null) {
+      if (imageInts != null && lineSize == rowSize) {
         pictureByteBuffer.order(ByteOrder.BIG_ENDIAN);
         IntBuffer pictureIntBuffer = pictureByteBuffer.asIntBuffer();
         pictureIntBuffer.put(imageInts);
       } else {
-        pictureByteBuffer.put(imageBytes);
+        if (imageInts != null) {
+          // rows of the picture are padded; go through bytes
+          ByteBuffer bytes = ByteBuffer.allocate(4 * imageInts.length);
+          bytes.order(ByteOrder.BIG_ENDIAN);
+          bytes.asIntBuffer().put(imageInts);
+          imageBytes = bytes.array();
+        }
+        if (lineSize == rowSize) {
+          pictureByteBuffer.put(imageBytes, 0, rowSize * mImageHeight);
+        } else {
+          for (int row = 0; row < mImageHeight; row++) {
+            pictureByteBuffer.position(row * lineSize);
+            pictureByteBuffer.put(imageBytes, row * rowSize, rowSize);
+          }
+        }
       }
       pictureByteBuffer = null;
       picture.setTimeStamp(timestamp);
@@ -164,7 +229,7 @@ class BgrConverter extends AMediaPictureConverter {
     validatePicture(input);
     // test that the picture is valid
     if (output == null) {
-      final byte[] bytes = new byte[willResample() ? mResampleMediaPicture.getDataPlaneSize(0) : input.getDataPlaneSize(0)];
+      final byte[] bytes = new byte[3 * mImageWidth * mImageHeight];
       // create the data buffer from the bytes
       
       final DataBufferByte db = new DataBufferByte(bytes, bytes.length);
@@ -189,18 +254,30 @@ class BgrConverter extends AMediaPictureConverter {
       output = new BufferedImage(colorModel, wr, false, null);
     }
 
+    // resample straight into the image's bytes when they are laid out as
+    // the resampler writes them, rather than through a picture
+
+    if (willResample() && isPacked(output)) {
+      final byte[] bytes = ((DataBufferByte) output.getRaster()
+          .getDataBuffer()).getData();
+      mToImageResampler.resampleToBytes(bytes, input);
+      return output;
+    }
+
     MediaPicture picture;
     // resample as needed
     AtomicReference<JNIReference> ref = new AtomicReference<JNIReference>(null);
     try {
       if (willResample()) {
-        picture = resample(mResampleMediaPicture, input, mToImageResampler);
+        picture = resample(getResamplePicture(), input, mToImageResampler);
       } else {
         picture = input;
       }
 
       final Buffer buffer = picture.getData(0);
       final int size = picture.getDataPlaneSize(0);
+      final int lineSize = picture.getLineSize(0);
+      final int rowSize = 3 * mImageWidth;
       final ByteBuffer byteBuf = buffer.getByteBuffer(0,
           size, ref);
       buffer.delete();
@@ -209,8 +286,15 @@ class BgrConverter extends AMediaPictureConverter {
       final DataBufferByte db = (DataBufferByte) output.getRaster()
           .getDataBuffer();
       final byte[] bytes = db.getData();
-      // and copy them in.
-      byteBuf.get(bytes, 0, size);
+      // and copy them in, a row at a time if the picture's are padded.
+      if (lineSize == rowSize) {
+        byteBuf.get(bytes, 0, rowSize * mImageHeight);
+      } else {
+        for (int row = 0; row < mImageHeight; row++) {
+          byteBuf.position(row * lineSize);
+          byteBuf.get(bytes, row * rowSize, rowSize);
+        }
+      }
 
       // return a new image created from the color model and raster
 
@@ -221,6 +305,34 @@ class BgrConverter extends AMediaPictureConverter {
     }
   }
 
+  /**
+   * Tests whether the pixels of an image are BGR bytes with no padding
+   * between rows, starting at the beginning of its one data bank, which
+   * is how a resampler reads and writes a packed BGR24 picture.
+   * 
+   * @param image the image to test
+   * 
+   * @return true if a resampler can use the image's bytes directly.
+   */
+
+  private boolean isPacked(BufferedImage image) {
+    final WritableRaster raster = image.getRaster();
+    if (!(raster.getDataBuffer() instanceof DataBufferByte)
+        || !(raster.getSampleModel() instanceof PixelInterleavedSampleModel))
+      return false;
+    final DataBufferByte db = (DataBufferByte) raster.getDataBuffer();
+    final PixelInterleavedSampleModel sm = (PixelInterleavedSampleModel) raster
+        .getSampleModel();
+    final int[] bandOffsets = sm.getBandOffsets();
+    return db.getNumBanks() == 1 && db.getOffset() == 0
+        && raster.getSampleModelTranslateX() == 0
+        && raster.getSampleModelTranslateY() == 0
+        && raster.getWidth() == mImageWidth
+        && raster.getHeight() == mImageHeight
+        && sm.getPixelStride() == 3 && sm.getScanlineStride() == 3 * mImageWidth
+        && Arrays.equals(bandOffsets, mBandOffsets);
+  }
+
   public void delete() {
     if (mResampleMediaPicture != null)
       mResampleMediaPicture.delete();
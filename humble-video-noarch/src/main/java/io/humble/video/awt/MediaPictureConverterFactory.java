@@ -308,6 +308,44 @@ public class MediaPictureConverterFactory
     PixelFormat.Type pictureType, 
     int pictureWidth, int pictureHeight,
     int imageWidth, int imageHeight)
+  {
+    return createConverter(converterDescriptor, pictureType,
+      pictureWidth, pictureHeight, imageWidth, imageHeight, false);
+  }
+
+  /** 
+   * Create a converter which translates betewen {@link BufferedImage}
+   * and {@link MediaPicture} types, choosing whether the pictures it
+   * resamples may go through dedicated conversion routines rather than
+   * the general rescaler.  Those are faster, but their colors can be off
+   * by a few levels; see
+   * {@link io.humble.video.MediaPictureResampler#setFastPaths(boolean)}.
+   * If no converter can be created, a descriptive {@link
+   * UnsupportedOperationException} is thrown.
+   *
+   * @param converterDescriptor the unique string descriptor of the
+   *        converter which is to be created
+   * @param pictureType the picture type of the converter
+   * @param pictureWidth the width of pictures
+   * @param pictureHeight the height of pictures
+   * @param imageWidth the width of images
+   * @param imageHeight the height of images
+   * @param fastPaths true to allow dedicated conversion routines; the
+   *        converter then needs a constructor of the form
+   *        (PixelFormat.Type, int, int, int, int, boolean)
+   *
+   * @throws UnsupportedOperationException if the converter can not be
+   *         found
+   * @throws UnsupportedOperationException if the converter can not be
+   *         properly created or initialized
+   */
+
+  public static MediaPictureConverter createConverter(
+    String converterDescriptor,
+    PixelFormat.Type pictureType, 
+    int pictureWidth, int pictureHeight,
+    int imageWidth, int imageHeight,
+    boolean fastPaths)
   {
     MediaPictureConverter converter = null;
     
@@ -322,23 +360,35 @@ public class MediaPictureConverterFactory
 
     try
     {
-      // establish the constructor 
-
-      Constructor<? extends MediaPictureConverter> converterConstructor = 
-        converterType.getConverterClass().getConstructor(PixelFormat.Type.class,
-          int.class, int.class, int.class, int.class);
+      // establish the constructor and create the converter; only
+      // converters asked for fast paths need a constructor that takes
+      // the flag
 
-      // create the converter
-
-      converter = converterConstructor.newInstance(
-        pictureType, pictureWidth, pictureHeight, imageWidth, imageHeight);
+      if (fastPaths)
+      {
+        Constructor<? extends MediaPictureConverter> converterConstructor = 
+          converterType.getConverterClass().getConstructor(PixelFormat.Type.class,
+            int.class, int.class, int.class, int.class, boolean.class);
+        converter = converterConstructor.newInstance(
+          pictureType, pictureWidth, pictureHeight, imageWidth, imageHeight,
+          true);
+      }
+      else
+      {
+        Constructor<? extends MediaPictureConverter> converterConstructor = 
+          converterType.getConverterClass().getConstructor(PixelFormat.Type.class,
+            int.class, int.class, int.class, int.class);
+        converter = converterConstructor.newInstance(
+          pictureType, pictureWidth, pictureHeight, imageWidth, imageHeight);
+      }
     }
     catch (NoSuchMethodException e)
     {
       throw new UnsupportedOperationException(
         "Converter " + converterType.getConverterClass() + 
         " requries a constructor of the form "  +
-        "(PixelFormat.Type, int, int, int, int)");
+        "(PixelFormat.Type, int, int, int, int" +
+        (fastPaths ? ", boolean)" : ")"));
     }
     catch (InvocationTargetException e)
     {
@@ -107,6 +107,16 @@ public class FfmpegIO
     return native_url_seek(handle, position, whence);
   }
 
+  /**
+   * The number of direct {@link java.nio.ByteBuffer}s made so far to hand
+   * FFmpeg's IO buffers to {@link IURLProtocolByteBufferHandler}s; for
+   * testing that they are reused.
+   */
+  static long getNumDirectBuffersMade()
+  {
+    return native_getNumDirectBuffersMade();
+  }
+
   private static native int native_registerProtocolHandler(
       String urlPrefix, URLProtocolManager proto);
 
@@ -124,4 +134,6 @@ public class FfmpegIO
 
   private static native int native_url_close(FfmpegIOHandle handle);
 
+  private static native long native_getNumDirectBuffersMade();
+
 }
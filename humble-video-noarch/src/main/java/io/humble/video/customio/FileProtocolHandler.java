@@ -21,6 +21,8 @@ package io.humble.video.customio;
 import java.io.File;
 import java.io.IOException;
 import java.io.RandomAccessFile;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
@@ -36,7 +38,7 @@ import io.humble.video.customio.IURLProtocolHandler;
  * @author aclarke
  *
  */
-public class FileProtocolHandler implements IURLProtocolHandler
+public class FileProtocolHandler implements IURLProtocolByteBufferHandler
 {
   File file = null;
   RandomAccessFile stream = null;
@@ -157,6 +159,22 @@ public class FileProtocolHandler implements IURLProtocolHandler
     }
   }
 
+  public int read(ByteBuffer buf)
+  {
+    try
+    {
+      final FileChannel channel = stream.getChannel();
+      int ret = channel.read(buf);
+      return ret < 0 ? 0 : ret;
+    }
+    catch (IOException e)
+    {
+      log.error("Got IO exception reading from file: {}", file);
+      e.printStackTrace();
+      return -1;
+    }
+  }
+
   public long seek(long offset, int whence)
   {
     try
@@ -207,6 +225,24 @@ public class FileProtocolHandler implements IURLProtocolHandler
     }
   }
 
+  public int write(ByteBuffer buf)
+  {
+    try
+    {
+      final FileChannel channel = stream.getChannel();
+      final int size = buf.remaining();
+      while (buf.hasRemaining())
+        channel.write(buf);
+      return size;
+    }
+    catch (IOException e)
+    {
+      log.error("Got error writing to file: {}", file);
+      e.printStackTrace();
+      return -1;
+    }
+  }
+
   private String getFilename(String url)
   {
     String retval = url;
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright (c) 2013, Art Clarke.  All rights reserved.
+ *  
+ * This file is part of Humble-Video.
+ *
+ * Humble-Video is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Humble-Video is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Humble-Video.  If not, see <http://www.gnu.org/licenses/>.
+ *******************************************************************************/
+
+package io.humble.video.customio;
+
+import java.nio.ByteBuffer;
+
+/**
+ * An {@link IURLProtocolHandler} that can move data through
+ * {@link ByteBuffer} objects instead of temporary byte arrays.
+ * <p>
+ * When a handler implements this interface Humble Video calls
+ * {@link #read(ByteBuffer)} and {@link #write(ByteBuffer)} instead of
+ * {@link #read(byte[], int)} and {@link #write(byte[], int)}. The buffers
+ * passed are direct buffers that wrap FFmpeg's whole IO buffer, and are
+ * reused from call to call with their position and limit moved to frame
+ * the bytes in play, so no Java objects are allocated and no extra copies
+ * are made per read or write.
+ * </p>
+ * <p>
+ * The buffers are only valid for the duration of the call they are passed
+ * to. Implementations must only touch the bytes between the buffer's
+ * position and limit, must not assume the position is 0, and must not keep
+ * a reference to the buffer after returning.
+ * </p>
+ * <p>
+ * The byte array methods are still required by {@link IURLProtocolHandler}, but
+ * will not be called by Humble Video for handlers that implement this
+ * interface.
+ * </p>
+ * @see ReadableWritableChannelHandler
+ * @see FileProtocolHandler
+ */
+public interface IURLProtocolByteBufferHandler extends IURLProtocolHandler
+{
+  /**
+   * This method gets called by FFMPEG when it tries to read data.
+   * <p>
+   * Non-blocking and interrupt semantics are the same as for
+   * {@link IURLProtocolHandler#read(byte[], int)}.
+   * </p>
+   * 
+   * @param buf A direct buffer to put your data into. FFMPEG would like
+   *   {@link ByteBuffer#remaining()} bytes written between its position and
+   *   its limit; write no more than that, starting at the current position.
+   * @return 0 for end of file, else number of bytes you put in the buffer, or -1 if error.
+   */
+  public int read(ByteBuffer buf);
+
+  /**
+   * This method gets called by FFMPEG when it tries to write data.
+   * <p>
+   * Non-blocking and interrupt semantics are the same as for
+   * {@link IURLProtocolHandler#write(byte[], int)}.
+   * </p>
+   * 
+   * @param buf A read-only direct buffer holding the data you should write,
+   *   between its position and its limit.
+   * @return 0 for end of file, else number of bytes you consumed from buf, or -1 if error.
+   */
+  public int write(ByteBuffer buf);
+}
@@ -39,12 +39,19 @@ import org.slf4j.LoggerFactory;
  * {@link #isStreamed(String, int)} will always return true.
  * 
  * </p>
+ * <p>
+ * 
+ * Humble Video reads and writes through {@link #read(ByteBuffer)} and
+ * {@link #write(ByteBuffer)}, which hand FFmpeg's buffers straight to the
+ * channel.
+ * 
+ * </p>
  * 
  * @author aclarke
  * 
  */
 
-public class ReadableWritableChannelHandler implements IURLProtocolHandler
+public class ReadableWritableChannelHandler implements IURLProtocolByteBufferHandler
 {
   private final Logger log = LoggerFactory.getLogger(this.getClass());
 
@@ -200,6 +207,29 @@ public class ReadableWritableChannelHandler implements IURLProtocolHandler
     }
   }
 
+  /**
+   * {@inheritDoc}
+   */
+
+  public int read(ByteBuffer buf)
+  {
+    if (mOpenStream == null || !(mOpenStream instanceof ReadableByteChannel))
+      return -1;
+
+    try
+    {
+      ReadableByteChannel channel = (ReadableByteChannel) mOpenStream;
+      int ret = channel.read(buf);
+      return ret < 0 ? 0 : ret;
+    }
+    catch (IOException e)
+    {
+      log.error("Got IO exception reading from channel: {}; {}",
+          mOpenStream, e);
+      return -1;
+    }
+  }
+
   /**
    * {@inheritDoc}
    * 
@@ -236,6 +266,28 @@ public class ReadableWritableChannelHandler implements IURLProtocolHandler
     }
   }
 
+  /**
+   * {@inheritDoc}
+   */
+
+  public int write(ByteBuffer buf)
+  {
+    if (mOpenStream == null ||
+        !(mOpenStream instanceof WritableByteChannel))
+      return -1;
+
+    try
+    {
+      WritableByteChannel channel = (WritableByteChannel) mOpenStream;
+      return channel.write(buf);
+    }
+    catch (IOException e)
+    {
+      log.error("Got error writing to file: {}; {}", mOpenStream, e);
+      return -1;
+    }
+  }
+
   /**
    * {@inheritDoc}
    * Always true for this class. 
@@ -228,6 +228,68 @@ public class MediaPictureConverterFactoryTest
   }
 
 
+  // fast paths are off unless asked for; asking reaches the resamplers,
+  // and the round trip still comes back gray.
+
+  @Test
+  public void testImageToImageSolidColorWithFastPaths()
+  {
+    int w = TEST_WIDTH;
+    int h = TEST_HEIGHT;
+    int gray  = Color.GRAY.getRGB();
+
+    // create the converters
+
+    MediaPictureConverter converter = MediaPictureConverterFactory.createConverter(
+      mConverterType.getDescriptor(), mPixelType, w, h, w, h, true);
+    MediaPictureConverter plain = MediaPictureConverterFactory.createConverter(
+      mConverterType.getDescriptor(), mPixelType, w, h);
+
+    if (converter.willResample() && converter instanceof AMediaPictureConverter)
+    {
+      AMediaPictureConverter fast = (AMediaPictureConverter)converter;
+      assertTrue(fast.mToImageResampler.getFastPaths());
+      assertTrue(fast.mToPictureResampler.getFastPaths());
+      AMediaPictureConverter slow = (AMediaPictureConverter)plain;
+      assertFalse(slow.mToImageResampler.getFastPaths());
+      assertFalse(slow.mToImageResampler.usesFastPath());
+      if (mPixelType == PixelFormat.Type.PIX_FMT_YUV420P &&
+          fast.getRequiredPictureType() == PixelFormat.Type.PIX_FMT_BGR24)
+      {
+        assertTrue(fast.mToImageResampler.usesFastPath());
+        assertTrue(fast.mToPictureResampler.usesFastPath());
+      }
+    }
+
+    // construct an all gray image
+
+    BufferedImage image1 = new BufferedImage(
+      w, h, mConverterType.getImageType());
+    for (int x = 0; x < w; ++x)
+      for (int y = 0; y < h; ++y)
+        image1.setRGB(x, y, gray);
+
+    // convert image1 to a picture and then back to image2
+
+    BufferedImage image2 = converter.toImage(null,
+      converter.toPicture(null, image1, 0));
+
+    for (int x = 0; x < w; ++x)
+      for (int y = 0; y < h; ++y)
+      {
+        int pixel1 = image1.getRGB(x, y);
+        int pixel2 = image2.getRGB(x, y);
+
+        String message = testPixels(
+          mConverterType.getPictureType() == converter.getPictureType(),
+          pixel1, pixel2, x, y, 
+          converter.getPictureType());
+        assertNull(message, message);
+      }
+    converter.delete();
+    plain.delete();
+  }
+
   // this test makes user of mPixelType which, and thus the solid color
   // test attempts to test across colors spaces.
 
@@ -18,12 +18,20 @@
  *******************************************************************************/
 package io.humble.video.customio;
 
+import static org.junit.Assert.assertArrayEquals;
 import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import java.io.File;
+import java.net.URL;
+import java.nio.ByteBuffer;
 
 import org.junit.Before;
 import org.junit.BeforeClass;
 import org.junit.Test;
 
+import io.humble.video.Demuxer;
+import io.humble.video.MediaPacket;
 import io.humble.video.customio.FfmpegIO;
 import io.humble.video.customio.FfmpegIOHandle;
 import io.humble.video.customio.IURLProtocolHandler;
@@ -76,6 +84,66 @@ public class URLProtocolHandlerTest
       return mHandler;
     }
   };
+  private static byte[] mBufferHandlerWritten;
+  private static final IURLProtocolByteBufferHandler mBufferHandler = new IURLProtocolByteBufferHandler()
+  {
+    public int close()
+    {
+      return 0;
+    }
+
+    public boolean isStreamed(String aUrl, int aFlags)
+    {
+      return true;
+    }
+
+    public int open(String aUrl, int aFlags)
+    {
+      return 0;
+    }
+
+    public int read(byte[] aBuf, int aSize)
+    {
+      throw new IllegalStateException("should read through ByteBuffer");
+    }
+
+    public int read(ByteBuffer aBuf)
+    {
+      if (!aBuf.isDirect())
+        throw new IllegalStateException("expected a direct buffer");
+      int size = aBuf.remaining();
+      for(int i = 0; i < size; i++)
+        aBuf.put((byte)i);
+      return size;
+    }
+
+    public long seek(long aOffset, int aWhence)
+    {
+      return -1;
+    }
+
+    public int write(byte[] aBuf, int aSize)
+    {
+      throw new IllegalStateException("should write through ByteBuffer");
+    }
+
+    public int write(ByteBuffer aBuf)
+    {
+      if (!aBuf.isDirect() || !aBuf.isReadOnly())
+        throw new IllegalStateException("expected a read-only direct buffer");
+      mBufferHandlerWritten = new byte[aBuf.remaining()];
+      aBuf.get(mBufferHandlerWritten);
+      return mBufferHandlerWritten.length;
+    }
+  };
+  private static final IURLProtocolHandlerFactory mBufferFactory = new IURLProtocolHandlerFactory()
+  {
+    public IURLProtocolHandler getHandler(String aProtocol, String aUrl,
+        int aFlags)
+    {
+      return mBufferHandler;
+    }
+  };
   private final byte[] mBuffer = new byte[10];
   private FfmpegIOHandle mHandle;
   
@@ -83,6 +151,7 @@ public class URLProtocolHandlerTest
   public static void beforeClass()
   {
     mMgr.registerFactory("test", mFactory);
+    mMgr.registerFactory("testbuf", mBufferFactory);
   }
   
   @Before
@@ -138,6 +207,56 @@ public class URLProtocolHandlerTest
     assertEquals("should fail", -1, retval);
   }
 
+  @Test
+  public void testByteBufferRead()
+  {
+    assertEquals(0, FfmpegIO.url_open(mHandle, "testbuf:read", IURLProtocolHandler.URL_RDONLY_MODE));
+    // twice, so the second read reuses the cached direct buffer
+    for(int j = 0; j < 2; j++) {
+      java.util.Arrays.fill(mBuffer, (byte)-1);
+      assertEquals(mBuffer.length, FfmpegIO.url_read(mHandle, mBuffer, mBuffer.length));
+      for(int i = 0; i < mBuffer.length; i++)
+        assertEquals(i, mBuffer[i]);
+    }
+    assertEquals(0, FfmpegIO.url_close(mHandle));
+  }
+
+  @Test
+  public void testByteBufferWrite()
+  {
+    for(int i = 0; i < mBuffer.length; i++)
+      mBuffer[i] = (byte)(i*2);
+    assertEquals(0, FfmpegIO.url_open(mHandle, "testbuf:write", IURLProtocolHandler.URL_WRONLY_MODE));
+    for(int j = 0; j < 2; j++) {
+      mBufferHandlerWritten = null;
+      assertEquals(mBuffer.length, FfmpegIO.url_write(mHandle, mBuffer, mBuffer.length));
+      assertArrayEquals(mBuffer, mBufferHandlerWritten);
+    }
+    assertEquals(0, FfmpegIO.url_close(mHandle));
+  }
+
+  @Test
+  public void testByteBufferDemuxReusesBuffers() throws InterruptedException, java.io.IOException
+  {
+    final URL s = this.getClass().getResource("/ucl_h264_aac.mp4");
+    final String url = URLProtocolManager.DEFAULT_PROTOCOL + ":" +
+        new File(s.getPath()).getPath();
+    final long made = FfmpegIO.getNumDirectBuffersMade();
+    final Demuxer source = Demuxer.make();
+    source.open(url, null, false, true, null, null);
+    final MediaPacket packet = MediaPacket.make();
+    int numPackets = 0;
+    while(source.read(packet) >= 0)
+      ++numPackets;
+    source.close();
+    // FFmpeg hands over a different slice of its IO buffer on most reads;
+    // they should all be framed on the same few direct buffers.
+    final long rebuilt = FfmpegIO.getNumDirectBuffersMade() - made;
+    assertTrue("no packets read", numPackets > 100);
+    assertTrue("rebuilt direct buffers " + rebuilt + " times for " +
+        numPackets + " packets", rebuilt <= 8);
+  }
+
   @Test
   public void testURLProtocolManagerGetResource()
   {